@@ -290,6 +290,20 @@ subroutine FWrap_CopyContState(SrcContStateData, DstContStateData, CtrlCode, Err
    DstContStateData%dummy = SrcContStateData%dummy
 end subroutine
 
+subroutine FWrap_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(FWrap_ContinuousStateType), intent(inout) :: ContStateData1
+   type(FWrap_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_dummy
+   character(*), parameter        :: RoutineName = 'FWrap_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = ContStateData1%dummy
+   ContStateData1%dummy = ContStateData2%dummy
+   ContStateData2%dummy = tmp_dummy
+end subroutine
+
 subroutine FWrap_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(FWrap_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -328,6 +342,20 @@ subroutine FWrap_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, Err
    DstDiscStateData%dummy = SrcDiscStateData%dummy
 end subroutine
 
+subroutine FWrap_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(FWrap_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(FWrap_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_dummy
+   character(*), parameter        :: RoutineName = 'FWrap_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = DiscStateData1%dummy
+   DiscStateData1%dummy = DiscStateData2%dummy
+   DiscStateData2%dummy = tmp_dummy
+end subroutine
+
 subroutine FWrap_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(FWrap_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -366,6 +394,20 @@ subroutine FWrap_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCod
    DstConstrStateData%dummy = SrcConstrStateData%dummy
 end subroutine
 
+subroutine FWrap_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(FWrap_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(FWrap_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_dummy
+   character(*), parameter        :: RoutineName = 'FWrap_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = ConstrStateData1%dummy
+   ConstrStateData1%dummy = ConstrStateData2%dummy
+   ConstrStateData2%dummy = tmp_dummy
+end subroutine
+
 subroutine FWrap_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(FWrap_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -404,6 +446,20 @@ subroutine FWrap_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode,
    DstOtherStateData%dummy = SrcOtherStateData%dummy
 end subroutine
 
+subroutine FWrap_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(FWrap_OtherStateType), intent(inout) :: OtherStateData1
+   type(FWrap_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   INTEGER(IntKi) :: tmp_dummy
+   character(*), parameter        :: RoutineName = 'FWrap_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = OtherStateData1%dummy
+   OtherStateData1%dummy = OtherStateData2%dummy
+   OtherStateData2%dummy = tmp_dummy
+end subroutine
+
 subroutine FWrap_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(FWrap_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -752,6 +808,20 @@ subroutine FWrap_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg
    DstInputData%dummy = SrcInputData%dummy
 end subroutine
 
+subroutine FWrap_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(FWrap_InputType), intent(inout) :: InputData1
+   type(FWrap_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_dummy
+   character(*), parameter        :: RoutineName = 'FWrap_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = InputData1%dummy
+   InputData1%dummy = InputData2%dummy
+   InputData2%dummy = tmp_dummy
+end subroutine
+
 subroutine FWrap_DestroyInput(InputData, ErrStat, ErrMsg)
    type(FWrap_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -66,6 +66,10 @@ MODULE WaveTankTesting
    type(MeshesMapsType  )         :: MeshMaps       ! mappings
    type(StructTmpType   )         :: StructTmp      ! temporary data - avoids reallocation
 
+   ! instance handles for the SeaState and MoorDyn c-bindings (0 until created)
+   integer(c_int)          :: SeaSt_Handle_c = 0_c_int
+   integer(c_int)          :: MD_Handle_c    = 0_c_int
+
    ! time stuff
    integer(IntKi)          :: VTKn_Global    ! global timestep for VTK
    integer(IntKi)          :: VTKn_last      ! last global timestep for VTK
@@ -212,6 +216,7 @@ subroutine WaveTank_Init(  &
    ! Setup and initialize SeaState
    !------------------------------
    call SeaSt_C_PreInit(            &
+      SeaSt_Handle_c,               &
       SimSettings%Env%Gravity,      &
       SimSettings%Env%WtrDens,      &
       SimSettings%Env%WtrDpth,      &
@@ -227,6 +232,7 @@ subroutine WaveTank_Init(  &
    SS_InputFile_C = transfer(trim(SimSettings%ModSettings%SS_InputFile ), SS_InputFile_C )
    OutRootName_C  = transfer(trim(SimSettings%Sim%OutRootName)//'.SeaSt'//c_null_char, OutRootName_C)
    call SeaSt_C_Init(            &
+      SeaSt_Handle_c,            &
       SS_InputFile_C,            &
       OutRootName_C,             &
       SimSettings%Sim%TMax,      &
@@ -262,6 +268,7 @@ subroutine WaveTank_Init(  &
    MD_InputFile_C = transfer(trim(SimSettings%ModSettings%MD_InputFile ), MD_InputFile_C )
    OutRootName_C  = transfer(trim(SimSettings%Sim%OutRootName)//'.MD'//c_null_char, OutRootName_C)
    call MD_C_Init(                           &
+      MD_Handle_c,                           &   !< instance handle (created by WaveTank_SetWaveFieldPointer)
       0_c_int,                               &   !< InputFilePassed: 0 for file, 1 for string
       c_loc(MD_InputFile_C(1)),              &
       int(IntfStrLen,c_int),                 &   !< InputFileStringLength_C
@@ -503,7 +510,7 @@ subroutine WaveTank_CalcStep( &
    ! Wave elevation at buoy, update buoy
    !--------------------------------------
    StructTmp%BuoyPos_c(1:2) = real(SimSettings%WaveBuoy%XYLoc, c_float)
-   call SeaSt_C_GetSurfElev(Time_C, StructTmp%BuoyPos_c(1:2), buoyWaveElev_c, ErrStat_C2, ErrMsg_C2)
+   call SeaSt_C_GetSurfElev(SeaSt_Handle_c, Time_C, StructTmp%BuoyPos_c(1:2), buoyWaveElev_c, ErrStat_C2, ErrMsg_C2)
    call SetErrStat_C(ErrStat_C2, ErrMsg_C2, ErrStat_C, ErrMsg_C, 'WaveTank_CalcStep::SeaSt_C_GetSurfElev')
    if (ErrStat_C >= AbortErrLev_C) return
    MeshMotions%WaveBuoyMotion%TranslationDisp(:,1) = (/ 0.0_ReKi, 0.0_ReKi, real(buoyWaveElev_c, ReKi) /)
@@ -527,7 +534,7 @@ subroutine WaveTank_CalcStep( &
    !--------------------------------------
    ! call SeaState_Calc (writes vis)
    !--------------------------------------
-   call SeaSt_C_CalcOutput(Time_C, WrOutputData%OutData_SS_c, ErrStat_C, ErrMsg_C)
+   call SeaSt_C_CalcOutput(SeaSt_Handle_c, Time_C, WrOutputData%OutData_SS_c, ErrStat_C, ErrMsg_C)
    call SetErrStat_C(ErrStat_C2, ErrMsg_C2, ErrStat_C, ErrMsg_C, 'WaveTank_CalcStep::SeaSt_C_CalcOutput')
    if (ErrStat_C >= AbortErrLev_C) return
    ! transfer data for writing out
@@ -541,12 +548,12 @@ subroutine WaveTank_CalcStep( &
    call SetMDTmpMotion()
 
    ! Update to T+DT
-   call MD_C_UpdateStates(TimePrev_c, Time_c, StructTmp%PtfmPosAng_c, StructTmp%PtfmVel_c, StructTmp%PtfmAcc_c, ErrStat_C2, ErrMsg_C2)
+   call MD_C_UpdateStates(MD_Handle_c, TimePrev_c, Time_c, StructTmp%PtfmPosAng_c, StructTmp%PtfmVel_c, StructTmp%PtfmAcc_c, ErrStat_C2, ErrMsg_C2)
    call SetErrStat_C(ErrStat_C2, ErrMsg_C2, ErrStat_C, ErrMsg_C, 'WaveTank_CalcStep::MD_C_UpdateStates')
    if (ErrStat_C >= AbortErrLev_C) return
 
    ! get loads at T+DT
-   call MD_C_CalcOutput(Time_c, StructTmp%PtfmPosAng_c, StructTmp%PtfmVel_c, StructTmp%PtfmAcc_c, CalcStepIO%FrcMom_MD_c, WrOutputData%OutData_MD, ErrStat_C2, ErrMsg_C2)
+   call MD_C_CalcOutput(MD_Handle_c, Time_c, StructTmp%PtfmPosAng_c, StructTmp%PtfmVel_c, StructTmp%PtfmAcc_c, CalcStepIO%FrcMom_MD_c, WrOutputData%OutData_MD, ErrStat_C2, ErrMsg_C2)
    call SetErrStat_C(ErrStat_C2, ErrMsg_C2, ErrStat_C, ErrMsg_C, 'WaveTank_CalcStep::MD_C_CalcOutput')
    if (ErrStat_C >= AbortErrLev_C) return
 
@@ -772,11 +779,13 @@ subroutine WaveTank_End(ErrStat_C, ErrMsg_C) bind (C, NAME="WaveTank_End")
    ! in case we were writing to a file instead of the screen
    if (ScreenLogOutput_Un > 0)   close(ScreenLogOutput_Un)
 
-   call MD_C_END(ErrStat_C2, ErrMsg_C2)
+   call MD_C_END(MD_Handle_c, ErrStat_C2, ErrMsg_C2)
    call SetErrStat_C(ErrStat_C2, ErrMsg_C2, ErrStat_C, ErrMsg_C, 'MD_C_END')
+   MD_Handle_c = 0_c_int
 
-   call SeaSt_C_END(ErrStat_C2, ErrMsg_C2)
+   call SeaSt_C_END(SeaSt_Handle_c, ErrStat_C2, ErrMsg_C2)
    call SetErrStat_C(ErrStat_C2, ErrMsg_C2, ErrStat_C, ErrMsg_C, 'SeaSt_C_END')
+   SeaSt_Handle_c = 0_c_int
 
    call ADI_C_END(ErrStat_C2, ErrMsg_C2)
    call SetErrStat_C(ErrStat_C2, ErrMsg_C2, ErrStat_C, ErrMsg_C, 'ADI_C_END')
@@ -808,7 +817,7 @@ subroutine WaveTank_SetWaveFieldPointer(ErrStat_C, ErrMsg_C) bind (C, NAME="Wave
    ErrStat_C = ErrID_None
    ErrMsg_C  = " "//C_NULL_CHAR
 
-   call SeaSt_C_GetWaveFieldPointer(WaveFieldPointer_C, ErrStat_C2, ErrMsg_C2)
+   call SeaSt_C_GetWaveFieldPointer(SeaSt_Handle_c, WaveFieldPointer_C, ErrStat_C2, ErrMsg_C2)
    call SetErrStat_C(ErrStat_C2, ErrMsg_C2, ErrStat_C, ErrMsg_C, 'WaveTank_SetWaveFieldPointer')
    if (ErrStat_C >= AbortErrLev_C) return
 
@@ -821,8 +830,10 @@ subroutine WaveTank_SetWaveFieldPointer(ErrStat_C, ErrMsg_C) bind (C, NAME="Wave
        return
    endif
 
-   ! There isn't a good way to check for an error here.  Will get caught at init
-   call MD_C_SetWaveFieldData(WaveFieldPointer_C)
+   ! This creates the MoorDyn instance if it does not exist yet
+   call MD_C_SetWaveFieldData(MD_Handle_c, WaveFieldPointer_C, ErrStat_C2, ErrMsg_C2)
+   call SetErrStat_C(ErrStat_C2, ErrMsg_C2, ErrStat_C, ErrMsg_C, 'WaveTank_SetWaveFieldPointer')
+   if (ErrStat_C >= AbortErrLev_C) return
 
    ! Probably doesn't matter, but clear the fortran pointer just in case
    WaveFieldPointer_F => NULL()
@@ -87,6 +87,12 @@ class HydroDynLib(OpenFASTInterfaceType):
         self._initialize_routines()
         self.ended = False                  # For error handling at end
 
+        # Per-object error buffers and instance handle so that several HydroDyn
+        # models can share one loaded library.
+        self.error_status_c = c_int(0)
+        self.error_message_c = create_string_buffer(self.ERROR_MESSAGE_LENGTH)
+        self._handle_c = c_int(0)
+
         # Input file handling configuration
         self.seastate_inputs_passed_as_string: bool = True  # Pass input file as string
         self.hydrodyn_inputs_passed_as_string: bool = True  # Pass input file as string
@@ -143,6 +149,7 @@ class HydroDynLib(OpenFASTInterfaceType):
     # _initialize_routines() ------------------------------------------------------------------------------------------------------------
     def _initialize_routines(self):
         self.HydroDyn_C_Init.argtypes = [
+            POINTER(c_int),                     # Handle_C (out)
             POINTER(c_int),                     # SeaState input file passed as string
             POINTER(c_char_p),                  # SeaState input file string
             POINTER(c_int),                     # SeaState input file string length
@@ -171,6 +178,7 @@ class HydroDynLib(OpenFASTInterfaceType):
         self.HydroDyn_C_Init.restype = c_int 
 
         self.HydroDyn_C_CalcOutput.argtypes = [
+            POINTER(c_int),                     # Handle_C
             POINTER(c_double),                  # Time_C
             POINTER(c_int),                     # numNodePts -- number of points expecting motions/loads
             POINTER(c_float),                   # nodePos -- node positions      in flat array of 6*numNodePts
@@ -184,6 +192,7 @@ class HydroDynLib(OpenFASTInterfaceType):
         self.HydroDyn_C_CalcOutput.restype = c_int
 
         self.HydroDyn_C_CalcOutput_and_AddedMass.argtypes = [
+            POINTER(c_int),                     # Handle_C
             POINTER(c_double),                  # Time_C
             POINTER(c_int),                     # numNodePts -- number of points expecting motions/loads
             POINTER(c_float),                   # nodePos -- node positions      in flat array of 6*numNodePts
@@ -197,6 +206,7 @@ class HydroDynLib(OpenFASTInterfaceType):
         self.HydroDyn_C_CalcOutput_and_AddedMass.restype = c_int
 
         self.HydroDyn_C_UpdateStates.argtypes = [
+            POINTER(c_int),                     # Handle_C
             POINTER(c_double),                  # Time_C
             POINTER(c_double),                  # TimeNext_C
             POINTER(c_int),                     # numNodePts -- number of points expecting motions/loads
@@ -209,6 +219,7 @@ class HydroDynLib(OpenFASTInterfaceType):
         self.HydroDyn_C_UpdateStates.restype = c_int
 
         self.HydroDyn_C_End.argtypes = [
+            POINTER(c_int),                     # Handle_C
             POINTER(c_int),                     # ErrStat_C
             POINTER(c_char)                     # ErrMsg_C
         ]
@@ -265,6 +276,7 @@ class HydroDynLib(OpenFASTInterfaceType):
 
         # call HydroDyn_C_Init
         self.HydroDyn_C_Init(
+            byref(self._handle_c),                                  # OUT: instance handle
             byref(c_int(self.seastate_inputs_passed_as_string)),    # IN: SeaState input file is passed as string
             c_char_p(seast_input_string),                           # IN: SeaState input file string
             byref(c_int(seast_input_string_length)),                # IN: SeaState input file string length
@@ -330,6 +342,7 @@ class HydroDynLib(OpenFASTInterfaceType):
 
         # Run HydroDyn_C_CalcOutput
         self.HydroDyn_C_CalcOutput(
+            byref(self._handle_c),                  # IN: instance handle
             byref(c_double(time)),                  # IN: time at which to calculate output forces
             byref(c_int(self.numNodePts)),          # IN: number of attachment points expected (where motions are transferred into HD)
             nodePos_flat_c,                         # IN: positions - specified by user
@@ -388,6 +401,7 @@ class HydroDynLib(OpenFASTInterfaceType):
 
         # Run HydroDyn_C_CalcOutput_and_AddedMass
         self.HydroDyn_C_CalcOutput_and_AddedMass(
+            byref(self._handle_c),                  # IN: instance handle
             byref(c_double(time)),                  # IN: time at which to calculate output forces
             byref(c_int(self.numNodePts)),          # IN: number of attachment points expected (where motions are transferred into HD)
             nodePos_flat_c,                         # IN: positions - specified by user
@@ -453,6 +467,7 @@ class HydroDynLib(OpenFASTInterfaceType):
 
         # Run HydroDyn_UpdateStates_c
         self.HydroDyn_C_UpdateStates(
+            byref(self._handle_c),                  # IN: instance handle
             byref(c_double(time)),                  # IN: time at which to calculate output forces
             byref(c_double(timeNext)),              # IN: time T+dt we are stepping to 
             byref(c_int(self.numNodePts)),          # IN: number of attachment points expected (where motions are transferred into HD)
@@ -471,6 +486,7 @@ class HydroDynLib(OpenFASTInterfaceType):
             self.ended = True
             # Run HydroDyn_C_End
             self.HydroDyn_C_End(
+                byref(self._handle_c),
                 byref(self.error_status_c),
                 self.error_message_c
             )
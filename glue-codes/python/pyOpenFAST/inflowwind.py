@@ -32,6 +32,7 @@ from ctypes import (
     c_char,
     c_char_p
 )
+import numpy as np
 import datetime
 import os
 
@@ -45,6 +46,11 @@ class InflowWindLib(OpenFASTInterfaceType):
         self._initialize_routines()
         self.ended = False                  # For error handling at end
 
+        # Handle to the InflowWind instance in the library.  Set by IfW_C_Init
+        # and passed to every other call, so several InflowWindLib objects can
+        # share one loaded library.
+        self._handle_c = c_int(0)
+
         # Input file handling
         self.IfWinputPass = 1               # Assume passing of input file as a string
 
@@ -87,6 +93,7 @@ class InflowWindLib(OpenFASTInterfaceType):
         Initialize the Python handles to necessary routines in the InflowWind library.
         """
         self.IfW_C_Init.argtypes = [
+            POINTER(c_int),                       # instance handle
             POINTER(c_int),                       # IfW input file passed as string
             POINTER(c_char_p),                    # input file string
             POINTER(c_int),                       # input file string length
@@ -103,6 +110,7 @@ class InflowWindLib(OpenFASTInterfaceType):
         self.IfW_C_Init.restype = c_int
 
         self.IfW_C_CalcOutput.argtypes = [
+            POINTER(c_int),                       # instance handle
             POINTER(c_double),                    # Time_C
             POINTER(c_float),                     # Positions
             POINTER(c_float),                     # Velocities
@@ -113,11 +121,23 @@ class InflowWindLib(OpenFASTInterfaceType):
         self.IfW_C_CalcOutput.restype = c_int
 
         self.IfW_C_End.argtypes = [
+            POINTER(c_int),                       # instance handle
             POINTER(c_int),                       # ErrStat_C
             POINTER(c_char)                       # ErrMsg_C
         ]
         self.IfW_C_End.restype = c_int
 
+        self.IfW_C_GetWindVelPts.argtypes = [
+            POINTER(c_int),                       # instance handle
+            POINTER(c_int),                       # number of points
+            POINTER(c_double),                    # Time_C
+            POINTER(c_float),                     # Positions (3 x N, flattened)
+            POINTER(c_float),                     # Velocities (3 x N, flattened)
+            POINTER(c_int),                       # ErrStat_C
+            POINTER(c_char)                       # ErrMsg_C
+        ]
+        self.IfW_C_GetWindVelPts.restype = c_int
+
 
     def ifw_init(self, IfW_input_string_array):
         """
@@ -135,6 +155,7 @@ class InflowWindLib(OpenFASTInterfaceType):
         self._numChannels_c = c_int(0)
 
         self.IfW_C_Init(
+            byref(self._handle_c),                 # OUT: instance handle
             byref(c_int(self.IfWinputPass)),       # IN: IfW input file is passed
             c_char_p(IfW_input_string),            # IN: input file string
             byref(c_int(IfW_input_string_length)), # IN: input file string length
@@ -171,6 +192,7 @@ class InflowWindLib(OpenFASTInterfaceType):
 
         # Run IFW_CALCOUTPUT_C
         self.IfW_C_CalcOutput(
+            byref(self._handle_c),                 # IN: instance handle
             byref(c_double(time)),                 # IN: time at which to calculate velocities
             positions_flat_c,                      # IN: positions - specified by user, flattened to 1D
             velocities_flat_c,                     # OUT: velocities at desired positions, flattened to 1D
@@ -194,6 +216,30 @@ class InflowWindLib(OpenFASTInterfaceType):
             count = count + 3
 
 
+    def ifw_get_wind_vel_pts(self, time, positions):
+        """
+        Get the wind velocity at an arbitrary set of points (N x 3 array) at a
+        single time.  Unlike ifw_calc_output, the number of points does not need
+        to match the numWindPts given at initialization.  Returns an N x 3 array.
+        """
+        pos = np.ascontiguousarray(np.asarray(positions, dtype=np.float32).reshape(-1, 3))
+        numPts = pos.shape[0]
+        vel = np.zeros((numPts, 3), dtype=np.float32)
+
+        self.IfW_C_GetWindVelPts(
+            byref(self._handle_c),                 # IN: instance handle
+            byref(c_int(numPts)),                  # IN: number of points
+            byref(c_double(time)),                 # IN: time at which to calculate velocities
+            pos.ctypes.data_as(POINTER(c_float)),  # IN: positions, N x 3
+            vel.ctypes.data_as(POINTER(c_float)),  # OUT: velocities at positions, N x 3
+            byref(self.error_status_c),            # OUT: ErrStat_C
+            self.error_message_c                   # OUT: ErrMsg_C
+        )
+
+        self.check_error()
+        return vel
+
+
     def ifw_end(self):
         """
         Call the cleanup routine in the InflowWind library.
@@ -201,6 +247,7 @@ class InflowWindLib(OpenFASTInterfaceType):
         if not self.ended:
             self.ended = True
             self.IfW_C_End(
+                byref(self._handle_c),
                 byref(self.error_status_c),
                 self.error_message_c
             )
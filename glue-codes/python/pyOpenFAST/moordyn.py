@@ -48,6 +48,12 @@ class MoorDynLib(OpenFASTInterfaceType):
         self._initialize_routines()
         self.ended             = False   # For error handling at end
 
+        # Handle to the MoorDyn instance in the library, set by MD_C_Init.
+        # Error buffers are per object so several instances can run at once.
+        self._handle_c         = c_int(0)
+        self.error_status_c    = c_int(0)
+        self.error_message_c   = create_string_buffer(self.ERROR_MESSAGE_LENGTH)
+
         self._channel_names    = create_string_buffer(256*1000)
         self._channel_units    = create_string_buffer(256*1000)
 
@@ -58,6 +64,7 @@ class MoorDynLib(OpenFASTInterfaceType):
     # Initialize routines ------------------------------------------------------------------------------------------------------------
     def _initialize_routines(self):
         self.MD_C_Init.argtypes = [
+            POINTER(c_int),                       # IN/OUT: instance handle
             POINTER(c_int),                       # IN: input file passed
             POINTER(c_char_p),                    # IN: input file string
             POINTER(c_int),                       # IN: input file string length
@@ -76,6 +83,7 @@ class MoorDynLib(OpenFASTInterfaceType):
         self.MD_C_Init.restype = c_int
 
         self.MD_C_CalcOutput.argtypes = [
+            POINTER(c_int),                       # IN: instance handle
             POINTER(c_double),                    # IN: Time @ n
             POINTER(c_float),                     # IN: Positions -- node positions    (1 x 6 array)  
             POINTER(c_float),                     # IN: Velocities -- node velocities  (1 x 6 array)
@@ -88,6 +96,7 @@ class MoorDynLib(OpenFASTInterfaceType):
         self.MD_C_CalcOutput.restype = c_int
         
         self.MD_C_UpdateStates.argtypes = [
+            POINTER(c_int),                       # IN: instance handle
             POINTER(c_double),                    # IN: time @ n
             POINTER(c_double),                    # IN: time @ n+1
             POINTER(c_float),                     # IN: Positions -- node positions    (1 x 6 array)
@@ -99,6 +108,7 @@ class MoorDynLib(OpenFASTInterfaceType):
         self.MD_C_UpdateStates.restype = c_int
 
         self.MD_C_End.argtypes = [
+            POINTER(c_int),                       # IN: instance handle
             POINTER(c_int),                       # OUT: ErrStat_C
             POINTER(c_char)                       # OUT: ErrMsg_C
         ]
@@ -120,6 +130,7 @@ class MoorDynLib(OpenFASTInterfaceType):
         self._numChannels = c_int(0)
 
         self.MD_C_Init(
+            byref(self._handle_c),                 # IN/OUT: instance handle
             byref(c_int(input_file_passed)),       # IN: input file passed
             c_char_p(input_string),                # IN: input file string
             byref(c_int(input_string_length)),     # IN: input file string length
@@ -162,6 +173,7 @@ class MoorDynLib(OpenFASTInterfaceType):
             outputs_c[i] = c_float(p)
 
         self.MD_C_CalcOutput(
+            byref(self._handle_c),                 # IN: instance handle
             byref(c_double(t)),                    # IN: time
             positions_c,                           # IN: positions
             velocities_c,                          # IN: velocities
@@ -196,6 +208,7 @@ class MoorDynLib(OpenFASTInterfaceType):
             accelerations_c[i] = c_float(p)
 
         self.MD_C_UpdateStates(
+            byref(self._handle_c),                 # IN: instance handle
             byref(c_double(t1)),                   # IN: current time (t)
             byref(c_double(t2)),                   # IN: next time step (t+1)
             positions_c,                           # IN: positions
@@ -213,6 +226,7 @@ class MoorDynLib(OpenFASTInterfaceType):
         if not self.ended:
             self.ended = True
             self.MD_C_End(
+                byref(self._handle_c),                 # IN: instance handle
                 byref(self.error_status_c),            # OUT: ErrStat_C
                 self.error_message_c                   # OUT: ErrMsg_C
             )
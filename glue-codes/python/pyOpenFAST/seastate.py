@@ -71,6 +71,9 @@ class SeaStateLib(OpenFASTInterfaceType):
         self.error_status_c = c_int(0)
         self.error_message_c = create_string_buffer(self.ERROR_MSG_C_LEN)
 
+        # Instance handle returned by SeaSt_C_PreInit and passed to all other routines
+        self._handle_c = c_int(0)
+
 
         # This buffer for the channel names and units is set arbitrarily large
         # to start.  Channel name and unit lengths are currently hard
@@ -98,6 +101,7 @@ class SeaStateLib(OpenFASTInterfaceType):
 
     def _initialize_routines(self):
         self.SeaSt_C_PreInit.argtypes = [
+            POINTER(c_int),         # intent(  out) :: Handle_C
             POINTER(c_float),       # intent(in   ) :: Gravity_c
             POINTER(c_float),       # intent(in   ) :: WtrDens_c
             POINTER(c_float),       # intent(in   ) :: WtrDpth_c
@@ -112,6 +116,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         self.SeaSt_C_PreInit.restype = None
 
         self.SeaSt_C_Init.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
             POINTER(c_char),        # intent(in   ) :: InputFile_c(IntfStrLen)
             POINTER(c_char),        # intent(in   ) :: OutRootName_c(IntfStrLen)
             POINTER(c_double),      # intent(in   ) :: TimeInterval_c
@@ -126,6 +131,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         self.SeaSt_C_Init.restype = None
 
         self.SeaSt_C_CalcOutput.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
             POINTER(c_double),      # intent(in   ) :: Time_C
             POINTER(c_float),       # intent(  out) :: OutputChannelValues_C(p%NumOuts)
             POINTER(c_int),         # intent(  out) :: ErrStat_C
@@ -134,12 +140,14 @@ class SeaStateLib(OpenFASTInterfaceType):
         self.SeaSt_C_CalcOutput.restype = None
 
         self.SeaSt_C_End.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
             POINTER(c_int),         # intent(  out) :: ErrStat_C
             POINTER(c_char)         # intent(  out) :: ErrMsg_C(ErrMsgLen_C)
         ]
         self.SeaSt_C_End.restype = None
 
         self.SeaSt_C_GetWaveFieldPointer.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
             POINTER(c_void_p),      # intent(  out) :: pointer to the WaveField data
             POINTER(c_int),         # intent(  out) :: ErrStat_C
             POINTER(c_char),        # intent(  out) :: ErrMsg_C(ErrMsgLen_C)
@@ -147,6 +155,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         self.SeaSt_C_GetWaveFieldPointer.restype = None
 
         self.SeaSt_C_SetWaveFieldPointer.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
             POINTER(c_void_p),      # intent(in   ) :: pointer to the WaveField data
             POINTER(c_int),         # intent(  out) :: ErrStat_C
             POINTER(c_char),        # intent(  out) :: ErrMsg_C(ErrMsgLen_C)
@@ -155,6 +164,7 @@ class SeaStateLib(OpenFASTInterfaceType):
 
 
         self.SeaSt_C_GetFluidVelAcc.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
             POINTER(c_double),      # intent(in   ) :: Time_C
             POINTER(c_float),       # intent(in   ) :: Pos_c(3)
             POINTER(c_float),       # intent(  out) :: Vel_c(3)
@@ -167,6 +177,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         self.SeaSt_C_GetFluidVelAcc.restype = None
 
         self.SeaSt_C_GetSurfElev.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
             POINTER(c_double),      # intent(in   ) :: Time_C
             POINTER(c_float),       # intent(in   ) :: Pos_c(3)
             POINTER(c_float),       # intent(  out) :: Elev_C
@@ -176,6 +187,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         self.SeaSt_C_GetSurfElev.restype = None
 
         self.SeaSt_C_GetSurfNorm.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
             POINTER(c_double),      # intent(in   ) :: Time_C
             POINTER(c_float),       # intent(in   ) :: Pos_c(3)
             POINTER(c_float),       # intent(  out) :: norm(3)
@@ -185,6 +197,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         self.SeaSt_C_GetSurfNorm.restype = None
 
         self.SeaSt_C_GetElevMinMaxEstimate.argtypes = [ 
+            POINTER(c_int),         # intent(in   ) :: Handle_C
             POINTER(c_float),       # intent(  out) :: elevMin_c
             POINTER(c_float),       # intent(  out) :: elevMax_c
             POINTER(c_int),         # intent(  out) :: ErrStat_C
@@ -192,6 +205,41 @@ class SeaStateLib(OpenFASTInterfaceType):
         ]
         self.SeaSt_C_GetElevMinMaxEstimate.restype = None
 
+        self.SeaSt_C_GetFluidVelAccPts.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
+            POINTER(c_int),         # intent(in   ) :: NumPts_C
+            POINTER(c_double),      # intent(in   ) :: Time_C
+            POINTER(c_float),       # intent(in   ) :: Pos_C(3*NumPts_C)
+            POINTER(c_float),       # intent(  out) :: Vel_C(3*NumPts_C)
+            POINTER(c_float),       # intent(  out) :: Acc_C(3*NumPts_C)
+            POINTER(c_int),         # intent(  out) :: NodeInWater_C(NumPts_C)
+            POINTER(c_int),         # intent(  out) :: ErrStat_C
+            POINTER(c_char),        # intent(  out) :: ErrMsg_C(ErrMsgLen_C)
+        ]
+        self.SeaSt_C_GetFluidVelAccPts.restype = None
+
+        self.SeaSt_C_GetSurfElevPts.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
+            POINTER(c_int),         # intent(in   ) :: NumPts_C
+            POINTER(c_double),      # intent(in   ) :: Time_C
+            POINTER(c_float),       # intent(in   ) :: Pos_C(2*NumPts_C)
+            POINTER(c_float),       # intent(  out) :: Elev_C(NumPts_C)
+            POINTER(c_int),         # intent(  out) :: ErrStat_C
+            POINTER(c_char),        # intent(  out) :: ErrMsg_C(ErrMsgLen_C)
+        ]
+        self.SeaSt_C_GetSurfElevPts.restype = None
+
+        self.SeaSt_C_GetDynPressurePts.argtypes = [
+            POINTER(c_int),         # intent(in   ) :: Handle_C
+            POINTER(c_int),         # intent(in   ) :: NumPts_C
+            POINTER(c_double),      # intent(in   ) :: Time_C
+            POINTER(c_float),       # intent(in   ) :: Pos_C(3*NumPts_C)
+            POINTER(c_float),       # intent(  out) :: DynP_C(NumPts_C)
+            POINTER(c_int),         # intent(  out) :: ErrStat_C
+            POINTER(c_char),        # intent(  out) :: ErrMsg_C(ErrMsgLen_C)
+        ]
+        self.SeaSt_C_GetDynPressurePts.restype = None
+
 
 
     def check_error(self) -> None:
@@ -215,6 +263,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         if self.error_status_c.value >= self.abort_error_level.value:
             try:
                 self.SeaSt_C_End(
+                    byref(self._handle_c),                  # IN -> instance handle
                     byref(self.error_status_c),             # OUT <- error status code
                     self.error_message_c                    # OUT <- error message buffer
                 )
@@ -248,6 +297,7 @@ class SeaStateLib(OpenFASTInterfaceType):
             self.vtk_output_dir.ljust(self.default_str_c_len).encode('utf-8')
         )
         self.SeaSt_C_PreInit(
+            byref(self._handle_c),
             byref(c_float(gravity)),
             byref(c_float(water_density)),
             byref(c_float(water_depth)),
@@ -286,6 +336,7 @@ class SeaStateLib(OpenFASTInterfaceType):
 
 
         self.SeaSt_C_Init(
+            byref(self._handle_c),
             ss_file_c,
             outrootname_c,
             byref(c_double(time_interval)),
@@ -338,6 +389,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         output_channel_values_c = (c_float * self.numChannels)(0.)
 
         self.SeaSt_C_CalcOutput(
+            byref(self._handle_c),           # IN -> instance handle
             byref(c_double(time)),           # IN -> current simulation time
             self.output_values.ctypes.data_as(POINTER(c_float)), # OUT: output channel values
             byref(self.error_status_c),      # OUT <- error status
@@ -354,6 +406,7 @@ class SeaStateLib(OpenFASTInterfaceType):
             self.ended = True
 
             self.SeaSt_C_End(
+                byref(self._handle_c),                  # IN -> instance handle
                 byref(self.error_status_c),             # OUT <- error status code
                 self.error_message_c                    # OUT <- error message buffer
             )
@@ -363,6 +416,7 @@ class SeaStateLib(OpenFASTInterfaceType):
 
     def seastate_getWaveFieldPointer(self,ss_pointer: c_void_p) -> None:
         self.SeaSt_C_GetWaveFieldPointer(
+            byref(self._handle_c),                      # IN -> instance handle
             byref(ss_pointer),                          # IN  -> pointer to the WaveField data
             byref(self.error_status_c),                 # OUT <- error status code
             self.error_message_c                        # OUT <- error message buffer
@@ -371,6 +425,7 @@ class SeaStateLib(OpenFASTInterfaceType):
 
     def seastate_setWaveFieldPointer(self,ss_pointer: c_void_p) -> None:
         self.SeaSt_C_SetWaveFieldPointer(
+            byref(self._handle_c),                      # IN -> instance handle
             byref(ss_pointer),                          # IN  -> pointer to the WaveField data
             byref(self.error_status_c),                 # OUT <- error status code
             self.error_message_c                        # OUT <- error message buffer
@@ -407,6 +462,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         acc = np.zeros( 3, dtype=c_float )
         nodeInWater_c = c_int(0)
         self.SeaSt_C_GetFluidVelAcc(
+            byref(self._handle_c),                      # IN -> instance handle
             byref(c_double(time)),                      # IN -> current simulation time
             pos.ctypes.data_as(POINTER(c_float)),       # IN -> position (3 vector)
             vel.ctypes.data_as(POINTER(c_float)),       # OUT <- velocity (3 vector)
@@ -439,6 +495,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         pos = np.array(position).astype(c_float)[:3]
         elev_c = c_float(0.0)
         self.SeaSt_C_GetSurfElev(
+            byref(self._handle_c),                      # IN -> instance handle
             byref(c_double(time)),                      # IN -> current simulation time
             pos.ctypes.data_as(POINTER(c_float)),       # IN -> position (3 vector)
             elev_c,                                     # OUT <- total wave elevation
@@ -471,6 +528,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         pos[1] = position[1]
         norm = np.zeros( 3, dtype=c_float )
         self.SeaSt_C_GetSurfNorm(
+            byref(self._handle_c),                      # IN -> instance handle
             byref(c_double(time)),                      # IN -> current simulation time
             pos.ctypes.data_as(POINTER(c_float)),       # IN -> position (3 vector)
             norm.ctypes.data_as(POINTER(c_float)),      # OUT <- normal vector to surface
@@ -497,6 +555,7 @@ class SeaStateLib(OpenFASTInterfaceType):
         elevMax_c = c_float(0.0)
         print("Calling SeaSt_C_GetElevMinMaxEstimate")
         self.SeaSt_C_GetElevMinMaxEstimate(
+            byref(self._handle_c),                      # IN -> instance handle
             elevMin_c,                                  # out <- min elev
             elevMax_c,                                  # out <- max elev
             byref(self.error_status_c),                 # OUT <- error status
@@ -508,6 +567,102 @@ class SeaStateLib(OpenFASTInterfaceType):
         return elevMin,elevMax 
 
 
+    def get_fluidVelAcc_pts(self,
+        time: float,
+        positions: npt.NDArray[np.float32],
+    ) -> tuple[npt.NDArray[np.float32], npt.NDArray[np.float32], npt.NDArray[np.int32]]:
+        """
+        Get the fluid velocity and acceleration at many points in one call.
+        Args:
+            time: Current simulation time
+            positions: N x 3 array of positions
+        Returns:
+            tuple: (vel, acc, nodeInWater) with vel and acc as N x 3 arrays and
+                nodeInWater as an array of length N (0=false, 1=true)
+        Raises:
+            RuntimeError: If calculation fails
+        """
+        pos = np.ascontiguousarray(np.asarray(positions, dtype=c_float).reshape(-1, 3))
+        numPts = pos.shape[0]
+        vel = np.zeros((numPts, 3), dtype=c_float)
+        acc = np.zeros((numPts, 3), dtype=c_float)
+        nodeInWater = np.zeros(numPts, dtype=c_int)
+        self.SeaSt_C_GetFluidVelAccPts(
+            byref(self._handle_c),                      # IN -> instance handle
+            byref(c_int(numPts)),                       # IN -> number of points
+            byref(c_double(time)),                      # IN -> current simulation time
+            pos.ctypes.data_as(POINTER(c_float)),       # IN -> positions (N x 3)
+            vel.ctypes.data_as(POINTER(c_float)),       # OUT <- velocities (N x 3)
+            acc.ctypes.data_as(POINTER(c_float)),       # OUT <- accelerations (N x 3)
+            nodeInWater.ctypes.data_as(POINTER(c_int)), # OUT <- node is in water (N)
+            byref(self.error_status_c),                 # OUT <- error status
+            self.error_message_c                        # OUT <- error message
+        )
+        self.check_error()
+        return vel,acc,nodeInWater
+
+
+    def get_surfElev_pts(self,
+        time: float,
+        positions: npt.NDArray[np.float32],
+    ) -> npt.NDArray[np.float32]:
+        """
+        Get the surface elevation at many X,Y points in one call.
+        Args:
+            time: Current simulation time
+            positions: N x 2 (or N x 3, Z is ignored) array of positions
+        Returns:
+            elevation in meters at each point (length N)
+        Raises:
+            RuntimeError: If calculation fails
+        """
+        pos = np.asarray(positions, dtype=c_float)
+        pos = np.ascontiguousarray(pos.reshape(-1, pos.shape[-1])[:, :2])
+        numPts = pos.shape[0]
+        elev = np.zeros(numPts, dtype=c_float)
+        self.SeaSt_C_GetSurfElevPts(
+            byref(self._handle_c),                      # IN -> instance handle
+            byref(c_int(numPts)),                       # IN -> number of points
+            byref(c_double(time)),                      # IN -> current simulation time
+            pos.ctypes.data_as(POINTER(c_float)),       # IN -> positions (N x 2)
+            elev.ctypes.data_as(POINTER(c_float)),      # OUT <- total wave elevation (N)
+            byref(self.error_status_c),                 # OUT <- error status
+            self.error_message_c                        # OUT <- error message
+        )
+        self.check_error()
+        return elev
+
+
+    def get_dynPressure_pts(self,
+        time: float,
+        positions: npt.NDArray[np.float32],
+    ) -> npt.NDArray[np.float32]:
+        """
+        Get the dynamic pressure at many points in one call.
+        Args:
+            time: Current simulation time
+            positions: N x 3 array of positions
+        Returns:
+            dynamic pressure at each point (length N)
+        Raises:
+            RuntimeError: If calculation fails
+        """
+        pos = np.ascontiguousarray(np.asarray(positions, dtype=c_float).reshape(-1, 3))
+        numPts = pos.shape[0]
+        dynP = np.zeros(numPts, dtype=c_float)
+        self.SeaSt_C_GetDynPressurePts(
+            byref(self._handle_c),                      # IN -> instance handle
+            byref(c_int(numPts)),                       # IN -> number of points
+            byref(c_double(time)),                      # IN -> current simulation time
+            pos.ctypes.data_as(POINTER(c_float)),       # IN -> positions (N x 3)
+            dynP.ctypes.data_as(POINTER(c_float)),      # OUT <- dynamic pressure (N)
+            byref(self.error_status_c),                 # OUT <- error status
+            self.error_message_c                        # OUT <- error message
+        )
+        self.check_error()
+        return dynP
+
+
     @property
     def num_outs(self):
         return self._numChannels.value
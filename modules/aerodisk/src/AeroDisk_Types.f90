@@ -727,6 +727,29 @@ subroutine ADsk_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    DstInputData%BlPitch = SrcInputData%BlPitch
 end subroutine
 
+subroutine ADsk_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(ADsk_InputType), intent(inout) :: InputData1
+   type(ADsk_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_RotSpeed
+   REAL(ReKi) :: tmp_BlPitch
+   character(*), parameter        :: RoutineName = 'ADsk_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%HubMotion, InputData2%HubMotion, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   tmp_RotSpeed = InputData1%RotSpeed
+   InputData1%RotSpeed = InputData2%RotSpeed
+   InputData2%RotSpeed = tmp_RotSpeed
+   tmp_BlPitch = InputData1%BlPitch
+   InputData1%BlPitch = InputData2%BlPitch
+   InputData2%BlPitch = tmp_BlPitch
+end subroutine
+
 subroutine ADsk_DestroyInput(InputData, ErrStat, ErrMsg)
    type(ADsk_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -858,6 +881,20 @@ subroutine ADsk_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrS
    DstContStateData%DummyContState = SrcContStateData%DummyContState
 end subroutine
 
+subroutine ADsk_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(ADsk_ContinuousStateType), intent(inout) :: ContStateData1
+   type(ADsk_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyContState
+   character(*), parameter        :: RoutineName = 'ADsk_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyContState = ContStateData1%DummyContState
+   ContStateData1%DummyContState = ContStateData2%DummyContState
+   ContStateData2%DummyContState = tmp_DummyContState
+end subroutine
+
 subroutine ADsk_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(ADsk_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -896,6 +933,20 @@ subroutine ADsk_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrS
    DstDiscStateData%DummyDiscreteState = SrcDiscStateData%DummyDiscreteState
 end subroutine
 
+subroutine ADsk_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(ADsk_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(ADsk_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyDiscreteState
+   character(*), parameter        :: RoutineName = 'ADsk_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscreteState = DiscStateData1%DummyDiscreteState
+   DiscStateData1%DummyDiscreteState = DiscStateData2%DummyDiscreteState
+   DiscStateData2%DummyDiscreteState = tmp_DummyDiscreteState
+end subroutine
+
 subroutine ADsk_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(ADsk_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -934,6 +985,20 @@ subroutine ADsk_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine ADsk_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(ADsk_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(ADsk_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'ADsk_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine ADsk_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(ADsk_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -972,6 +1037,20 @@ subroutine ADsk_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, E
    DstOtherStateData%DummyOtherState = SrcOtherStateData%DummyOtherState
 end subroutine
 
+subroutine ADsk_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(ADsk_OtherStateType), intent(inout) :: OtherStateData1
+   type(ADsk_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   INTEGER(IntKi) :: tmp_DummyOtherState
+   character(*), parameter        :: RoutineName = 'ADsk_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyOtherState = OtherStateData1%DummyOtherState
+   OtherStateData1%DummyOtherState = OtherStateData2%DummyOtherState
+   OtherStateData2%DummyOtherState = tmp_DummyOtherState
+end subroutine
+
 subroutine ADsk_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(ADsk_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
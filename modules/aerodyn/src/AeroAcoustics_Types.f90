@@ -957,6 +957,24 @@ subroutine AA_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSta
    end if
 end subroutine
 
+subroutine AA_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(AA_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(AA_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_TIVx(:,:)
+   REAL(ReKi), allocatable :: tmp_RegVxStor(:,:,:)
+   character(*), parameter        :: RoutineName = 'AA_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(DiscStateData1%TIVx, tmp_TIVx)
+   call move_alloc(DiscStateData2%TIVx, DiscStateData1%TIVx)
+   call move_alloc(tmp_TIVx, DiscStateData2%TIVx)
+   call move_alloc(DiscStateData1%RegVxStor, tmp_RegVxStor)
+   call move_alloc(DiscStateData2%RegVxStor, DiscStateData1%RegVxStor)
+   call move_alloc(tmp_RegVxStor, DiscStateData2%RegVxStor)
+end subroutine
+
 subroutine AA_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(AA_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1019,6 +1037,20 @@ subroutine AA_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Err
    end if
 end subroutine
 
+subroutine AA_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(AA_OtherStateType), intent(inout) :: OtherStateData1
+   type(AA_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   INTEGER(IntKi), allocatable :: tmp_allregcounter(:,:)
+   character(*), parameter        :: RoutineName = 'AA_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(OtherStateData1%allregcounter, tmp_allregcounter)
+   call move_alloc(OtherStateData2%allregcounter, OtherStateData1%allregcounter)
+   call move_alloc(tmp_allregcounter, OtherStateData2%allregcounter)
+end subroutine
+
 subroutine AA_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(AA_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2092,6 +2124,36 @@ subroutine AA_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine AA_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(AA_InputType), intent(inout) :: InputData1
+   type(AA_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_RotGtoL(:,:,:,:)
+   REAL(ReKi), allocatable :: tmp_AeroCent_G(:,:,:)
+   REAL(ReKi), allocatable :: tmp_Vrel(:,:)
+   REAL(ReKi), allocatable :: tmp_AoANoise(:,:)
+   REAL(ReKi), allocatable :: tmp_Inflow(:,:,:)
+   character(*), parameter        :: RoutineName = 'AA_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(InputData1%RotGtoL, tmp_RotGtoL)
+   call move_alloc(InputData2%RotGtoL, InputData1%RotGtoL)
+   call move_alloc(tmp_RotGtoL, InputData2%RotGtoL)
+   call move_alloc(InputData1%AeroCent_G, tmp_AeroCent_G)
+   call move_alloc(InputData2%AeroCent_G, InputData1%AeroCent_G)
+   call move_alloc(tmp_AeroCent_G, InputData2%AeroCent_G)
+   call move_alloc(InputData1%Vrel, tmp_Vrel)
+   call move_alloc(InputData2%Vrel, InputData1%Vrel)
+   call move_alloc(tmp_Vrel, InputData2%Vrel)
+   call move_alloc(InputData1%AoANoise, tmp_AoANoise)
+   call move_alloc(InputData2%AoANoise, InputData1%AoANoise)
+   call move_alloc(tmp_AoANoise, InputData2%AoANoise)
+   call move_alloc(InputData1%Inflow, tmp_Inflow)
+   call move_alloc(InputData2%Inflow, InputData1%Inflow)
+   call move_alloc(tmp_Inflow, InputData2%Inflow)
+end subroutine
+
 subroutine AA_DestroyInput(InputData, ErrStat, ErrMsg)
    type(AA_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
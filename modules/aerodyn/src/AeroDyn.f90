@@ -759,6 +759,17 @@ endif
    if (p%TwrPotent /= TwrPotent_none .or. p%TwrShadow /= TwrShadow_none) then
       call AllocAry( m%TwrClrnc, p%NumBlNds, p%NumBlades, 'm%TwrClrnc', ErrStat2, ErrMsg2 )
          call SetErrStat( errStat2, errMsg2, errStat, errMsg, RoutineName )
+         ! search index for the nearest tower element/node (refreshed in TwrInfl_RefitIndex):
+      call AllocAry( m%TwrNodePos, 3, p%NumTwrNds, 'm%TwrNodePos', ErrStat2, ErrMsg2 )
+         call SetErrStat( errStat2, errMsg2, errStat, errMsg, RoutineName )
+      call AllocAry( m%TwrNodeOrder, p%NumTwrNds, 'm%TwrNodeOrder', ErrStat2, ErrMsg2 )
+         call SetErrStat( errStat2, errMsg2, errStat, errMsg, RoutineName )
+      call AllocAry( m%TwrElemOrder, max(p%NumTwrNds-1,0), 'm%TwrElemOrder', ErrStat2, ErrMsg2 )
+         call SetErrStat( errStat2, errMsg2, errStat, errMsg, RoutineName )
+      call AllocAry( m%TwrElemZLo, max(p%NumTwrNds-1,0), 'm%TwrElemZLo', ErrStat2, ErrMsg2 )
+         call SetErrStat( errStat2, errMsg2, errStat, errMsg, RoutineName )
+      call AllocAry( m%TwrElemZHi, max(p%NumTwrNds-1,0), 'm%TwrElemZHi', ErrStat2, ErrMsg2 )
+         call SetErrStat( errStat2, errMsg2, errStat, errMsg, RoutineName )
    end if
 
    call AllocAry( m%Cant, p%NumBlNds, p%NumBlades, 'm%Cant', ErrStat2, ErrMsg2 )
@@ -5473,6 +5484,63 @@ SUBROUTINE CheckTwrInfl(u, ErrStat, ErrMsg )
    
 END SUBROUTINE CheckTwrInfl
 !----------------------------------------------------------------------------------------------------------------------------------
+!> This routine updates the search index used to find the tower element or node nearest to a point (see TwrInfl_NearestLine2Element
+!! and TwrInfl_NearestPoint) from the deflected tower: the node positions, the line2 elements sorted by the elevation of their lowest
+!! node, and the nodes sorted by elevation. The tower nodes are normally ordered from base to top, in which case the insertion
+!! sorts below take a single pass.
+SUBROUTINE TwrInfl_RefitIndex( u, m )
+
+   TYPE(RotInputType),           INTENT(IN   )  :: u                       !< Inputs at Time t
+   type(RotMiscVarType),         intent(inout)  :: m                       !< Misc/optimization variables
+
+   ! local variables
+   real(ReKi)                                   :: zLo, zHi                ! lowest and highest elevation of an element
+   integer(IntKi)                               :: i, jElem, n1, n2        ! loop counters, element and node numbers
+
+
+   do n1 = 1, u%TowerMotion%NNodes
+      m%TwrNodePos(:,n1) = u%TowerMotion%Position(:,n1) + u%TowerMotion%TranslationDisp(:,n1)
+   end do
+
+      ! line2 elements, sorted by the elevation of their lowest node
+   do jElem = 1, u%TowerMotion%ElemTable(ELEMENT_LINE2)%nelem
+      n1 = u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(jElem)%ElemNodes(1)
+      n2 = u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(jElem)%ElemNodes(2)
+      zLo = min( m%TwrNodePos(3,n1), m%TwrNodePos(3,n2) )
+
+      i = jElem - 1
+      do while (i > 0)
+         if (m%TwrElemZLo(i) <= zLo) exit
+         m%TwrElemOrder(i+1) = m%TwrElemOrder(i)
+         m%TwrElemZLo(  i+1) = m%TwrElemZLo(  i)
+         i = i - 1
+      end do
+      m%TwrElemOrder(i+1) = jElem
+      m%TwrElemZLo(  i+1) = zLo
+   end do
+
+      ! running maximum of the elevation of the highest node, so the search can stop going down the list
+   zHi = -HUGE(zHi)
+   do i = 1, u%TowerMotion%ElemTable(ELEMENT_LINE2)%nelem
+      n1 = u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(m%TwrElemOrder(i))%ElemNodes(1)
+      n2 = u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(m%TwrElemOrder(i))%ElemNodes(2)
+      zHi = max( zHi, m%TwrNodePos(3,n1), m%TwrNodePos(3,n2) )
+      m%TwrElemZHi(i) = zHi
+   end do
+
+      ! nodes, sorted by elevation
+   do n1 = 1, u%TowerMotion%NNodes
+      i = n1 - 1
+      do while (i > 0)
+         if (m%TwrNodePos(3,m%TwrNodeOrder(i)) <= m%TwrNodePos(3,n1)) exit
+         m%TwrNodeOrder(i+1) = m%TwrNodeOrder(i)
+         i = i - 1
+      end do
+      m%TwrNodeOrder(i+1) = n1
+   end do
+
+END SUBROUTINE TwrInfl_RefitIndex
+!----------------------------------------------------------------------------------------------------------------------------------
 !> This routine calculates m%DisturbedInflow, the influence of tower shadow and/or potential flow on the inflow velocities
 SUBROUTINE TwrInfl( p, u, RotInflow, m, ErrStat, ErrMsg )
 !..................................................................................................................................
@@ -5494,9 +5562,10 @@ SUBROUTINE TwrInfl( p, u, RotInflow, m, ErrStat, ErrMsg )
    real(ReKi)                                   :: W_tower                 ! local relative wind speed normal to the tower
 
    real(ReKi)                                   :: BladeNodePosition(3)    ! local blade node position
-   
+   real(ReKi)                                   :: TwrClrnc                ! local tower clearance
+
    real(ReKi)                                   :: v(3)                    ! temp vector
-   
+
    logical                                      :: FirstWarn_TowerStrike
    logical                                      :: DisturbInflow
    
@@ -5515,16 +5584,20 @@ SUBROUTINE TwrInfl( p, u, RotInflow, m, ErrStat, ErrMsg )
    call CheckTwrInfl( u, ErrStat2, ErrMsg2 )
       call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
       if (ErrStat >= AbortErrLev) return
-      
+
+      ! update the tower search index for the deflected tower:
+   call TwrInfl_RefitIndex( u, m )
+
    do k = 1, p%NumBlades
       do j = 1, u%BladeMotion(k)%NNodes
-         
-         ! for each line2-element node of the blade mesh, a nearest-neighbor line2 element or node of the tower 
+
+         ! for each line2-element node of the blade mesh, a nearest-neighbor line2 element or node of the tower
          ! mesh is found in the deflected configuration, returning theta_tower, W_tower, xbar, ybar, zbar, and TowerCd:
-         
+
          BladeNodePosition = u%BladeMotion(k)%Position(:,j) + u%BladeMotion(k)%TranslationDisp(:,j)
-         
-         call getLocalTowerProps(p, u, RotInflow, BladeNodePosition, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, m%TwrClrnc(j,k), FirstWarn_TowerStrike, DisturbInflow, ErrStat2, ErrMsg2)
+
+         call getLocalTowerProps(p, u, RotInflow, m, BladeNodePosition, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrClrnc, FirstWarn_TowerStrike, DisturbInflow, ErrStat2, ErrMsg2)
+            m%TwrClrnc(j,k) = TwrClrnc
             call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
             if (.not. FirstWarn_TowerStrike) call SetErrStat(ErrID_Fatal, "Tower strike.", ErrStat, ErrMsg, RoutineName )
             if (ErrStat >= AbortErrLev) return
@@ -5581,6 +5654,9 @@ SUBROUTINE TwrInflArray( p, u, RotInflow, m, Positions, Inflow, ErrStat, ErrMsg
    ! these models are valid for only small tower deflections; check for potential division-by-zero errors:   
    call CheckTwrInfl( u, ErrStat2, ErrMsg2 ); call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName ); if (ErrStat >= AbortErrLev) return
 
+   ! update the tower search index for the deflected tower (read-only in the loop below)
+   call TwrInfl_RefitIndex( u, m )
+
    !$OMP PARALLEL default(shared)
    !$OMP do private(i,Pos,theta_tower_trans,W_tower,xbar,ybar,zbar,TwrCd,TwrTI,TwrClrnc,FirstWarn_TowerStrike,DisturbInflow,v) schedule(runtime)
    do i = 1, size(Positions,2)
@@ -5588,7 +5664,7 @@ SUBROUTINE TwrInflArray( p, u, RotInflow, m, Positions, Inflow, ErrStat, ErrMsg
          
       ! Find nearest line2 element or node of the tower  (see getLocalTowerProps)
       ! values are found for the deflected tower, returning theta_tower, W_tower, xbar, ybar, zbar, and TowerCd:
-      call getLocalTowerProps(p, u, RotInflow, Pos, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrClrnc, FirstWarn_TowerStrike, DisturbInflow, ErrStat2, ErrMsg2)
+      call getLocalTowerProps(p, u, RotInflow, m, Pos, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrClrnc, FirstWarn_TowerStrike, DisturbInflow, ErrStat2, ErrMsg2)
 
       if ( DisturbInflow ) then
          v = CalculateTowerInfluence(p, xbar, ybar, zbar, W_tower, TwrCd, TwrTI)
@@ -5677,11 +5753,12 @@ END FUNCTION CalculateTowerInfluence
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This routine returns the tower constants necessary to compute the tower influence. 
 !! if u%TowerMotion does not have any nodes there will be serious problems. I assume that has been checked earlier.
-SUBROUTINE getLocalTowerProps(p, u, RotInflow, BladeNodePosition, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrClrnc, FirstWarn_TowerStrike, DisturbInflow, ErrStat, ErrMsg)
+SUBROUTINE getLocalTowerProps(p, u, RotInflow, m, BladeNodePosition, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrClrnc, FirstWarn_TowerStrike, DisturbInflow, ErrStat, ErrMsg)
 !..................................................................................................................................
    TYPE(RotInputType),           INTENT(IN   )  :: u                       !< Inputs at Time t
    TYPE(RotInflowType),          INTENT(IN   )  :: RotInflow               !< Rotor inflow at Time t 
    TYPE(RotParameterType),       INTENT(IN   )  :: p                       !< Parameters
+   type(RotMiscVarType),         intent(in   )  :: m                       !< Misc/optimization variables (tower search index from TwrInfl_RefitIndex)
    REAL(ReKi)                   ,INTENT(IN   )  :: BladeNodePosition(3)    !< local blade node position
    REAL(ReKi)                   ,INTENT(  OUT)  :: theta_tower_trans(3,3)  !< transpose of local tower orientation expressed as a DCM
    LOGICAL                      ,INTENT(INOUT)  :: FirstWarn_TowerStrike   !< Whether we should check and warn for a tower strike 
@@ -5709,13 +5786,13 @@ SUBROUTINE getLocalTowerProps(p, u, RotInflow, BladeNodePosition, theta_tower_tr
    ! ..............................................
    ! option 1: nearest line2 element
    ! ..............................................
-   call TwrInfl_NearestLine2Element(p, u, RotInflow, BladeNodePosition, r_TowerBlade, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrDiam, found)
+   call TwrInfl_NearestLine2Element(p, u, RotInflow, m, BladeNodePosition, r_TowerBlade, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrDiam, found)
    
    if ( .not. found) then 
       ! ..............................................
       ! option 2: nearest node
       ! ..............................................
-      call TwrInfl_NearestPoint(p, u, RotInflow, BladeNodePosition, r_TowerBlade, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrDiam)
+      call TwrInfl_NearestPoint(p, u, RotInflow, m, BladeNodePosition, r_TowerBlade, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrDiam)
          
    end if
    
@@ -5749,14 +5826,18 @@ END SUBROUTINE getLocalTowerProps
 !----------------------------------------------------------------------------------------------------------------------------------
 !> Option 1: Find the nearest-neighbor line2 element of the tower mesh for which the blade line2-element node projects orthogonally onto
 !!   the tower line2-element domain (following an approach similar to the line2_to_line2 mapping search for motion and scalar quantities). 
-!!   That is, for each node of the blade mesh, an orthogonal projection is made onto all possible Line2 elements of the tower mesh and 
+!!   That is, for each node of the blade mesh, an orthogonal projection is made onto the Line2 elements of the tower mesh and 
 !!   the line2 element of the tower mesh that is the minimum distance away is found.
+!!   The elements are visited in elevation order (see TwrInfl_RefitIndex), starting from the elevation of the blade node, and the
+!!   search stops once the vertical gap to the remaining elements exceeds the minimum distance found so far. Ties are resolved in
+!!   favor of the lowest element number, so the element found is the same as with an exhaustive search.
 !! Adapted from modmesh_mapping::createmapping_projecttoline2()
-SUBROUTINE TwrInfl_NearestLine2Element(p, u, RotInflow, BladeNodePosition, r_TowerBlade, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrDiam, found)
+SUBROUTINE TwrInfl_NearestLine2Element(p, u, RotInflow, m, BladeNodePosition, r_TowerBlade, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrDiam, found)
 !..................................................................................................................................
    TYPE(RotInputType),              INTENT(IN   )  :: u                             !< Inputs at Time t
    TYPE(RotInflowType),             INTENT(IN   )  :: RotInflow                     !< Rotor Inflow at Time t
    TYPE(RotParameterType),          INTENT(IN   )  :: p                             !< Parameters
+   TYPE(RotMiscVarType),            INTENT(IN   )  :: m                             !< Misc/optimization variables (tower search index)
    REAL(ReKi)                      ,INTENT(IN   )  :: BladeNodePosition(3)          !< local blade node position
    REAL(ReKi)                      ,INTENT(  OUT)  :: r_TowerBlade(3)               !< distance vector from tower to blade
    REAL(ReKi)                      ,INTENT(  OUT)  :: theta_tower_trans(3,3)        !< transpose of local tower orientation expressed as a DCM
@@ -5771,131 +5852,178 @@ SUBROUTINE TwrInfl_NearestLine2Element(p, u, RotInflow, BladeNodePosition, r_Tow
       
       ! local variables
    REAL(ReKi)      :: denom
-   REAL(ReKi)      :: dist
    REAL(ReKi)      :: min_dist
+   REAL(ReKi)      :: gap                 ! vertical distance between the blade node and an element (lower bound on their distance)
    REAL(ReKi)      :: elem_position, elem_position2
-   REAL(SiKi)      :: elem_position_SiKi
+   REAL(ReKi)      :: min_elem_position   ! elem_position on the nearest element
 
    REAL(ReKi)      :: p1(3), p2(3)        ! position vectors for nodes on tower line 2 element
    
    REAL(ReKi)      :: V_rel_tower(3)
    
    REAL(ReKi)      :: n1_n2_vector(3)     ! vector going from node 1 to node 2 in Line2 element
-   REAL(ReKi)      :: n1_Point_vector(3)  ! vector going from node 1 in Line 2 element to Destination Point
    REAL(ReKi)      :: tmp(3)              ! temporary vector for cross product calculation
 
-   INTEGER(IntKi)  :: jElem               ! do-loop counter for elements on tower mesh
+   INTEGER(IntKi)  :: i                   ! index into the elevation-sorted element list
+   INTEGER(IntKi)  :: iLo, iHi, iMid      ! bisection bounds
+   INTEGER(IntKi)  :: nElem               ! number of elements on tower mesh
+   INTEGER(IntKi)  :: jElem               ! element on tower mesh
+   INTEGER(IntKi)  :: min_jElem           ! nearest element on tower mesh
 
    INTEGER(IntKi)  :: n1, n2              ! nodes associated with an element
-
-   LOGICAL         :: on_element
    
       
    found = .false.
    min_dist = HUGE(min_dist)
+   min_jElem = 0
+   min_elem_position = 0.0_ReKi
+   nElem = u%TowerMotion%ElemTable(ELEMENT_LINE2)%nelem   ! number of elements on TowerMesh
+
+      ! find the first element (in elevation order) whose lowest node is above the blade node
+   iLo = 0
+   iHi = nElem + 1
+   do while (iHi - iLo > 1)
+      iMid = (iLo + iHi) / 2
+      if (m%TwrElemZLo(iMid) > BladeNodePosition(3)) then
+         iHi = iMid
+      else
+         iLo = iMid
+      end if
+   end do
 
-   do jElem = 1, u%TowerMotion%ElemTable(ELEMENT_LINE2)%nelem   ! number of elements on TowerMesh
-         ! grab node numbers associated with the jElem_th element
-      n1 = u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(jElem)%ElemNodes(1)
-      n2 = u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(jElem)%ElemNodes(2)
+      ! elements starting at or below the blade node, going down; TwrElemZHi does not increase in this direction
+   do i = iLo, 1, -1
+      gap = BladeNodePosition(3) - m%TwrElemZHi(i)
+      if (gap > 0.0_ReKi) then
+         if (gap*gap > min_dist) exit
+      end if
+      call CheckElement( m%TwrElemOrder(i) )
+   end do
+
+      ! elements starting above the blade node, going up; TwrElemZLo does not decrease in this direction
+   do i = iHi, nElem
+      gap = m%TwrElemZLo(i) - BladeNodePosition(3)
+      if (gap*gap > min_dist) exit
+      call CheckElement( m%TwrElemOrder(i) )
+   end do
 
-      p1 = u%TowerMotion%Position(:,n1) + u%TowerMotion%TranslationDisp(:,n1)
-      p2 = u%TowerMotion%Position(:,n2) + u%TowerMotion%TranslationDisp(:,n2)
+   if (.not. found) return
 
-         ! Calculate vectors used in projection operation
-      n1_n2_vector    = p2 - p1
-      n1_Point_vector = BladeNodePosition - p1
+      ! calculate the values to be returned for the nearest element:
+   n1 = u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(min_jElem)%ElemNodes(1)
+   n2 = u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(min_jElem)%ElemNodes(2)
+
+   p1 = m%TwrNodePos(:,n1)
+   p2 = m%TwrNodePos(:,n2)
+   n1_n2_vector = p2 - p1
+   denom        = DOT_PRODUCT( n1_n2_vector, n1_n2_vector )
+
+   elem_position  = min_elem_position
+   elem_position2 = 1.0_ReKi - elem_position
+   r_TowerBlade   = BladeNodePosition - elem_position2*p1 - elem_position*p2
+
+   V_rel_tower =   ( RotInflow%Tower%InflowVel(:,n1) - u%TowerMotion%TranslationVel(:,n1) ) * elem_position2  &
+                 + ( RotInflow%Tower%InflowVel(:,n2) - u%TowerMotion%TranslationVel(:,n2) ) * elem_position
+   
+   TwrDiam     = elem_position2*p%TwrDiam(n1) + elem_position*p%TwrDiam(n2)
+   TwrCd       = elem_position2*p%TwrCd(  n1) + elem_position*p%TwrCd(  n2)
+   TwrTI       = elem_position2*p%TwrTI(  n1) + elem_position*p%TwrTI(  n2)
+   
+   
+   ! z_hat
+   theta_tower_trans(:,3) = n1_n2_vector / sqrt( denom ) ! = n1_n2_vector / twoNorm( n1_n2_vector )
+   
+   tmp = V_rel_tower - dot_product(V_rel_tower,theta_tower_trans(:,3)) * theta_tower_trans(:,3)
+   denom = TwoNorm( tmp )
+   if (.not. EqualRealNos( denom, 0.0_ReKi ) ) then
+      ! x_hat
+      theta_tower_trans(:,1) = tmp / denom
+      
+      ! y_hat
+      tmp = cross_product( theta_tower_trans(:,3), V_rel_tower )
+      theta_tower_trans(:,2) = tmp / denom  
+      
+      W_tower = dot_product( V_rel_tower,theta_tower_trans(:,1) )
+      xbar    = 2.0/TwrDiam * dot_product( r_TowerBlade, theta_tower_trans(:,1) )
+      ybar    = 2.0/TwrDiam * dot_product( r_TowerBlade, theta_tower_trans(:,2) )
+      zbar    = 0.0_ReKi
+                                    
+   else
+         ! there is no tower influence because dot_product(V_rel_tower,x_hat) = 0
+         ! thus, we don't need to set the other values (except we don't want the sum of xbar^2 and ybar^2 to be 0)
+      theta_tower_trans = 0.0_ReKi
+      W_tower           = 0.0_ReKi
+      xbar              = 1.0_ReKi
+      ybar              = 0.0_ReKi  
+      zbar              = 0.0_ReKi
+   end if
 
-      denom           = DOT_PRODUCT( n1_n2_vector, n1_n2_vector ) ! we've already checked that these aren't zero
+contains
+   !> Project the blade node onto element jElem and keep it if it is the nearest so far
+   subroutine CheckElement(jElem)
+      integer(IntKi), intent(in) :: jElem
+      REAL(ReKi)      :: dist
+      REAL(ReKi)      :: elem_pos
+      REAL(SiKi)      :: elem_position_SiKi
+      REAL(ReKi)      :: e1(3), e2(3)        ! position vectors for nodes on tower line 2 element
+      REAL(ReKi)      :: e1_e2_vector(3)     ! vector going from node 1 to node 2 in Line2 element
+      REAL(ReKi)      :: e1_Point_vector(3)  ! vector going from node 1 in Line 2 element to Destination Point
+      REAL(ReKi)      :: r(3)                ! distance vector from element to blade node
+      LOGICAL         :: on_element
+
+         ! grab node positions associated with the jElem_th element
+      e1 = m%TwrNodePos(:, u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(jElem)%ElemNodes(1))
+      e2 = m%TwrNodePos(:, u%TowerMotion%ElemTable(ELEMENT_LINE2)%Elements(jElem)%ElemNodes(2))
 
-         ! project point onto line defined by n1 and n2
+         ! Calculate vectors used in projection operation
+      e1_e2_vector    = e2 - e1
+      e1_Point_vector = BladeNodePosition - e1
 
-      elem_position = DOT_PRODUCT(n1_n2_vector,n1_Point_vector) / denom
+         ! project point onto line defined by n1 and n2 (we've already checked that the element length isn't zero)
+      elem_pos = DOT_PRODUCT(e1_e2_vector,e1_Point_vector) / DOT_PRODUCT( e1_e2_vector, e1_e2_vector )
 
             ! note: i forumlated it this way because Fortran doesn't necessarially do shortcutting and I don't want to call EqualRealNos if we don't need it:
-      if ( elem_position .ge. 0.0_ReKi .and. elem_position .le. 1.0_ReKi ) then !we're ON the element (between the two nodes)
+      if ( elem_pos .ge. 0.0_ReKi .and. elem_pos .le. 1.0_ReKi ) then !we're ON the element (between the two nodes)
          on_element = .true.
       else
-         elem_position_SiKi = REAL( elem_position, SiKi )
+         elem_position_SiKi = REAL( elem_pos, SiKi )
          if (EqualRealNos( elem_position_SiKi, 1.0_SiKi )) then !we're ON the element (at a node)
             on_element = .true.
-            elem_position = 1.0_ReKi
+            elem_pos = 1.0_ReKi
          elseif (EqualRealNos( elem_position_SiKi,  0.0_SiKi )) then !we're ON the element (at a node)
             on_element = .true.
-            elem_position = 0.0_ReKi
+            elem_pos = 0.0_ReKi
          else !we're not on the element
             on_element = .false.
          end if
-         
       end if
 
-      if (on_element) then
-
-         ! calculate distance between point and line (note: this is actually the distance squared);
-         ! will only store information once we have determined the closest element
-         elem_position2 = 1.0_ReKi - elem_position
-         
-         r_TowerBlade  = BladeNodePosition - elem_position2*p1 - elem_position*p2
-         dist = dot_product( r_TowerBlade, r_TowerBlade )
-
-         if (dist .lt. min_dist) then
-            found = .true.
-            min_dist = dist
+      if (.not. on_element) return
 
-            V_rel_tower =   ( RotInflow%Tower%InflowVel(:,n1) - u%TowerMotion%TranslationVel(:,n1) ) * elem_position2  &
-                          + ( RotInflow%Tower%InflowVel(:,n2) - u%TowerMotion%TranslationVel(:,n2) ) * elem_position
-            
-            TwrDiam     = elem_position2*p%TwrDiam(n1) + elem_position*p%TwrDiam(n2)
-            TwrCd       = elem_position2*p%TwrCd(  n1) + elem_position*p%TwrCd(  n2)
-            TwrTI       = elem_position2*p%TwrTI(  n1) + elem_position*p%TwrTI(  n2)
-            
-            
-            ! z_hat
-            theta_tower_trans(:,3) = n1_n2_vector / sqrt( denom ) ! = n1_n2_vector / twoNorm( n1_n2_vector )
-            
-            tmp = V_rel_tower - dot_product(V_rel_tower,theta_tower_trans(:,3)) * theta_tower_trans(:,3)
-            denom = TwoNorm( tmp )
-            if (.not. EqualRealNos( denom, 0.0_ReKi ) ) then
-               ! x_hat
-               theta_tower_trans(:,1) = tmp / denom
-               
-               ! y_hat
-               tmp = cross_product( theta_tower_trans(:,3), V_rel_tower )
-               theta_tower_trans(:,2) = tmp / denom  
-               
-               W_tower = dot_product( V_rel_tower,theta_tower_trans(:,1) )
-               xbar    = 2.0/TwrDiam * dot_product( r_TowerBlade, theta_tower_trans(:,1) )
-               ybar    = 2.0/TwrDiam * dot_product( r_TowerBlade, theta_tower_trans(:,2) )
-               zbar    = 0.0_ReKi
-                                             
-            else
-                  ! there is no tower influence because dot_product(V_rel_tower,x_hat) = 0
-                  ! thus, we don't need to set the other values (except we don't want the sum of xbar^2 and ybar^2 to be 0)
-               theta_tower_trans = 0.0_ReKi
-               W_tower           = 0.0_ReKi
-               xbar              = 1.0_ReKi
-               ybar              = 0.0_ReKi  
-               zbar              = 0.0_ReKi
-            end if
-   
-            
-         end if !the point is closest to this line2 element
+         ! calculate distance between point and line (note: this is actually the distance squared)
+      r    = BladeNodePosition - (1.0_ReKi - elem_pos)*e1 - elem_pos*e2
+      dist = dot_product( r, r )
 
+      if (dist < min_dist .or. (dist == min_dist .and. jElem < min_jElem)) then
+         found             = .true.
+         min_dist          = dist
+         min_jElem         = jElem
+         min_elem_position = elem_pos
       end if
-
-   end do !jElem
+   end subroutine CheckElement
 
 END SUBROUTINE TwrInfl_NearestLine2Element
 !----------------------------------------------------------------------------------------------------------------------------------
 !> Option 2: used when the blade node does not orthogonally intersect a tower element.
 !!  Find the nearest-neighbor node in the tower Line2-element domain (following an approach similar to the point_to_point mapping
 !!  search for motion and scalar quantities). That is, for each node of the blade mesh, the node of the tower mesh that is the minimum 
-!!  distance away is found.
-SUBROUTINE TwrInfl_NearestPoint(p, u, RotInflow, BladeNodePosition, r_TowerBlade, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrDiam)
+!!  distance away is found. The nodes are visited in elevation order (see TwrInfl_RefitIndex), as in TwrInfl_NearestLine2Element.
+SUBROUTINE TwrInfl_NearestPoint(p, u, RotInflow, m, BladeNodePosition, r_TowerBlade, theta_tower_trans, W_tower, xbar, ybar, zbar, TwrCd, TwrTI, TwrDiam)
 !..................................................................................................................................
    TYPE(RotInputType),              INTENT(IN   )  :: u                             !< Inputs at Time t
    TYPE(RotInflowType),             INTENT(IN   )  :: RotInflow                     !< Rotor Inflow at Time t
    TYPE(RotParameterType),          INTENT(IN   )  :: p                             !< Parameters
+   TYPE(RotMiscVarType),            INTENT(IN   )  :: m                             !< Misc/optimization variables (tower search index)
    REAL(ReKi)                      ,INTENT(IN   )  :: BladeNodePosition(3)          !< local blade node position
    REAL(ReKi)                      ,INTENT(  OUT)  :: r_TowerBlade(3)               !< distance vector from tower to blade
    REAL(ReKi)                      ,INTENT(  OUT)  :: theta_tower_trans(3,3)        !< transpose of local tower orientation expressed as a DCM
@@ -5909,17 +6037,19 @@ SUBROUTINE TwrInfl_NearestPoint(p, u, RotInflow, BladeNodePosition, r_TowerBlade
       
       ! local variables
    REAL(ReKi)      :: denom
-   REAL(ReKi)      :: dist
    REAL(ReKi)      :: min_dist
+   REAL(ReKi)      :: gap                       ! vertical distance between the blade node and a tower node
    REAL(ReKi)      :: cosTaper
 
-   REAL(ReKi)      :: p1(3)                     ! position vectors for nodes on tower   
    REAL(ReKi)      :: V_rel_tower(3)
    
    REAL(ReKi)      :: tmp(3)                    ! temporary vector for cross product calculation
 
    INTEGER(IntKi)  :: n1                        ! node
    INTEGER(IntKi)  :: node_with_min_distance    
+   INTEGER(IntKi)  :: i                         ! index into the elevation-sorted node list
+   INTEGER(IntKi)  :: iLo, iHi, iMid            ! bisection bounds
+   INTEGER(IntKi)  :: nNodes                    ! number of nodes on tower mesh
 
    
    
@@ -5929,23 +6059,31 @@ SUBROUTINE TwrInfl_NearestPoint(p, u, RotInflow, BladeNodePosition, r_TowerBlade
       
    min_dist = HUGE(min_dist)
    node_with_min_distance = 0
+   nNodes = u%TowerMotion%NNodes   ! number of nodes on TowerMesh
+
+      ! find the first node (in elevation order) above the blade node
+   iLo = 0
+   iHi = nNodes + 1
+   do while (iHi - iLo > 1)
+      iMid = (iLo + iHi) / 2
+      if (m%TwrNodePos(3,m%TwrNodeOrder(iMid)) > BladeNodePosition(3)) then
+         iHi = iMid
+      else
+         iLo = iMid
+      end if
+   end do
 
-   do n1 = 1, u%TowerMotion%NNodes   ! number of nodes on TowerMesh
-      
-      p1 = u%TowerMotion%Position(:,n1) + u%TowerMotion%TranslationDisp(:,n1)
-      
-         ! calculate distance between points (note: this is actually the distance squared);
-         ! will only store information once we have determined the closest node
-      r_TowerBlade  = BladeNodePosition - p1         
-      dist = dot_product( r_TowerBlade, r_TowerBlade )
-
-      if (dist .lt. min_dist) then
-         min_dist = dist
-         node_with_min_distance = n1
-               
-      end if !the point is (so far) closest to this blade node
+   do i = iLo, 1, -1
+      gap = BladeNodePosition(3) - m%TwrNodePos(3,m%TwrNodeOrder(i))
+      if (gap*gap > min_dist) exit
+      call CheckNode( m%TwrNodeOrder(i) )
+   end do
 
-   end do !n1
+   do i = iHi, nNodes
+      gap = m%TwrNodePos(3,m%TwrNodeOrder(i)) - BladeNodePosition(3)
+      if (gap*gap > min_dist) exit
+      call CheckNode( m%TwrNodeOrder(i) )
+   end do
    
       !.................
       ! calculate the values to be returned:  
@@ -6010,6 +6148,23 @@ SUBROUTINE TwrInfl_NearestPoint(p, u, RotInflow, BladeNodePosition, r_TowerBlade
       
    end if   
 
+
+contains
+   !> Keep tower node n if it is the closest to the blade node so far
+   subroutine CheckNode(n)
+      integer(IntKi), intent(in) :: n
+      REAL(ReKi)      :: r(3)                      ! distance vector from tower node to blade node
+      REAL(ReKi)      :: dist
+
+         ! calculate distance between points (note: this is actually the distance squared)
+      r    = BladeNodePosition - m%TwrNodePos(:,n)
+      dist = dot_product( r, r )
+
+      if (dist < min_dist .or. (dist == min_dist .and. n < node_with_min_distance)) then
+         min_dist = dist
+         node_with_min_distance = n
+      end if !the point is (so far) closest to this blade node
+   end subroutine CheckNode
 END SUBROUTINE TwrInfl_NearestPoint
 !----------------------------------------------------------------------------------------------------------------------------------
 
@@ -624,6 +624,21 @@ subroutine ADI_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSt
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine ADI_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(ADI_ContinuousStateType), intent(inout) :: ContStateData1
+   type(ADI_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'ADI_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call AD_SwapContState(ContStateData1%AD, ContStateData2%AD, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine ADI_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(ADI_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -670,6 +685,21 @@ subroutine ADI_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSt
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine ADI_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(ADI_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(ADI_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'ADI_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call AD_SwapDiscState(DiscStateData1%AD, DiscStateData2%AD, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine ADI_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(ADI_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -716,6 +746,21 @@ subroutine ADI_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine ADI_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(ADI_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(ADI_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'ADI_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call AD_SwapConstrState(ConstrStateData1%AD, ConstrStateData2%AD, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine ADI_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(ADI_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -762,6 +807,21 @@ subroutine ADI_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Er
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine ADI_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(ADI_OtherStateType), intent(inout) :: OtherStateData1
+   type(ADI_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'ADI_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call AD_SwapOtherState(OtherStateData1%AD, OtherStateData2%AD, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine ADI_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(ADI_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -985,6 +1045,21 @@ subroutine ADI_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine ADI_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(ADI_InputType), intent(inout) :: InputData1
+   type(ADI_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'ADI_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call AD_SwapInput(InputData1%AD, InputData2%AD, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine ADI_DestroyInput(InputData, ErrStat, ErrMsg)
    type(ADI_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -504,6 +504,11 @@ IMPLICIT NONE
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: Cant      !< curvature angle, saved for possible output to file [rad]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: Toe      !< Toe angle, saved for possible output to file [rad]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: TwrClrnc      !< Distance between tower (including tower radius) and blade node (not including blade width), saved for possible output to file [m]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: TwrNodePos      !< Deflected tower node positions, refreshed each time the tower influence is computed [m]
+    INTEGER(IntKi) , DIMENSION(:), ALLOCATABLE  :: TwrElemOrder      !< Tower line2 elements sorted by the elevation of their lowest node (tower-influence search index) [-]
+    REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: TwrElemZLo      !< Elevation of the lowest node of each element in TwrElemOrder [m]
+    REAL(ReKi) , DIMENSION(:), ALLOCATABLE  :: TwrElemZHi      !< Running maximum of the elevation of the highest node of the elements in TwrElemOrder [m]
+    INTEGER(IntKi) , DIMENSION(:), ALLOCATABLE  :: TwrNodeOrder      !< Tower nodes sorted by elevation (tower-influence search index) [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: X      !< normal force per unit length (normal to the plane, not chord) of the jth node in the kth blade [N/m]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: Y      !< tangential force per unit length (tangential to the plane, not chord) of the jth node in the kth blade [N/m]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: Z      !< axial force per unit length (tangential to the plane, not chord) of the jth node in the kth blade [N/m]
@@ -2479,6 +2484,21 @@ subroutine AD_CopyRotContinuousStateType(SrcRotContinuousStateTypeData, DstRotCo
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine AD_SwapRotContinuousStateType(RotContinuousStateTypeData1, RotContinuousStateTypeData2, ErrStat, ErrMsg)
+   type(RotContinuousStateType), intent(inout) :: RotContinuousStateTypeData1
+   type(RotContinuousStateType), intent(inout) :: RotContinuousStateTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'AD_SwapRotContinuousStateType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call BEMT_SwapContState(RotContinuousStateTypeData1%BEMT, RotContinuousStateTypeData2%BEMT, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine AD_DestroyRotContinuousStateType(RotContinuousStateTypeData, ErrStat, ErrMsg)
    type(RotContinuousStateType), intent(inout) :: RotContinuousStateTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2543,6 +2563,40 @@ subroutine AD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSta
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine AD_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(AD_ContinuousStateType), intent(inout) :: ContStateData1
+   type(AD_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'AD_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(ContStateData1%rotors) .neqv. allocated(ContStateData2%rotors)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%rotors)) then
+      if (any(lbound(ContStateData1%rotors) /= lbound(ContStateData2%rotors)) .or. any(ubound(ContStateData1%rotors) /= ubound(ContStateData2%rotors))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ContStateData1%rotors)
+      UB(1:1) = ubound(ContStateData1%rotors)
+      do i1 = LB(1), UB(1)
+         call AD_SwapRotContinuousStateType(ContStateData1%rotors(i1), ContStateData2%rotors(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call FVW_SwapContState(ContStateData1%FVW, ContStateData2%FVW, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine AD_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(AD_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2631,6 +2685,24 @@ subroutine AD_CopyRotDiscreteStateType(SrcRotDiscreteStateTypeData, DstRotDiscre
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine AD_SwapRotDiscreteStateType(RotDiscreteStateTypeData1, RotDiscreteStateTypeData2, ErrStat, ErrMsg)
+   type(RotDiscreteStateType), intent(inout) :: RotDiscreteStateTypeData1
+   type(RotDiscreteStateType), intent(inout) :: RotDiscreteStateTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'AD_SwapRotDiscreteStateType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call BEMT_SwapDiscState(RotDiscreteStateTypeData1%BEMT, RotDiscreteStateTypeData2%BEMT, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call AA_SwapDiscState(RotDiscreteStateTypeData1%AA, RotDiscreteStateTypeData2%AA, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine AD_DestroyRotDiscreteStateType(RotDiscreteStateTypeData, ErrStat, ErrMsg)
    type(RotDiscreteStateType), intent(inout) :: RotDiscreteStateTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2699,6 +2771,40 @@ subroutine AD_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSta
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine AD_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(AD_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(AD_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'AD_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(DiscStateData1%rotors) .neqv. allocated(DiscStateData2%rotors)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(DiscStateData1%rotors)) then
+      if (any(lbound(DiscStateData1%rotors) /= lbound(DiscStateData2%rotors)) .or. any(ubound(DiscStateData1%rotors) /= ubound(DiscStateData2%rotors))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(DiscStateData1%rotors)
+      UB(1:1) = ubound(DiscStateData1%rotors)
+      do i1 = LB(1), UB(1)
+         call AD_SwapRotDiscreteStateType(DiscStateData1%rotors(i1), DiscStateData2%rotors(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call FVW_SwapDiscState(DiscStateData1%FVW, DiscStateData2%FVW, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine AD_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(AD_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2784,6 +2890,21 @@ subroutine AD_CopyRotConstraintStateType(SrcRotConstraintStateTypeData, DstRotCo
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine AD_SwapRotConstraintStateType(RotConstraintStateTypeData1, RotConstraintStateTypeData2, ErrStat, ErrMsg)
+   type(RotConstraintStateType), intent(inout) :: RotConstraintStateTypeData1
+   type(RotConstraintStateType), intent(inout) :: RotConstraintStateTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'AD_SwapRotConstraintStateType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call BEMT_SwapConstrState(RotConstraintStateTypeData1%BEMT, RotConstraintStateTypeData2%BEMT, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine AD_DestroyRotConstraintStateType(RotConstraintStateTypeData, ErrStat, ErrMsg)
    type(RotConstraintStateType), intent(inout) :: RotConstraintStateTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2848,6 +2969,40 @@ subroutine AD_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine AD_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(AD_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(AD_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'AD_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(ConstrStateData1%rotors) .neqv. allocated(ConstrStateData2%rotors)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ConstrStateData1%rotors)) then
+      if (any(lbound(ConstrStateData1%rotors) /= lbound(ConstrStateData2%rotors)) .or. any(ubound(ConstrStateData1%rotors) /= ubound(ConstrStateData2%rotors))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ConstrStateData1%rotors)
+      UB(1:1) = ubound(ConstrStateData1%rotors)
+      do i1 = LB(1), UB(1)
+         call AD_SwapRotConstraintStateType(ConstrStateData1%rotors(i1), ConstrStateData2%rotors(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call FVW_SwapConstrState(ConstrStateData1%FVW, ConstrStateData2%FVW, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine AD_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(AD_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2936,6 +3091,24 @@ subroutine AD_CopyRotOtherStateType(SrcRotOtherStateTypeData, DstRotOtherStateTy
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine AD_SwapRotOtherStateType(RotOtherStateTypeData1, RotOtherStateTypeData2, ErrStat, ErrMsg)
+   type(RotOtherStateType), intent(inout) :: RotOtherStateTypeData1
+   type(RotOtherStateType), intent(inout) :: RotOtherStateTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'AD_SwapRotOtherStateType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call BEMT_SwapOtherState(RotOtherStateTypeData1%BEMT, RotOtherStateTypeData2%BEMT, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call AA_SwapOtherState(RotOtherStateTypeData1%AA, RotOtherStateTypeData2%AA, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine AD_DestroyRotOtherStateType(RotOtherStateTypeData, ErrStat, ErrMsg)
    type(RotOtherStateType), intent(inout) :: RotOtherStateTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3016,6 +3189,44 @@ subroutine AD_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Err
    end if
 end subroutine
 
+subroutine AD_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(AD_OtherStateType), intent(inout) :: OtherStateData1
+   type(AD_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_WakeLocationPoints(:,:)
+   character(*), parameter        :: RoutineName = 'AD_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(OtherStateData1%rotors) .neqv. allocated(OtherStateData2%rotors)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%rotors)) then
+      if (any(lbound(OtherStateData1%rotors) /= lbound(OtherStateData2%rotors)) .or. any(ubound(OtherStateData1%rotors) /= ubound(OtherStateData2%rotors))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%rotors)
+      UB(1:1) = ubound(OtherStateData1%rotors)
+      do i1 = LB(1), UB(1)
+         call AD_SwapRotOtherStateType(OtherStateData1%rotors(i1), OtherStateData2%rotors(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call FVW_SwapOtherState(OtherStateData1%FVW, OtherStateData2%FVW, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call move_alloc(OtherStateData1%WakeLocationPoints, tmp_WakeLocationPoints)
+   call move_alloc(OtherStateData2%WakeLocationPoints, OtherStateData1%WakeLocationPoints)
+   call move_alloc(tmp_WakeLocationPoints, OtherStateData2%WakeLocationPoints)
+end subroutine
+
 subroutine AD_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(AD_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4461,6 +4672,70 @@ subroutine AD_CopyRotInputType(SrcRotInputTypeData, DstRotInputTypeData, CtrlCod
    end if
 end subroutine
 
+subroutine AD_SwapRotInputType(RotInputTypeData1, RotInputTypeData2, ErrStat, ErrMsg)
+   type(RotInputType), intent(inout) :: RotInputTypeData1
+   type(RotInputType), intent(inout) :: RotInputTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_UserProp(:,:)
+   character(*), parameter        :: RoutineName = 'AD_SwapRotInputType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(RotInputTypeData1%NacelleMotion, RotInputTypeData2%NacelleMotion, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(RotInputTypeData1%TowerMotion, RotInputTypeData2%TowerMotion, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(RotInputTypeData1%HubMotion, RotInputTypeData2%HubMotion, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   if (allocated(RotInputTypeData1%BladeRootMotion) .neqv. allocated(RotInputTypeData2%BladeRootMotion)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap RotInputTypeData1%BladeRootMotion with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(RotInputTypeData1%BladeRootMotion)) then
+      if (any(lbound(RotInputTypeData1%BladeRootMotion) /= lbound(RotInputTypeData2%BladeRootMotion)) .or. any(ubound(RotInputTypeData1%BladeRootMotion) /= ubound(RotInputTypeData2%BladeRootMotion))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap RotInputTypeData1%BladeRootMotion with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(RotInputTypeData1%BladeRootMotion)
+      UB(1:1) = ubound(RotInputTypeData1%BladeRootMotion)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(RotInputTypeData1%BladeRootMotion(i1), RotInputTypeData2%BladeRootMotion(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(RotInputTypeData1%BladeMotion) .neqv. allocated(RotInputTypeData2%BladeMotion)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap RotInputTypeData1%BladeMotion with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(RotInputTypeData1%BladeMotion)) then
+      if (any(lbound(RotInputTypeData1%BladeMotion) /= lbound(RotInputTypeData2%BladeMotion)) .or. any(ubound(RotInputTypeData1%BladeMotion) /= ubound(RotInputTypeData2%BladeMotion))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap RotInputTypeData1%BladeMotion with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(RotInputTypeData1%BladeMotion)
+      UB(1:1) = ubound(RotInputTypeData1%BladeMotion)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(RotInputTypeData1%BladeMotion(i1), RotInputTypeData2%BladeMotion(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call MeshSwap(RotInputTypeData1%TFinMotion, RotInputTypeData2%TFinMotion, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call move_alloc(RotInputTypeData1%UserProp, tmp_UserProp)
+   call move_alloc(RotInputTypeData2%UserProp, RotInputTypeData1%UserProp)
+   call move_alloc(tmp_UserProp, RotInputTypeData2%UserProp)
+end subroutine
+
 subroutine AD_DestroyRotInputType(RotInputTypeData, ErrStat, ErrMsg)
    type(RotInputType), intent(inout) :: RotInputTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4609,6 +4884,37 @@ subroutine AD_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine AD_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(AD_InputType), intent(inout) :: InputData1
+   type(AD_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'AD_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(InputData1%rotors) .neqv. allocated(InputData2%rotors)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%rotors)) then
+      if (any(lbound(InputData1%rotors) /= lbound(InputData2%rotors)) .or. any(ubound(InputData1%rotors) /= ubound(InputData2%rotors))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%rotors)
+      UB(1:1) = ubound(InputData1%rotors)
+      do i1 = LB(1), UB(1)
+         call AD_SwapRotInputType(InputData1%rotors(i1), InputData2%rotors(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+end subroutine
+
 subroutine AD_DestroyInput(InputData, ErrStat, ErrMsg)
    type(AD_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -5105,6 +5411,66 @@ subroutine AD_CopyRotMiscVarType(SrcRotMiscVarTypeData, DstRotMiscVarTypeData, C
       end if
       DstRotMiscVarTypeData%TwrClrnc = SrcRotMiscVarTypeData%TwrClrnc
    end if
+   if (allocated(SrcRotMiscVarTypeData%TwrNodePos)) then
+      LB(1:2) = lbound(SrcRotMiscVarTypeData%TwrNodePos)
+      UB(1:2) = ubound(SrcRotMiscVarTypeData%TwrNodePos)
+      if (.not. allocated(DstRotMiscVarTypeData%TwrNodePos)) then
+         allocate(DstRotMiscVarTypeData%TwrNodePos(LB(1):UB(1),LB(2):UB(2)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstRotMiscVarTypeData%TwrNodePos.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstRotMiscVarTypeData%TwrNodePos = SrcRotMiscVarTypeData%TwrNodePos
+   end if
+   if (allocated(SrcRotMiscVarTypeData%TwrElemOrder)) then
+      LB(1:1) = lbound(SrcRotMiscVarTypeData%TwrElemOrder)
+      UB(1:1) = ubound(SrcRotMiscVarTypeData%TwrElemOrder)
+      if (.not. allocated(DstRotMiscVarTypeData%TwrElemOrder)) then
+         allocate(DstRotMiscVarTypeData%TwrElemOrder(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstRotMiscVarTypeData%TwrElemOrder.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstRotMiscVarTypeData%TwrElemOrder = SrcRotMiscVarTypeData%TwrElemOrder
+   end if
+   if (allocated(SrcRotMiscVarTypeData%TwrElemZLo)) then
+      LB(1:1) = lbound(SrcRotMiscVarTypeData%TwrElemZLo)
+      UB(1:1) = ubound(SrcRotMiscVarTypeData%TwrElemZLo)
+      if (.not. allocated(DstRotMiscVarTypeData%TwrElemZLo)) then
+         allocate(DstRotMiscVarTypeData%TwrElemZLo(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstRotMiscVarTypeData%TwrElemZLo.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstRotMiscVarTypeData%TwrElemZLo = SrcRotMiscVarTypeData%TwrElemZLo
+   end if
+   if (allocated(SrcRotMiscVarTypeData%TwrElemZHi)) then
+      LB(1:1) = lbound(SrcRotMiscVarTypeData%TwrElemZHi)
+      UB(1:1) = ubound(SrcRotMiscVarTypeData%TwrElemZHi)
+      if (.not. allocated(DstRotMiscVarTypeData%TwrElemZHi)) then
+         allocate(DstRotMiscVarTypeData%TwrElemZHi(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstRotMiscVarTypeData%TwrElemZHi.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstRotMiscVarTypeData%TwrElemZHi = SrcRotMiscVarTypeData%TwrElemZHi
+   end if
+   if (allocated(SrcRotMiscVarTypeData%TwrNodeOrder)) then
+      LB(1:1) = lbound(SrcRotMiscVarTypeData%TwrNodeOrder)
+      UB(1:1) = ubound(SrcRotMiscVarTypeData%TwrNodeOrder)
+      if (.not. allocated(DstRotMiscVarTypeData%TwrNodeOrder)) then
+         allocate(DstRotMiscVarTypeData%TwrNodeOrder(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstRotMiscVarTypeData%TwrNodeOrder.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstRotMiscVarTypeData%TwrNodeOrder = SrcRotMiscVarTypeData%TwrNodeOrder
+   end if
    if (allocated(SrcRotMiscVarTypeData%X)) then
       LB(1:2) = lbound(SrcRotMiscVarTypeData%X)
       UB(1:2) = ubound(SrcRotMiscVarTypeData%X)
@@ -5633,6 +5999,21 @@ subroutine AD_DestroyRotMiscVarType(RotMiscVarTypeData, ErrStat, ErrMsg)
    if (allocated(RotMiscVarTypeData%TwrClrnc)) then
       deallocate(RotMiscVarTypeData%TwrClrnc)
    end if
+   if (allocated(RotMiscVarTypeData%TwrNodePos)) then
+      deallocate(RotMiscVarTypeData%TwrNodePos)
+   end if
+   if (allocated(RotMiscVarTypeData%TwrElemOrder)) then
+      deallocate(RotMiscVarTypeData%TwrElemOrder)
+   end if
+   if (allocated(RotMiscVarTypeData%TwrElemZLo)) then
+      deallocate(RotMiscVarTypeData%TwrElemZLo)
+   end if
+   if (allocated(RotMiscVarTypeData%TwrElemZHi)) then
+      deallocate(RotMiscVarTypeData%TwrElemZHi)
+   end if
+   if (allocated(RotMiscVarTypeData%TwrNodeOrder)) then
+      deallocate(RotMiscVarTypeData%TwrNodeOrder)
+   end if
    if (allocated(RotMiscVarTypeData%X)) then
       deallocate(RotMiscVarTypeData%X)
    end if
@@ -5815,6 +6196,11 @@ subroutine AD_PackRotMiscVarType(RF, Indata)
    call RegPackAlloc(RF, InData%Cant)
    call RegPackAlloc(RF, InData%Toe)
    call RegPackAlloc(RF, InData%TwrClrnc)
+   call RegPackAlloc(RF, InData%TwrNodePos)
+   call RegPackAlloc(RF, InData%TwrElemOrder)
+   call RegPackAlloc(RF, InData%TwrElemZLo)
+   call RegPackAlloc(RF, InData%TwrElemZHi)
+   call RegPackAlloc(RF, InData%TwrNodeOrder)
    call RegPackAlloc(RF, InData%X)
    call RegPackAlloc(RF, InData%Y)
    call RegPackAlloc(RF, InData%Z)
@@ -5958,6 +6344,11 @@ subroutine AD_UnPackRotMiscVarType(RF, OutData)
    call RegUnpackAlloc(RF, OutData%Cant); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%Toe); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%TwrClrnc); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%TwrNodePos); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%TwrElemOrder); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%TwrElemZLo); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%TwrElemZHi); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%TwrNodeOrder); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%X); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%Y); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%Z); if (RegCheckErr(RF, RoutineName)) return
@@ -950,6 +950,28 @@ subroutine AFI_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    DstInputData%Re = SrcInputData%Re
 end subroutine
 
+subroutine AFI_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(AFI_InputType), intent(inout) :: InputData1
+   type(AFI_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_AoA
+   REAL(ReKi) :: tmp_UserProp
+   REAL(ReKi) :: tmp_Re
+   character(*), parameter        :: RoutineName = 'AFI_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_AoA = InputData1%AoA
+   InputData1%AoA = InputData2%AoA
+   InputData2%AoA = tmp_AoA
+   tmp_UserProp = InputData1%UserProp
+   InputData1%UserProp = InputData2%UserProp
+   InputData2%UserProp = tmp_UserProp
+   tmp_Re = InputData1%Re
+   InputData1%Re = InputData2%Re
+   InputData2%Re = tmp_Re
+end subroutine
+
 subroutine AFI_DestroyInput(InputData, ErrStat, ErrMsg)
    type(AFI_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -622,6 +622,28 @@ subroutine BEMT_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrS
    DstContStateData%V_w = SrcContStateData%V_w
 end subroutine
 
+subroutine BEMT_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(BEMT_ContinuousStateType), intent(inout) :: ContStateData1
+   type(BEMT_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(R8Ki) :: tmp_V_w(1:3)
+   character(*), parameter        :: RoutineName = 'BEMT_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call UA_SwapContState(ContStateData1%UA, ContStateData2%UA, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call DBEMT_SwapContState(ContStateData1%DBEMT, ContStateData2%DBEMT, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   tmp_V_w = ContStateData1%V_w
+   ContStateData1%V_w = ContStateData2%V_w
+   ContStateData2%V_w = tmp_V_w
+end subroutine
+
 subroutine BEMT_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(BEMT_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -674,6 +696,21 @@ subroutine BEMT_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrS
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine BEMT_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(BEMT_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(BEMT_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'BEMT_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call UA_SwapDiscState(DiscStateData1%UA, DiscStateData2%UA, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine BEMT_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(BEMT_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -729,6 +766,20 @@ subroutine BEMT_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode
    end if
 end subroutine
 
+subroutine BEMT_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(BEMT_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(BEMT_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_phi(:,:)
+   character(*), parameter        :: RoutineName = 'BEMT_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ConstrStateData1%phi, tmp_phi)
+   call move_alloc(ConstrStateData2%phi, ConstrStateData1%phi)
+   call move_alloc(tmp_phi, ConstrStateData2%phi)
+end subroutine
+
 subroutine BEMT_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(BEMT_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -803,6 +854,45 @@ subroutine BEMT_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, E
    DstOtherStateData%n = SrcOtherStateData%n
 end subroutine
 
+subroutine BEMT_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(BEMT_OtherStateType), intent(inout) :: OtherStateData1
+   type(BEMT_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   LOGICAL, allocatable :: tmp_ValidPhi(:,:)
+   LOGICAL :: tmp_nodesInitialized
+   INTEGER(IntKi) :: tmp_n
+   character(*), parameter        :: RoutineName = 'BEMT_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call UA_SwapOtherState(OtherStateData1%UA, OtherStateData2%UA, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call DBEMT_SwapOtherState(OtherStateData1%DBEMT, OtherStateData2%DBEMT, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call move_alloc(OtherStateData1%ValidPhi, tmp_ValidPhi)
+   call move_alloc(OtherStateData2%ValidPhi, OtherStateData1%ValidPhi)
+   call move_alloc(tmp_ValidPhi, OtherStateData2%ValidPhi)
+   tmp_nodesInitialized = OtherStateData1%nodesInitialized
+   OtherStateData1%nodesInitialized = OtherStateData2%nodesInitialized
+   OtherStateData2%nodesInitialized = tmp_nodesInitialized
+   LB(1:1) = lbound(OtherStateData1%xdot)
+   UB(1:1) = ubound(OtherStateData1%xdot)
+   do i1 = LB(1), UB(1)
+      call BEMT_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      if (ErrStat >= AbortErrLev) return
+   end do
+   tmp_n = OtherStateData1%n
+   OtherStateData1%n = OtherStateData2%n
+   OtherStateData2%n = tmp_n
+end subroutine
+
 subroutine BEMT_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(BEMT_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1609,6 +1699,92 @@ subroutine BEMT_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine BEMT_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(BEMT_InputType), intent(inout) :: InputData1
+   type(BEMT_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_theta(:,:)
+   REAL(ReKi) :: tmp_chi0
+   REAL(ReKi) :: tmp_psiSkewOffset
+   REAL(ReKi), allocatable :: tmp_psi_s(:)
+   REAL(ReKi) :: tmp_omega
+   REAL(ReKi) :: tmp_TSR
+   REAL(ReKi), allocatable :: tmp_Vx(:,:)
+   REAL(ReKi), allocatable :: tmp_Vy(:,:)
+   REAL(ReKi), allocatable :: tmp_Vz(:,:)
+   REAL(ReKi), allocatable :: tmp_omega_z(:,:)
+   REAL(ReKi), allocatable :: tmp_xVelCorr(:,:)
+   REAL(ReKi), allocatable :: tmp_rLocal(:,:)
+   REAL(ReKi) :: tmp_Un_disk
+   REAL(ReKi) :: tmp_V0(1:3)
+   REAL(R8Ki) :: tmp_x_hat_disk(1:3)
+   REAL(ReKi), allocatable :: tmp_UserProp(:,:)
+   REAL(ReKi), allocatable :: tmp_CantAngle(:,:)
+   REAL(ReKi), allocatable :: tmp_drdz(:,:)
+   REAL(ReKi), allocatable :: tmp_toeAngle(:,:)
+   character(*), parameter        :: RoutineName = 'BEMT_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(InputData1%theta, tmp_theta)
+   call move_alloc(InputData2%theta, InputData1%theta)
+   call move_alloc(tmp_theta, InputData2%theta)
+   tmp_chi0 = InputData1%chi0
+   InputData1%chi0 = InputData2%chi0
+   InputData2%chi0 = tmp_chi0
+   tmp_psiSkewOffset = InputData1%psiSkewOffset
+   InputData1%psiSkewOffset = InputData2%psiSkewOffset
+   InputData2%psiSkewOffset = tmp_psiSkewOffset
+   call move_alloc(InputData1%psi_s, tmp_psi_s)
+   call move_alloc(InputData2%psi_s, InputData1%psi_s)
+   call move_alloc(tmp_psi_s, InputData2%psi_s)
+   tmp_omega = InputData1%omega
+   InputData1%omega = InputData2%omega
+   InputData2%omega = tmp_omega
+   tmp_TSR = InputData1%TSR
+   InputData1%TSR = InputData2%TSR
+   InputData2%TSR = tmp_TSR
+   call move_alloc(InputData1%Vx, tmp_Vx)
+   call move_alloc(InputData2%Vx, InputData1%Vx)
+   call move_alloc(tmp_Vx, InputData2%Vx)
+   call move_alloc(InputData1%Vy, tmp_Vy)
+   call move_alloc(InputData2%Vy, InputData1%Vy)
+   call move_alloc(tmp_Vy, InputData2%Vy)
+   call move_alloc(InputData1%Vz, tmp_Vz)
+   call move_alloc(InputData2%Vz, InputData1%Vz)
+   call move_alloc(tmp_Vz, InputData2%Vz)
+   call move_alloc(InputData1%omega_z, tmp_omega_z)
+   call move_alloc(InputData2%omega_z, InputData1%omega_z)
+   call move_alloc(tmp_omega_z, InputData2%omega_z)
+   call move_alloc(InputData1%xVelCorr, tmp_xVelCorr)
+   call move_alloc(InputData2%xVelCorr, InputData1%xVelCorr)
+   call move_alloc(tmp_xVelCorr, InputData2%xVelCorr)
+   call move_alloc(InputData1%rLocal, tmp_rLocal)
+   call move_alloc(InputData2%rLocal, InputData1%rLocal)
+   call move_alloc(tmp_rLocal, InputData2%rLocal)
+   tmp_Un_disk = InputData1%Un_disk
+   InputData1%Un_disk = InputData2%Un_disk
+   InputData2%Un_disk = tmp_Un_disk
+   tmp_V0 = InputData1%V0
+   InputData1%V0 = InputData2%V0
+   InputData2%V0 = tmp_V0
+   tmp_x_hat_disk = InputData1%x_hat_disk
+   InputData1%x_hat_disk = InputData2%x_hat_disk
+   InputData2%x_hat_disk = tmp_x_hat_disk
+   call move_alloc(InputData1%UserProp, tmp_UserProp)
+   call move_alloc(InputData2%UserProp, InputData1%UserProp)
+   call move_alloc(tmp_UserProp, InputData2%UserProp)
+   call move_alloc(InputData1%CantAngle, tmp_CantAngle)
+   call move_alloc(InputData2%CantAngle, InputData1%CantAngle)
+   call move_alloc(tmp_CantAngle, InputData2%CantAngle)
+   call move_alloc(InputData1%drdz, tmp_drdz)
+   call move_alloc(InputData2%drdz, InputData1%drdz)
+   call move_alloc(tmp_drdz, InputData2%drdz)
+   call move_alloc(InputData1%toeAngle, tmp_toeAngle)
+   call move_alloc(InputData2%toeAngle, InputData1%toeAngle)
+   call move_alloc(tmp_toeAngle, InputData2%toeAngle)
+end subroutine
+
 subroutine BEMT_DestroyInput(InputData, ErrStat, ErrMsg)
    type(BEMT_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -257,6 +257,24 @@ subroutine DBEMT_CopyElementContinuousStateType(SrcElementContinuousStateTypeDat
    DstElementContinuousStateTypeData%vind_1 = SrcElementContinuousStateTypeData%vind_1
 end subroutine
 
+subroutine DBEMT_SwapElementContinuousStateType(ElementContinuousStateTypeData1, ElementContinuousStateTypeData2, ErrStat, ErrMsg)
+   type(DBEMT_ElementContinuousStateType), intent(inout) :: ElementContinuousStateTypeData1
+   type(DBEMT_ElementContinuousStateType), intent(inout) :: ElementContinuousStateTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki) :: tmp_vind(1:2)
+   REAL(R8Ki) :: tmp_vind_1(1:2)
+   character(*), parameter        :: RoutineName = 'DBEMT_SwapElementContinuousStateType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_vind = ElementContinuousStateTypeData1%vind
+   ElementContinuousStateTypeData1%vind = ElementContinuousStateTypeData2%vind
+   ElementContinuousStateTypeData2%vind = tmp_vind
+   tmp_vind_1 = ElementContinuousStateTypeData1%vind_1
+   ElementContinuousStateTypeData1%vind_1 = ElementContinuousStateTypeData2%vind_1
+   ElementContinuousStateTypeData2%vind_1 = tmp_vind_1
+end subroutine
+
 subroutine DBEMT_DestroyElementContinuousStateType(ElementContinuousStateTypeData, ErrStat, ErrMsg)
    type(DBEMT_ElementContinuousStateType), intent(inout) :: ElementContinuousStateTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -318,6 +336,39 @@ subroutine DBEMT_CopyContState(SrcContStateData, DstContStateData, CtrlCode, Err
    end if
 end subroutine
 
+subroutine DBEMT_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(DBEMT_ContinuousStateType), intent(inout) :: ContStateData1
+   type(DBEMT_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'DBEMT_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(ContStateData1%element) .neqv. allocated(ContStateData2%element)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%element with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%element)) then
+      if (any(lbound(ContStateData1%element) /= lbound(ContStateData2%element)) .or. any(ubound(ContStateData1%element) /= ubound(ContStateData2%element))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%element with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:2) = lbound(ContStateData1%element)
+      UB(1:2) = ubound(ContStateData1%element)
+      do i2 = LB(2), UB(2)
+         do i1 = LB(1), UB(1)
+            call DBEMT_SwapElementContinuousStateType(ContStateData1%element(i1,i2), ContStateData2%element(i1,i2), ErrStat2, ErrMsg2)
+            call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+            if (ErrStat >= AbortErrLev) return
+         end do
+      end do
+   end if
+end subroutine
+
 subroutine DBEMT_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(DBEMT_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -401,6 +452,20 @@ subroutine DBEMT_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, Err
    DstDiscStateData%DummyState = SrcDiscStateData%DummyState
 end subroutine
 
+subroutine DBEMT_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(DBEMT_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(DBEMT_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyState
+   character(*), parameter        :: RoutineName = 'DBEMT_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyState = DiscStateData1%DummyState
+   DiscStateData1%DummyState = DiscStateData2%DummyState
+   DiscStateData2%DummyState = tmp_DummyState
+end subroutine
+
 subroutine DBEMT_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(DBEMT_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -439,6 +504,20 @@ subroutine DBEMT_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCod
    DstConstrStateData%DummyState = SrcConstrStateData%DummyState
 end subroutine
 
+subroutine DBEMT_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(DBEMT_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(DBEMT_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyState
+   character(*), parameter        :: RoutineName = 'DBEMT_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyState = ConstrStateData1%DummyState
+   ConstrStateData1%DummyState = ConstrStateData2%DummyState
+   ConstrStateData2%DummyState = tmp_DummyState
+end subroutine
+
 subroutine DBEMT_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(DBEMT_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -513,6 +592,43 @@ subroutine DBEMT_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode,
    end do
 end subroutine
 
+subroutine DBEMT_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(DBEMT_OtherStateType), intent(inout) :: OtherStateData1
+   type(DBEMT_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   LOGICAL, allocatable :: tmp_areStatesInitialized(:,:)
+   REAL(ReKi) :: tmp_tau1
+   REAL(ReKi) :: tmp_tau2
+   INTEGER(IntKi), allocatable :: tmp_n(:,:)
+   character(*), parameter        :: RoutineName = 'DBEMT_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(OtherStateData1%areStatesInitialized, tmp_areStatesInitialized)
+   call move_alloc(OtherStateData2%areStatesInitialized, OtherStateData1%areStatesInitialized)
+   call move_alloc(tmp_areStatesInitialized, OtherStateData2%areStatesInitialized)
+   tmp_tau1 = OtherStateData1%tau1
+   OtherStateData1%tau1 = OtherStateData2%tau1
+   OtherStateData2%tau1 = tmp_tau1
+   tmp_tau2 = OtherStateData1%tau2
+   OtherStateData1%tau2 = OtherStateData2%tau2
+   OtherStateData2%tau2 = tmp_tau2
+   call move_alloc(OtherStateData1%n, tmp_n)
+   call move_alloc(OtherStateData2%n, OtherStateData1%n)
+   call move_alloc(tmp_n, OtherStateData2%n)
+   LB(1:1) = lbound(OtherStateData1%xdot)
+   UB(1:1) = ubound(OtherStateData1%xdot)
+   do i1 = LB(1), UB(1)
+      call DBEMT_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      if (ErrStat >= AbortErrLev) return
+   end do
+end subroutine
+
 subroutine DBEMT_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(DBEMT_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -706,6 +822,24 @@ subroutine DBEMT_CopyElementInputType(SrcElementInputTypeData, DstElementInputTy
    DstElementInputTypeData%spanRatio = SrcElementInputTypeData%spanRatio
 end subroutine
 
+subroutine DBEMT_SwapElementInputType(ElementInputTypeData1, ElementInputTypeData2, ErrStat, ErrMsg)
+   type(DBEMT_ElementInputType), intent(inout) :: ElementInputTypeData1
+   type(DBEMT_ElementInputType), intent(inout) :: ElementInputTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_vind_s(1:2)
+   REAL(ReKi) :: tmp_spanRatio
+   character(*), parameter        :: RoutineName = 'DBEMT_SwapElementInputType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_vind_s = ElementInputTypeData1%vind_s
+   ElementInputTypeData1%vind_s = ElementInputTypeData2%vind_s
+   ElementInputTypeData2%vind_s = tmp_vind_s
+   tmp_spanRatio = ElementInputTypeData1%spanRatio
+   ElementInputTypeData1%spanRatio = ElementInputTypeData2%spanRatio
+   ElementInputTypeData2%spanRatio = tmp_spanRatio
+end subroutine
+
 subroutine DBEMT_DestroyElementInputType(ElementInputTypeData, ErrStat, ErrMsg)
    type(DBEMT_ElementInputType), intent(inout) :: ElementInputTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -770,6 +904,51 @@ subroutine DBEMT_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg
    end if
 end subroutine
 
+subroutine DBEMT_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(DBEMT_InputType), intent(inout) :: InputData1
+   type(DBEMT_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_AxInd_disk
+   REAL(ReKi) :: tmp_Un_disk
+   REAL(ReKi) :: tmp_R_disk
+   character(*), parameter        :: RoutineName = 'DBEMT_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_AxInd_disk = InputData1%AxInd_disk
+   InputData1%AxInd_disk = InputData2%AxInd_disk
+   InputData2%AxInd_disk = tmp_AxInd_disk
+   tmp_Un_disk = InputData1%Un_disk
+   InputData1%Un_disk = InputData2%Un_disk
+   InputData2%Un_disk = tmp_Un_disk
+   tmp_R_disk = InputData1%R_disk
+   InputData1%R_disk = InputData2%R_disk
+   InputData2%R_disk = tmp_R_disk
+   if (allocated(InputData1%element) .neqv. allocated(InputData2%element)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%element with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%element)) then
+      if (any(lbound(InputData1%element) /= lbound(InputData2%element)) .or. any(ubound(InputData1%element) /= ubound(InputData2%element))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%element with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:2) = lbound(InputData1%element)
+      UB(1:2) = ubound(InputData1%element)
+      do i2 = LB(2), UB(2)
+         do i1 = LB(1), UB(1)
+            call DBEMT_SwapElementInputType(InputData1%element(i1,i2), InputData2%element(i1,i2), ErrStat2, ErrMsg2)
+            call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+            if (ErrStat >= AbortErrLev) return
+         end do
+      end do
+   end if
+end subroutine
+
 subroutine DBEMT_DestroyInput(InputData, ErrStat, ErrMsg)
    type(DBEMT_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -990,6 +990,20 @@ subroutine FVW_CopyT_SrcPanlVar(SrcT_SrcPanlVarData, DstT_SrcPanlVarData, CtrlCo
    end if
 end subroutine
 
+subroutine FVW_SwapT_SrcPanlVar(T_SrcPanlVarData1, T_SrcPanlVarData2, ErrStat, ErrMsg)
+   type(T_SrcPanlVar), intent(inout) :: T_SrcPanlVarData1
+   type(T_SrcPanlVar), intent(inout) :: T_SrcPanlVarData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_Sigma(:)
+   character(*), parameter        :: RoutineName = 'FVW_SwapT_SrcPanlVar'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(T_SrcPanlVarData1%Sigma, tmp_Sigma)
+   call move_alloc(T_SrcPanlVarData2%Sigma, T_SrcPanlVarData1%Sigma)
+   call move_alloc(tmp_Sigma, T_SrcPanlVarData2%Sigma)
+end subroutine
+
 subroutine FVW_DestroyT_SrcPanlVar(T_SrcPanlVarData, ErrStat, ErrMsg)
    type(T_SrcPanlVar), intent(inout) :: T_SrcPanlVarData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1772,6 +1786,40 @@ subroutine FVW_CopyWng_ContinuousStateType(SrcWng_ContinuousStateTypeData, DstWn
    end if
 end subroutine
 
+subroutine FVW_SwapWng_ContinuousStateType(Wng_ContinuousStateTypeData1, Wng_ContinuousStateTypeData2, ErrStat, ErrMsg)
+   type(Wng_ContinuousStateType), intent(inout) :: Wng_ContinuousStateTypeData1
+   type(Wng_ContinuousStateType), intent(inout) :: Wng_ContinuousStateTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_Gamma_NW(:,:)
+   REAL(ReKi), allocatable :: tmp_Gamma_FW(:,:)
+   REAL(ReKi), allocatable :: tmp_Eps_NW(:,:,:)
+   REAL(ReKi), allocatable :: tmp_Eps_FW(:,:,:)
+   REAL(ReKi), allocatable :: tmp_r_NW(:,:,:)
+   REAL(ReKi), allocatable :: tmp_r_FW(:,:,:)
+   character(*), parameter        :: RoutineName = 'FVW_SwapWng_ContinuousStateType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(Wng_ContinuousStateTypeData1%Gamma_NW, tmp_Gamma_NW)
+   call move_alloc(Wng_ContinuousStateTypeData2%Gamma_NW, Wng_ContinuousStateTypeData1%Gamma_NW)
+   call move_alloc(tmp_Gamma_NW, Wng_ContinuousStateTypeData2%Gamma_NW)
+   call move_alloc(Wng_ContinuousStateTypeData1%Gamma_FW, tmp_Gamma_FW)
+   call move_alloc(Wng_ContinuousStateTypeData2%Gamma_FW, Wng_ContinuousStateTypeData1%Gamma_FW)
+   call move_alloc(tmp_Gamma_FW, Wng_ContinuousStateTypeData2%Gamma_FW)
+   call move_alloc(Wng_ContinuousStateTypeData1%Eps_NW, tmp_Eps_NW)
+   call move_alloc(Wng_ContinuousStateTypeData2%Eps_NW, Wng_ContinuousStateTypeData1%Eps_NW)
+   call move_alloc(tmp_Eps_NW, Wng_ContinuousStateTypeData2%Eps_NW)
+   call move_alloc(Wng_ContinuousStateTypeData1%Eps_FW, tmp_Eps_FW)
+   call move_alloc(Wng_ContinuousStateTypeData2%Eps_FW, Wng_ContinuousStateTypeData1%Eps_FW)
+   call move_alloc(tmp_Eps_FW, Wng_ContinuousStateTypeData2%Eps_FW)
+   call move_alloc(Wng_ContinuousStateTypeData1%r_NW, tmp_r_NW)
+   call move_alloc(Wng_ContinuousStateTypeData2%r_NW, Wng_ContinuousStateTypeData1%r_NW)
+   call move_alloc(tmp_r_NW, Wng_ContinuousStateTypeData2%r_NW)
+   call move_alloc(Wng_ContinuousStateTypeData1%r_FW, tmp_r_FW)
+   call move_alloc(Wng_ContinuousStateTypeData2%r_FW, Wng_ContinuousStateTypeData1%r_FW)
+   call move_alloc(tmp_r_FW, Wng_ContinuousStateTypeData2%r_FW)
+end subroutine
+
 subroutine FVW_DestroyWng_ContinuousStateType(Wng_ContinuousStateTypeData, ErrStat, ErrMsg)
    type(Wng_ContinuousStateType), intent(inout) :: Wng_ContinuousStateTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1876,6 +1924,54 @@ subroutine FVW_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSt
    end if
 end subroutine
 
+subroutine FVW_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(FVW_ContinuousStateType), intent(inout) :: ContStateData1
+   type(FVW_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'FVW_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(ContStateData1%W) .neqv. allocated(ContStateData2%W)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%W with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%W)) then
+      if (any(lbound(ContStateData1%W) /= lbound(ContStateData2%W)) .or. any(ubound(ContStateData1%W) /= ubound(ContStateData2%W))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%W with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ContStateData1%W)
+      UB(1:1) = ubound(ContStateData1%W)
+      do i1 = LB(1), UB(1)
+         call FVW_SwapWng_ContinuousStateType(ContStateData1%W(i1), ContStateData2%W(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(ContStateData1%UA) .neqv. allocated(ContStateData2%UA)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%UA with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%UA)) then
+      if (any(lbound(ContStateData1%UA) /= lbound(ContStateData2%UA)) .or. any(ubound(ContStateData1%UA) /= ubound(ContStateData2%UA))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%UA with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ContStateData1%UA)
+      UB(1:1) = ubound(ContStateData1%UA)
+      do i1 = LB(1), UB(1)
+         call UA_SwapContState(ContStateData1%UA(i1), ContStateData2%UA(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+end subroutine
+
 subroutine FVW_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(FVW_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3187,6 +3283,24 @@ subroutine FVW_CopyRot_InputType(SrcRot_InputTypeData, DstRot_InputTypeData, Ctr
    DstRot_InputTypeData%HubPosition = SrcRot_InputTypeData%HubPosition
 end subroutine
 
+subroutine FVW_SwapRot_InputType(Rot_InputTypeData1, Rot_InputTypeData2, ErrStat, ErrMsg)
+   type(Rot_InputType), intent(inout) :: Rot_InputTypeData1
+   type(Rot_InputType), intent(inout) :: Rot_InputTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_HubOrientation(1:3,1:3)
+   REAL(ReKi) :: tmp_HubPosition(1:3)
+   character(*), parameter        :: RoutineName = 'FVW_SwapRot_InputType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_HubOrientation = Rot_InputTypeData1%HubOrientation
+   Rot_InputTypeData1%HubOrientation = Rot_InputTypeData2%HubOrientation
+   Rot_InputTypeData2%HubOrientation = tmp_HubOrientation
+   tmp_HubPosition = Rot_InputTypeData1%HubPosition
+   Rot_InputTypeData1%HubPosition = Rot_InputTypeData2%HubPosition
+   Rot_InputTypeData2%HubPosition = tmp_HubPosition
+end subroutine
+
 subroutine FVW_DestroyRot_InputType(Rot_InputTypeData, ErrStat, ErrMsg)
    type(Rot_InputType), intent(inout) :: Rot_InputTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3252,6 +3366,24 @@ subroutine FVW_CopyWng_InputType(SrcWng_InputTypeData, DstWng_InputTypeData, Ctr
    end if
 end subroutine
 
+subroutine FVW_SwapWng_InputType(Wng_InputTypeData1, Wng_InputTypeData2, ErrStat, ErrMsg)
+   type(Wng_InputType), intent(inout) :: Wng_InputTypeData1
+   type(Wng_InputType), intent(inout) :: Wng_InputTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_Vwnd_LL(:,:)
+   REAL(ReKi), allocatable :: tmp_omega_z(:)
+   character(*), parameter        :: RoutineName = 'FVW_SwapWng_InputType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(Wng_InputTypeData1%Vwnd_LL, tmp_Vwnd_LL)
+   call move_alloc(Wng_InputTypeData2%Vwnd_LL, Wng_InputTypeData1%Vwnd_LL)
+   call move_alloc(tmp_Vwnd_LL, Wng_InputTypeData2%Vwnd_LL)
+   call move_alloc(Wng_InputTypeData1%omega_z, tmp_omega_z)
+   call move_alloc(Wng_InputTypeData2%omega_z, Wng_InputTypeData1%omega_z)
+   call move_alloc(tmp_omega_z, Wng_InputTypeData2%omega_z)
+end subroutine
+
 subroutine FVW_DestroyWng_InputType(Wng_InputTypeData, ErrStat, ErrMsg)
    type(Wng_InputType), intent(inout) :: Wng_InputTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3364,6 +3496,75 @@ subroutine FVW_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine FVW_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(FVW_InputType), intent(inout) :: InputData1
+   type(FVW_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_V_wind(:,:)
+   character(*), parameter        :: RoutineName = 'FVW_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(InputData1%rotors) .neqv. allocated(InputData2%rotors)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%rotors)) then
+      if (any(lbound(InputData1%rotors) /= lbound(InputData2%rotors)) .or. any(ubound(InputData1%rotors) /= ubound(InputData2%rotors))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%rotors with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%rotors)
+      UB(1:1) = ubound(InputData1%rotors)
+      do i1 = LB(1), UB(1)
+         call FVW_SwapRot_InputType(InputData1%rotors(i1), InputData2%rotors(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(InputData1%W) .neqv. allocated(InputData2%W)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%W with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%W)) then
+      if (any(lbound(InputData1%W) /= lbound(InputData2%W)) .or. any(ubound(InputData1%W) /= ubound(InputData2%W))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%W with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%W)
+      UB(1:1) = ubound(InputData1%W)
+      do i1 = LB(1), UB(1)
+         call FVW_SwapWng_InputType(InputData1%W(i1), InputData2%W(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(InputData1%WingsMesh) .neqv. allocated(InputData2%WingsMesh)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%WingsMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%WingsMesh)) then
+      if (any(lbound(InputData1%WingsMesh) /= lbound(InputData2%WingsMesh)) .or. any(ubound(InputData1%WingsMesh) /= ubound(InputData2%WingsMesh))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%WingsMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%WingsMesh)
+      UB(1:1) = ubound(InputData1%WingsMesh)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%WingsMesh(i1), InputData2%WingsMesh(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call move_alloc(InputData1%V_wind, tmp_V_wind)
+   call move_alloc(InputData2%V_wind, InputData1%V_wind)
+   call move_alloc(tmp_V_wind, InputData2%V_wind)
+end subroutine
+
 subroutine FVW_DestroyInput(InputData, ErrStat, ErrMsg)
    type(FVW_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3528,6 +3729,41 @@ subroutine FVW_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSt
    end if
 end subroutine
 
+subroutine FVW_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(FVW_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(FVW_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_Dummy
+   character(*), parameter        :: RoutineName = 'FVW_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Dummy = DiscStateData1%Dummy
+   DiscStateData1%Dummy = DiscStateData2%Dummy
+   DiscStateData2%Dummy = tmp_Dummy
+   if (allocated(DiscStateData1%UA) .neqv. allocated(DiscStateData2%UA)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%UA with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(DiscStateData1%UA)) then
+      if (any(lbound(DiscStateData1%UA) /= lbound(DiscStateData2%UA)) .or. any(ubound(DiscStateData1%UA) /= ubound(DiscStateData2%UA))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%UA with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(DiscStateData1%UA)
+      UB(1:1) = ubound(DiscStateData1%UA)
+      do i1 = LB(1), UB(1)
+         call UA_SwapDiscState(DiscStateData1%UA(i1), DiscStateData2%UA(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+end subroutine
+
 subroutine FVW_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(FVW_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3620,6 +3856,20 @@ subroutine FVW_CopyWng_ConstraintStateType(SrcWng_ConstraintStateTypeData, DstWn
    end if
 end subroutine
 
+subroutine FVW_SwapWng_ConstraintStateType(Wng_ConstraintStateTypeData1, Wng_ConstraintStateTypeData2, ErrStat, ErrMsg)
+   type(Wng_ConstraintStateType), intent(inout) :: Wng_ConstraintStateTypeData1
+   type(Wng_ConstraintStateType), intent(inout) :: Wng_ConstraintStateTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_Gamma_LL(:)
+   character(*), parameter        :: RoutineName = 'FVW_SwapWng_ConstraintStateType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(Wng_ConstraintStateTypeData1%Gamma_LL, tmp_Gamma_LL)
+   call move_alloc(Wng_ConstraintStateTypeData2%Gamma_LL, Wng_ConstraintStateTypeData1%Gamma_LL)
+   call move_alloc(tmp_Gamma_LL, Wng_ConstraintStateTypeData2%Gamma_LL)
+end subroutine
+
 subroutine FVW_DestroyWng_ConstraintStateType(Wng_ConstraintStateTypeData, ErrStat, ErrMsg)
    type(Wng_ConstraintStateType), intent(inout) :: Wng_ConstraintStateTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3687,6 +3937,44 @@ subroutine FVW_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine FVW_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(FVW_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(FVW_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_residual
+   character(*), parameter        :: RoutineName = 'FVW_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(ConstrStateData1%W) .neqv. allocated(ConstrStateData2%W)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%W with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ConstrStateData1%W)) then
+      if (any(lbound(ConstrStateData1%W) /= lbound(ConstrStateData2%W)) .or. any(ubound(ConstrStateData1%W) /= ubound(ConstrStateData2%W))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%W with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ConstrStateData1%W)
+      UB(1:1) = ubound(ConstrStateData1%W)
+      do i1 = LB(1), UB(1)
+         call FVW_SwapWng_ConstraintStateType(ConstrStateData1%W(i1), ConstrStateData2%W(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   tmp_residual = ConstrStateData1%residual
+   ConstrStateData1%residual = ConstrStateData2%residual
+   ConstrStateData2%residual = tmp_residual
+   call FVW_SwapT_SrcPanlVar(ConstrStateData1%SrcPnl, ConstrStateData2%SrcPnl, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine FVW_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(FVW_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3791,6 +4079,45 @@ subroutine FVW_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Er
    DstOtherStateData%Initialized = SrcOtherStateData%Initialized
 end subroutine
 
+subroutine FVW_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(FVW_OtherStateType), intent(inout) :: OtherStateData1
+   type(FVW_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_ShedScale
+   LOGICAL :: tmp_Initialized
+   character(*), parameter        :: RoutineName = 'FVW_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_ShedScale = OtherStateData1%ShedScale
+   OtherStateData1%ShedScale = OtherStateData2%ShedScale
+   OtherStateData2%ShedScale = tmp_ShedScale
+   if (allocated(OtherStateData1%UA) .neqv. allocated(OtherStateData2%UA)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%UA with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%UA)) then
+      if (any(lbound(OtherStateData1%UA) /= lbound(OtherStateData2%UA)) .or. any(ubound(OtherStateData1%UA) /= ubound(OtherStateData2%UA))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%UA with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%UA)
+      UB(1:1) = ubound(OtherStateData1%UA)
+      do i1 = LB(1), UB(1)
+         call UA_SwapOtherState(OtherStateData1%UA(i1), OtherStateData2%UA(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   tmp_Initialized = OtherStateData1%Initialized
+   OtherStateData1%Initialized = OtherStateData2%Initialized
+   OtherStateData2%Initialized = tmp_Initialized
+end subroutine
+
 subroutine FVW_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(FVW_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
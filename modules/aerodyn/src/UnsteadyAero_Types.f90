@@ -676,6 +676,20 @@ subroutine UA_CopyElementContinuousStateType(SrcElementContinuousStateTypeData,
    DstElementContinuousStateTypeData%x = SrcElementContinuousStateTypeData%x
 end subroutine
 
+subroutine UA_SwapElementContinuousStateType(ElementContinuousStateTypeData1, ElementContinuousStateTypeData2, ErrStat, ErrMsg)
+   type(UA_ElementContinuousStateType), intent(inout) :: ElementContinuousStateTypeData1
+   type(UA_ElementContinuousStateType), intent(inout) :: ElementContinuousStateTypeData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki) :: tmp_x(1:7)
+   character(*), parameter        :: RoutineName = 'UA_SwapElementContinuousStateType'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_x = ElementContinuousStateTypeData1%x
+   ElementContinuousStateTypeData1%x = ElementContinuousStateTypeData2%x
+   ElementContinuousStateTypeData2%x = tmp_x
+end subroutine
+
 subroutine UA_DestroyElementContinuousStateType(ElementContinuousStateTypeData, ErrStat, ErrMsg)
    type(UA_ElementContinuousStateType), intent(inout) :: ElementContinuousStateTypeData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -735,6 +749,39 @@ subroutine UA_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSta
    end if
 end subroutine
 
+subroutine UA_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(UA_ContinuousStateType), intent(inout) :: ContStateData1
+   type(UA_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'UA_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(ContStateData1%element) .neqv. allocated(ContStateData2%element)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%element with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%element)) then
+      if (any(lbound(ContStateData1%element) /= lbound(ContStateData2%element)) .or. any(ubound(ContStateData1%element) /= ubound(ContStateData2%element))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%element with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:2) = lbound(ContStateData1%element)
+      UB(1:2) = ubound(ContStateData1%element)
+      do i2 = LB(2), UB(2)
+         do i1 = LB(1), UB(1)
+            call UA_SwapElementContinuousStateType(ContStateData1%element(i1,i2), ContStateData2%element(i1,i2), ErrStat2, ErrMsg2)
+            call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+            if (ErrStat >= AbortErrLev) return
+         end do
+      end do
+   end if
+end subroutine
+
 subroutine UA_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(UA_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1227,6 +1274,152 @@ subroutine UA_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSta
    end if
 end subroutine
 
+subroutine UA_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(UA_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(UA_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_alpha_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_alpha_filt_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_alpha_dot(:,:)
+   REAL(ReKi), allocatable :: tmp_alpha_dot_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_q_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Kalpha_f_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Kq_f_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_q_f_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_X1_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_X2_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_X3_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_X4_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Kprime_alpha_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Kprime_q_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Kprimeprime_q_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_K3prime_q_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Dp_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Cn_pot_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_fprimeprime_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_fprimeprime_c_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_fprimeprime_m_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Df_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Df_c_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Df_m_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Dalphaf_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_alphaf_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_fprime_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_fprime_c_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_fprime_m_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_tau_V(:,:)
+   REAL(ReKi), allocatable :: tmp_tau_V_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Cn_v_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_C_V_minus1(:,:)
+   REAL(ReKi), allocatable :: tmp_Cn_prime_minus1(:,:)
+   character(*), parameter        :: RoutineName = 'UA_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(DiscStateData1%alpha_minus1, tmp_alpha_minus1)
+   call move_alloc(DiscStateData2%alpha_minus1, DiscStateData1%alpha_minus1)
+   call move_alloc(tmp_alpha_minus1, DiscStateData2%alpha_minus1)
+   call move_alloc(DiscStateData1%alpha_filt_minus1, tmp_alpha_filt_minus1)
+   call move_alloc(DiscStateData2%alpha_filt_minus1, DiscStateData1%alpha_filt_minus1)
+   call move_alloc(tmp_alpha_filt_minus1, DiscStateData2%alpha_filt_minus1)
+   call move_alloc(DiscStateData1%alpha_dot, tmp_alpha_dot)
+   call move_alloc(DiscStateData2%alpha_dot, DiscStateData1%alpha_dot)
+   call move_alloc(tmp_alpha_dot, DiscStateData2%alpha_dot)
+   call move_alloc(DiscStateData1%alpha_dot_minus1, tmp_alpha_dot_minus1)
+   call move_alloc(DiscStateData2%alpha_dot_minus1, DiscStateData1%alpha_dot_minus1)
+   call move_alloc(tmp_alpha_dot_minus1, DiscStateData2%alpha_dot_minus1)
+   call move_alloc(DiscStateData1%q_minus1, tmp_q_minus1)
+   call move_alloc(DiscStateData2%q_minus1, DiscStateData1%q_minus1)
+   call move_alloc(tmp_q_minus1, DiscStateData2%q_minus1)
+   call move_alloc(DiscStateData1%Kalpha_f_minus1, tmp_Kalpha_f_minus1)
+   call move_alloc(DiscStateData2%Kalpha_f_minus1, DiscStateData1%Kalpha_f_minus1)
+   call move_alloc(tmp_Kalpha_f_minus1, DiscStateData2%Kalpha_f_minus1)
+   call move_alloc(DiscStateData1%Kq_f_minus1, tmp_Kq_f_minus1)
+   call move_alloc(DiscStateData2%Kq_f_minus1, DiscStateData1%Kq_f_minus1)
+   call move_alloc(tmp_Kq_f_minus1, DiscStateData2%Kq_f_minus1)
+   call move_alloc(DiscStateData1%q_f_minus1, tmp_q_f_minus1)
+   call move_alloc(DiscStateData2%q_f_minus1, DiscStateData1%q_f_minus1)
+   call move_alloc(tmp_q_f_minus1, DiscStateData2%q_f_minus1)
+   call move_alloc(DiscStateData1%X1_minus1, tmp_X1_minus1)
+   call move_alloc(DiscStateData2%X1_minus1, DiscStateData1%X1_minus1)
+   call move_alloc(tmp_X1_minus1, DiscStateData2%X1_minus1)
+   call move_alloc(DiscStateData1%X2_minus1, tmp_X2_minus1)
+   call move_alloc(DiscStateData2%X2_minus1, DiscStateData1%X2_minus1)
+   call move_alloc(tmp_X2_minus1, DiscStateData2%X2_minus1)
+   call move_alloc(DiscStateData1%X3_minus1, tmp_X3_minus1)
+   call move_alloc(DiscStateData2%X3_minus1, DiscStateData1%X3_minus1)
+   call move_alloc(tmp_X3_minus1, DiscStateData2%X3_minus1)
+   call move_alloc(DiscStateData1%X4_minus1, tmp_X4_minus1)
+   call move_alloc(DiscStateData2%X4_minus1, DiscStateData1%X4_minus1)
+   call move_alloc(tmp_X4_minus1, DiscStateData2%X4_minus1)
+   call move_alloc(DiscStateData1%Kprime_alpha_minus1, tmp_Kprime_alpha_minus1)
+   call move_alloc(DiscStateData2%Kprime_alpha_minus1, DiscStateData1%Kprime_alpha_minus1)
+   call move_alloc(tmp_Kprime_alpha_minus1, DiscStateData2%Kprime_alpha_minus1)
+   call move_alloc(DiscStateData1%Kprime_q_minus1, tmp_Kprime_q_minus1)
+   call move_alloc(DiscStateData2%Kprime_q_minus1, DiscStateData1%Kprime_q_minus1)
+   call move_alloc(tmp_Kprime_q_minus1, DiscStateData2%Kprime_q_minus1)
+   call move_alloc(DiscStateData1%Kprimeprime_q_minus1, tmp_Kprimeprime_q_minus1)
+   call move_alloc(DiscStateData2%Kprimeprime_q_minus1, DiscStateData1%Kprimeprime_q_minus1)
+   call move_alloc(tmp_Kprimeprime_q_minus1, DiscStateData2%Kprimeprime_q_minus1)
+   call move_alloc(DiscStateData1%K3prime_q_minus1, tmp_K3prime_q_minus1)
+   call move_alloc(DiscStateData2%K3prime_q_minus1, DiscStateData1%K3prime_q_minus1)
+   call move_alloc(tmp_K3prime_q_minus1, DiscStateData2%K3prime_q_minus1)
+   call move_alloc(DiscStateData1%Dp_minus1, tmp_Dp_minus1)
+   call move_alloc(DiscStateData2%Dp_minus1, DiscStateData1%Dp_minus1)
+   call move_alloc(tmp_Dp_minus1, DiscStateData2%Dp_minus1)
+   call move_alloc(DiscStateData1%Cn_pot_minus1, tmp_Cn_pot_minus1)
+   call move_alloc(DiscStateData2%Cn_pot_minus1, DiscStateData1%Cn_pot_minus1)
+   call move_alloc(tmp_Cn_pot_minus1, DiscStateData2%Cn_pot_minus1)
+   call move_alloc(DiscStateData1%fprimeprime_minus1, tmp_fprimeprime_minus1)
+   call move_alloc(DiscStateData2%fprimeprime_minus1, DiscStateData1%fprimeprime_minus1)
+   call move_alloc(tmp_fprimeprime_minus1, DiscStateData2%fprimeprime_minus1)
+   call move_alloc(DiscStateData1%fprimeprime_c_minus1, tmp_fprimeprime_c_minus1)
+   call move_alloc(DiscStateData2%fprimeprime_c_minus1, DiscStateData1%fprimeprime_c_minus1)
+   call move_alloc(tmp_fprimeprime_c_minus1, DiscStateData2%fprimeprime_c_minus1)
+   call move_alloc(DiscStateData1%fprimeprime_m_minus1, tmp_fprimeprime_m_minus1)
+   call move_alloc(DiscStateData2%fprimeprime_m_minus1, DiscStateData1%fprimeprime_m_minus1)
+   call move_alloc(tmp_fprimeprime_m_minus1, DiscStateData2%fprimeprime_m_minus1)
+   call move_alloc(DiscStateData1%Df_minus1, tmp_Df_minus1)
+   call move_alloc(DiscStateData2%Df_minus1, DiscStateData1%Df_minus1)
+   call move_alloc(tmp_Df_minus1, DiscStateData2%Df_minus1)
+   call move_alloc(DiscStateData1%Df_c_minus1, tmp_Df_c_minus1)
+   call move_alloc(DiscStateData2%Df_c_minus1, DiscStateData1%Df_c_minus1)
+   call move_alloc(tmp_Df_c_minus1, DiscStateData2%Df_c_minus1)
+   call move_alloc(DiscStateData1%Df_m_minus1, tmp_Df_m_minus1)
+   call move_alloc(DiscStateData2%Df_m_minus1, DiscStateData1%Df_m_minus1)
+   call move_alloc(tmp_Df_m_minus1, DiscStateData2%Df_m_minus1)
+   call move_alloc(DiscStateData1%Dalphaf_minus1, tmp_Dalphaf_minus1)
+   call move_alloc(DiscStateData2%Dalphaf_minus1, DiscStateData1%Dalphaf_minus1)
+   call move_alloc(tmp_Dalphaf_minus1, DiscStateData2%Dalphaf_minus1)
+   call move_alloc(DiscStateData1%alphaf_minus1, tmp_alphaf_minus1)
+   call move_alloc(DiscStateData2%alphaf_minus1, DiscStateData1%alphaf_minus1)
+   call move_alloc(tmp_alphaf_minus1, DiscStateData2%alphaf_minus1)
+   call move_alloc(DiscStateData1%fprime_minus1, tmp_fprime_minus1)
+   call move_alloc(DiscStateData2%fprime_minus1, DiscStateData1%fprime_minus1)
+   call move_alloc(tmp_fprime_minus1, DiscStateData2%fprime_minus1)
+   call move_alloc(DiscStateData1%fprime_c_minus1, tmp_fprime_c_minus1)
+   call move_alloc(DiscStateData2%fprime_c_minus1, DiscStateData1%fprime_c_minus1)
+   call move_alloc(tmp_fprime_c_minus1, DiscStateData2%fprime_c_minus1)
+   call move_alloc(DiscStateData1%fprime_m_minus1, tmp_fprime_m_minus1)
+   call move_alloc(DiscStateData2%fprime_m_minus1, DiscStateData1%fprime_m_minus1)
+   call move_alloc(tmp_fprime_m_minus1, DiscStateData2%fprime_m_minus1)
+   call move_alloc(DiscStateData1%tau_V, tmp_tau_V)
+   call move_alloc(DiscStateData2%tau_V, DiscStateData1%tau_V)
+   call move_alloc(tmp_tau_V, DiscStateData2%tau_V)
+   call move_alloc(DiscStateData1%tau_V_minus1, tmp_tau_V_minus1)
+   call move_alloc(DiscStateData2%tau_V_minus1, DiscStateData1%tau_V_minus1)
+   call move_alloc(tmp_tau_V_minus1, DiscStateData2%tau_V_minus1)
+   call move_alloc(DiscStateData1%Cn_v_minus1, tmp_Cn_v_minus1)
+   call move_alloc(DiscStateData2%Cn_v_minus1, DiscStateData1%Cn_v_minus1)
+   call move_alloc(tmp_Cn_v_minus1, DiscStateData2%Cn_v_minus1)
+   call move_alloc(DiscStateData1%C_V_minus1, tmp_C_V_minus1)
+   call move_alloc(DiscStateData2%C_V_minus1, DiscStateData1%C_V_minus1)
+   call move_alloc(tmp_C_V_minus1, DiscStateData2%C_V_minus1)
+   call move_alloc(DiscStateData1%Cn_prime_minus1, tmp_Cn_prime_minus1)
+   call move_alloc(DiscStateData2%Cn_prime_minus1, DiscStateData1%Cn_prime_minus1)
+   call move_alloc(tmp_Cn_prime_minus1, DiscStateData2%Cn_prime_minus1)
+end subroutine
+
 subroutine UA_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(UA_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1436,6 +1629,20 @@ subroutine UA_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%DummyConstraintState = SrcConstrStateData%DummyConstraintState
 end subroutine
 
+subroutine UA_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(UA_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(UA_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstraintState
+   character(*), parameter        :: RoutineName = 'UA_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstraintState = ConstrStateData1%DummyConstraintState
+   ConstrStateData1%DummyConstraintState = ConstrStateData2%DummyConstraintState
+   ConstrStateData2%DummyConstraintState = tmp_DummyConstraintState
+end subroutine
+
 subroutine UA_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(UA_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1647,6 +1854,86 @@ subroutine UA_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Err
    end if
 end subroutine
 
+subroutine UA_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(UA_OtherStateType), intent(inout) :: OtherStateData1
+   type(UA_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   LOGICAL, allocatable :: tmp_FirstPass(:,:)
+   REAL(ReKi), allocatable :: tmp_sigma1(:,:)
+   REAL(ReKi), allocatable :: tmp_sigma1c(:,:)
+   REAL(ReKi), allocatable :: tmp_sigma1m(:,:)
+   REAL(ReKi), allocatable :: tmp_sigma3(:,:)
+   INTEGER(IntKi), allocatable :: tmp_n(:,:)
+   REAL(ReKi), allocatable :: tmp_t_vortexBegin(:,:)
+   REAL(ReKi), allocatable :: tmp_SignOfOmega(:,:)
+   LOGICAL, allocatable :: tmp_PositivePressure(:,:)
+   LOGICAL, allocatable :: tmp_vortexOn(:,:)
+   LOGICAL, allocatable :: tmp_BelowThreshold(:,:)
+   LOGICAL, allocatable :: tmp_activeL(:,:)
+   LOGICAL, allocatable :: tmp_activeD(:,:)
+   character(*), parameter        :: RoutineName = 'UA_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(OtherStateData1%FirstPass, tmp_FirstPass)
+   call move_alloc(OtherStateData2%FirstPass, OtherStateData1%FirstPass)
+   call move_alloc(tmp_FirstPass, OtherStateData2%FirstPass)
+   call move_alloc(OtherStateData1%sigma1, tmp_sigma1)
+   call move_alloc(OtherStateData2%sigma1, OtherStateData1%sigma1)
+   call move_alloc(tmp_sigma1, OtherStateData2%sigma1)
+   call move_alloc(OtherStateData1%sigma1c, tmp_sigma1c)
+   call move_alloc(OtherStateData2%sigma1c, OtherStateData1%sigma1c)
+   call move_alloc(tmp_sigma1c, OtherStateData2%sigma1c)
+   call move_alloc(OtherStateData1%sigma1m, tmp_sigma1m)
+   call move_alloc(OtherStateData2%sigma1m, OtherStateData1%sigma1m)
+   call move_alloc(tmp_sigma1m, OtherStateData2%sigma1m)
+   call move_alloc(OtherStateData1%sigma3, tmp_sigma3)
+   call move_alloc(OtherStateData2%sigma3, OtherStateData1%sigma3)
+   call move_alloc(tmp_sigma3, OtherStateData2%sigma3)
+   call move_alloc(OtherStateData1%n, tmp_n)
+   call move_alloc(OtherStateData2%n, OtherStateData1%n)
+   call move_alloc(tmp_n, OtherStateData2%n)
+   LB(1:1) = lbound(OtherStateData1%xdot)
+   UB(1:1) = ubound(OtherStateData1%xdot)
+   do i1 = LB(1), UB(1)
+      call UA_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      if (ErrStat >= AbortErrLev) return
+   end do
+   LB(1:1) = lbound(OtherStateData1%xHistory)
+   UB(1:1) = ubound(OtherStateData1%xHistory)
+   do i1 = LB(1), UB(1)
+      call UA_SwapContState(OtherStateData1%xHistory(i1), OtherStateData2%xHistory(i1), ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      if (ErrStat >= AbortErrLev) return
+   end do
+   call move_alloc(OtherStateData1%t_vortexBegin, tmp_t_vortexBegin)
+   call move_alloc(OtherStateData2%t_vortexBegin, OtherStateData1%t_vortexBegin)
+   call move_alloc(tmp_t_vortexBegin, OtherStateData2%t_vortexBegin)
+   call move_alloc(OtherStateData1%SignOfOmega, tmp_SignOfOmega)
+   call move_alloc(OtherStateData2%SignOfOmega, OtherStateData1%SignOfOmega)
+   call move_alloc(tmp_SignOfOmega, OtherStateData2%SignOfOmega)
+   call move_alloc(OtherStateData1%PositivePressure, tmp_PositivePressure)
+   call move_alloc(OtherStateData2%PositivePressure, OtherStateData1%PositivePressure)
+   call move_alloc(tmp_PositivePressure, OtherStateData2%PositivePressure)
+   call move_alloc(OtherStateData1%vortexOn, tmp_vortexOn)
+   call move_alloc(OtherStateData2%vortexOn, OtherStateData1%vortexOn)
+   call move_alloc(tmp_vortexOn, OtherStateData2%vortexOn)
+   call move_alloc(OtherStateData1%BelowThreshold, tmp_BelowThreshold)
+   call move_alloc(OtherStateData2%BelowThreshold, OtherStateData1%BelowThreshold)
+   call move_alloc(tmp_BelowThreshold, OtherStateData2%BelowThreshold)
+   call move_alloc(OtherStateData1%activeL, tmp_activeL)
+   call move_alloc(OtherStateData2%activeL, OtherStateData1%activeL)
+   call move_alloc(tmp_activeL, OtherStateData2%activeL)
+   call move_alloc(OtherStateData1%activeD, tmp_activeD)
+   call move_alloc(OtherStateData2%activeD, OtherStateData1%activeD)
+   call move_alloc(tmp_activeD, OtherStateData2%activeD)
+end subroutine
+
 subroutine UA_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(UA_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2091,6 +2378,40 @@ subroutine UA_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    DstInputData%omega = SrcInputData%omega
 end subroutine
 
+subroutine UA_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(UA_InputType), intent(inout) :: InputData1
+   type(UA_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_U
+   REAL(ReKi) :: tmp_alpha
+   REAL(ReKi) :: tmp_Re
+   REAL(ReKi) :: tmp_UserProp
+   REAL(ReKi) :: tmp_v_ac(1:2)
+   REAL(ReKi) :: tmp_omega
+   character(*), parameter        :: RoutineName = 'UA_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_U = InputData1%U
+   InputData1%U = InputData2%U
+   InputData2%U = tmp_U
+   tmp_alpha = InputData1%alpha
+   InputData1%alpha = InputData2%alpha
+   InputData2%alpha = tmp_alpha
+   tmp_Re = InputData1%Re
+   InputData1%Re = InputData2%Re
+   InputData2%Re = tmp_Re
+   tmp_UserProp = InputData1%UserProp
+   InputData1%UserProp = InputData2%UserProp
+   InputData2%UserProp = tmp_UserProp
+   tmp_v_ac = InputData1%v_ac
+   InputData1%v_ac = InputData2%v_ac
+   InputData2%v_ac = tmp_v_ac
+   tmp_omega = InputData1%omega
+   InputData1%omega = InputData2%omega
+   InputData2%omega = tmp_omega
+end subroutine
+
 subroutine UA_DestroyInput(InputData, ErrStat, ErrMsg)
    type(UA_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
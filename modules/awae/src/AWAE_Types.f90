@@ -971,6 +971,20 @@ subroutine AWAE_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrS
    DstContStateData%Dummy = SrcContStateData%Dummy
 end subroutine
 
+subroutine AWAE_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(AWAE_ContinuousStateType), intent(inout) :: ContStateData1
+   type(AWAE_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_Dummy
+   character(*), parameter        :: RoutineName = 'AWAE_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Dummy = ContStateData1%Dummy
+   ContStateData1%Dummy = ContStateData2%Dummy
+   ContStateData2%Dummy = tmp_Dummy
+end subroutine
+
 subroutine AWAE_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(AWAE_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1011,6 +1025,28 @@ subroutine AWAE_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrS
    DstDiscStateData%Ufarm = SrcDiscStateData%Ufarm
 end subroutine
 
+subroutine AWAE_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(AWAE_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(AWAE_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_Dummy
+   REAL(ReKi) :: tmp_WAT_B_Box(1:3)
+   REAL(ReKi) :: tmp_Ufarm(1:3)
+   character(*), parameter        :: RoutineName = 'AWAE_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Dummy = DiscStateData1%Dummy
+   DiscStateData1%Dummy = DiscStateData2%Dummy
+   DiscStateData2%Dummy = tmp_Dummy
+   tmp_WAT_B_Box = DiscStateData1%WAT_B_Box
+   DiscStateData1%WAT_B_Box = DiscStateData2%WAT_B_Box
+   DiscStateData2%WAT_B_Box = tmp_WAT_B_Box
+   tmp_Ufarm = DiscStateData1%Ufarm
+   DiscStateData1%Ufarm = DiscStateData2%Ufarm
+   DiscStateData2%Ufarm = tmp_Ufarm
+end subroutine
+
 subroutine AWAE_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(AWAE_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1053,6 +1089,20 @@ subroutine AWAE_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode
    DstConstrStateData%Dummy = SrcConstrStateData%Dummy
 end subroutine
 
+subroutine AWAE_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(AWAE_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(AWAE_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_Dummy
+   character(*), parameter        :: RoutineName = 'AWAE_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Dummy = ConstrStateData1%Dummy
+   ConstrStateData1%Dummy = ConstrStateData2%Dummy
+   ConstrStateData2%Dummy = tmp_Dummy
+end subroutine
+
 subroutine AWAE_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(AWAE_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1091,6 +1141,20 @@ subroutine AWAE_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, E
    DstOtherStateData%Dummy = SrcOtherStateData%Dummy
 end subroutine
 
+subroutine AWAE_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(AWAE_OtherStateType), intent(inout) :: OtherStateData1
+   type(AWAE_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_Dummy
+   character(*), parameter        :: RoutineName = 'AWAE_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Dummy = OtherStateData1%Dummy
+   OtherStateData1%Dummy = OtherStateData2%Dummy
+   OtherStateData2%Dummy = tmp_Dummy
+end subroutine
+
 subroutine AWAE_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(AWAE_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2663,6 +2727,48 @@ subroutine AWAE_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine AWAE_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(AWAE_InputType), intent(inout) :: InputData1
+   type(AWAE_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_NumPlanes(:)
+   REAL(ReKi), allocatable :: tmp_xhat_plane(:,:,:)
+   REAL(ReKi), allocatable :: tmp_p_plane(:,:,:)
+   REAL(ReKi), allocatable :: tmp_Vx_wake(:,:,:,:)
+   REAL(ReKi), allocatable :: tmp_Vy_wake(:,:,:,:)
+   REAL(ReKi), allocatable :: tmp_Vz_wake(:,:,:,:)
+   REAL(ReKi), allocatable :: tmp_D_wake(:,:)
+   REAL(ReKi), allocatable :: tmp_WAT_k(:,:,:,:)
+   character(*), parameter        :: RoutineName = 'AWAE_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(InputData1%NumPlanes, tmp_NumPlanes)
+   call move_alloc(InputData2%NumPlanes, InputData1%NumPlanes)
+   call move_alloc(tmp_NumPlanes, InputData2%NumPlanes)
+   call move_alloc(InputData1%xhat_plane, tmp_xhat_plane)
+   call move_alloc(InputData2%xhat_plane, InputData1%xhat_plane)
+   call move_alloc(tmp_xhat_plane, InputData2%xhat_plane)
+   call move_alloc(InputData1%p_plane, tmp_p_plane)
+   call move_alloc(InputData2%p_plane, InputData1%p_plane)
+   call move_alloc(tmp_p_plane, InputData2%p_plane)
+   call move_alloc(InputData1%Vx_wake, tmp_Vx_wake)
+   call move_alloc(InputData2%Vx_wake, InputData1%Vx_wake)
+   call move_alloc(tmp_Vx_wake, InputData2%Vx_wake)
+   call move_alloc(InputData1%Vy_wake, tmp_Vy_wake)
+   call move_alloc(InputData2%Vy_wake, InputData1%Vy_wake)
+   call move_alloc(tmp_Vy_wake, InputData2%Vy_wake)
+   call move_alloc(InputData1%Vz_wake, tmp_Vz_wake)
+   call move_alloc(InputData2%Vz_wake, InputData1%Vz_wake)
+   call move_alloc(tmp_Vz_wake, InputData2%Vz_wake)
+   call move_alloc(InputData1%D_wake, tmp_D_wake)
+   call move_alloc(InputData2%D_wake, InputData1%D_wake)
+   call move_alloc(tmp_D_wake, InputData2%D_wake)
+   call move_alloc(InputData1%WAT_k, tmp_WAT_k)
+   call move_alloc(InputData2%WAT_k, InputData1%WAT_k)
+   call move_alloc(tmp_WAT_k, InputData2%WAT_k)
+end subroutine
+
 subroutine AWAE_DestroyInput(InputData, ErrStat, ErrMsg)
    type(AWAE_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -866,6 +866,24 @@ subroutine BD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSta
    end if
 end subroutine
 
+subroutine BD_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(BD_ContinuousStateType), intent(inout) :: ContStateData1
+   type(BD_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki), allocatable :: tmp_q(:,:)
+   REAL(R8Ki), allocatable :: tmp_dqdt(:,:)
+   character(*), parameter        :: RoutineName = 'BD_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%q, tmp_q)
+   call move_alloc(ContStateData2%q, ContStateData1%q)
+   call move_alloc(tmp_q, ContStateData2%q)
+   call move_alloc(ContStateData1%dqdt, tmp_dqdt)
+   call move_alloc(ContStateData2%dqdt, ContStateData1%dqdt)
+   call move_alloc(tmp_dqdt, ContStateData2%dqdt)
+end subroutine
+
 subroutine BD_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(BD_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -915,6 +933,20 @@ subroutine BD_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSta
    DstDiscStateData%DummyDiscState = SrcDiscStateData%DummyDiscState
 end subroutine
 
+subroutine BD_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(BD_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(BD_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyDiscState
+   character(*), parameter        :: RoutineName = 'BD_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscState = DiscStateData1%DummyDiscState
+   DiscStateData1%DummyDiscState = DiscStateData2%DummyDiscState
+   DiscStateData2%DummyDiscState = tmp_DummyDiscState
+end subroutine
+
 subroutine BD_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(BD_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -953,6 +985,20 @@ subroutine BD_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine BD_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(BD_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(BD_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'BD_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine BD_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(BD_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1021,6 +1067,44 @@ subroutine BD_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Err
    DstOtherStateData%Glb_crv = SrcOtherStateData%Glb_crv
 end subroutine
 
+subroutine BD_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(BD_OtherStateType), intent(inout) :: OtherStateData1
+   type(BD_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki), allocatable :: tmp_acc(:,:)
+   REAL(R8Ki), allocatable :: tmp_xcc(:,:)
+   LOGICAL :: tmp_InitAcc
+   LOGICAL :: tmp_RunQuasiStaticInit
+   REAL(R8Ki) :: tmp_GlbPos(1:3)
+   REAL(R8Ki) :: tmp_GlbRot(1:3,1:3)
+   REAL(R8Ki) :: tmp_Glb_crv(1:3)
+   character(*), parameter        :: RoutineName = 'BD_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(OtherStateData1%acc, tmp_acc)
+   call move_alloc(OtherStateData2%acc, OtherStateData1%acc)
+   call move_alloc(tmp_acc, OtherStateData2%acc)
+   call move_alloc(OtherStateData1%xcc, tmp_xcc)
+   call move_alloc(OtherStateData2%xcc, OtherStateData1%xcc)
+   call move_alloc(tmp_xcc, OtherStateData2%xcc)
+   tmp_InitAcc = OtherStateData1%InitAcc
+   OtherStateData1%InitAcc = OtherStateData2%InitAcc
+   OtherStateData2%InitAcc = tmp_InitAcc
+   tmp_RunQuasiStaticInit = OtherStateData1%RunQuasiStaticInit
+   OtherStateData1%RunQuasiStaticInit = OtherStateData2%RunQuasiStaticInit
+   OtherStateData2%RunQuasiStaticInit = tmp_RunQuasiStaticInit
+   tmp_GlbPos = OtherStateData1%GlbPos
+   OtherStateData1%GlbPos = OtherStateData2%GlbPos
+   OtherStateData2%GlbPos = tmp_GlbPos
+   tmp_GlbRot = OtherStateData1%GlbRot
+   OtherStateData1%GlbRot = OtherStateData2%GlbRot
+   OtherStateData2%GlbRot = tmp_GlbRot
+   tmp_Glb_crv = OtherStateData1%Glb_crv
+   OtherStateData1%Glb_crv = OtherStateData2%Glb_crv
+   OtherStateData2%Glb_crv = tmp_Glb_crv
+end subroutine
+
 subroutine BD_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(BD_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1879,6 +1963,27 @@ subroutine BD_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine BD_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(BD_InputType), intent(inout) :: InputData1
+   type(BD_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'BD_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%RootMotion, InputData2%RootMotion, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%PointLoad, InputData2%PointLoad, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%DistrLoad, InputData2%DistrLoad, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine BD_DestroyInput(InputData, ErrStat, ErrMsg)
    type(BD_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
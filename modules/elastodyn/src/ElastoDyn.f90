@@ -692,6 +692,7 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
    
    
    ! Array m%AllOuts() is initialized to 0.0 in initialization, so we are not going to reinitialize it here.
+   ! Blocks of channels that are not requested (see p%OutBlk, set in SetOutParam) are not computed and keep their old values.
 
    !...............................................................................................................................
    ! Calculate all of the total forces and moments using all of the partial forces and moments calculated in RtHS().  Also,
@@ -809,17 +810,19 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
    ENDDO ! J - Tower nodes / elements
 
 
-   DO J = 1,p%TwrNodes  ! Loop through the tower nodes / elements
+   IF ( p%OutBlk(ED_OutBlk_TwrLd) ) THEN ! FTTower and MFHydro are only needed for the local tower loads
+      DO J = 1,p%TwrNodes  ! Loop through the tower nodes / elements
 
-      FTTower (:,J) = m%RtHS%FTHydrot (:,J)
-      MFHydro (:,J) = m%RtHS%MFHydrot (:,J)
+         FTTower (:,J) = m%RtHS%FTHydrot (:,J)
+         MFHydro (:,J) = m%RtHS%MFHydrot (:,J)
 
-      DO I = 1,p%DOFs%NPTE  ! Loop through all active (enabled) DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing center of mass (point O)
-         FTTower (:,J) = FTTower (:,J) + m%RtHS%PFTHydro (:,J,p%DOFs%PTE(I)  )*m%QD2T(p%DOFs%PTE(I))
-         MFHydro (:,J) = MFHydro (:,J) + m%RtHS%PMFHydro (:,J,p%DOFs%PTE(I)  )*m%QD2T(p%DOFs%PTE(I))
-      ENDDO          ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing center of mass (point O)
+         DO I = 1,p%DOFs%NPTE  ! Loop through all active (enabled) DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing center of mass (point O)
+            FTTower (:,J) = FTTower (:,J) + m%RtHS%PFTHydro (:,J,p%DOFs%PTE(I)  )*m%QD2T(p%DOFs%PTE(I))
+            MFHydro (:,J) = MFHydro (:,J) + m%RtHS%PMFHydro (:,J,p%DOFs%PTE(I)  )*m%QD2T(p%DOFs%PTE(I))
+         ENDDO          ! I - All active (enabled) DOFs that contribute to the QD2T-related linear accelerations of the yaw bearing center of mass (point O)
 
-   ENDDO ! J - Tower nodes / elements
+      ENDDO ! J - Tower nodes / elements
+   END IF
 
 
       ! Convert the units of the forces and moments from N and N-m
@@ -849,71 +852,75 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
       ! Blade (1-3) Tip Motions:
 
-   DO K = 1,p%NumBl
-      rSTipPSTip = m%RtHS%rS0S(:,K,p%TipNode) - p%BldFlexL*m%CoordSys%j3(K,:)  ! Position vector from the undeflected blade tip (point S tip prime) to the deflected blade tip (point S tip) of blade 1.
-      rOSTip     = m%RtHS%rS  (:,K,p%TipNode) - m%RtHS%rO                ! Position vector from the deflected tower top (point O) to the deflected blade tip (point S tip) of blade 1.
-      rOSTipxn   =      DOT_PRODUCT( rOSTip, m%CoordSys%d1 )                ! Component of rOSTip directed along the xn-axis.
-      rOSTipyn   = -1.0*DOT_PRODUCT( rOSTip, m%CoordSys%d3 )                ! Component of rOSTip directed along the yn-axis.
-      rOSTipzn   =      DOT_PRODUCT( rOSTip, m%CoordSys%d2 )                ! Component of rOSTip directed along the zn-axis.
-
-      IF (.NOT. p%BD4Blades) THEN
-         m%AllOuts(  TipDxc(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%i1(K,         :) )
-         m%AllOuts(  TipDyc(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%i2(K,         :) )
-         m%AllOuts(  TipDzc(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%i3(K,         :) )
-         m%AllOuts(  TipDxb(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%j1(K,         :) )
-         m%AllOuts(  TipDyb(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%j2(K,         :) )
-      !JASON: USE TipNode HERE INSTEAD OF BldNodes IF YOU ALLOCATE AND DEFINE n1, n2, n3, m1, m2, AND m3 TO USE TipNode.  THIS WILL REQUIRE THAT THE AERODYNAMIC AND STRUCTURAL TWISTS, AeroTwst() AND ThetaS(), BE KNOWN AT THE TIP!!!
-         m%AllOuts( TipALxb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K), m%CoordSys%n1(K,p%BldNodes,:) )
-         m%AllOuts( TipALyb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K), m%CoordSys%n2(K,p%BldNodes,:) )
-         m%AllOuts( TipALzb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K), m%CoordSys%n3(K,p%BldNodes,:) )
-         m%AllOuts( TipALgxb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K) - gAccE, m%CoordSys%n1(K,p%BldNodes,:) )
-         m%AllOuts( TipALgyb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K) - gAccE, m%CoordSys%n2(K,p%BldNodes,:) )
-         m%AllOuts( TipALgzb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K) - gAccE, m%CoordSys%n3(K,p%BldNodes,:) )
-         m%AllOuts( TipRDxb(K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%TipNode), m%CoordSys%j1(K,         :) )*R2D
-         m%AllOuts( TipRDyb(K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%TipNode), m%CoordSys%j2(K,         :) )*R2D
-         ! There is no sense computing AllOuts( TipRDzc(K) ) here since it is always zero for FAST simulation results.
-         IF ( p%MHK == MHK_Floating ) THEN
-            IF ( rOSTipzn < 0.0 )  THEN   ! Tip of blade K is above the yaw bearing.
-               m%AllOuts(TipClrnc(K) ) = SQRT( rOSTipxn*rOSTipxn + rOSTipyn*rOSTipyn + rOSTipzn*rOSTipzn ) ! Absolute distance from the tower top / yaw bearing to the tip of blade 1.
-            ELSE                          ! Tip of blade K is below the yaw bearing.
-               m%AllOuts(TipClrnc(K) ) = SQRT( rOSTipxn*rOSTipxn + rOSTipyn*rOSTipyn                     ) ! Perpendicular distance from the yaw axis / tower centerline to the tip of blade 1.
-            ENDIF
-         ELSE
-            IF ( rOSTipzn > 0.0 )  THEN   ! Tip of blade K is above the yaw bearing.
-               m%AllOuts(TipClrnc(K) ) = SQRT( rOSTipxn*rOSTipxn + rOSTipyn*rOSTipyn + rOSTipzn*rOSTipzn ) ! Absolute distance from the tower top / yaw bearing to the tip of blade 1.
-            ELSE                          ! Tip of blade K is below the yaw bearing.
-               m%AllOuts(TipClrnc(K) ) = SQRT( rOSTipxn*rOSTipxn + rOSTipyn*rOSTipyn                     ) ! Perpendicular distance from the yaw axis / tower centerline to the tip of blade 1.
+   IF ( p%OutBlk(ED_OutBlk_BldTip) ) THEN
+      DO K = 1,p%NumBl
+         rSTipPSTip = m%RtHS%rS0S(:,K,p%TipNode) - p%BldFlexL*m%CoordSys%j3(K,:)  ! Position vector from the undeflected blade tip (point S tip prime) to the deflected blade tip (point S tip) of blade 1.
+         rOSTip     = m%RtHS%rS  (:,K,p%TipNode) - m%RtHS%rO                ! Position vector from the deflected tower top (point O) to the deflected blade tip (point S tip) of blade 1.
+         rOSTipxn   =      DOT_PRODUCT( rOSTip, m%CoordSys%d1 )                ! Component of rOSTip directed along the xn-axis.
+         rOSTipyn   = -1.0*DOT_PRODUCT( rOSTip, m%CoordSys%d3 )                ! Component of rOSTip directed along the yn-axis.
+         rOSTipzn   =      DOT_PRODUCT( rOSTip, m%CoordSys%d2 )                ! Component of rOSTip directed along the zn-axis.
+
+         IF (.NOT. p%BD4Blades) THEN
+            m%AllOuts(  TipDxc(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%i1(K,         :) )
+            m%AllOuts(  TipDyc(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%i2(K,         :) )
+            m%AllOuts(  TipDzc(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%i3(K,         :) )
+            m%AllOuts(  TipDxb(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%j1(K,         :) )
+            m%AllOuts(  TipDyb(K) ) = DOT_PRODUCT(            rSTipPSTip, m%CoordSys%j2(K,         :) )
+         !JASON: USE TipNode HERE INSTEAD OF BldNodes IF YOU ALLOCATE AND DEFINE n1, n2, n3, m1, m2, AND m3 TO USE TipNode.  THIS WILL REQUIRE THAT THE AERODYNAMIC AND STRUCTURAL TWISTS, AeroTwst() AND ThetaS(), BE KNOWN AT THE TIP!!!
+            m%AllOuts( TipALxb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K), m%CoordSys%n1(K,p%BldNodes,:) )
+            m%AllOuts( TipALyb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K), m%CoordSys%n2(K,p%BldNodes,:) )
+            m%AllOuts( TipALzb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K), m%CoordSys%n3(K,p%BldNodes,:) )
+            m%AllOuts( TipALgxb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K) - gAccE, m%CoordSys%n1(K,p%BldNodes,:) )
+            m%AllOuts( TipALgyb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K) - gAccE, m%CoordSys%n2(K,p%BldNodes,:) )
+            m%AllOuts( TipALgzb(K) ) = DOT_PRODUCT( LinAccES(:,p%TipNode,K) - gAccE, m%CoordSys%n3(K,p%BldNodes,:) )
+            m%AllOuts( TipRDxb(K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%TipNode), m%CoordSys%j1(K,         :) )*R2D
+            m%AllOuts( TipRDyb(K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%TipNode), m%CoordSys%j2(K,         :) )*R2D
+            ! There is no sense computing AllOuts( TipRDzc(K) ) here since it is always zero for FAST simulation results.
+            IF ( p%MHK == MHK_Floating ) THEN
+               IF ( rOSTipzn < 0.0 )  THEN   ! Tip of blade K is above the yaw bearing.
+                  m%AllOuts(TipClrnc(K) ) = SQRT( rOSTipxn*rOSTipxn + rOSTipyn*rOSTipyn + rOSTipzn*rOSTipzn ) ! Absolute distance from the tower top / yaw bearing to the tip of blade 1.
+               ELSE                          ! Tip of blade K is below the yaw bearing.
+                  m%AllOuts(TipClrnc(K) ) = SQRT( rOSTipxn*rOSTipxn + rOSTipyn*rOSTipyn                     ) ! Perpendicular distance from the yaw axis / tower centerline to the tip of blade 1.
+               ENDIF
+            ELSE
+               IF ( rOSTipzn > 0.0 )  THEN   ! Tip of blade K is above the yaw bearing.
+                  m%AllOuts(TipClrnc(K) ) = SQRT( rOSTipxn*rOSTipxn + rOSTipyn*rOSTipyn + rOSTipzn*rOSTipzn ) ! Absolute distance from the tower top / yaw bearing to the tip of blade 1.
+               ELSE                          ! Tip of blade K is below the yaw bearing.
+                  m%AllOuts(TipClrnc(K) ) = SQRT( rOSTipxn*rOSTipxn + rOSTipyn*rOSTipyn                     ) ! Perpendicular distance from the yaw axis / tower centerline to the tip of blade 1.
+               ENDIF
             ENDIF
-         ENDIF
-      END IF      
+         END IF      
 
-   END DO !K
+      END DO !K
+   END IF
 
       ! Blade (1-3) Local Span Motions:
 
-   DO K = 1,p%NumBl
-      DO I = 1, p%NBlGages
+   IF ( p%OutBlk(ED_OutBlk_BldSpnMot) ) THEN
+      DO K = 1,p%NumBl
+         DO I = 1, p%NBlGages
 
-         m%AllOuts( SpnALxb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n1(K,p%BldGagNd(I),:) )
-         m%AllOuts( SpnALyb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n2(K,p%BldGagNd(I),:) )
-         m%AllOuts( SpnALzb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n3(K,p%BldGagNd(I),:) )
+            m%AllOuts( SpnALxb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n1(K,p%BldGagNd(I),:) )
+            m%AllOuts( SpnALyb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n2(K,p%BldGagNd(I),:) )
+            m%AllOuts( SpnALzb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K), m%CoordSys%n3(K,p%BldGagNd(I),:) )
 
-         m%AllOuts( SpnALgxb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K) - gAccE, m%CoordSys%n1(K,p%BldGagNd(I),:) )
-         m%AllOuts( SpnALgyb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K) - gAccE, m%CoordSys%n2(K,p%BldGagNd(I),:) )
-         m%AllOuts( SpnALgzb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K) - gAccE, m%CoordSys%n3(K,p%BldGagNd(I),:) )
+            m%AllOuts( SpnALgxb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K) - gAccE, m%CoordSys%n1(K,p%BldGagNd(I),:) )
+            m%AllOuts( SpnALgyb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K) - gAccE, m%CoordSys%n2(K,p%BldGagNd(I),:) )
+            m%AllOuts( SpnALgzb(I,K) ) = DOT_PRODUCT( LinAccES(:,p%BldGagNd(I),K) - gAccE, m%CoordSys%n3(K,p%BldGagNd(I),:) )
 
-         rSPS                      = m%RtHS%rS0S(:,K,p%BldGagNd(I)) - p%RNodes(p%BldGagNd(I))*m%CoordSys%j3(K,:)
+            rSPS                      = m%RtHS%rS0S(:,K,p%BldGagNd(I)) - p%RNodes(p%BldGagNd(I))*m%CoordSys%j3(K,:)
 
-         m%AllOuts( SpnTDxb(I,K) ) = DOT_PRODUCT( rSPS, m%CoordSys%j1(K,:) )
-         m%AllOuts( SpnTDyb(I,K) ) = DOT_PRODUCT( rSPS, m%CoordSys%j2(K,:) )
-         m%AllOuts( SpnTDzb(I,K) ) = DOT_PRODUCT( rSPS, m%CoordSys%j3(K,:) )
+            m%AllOuts( SpnTDxb(I,K) ) = DOT_PRODUCT( rSPS, m%CoordSys%j1(K,:) )
+            m%AllOuts( SpnTDyb(I,K) ) = DOT_PRODUCT( rSPS, m%CoordSys%j2(K,:) )
+            m%AllOuts( SpnTDzb(I,K) ) = DOT_PRODUCT( rSPS, m%CoordSys%j3(K,:) )
 
-         m%AllOuts( SpnRDxb(I,K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%BldGagNd(I)), m%CoordSys%j1(K,:) )*R2D
-         m%AllOuts( SpnRDyb(I,K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%BldGagNd(I)), m%CoordSys%j2(K,:) )*R2D
-        !m%AllOuts( SpnRDzb(I,K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%BldGagNd(I)), m%CoordSys%j3(K,:) )*R2D           ! this is always zero for FAST
+            m%AllOuts( SpnRDxb(I,K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%BldGagNd(I)), m%CoordSys%j1(K,:) )*R2D
+            m%AllOuts( SpnRDyb(I,K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%BldGagNd(I)), m%CoordSys%j2(K,:) )*R2D
+           !m%AllOuts( SpnRDzb(I,K) ) = DOT_PRODUCT( m%RtHS%AngPosHM(:,K,p%BldGagNd(I)), m%CoordSys%j3(K,:) )*R2D           ! this is always zero for FAST
 
-      END DO !I
-   END DO !K
+         END DO !I
+      END DO !K
+   END IF
 
 
       ! Blade Pitch Motions:
@@ -1004,16 +1011,18 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
       ! Rotor-Furl Motions:
 
-   m%AllOuts( RotFurlP) = x%QT  (DOF_RFrl)*R2D
-   m%AllOuts( RotFurlV) = x%QDT (DOF_RFrl)*R2D
-   m%AllOuts( RotFurlA) = m%QD2T(DOF_RFrl)*R2D
+   IF ( p%OutBlk(ED_OutBlk_Furl) ) THEN
+      m%AllOuts( RotFurlP) = x%QT  (DOF_RFrl)*R2D
+      m%AllOuts( RotFurlV) = x%QDT (DOF_RFrl)*R2D
+      m%AllOuts( RotFurlA) = m%QD2T(DOF_RFrl)*R2D
 
 
-      ! Tail-Furl Motions:
+         ! Tail-Furl Motions:
 
-   m%AllOuts(TailFurlP) = x%QT  (DOF_TFrl)*R2D
-   m%AllOuts(TailFurlV) = x%QDT (DOF_TFrl)*R2D
-   m%AllOuts(TailFurlA) = m%QD2T(DOF_TFrl)*R2D
+      m%AllOuts(TailFurlP) = x%QT  (DOF_TFrl)*R2D
+      m%AllOuts(TailFurlV) = x%QDT (DOF_TFrl)*R2D
+      m%AllOuts(TailFurlA) = m%QD2T(DOF_TFrl)*R2D
+   END IF
 
 
       ! Yaw Motions:
@@ -1060,88 +1069,92 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
       ! Local Tower Motions:
 
-   DO I = 1, p%NTwGages
+   IF ( p%OutBlk(ED_OutBlk_TwrMot) ) THEN
+      DO I = 1, p%NTwGages
 
-      m%AllOuts( TwHtALxt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t1(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtALyt(I) ) = -1.0*DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t3(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtALzt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t2(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtALxt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t1(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtALyt(I) ) = -1.0*DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t3(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtALzt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)), m%CoordSys%t2(p%TwrGagNd(I),:) )
 
-      m%AllOuts( TwHtALgxt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)) - gAccE, m%CoordSys%t1(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtALgyt(I) ) = -1.0*DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)) - gAccE, m%CoordSys%t3(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtALgzt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)) - gAccE, m%CoordSys%t2(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtALgxt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)) - gAccE, m%CoordSys%t1(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtALgyt(I) ) = -1.0*DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)) - gAccE, m%CoordSys%t3(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtALgzt(I) ) =      DOT_PRODUCT( LinAccET(:,p%TwrGagNd(I)) - gAccE, m%CoordSys%t2(p%TwrGagNd(I),:) )
 
-      rTPT                   = m%RtHS%rT0T(:,p%TwrGagNd(I)) - p%HNodes(p%TwrGagNd(I))*m%CoordSys%a2(:)
+         rTPT                   = m%RtHS%rT0T(:,p%TwrGagNd(I)) - p%HNodes(p%TwrGagNd(I))*m%CoordSys%a2(:)
 
-      m%AllOuts( TwHtTDxt(I) ) =      DOT_PRODUCT( rTPT,     m%CoordSys%a1 )
-      m%AllOuts( TwHtTDyt(I) ) = -1.0*DOT_PRODUCT( rTPT,     m%CoordSys%a3 )
-      m%AllOuts( TwHtTDzt(I) ) =      DOT_PRODUCT( rTPT,     m%CoordSys%a2 )
+         m%AllOuts( TwHtTDxt(I) ) =      DOT_PRODUCT( rTPT,     m%CoordSys%a1 )
+         m%AllOuts( TwHtTDyt(I) ) = -1.0*DOT_PRODUCT( rTPT,     m%CoordSys%a3 )
+         m%AllOuts( TwHtTDzt(I) ) =      DOT_PRODUCT( rTPT,     m%CoordSys%a2 )
 
-      m%AllOuts( TwHtRDxt(I) ) =      DOT_PRODUCT( m%RtHS%AngPosXF(:,p%TwrGagNd(I)), m%CoordSys%a1 )*R2D  !why is this zero???
-      m%AllOuts( TwHtRDyt(I) ) = -1.0*DOT_PRODUCT( m%RtHS%AngPosXF(:,p%TwrGagNd(I)), m%CoordSys%a3 )*R2D
-   !   m%AllOuts( TwHtRDzt(I) ) =     DOT_PRODUCT( m%RtHS%AngPosXF(:,p%TwrGagNd(I)), m%CoordSys%a2 )*R2D  !this will always be 0 in FAST, so no need to calculate
+         m%AllOuts( TwHtRDxt(I) ) =      DOT_PRODUCT( m%RtHS%AngPosXF(:,p%TwrGagNd(I)), m%CoordSys%a1 )*R2D  !why is this zero???
+         m%AllOuts( TwHtRDyt(I) ) = -1.0*DOT_PRODUCT( m%RtHS%AngPosXF(:,p%TwrGagNd(I)), m%CoordSys%a3 )*R2D
+      !   m%AllOuts( TwHtRDzt(I) ) =     DOT_PRODUCT( m%RtHS%AngPosXF(:,p%TwrGagNd(I)), m%CoordSys%a2 )*R2D  !this will always be 0 in FAST, so no need to calculate
 
 
-      m%AllOuts( TwHtTPxi(I) ) =      m%RtHS%rT(1,p%TwrGagNd(I)) + p%PtfmRefxt
-      m%AllOuts( TwHtTPyi(I) ) = -1.0*m%RtHS%rT(3,p%TwrGagNd(I)) + p%PtfmRefyt
-      m%AllOuts( TwHtTPzi(I) ) =      m%RtHS%rT(2,p%TwrGagNd(I)) + p%PtfmRefzt
+         m%AllOuts( TwHtTPxi(I) ) =      m%RtHS%rT(1,p%TwrGagNd(I)) + p%PtfmRefxt
+         m%AllOuts( TwHtTPyi(I) ) = -1.0*m%RtHS%rT(3,p%TwrGagNd(I)) + p%PtfmRefyt
+         m%AllOuts( TwHtTPzi(I) ) =      m%RtHS%rT(2,p%TwrGagNd(I)) + p%PtfmRefzt
 
-      ! m%AllOuts( TwHtRPxi(I) ) =  m%RtHS%AngPosEF(1,p%TwrGagNd(I))*R2D
-      ! m%AllOuts( TwHtRPyi(I) ) = -m%RtHS%AngPosEF(3,p%TwrGagNd(I))*R2D
-      ! m%AllOuts( TwHtRPzi(I) ) =  m%RtHS%AngPosEF(2,p%TwrGagNd(I))*R2D
+         ! m%AllOuts( TwHtRPxi(I) ) =  m%RtHS%AngPosEF(1,p%TwrGagNd(I))*R2D
+         ! m%AllOuts( TwHtRPyi(I) ) = -m%RtHS%AngPosEF(3,p%TwrGagNd(I))*R2D
+         ! m%AllOuts( TwHtRPzi(I) ) =  m%RtHS%AngPosEF(2,p%TwrGagNd(I))*R2D
 
-      m%AllOuts( TwHtRPxi(I) ) =  m%RtHS%AngPosEF(1,p%TwrGagNd(I))*R2D ! <- AngPosEF is now simply the roll, pitch, and yaw angles (possibly large) of each tower section
-      m%AllOuts( TwHtRPyi(I) ) =  m%RtHS%AngPosEF(2,p%TwrGagNd(I))*R2D
-      m%AllOuts( TwHtRPzi(I) ) =  m%RtHS%AngPosEF(3,p%TwrGagNd(I))*R2D
+         m%AllOuts( TwHtRPxi(I) ) =  m%RtHS%AngPosEF(1,p%TwrGagNd(I))*R2D ! <- AngPosEF is now simply the roll, pitch, and yaw angles (possibly large) of each tower section
+         m%AllOuts( TwHtRPyi(I) ) =  m%RtHS%AngPosEF(2,p%TwrGagNd(I))*R2D
+         m%AllOuts( TwHtRPzi(I) ) =  m%RtHS%AngPosEF(3,p%TwrGagNd(I))*R2D
 
-   END DO !I
+      END DO !I
+   END IF
 
       ! Platform Motions:
 
-   m%AllOuts( PtfmTDxt) =  DOT_PRODUCT(       m%RtHS%rZ, m%CoordSys%a1 )
-   m%AllOuts( PtfmTDyt) = -DOT_PRODUCT(       m%RtHS%rZ, m%CoordSys%a3 )
-   m%AllOuts( PtfmTDzt) =  DOT_PRODUCT(       m%RtHS%rZ, m%CoordSys%a2 )
-   m%AllOuts( PtfmTDxi) = x%QT  (DOF_Sg )
-   m%AllOuts( PtfmTDyi) = x%QT  (DOF_Sw )
-   m%AllOuts( PtfmTDzi) = x%QT  (DOF_Hv )
-   m%AllOuts( PtfmTVxt) =  DOT_PRODUCT( m%RtHS%LinVelEZ, m%CoordSys%a1 )
-   m%AllOuts( PtfmTVyt) = -DOT_PRODUCT( m%RtHS%LinVelEZ, m%CoordSys%a3 )
-   m%AllOuts( PtfmTVzt) =  DOT_PRODUCT( m%RtHS%LinVelEZ, m%CoordSys%a2 )
-   m%AllOuts( PtfmTVxi) = x%QDT (DOF_Sg )
-   m%AllOuts( PtfmTVyi) = x%QDT (DOF_Sw )
-   m%AllOuts( PtfmTVzi) = x%QDT (DOF_Hv )
-   m%AllOuts( PtfmTAxt) =  DOT_PRODUCT(                 LinAccEZ, m%CoordSys%a1 )
-   m%AllOuts( PtfmTAyt) = -DOT_PRODUCT(                 LinAccEZ, m%CoordSys%a3 )
-   m%AllOuts( PtfmTAzt) =  DOT_PRODUCT(                 LinAccEZ, m%CoordSys%a2 )
-   m%AllOuts( PtfmTAgxt) =  DOT_PRODUCT(        LinAccEZ - gAccE, m%CoordSys%a1 )
-   m%AllOuts( PtfmTAgyt) = -DOT_PRODUCT(        LinAccEZ - gAccE, m%CoordSys%a3 )
-   m%AllOuts( PtfmTAgzt) =  DOT_PRODUCT(        LinAccEZ - gAccE, m%CoordSys%a2 )
-   m%AllOuts( PtfmTAxi) = m%QD2T(DOF_Sg  )
-   m%AllOuts( PtfmTAyi) = m%QD2T(DOF_Sw  )
-   m%AllOuts( PtfmTAzi) = m%QD2T(DOF_Hv  )
-   m%AllOuts( PtfmTAgxi) = m%QD2T(DOF_Sg  )
-   m%AllOuts( PtfmTAgyi) = m%QD2T(DOF_Sw  )
-   m%AllOuts( PtfmTAgzi) = m%QD2T(DOF_Hv  ) + p%Gravity
-   m%AllOuts( PtfmRDxi) = x%QT  (DOF_R )*R2D
-   m%AllOuts( PtfmRDyi) = x%QT  (DOF_P )*R2D
-   m%AllOuts( PtfmRDzi) = x%QT  (DOF_Y )*R2D
-   m%AllOuts( PtfmRVxt) =  DOT_PRODUCT( m%RtHS%AngVelEX, m%CoordSys%a1 )*R2D
-   m%AllOuts( PtfmRVyt) = -DOT_PRODUCT( m%RtHS%AngVelEX, m%CoordSys%a3 )*R2D
-   m%AllOuts( PtfmRVzt) =  DOT_PRODUCT( m%RtHS%AngVelEX, m%CoordSys%a2 )*R2D
-   ! m%AllOuts( PtfmRVxi) = x%QDT (DOF_R )*R2D
-   ! m%AllOuts( PtfmRVyi) = x%QDT (DOF_P )*R2D
-   ! m%AllOuts( PtfmRVzi) = x%QDT (DOF_Y )*R2D
-   m%AllOuts( PtfmRVxi) =  m%RtHS%AngVelEX(1)*R2D
-   m%AllOuts( PtfmRVyi) = -m%RtHS%AngVelEX(3)*R2D
-   m%AllOuts( PtfmRVzi) =  m%RtHS%AngVelEX(2)*R2D
-   m%AllOuts( PtfmRAxt) =  DOT_PRODUCT(                 AngAccEX, m%CoordSys%a1 )*R2D
-   m%AllOuts( PtfmRAyt) = -DOT_PRODUCT(                 AngAccEX, m%CoordSys%a3 )*R2D
-   m%AllOuts( PtfmRAzt) =  DOT_PRODUCT(                 AngAccEX, m%CoordSys%a2 )*R2D
-   ! m%AllOuts( PtfmRAxi) = m%QD2T(DOF_R )*R2D
-   ! m%AllOuts( PtfmRAyi) = m%QD2T(DOF_P )*R2D
-   ! m%AllOuts( PtfmRAzi) = m%QD2T(DOF_Y )*R2D
-   m%AllOuts( PtfmRAxi) =  AngAccEX(1)*R2D
-   m%AllOuts( PtfmRAyi) = -AngAccEX(3)*R2D
-   m%AllOuts( PtfmRAzi) =  AngAccEX(2)*R2D
+   IF ( p%OutBlk(ED_OutBlk_PtfmMot) ) THEN
+      m%AllOuts( PtfmTDxt) =  DOT_PRODUCT(       m%RtHS%rZ, m%CoordSys%a1 )
+      m%AllOuts( PtfmTDyt) = -DOT_PRODUCT(       m%RtHS%rZ, m%CoordSys%a3 )
+      m%AllOuts( PtfmTDzt) =  DOT_PRODUCT(       m%RtHS%rZ, m%CoordSys%a2 )
+      m%AllOuts( PtfmTDxi) = x%QT  (DOF_Sg )
+      m%AllOuts( PtfmTDyi) = x%QT  (DOF_Sw )
+      m%AllOuts( PtfmTDzi) = x%QT  (DOF_Hv )
+      m%AllOuts( PtfmTVxt) =  DOT_PRODUCT( m%RtHS%LinVelEZ, m%CoordSys%a1 )
+      m%AllOuts( PtfmTVyt) = -DOT_PRODUCT( m%RtHS%LinVelEZ, m%CoordSys%a3 )
+      m%AllOuts( PtfmTVzt) =  DOT_PRODUCT( m%RtHS%LinVelEZ, m%CoordSys%a2 )
+      m%AllOuts( PtfmTVxi) = x%QDT (DOF_Sg )
+      m%AllOuts( PtfmTVyi) = x%QDT (DOF_Sw )
+      m%AllOuts( PtfmTVzi) = x%QDT (DOF_Hv )
+      m%AllOuts( PtfmTAxt) =  DOT_PRODUCT(                 LinAccEZ, m%CoordSys%a1 )
+      m%AllOuts( PtfmTAyt) = -DOT_PRODUCT(                 LinAccEZ, m%CoordSys%a3 )
+      m%AllOuts( PtfmTAzt) =  DOT_PRODUCT(                 LinAccEZ, m%CoordSys%a2 )
+      m%AllOuts( PtfmTAgxt) =  DOT_PRODUCT(        LinAccEZ - gAccE, m%CoordSys%a1 )
+      m%AllOuts( PtfmTAgyt) = -DOT_PRODUCT(        LinAccEZ - gAccE, m%CoordSys%a3 )
+      m%AllOuts( PtfmTAgzt) =  DOT_PRODUCT(        LinAccEZ - gAccE, m%CoordSys%a2 )
+      m%AllOuts( PtfmTAxi) = m%QD2T(DOF_Sg  )
+      m%AllOuts( PtfmTAyi) = m%QD2T(DOF_Sw  )
+      m%AllOuts( PtfmTAzi) = m%QD2T(DOF_Hv  )
+      m%AllOuts( PtfmTAgxi) = m%QD2T(DOF_Sg  )
+      m%AllOuts( PtfmTAgyi) = m%QD2T(DOF_Sw  )
+      m%AllOuts( PtfmTAgzi) = m%QD2T(DOF_Hv  ) + p%Gravity
+      m%AllOuts( PtfmRDxi) = x%QT  (DOF_R )*R2D
+      m%AllOuts( PtfmRDyi) = x%QT  (DOF_P )*R2D
+      m%AllOuts( PtfmRDzi) = x%QT  (DOF_Y )*R2D
+      m%AllOuts( PtfmRVxt) =  DOT_PRODUCT( m%RtHS%AngVelEX, m%CoordSys%a1 )*R2D
+      m%AllOuts( PtfmRVyt) = -DOT_PRODUCT( m%RtHS%AngVelEX, m%CoordSys%a3 )*R2D
+      m%AllOuts( PtfmRVzt) =  DOT_PRODUCT( m%RtHS%AngVelEX, m%CoordSys%a2 )*R2D
+      ! m%AllOuts( PtfmRVxi) = x%QDT (DOF_R )*R2D
+      ! m%AllOuts( PtfmRVyi) = x%QDT (DOF_P )*R2D
+      ! m%AllOuts( PtfmRVzi) = x%QDT (DOF_Y )*R2D
+      m%AllOuts( PtfmRVxi) =  m%RtHS%AngVelEX(1)*R2D
+      m%AllOuts( PtfmRVyi) = -m%RtHS%AngVelEX(3)*R2D
+      m%AllOuts( PtfmRVzi) =  m%RtHS%AngVelEX(2)*R2D
+      m%AllOuts( PtfmRAxt) =  DOT_PRODUCT(                 AngAccEX, m%CoordSys%a1 )*R2D
+      m%AllOuts( PtfmRAyt) = -DOT_PRODUCT(                 AngAccEX, m%CoordSys%a3 )*R2D
+      m%AllOuts( PtfmRAzt) =  DOT_PRODUCT(                 AngAccEX, m%CoordSys%a2 )*R2D
+      ! m%AllOuts( PtfmRAxi) = m%QD2T(DOF_R )*R2D
+      ! m%AllOuts( PtfmRAyi) = m%QD2T(DOF_P )*R2D
+      ! m%AllOuts( PtfmRAzi) = m%QD2T(DOF_Y )*R2D
+      m%AllOuts( PtfmRAxi) =  AngAccEX(1)*R2D
+      m%AllOuts( PtfmRAyi) = -AngAccEX(3)*R2D
+      m%AllOuts( PtfmRAzi) =  AngAccEX(2)*R2D
+   END IF
 
 
 
@@ -1163,51 +1176,53 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
       ! Blade Local Span Loads:
 
-   DO K = 1,p%NumBl
-      DO I = 1,p%NBlGages
+   IF ( p%OutBlk(ED_OutBlk_BldSpnLd) ) THEN
+      DO K = 1,p%NumBl
+         DO I = 1,p%NBlGages
 
-      ! Initialize FrcMGagB and MomMGagB using the tip brake effects:
+         ! Initialize FrcMGagB and MomMGagB using the tip brake effects:
 
-         FrcMGagB = m%RtHS%FSTipDrag(:,K) - p%TipMass(K)*( p%Gravity*m%CoordSys%z2 + LinAccES(:,p%TipNode,K) )
-         MomMGagB = CROSS_PRODUCT( m%RtHS%rS0S(:,K,p%TipNode) - m%RtHS%rS0S(:,K,p%BldGagNd(I)), FrcMGagB )
+            FrcMGagB = m%RtHS%FSTipDrag(:,K) - p%TipMass(K)*( p%Gravity*m%CoordSys%z2 + LinAccES(:,p%TipNode,K) )
+            MomMGagB = CROSS_PRODUCT( m%RtHS%rS0S(:,K,p%TipNode) - m%RtHS%rS0S(:,K,p%BldGagNd(I)), FrcMGagB )
 
-      ! Integrate to find FrcMGagB and MomMGagB using all of the nodes / elements above the current strain gage location:
-         DO J = ( p%BldGagNd(I) + 1 ),p%BldNodes ! Loop through blade nodes / elements above strain gage node
+         ! Integrate to find FrcMGagB and MomMGagB using all of the nodes / elements above the current strain gage location:
+            DO J = ( p%BldGagNd(I) + 1 ),p%BldNodes ! Loop through blade nodes / elements above strain gage node
 
-            TmpVec2  = m%RtHS%FSAero(:,K,J) - p%MassB(K,J)*( p%Gravity*m%CoordSys%z2 + LinAccES(:,J,K) )  ! Portion of FrcMGagB associated with element J
-            FrcMGagB = FrcMGagB + TmpVec2*p%DRNodes(J)
+               TmpVec2  = m%RtHS%FSAero(:,K,J) - p%MassB(K,J)*( p%Gravity*m%CoordSys%z2 + LinAccES(:,J,K) )  ! Portion of FrcMGagB associated with element J
+               FrcMGagB = FrcMGagB + TmpVec2*p%DRNodes(J)
 
-            TmpVec = CROSS_PRODUCT( m%RtHS%rS0S(:,K,J) - m%RtHS%rS0S(:,K,p%BldGagNd(I)), TmpVec2 )           ! Portion of MomMGagB associated with element J
-            MomMGagB = MomMGagB + ( TmpVec + m%RtHS%MMAero(:,K,J) )*p%DRNodes(J)
+               TmpVec = CROSS_PRODUCT( m%RtHS%rS0S(:,K,J) - m%RtHS%rS0S(:,K,p%BldGagNd(I)), TmpVec2 )           ! Portion of MomMGagB associated with element J
+               MomMGagB = MomMGagB + ( TmpVec + m%RtHS%MMAero(:,K,J) )*p%DRNodes(J)
 
-         ENDDO ! J - Blade nodes / elements above strain gage node
+            ENDDO ! J - Blade nodes / elements above strain gage node
 
-      ! Add the effects of 1/2 the strain gage element:
-      ! NOTE: for the radius in this calculation, assume that there is no
-      !   shortening effect (due to blade bending) within the element.  Thus,
-      !   the moment arm for the force is 1/4 of p%DRNodes() and the element
-      !   length is 1/2 of p%DRNodes().
+         ! Add the effects of 1/2 the strain gage element:
+         ! NOTE: for the radius in this calculation, assume that there is no
+         !   shortening effect (due to blade bending) within the element.  Thus,
+         !   the moment arm for the force is 1/4 of p%DRNodes() and the element
+         !   length is 1/2 of p%DRNodes().
 
-         TmpVec2  = m%RtHS%FSAero(:,K,p%BldGagNd(I)) - p%MassB(K,p%BldGagNd(I))* ( p%Gravity*m%CoordSys%z2 + LinAccES(:,p%BldGagNd(I),K) ) ! Portion of FrcMGagB associated with 1/2 of the strain gage element
-         FrcMGagB = FrcMGagB + TmpVec2 * 0.5 * p%DRNodes(p%BldGagNd(I))                                                    ! Portion of FrcMGagB associated with 1/2 of the strain gage element
-         FrcMGagB = 0.001*FrcMGagB           ! Convert the local force to kN
+            TmpVec2  = m%RtHS%FSAero(:,K,p%BldGagNd(I)) - p%MassB(K,p%BldGagNd(I))* ( p%Gravity*m%CoordSys%z2 + LinAccES(:,p%BldGagNd(I),K) ) ! Portion of FrcMGagB associated with 1/2 of the strain gage element
+            FrcMGagB = FrcMGagB + TmpVec2 * 0.5 * p%DRNodes(p%BldGagNd(I))                                                    ! Portion of FrcMGagB associated with 1/2 of the strain gage element
+            FrcMGagB = 0.001*FrcMGagB           ! Convert the local force to kN
 
 
-         TmpVec = CROSS_PRODUCT( ( 0.25_R8Ki*p%DRNodes(p%BldGagNd(I)) )*m%CoordSys%j3(K,:), TmpVec2 )                              ! Portion of MomMGagB associated with 1/2 of the strain gage element
+            TmpVec = CROSS_PRODUCT( ( 0.25_R8Ki*p%DRNodes(p%BldGagNd(I)) )*m%CoordSys%j3(K,:), TmpVec2 )                              ! Portion of MomMGagB associated with 1/2 of the strain gage element
 
-         MomMGagB = MomMGagB + ( TmpVec + m%RtHS%MMAero(:,K,p%BldGagNd(I)) )* ( 0.5 *p%DRNodes(p%BldGagNd(I)) )
-         MomMGagB = 0.001*MomMGagB           ! Convert the local moment to kN-m
+            MomMGagB = MomMGagB + ( TmpVec + m%RtHS%MMAero(:,K,p%BldGagNd(I)) )* ( 0.5 *p%DRNodes(p%BldGagNd(I)) )
+            MomMGagB = 0.001*MomMGagB           ! Convert the local moment to kN-m
 
 
-         m%AllOuts(SpnFLxb(I,K)) = DOT_PRODUCT( FrcMGagB, m%CoordSys%n1(K,p%BldGagNd(I),:) )
-         m%AllOuts(SpnFLyb(I,K)) = DOT_PRODUCT( FrcMGagB, m%CoordSys%n2(K,p%BldGagNd(I),:) )
-         m%AllOuts(SpnFLzb(I,K)) = DOT_PRODUCT( FrcMGagB, m%CoordSys%n3(K,p%BldGagNd(I),:) )
+            m%AllOuts(SpnFLxb(I,K)) = DOT_PRODUCT( FrcMGagB, m%CoordSys%n1(K,p%BldGagNd(I),:) )
+            m%AllOuts(SpnFLyb(I,K)) = DOT_PRODUCT( FrcMGagB, m%CoordSys%n2(K,p%BldGagNd(I),:) )
+            m%AllOuts(SpnFLzb(I,K)) = DOT_PRODUCT( FrcMGagB, m%CoordSys%n3(K,p%BldGagNd(I),:) )
 
-         m%AllOuts(SpnMLxb(I,K)) = DOT_PRODUCT( MomMGagB, m%CoordSys%n1(K,p%BldGagNd(I),:) )
-         m%AllOuts(SpnMLyb(I,K)) = DOT_PRODUCT( MomMGagB, m%CoordSys%n2(K,p%BldGagNd(I),:) )
-         m%AllOuts(SpnMLzb(I,K)) = DOT_PRODUCT( MomMGagB, m%CoordSys%n3(K,p%BldGagNd(I),:) )
-      END DO ! I
-   END DO ! K
+            m%AllOuts(SpnMLxb(I,K)) = DOT_PRODUCT( MomMGagB, m%CoordSys%n1(K,p%BldGagNd(I),:) )
+            m%AllOuts(SpnMLyb(I,K)) = DOT_PRODUCT( MomMGagB, m%CoordSys%n2(K,p%BldGagNd(I),:) )
+            m%AllOuts(SpnMLzb(I,K)) = DOT_PRODUCT( MomMGagB, m%CoordSys%n3(K,p%BldGagNd(I),:) )
+         END DO ! I
+      END DO ! K
+   END IF
 
 
 
@@ -1292,12 +1307,14 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
       ! Rotor-Furl Axis Loads:
 
-   m%AllOuts(RFrlBrM  ) =  DOT_PRODUCT( MomNGnRt, m%CoordSys%rfa )
+   IF ( p%OutBlk(ED_OutBlk_Furl) ) THEN
+      m%AllOuts(RFrlBrM  ) =  DOT_PRODUCT( MomNGnRt, m%CoordSys%rfa )
 
 
-      ! Tail-Furl Axis Loads:
+         ! Tail-Furl Axis Loads:
 
-   m%AllOuts(TFrlBrM  ) =  DOT_PRODUCT( MomNTail, m%CoordSys%tfa )
+      m%AllOuts(TFrlBrM  ) =  DOT_PRODUCT( MomNTail, m%CoordSys%tfa )
+   END IF
 
 
       ! Tower-Top / Yaw Bearing Loads:
@@ -1332,49 +1349,51 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
       ! Local Tower Loads:
 
-   FrcONcRt = 1000.0*FrcONcRt ! Convert the units of these forces and moments
-   MomBNcRt = 1000.0*MomBNcRt ! from kN and kN-m back to N and N-m, respectively.
+   IF ( p%OutBlk(ED_OutBlk_TwrLd) ) THEN
+      FrcONcRt = 1000.0*FrcONcRt ! Convert the units of these forces and moments
+      MomBNcRt = 1000.0*MomBNcRt ! from kN and kN-m back to N and N-m, respectively.
 
-   DO I=1,p%NTwGages
+      DO I=1,p%NTwGages
 
-      ! Initialize FrcFGagT and MomFGagT using the tower-top and yaw bearing mass effects:
-      FrcFGagT = FrcONcRt - p%YawBrMass*( p%Gravity*m%CoordSys%z2 + LinAccEO )
-      MomFGagT = CROSS_PRODUCT( m%RtHS%rZO - m%RtHS%rZT(:,p%TwrGagNd(I)), FrcFGagT )
-      MomFGagT = MomFGagT + MomBNcRt
+         ! Initialize FrcFGagT and MomFGagT using the tower-top and yaw bearing mass effects:
+         FrcFGagT = FrcONcRt - p%YawBrMass*( p%Gravity*m%CoordSys%z2 + LinAccEO )
+         MomFGagT = CROSS_PRODUCT( m%RtHS%rZO - m%RtHS%rZT(:,p%TwrGagNd(I)), FrcFGagT )
+         MomFGagT = MomFGagT + MomBNcRt
 
-      ! Integrate to find FrcFGagT and MomFGagT using all of the nodes / elements above the current strain gage location:
-      DO J = ( p%TwrGagNd(I) + 1 ),p%TwrNodes ! Loop through tower nodes / elements above strain gage node
-         TmpVec2  = FTTower(:,J) - p%MassT(J)*( p%Gravity*m%CoordSys%z2 + LinAccET(:,J) )           ! Portion of FrcFGagT associated with element J
-         FrcFGagT = FrcFGagT + TmpVec2*abs(p%DHNodes(J))
+         ! Integrate to find FrcFGagT and MomFGagT using all of the nodes / elements above the current strain gage location:
+         DO J = ( p%TwrGagNd(I) + 1 ),p%TwrNodes ! Loop through tower nodes / elements above strain gage node
+            TmpVec2  = FTTower(:,J) - p%MassT(J)*( p%Gravity*m%CoordSys%z2 + LinAccET(:,J) )           ! Portion of FrcFGagT associated with element J
+            FrcFGagT = FrcFGagT + TmpVec2*abs(p%DHNodes(J))
 
-         TmpVec = CROSS_PRODUCT( m%RtHS%rZT(:,J) - m%RtHS%rZT(:,p%TwrGagNd(I)), TmpVec2 )                          ! Portion of MomFGagT associated with element J
-         MomFGagT = MomFGagT + ( TmpVec + MFHydro(:,J) )*abs(p%DHNodes(J))
-      ENDDO ! J -Tower nodes / elements above strain gage node
+            TmpVec = CROSS_PRODUCT( m%RtHS%rZT(:,J) - m%RtHS%rZT(:,p%TwrGagNd(I)), TmpVec2 )                          ! Portion of MomFGagT associated with element J
+            MomFGagT = MomFGagT + ( TmpVec + MFHydro(:,J) )*abs(p%DHNodes(J))
+         ENDDO ! J -Tower nodes / elements above strain gage node
 
-      ! Add the effects of 1/2 the strain gage element:
-      ! NOTE: for the radius in this calculation, assume that there is no shortening
-      !   effect (due to tower bending) within the element.  Thus, the moment arm
-      !   for the force is 1/4 of DHNodes() and the element length is 1/2 of DHNodes().
+         ! Add the effects of 1/2 the strain gage element:
+         ! NOTE: for the radius in this calculation, assume that there is no shortening
+         !   effect (due to tower bending) within the element.  Thus, the moment arm
+         !   for the force is 1/4 of DHNodes() and the element length is 1/2 of DHNodes().
 
-      TmpVec2  = FTTower(:,p%TwrGagNd(I)) - p%MassT(p%TwrGagNd(I))*( p%Gravity*m%CoordSys%z2 + LinAccET(:,p%TwrGagNd(I)))
+         TmpVec2  = FTTower(:,p%TwrGagNd(I)) - p%MassT(p%TwrGagNd(I))*( p%Gravity*m%CoordSys%z2 + LinAccET(:,p%TwrGagNd(I)))
 
-      FrcFGagT = FrcFGagT + TmpVec2 * 0.5 * abs(p%DHNodes(p%TwrGagNd(I)))
-      FrcFGagT = 0.001*FrcFGagT  ! Convert the local force to kN
+         FrcFGagT = FrcFGagT + TmpVec2 * 0.5 * abs(p%DHNodes(p%TwrGagNd(I)))
+         FrcFGagT = 0.001*FrcFGagT  ! Convert the local force to kN
 
-      TmpVec = CROSS_PRODUCT( ( 0.25_R8Ki*p%DHNodes( p%TwrGagNd(I)) )*m%CoordSys%a2, TmpVec2 )              ! Portion of MomFGagT associated with 1/2 of the strain gage element
-      TmpVec   = TmpVec   + MFHydro(:,p%TwrGagNd(I))
-      MomFGagT = MomFGagT + TmpVec * 0.5 * abs(p%DHNodes(p%TwrGagNd(I)))
-      MomFGagT = 0.001*MomFGagT  ! Convert the local moment to kN-m
+         TmpVec = CROSS_PRODUCT( ( 0.25_R8Ki*p%DHNodes( p%TwrGagNd(I)) )*m%CoordSys%a2, TmpVec2 )              ! Portion of MomFGagT associated with 1/2 of the strain gage element
+         TmpVec   = TmpVec   + MFHydro(:,p%TwrGagNd(I))
+         MomFGagT = MomFGagT + TmpVec * 0.5 * abs(p%DHNodes(p%TwrGagNd(I)))
+         MomFGagT = 0.001*MomFGagT  ! Convert the local moment to kN-m
 
-      m%AllOuts( TwHtFLxt(I) ) =     DOT_PRODUCT( FrcFGagT, m%CoordSys%t1(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtFLyt(I) ) = -1.*DOT_PRODUCT( FrcFGagT, m%CoordSys%t3(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtFLzt(I) ) =     DOT_PRODUCT( FrcFGagT, m%CoordSys%t2(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtFLxt(I) ) =     DOT_PRODUCT( FrcFGagT, m%CoordSys%t1(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtFLyt(I) ) = -1.*DOT_PRODUCT( FrcFGagT, m%CoordSys%t3(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtFLzt(I) ) =     DOT_PRODUCT( FrcFGagT, m%CoordSys%t2(p%TwrGagNd(I),:) )
 
-      m%AllOuts( TwHtMLxt(I) ) =     DOT_PRODUCT( MomFGagT, m%CoordSys%t1(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtMLyt(I) ) = -1.*DOT_PRODUCT( MomFGagT, m%CoordSys%t3(p%TwrGagNd(I),:) )
-      m%AllOuts( TwHtMLzt(I) ) =     DOT_PRODUCT( MomFGagT, m%CoordSys%t2(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtMLxt(I) ) =     DOT_PRODUCT( MomFGagT, m%CoordSys%t1(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtMLyt(I) ) = -1.*DOT_PRODUCT( MomFGagT, m%CoordSys%t3(p%TwrGagNd(I),:) )
+         m%AllOuts( TwHtMLzt(I) ) =     DOT_PRODUCT( MomFGagT, m%CoordSys%t2(p%TwrGagNd(I),:) )
 
-   END DO
+      END DO
+   END IF
 
 
    !   ! Platform Loads:
@@ -1395,96 +1414,98 @@ SUBROUTINE ED_CalcOutput( t, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 
       ! Internal p%DOFs outputs:
 
-   m%AllOuts( Q_B1E1   ) = x%QT(   DOF_BE(1,1) )
-   m%AllOuts( Q_B1F1   ) = x%QT(   DOF_BF(1,1) )
-   m%AllOuts( Q_B1F2   ) = x%QT(   DOF_BF(1,2) )
-   m%AllOuts( Q_DrTr   ) = x%QT(   DOF_DrTr    )
-   m%AllOuts( Q_GeAz   ) = x%QT(   DOF_GeAz    )
-   m%AllOuts( Q_RFrl   ) = x%QT(   DOF_RFrl    )
-   m%AllOuts( Q_TFrl   ) = x%QT(   DOF_TFrl    )
-   m%AllOuts( Q_Yaw    ) = x%QT(   DOF_Yaw     )
-   m%AllOuts( Q_TFA1   ) = x%QT(   DOF_TFA1    )
-   m%AllOuts( Q_TSS1   ) = x%QT(   DOF_TSS1    )
-   m%AllOuts( Q_TFA2   ) = x%QT(   DOF_TFA2    )
-   m%AllOuts( Q_TSS2   ) = x%QT(   DOF_TSS2    )
-   m%AllOuts( Q_Sg     ) = x%QT(   DOF_Sg      )
-   m%AllOuts( Q_Sw     ) = x%QT(   DOF_Sw      )
-   m%AllOuts( Q_Hv     ) = x%QT(   DOF_Hv      )
-   m%AllOuts( Q_R      ) = x%QT(   DOF_R       )
-   m%AllOuts( Q_P      ) = x%QT(   DOF_P       )
-   m%AllOuts( Q_Y      ) = x%QT(   DOF_Y       )
-
-   m%AllOuts( QD_B1E1  ) = x%QDT(  DOF_BE(1,1) )
-   m%AllOuts( QD_B1F1  ) = x%QDT(  DOF_BF(1,1) )
-   m%AllOuts( QD_B1F2  ) = x%QDT(  DOF_BF(1,2) )
-   m%AllOuts( QD_DrTr  ) = x%QDT(  DOF_DrTr    )
-   m%AllOuts( QD_GeAz  ) = x%QDT(  DOF_GeAz    )
-   m%AllOuts( QD_RFrl  ) = x%QDT(  DOF_RFrl    )
-   m%AllOuts( QD_TFrl  ) = x%QDT(  DOF_TFrl    )
-   m%AllOuts( QD_Yaw   ) = x%QDT(  DOF_Yaw     )
-   m%AllOuts( QD_TFA1  ) = x%QDT(  DOF_TFA1    )
-   m%AllOuts( QD_TSS1  ) = x%QDT(  DOF_TSS1    )
-   m%AllOuts( QD_TFA2  ) = x%QDT(  DOF_TFA2    )
-   m%AllOuts( QD_TSS2  ) = x%QDT(  DOF_TSS2    )
-   m%AllOuts( QD_Sg    ) = x%QDT(  DOF_Sg      )
-   m%AllOuts( QD_Sw    ) = x%QDT(  DOF_Sw      )
-   m%AllOuts( QD_Hv    ) = x%QDT(  DOF_Hv      )
-   m%AllOuts( QD_R     ) = x%QDT(  DOF_R       )
-   m%AllOuts( QD_P     ) = x%QDT(  DOF_P       )
-   m%AllOuts( QD_Y     ) = x%QDT(  DOF_Y       )
-
-   m%AllOuts( QD2_B1E1 ) = m%QD2T( DOF_BE(1,1) )
-   m%AllOuts( QD2_B1F1 ) = m%QD2T( DOF_BF(1,1) )
-   m%AllOuts( QD2_B1F2 ) = m%QD2T( DOF_BF(1,2) )
-   m%AllOuts( QD2_DrTr ) = m%QD2T( DOF_DrTr    )
-   m%AllOuts( QD2_GeAz ) = m%QD2T( DOF_GeAz    )
-   m%AllOuts( QD2_RFrl ) = m%QD2T( DOF_RFrl    )
-   m%AllOuts( QD2_TFrl ) = m%QD2T( DOF_TFrl    )
-   m%AllOuts( QD2_Yaw  ) = m%QD2T( DOF_Yaw     )
-   m%AllOuts( QD2_TFA1 ) = m%QD2T( DOF_TFA1    )
-   m%AllOuts( QD2_TSS1 ) = m%QD2T( DOF_TSS1    )
-   m%AllOuts( QD2_TFA2 ) = m%QD2T( DOF_TFA2    )
-   m%AllOuts( QD2_TSS2 ) = m%QD2T( DOF_TSS2    )
-   m%AllOuts( QD2_Sg   ) = m%QD2T( DOF_Sg      )
-   m%AllOuts( QD2_Sw   ) = m%QD2T( DOF_Sw      )
-   m%AllOuts( QD2_Hv   ) = m%QD2T( DOF_Hv      )
-   m%AllOuts( QD2_R    ) = m%QD2T( DOF_R       )
-   m%AllOuts( QD2_P    ) = m%QD2T( DOF_P       )
-   m%AllOuts( QD2_Y    ) = m%QD2T( DOF_Y       )
-
-IF ( p%NumBl > 1 ) THEN
-
-   m%AllOuts( Q_B2E1   ) = x%QT(   DOF_BE(2,1) )
-   m%AllOuts( Q_B2F1   ) = x%QT(   DOF_BF(2,1) )
-   m%AllOuts( Q_B2F2   ) = x%QT(   DOF_BF(2,2) )
-      
-   m%AllOuts( QD_B2E1  ) = x%QDT(  DOF_BE(2,1) )
-   m%AllOuts( QD_B2F1  ) = x%QDT(  DOF_BF(2,1) )
-   m%AllOuts( QD_B2F2  ) = x%QDT(  DOF_BF(2,2) )
-
-   m%AllOuts( QD2_B2E1 ) = m%QD2T( DOF_BE(2,1) )
-   m%AllOuts( QD2_B2F1 ) = m%QD2T( DOF_BF(2,1) )
-   m%AllOuts( QD2_B2F2 ) = m%QD2T( DOF_BF(2,2) )
-   
-   IF ( p%NumBl > 2 ) THEN
-      m%AllOuts( Q_B3E1   ) = x%QT(   DOF_BE(3,1) )
-      m%AllOuts( Q_B3F1   ) = x%QT(   DOF_BF(3,1) )
-      m%AllOuts( Q_B3F2   ) = x%QT(   DOF_BF(3,2) )
-
-      m%AllOuts( QD_B3E1  ) = x%QDT(  DOF_BE(3,1) )
-      m%AllOuts( QD_B3F1  ) = x%QDT(  DOF_BF(3,1) )
-      m%AllOuts( QD_B3F2  ) = x%QDT(  DOF_BF(3,2) )
-
-      m%AllOuts( QD2_B3E1 ) = m%QD2T( DOF_BE(3,1) )
-      m%AllOuts( QD2_B3F1 ) = m%QD2T( DOF_BF(3,1) )
-      m%AllOuts( QD2_B3F2 ) = m%QD2T( DOF_BF(3,2) )
-   ELSE
-      m%AllOuts( Q_Teet   ) = x%QT(   DOF_Teet    )
-      m%AllOuts( QD_Teet  ) = x%QDT(  DOF_Teet    )
-      m%AllOuts( QD2_Teet ) = m%QD2T( DOF_Teet    )
-   END IF
+   IF ( p%OutBlk(ED_OutBlk_DOFs) ) THEN
+      m%AllOuts( Q_B1E1   ) = x%QT(   DOF_BE(1,1) )
+      m%AllOuts( Q_B1F1   ) = x%QT(   DOF_BF(1,1) )
+      m%AllOuts( Q_B1F2   ) = x%QT(   DOF_BF(1,2) )
+      m%AllOuts( Q_DrTr   ) = x%QT(   DOF_DrTr    )
+      m%AllOuts( Q_GeAz   ) = x%QT(   DOF_GeAz    )
+      m%AllOuts( Q_RFrl   ) = x%QT(   DOF_RFrl    )
+      m%AllOuts( Q_TFrl   ) = x%QT(   DOF_TFrl    )
+      m%AllOuts( Q_Yaw    ) = x%QT(   DOF_Yaw     )
+      m%AllOuts( Q_TFA1   ) = x%QT(   DOF_TFA1    )
+      m%AllOuts( Q_TSS1   ) = x%QT(   DOF_TSS1    )
+      m%AllOuts( Q_TFA2   ) = x%QT(   DOF_TFA2    )
+      m%AllOuts( Q_TSS2   ) = x%QT(   DOF_TSS2    )
+      m%AllOuts( Q_Sg     ) = x%QT(   DOF_Sg      )
+      m%AllOuts( Q_Sw     ) = x%QT(   DOF_Sw      )
+      m%AllOuts( Q_Hv     ) = x%QT(   DOF_Hv      )
+      m%AllOuts( Q_R      ) = x%QT(   DOF_R       )
+      m%AllOuts( Q_P      ) = x%QT(   DOF_P       )
+      m%AllOuts( Q_Y      ) = x%QT(   DOF_Y       )
+
+      m%AllOuts( QD_B1E1  ) = x%QDT(  DOF_BE(1,1) )
+      m%AllOuts( QD_B1F1  ) = x%QDT(  DOF_BF(1,1) )
+      m%AllOuts( QD_B1F2  ) = x%QDT(  DOF_BF(1,2) )
+      m%AllOuts( QD_DrTr  ) = x%QDT(  DOF_DrTr    )
+      m%AllOuts( QD_GeAz  ) = x%QDT(  DOF_GeAz    )
+      m%AllOuts( QD_RFrl  ) = x%QDT(  DOF_RFrl    )
+      m%AllOuts( QD_TFrl  ) = x%QDT(  DOF_TFrl    )
+      m%AllOuts( QD_Yaw   ) = x%QDT(  DOF_Yaw     )
+      m%AllOuts( QD_TFA1  ) = x%QDT(  DOF_TFA1    )
+      m%AllOuts( QD_TSS1  ) = x%QDT(  DOF_TSS1    )
+      m%AllOuts( QD_TFA2  ) = x%QDT(  DOF_TFA2    )
+      m%AllOuts( QD_TSS2  ) = x%QDT(  DOF_TSS2    )
+      m%AllOuts( QD_Sg    ) = x%QDT(  DOF_Sg      )
+      m%AllOuts( QD_Sw    ) = x%QDT(  DOF_Sw      )
+      m%AllOuts( QD_Hv    ) = x%QDT(  DOF_Hv      )
+      m%AllOuts( QD_R     ) = x%QDT(  DOF_R       )
+      m%AllOuts( QD_P     ) = x%QDT(  DOF_P       )
+      m%AllOuts( QD_Y     ) = x%QDT(  DOF_Y       )
+
+      m%AllOuts( QD2_B1E1 ) = m%QD2T( DOF_BE(1,1) )
+      m%AllOuts( QD2_B1F1 ) = m%QD2T( DOF_BF(1,1) )
+      m%AllOuts( QD2_B1F2 ) = m%QD2T( DOF_BF(1,2) )
+      m%AllOuts( QD2_DrTr ) = m%QD2T( DOF_DrTr    )
+      m%AllOuts( QD2_GeAz ) = m%QD2T( DOF_GeAz    )
+      m%AllOuts( QD2_RFrl ) = m%QD2T( DOF_RFrl    )
+      m%AllOuts( QD2_TFrl ) = m%QD2T( DOF_TFrl    )
+      m%AllOuts( QD2_Yaw  ) = m%QD2T( DOF_Yaw     )
+      m%AllOuts( QD2_TFA1 ) = m%QD2T( DOF_TFA1    )
+      m%AllOuts( QD2_TSS1 ) = m%QD2T( DOF_TSS1    )
+      m%AllOuts( QD2_TFA2 ) = m%QD2T( DOF_TFA2    )
+      m%AllOuts( QD2_TSS2 ) = m%QD2T( DOF_TSS2    )
+      m%AllOuts( QD2_Sg   ) = m%QD2T( DOF_Sg      )
+      m%AllOuts( QD2_Sw   ) = m%QD2T( DOF_Sw      )
+      m%AllOuts( QD2_Hv   ) = m%QD2T( DOF_Hv      )
+      m%AllOuts( QD2_R    ) = m%QD2T( DOF_R       )
+      m%AllOuts( QD2_P    ) = m%QD2T( DOF_P       )
+      m%AllOuts( QD2_Y    ) = m%QD2T( DOF_Y       )
+
+   IF ( p%NumBl > 1 ) THEN
+
+      m%AllOuts( Q_B2E1   ) = x%QT(   DOF_BE(2,1) )
+      m%AllOuts( Q_B2F1   ) = x%QT(   DOF_BF(2,1) )
+      m%AllOuts( Q_B2F2   ) = x%QT(   DOF_BF(2,2) )
+      
+      m%AllOuts( QD_B2E1  ) = x%QDT(  DOF_BE(2,1) )
+      m%AllOuts( QD_B2F1  ) = x%QDT(  DOF_BF(2,1) )
+      m%AllOuts( QD_B2F2  ) = x%QDT(  DOF_BF(2,2) )
+
+      m%AllOuts( QD2_B2E1 ) = m%QD2T( DOF_BE(2,1) )
+      m%AllOuts( QD2_B2F1 ) = m%QD2T( DOF_BF(2,1) )
+      m%AllOuts( QD2_B2F2 ) = m%QD2T( DOF_BF(2,2) )
+   
+      IF ( p%NumBl > 2 ) THEN
+         m%AllOuts( Q_B3E1   ) = x%QT(   DOF_BE(3,1) )
+         m%AllOuts( Q_B3F1   ) = x%QT(   DOF_BF(3,1) )
+         m%AllOuts( Q_B3F2   ) = x%QT(   DOF_BF(3,2) )
+
+         m%AllOuts( QD_B3E1  ) = x%QDT(  DOF_BE(3,1) )
+         m%AllOuts( QD_B3F1  ) = x%QDT(  DOF_BF(3,1) )
+         m%AllOuts( QD_B3F2  ) = x%QDT(  DOF_BF(3,2) )
+
+         m%AllOuts( QD2_B3E1 ) = m%QD2T( DOF_BE(3,1) )
+         m%AllOuts( QD2_B3F1 ) = m%QD2T( DOF_BF(3,1) )
+         m%AllOuts( QD2_B3F2 ) = m%QD2T( DOF_BF(3,2) )
+      ELSE
+         m%AllOuts( Q_Teet   ) = x%QT(   DOF_Teet    )
+         m%AllOuts( QD_Teet  ) = x%QDT(  DOF_Teet    )
+         m%AllOuts( QD2_Teet ) = m%QD2T( DOF_Teet    )
+      END IF
       
-END IF
+   END IF
+   END IF
 
    !...............................................................................................................................
    ! Place the selected output channels into the WriteOutput(:) array with the proper sign:
@@ -4635,6 +4656,33 @@ end if
    
    END DO
    
+
+      ! Flag the blocks of output channels that are requested, so that ED_CalcOutput() can skip the others.
+      ! Channels that are not in one of these blocks are always computed (some of them are also used to set the module outputs).
+      ! NOTE: the blocks are ranges of contiguous channel indices, in the order stored in "OutListParameters.xlsx"
+
+   p%OutBlk = .FALSE.
+   DO I = 1,p%NumOuts
+      SELECT CASE ( p%OutParam(I)%Indx )
+      CASE ( TipDxc1   : Spn1ALxb1-1 )
+         p%OutBlk(ED_OutBlk_BldTip   ) = .TRUE.
+      CASE ( Spn1ALxb1 : PtchPMzc1-1 )
+         p%OutBlk(ED_OutBlk_BldSpnMot) = .TRUE.
+      CASE ( RotFurlP  : YawPzn-1, RFrlBrM : YawBrFxn-1 )
+         p%OutBlk(ED_OutBlk_Furl     ) = .TRUE.
+      CASE ( TwHt1ALxt : PtfmTDxt-1 )
+         p%OutBlk(ED_OutBlk_TwrMot   ) = .TRUE.
+      CASE ( PtfmTDxt  : RootFxc1-1 )
+         p%OutBlk(ED_OutBlk_PtfmMot  ) = .TRUE.
+      CASE ( Spn1MLxb1 : LSShftFxa-1 )
+         p%OutBlk(ED_OutBlk_BldSpnLd ) = .TRUE.
+      CASE ( TwHt1MLxt : Q_B1E1-1 )
+         p%OutBlk(ED_OutBlk_TwrLd    ) = .TRUE.
+      CASE ( Q_B1E1    : MaxOutPts )
+         p%OutBlk(ED_OutBlk_DOFs     ) = .TRUE.
+      END SELECT
+   END DO
+   
    RETURN
 END SUBROUTINE SetOutParam
 !----------------------------------------------------------------------------------------------------------------------------------
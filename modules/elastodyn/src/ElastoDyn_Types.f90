@@ -35,6 +35,15 @@ USE NWTC_Library
 IMPLICIT NONE
     INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_NMX                           = 4      ! Used in updating predictor-corrector values (size of state history) [-]
     INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_u_BlPitchComC                 = -1      ! DatLoc number for collective blade pitch extended input [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_OutBlk_BldTip                 = 1      ! Output block: blade tip motions [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_OutBlk_BldSpnMot              = 2      ! Output block: blade local span motions [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_OutBlk_Furl                   = 3      ! Output block: rotor-furl and tail-furl motions and bearing loads [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_OutBlk_TwrMot                 = 4      ! Output block: local tower motions [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_OutBlk_PtfmMot                = 5      ! Output block: platform motions [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_OutBlk_BldSpnLd               = 6      ! Output block: blade local span loads [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_OutBlk_TwrLd                  = 7      ! Output block: local tower loads [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_OutBlk_DOFs                   = 8      ! Output block: internal degrees of freedom [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: ED_NumOutBlks                    = 8      ! Number of blocks of output channels that are only computed when requested [-]
 ! =========  ED_InitInputType  =======
   TYPE, PUBLIC :: ED_InitInputType
     CHARACTER(1024)  :: InputFile      !< Name of the input file [-]
@@ -567,6 +576,7 @@ IMPLICIT NONE
     INTEGER(IntKi)  :: NBlGages = 0      !< Number of blade strain gages [-]
     INTEGER(IntKi)  :: NTwGages = 0      !< Number of tower strain gages [-]
     TYPE(OutParmType) , DIMENSION(:), ALLOCATABLE  :: OutParam      !< Names and units (and other characteristics) of all requested output parameters [-]
+    LOGICAL , DIMENSION(1:ED_NumOutBlks)  :: OutBlk = .TRUE.      !< Flags for the blocks of output channels that must be computed in ED_CalcOutput (at least one of their channels is requested) [-]
     CHARACTER(1)  :: Delim      !< Column delimiter for output text files [-]
     REAL(ReKi)  :: AvgNrmTpRd = 0.0_ReKi      !< Average tip radius normal to the shaft [meters]
     REAL(R8Ki)  :: AzimB1Up = 0.0_R8Ki      !< Azimuth value to use for I/O when blade 1 points up [radians]
@@ -4596,6 +4606,24 @@ subroutine ED_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSta
    end if
 end subroutine
 
+subroutine ED_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(ED_ContinuousStateType), intent(inout) :: ContStateData1
+   type(ED_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki), allocatable :: tmp_QT(:)
+   REAL(R8Ki), allocatable :: tmp_QDT(:)
+   character(*), parameter        :: RoutineName = 'ED_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%QT, tmp_QT)
+   call move_alloc(ContStateData2%QT, ContStateData1%QT)
+   call move_alloc(tmp_QT, ContStateData2%QT)
+   call move_alloc(ContStateData1%QDT, tmp_QDT)
+   call move_alloc(ContStateData2%QDT, ContStateData1%QDT)
+   call move_alloc(tmp_QDT, ContStateData2%QDT)
+end subroutine
+
 subroutine ED_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(ED_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4645,6 +4673,20 @@ subroutine ED_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSta
    DstDiscStateData%DummyDiscState = SrcDiscStateData%DummyDiscState
 end subroutine
 
+subroutine ED_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(ED_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(ED_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyDiscState
+   character(*), parameter        :: RoutineName = 'ED_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscState = DiscStateData1%DummyDiscState
+   DiscStateData1%DummyDiscState = DiscStateData2%DummyDiscState
+   DiscStateData2%DummyDiscState = tmp_DummyDiscState
+end subroutine
+
 subroutine ED_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(ED_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4683,6 +4725,20 @@ subroutine ED_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine ED_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(ED_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(ED_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'ED_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine ED_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(ED_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4752,6 +4808,67 @@ subroutine ED_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Err
    DstOtherStateData%OmegaDotTn = SrcOtherStateData%OmegaDotTn
 end subroutine
 
+subroutine ED_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(ED_OtherStateType), intent(inout) :: OtherStateData1
+   type(ED_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   INTEGER(IntKi) :: tmp_n
+   INTEGER(IntKi), allocatable :: tmp_IC(:)
+   REAL(ReKi) :: tmp_HSSBrTrq
+   REAL(ReKi) :: tmp_HSSBrTrqC
+   INTEGER(IntKi) :: tmp_SgnPrvLSTQ
+   INTEGER(IntKi) :: tmp_SgnLSTQ(1:ED_NMX)
+   REAL(ReKi) :: tmp_Mfhat
+   REAL(ReKi) :: tmp_YawFriMfp
+   REAL(R8Ki) :: tmp_OmegaTn
+   REAL(R8Ki) :: tmp_OmegaDotTn
+   character(*), parameter        :: RoutineName = 'ED_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_n = OtherStateData1%n
+   OtherStateData1%n = OtherStateData2%n
+   OtherStateData2%n = tmp_n
+   LB(1:1) = lbound(OtherStateData1%xdot)
+   UB(1:1) = ubound(OtherStateData1%xdot)
+   do i1 = LB(1), UB(1)
+      call ED_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      if (ErrStat >= AbortErrLev) return
+   end do
+   call move_alloc(OtherStateData1%IC, tmp_IC)
+   call move_alloc(OtherStateData2%IC, OtherStateData1%IC)
+   call move_alloc(tmp_IC, OtherStateData2%IC)
+   tmp_HSSBrTrq = OtherStateData1%HSSBrTrq
+   OtherStateData1%HSSBrTrq = OtherStateData2%HSSBrTrq
+   OtherStateData2%HSSBrTrq = tmp_HSSBrTrq
+   tmp_HSSBrTrqC = OtherStateData1%HSSBrTrqC
+   OtherStateData1%HSSBrTrqC = OtherStateData2%HSSBrTrqC
+   OtherStateData2%HSSBrTrqC = tmp_HSSBrTrqC
+   tmp_SgnPrvLSTQ = OtherStateData1%SgnPrvLSTQ
+   OtherStateData1%SgnPrvLSTQ = OtherStateData2%SgnPrvLSTQ
+   OtherStateData2%SgnPrvLSTQ = tmp_SgnPrvLSTQ
+   tmp_SgnLSTQ = OtherStateData1%SgnLSTQ
+   OtherStateData1%SgnLSTQ = OtherStateData2%SgnLSTQ
+   OtherStateData2%SgnLSTQ = tmp_SgnLSTQ
+   tmp_Mfhat = OtherStateData1%Mfhat
+   OtherStateData1%Mfhat = OtherStateData2%Mfhat
+   OtherStateData2%Mfhat = tmp_Mfhat
+   tmp_YawFriMfp = OtherStateData1%YawFriMfp
+   OtherStateData1%YawFriMfp = OtherStateData2%YawFriMfp
+   OtherStateData2%YawFriMfp = tmp_YawFriMfp
+   tmp_OmegaTn = OtherStateData1%OmegaTn
+   OtherStateData1%OmegaTn = OtherStateData2%OmegaTn
+   OtherStateData2%OmegaTn = tmp_OmegaTn
+   tmp_OmegaDotTn = OtherStateData1%OmegaDotTn
+   OtherStateData1%OmegaDotTn = OtherStateData2%OmegaDotTn
+   OtherStateData2%OmegaDotTn = tmp_OmegaDotTn
+end subroutine
+
 subroutine ED_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(ED_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4918,6 +5035,7 @@ subroutine ED_CopyParam(SrcParamData, DstParamData, CtrlCode, ErrStat, ErrMsg)
          if (ErrStat >= AbortErrLev) return
       end do
    end if
+   DstParamData%OutBlk = SrcParamData%OutBlk
    DstParamData%Delim = SrcParamData%Delim
    DstParamData%AvgNrmTpRd = SrcParamData%AvgNrmTpRd
    DstParamData%AzimB1Up = SrcParamData%AzimB1Up
@@ -5883,6 +6001,7 @@ subroutine ED_PackParam(RF, Indata)
          call NWTC_Library_PackOutParmType(RF, InData%OutParam(i1)) 
       end do
    end if
+   call RegPack(RF, InData%OutBlk)
    call RegPack(RF, InData%Delim)
    call RegPack(RF, InData%AvgNrmTpRd)
    call RegPack(RF, InData%AzimB1Up)
@@ -6145,6 +6264,7 @@ subroutine ED_UnPackParam(RF, OutData)
          call NWTC_Library_UnpackOutParmType(RF, OutData%OutParam(i1)) ! OutParam 
       end do
    end if
+   call RegUnpack(RF, OutData%OutBlk); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%Delim); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%AvgNrmTpRd); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%AzimB1Up); if (RegCheckErr(RF, RoutineName)) return
@@ -6472,6 +6592,97 @@ subroutine ED_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    DstInputData%HSSBrTrqC = SrcInputData%HSSBrTrqC
 end subroutine
 
+subroutine ED_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(ED_InputType), intent(inout) :: InputData1
+   type(ED_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2, i3
+   integer(B4Ki)                  :: LB(3), UB(3)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_TwrAddedMass(:,:,:)
+   REAL(ReKi) :: tmp_PtfmAddedMass(1:6,1:6)
+   REAL(ReKi), allocatable :: tmp_BlPitchCom(:)
+   REAL(ReKi), allocatable :: tmp_BlPitchMom(:)
+   REAL(ReKi) :: tmp_YawMom
+   REAL(ReKi) :: tmp_GenTrq
+   REAL(ReKi) :: tmp_HSSBrTrqC
+   character(*), parameter        :: RoutineName = 'ED_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(InputData1%BladePtLoads) .neqv. allocated(InputData2%BladePtLoads)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladePtLoads with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%BladePtLoads)) then
+      if (any(lbound(InputData1%BladePtLoads) /= lbound(InputData2%BladePtLoads)) .or. any(ubound(InputData1%BladePtLoads) /= ubound(InputData2%BladePtLoads))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladePtLoads with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%BladePtLoads)
+      UB(1:1) = ubound(InputData1%BladePtLoads)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%BladePtLoads(i1), InputData2%BladePtLoads(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call MeshSwap(InputData1%PlatformPtMesh, InputData2%PlatformPtMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%TowerPtLoads, InputData2%TowerPtLoads, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   if (allocated(InputData1%BladeRootLoads) .neqv. allocated(InputData2%BladeRootLoads)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladeRootLoads with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%BladeRootLoads)) then
+      if (any(lbound(InputData1%BladeRootLoads) /= lbound(InputData2%BladeRootLoads)) .or. any(ubound(InputData1%BladeRootLoads) /= ubound(InputData2%BladeRootLoads))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladeRootLoads with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%BladeRootLoads)
+      UB(1:1) = ubound(InputData1%BladeRootLoads)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%BladeRootLoads(i1), InputData2%BladeRootLoads(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call MeshSwap(InputData1%HubPtLoad, InputData2%HubPtLoad, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%NacelleLoads, InputData2%NacelleLoads, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%TFinCMLoads, InputData2%TFinCMLoads, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call move_alloc(InputData1%TwrAddedMass, tmp_TwrAddedMass)
+   call move_alloc(InputData2%TwrAddedMass, InputData1%TwrAddedMass)
+   call move_alloc(tmp_TwrAddedMass, InputData2%TwrAddedMass)
+   tmp_PtfmAddedMass = InputData1%PtfmAddedMass
+   InputData1%PtfmAddedMass = InputData2%PtfmAddedMass
+   InputData2%PtfmAddedMass = tmp_PtfmAddedMass
+   call move_alloc(InputData1%BlPitchCom, tmp_BlPitchCom)
+   call move_alloc(InputData2%BlPitchCom, InputData1%BlPitchCom)
+   call move_alloc(tmp_BlPitchCom, InputData2%BlPitchCom)
+   call move_alloc(InputData1%BlPitchMom, tmp_BlPitchMom)
+   call move_alloc(InputData2%BlPitchMom, InputData1%BlPitchMom)
+   call move_alloc(tmp_BlPitchMom, InputData2%BlPitchMom)
+   tmp_YawMom = InputData1%YawMom
+   InputData1%YawMom = InputData2%YawMom
+   InputData2%YawMom = tmp_YawMom
+   tmp_GenTrq = InputData1%GenTrq
+   InputData1%GenTrq = InputData2%GenTrq
+   InputData2%GenTrq = tmp_GenTrq
+   tmp_HSSBrTrqC = InputData1%HSSBrTrqC
+   InputData1%HSSBrTrqC = InputData2%HSSBrTrqC
+   InputData2%HSSBrTrqC = tmp_HSSBrTrqC
+end subroutine
+
 subroutine ED_DestroyInput(InputData, ErrStat, ErrMsg)
    type(ED_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
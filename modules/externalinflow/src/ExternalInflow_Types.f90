@@ -1442,6 +1442,88 @@ subroutine ExtInfw_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrM
    end if
 end subroutine
 
+subroutine ExtInfw_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(ExtInfw_InputType), intent(inout) :: InputData1
+   type(ExtInfw_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(KIND=C_FLOAT), pointer :: tmp_pxVel(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_pyVel(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_pzVel(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_pxForce(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_pyForce(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_pzForce(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_xdotForce(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_ydotForce(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_zdotForce(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_pOrientation(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_fx(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_fy(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_fz(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_momentx(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_momenty(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_momentz(:)
+   REAL(KIND=C_FLOAT), pointer :: tmp_forceNodesChord(:)
+   type(ExtInfw_InputType_C) :: tmp_C_obj
+   character(*), parameter        :: RoutineName = 'ExtInfw_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_pxVel => InputData1%pxVel
+   InputData1%pxVel => InputData2%pxVel
+   InputData2%pxVel => tmp_pxVel
+   tmp_pyVel => InputData1%pyVel
+   InputData1%pyVel => InputData2%pyVel
+   InputData2%pyVel => tmp_pyVel
+   tmp_pzVel => InputData1%pzVel
+   InputData1%pzVel => InputData2%pzVel
+   InputData2%pzVel => tmp_pzVel
+   tmp_pxForce => InputData1%pxForce
+   InputData1%pxForce => InputData2%pxForce
+   InputData2%pxForce => tmp_pxForce
+   tmp_pyForce => InputData1%pyForce
+   InputData1%pyForce => InputData2%pyForce
+   InputData2%pyForce => tmp_pyForce
+   tmp_pzForce => InputData1%pzForce
+   InputData1%pzForce => InputData2%pzForce
+   InputData2%pzForce => tmp_pzForce
+   tmp_xdotForce => InputData1%xdotForce
+   InputData1%xdotForce => InputData2%xdotForce
+   InputData2%xdotForce => tmp_xdotForce
+   tmp_ydotForce => InputData1%ydotForce
+   InputData1%ydotForce => InputData2%ydotForce
+   InputData2%ydotForce => tmp_ydotForce
+   tmp_zdotForce => InputData1%zdotForce
+   InputData1%zdotForce => InputData2%zdotForce
+   InputData2%zdotForce => tmp_zdotForce
+   tmp_pOrientation => InputData1%pOrientation
+   InputData1%pOrientation => InputData2%pOrientation
+   InputData2%pOrientation => tmp_pOrientation
+   tmp_fx => InputData1%fx
+   InputData1%fx => InputData2%fx
+   InputData2%fx => tmp_fx
+   tmp_fy => InputData1%fy
+   InputData1%fy => InputData2%fy
+   InputData2%fy => tmp_fy
+   tmp_fz => InputData1%fz
+   InputData1%fz => InputData2%fz
+   InputData2%fz => tmp_fz
+   tmp_momentx => InputData1%momentx
+   InputData1%momentx => InputData2%momentx
+   InputData2%momentx => tmp_momentx
+   tmp_momenty => InputData1%momenty
+   InputData1%momenty => InputData2%momenty
+   InputData2%momenty => tmp_momenty
+   tmp_momentz => InputData1%momentz
+   InputData1%momentz => InputData2%momentz
+   InputData2%momentz => tmp_momentz
+   tmp_forceNodesChord => InputData1%forceNodesChord
+   InputData1%forceNodesChord => InputData2%forceNodesChord
+   InputData2%forceNodesChord => tmp_forceNodesChord
+   tmp_C_obj = InputData1%C_obj
+   InputData1%C_obj = InputData2%C_obj
+   InputData2%C_obj = tmp_C_obj
+end subroutine
+
 subroutine ExtInfw_DestroyInput(InputData, ErrStat, ErrMsg)
    type(ExtInfw_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -231,6 +231,44 @@ subroutine ExtLdDX_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrM
    end if
 end subroutine
 
+subroutine ExtLdDX_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(ExtLdDX_InputType), intent(inout) :: InputData1
+   type(ExtLdDX_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(KIND=C_DOUBLE), pointer :: tmp_twrDef(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_bldDef(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_hubDef(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_nacDef(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_bldRootDef(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_bldPitch(:)
+   type(ExtLdDX_InputType_C) :: tmp_C_obj
+   character(*), parameter        :: RoutineName = 'ExtLdDX_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_twrDef => InputData1%twrDef
+   InputData1%twrDef => InputData2%twrDef
+   InputData2%twrDef => tmp_twrDef
+   tmp_bldDef => InputData1%bldDef
+   InputData1%bldDef => InputData2%bldDef
+   InputData2%bldDef => tmp_bldDef
+   tmp_hubDef => InputData1%hubDef
+   InputData1%hubDef => InputData2%hubDef
+   InputData2%hubDef => tmp_hubDef
+   tmp_nacDef => InputData1%nacDef
+   InputData1%nacDef => InputData2%nacDef
+   InputData2%nacDef => tmp_nacDef
+   tmp_bldRootDef => InputData1%bldRootDef
+   InputData1%bldRootDef => InputData2%bldRootDef
+   InputData2%bldRootDef => tmp_bldRootDef
+   tmp_bldPitch => InputData1%bldPitch
+   InputData1%bldPitch => InputData2%bldPitch
+   InputData2%bldPitch => tmp_bldPitch
+   tmp_C_obj = InputData1%C_obj
+   InputData1%C_obj = InputData2%C_obj
+   InputData2%C_obj = tmp_C_obj
+end subroutine
+
 subroutine ExtLdDX_DestroyInput(InputData, ErrStat, ErrMsg)
    type(ExtLdDX_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
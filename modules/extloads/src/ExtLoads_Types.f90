@@ -512,6 +512,20 @@ subroutine ExtLd_CopyContState(SrcContStateData, DstContStateData, CtrlCode, Err
    DstContStateData%blah = SrcContStateData%blah
 end subroutine
 
+subroutine ExtLd_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(ExtLd_ContinuousStateType), intent(inout) :: ContStateData1
+   type(ExtLd_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_blah
+   character(*), parameter        :: RoutineName = 'ExtLd_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_blah = ContStateData1%blah
+   ContStateData1%blah = ContStateData2%blah
+   ContStateData2%blah = tmp_blah
+end subroutine
+
 subroutine ExtLd_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(ExtLd_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -550,6 +564,20 @@ subroutine ExtLd_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, Err
    DstDiscStateData%blah = SrcDiscStateData%blah
 end subroutine
 
+subroutine ExtLd_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(ExtLd_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(ExtLd_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_blah
+   character(*), parameter        :: RoutineName = 'ExtLd_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_blah = DiscStateData1%blah
+   DiscStateData1%blah = DiscStateData2%blah
+   DiscStateData2%blah = tmp_blah
+end subroutine
+
 subroutine ExtLd_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(ExtLd_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -640,6 +668,20 @@ subroutine ExtLd_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCod
    DstConstrStateData%blah = SrcConstrStateData%blah
 end subroutine
 
+subroutine ExtLd_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(ExtLd_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(ExtLd_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_blah
+   character(*), parameter        :: RoutineName = 'ExtLd_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_blah = ConstrStateData1%blah
+   ConstrStateData1%blah = ConstrStateData2%blah
+   ConstrStateData2%blah = tmp_blah
+end subroutine
+
 subroutine ExtLd_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(ExtLd_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -678,6 +720,20 @@ subroutine ExtLd_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode,
    DstOtherStateData%blah = SrcOtherStateData%blah
 end subroutine
 
+subroutine ExtLd_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(ExtLd_OtherStateType), intent(inout) :: OtherStateData1
+   type(ExtLd_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_blah
+   character(*), parameter        :: RoutineName = 'ExtLd_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_blah = OtherStateData1%blah
+   OtherStateData1%blah = OtherStateData2%blah
+   OtherStateData2%blah = tmp_blah
+end subroutine
+
 subroutine ExtLd_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(ExtLd_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -868,6 +924,90 @@ subroutine ExtLd_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg
    end if
 end subroutine
 
+subroutine ExtLd_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(ExtLd_InputType), intent(inout) :: InputData1
+   type(ExtLd_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_az
+   character(*), parameter        :: RoutineName = 'ExtLd_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call ExtLdDX_SwapInput(InputData1%DX_u, InputData2%DX_u, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   tmp_az = InputData1%az
+   InputData1%az = InputData2%az
+   InputData2%az = tmp_az
+   call MeshSwap(InputData1%TowerMotion, InputData2%TowerMotion, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%HubMotion, InputData2%HubMotion, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%NacelleMotion, InputData2%NacelleMotion, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   if (allocated(InputData1%BladeRootMotion) .neqv. allocated(InputData2%BladeRootMotion)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladeRootMotion with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%BladeRootMotion)) then
+      if (any(lbound(InputData1%BladeRootMotion) /= lbound(InputData2%BladeRootMotion)) .or. any(ubound(InputData1%BladeRootMotion) /= ubound(InputData2%BladeRootMotion))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladeRootMotion with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%BladeRootMotion)
+      UB(1:1) = ubound(InputData1%BladeRootMotion)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%BladeRootMotion(i1), InputData2%BladeRootMotion(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(InputData1%BladeMotion) .neqv. allocated(InputData2%BladeMotion)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladeMotion with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%BladeMotion)) then
+      if (any(lbound(InputData1%BladeMotion) /= lbound(InputData2%BladeMotion)) .or. any(ubound(InputData1%BladeMotion) /= ubound(InputData2%BladeMotion))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladeMotion with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%BladeMotion)
+      UB(1:1) = ubound(InputData1%BladeMotion)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%BladeMotion(i1), InputData2%BladeMotion(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call MeshSwap(InputData1%TowerLoadAD, InputData2%TowerLoadAD, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   if (allocated(InputData1%BladeLoadAD) .neqv. allocated(InputData2%BladeLoadAD)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladeLoadAD with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%BladeLoadAD)) then
+      if (any(lbound(InputData1%BladeLoadAD) /= lbound(InputData2%BladeLoadAD)) .or. any(ubound(InputData1%BladeLoadAD) /= ubound(InputData2%BladeLoadAD))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BladeLoadAD with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%BladeLoadAD)
+      UB(1:1) = ubound(InputData1%BladeLoadAD)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%BladeLoadAD(i1), InputData2%BladeLoadAD(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+end subroutine
+
 subroutine ExtLd_DestroyInput(InputData, ErrStat, ErrMsg)
    type(ExtLd_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
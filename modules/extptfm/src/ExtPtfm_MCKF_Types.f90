@@ -643,6 +643,24 @@ subroutine ExtPtfm_CopyContState(SrcContStateData, DstContStateData, CtrlCode, E
    end if
 end subroutine
 
+subroutine ExtPtfm_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(ExtPtfm_ContinuousStateType), intent(inout) :: ContStateData1
+   type(ExtPtfm_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_qm(:)
+   REAL(ReKi), allocatable :: tmp_qmdot(:)
+   character(*), parameter        :: RoutineName = 'ExtPtfm_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%qm, tmp_qm)
+   call move_alloc(ContStateData2%qm, ContStateData1%qm)
+   call move_alloc(tmp_qm, ContStateData2%qm)
+   call move_alloc(ContStateData1%qmdot, tmp_qmdot)
+   call move_alloc(ContStateData2%qmdot, ContStateData1%qmdot)
+   call move_alloc(tmp_qmdot, ContStateData2%qmdot)
+end subroutine
+
 subroutine ExtPtfm_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(ExtPtfm_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -692,6 +710,20 @@ subroutine ExtPtfm_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, E
    DstDiscStateData%DummyDiscState = SrcDiscStateData%DummyDiscState
 end subroutine
 
+subroutine ExtPtfm_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(ExtPtfm_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(ExtPtfm_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyDiscState
+   character(*), parameter        :: RoutineName = 'ExtPtfm_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscState = DiscStateData1%DummyDiscState
+   DiscStateData1%DummyDiscState = DiscStateData2%DummyDiscState
+   DiscStateData2%DummyDiscState = tmp_DummyDiscState
+end subroutine
+
 subroutine ExtPtfm_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(ExtPtfm_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -730,6 +762,20 @@ subroutine ExtPtfm_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlC
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine ExtPtfm_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(ExtPtfm_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(ExtPtfm_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'ExtPtfm_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine ExtPtfm_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(ExtPtfm_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -788,6 +834,41 @@ subroutine ExtPtfm_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode
    DstOtherStateData%n = SrcOtherStateData%n
 end subroutine
 
+subroutine ExtPtfm_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(ExtPtfm_OtherStateType), intent(inout) :: OtherStateData1
+   type(ExtPtfm_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   INTEGER(IntKi) :: tmp_n
+   character(*), parameter        :: RoutineName = 'ExtPtfm_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(OtherStateData1%xdot) .neqv. allocated(OtherStateData2%xdot)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%xdot with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%xdot)) then
+      if (any(lbound(OtherStateData1%xdot) /= lbound(OtherStateData2%xdot)) .or. any(ubound(OtherStateData1%xdot) /= ubound(OtherStateData2%xdot))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%xdot with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%xdot)
+      UB(1:1) = ubound(OtherStateData1%xdot)
+      do i1 = LB(1), UB(1)
+         call ExtPtfm_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   tmp_n = OtherStateData1%n
+   OtherStateData1%n = OtherStateData2%n
+   OtherStateData2%n = tmp_n
+end subroutine
+
 subroutine ExtPtfm_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(ExtPtfm_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1614,6 +1695,31 @@ subroutine ExtPtfm_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrM
    end if
 end subroutine
 
+subroutine ExtPtfm_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(ExtPtfm_InputType), intent(inout) :: InputData1
+   type(ExtPtfm_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_Fm(:)
+   character(*), parameter        :: RoutineName = 'ExtPtfm_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%PtfmMesh, InputData2%PtfmMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%ConnLdMesh, InputData2%ConnLdMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%FBMesh, InputData2%FBMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call move_alloc(InputData1%Fm, tmp_Fm)
+   call move_alloc(InputData2%Fm, InputData1%Fm)
+   call move_alloc(tmp_Fm, InputData2%Fm)
+end subroutine
+
 subroutine ExtPtfm_DestroyInput(InputData, ErrStat, ErrMsg)
    type(ExtPtfm_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -959,6 +959,24 @@ subroutine FEAM_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrS
    end if
 end subroutine
 
+subroutine FEAM_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(FEAM_ContinuousStateType), intent(inout) :: ContStateData1
+   type(FEAM_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_GLU(:,:)
+   REAL(ReKi), allocatable :: tmp_GLDU(:,:)
+   character(*), parameter        :: RoutineName = 'FEAM_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%GLU, tmp_GLU)
+   call move_alloc(ContStateData2%GLU, ContStateData1%GLU)
+   call move_alloc(tmp_GLU, ContStateData2%GLU)
+   call move_alloc(ContStateData1%GLDU, tmp_GLDU)
+   call move_alloc(ContStateData2%GLDU, ContStateData1%GLDU)
+   call move_alloc(tmp_GLDU, ContStateData2%GLDU)
+end subroutine
+
 subroutine FEAM_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(FEAM_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1008,6 +1026,20 @@ subroutine FEAM_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrS
    DstDiscStateData%DummyDiscState = SrcDiscStateData%DummyDiscState
 end subroutine
 
+subroutine FEAM_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(FEAM_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(FEAM_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyDiscState
+   character(*), parameter        :: RoutineName = 'FEAM_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscState = DiscStateData1%DummyDiscState
+   DiscStateData1%DummyDiscState = DiscStateData2%DummyDiscState
+   DiscStateData2%DummyDiscState = tmp_DummyDiscState
+end subroutine
+
 subroutine FEAM_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(FEAM_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1047,6 +1079,24 @@ subroutine FEAM_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode
    DstConstrStateData%TZER = SrcConstrStateData%TZER
 end subroutine
 
+subroutine FEAM_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(FEAM_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(FEAM_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_TSN(1:3)
+   REAL(ReKi) :: tmp_TZER(1:3)
+   character(*), parameter        :: RoutineName = 'FEAM_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_TSN = ConstrStateData1%TSN
+   ConstrStateData1%TSN = ConstrStateData2%TSN
+   ConstrStateData2%TSN = tmp_TSN
+   tmp_TZER = ConstrStateData1%TZER
+   ConstrStateData1%TZER = ConstrStateData2%TZER
+   ConstrStateData2%TZER = tmp_TZER
+end subroutine
+
 subroutine FEAM_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(FEAM_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1165,6 +1215,60 @@ subroutine FEAM_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, E
    DstOtherStateData%EMAS0 = SrcOtherStateData%EMAS0
 end subroutine
 
+subroutine FEAM_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(FEAM_OtherStateType), intent(inout) :: OtherStateData1
+   type(FEAM_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_GLU0(:,:)
+   REAL(ReKi), allocatable :: tmp_GLDDU(:,:)
+   LOGICAL :: tmp_BottomTouch
+   REAL(ReKi), allocatable :: tmp_GFORC0(:,:,:)
+   REAL(ReKi), allocatable :: tmp_GMASS0(:,:,:,:)
+   REAL(ReKi), allocatable :: tmp_FAST_FPA(:,:)
+   REAL(ReKi), allocatable :: tmp_FAST_RP(:,:)
+   INTEGER(IntKi) :: tmp_INCR
+   REAL(ReKi) :: tmp_RSDF(1:15)
+   REAL(ReKi) :: tmp_FORC0(1:15)
+   REAL(ReKi) :: tmp_EMAS0(1:15,1:15)
+   character(*), parameter        :: RoutineName = 'FEAM_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(OtherStateData1%GLU0, tmp_GLU0)
+   call move_alloc(OtherStateData2%GLU0, OtherStateData1%GLU0)
+   call move_alloc(tmp_GLU0, OtherStateData2%GLU0)
+   call move_alloc(OtherStateData1%GLDDU, tmp_GLDDU)
+   call move_alloc(OtherStateData2%GLDDU, OtherStateData1%GLDDU)
+   call move_alloc(tmp_GLDDU, OtherStateData2%GLDDU)
+   tmp_BottomTouch = OtherStateData1%BottomTouch
+   OtherStateData1%BottomTouch = OtherStateData2%BottomTouch
+   OtherStateData2%BottomTouch = tmp_BottomTouch
+   call move_alloc(OtherStateData1%GFORC0, tmp_GFORC0)
+   call move_alloc(OtherStateData2%GFORC0, OtherStateData1%GFORC0)
+   call move_alloc(tmp_GFORC0, OtherStateData2%GFORC0)
+   call move_alloc(OtherStateData1%GMASS0, tmp_GMASS0)
+   call move_alloc(OtherStateData2%GMASS0, OtherStateData1%GMASS0)
+   call move_alloc(tmp_GMASS0, OtherStateData2%GMASS0)
+   call move_alloc(OtherStateData1%FAST_FPA, tmp_FAST_FPA)
+   call move_alloc(OtherStateData2%FAST_FPA, OtherStateData1%FAST_FPA)
+   call move_alloc(tmp_FAST_FPA, OtherStateData2%FAST_FPA)
+   call move_alloc(OtherStateData1%FAST_RP, tmp_FAST_RP)
+   call move_alloc(OtherStateData2%FAST_RP, OtherStateData1%FAST_RP)
+   call move_alloc(tmp_FAST_RP, OtherStateData2%FAST_RP)
+   tmp_INCR = OtherStateData1%INCR
+   OtherStateData1%INCR = OtherStateData2%INCR
+   OtherStateData2%INCR = tmp_INCR
+   tmp_RSDF = OtherStateData1%RSDF
+   OtherStateData1%RSDF = OtherStateData2%RSDF
+   OtherStateData2%RSDF = tmp_RSDF
+   tmp_FORC0 = OtherStateData1%FORC0
+   OtherStateData1%FORC0 = OtherStateData2%FORC0
+   OtherStateData2%FORC0 = tmp_FORC0
+   tmp_EMAS0 = OtherStateData1%EMAS0
+   OtherStateData1%EMAS0 = OtherStateData2%EMAS0
+   OtherStateData2%EMAS0 = tmp_EMAS0
+end subroutine
+
 subroutine FEAM_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(FEAM_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2000,6 +2104,24 @@ subroutine FEAM_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine FEAM_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(FEAM_InputType), intent(inout) :: InputData1
+   type(FEAM_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'FEAM_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%HydroForceLineMesh, InputData2%HydroForceLineMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%PtFairleadDisplacement, InputData2%PtFairleadDisplacement, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine FEAM_DestroyInput(InputData, ErrStat, ErrMsg)
    type(FEAM_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -172,7 +172,7 @@ SUBROUTINE Conv_Rdtn_Init( InitInp, u, p, x, xd, z, OtherState, y, m, InitOut, E
          RETURN
       END IF
 
-      ALLOCATE ( xd%XDHistory(p%NDOF,0:p%NStepRdtn) , STAT=ErrStat )   ! In the numerical convolution we must have NStepRdtn1 elements within the XDHistory array, which is one more than the NStepRdtn elements that are in the RdtnKrnl array
+      ALLOCATE ( xd%XDHistory(p%NDOF,0:2*p%NStepRdtn-1) , STAT=ErrStat )   ! Ring buffer in which each velocity is stored twice (at K and K+NStepRdtn), so that the last NStepRdtn velocities are always contiguous
       IF ( ErrStat /= ErrID_None )  THEN
          ErrMsg = ' Error allocating memory for the XDHistory array.'
          ErrStat = ErrID_Fatal
@@ -180,7 +180,7 @@ SUBROUTINE Conv_Rdtn_Init( InitInp, u, p, x, xd, z, OtherState, y, m, InitOut, E
       END IF
 
          ! Initialize all elements of the xd%XDHistory array with the initial values of u%Velocity
-      DO K = 0,p%NStepRdtn-1
+      DO K = 0,2*p%NStepRdtn-1
          DO J = 1,p%NDOF                 ! Loop through all DOFs
             xd%XDHistory(J,K) = u%Velocity(J)
          END DO
@@ -337,6 +337,13 @@ SUBROUTINE Conv_Rdtn_Init( InitInp, u, p, x, xd, z, OtherState, y, m, InitOut, E
 
    IF ( ALLOCATED( RdtnTime     ) ) DEALLOCATE( RdtnTime     )
 
+      ! Store the kernel in reverse order of time lag, so that the convolution with the (chronological) velocity history
+      !   in Conv_Rdtn_CalcOutput() is a single matrix-vector product over contiguous memory:
+   p%RdtnKrnl = p%RdtnKrnl(:,:,p%NStepRdtn-1:0:-1)
+
+   call AllocAry( m%F_RdtnDT, p%NDOF, "m%F_RdtnDT", ErrStat2, ErrMsg2 ); call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'Conv_Rdtn_Init' )
+   IF ( ErrStat >= AbortErrLev ) RETURN
+
 
    m%LastIndRdtn = 0
    OtherState%IndRdtn = 0
@@ -482,7 +489,7 @@ END SUBROUTINE Conv_Rdtn_UpdateStates
 !> Routine for computing outputs, used in both loose and tight coupling.
 SUBROUTINE Conv_Rdtn_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat, ErrMsg )
 !..................................................................................................................................
-   use NWTC_LAPACK, only: LAPACK_gemm
+   use NWTC_LAPACK, only: SGEMV   ! specific routine, so that the kernel and history can be passed by sequence association
 
       REAL(DbKi),                          INTENT(IN   )  :: Time        !< Current simulation time in seconds
       TYPE(Conv_Rdtn_InputType),           INTENT(IN   )  :: u           !< Inputs at Time
@@ -497,50 +504,41 @@ SUBROUTINE Conv_Rdtn_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat
       INTEGER(IntKi),                       INTENT(  OUT) :: ErrStat     !< Error status of the operation
       CHARACTER(*),                         INTENT(  OUT) :: ErrMsg      !< Error message if ErrStat /= ErrID_None
 
-      character(*), parameter              :: RoutineName = 'Conv_Rdtn_CalcOutput'
-      integer(IntKi)                       :: ErrStat2
-      character(ErrMsgLen)                 :: ErrMsg2
-      REAL(SiKi), allocatable              :: F_RdtnDT(:,:)                      ! The portion of the total load contribution from wave radiation damping associated with the convolution integral proportional to ( RdtnDT - RdtnRmndr ) (N, N-m)
-
-      INTEGER                              :: I                                       ! Generic index
-      INTEGER                              :: J                                       ! Generic index
-      INTEGER                              :: K                                       ! Generic index
-
       INTEGER(IntKi)                       :: MaxInd
+      INTEGER(IntKi)                       :: FirstInd                                ! Index of the oldest velocity used in the convolution (in xd%XDHistory)
+      INTEGER(IntKi)                       :: KrnlInd                                 ! Index of the kernel at time lag MaxInd*RdtnDT (in p%RdtnKrnl)
 
       ErrStat = ErrID_None
       ErrMsg  = ""
 
       MaxInd = MIN(p%NStepRdtn-1,OtherState%IndRdtn)  ! Note: xd%IndRdtn index is from the previous time-step since this state was for the previous time-step
 
-      call AllocAry(F_RdtnDT, p%NDOF, 1, 'F_RdtnDT', ErrStat2, ErrMsg2)
-      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-      if (ErrStat >= AbortErrLev) return
+         ! The velocities xd%XDHistory(:,FirstInd:FirstInd+MaxInd) are in chronological order and the kernel p%RdtnKrnl(:,:,KrnlInd:p%NStepRdtn-1)
+         !   is stored in reverse order of time lag, so the history and the kernel are both contiguous:
+      IF ( OtherState%IndRdtn < p%NStepRdtn ) THEN
+         FirstInd = 0
+      ELSE
+         FirstInd = MOD(OtherState%IndRdtn, p%NStepRdtn) + 1
+      END IF
+      KrnlInd = p%NStepRdtn-1-MaxInd
 
       ! Perform numerical convolution to determine the load contribution from wave radiation damping:
-      ! Contribution from the first and last time steps are halved to make the integration 2nd-order accurate
-
-      ! First time step
-      call LAPACK_gemm('N', 'N', -0.5_SiKi, p%RdtnKrnl(:,:,MaxInd), xd%XDHistory(:,0:0), 0.0_SiKi, F_RdtnDT, ErrStat2, ErrMsg2)
-      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-      if (ErrStat >= AbortErrLev) return
+      call SGEMV('N', p%NDOF, p%NDOF*(MaxInd+1), -1.0_SiKi, p%RdtnKrnl(1,1,KrnlInd), p%NDOF, xd%XDHistory(1,FirstInd), 1, 0.0_SiKi, m%F_RdtnDT, 1)
 
-      ! Last time step
-      call LAPACK_gemm('N', 'N', -0.5_SiKi, p%RdtnKrnl(:,:,0), xd%XDHistory(:,MaxInd:MaxInd), 1.0_SiKi, F_RdtnDT, ErrStat2, ErrMsg2)
-
-      ! Intermediate time steps
-      do K = 1, MaxInd-1 
-         call LAPACK_gemm('N', 'N', -1.0_SiKi, p%RdtnKrnl(:,:,MaxInd-K), xd%XDHistory(:,K:K), 1.0_SiKi, F_RdtnDT, ErrStat2, ErrMsg2)
-      end do
+      ! Contribution from the first and last time steps are halved to make the integration 2nd-order accurate
+      IF ( MaxInd > 0 ) THEN
+         call SGEMV('N', p%NDOF, p%NDOF, 0.5_SiKi, p%RdtnKrnl(1,1,KrnlInd),       p%NDOF, xd%XDHistory(1,FirstInd),        1, 1.0_SiKi, m%F_RdtnDT, 1)  ! First time step
+         call SGEMV('N', p%NDOF, p%NDOF, 0.5_SiKi, p%RdtnKrnl(1,1,p%NStepRdtn-1), p%NDOF, xd%XDHistory(1,FirstInd+MaxInd), 1, 1.0_SiKi, m%F_RdtnDT, 1)  ! Last time step
+      END IF
 
-      y%F_Rdtn = p%RdtnDT*real(F_RdtnDT(:,1), ReKi) !F_Rdtn
+      y%F_Rdtn = p%RdtnDT*real(m%F_RdtnDT, ReKi) !F_Rdtn
 
       ! Loop through all wave radiation damping forces and moments
       ! F_RdtnDT = 0.0
       ! DO I = 1,p%NDOF
       !    DO J = 1,p%NDOF              ! Loop through all platform DOFs
       !       ! Contribution from the first and last time steps are halved to make the integration 2nd-order accurate
-      !       F_RdtnDT(I) = F_RdtnDT(I) - 0.5_SiKi * p%RdtnKrnl(MaxInd,I,J)*xd%XDHistory(0,J) &
+      !       F_RdtnDT(I) = F_RdtnDT(I) - 0.5_SiKi * p%RdtnKrnl(MaxInd,I,J)*xd%XDHistory(0,J) &   ! (RdtnKrnl indexed by time lag)
       !                                 - 0.5_SiKi * p%RdtnKrnl(0,I,J)*xd%XDHistory(MaxInd,J)
             
       !       ! Loop through all remaining NStepRdtn-2 time steps in the radiation Kernel (less than NStepRdtn time steps are used when ZTime < RdtnTmax)
@@ -643,22 +641,14 @@ SUBROUTINE Conv_Rdtn_UpdateDiscState( Time, n, u, p, x, xd, z, OtherState, m, Er
          ! NOTE: When IndRdtn > LastIndRdtn, IndRdtn will equal           LastIndRdtn + 1 if DT <= RdtnDT;
          !       When IndRdtn > LastIndRdtn, IndRdtn will be greater than LastIndRdtn + 1 if DT >  RdtnDT.
 
-      IF ( OtherState%IndRdtn < (p%NStepRdtn) )  THEN
-         DO J = 1,p%NDOF  ! Loop through all platform DOFs
-            xd%XDHistory(J,OtherState%IndRdtn) = u%Velocity(J)  ! XDHistory was allocated as a zero-based array!
-         END DO       ! J - All platform DOFs
-      ELSE
-
-         ! Shift the stored history by one index
-         DO K = 0,p%NStepRdtn-2
-            DO J = 1,p%NDOF                 ! Loop through all DOFs
-               xd%XDHistory(J,K) = xd%XDHistory(J,K+1)
-            END DO
-         END DO
-         DO J = 1,p%NDOF  ! Loop through all platform DOFs
-            xd%XDHistory(J,p%NStepRdtn-1) = u%Velocity(J) ! Set the last array element to the current velocity
-         END DO       ! J - All platform DOFs
-      END IF
+         ! XDHistory is a ring buffer (allocated as a zero-based array!) in which each velocity is stored at K and K+NStepRdtn,
+         !   so the oldest values are replaced without shifting the stored history and the last NStepRdtn values are always
+         !   contiguous (in XDHistory(:,K+1:K+NStepRdtn) once the history is full):
+      K = MOD( OtherState%IndRdtn, p%NStepRdtn )
+      DO J = 1,p%NDOF  ! Loop through all platform DOFs
+         xd%XDHistory(J,K)             = u%Velocity(J)
+         xd%XDHistory(J,K+p%NStepRdtn) = u%Velocity(J)
+      END DO       ! J - All platform DOFs
 
 END SUBROUTINE Conv_Rdtn_UpdateDiscState
 !----------------------------------------------------------------------------------------------------------------------------------
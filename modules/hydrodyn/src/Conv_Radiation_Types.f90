@@ -60,7 +60,7 @@ IMPLICIT NONE
 ! =======================
 ! =========  Conv_Rdtn_DiscreteStateType  =======
   TYPE, PUBLIC :: Conv_Rdtn_DiscreteStateType
-    REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: XDHistory      !<  [-]
+    REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: XDHistory      !< Velocity history stored twice in a ring buffer of 2*NStepRdtn columns, so that the last NStepRdtn values are always contiguous [-]
     REAL(DbKi)  :: LastTime = 0.0_R8Ki      !<  [-]
   END TYPE Conv_Rdtn_DiscreteStateType
 ! =======================
@@ -77,6 +77,7 @@ IMPLICIT NONE
 ! =========  Conv_Rdtn_MiscVarType  =======
   TYPE, PUBLIC :: Conv_Rdtn_MiscVarType
     INTEGER(IntKi)  :: LastIndRdtn = 0_IntKi      !<  [-]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: F_RdtnDT      !< The portion of the total load contribution from wave radiation damping associated with the convolution integral (N/RdtnDT, N-m/RdtnDT) [-]
   END TYPE Conv_Rdtn_MiscVarType
 ! =======================
 ! =========  Conv_Rdtn_ParameterType  =======
@@ -85,7 +86,7 @@ IMPLICIT NONE
     REAL(DbKi)  :: RdtnDT = 0.0_R8Ki      !<  [-]
     INTEGER(IntKi)  :: NBody = 0_IntKi      !< [>=1; only used when PotMod=1. If NBodyMod=1, the WAMIT data contains a vector of size 6*NBody x 1 and matrices of size 6*NBody x 6*NBody; if NBodyMod>1, there are NBody sets of WAMIT data each with a vector of size 6 x 1 and matrices of size 6 x 6] [-]
     INTEGER(IntKi)  :: NDOF = 0_IntKi      !< Total number of degrees of freedom for all bodies including AddDOF [-]
-    REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: RdtnKrnl      !<  [-]
+    REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: RdtnKrnl      !< Wave radiation kernel stored in reverse order of time lag: RdtnKrnl(:,:,NStepRdtn-1-K) is the kernel at time K*RdtnDT [-]
     INTEGER(IntKi)  :: NStepRdtn = 0_IntKi      !<  [-]
     INTEGER(IntKi)  :: NStepRdtn1 = 0_IntKi      !<  [-]
   END TYPE Conv_Rdtn_ParameterType
@@ -271,6 +272,20 @@ subroutine Conv_Rdtn_CopyContState(SrcContStateData, DstContStateData, CtrlCode,
    DstContStateData%DummyContState = SrcContStateData%DummyContState
 end subroutine
 
+subroutine Conv_Rdtn_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(Conv_Rdtn_ContinuousStateType), intent(inout) :: ContStateData1
+   type(Conv_Rdtn_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyContState
+   character(*), parameter        :: RoutineName = 'Conv_Rdtn_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyContState = ContStateData1%DummyContState
+   ContStateData1%DummyContState = ContStateData2%DummyContState
+   ContStateData2%DummyContState = tmp_DummyContState
+end subroutine
+
 subroutine Conv_Rdtn_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(Conv_Rdtn_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -323,6 +338,24 @@ subroutine Conv_Rdtn_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode,
    DstDiscStateData%LastTime = SrcDiscStateData%LastTime
 end subroutine
 
+subroutine Conv_Rdtn_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(Conv_Rdtn_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(Conv_Rdtn_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi), allocatable :: tmp_XDHistory(:,:)
+   REAL(DbKi) :: tmp_LastTime
+   character(*), parameter        :: RoutineName = 'Conv_Rdtn_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(DiscStateData1%XDHistory, tmp_XDHistory)
+   call move_alloc(DiscStateData2%XDHistory, DiscStateData1%XDHistory)
+   call move_alloc(tmp_XDHistory, DiscStateData2%XDHistory)
+   tmp_LastTime = DiscStateData1%LastTime
+   DiscStateData1%LastTime = DiscStateData2%LastTime
+   DiscStateData2%LastTime = tmp_LastTime
+end subroutine
+
 subroutine Conv_Rdtn_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(Conv_Rdtn_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -369,6 +402,20 @@ subroutine Conv_Rdtn_CopyConstrState(SrcConstrStateData, DstConstrStateData, Ctr
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine Conv_Rdtn_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(Conv_Rdtn_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(Conv_Rdtn_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'Conv_Rdtn_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine Conv_Rdtn_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(Conv_Rdtn_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -407,6 +454,20 @@ subroutine Conv_Rdtn_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCo
    DstOtherStateData%IndRdtn = SrcOtherStateData%IndRdtn
 end subroutine
 
+subroutine Conv_Rdtn_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(Conv_Rdtn_OtherStateType), intent(inout) :: OtherStateData1
+   type(Conv_Rdtn_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   INTEGER(IntKi) :: tmp_IndRdtn
+   character(*), parameter        :: RoutineName = 'Conv_Rdtn_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_IndRdtn = OtherStateData1%IndRdtn
+   OtherStateData1%IndRdtn = OtherStateData2%IndRdtn
+   OtherStateData2%IndRdtn = tmp_IndRdtn
+end subroutine
+
 subroutine Conv_Rdtn_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(Conv_Rdtn_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -439,10 +500,24 @@ subroutine Conv_Rdtn_CopyMisc(SrcMiscData, DstMiscData, CtrlCode, ErrStat, ErrMs
    integer(IntKi),  intent(in   ) :: CtrlCode
    integer(IntKi),  intent(  out) :: ErrStat
    character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
    character(*), parameter        :: RoutineName = 'Conv_Rdtn_CopyMisc'
    ErrStat = ErrID_None
    ErrMsg  = ''
    DstMiscData%LastIndRdtn = SrcMiscData%LastIndRdtn
+   if (allocated(SrcMiscData%F_RdtnDT)) then
+      LB(1:1) = lbound(SrcMiscData%F_RdtnDT)
+      UB(1:1) = ubound(SrcMiscData%F_RdtnDT)
+      if (.not. allocated(DstMiscData%F_RdtnDT)) then
+         allocate(DstMiscData%F_RdtnDT(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%F_RdtnDT.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstMiscData%F_RdtnDT = SrcMiscData%F_RdtnDT
+   end if
 end subroutine
 
 subroutine Conv_Rdtn_DestroyMisc(MiscData, ErrStat, ErrMsg)
@@ -452,6 +527,9 @@ subroutine Conv_Rdtn_DestroyMisc(MiscData, ErrStat, ErrMsg)
    character(*), parameter        :: RoutineName = 'Conv_Rdtn_DestroyMisc'
    ErrStat = ErrID_None
    ErrMsg  = ''
+   if (allocated(MiscData%F_RdtnDT)) then
+      deallocate(MiscData%F_RdtnDT)
+   end if
 end subroutine
 
 subroutine Conv_Rdtn_PackMisc(RF, Indata)
@@ -460,6 +538,7 @@ subroutine Conv_Rdtn_PackMisc(RF, Indata)
    character(*), parameter         :: RoutineName = 'Conv_Rdtn_PackMisc'
    if (RF%ErrStat >= AbortErrLev) return
    call RegPack(RF, InData%LastIndRdtn)
+   call RegPackAlloc(RF, InData%F_RdtnDT)
    if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
@@ -467,8 +546,12 @@ subroutine Conv_Rdtn_UnPackMisc(RF, OutData)
    type(RegFile), intent(inout)    :: RF
    type(Conv_Rdtn_MiscVarType), intent(inout) :: OutData
    character(*), parameter            :: RoutineName = 'Conv_Rdtn_UnPackMisc'
+   integer(B4Ki)   :: LB(1), UB(1)
+   integer(IntKi)  :: stat
+   logical         :: IsAllocAssoc
    if (RF%ErrStat /= ErrID_None) return
    call RegUnpack(RF, OutData%LastIndRdtn); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%F_RdtnDT); if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
 subroutine Conv_Rdtn_CopyParam(SrcParamData, DstParamData, CtrlCode, ErrStat, ErrMsg)
@@ -571,6 +654,20 @@ subroutine Conv_Rdtn_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, Er
    end if
 end subroutine
 
+subroutine Conv_Rdtn_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(Conv_Rdtn_InputType), intent(inout) :: InputData1
+   type(Conv_Rdtn_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_Velocity(:)
+   character(*), parameter        :: RoutineName = 'Conv_Rdtn_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(InputData1%Velocity, tmp_Velocity)
+   call move_alloc(InputData2%Velocity, InputData1%Velocity)
+   call move_alloc(tmp_Velocity, InputData2%Velocity)
+end subroutine
+
 subroutine Conv_Rdtn_DestroyInput(InputData, ErrStat, ErrMsg)
    type(Conv_Rdtn_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -656,7 +656,7 @@ SUBROUTINE HydroDyn_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, I
                   WRITE( InputFileData%UnSum, '(1X,I10,2X,E12.5)',ADVANCE='no' ) K, K*p%WAMIT(iWAMIT)%Conv_Rdtn%RdtnDT
                   do i = 1,p%WAMIT(iWAMIT)%NDOF
                      do j = 1,p%WAMIT(iWAMIT)%NDOF
-                        WRITE( InputFileData%UnSum, '(2X,ES16.5)',ADVANCE='no' ) p%WAMIT(iWAMIT)%Conv_Rdtn%RdtnKrnl(i,j,k)
+                        WRITE( InputFileData%UnSum, '(2X,ES16.5)',ADVANCE='no' ) p%WAMIT(iWAMIT)%Conv_Rdtn%RdtnKrnl(i,j,p%WAMIT(iWAMIT)%Conv_Rdtn%NStepRdtn-1-k)  ! kernel is stored in reverse order of time lag
                      end do
                   end do
                   write(InputFileData%UnSum,'()')  ! end of line character
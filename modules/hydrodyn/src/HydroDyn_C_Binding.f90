@@ -58,20 +58,11 @@ MODULE HydroDyn_C_BINDING
    !------------------------------------------------------------------------------------
    !  Data storage
    !     All HydroDyn data is stored within the following data structures inside this
-   !     module.  No data is stored within HydroDyn itself, but is instead passed in
+   !     module (one HD_C_InstanceType per model).  No data is stored within HydroDyn itself, but is instead passed in
    !     from this module.  This data is not available to the calling code unless
    !     explicitly passed through the interface (derived types such as these are
    !     non-trivial to pass through the c-bindings).
    !------------------------------
-   !  Extrapolation and interpolation
-   !     For the solver in HD, previous timesteps input must be stored for extrapolation
-   !     to the t+dt timestep.  This can be either linear (1) quadratic (2).  The
-   !     InterpOrder variable tracks what this is and sets the size of the inputs `u`
-   !     passed into HD. Inputs `u` will be sized as follows:
-   !        linear    interp     u(2)  with inputs at T,T-dt
-   !        quadratic interp     u(3)  with inputs at T,T-dt,T-2*dt
-   integer(IntKi)                         :: InterpOrder
-   !------------------------------
    !  Primary HD derived data types
    type :: HD_data
       type(HydroDyn_InputType),  allocatable :: u(:)              !< Inputs at T, T-dt, T-2*dt (history kept for updating states)
@@ -87,8 +78,6 @@ MODULE HydroDyn_C_BINDING
       logical                                :: Initialized = .FALSE.
    end type HD_data
 
-   type(HD_data)     :: HD
-
    !  Primary SeaState derived data types
    ! NOTE: SeaSt does not contain states, so only using single instance of states.
    type :: SeaSt_data
@@ -105,27 +94,6 @@ MODULE HydroDyn_C_BINDING
       logical                                :: Initialized = .FALSE.
    end type SeaSt_data
 
-   type(SeaSt_data)  :: SeaSt
-
-   !------------------------------
-   !  Time tracking
-   !     When we are performing a correction step, time information of previous
-   !     calls is needed to decide how to apply correction logic or cycle the inputs
-   !     and resave the previous timestep states.
-   !  Correction steps
-   !     OpenFAST has the ability to perform correction steps.  During a correction
-   !     step, new input values are passed in but the timestep remains the same.
-   !     When this occurs the new input data at time t is used with the state
-   !     information from the previous timestep (t) to calculate new state values
-   !     time t+dt in the UpdateStates routine.  In OpenFAST this is all handled by
-   !     the glue code.  However, here we do not pass state information through the
-   !     interface and therefore must store it here analogously to how it is handled
-   !     in the OpenFAST glue code.
-   real(DbKi)                             :: dT_Global         ! dT of the code calling this module
-   integer(IntKi)                         :: N_Global          ! global timestep
-   real(DbKi)                             :: T_Initial         ! initial Time of simulation
-   real(DbKi),       allocatable          :: InputTimes(:)     ! input times corresponding to u(:) array
-   real(DbKi)                             :: InputTimePrev     ! input time of last UpdateStates call
    ! Note that we are including the previous state info here (not done in OF this way)
    integer(IntKi),   parameter            :: STATE_LAST = 0    ! Index for previous state (not needed in OF, but necessary here)
    integer(IntKi),   parameter            :: STATE_CURR = 1    ! Index for current state
@@ -134,48 +102,93 @@ MODULE HydroDyn_C_BINDING
    integer(IntKi),   parameter            :: INPUT_LAST = 3    ! Index for previous  input at t-dt
    integer(IntKi),   parameter            :: INPUT_CURR = 2    ! Index for current   input at t
    integer(IntKi),   parameter            :: INPUT_PRED = 1    ! Index for predicted input at t+dt
-   !------------------------------------------------------------------------------------
-
-
 
    !------------------------------------------------------------------------------------
-   !  Meshes for motions and loads
-   !     Meshes are used within HD to handle all motions and loads. Rather than directly
-   !     map to those nodes, we will create a mapping to go between the array of node
-   !     positions passed into this module and what is used inside HD.  This is done
-   !     through a pair of meshes for the motion and loads corresponding to the node
-   !     positions passed in.
-   !------------------------------
-   !  Meshes for external nodes
-   !     These point meshes are merely used to simplify the mapping of motions/loads
-   !     to/from HD using the library mesh mapping routines.  These meshes may contain
-   !     one or multiple points.
-   !        - 1 point   -- rigid floating body assumption
-   !        - N points  -- flexible structure (either floating or fixed bottom)
-   integer(IntKi)                         :: NumNodePts              ! Number of mesh points we are interfacing motions/loads to/from HD
-   type(MeshType)                         :: HD_MotionMesh           ! mesh for motions of external nodes
-   type(MeshType)                         :: HD_LoadMesh             ! mesh for loads  for external nodes
-   type(MeshType)                         :: HD_LoadMesh_tmp         ! mesh for loads  for external nodes -- temporary
-   !------------------------------
-   !  Mesh mapping: motions
-   !     The mapping of motions from the nodes passed in to the corresponding HD meshes
-   type(MeshMapType)                      :: Map_Motion_2_HD_PRP_P   ! Mesh mapping between input motion mesh and PRP
-   type(MeshMapType)                      :: Map_Motion_2_HD_WB_P    ! Mesh mapping between input motion mesh and WAMIT body(ies) mesh
-   type(MeshMapType)                      :: Map_Motion_2_HD_Mo_P    ! Mesh mapping between input motion mesh and Morison mesh
-   !------------------------------
-   !  Mesh mapping: loads
-   !     The mapping of loads from the HD meshes to the corresponding external nodes
-   type(MeshMapType)                      :: Map_HD_WB_P_2_Load      ! Mesh mapping between HD output WAMIT body loads mesh and external nodes mesh
-   type(MeshMapType)                      :: Map_HD_Mo_P_2_Load      ! Mesh mapping between HD output Morison    loads mesh and external nodes mesh
-   !  Meshes -- helper stuff
-   real(R8Ki)                             :: theta(3)                ! mesh creation helper data
-   !  Motions input (so we don't have to reallocate all the time
-   real(ReKi), allocatable                :: tmpNodePos(:,:)         ! temp array.  Probably don't need this, but makes conversion from C clearer.
-   real(ReKi), allocatable                :: tmpNodeVel(:,:)         ! temp array.  Probably don't need this, but makes conversion from C clearer.
-   real(ReKi), allocatable                :: tmpNodeAcc(:,:)         ! temp array.  Probably don't need this, but makes conversion from C clearer.
-   real(ReKi), allocatable                :: tmpNodeFrc(:,:)         ! temp array.  Probably don't need this, but makes conversion to   C clearer.
-   real(ReKi), allocatable                :: tmpNodeAdm(:,:)         ! temp array.  Probably don't need this, but makes conversion to   C clearer.
-   logical,    allocatable                :: perturbed(:)            ! helps keeping track of which node has been perturbed when computing added mass
+   !  Instances
+   !     Each HydroDyn+SeaState model created through this interface is kept in its own
+   !     HD_C_InstanceType record.  HydroDyn_C_Init creates the record and returns an
+   !     integer handle to it; all other HydroDyn_C_* routines take that handle as their
+   !     first argument, so several independent models can be run from one process.
+   !     Calls on different handles may be made from separate threads at the same time.
+   !     Creating or ending an instance changes the instance list, so HydroDyn_C_Init
+   !     and HydroDyn_C_End must not overlap with any other call into this library.
+   type :: HD_C_InstanceType
+      !------------------------------
+      !  Extrapolation and interpolation
+      !     For the solver in HD, previous timesteps input must be stored for extrapolation
+      !     to the t+dt timestep.  This can be either linear (1) quadratic (2).  The
+      !     InterpOrder variable tracks what this is and sets the size of the inputs `u`
+      !     passed into HD. Inputs `u` will be sized as follows:
+      !        linear    interp     u(2)  with inputs at T,T-dt
+      !        quadratic interp     u(3)  with inputs at T,T-dt,T-2*dt
+      integer(IntKi)                         :: InterpOrder
+      !------------------------------
+      !  Primary HD and SeaState data
+      type(HD_data)                          :: HD
+      type(SeaSt_data)                       :: SeaSt
+      !------------------------------
+      !  Time tracking
+      !     When we are performing a correction step, time information of previous
+      !     calls is needed to decide how to apply correction logic or cycle the inputs
+      !     and resave the previous timestep states.
+      !  Correction steps
+      !     OpenFAST has the ability to perform correction steps.  During a correction
+      !     step, new input values are passed in but the timestep remains the same.
+      !     When this occurs the new input data at time t is used with the state
+      !     information from the previous timestep (t) to calculate new state values
+      !     time t+dt in the UpdateStates routine.  In OpenFAST this is all handled by
+      !     the glue code.  However, here we do not pass state information through the
+      !     interface and therefore must store it here analogously to how it is handled
+      !     in the OpenFAST glue code.
+      real(DbKi)                             :: dT_Global         ! dT of the code calling this module
+      integer(IntKi)                         :: N_Global          ! global timestep
+      real(DbKi)                             :: T_Initial         ! initial Time of simulation
+      real(DbKi),       allocatable          :: InputTimes(:)     ! input times corresponding to u(:) array
+      real(DbKi)                             :: InputTimePrev     ! input time of last UpdateStates call
+      !------------------------------
+      !  Meshes for motions and loads
+      !     Meshes are used within HD to handle all motions and loads. Rather than directly
+      !     map to those nodes, we will create a mapping to go between the array of node
+      !     positions passed into this module and what is used inside HD.  This is done
+      !     through a pair of meshes for the motion and loads corresponding to the node
+      !     positions passed in.
+      !------------------------------
+      !  Meshes for external nodes
+      !     These point meshes are merely used to simplify the mapping of motions/loads
+      !     to/from HD using the library mesh mapping routines.  These meshes may contain
+      !     one or multiple points.
+      !        - 1 point   -- rigid floating body assumption
+      !        - N points  -- flexible structure (either floating or fixed bottom)
+      integer(IntKi)                         :: NumNodePts              ! Number of mesh points we are interfacing motions/loads to/from HD
+      type(MeshType)                         :: HD_MotionMesh           ! mesh for motions of external nodes
+      type(MeshType)                         :: HD_LoadMesh             ! mesh for loads  for external nodes
+      type(MeshType)                         :: HD_LoadMesh_tmp         ! mesh for loads  for external nodes -- temporary
+      !------------------------------
+      !  Mesh mapping: motions
+      !     The mapping of motions from the nodes passed in to the corresponding HD meshes
+      type(MeshMapType)                      :: Map_Motion_2_HD_PRP_P   ! Mesh mapping between input motion mesh and PRP
+      type(MeshMapType)                      :: Map_Motion_2_HD_WB_P    ! Mesh mapping between input motion mesh and WAMIT body(ies) mesh
+      type(MeshMapType)                      :: Map_Motion_2_HD_Mo_P    ! Mesh mapping between input motion mesh and Morison mesh
+      !------------------------------
+      !  Mesh mapping: loads
+      !     The mapping of loads from the HD meshes to the corresponding external nodes
+      type(MeshMapType)                      :: Map_HD_WB_P_2_Load      ! Mesh mapping between HD output WAMIT body loads mesh and external nodes mesh
+      type(MeshMapType)                      :: Map_HD_Mo_P_2_Load      ! Mesh mapping between HD output Morison    loads mesh and external nodes mesh
+      !  Motions input (so we don't have to reallocate all the time
+      real(ReKi), allocatable                :: tmpNodePos(:,:)         ! temp array.  Probably don't need this, but makes conversion from C clearer.
+      real(ReKi), allocatable                :: tmpNodeVel(:,:)         ! temp array.  Probably don't need this, but makes conversion from C clearer.
+      real(ReKi), allocatable                :: tmpNodeAcc(:,:)         ! temp array.  Probably don't need this, but makes conversion from C clearer.
+      real(ReKi), allocatable                :: tmpNodeFrc(:,:)         ! temp array.  Probably don't need this, but makes conversion to   C clearer.
+      real(ReKi), allocatable                :: tmpNodeAdm(:,:)         ! temp array.  Probably don't need this, but makes conversion to   C clearer.
+      logical,    allocatable                :: perturbed(:)            ! helps keeping track of which node has been perturbed when computing added mass
+   end type HD_C_InstanceType
+
+   !> Instances are held through pointers so that they never move when the list grows
+   type :: HD_C_InstancePtr
+      type(HD_C_InstanceType), pointer              :: Inst => NULL()
+   end type HD_C_InstancePtr
+
+   type(HD_C_InstancePtr), allocatable           :: Instances(:)      !< Instance list; the handle is the index into this array
    !------------------------------------------------------------------------------------
 
 
@@ -203,7 +216,7 @@ end subroutine SetErr
 !===============================================================================================================
 !--------------------------------------------- HydroDyn Init----------------------------------------------------
 !===============================================================================================================
-SUBROUTINE HydroDyn_C_Init(                                                            &
+SUBROUTINE HydroDyn_C_Init(  Handle_C,                                                  &
                SeaSt_InputFilePassed,                                                  &
                SeaSt_InputFileString_C,   SeaSt_InputFileStringLength_C,               &
                HD_InputFilePassed,                                                     &
@@ -222,6 +235,7 @@ SUBROUTINE HydroDyn_C_Init(
 !GCC$ ATTRIBUTES DLLEXPORT :: HydroDyn_C_Init
 #endif
 
+   integer(c_int),            intent(  out)  :: Handle_C                               !< Handle for the new instance (pass to all other HydroDyn_C_* routines)
    integer(c_int),            intent(in   )  :: SeaSt_InputFilePassed                  !< 0: pass the input file name; 1: pass the input file content
    type(c_ptr),               intent(in   )  :: SeaSt_InputFileString_C                !< SeaSt input file as a single string with lines deliniated by C_NULL_CHAR
    integer(c_int),            intent(in   )  :: SeaSt_InputFileStringLength_C          !< SeaSt length of the input file string
@@ -251,6 +265,7 @@ SUBROUTINE HydroDyn_C_Init(
    character(kind=c_char),    intent(  out)  :: ErrMsg_C(ErrMsgLen_C)                  !< Error message (C_NULL_CHAR terminated)
 
    ! Local Variables
+   type(HD_C_InstanceType),                                    pointer  :: Inst              !< Instance data for this handle
    character(IntfStrLen)                                                :: OutRootName       !< Root name to use for echo files and other
    character(kind=C_char, len=SeaSt_InputFileStringLength_C), pointer   :: SeaSt_InputFileString   !< Input file as a single string with NULL chracter separating lines
    character(kind=C_char, len=HD_InputFileStringLength_C), pointer      :: HD_InputFileString      !< Input file as a single string with NULL chracter separating lines
@@ -273,9 +288,13 @@ SUBROUTINE HydroDyn_C_Init(
    CALL DispCopyrightLicense( version%Name )
    CALL DispCompileRuntimeInfo( version%Name )
 
+   ! Create the instance.  The handle is returned even if initialization fails so
+   ! that HydroDyn_C_End can clean up whatever was allocated.
+   call NewInstance(Handle_C, Inst, ErrStat2, ErrMsg2);  if (Failed())  return
+
    ! Sanity checks on values passed
-   InterpOrder = int(InterpOrder_C, IntKi)
-   if ( InterpOrder < 1_IntKi .or. InterpOrder > 2_IntKi ) then
+   Inst%InterpOrder = int(InterpOrder_C, IntKi)
+   if ( Inst%InterpOrder < 1_IntKi .or. Inst%InterpOrder > 2_IntKi ) then
       ErrStat2 =  ErrID_Fatal
       ErrMsg2  =  "InterpOrder passed into HydroDyn_C must be 1 (linear) or 2 (quadratic)"
       if (Failed())  return
@@ -287,26 +306,26 @@ SUBROUTINE HydroDyn_C_Init(
    !--------------------------------------------------------------------------------------------------------------------------------
    ! Simulation time
    TimeInterval                  = REAL(DT_C,         DbKi)
-   dT_Global                     = TimeInterval                ! Assume this DT is constant for all simulation
-   N_Global                      = 0_IntKi                     ! Assume we are on timestep 0 at start
-   t_initial                     = REAL(T_Initial_C,  DbKi)
+   Inst%dT_Global                = TimeInterval                ! Assume this DT is constant for all simulation
+   Inst%N_Global                 = 0_IntKi                     ! Assume we are on timestep 0 at start
+   Inst%t_initial                = REAL(T_Initial_C,  DbKi)
 
    ! Number of bodies and initial positions
    !  -  NumNodePts is the number of interface Mesh points we are expecting on the python
    !     side.  Will validate this against what HD reads from the initialization info.
-   NumNodePts                    = int(NumNodePts_C, IntKi)
-   if (NumNodePts < 1) then
+   Inst%NumNodePts               = int(NumNodePts_C, IntKi)
+   if (Inst%NumNodePts < 1) then
       ErrStat2 =  ErrID_Fatal
       ErrMsg2  =  "At least one node point must be specified"
       if (Failed())  return
    endif
    ! Allocate temporary arrays to simplify data conversions
-   call AllocAry( tmpNodePos, 6, NumNodePts, "tmpNodePos", ErrStat2, ErrMsg2 );     if (Failed())  return
-   call AllocAry( tmpNodeVel, 6, NumNodePts, "tmpNodeVel", ErrStat2, ErrMsg2 );     if (Failed())  return
-   call AllocAry( tmpNodeAcc, 6, NumNodePts, "tmpNodeAcc", ErrStat2, ErrMsg2 );     if (Failed())  return
-   call AllocAry( tmpNodeFrc, 6, NumNodePts, "tmpNodeFrc", ErrStat2, ErrMsg2 );     if (Failed())  return
+   call AllocAry( Inst%tmpNodePos, 6, Inst%NumNodePts, "tmpNodePos", ErrStat2, ErrMsg2 );     if (Failed())  return
+   call AllocAry( Inst%tmpNodeVel, 6, Inst%NumNodePts, "tmpNodeVel", ErrStat2, ErrMsg2 );     if (Failed())  return
+   call AllocAry( Inst%tmpNodeAcc, 6, Inst%NumNodePts, "tmpNodeAcc", ErrStat2, ErrMsg2 );     if (Failed())  return
+   call AllocAry( Inst%tmpNodeFrc, 6, Inst%NumNodePts, "tmpNodeFrc", ErrStat2, ErrMsg2 );     if (Failed())  return
    ! structural mesh reference position
-   tmpNodePos(1:6,1:NumNodePts)   = reshape( real(InitNodePositions_C(1:6*NumNodePts),ReKi), (/6,NumNodePts/) )
+   Inst%tmpNodePos(1:6,1:Inst%NumNodePts)   = reshape( real(InitNodePositions_C(1:6*Inst%NumNodePts),ReKi), (/6,Inst%NumNodePts/) )
 
    !----------------------------------------------------
    ! Allocate input array u and corresponding InputTimes for SeaState and HD
@@ -316,18 +335,18 @@ SUBROUTINE HydroDyn_C_Init(
    !        u(1)  inputs at t
    !        u(2)  inputs at t -   dt
    !        u(3)  inputs at t - 2*dt      ! quadratic only
-   allocate(HD%u(InterpOrder+1), STAT=ErrStat2)
+   allocate(Inst%HD%u(Inst%InterpOrder+1), STAT=ErrStat2)
       if (ErrStat2 /= 0) then
          ErrStat2 = ErrID_Fatal
          ErrMsg2  = "Could not allocate inuput"
          if (Failed())  return
       endif
-   call AllocAry( InputTimes, InterpOrder+1, "InputTimes", ErrStat2, ErrMsg2 );  if (Failed())  return
+   call AllocAry( Inst%InputTimes, Inst%InterpOrder+1, "InputTimes", ErrStat2, ErrMsg2 );  if (Failed())  return
 
    !----------------------------------------------------
    ! Allocate arrays for HD added mass matrix
-   call AllocAry(  perturbed,                 NumNodePts,  "perturbed", ErrStat2, ErrMsg2 );     if (Failed())  return
-   call AllocAry( tmpNodeAdm, 6*NumNodePts, 6*NumNodePts, "tmpNodeAdm", ErrStat2, ErrMsg2 );     if (Failed())  return
+   call AllocAry(  Inst%perturbed,                 Inst%NumNodePts,  "perturbed", ErrStat2, ErrMsg2 );     if (Failed())  return
+   call AllocAry( Inst%tmpNodeAdm, 6*Inst%NumNodePts, 6*Inst%NumNodePts, "tmpNodeAdm", ErrStat2, ErrMsg2 );     if (Failed())  return
 
    !--------------------------------------------------------------------------------------------------------------------------------
    ! SeaState initialize
@@ -339,17 +358,17 @@ SUBROUTINE HydroDyn_C_Init(
    ! Format SeaSt input file contents
    if (SeaSt_InputFilePassed==1_c_int) then
       ! Get the data to pass to SeaSt%Init
-      SeaSt%InitInp%InputFile       = "passed_SeaSt_file"      ! dummy
-      SeaSt%InitInp%UseInputFile    = .FALSE.                  ! this probably should be passed in
-      call InitFileInfo(SeaSt_InputFileString, SeaSt%InitInp%PassedFileData, ErrStat2, ErrMsg2);   if (Failed())  return
+      Inst%SeaSt%InitInp%InputFile       = "passed_SeaSt_file"      ! dummy
+      Inst%SeaSt%InitInp%UseInputFile    = .FALSE.                  ! this probably should be passed in
+      call InitFileInfo(SeaSt_InputFileString, Inst%SeaSt%InitInp%PassedFileData, ErrStat2, ErrMsg2);   if (Failed())  return
    else
       i = min(IntfStrLen,SeaSt_InputFileStringLength_C)
       TmpFileName = ''
       TmpFileName(1:i) = SeaSt_InputFileString(1:i)
       i = INDEX(TmpFileName,C_NULL_CHAR) - 1                ! if this has a c null character at the end...
       if ( i > 0 ) TmpFileName = TmpFileName(1:I)           ! remove it
-      SeaSt%InitInp%InputFile  = TmpFileName
-      SeaSt%InitInp%UseInputFile    = .TRUE.
+      Inst%SeaSt%InitInp%InputFile  = TmpFileName
+      Inst%SeaSt%InitInp%UseInputFile    = .TRUE.
    endif
 
    ! For diagnostic purposes, the following can be used to display the contents
@@ -358,31 +377,31 @@ SUBROUTINE HydroDyn_C_Init(
    !call Print_FileInfo_Struct( CU, SeaSt%InitInp%PassedFileData )
 
    ! Set other inputs for calling SeaState_Init
-   SeaSt%InitInp%hasIce          = .FALSE.                  ! Always keep at false unless interfacing to ice modules
+   Inst%SeaSt%InitInp%hasIce          = .FALSE.                  ! Always keep at false unless interfacing to ice modules
 
    ! Linearization
    !     for now, set linearization to false. Pass this in later when interface supports it
    !     Note: we may want to linearize at T=0 for added mass effects, but that might be
    !        special case
-   HD%InitInp%Linearize             = .FALSE.
+   Inst%HD%InitInp%Linearize             = .FALSE.
 
    ! RootName -- for output of echo or other files
    OutRootName = TRANSFER( OutRootName_C, OutRootName )
    i = INDEX(OutRootName,C_NULL_CHAR) - 1             ! if this has a c null character at the end...
    if ( i > 0 ) OutRootName = OutRootName(1:I)        ! remove it
-   SeaSt%InitInp%OutRootName = trim(OutRootName)//".SEA"
+   Inst%SeaSt%InitInp%OutRootName = trim(OutRootName)//".SEA"
 
    ! Values passed in
-   SeaSt%InitInp%Gravity         = REAL(Gravity_C,    ReKi)
-   SeaSt%InitInp%defWtrDens      = REAL(defWtrDens_C, ReKi)    ! use values from SeaState
-   SeaSt%InitInp%defWtrDpth      = REAL(defWtrDpth_C, ReKi)    ! use values from SeaState
-   SeaSt%InitInp%defMSL2SWL      = REAL(defMSL2SWL_C, ReKi)    ! use values from SeaState
-   SeaSt%InitInp%TMax            = REAL(TMax_C,       DbKi)
+   Inst%SeaSt%InitInp%Gravity         = REAL(Gravity_C,    ReKi)
+   Inst%SeaSt%InitInp%defWtrDens      = REAL(defWtrDens_C, ReKi)    ! use values from SeaState
+   Inst%SeaSt%InitInp%defWtrDpth      = REAL(defWtrDpth_C, ReKi)    ! use values from SeaState
+   Inst%SeaSt%InitInp%defMSL2SWL      = REAL(defMSL2SWL_C, ReKi)    ! use values from SeaState
+   Inst%SeaSt%InitInp%TMax            = REAL(TMax_C,       DbKi)
 
    ! Platform reference position
    !     This is only specified as an (X,Y) position (no Z).
-   SeaSt%InitInp%PtfmLocationX         = REAL(PtfmRefPtPositionX_C, ReKi)
-   SeaSt%InitInp%PtfmLocationY         = REAL(PtfmRefPtPositionY_C, ReKi)
+   Inst%SeaSt%InitInp%PtfmLocationX         = REAL(PtfmRefPtPositionX_C, ReKi)
+   Inst%SeaSt%InitInp%PtfmLocationY         = REAL(PtfmRefPtPositionY_C, ReKi)
 
    
    ! Wave elevation output
@@ -392,9 +411,9 @@ SUBROUTINE HydroDyn_C_Init(
    ! Skipping this for now.  Maybe add later.
    !SeaSt%InitInp%WaveElevXY
 
-   call SeaSt_Init( SeaSt%InitInp, SeaSt%u, SeaSt%p, SeaSt%x, SeaSt%xd, SeaSt%z, SeaSt%OtherStates, SeaSt%y, SeaSt%m, TimeInterval, SeaSt%InitOutData, ErrStat, ErrMsg )
+   call SeaSt_Init( Inst%SeaSt%InitInp, Inst%SeaSt%u, Inst%SeaSt%p, Inst%SeaSt%x, Inst%SeaSt%xd, Inst%SeaSt%z, Inst%SeaSt%OtherStates, Inst%SeaSt%y, Inst%SeaSt%m, TimeInterval, Inst%SeaSt%InitOutData, ErrStat, ErrMsg )
       if (Failed())  return
-   SeaSt%Initialized = .true.
+   Inst%SeaSt%Initialized = .true.
 
 
 
@@ -408,17 +427,17 @@ SUBROUTINE HydroDyn_C_Init(
    ! Format HD input file contents
    if (HD_InputFilePassed==1_c_int) then
       ! Get the data to pass to HD%InitInp
-      HD%InitInp%InputFile             = "passed_hd_file"         ! dummy
-      HD%InitInp%UseInputFile          = .FALSE.                  ! this probably should be passed in
-      call InitFileInfo(HD_InputFileString, HD%InitInp%PassedFileData, ErrStat2, ErrMsg2);   if (Failed())  return
+      Inst%HD%InitInp%InputFile             = "passed_hd_file"         ! dummy
+      Inst%HD%InitInp%UseInputFile          = .FALSE.                  ! this probably should be passed in
+      call InitFileInfo(HD_InputFileString, Inst%HD%InitInp%PassedFileData, ErrStat2, ErrMsg2);   if (Failed())  return
    else
       i = min(IntfStrLen, HD_InputFileStringLength_C)
       TmpFileName = ''
       TmpFileName(1:i) = HD_InputFileString(1:i)
       i = INDEX(TmpFileName,C_NULL_CHAR) - 1                ! if this has a c null character at the end...
       if ( i > 0 ) TmpFileName = TmpFileName(1:I)           ! remove it
-      HD%InitInp%InputFile  = TmpFileName
-      HD%InitInp%UseInputFile    = .TRUE.
+      Inst%HD%InitInp%InputFile  = TmpFileName
+      Inst%HD%InitInp%UseInputFile    = .TRUE.
    endif
 
    ! For diagnostic purposes, the following can be used to display the contents
@@ -431,17 +450,17 @@ SUBROUTINE HydroDyn_C_Init(
    !     for now, set linearization to false. Pass this in later when interface supports it
    !     Note: we may want to linearize at T=0 for added mass effects, but that might be
    !        special case
-   HD%InitInp%Linearize             = .FALSE.
+   Inst%HD%InitInp%Linearize             = .FALSE.
 
    ! RootName -- for output of echo or other files
    OutRootName = TRANSFER( OutRootName_C, OutRootName )
    i = INDEX(OutRootName,C_NULL_CHAR) - 1             ! if this has a c null character at the end...
    if ( i > 0 ) OutRootName = OutRootName(1:I)        ! remove it
-   HD%InitInp%OutRootName = trim(OutRootName)//".HD"
+   Inst%HD%InitInp%OutRootName = trim(OutRootName)//".HD"
 
    ! Values passed in
-   HD%InitInp%Gravity            = REAL(Gravity_C,    ReKi)
-   HD%InitInp%TMax               = REAL(TMax_C,       DbKi)
+   Inst%HD%InitInp%Gravity            = REAL(Gravity_C,    ReKi)
+   Inst%HD%InitInp%TMax               = REAL(TMax_C,       DbKi)
 
 !FIXME: initial platform position does not work!!!
    ! Initial platform position
@@ -449,9 +468,9 @@ SUBROUTINE HydroDyn_C_Init(
 
    ! Transfer data from SeaState
    ! Need to set up other module's InitInput data here because we will also need to clean up SeaState data and would rather not defer that cleanup
-   HD%InitInp%InvalidWithSSExctn = SeaSt%InitOutData%InvalidWithSSExctn
+   Inst%HD%InitInp%InvalidWithSSExctn = Inst%SeaSt%InitOutData%InvalidWithSSExctn
 
-   HD%InitInp%WaveField      => SeaSt%InitOutData%WaveField ! can be set regardless of association(); if not associated, HD shouldn't work
+   Inst%HD%InitInp%WaveField      => Inst%SeaSt%InitOutData%WaveField ! can be set regardless of association(); if not associated, HD shouldn't work
 
 
    !-------------------------------------------------------------
@@ -460,9 +479,9 @@ SUBROUTINE HydroDyn_C_Init(
    !
    !     NOTE: Pass u(1) only (this is empty and will be set inside Init).  We will copy
    !           this to u(2) and u(3) afterwards
-   call HydroDyn_Init( HD%InitInp, HD%u(1), HD%p, HD%x(STATE_CURR), HD%xd(STATE_CURR), HD%z(STATE_CURR), HD%OtherStates(STATE_CURR), HD%y, HD%m, TimeInterval, HD%InitOutData, ErrStat2, ErrMsg2 )
+   call HydroDyn_Init( Inst%HD%InitInp, Inst%HD%u(1), Inst%HD%p, Inst%HD%x(STATE_CURR), Inst%HD%xd(STATE_CURR), Inst%HD%z(STATE_CURR), Inst%HD%OtherStates(STATE_CURR), Inst%HD%y, Inst%HD%m, TimeInterval, Inst%HD%InitOutData, ErrStat2, ErrMsg2 )
       if (Failed())  return
-   HD%Initialized = .true.
+   Inst%HD%Initialized = .true.
 
 
    !-------------------------------------------------------------
@@ -478,29 +497,29 @@ SUBROUTINE HydroDyn_C_Init(
    !     for the first and second time steps.  (The interpolation order in the ExtrapInput routines are determined as
    !     order = SIZE(Input)
    !-------------------------------------------------------------
-   do i=2,InterpOrder+1
-      call HydroDyn_CopyInput (HD%u(1),  HD%u(i),  MESH_NEWCOPY, Errstat2, ErrMsg2)
+   do i=2,Inst%InterpOrder+1
+      call HydroDyn_CopyInput (Inst%HD%u(1),  Inst%HD%u(i),  MESH_NEWCOPY, Errstat2, ErrMsg2)
          if (Failed())  return
    enddo
-   do i = 1, InterpOrder + 1
-      InputTimes(i) = t_initial - (i - 1) * dT_Global
+   do i = 1, Inst%InterpOrder + 1
+      Inst%InputTimes(i) = Inst%t_initial - (i - 1) * Inst%dT_Global
    enddo
-   InputTimePrev = InputTimes(1) - dT_Global    ! Initialize for UpdateStates
+   Inst%InputTimePrev = Inst%InputTimes(1) - Inst%dT_Global    ! Initialize for UpdateStates
 
 
    !-------------------------------------------------------------
    ! Initial setup of other pieces of x,xd,z,OtherStates
-   CALL HydroDyn_CopyContState  ( HD%x(          STATE_CURR), HD%x(          STATE_PRED), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
-   CALL HydroDyn_CopyDiscState  ( HD%xd(         STATE_CURR), HD%xd(         STATE_PRED), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
-   CALL HydroDyn_CopyConstrState( HD%z(          STATE_CURR), HD%z(          STATE_PRED), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
-   CALL HydroDyn_CopyOtherState ( HD%OtherStates(STATE_CURR), HD%OtherStates(STATE_PRED), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
+   CALL HydroDyn_CopyContState  ( Inst%HD%x(          STATE_CURR), Inst%HD%x(          STATE_PRED), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
+   CALL HydroDyn_CopyDiscState  ( Inst%HD%xd(         STATE_CURR), Inst%HD%xd(         STATE_PRED), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
+   CALL HydroDyn_CopyConstrState( Inst%HD%z(          STATE_CURR), Inst%HD%z(          STATE_PRED), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
+   CALL HydroDyn_CopyOtherState ( Inst%HD%OtherStates(STATE_CURR), Inst%HD%OtherStates(STATE_PRED), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
 
    !-------------------------------------------------------------
    ! Setup the previous timestep copies of states
-   CALL HydroDyn_CopyContState  ( HD%x(          STATE_CURR), HD%x(          STATE_LAST), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
-   CALL HydroDyn_CopyDiscState  ( HD%xd(         STATE_CURR), HD%xd(         STATE_LAST), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
-   CALL HydroDyn_CopyConstrState( HD%z(          STATE_CURR), HD%z(          STATE_LAST), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
-   CALL HydroDyn_CopyOtherState ( HD%OtherStates(STATE_CURR), HD%OtherStates(STATE_LAST), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
+   CALL HydroDyn_CopyContState  ( Inst%HD%x(          STATE_CURR), Inst%HD%x(          STATE_LAST), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
+   CALL HydroDyn_CopyDiscState  ( Inst%HD%xd(         STATE_CURR), Inst%HD%xd(         STATE_LAST), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
+   CALL HydroDyn_CopyConstrState( Inst%HD%z(          STATE_CURR), Inst%HD%z(          STATE_LAST), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
+   CALL HydroDyn_CopyOtherState ( Inst%HD%OtherStates(STATE_CURR), Inst%HD%OtherStates(STATE_LAST), MESH_NEWCOPY, Errstat2, ErrMsg2);    if (Failed())  return
 
 
 
@@ -514,28 +533,28 @@ SUBROUTINE HydroDyn_C_Init(
    !-------------------------------------------------------------
    !  Set output channel information for driver code
    ! Number of channels
-   if (allocated(SeaSt%InitOutData%WriteOutputHdr))   NChanSS = size(SeaSt%InitOutData%WriteOutputHdr)
-   if (allocated(HD%InitOutData%WriteOutputHdr))      NChanHD = size(HD%InitOutData%WriteOutputHdr)
+   if (allocated(Inst%SeaSt%InitOutData%WriteOutputHdr))   NChanSS = size(Inst%SeaSt%InitOutData%WriteOutputHdr)
+   if (allocated(Inst%HD%InitOutData%WriteOutputHdr))      NChanHD = size(Inst%HD%InitOutData%WriteOutputHdr)
    NumChannels_C = NChanSS + NChanHD
 
    ! transfer the output channel names and units to c_char arrays for returning
    !     Upgrade idea:  use C_NULL_CHAR as delimiters.  Requires rework of Python
    !                    side of code.
    k=1
-   if (allocated(SeaSt%InitOutData%WriteOutputHdr)) then
-      do i=1,size(SeaSt%InitOutData%WriteOutputHdr)
+   if (allocated(Inst%SeaSt%InitOutData%WriteOutputHdr)) then
+      do i=1,size(Inst%SeaSt%InitOutData%WriteOutputHdr)
          do j=1,ChanLen    ! max length of channel name.  Same for units
-            OutputChannelNames_C(k)=SeaSt%InitOutData%WriteOutputHdr(i)(j:j)
-            OutputChannelUnits_C(k)=SeaSt%InitOutData%WriteOutputUnt(i)(j:j)
+            OutputChannelNames_C(k)=Inst%SeaSt%InitOutData%WriteOutputHdr(i)(j:j)
+            OutputChannelUnits_C(k)=Inst%SeaSt%InitOutData%WriteOutputUnt(i)(j:j)
             k=k+1
          enddo
       enddo
    endif
-   if (allocated(HD%InitOutData%WriteOutputHdr)) then
-      do i=1,size(HD%InitOutData%WriteOutputHdr)
+   if (allocated(Inst%HD%InitOutData%WriteOutputHdr)) then
+      do i=1,size(Inst%HD%InitOutData%WriteOutputHdr)
          do j=1,ChanLen    ! max length of channel name.  Same for units
-            OutputChannelNames_C(k)=HD%InitOutData%WriteOutputHdr(i)(j:j)
-            OutputChannelUnits_C(k)=HD%InitOutData%WriteOutputUnt(i)(j:j)
+            OutputChannelNames_C(k)=Inst%HD%InitOutData%WriteOutputHdr(i)(j:j)
+            OutputChannelUnits_C(k)=Inst%HD%InitOutData%WriteOutputUnt(i)(j:j)
             k=k+1
          enddo
       enddo
@@ -559,12 +578,13 @@ CONTAINS
    end function Failed
 
    subroutine FailCleanup()
-      if (allocated(tmpNodePos))    deallocate(tmpNodePos)
-      if (allocated(tmpNodeVel))    deallocate(tmpNodeVel)
-      if (allocated(tmpNodeAcc))    deallocate(tmpNodeAcc)
-      if (allocated(tmpNodeFrc))    deallocate(tmpNodeFrc)
-      if (allocated(tmpNodeAdm))    deallocate(tmpNodeAdm)
-      if (allocated(perturbed ))    deallocate(perturbed )
+      if (.not. associated(Inst))         return
+      if (allocated(Inst%tmpNodePos))    deallocate(Inst%tmpNodePos)
+      if (allocated(Inst%tmpNodeVel))    deallocate(Inst%tmpNodeVel)
+      if (allocated(Inst%tmpNodeAcc))    deallocate(Inst%tmpNodeAcc)
+      if (allocated(Inst%tmpNodeFrc))    deallocate(Inst%tmpNodeFrc)
+      if (allocated(Inst%tmpNodeAdm))    deallocate(Inst%tmpNodeAdm)
+      if (allocated(Inst%perturbed ))    deallocate(Inst%perturbed )
    end subroutine FailCleanup
 
    !> This subroutine sets the interface meshes to map to the input motions to the HD
@@ -583,9 +603,9 @@ CONTAINS
       ! Motion mesh
       !     This point mesh may contain more than one point. Mapping will be used to map
       !     this to the input meshes for WAMIT and Morison.
-      call MeshCreate(  HD_MotionMesh                       ,  &
+      call MeshCreate(  Inst%HD_MotionMesh                       ,  &
                         IOS              = COMPONENT_INPUT  ,  &
-                        Nnodes           = NumNodePts       ,  &
+                        Nnodes           = Inst%NumNodePts       ,  &
                         ErrStat          = ErrStat3         ,  &
                         ErrMess          = ErrMsg3          ,  &
                         TranslationDisp  = .TRUE.,    Orientation = .TRUE., &
@@ -593,26 +613,26 @@ CONTAINS
                         TranslationAcc   = .TRUE.,    RotationAcc = .TRUE.  )
          if (ErrStat3 >= AbortErrLev) return
 
-      do iNode=1,NumNodePts
+      do iNode=1,Inst%NumNodePts
          ! initial position and orientation of node
-         InitPos  = tmpNodePos(1:3,iNode)
-         theta    = real(tmpNodePos(4:6,iNode),DbKi)    ! convert ReKi to DbKi to avoid roundoff
+         InitPos  = Inst%tmpNodePos(1:3,iNode)
+         theta    = real(Inst%tmpNodePos(4:6,iNode),DbKi)    ! convert ReKi to DbKi to avoid roundoff
          Orient = EulerConstructZYX(theta)
-         call MeshPositionNode(  HD_MotionMesh            , &
+         call MeshPositionNode(  Inst%HD_MotionMesh            , &
                                  iNode                    , &
                                  InitPos                  , &  ! position
                                  ErrStat3, ErrMsg3        , &
                                  Orient                     )  ! orientation
             if (ErrStat3 >= AbortErrLev) return
 
-         call MeshConstructElement ( HD_MotionMesh, ELEMENT_POINT, ErrStat3, ErrMsg3, iNode )
+         call MeshConstructElement ( Inst%HD_MotionMesh, ELEMENT_POINT, ErrStat3, ErrMsg3, iNode )
             if (ErrStat3 >= AbortErrLev) return
       enddo
 
-      call MeshCommit ( HD_MotionMesh, ErrStat3, ErrMsg3 )
+      call MeshCommit ( Inst%HD_MotionMesh, ErrStat3, ErrMsg3 )
          if (ErrStat3 >= AbortErrLev) return
 
-      HD_MotionMesh%RemapFlag  = .TRUE.
+      Inst%HD_MotionMesh%RemapFlag  = .TRUE.
 
       ! For checking the mesh, uncomment this.
       !     note: CU is is output unit (platform dependent).
@@ -623,8 +643,8 @@ CONTAINS
       !     This point mesh may contain more than one point. Mapping will be used to map
       !     the loads from output meshes for WAMIT and Morison.
       ! Output mesh for loads at each WAMIT body
-      CALL MeshCopy( SrcMesh  = HD_MotionMesh      ,&
-                     DestMesh = HD_LoadMesh        ,&
+      CALL MeshCopy( SrcMesh  = Inst%HD_MotionMesh      ,&
+                     DestMesh = Inst%HD_LoadMesh        ,&
                      CtrlCode = MESH_SIBLING       ,&
                      IOS      = COMPONENT_OUTPUT   ,&
                      ErrStat  = ErrStat3           ,&
@@ -633,7 +653,7 @@ CONTAINS
                      Moment   = .TRUE.             )
          if (ErrStat3 >= AbortErrLev) return
 
-      HD_LoadMesh%RemapFlag  = .TRUE.
+      Inst%HD_LoadMesh%RemapFlag  = .TRUE.
 
       ! For checking the mesh, uncomment this.
       !     note: CU is is output unit (platform dependent).
@@ -644,8 +664,8 @@ CONTAINS
       !     This point mesh may contain more than one point. Mapping will be used to map
       !     the loads from output meshes for WAMIT and Morison.
       ! Output mesh for loads at each WAMIT body
-      CALL MeshCopy( SrcMesh  = HD_LoadMesh        ,&
-                     DestMesh = HD_LoadMesh_tmp    ,&
+      CALL MeshCopy( SrcMesh  = Inst%HD_LoadMesh        ,&
+                     DestMesh = Inst%HD_LoadMesh_tmp    ,&
                      CtrlCode = MESH_COUSIN        ,&
                      IOS      = COMPONENT_OUTPUT   ,&
                      ErrStat  = ErrStat3           ,&
@@ -654,7 +674,7 @@ CONTAINS
                      Moment   = .TRUE.             )
          if (ErrStat3 >= AbortErrLev) return
 
-      HD_LoadMesh_tmp%RemapFlag  = .TRUE.
+      Inst%HD_LoadMesh_tmp%RemapFlag  = .TRUE.
 
       ! For checking the mesh, uncomment this.
       !     note: CU is is output unit (platform dependent).
@@ -663,24 +683,24 @@ CONTAINS
       !-------------------------------------------------------------
       ! Set the mapping meshes
       !     PRP - principle reference point
-      call MeshMapCreate( HD_MotionMesh, HD%u(1)%PRPMesh, Map_Motion_2_HD_PRP_P, ErrStat3, ErrMsg3 )
+      call MeshMapCreate( Inst%HD_MotionMesh, Inst%HD%u(1)%PRPMesh, Inst%Map_Motion_2_HD_PRP_P, ErrStat3, ErrMsg3 )
          if (ErrStat3 >= AbortErrLev) return
       !     WAMIT - floating bodies using potential flow
-      if ( HD%u(1)%WAMITMesh%Committed ) then      ! input motions
-         call MeshMapCreate( HD_MotionMesh, HD%u(1)%WAMITMesh, Map_Motion_2_HD_WB_P, ErrStat3, ErrMsg3 )
+      if ( Inst%HD%u(1)%WAMITMesh%Committed ) then      ! input motions
+         call MeshMapCreate( Inst%HD_MotionMesh, Inst%HD%u(1)%WAMITMesh, Inst%Map_Motion_2_HD_WB_P, ErrStat3, ErrMsg3 )
             if (ErrStat3 >= AbortErrLev) return
       endif
-      if (    HD%y%WAMITMesh%Committed ) then      ! output loads
-         call MeshMapCreate( HD%y%WAMITMesh, HD_LoadMesh, Map_HD_WB_P_2_Load, ErrStat3, ErrMsg3 )
+      if (    Inst%HD%y%WAMITMesh%Committed ) then      ! output loads
+         call MeshMapCreate( Inst%HD%y%WAMITMesh, Inst%HD_LoadMesh, Inst%Map_HD_WB_P_2_Load, ErrStat3, ErrMsg3 )
             if (ErrStat3 >= AbortErrLev) return
       endif
       !     Morison - nodes for strip theory
-      if ( HD%u(1)%Morison%Mesh%Committed ) then  ! input motions
-         call MeshMapCreate( HD_MotionMesh, HD%u(1)%Morison%Mesh, Map_Motion_2_HD_Mo_P, ErrStat3, ErrMsg3 )
+      if ( Inst%HD%u(1)%Morison%Mesh%Committed ) then  ! input motions
+         call MeshMapCreate( Inst%HD_MotionMesh, Inst%HD%u(1)%Morison%Mesh, Inst%Map_Motion_2_HD_Mo_P, ErrStat3, ErrMsg3 )
             if (ErrStat3 >= AbortErrLev) return
       endif
-      if (    HD%y%Morison%Mesh%Committed ) then   ! output loads
-         call MeshMapCreate( HD%y%Morison%Mesh, HD_LoadMesh, Map_HD_Mo_P_2_Load, ErrStat3, ErrMsg3 )
+      if (    Inst%HD%y%Morison%Mesh%Committed ) then   ! output loads
+         call MeshMapCreate( Inst%HD%y%Morison%Mesh, Inst%HD_LoadMesh, Inst%Map_HD_Mo_P_2_Load, ErrStat3, ErrMsg3 )
             if (ErrStat3 >= AbortErrLev) return
       endif
 
@@ -701,19 +721,19 @@ CONTAINS
       character(ErrMsgLen),   intent(  out)  :: ErrMsg3     !< temporary error message
       ErrStat3 = ErrID_None
       ErrMsg3  = ""
-      if ( NumNodePts > 1 ) then
-         if ( HD%u(1)%Morison%Mesh%Committed .and. HD%u(1)%WAMITMesh%Committed ) then
-            if ( (HD%u(1)%Morison%Mesh%Nnodes + HD%u(1)%WAMITMesh%Nnodes) < 2_IntKi) then
+      if ( Inst%NumNodePts > 1 ) then
+         if ( Inst%HD%u(1)%Morison%Mesh%Committed .and. Inst%HD%u(1)%WAMITMesh%Committed ) then
+            if ( (Inst%HD%u(1)%Morison%Mesh%Nnodes + Inst%HD%u(1)%WAMITMesh%Nnodes) < 2_IntKi) then
                ErrStat3 = ErrID_Fatal
                ErrMsg3  = "More than one node passed into library, but only one HydroDyn node exists."
             endif
-         elseif ( HD%u(1)%Morison%Mesh%Committed ) then     ! No WAMIT
-            if ( HD%u(1)%Morison%Mesh%Nnodes < 2_IntKi ) then
+         elseif ( Inst%HD%u(1)%Morison%Mesh%Committed ) then     ! No WAMIT
+            if ( Inst%HD%u(1)%Morison%Mesh%Nnodes < 2_IntKi ) then
                ErrStat3 = ErrID_Fatal
                ErrMsg3  = "More than one node passed into library, but only one HydroDyn node exists on Morison mesh."
             endif
-         elseif ( HD%u(1)%WAMITMesh%Committed    ) then     ! No Morison
-            if ( HD%u(1)%WAMITMesh%Nnodes  < 2_IntKi ) then
+         elseif ( Inst%HD%u(1)%WAMITMesh%Committed    ) then     ! No Morison
+            if ( Inst%HD%u(1)%WAMITMesh%Nnodes  < 2_IntKi ) then
                ErrStat3 = ErrID_Fatal
                ErrMsg3  = "More than one node passed into library, but only one HydroDyn node exists on the WAMIT mesh."
             endif
@@ -733,15 +753,15 @@ CONTAINS
       real(ReKi)                             :: tmpZpos     !< temporary z-position
       ErrStat3 = ErrID_None
       ErrMsg3  = ""
-      tmpZpos=-0.001_ReKi*abs(HD%p%WaveField%EffWtrDpth)                    ! Initial comparison value close to surface
-      if ( NumNodePts == 1 .and. HD%u(1)%Morison%Mesh%Committed ) then
-         do i=1,HD%u(1)%Morison%Mesh%Nnodes
+      tmpZpos=-0.001_ReKi*abs(Inst%HD%p%WaveField%EffWtrDpth)                    ! Initial comparison value close to surface
+      if ( Inst%NumNodePts == 1 .and. Inst%HD%u(1)%Morison%Mesh%Committed ) then
+         do i=1,Inst%HD%u(1)%Morison%Mesh%Nnodes
             ! Find lowest Morison node
-            if (HD%u(1)%Morison%Mesh%Position(3,i) < tmpZpos) then
-               tmpZpos = HD%u(1)%Morison%Mesh%Position(3,i)
+            if (Inst%HD%u(1)%Morison%Mesh%Position(3,i) < tmpZpos) then
+               tmpZpos = Inst%HD%u(1)%Morison%Mesh%Position(3,i)
             endif
          enddo
-         if (tmpZpos < -abs(HD%p%WaveField%EffWtrDpth)*0.9_ReKi) then       ! within 10% of the seafloor
+         if (tmpZpos < -abs(Inst%HD%p%WaveField%EffWtrDpth)*0.9_ReKi) then       ! within 10% of the seafloor
             ErrStat3 = ErrID_Severe
             ErrMsg3  = "Inconsistent model"//NewLine//"   -- Single library input node for simulating rigid floating structure."//  &
                         NewLine//"   -- Lowest Morison node is is in lowest 10% of water depth indicating fixed bottom structure from HydroDyn."// &
@@ -757,24 +777,26 @@ END SUBROUTINE HydroDyn_C_Init
 !--------------------------------------------- HydroDyn CalcOutput ---------------------------------------------
 !===============================================================================================================
 
-SUBROUTINE HydroDyn_C_CalcOutput(Time_C, NumNodePts_C, NodePos_C, NodeVel_C, NodeAcc_C, &
+SUBROUTINE HydroDyn_C_CalcOutput(Handle_C, Time_C, NumNodePts_C, NodePos_C, NodeVel_C, NodeAcc_C, &
                NodeFrc_C, OutputChannelValues_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='HydroDyn_C_CalcOutput')
    implicit none
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: HydroDyn_C_CalcOutput
 !GCC$ ATTRIBUTES DLLEXPORT :: HydroDyn_C_CalcOutput
 #endif
+   integer(c_int),            intent(in   )  :: Handle_C                      !< Instance handle from HydroDyn_C_Init
    real(c_double),            intent(in   )  :: Time_C
    integer(c_int),            intent(in   )  :: NumNodePts_C                 !< Number of mesh points we are transfering motions to and output loads to
    real(c_float),             intent(in   )  :: NodePos_C( 6*NumNodePts_C )  !< A 6xNumNodePts_C array [x,y,z,Rx,Ry,Rz]          -- positions (global)
    real(c_float),             intent(in   )  :: NodeVel_C( 6*NumNodePts_C )  !< A 6xNumNodePts_C array [Vx,Vy,Vz,RVx,RVy,RVz]    -- velocities (global)
    real(c_float),             intent(in   )  :: NodeAcc_C( 6*NumNodePts_C )  !< A 6xNumNodePts_C array [Ax,Ay,Az,RAx,RAy,RAz]    -- accelerations (global)
    real(c_float),             intent(  out)  :: NodeFrc_C( 6*NumNodePts_C )  !< A 6xNumNodePts_C array [Fx,Fy,Fz,Mx,My,Mz]       -- forces and moments (global)
-   real(c_float),             intent(  out)  :: OutputChannelValues_C(SeaSt%p%NumOuts+HD%p%NumOuts)
+   real(c_float),             intent(  out)  :: OutputChannelValues_C(*)    !< SeaState followed by HydroDyn output channels
    integer(c_int),            intent(  out)  :: ErrStat_C
    character(kind=c_char),    intent(  out)  :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local variables
+   type(HD_C_InstanceType),   pointer        :: Inst                          !< Instance data for this handle
    real(DbKi)                                :: Time
    integer(IntKi)                            :: iNode,i,k
    integer(IntKi)                            :: ErrStat                       !< aggregated error status
@@ -787,8 +809,10 @@ SUBROUTINE HydroDyn_C_CalcOutput(Time_C, NumNodePts_C, NodePos_C, NodeVel_C, Nod
    ErrStat  =  ErrID_None
    ErrMsg   =  ""
 
+   call GetInstance(Handle_C, Inst, ErrStat2, ErrMsg2);  if (Failed())  return
+
    ! Sanity check -- number of node points cannot change
-   if ( NumNodePts /= int(NumNodePts_C, IntKi) ) then
+   if ( Inst%NumNodePts /= int(NumNodePts_C, IntKi) ) then
       ErrStat2 =  ErrID_Fatal
       ErrMsg2  =  "Number of node points passed in changed.  This must be constant throughout simulation"
       if (Failed())  return
@@ -798,47 +822,47 @@ SUBROUTINE HydroDyn_C_CalcOutput(Time_C, NumNodePts_C, NodePos_C, NodeVel_C, Nod
    Time = REAL(Time_C,DbKi)
 
    ! Reshape position, velocity, acceleration
-   tmpNodePos(1:6,1:NumNodePts)   = reshape( real(NodePos_C(1:6*NumNodePts),ReKi), (/6,NumNodePts/) )
-   tmpNodeVel(1:6,1:NumNodePts)   = reshape( real(NodeVel_C(1:6*NumNodePts),ReKi), (/6,NumNodePts/) )
-   tmpNodeAcc(1:6,1:NumNodePts)   = reshape( real(NodeAcc_C(1:6*NumNodePts),ReKi), (/6,NumNodePts/) )
+   Inst%tmpNodePos(1:6,1:Inst%NumNodePts)   = reshape( real(NodePos_C(1:6*Inst%NumNodePts),ReKi), (/6,Inst%NumNodePts/) )
+   Inst%tmpNodeVel(1:6,1:Inst%NumNodePts)   = reshape( real(NodeVel_C(1:6*Inst%NumNodePts),ReKi), (/6,Inst%NumNodePts/) )
+   Inst%tmpNodeAcc(1:6,1:Inst%NumNodePts)   = reshape( real(NodeAcc_C(1:6*Inst%NumNodePts),ReKi), (/6,Inst%NumNodePts/) )
 
 
    ! Transfer motions to input meshes
-   call Set_MotionMesh()           ! update motion mesh with input motion arrays
-   call HD_SetInputMotion( HD%u(1), ErrStat2, ErrMsg2 )  ! transfer input motion mesh to u(1) meshes
+   call Set_MotionMesh(Inst)           ! update motion mesh with input motion arrays
+   call HD_SetInputMotion( Inst, Inst%HD%u(1), ErrStat2, ErrMsg2 )  ! transfer input motion mesh to u(1) meshes
       if (Failed())  return
 
 
    ! Call the main subroutine HydroDyn_CalcOutput to get the resulting forces and moments at time T
-   CALL HydroDyn_CalcOutput( Time, HD%u(1), HD%p, HD%x(STATE_CURR), HD%xd(STATE_CURR), HD%z(STATE_CURR), HD%OtherStates(STATE_CURR), HD%y, HD%m, ErrStat2, ErrMsg2 )
+   CALL HydroDyn_CalcOutput( Time, Inst%HD%u(1), Inst%HD%p, Inst%HD%x(STATE_CURR), Inst%HD%xd(STATE_CURR), Inst%HD%z(STATE_CURR), Inst%HD%OtherStates(STATE_CURR), Inst%HD%y, Inst%HD%m, ErrStat2, ErrMsg2 )
       if (Failed())  return
 
 
    ! Transfer resulting load meshes to intermediate mesh
-   call HD_TransferLoads( HD%u(1), HD%y, ErrStat2, ErrMsg2 )
+   call HD_TransferLoads( Inst, Inst%HD%u(1), Inst%HD%y, ErrStat2, ErrMsg2 )
       if (Failed())  return
 
 
    ! Set output force/moment array
-   call Set_OutputLoadArray( )
+   call Set_OutputLoadArray(Inst)
    ! Reshape for return
-   NodeFrc_C(1:6*NumNodePts) = reshape( real(tmpNodeFrc(1:6,1:NumNodePts), c_float), (/6*NumNodePts/) )
+   NodeFrc_C(1:6*Inst%NumNodePts) = reshape( real(Inst%tmpNodeFrc(1:6,1:Inst%NumNodePts), c_float), (/6*Inst%NumNodePts/) )
 
 
    ! call SeaState to get outputs of WaveElev, etc
-   call SeaSt_CalcOutput( Time, SeaSt%u, SeaSt%p, SeaSt%x, SeaSt%xd, SeaSt%z, SeaSt%OtherStates, SeaSt%y, SeaSt%m, ErrStat2, ErrMsg2 )
+   call SeaSt_CalcOutput( Time, Inst%SeaSt%u, Inst%SeaSt%p, Inst%SeaSt%x, Inst%SeaSt%xd, Inst%SeaSt%z, Inst%SeaSt%OtherStates, Inst%SeaSt%y, Inst%SeaSt%m, ErrStat2, ErrMsg2 )
 
    ! Get the output channel info out of y
    k=1
-   if (allocated(SeaSt%y%WriteOutput)) then
-      do i=1,size(SeaSt%y%WriteOutput)
-         OutputChannelValues_C(k) = REAL(SeaSt%y%WriteOutput(i), C_FLOAT)
+   if (allocated(Inst%SeaSt%y%WriteOutput)) then
+      do i=1,size(Inst%SeaSt%y%WriteOutput)
+         OutputChannelValues_C(k) = REAL(Inst%SeaSt%y%WriteOutput(i), C_FLOAT)
          k=k+1
       enddo
    endif
-   if (allocated(HD%y%WriteOutput)) then
-      do i=1,size(HD%y%WriteOutput)
-         OutputChannelValues_C(k) = REAL(HD%y%WriteOutput(i), C_FLOAT)
+   if (allocated(Inst%HD%y%WriteOutput)) then
+      do i=1,size(Inst%HD%y%WriteOutput)
+         OutputChannelValues_C(k) = REAL(Inst%HD%y%WriteOutput(i), C_FLOAT)
          k=k+1
       enddo
    endif
@@ -861,24 +885,26 @@ END SUBROUTINE HydroDyn_C_CalcOutput
 !! into the hydrodynamic forces without added mass, and a separate added mass matrix.
 !===============================================================================================================
 
-SUBROUTINE HydroDyn_C_CalcOutput_and_AddedMass(Time_C, NumNodePts_C, NodePos_C, NodeVel_C, &
+SUBROUTINE HydroDyn_C_CalcOutput_and_AddedMass(Handle_C, Time_C, NumNodePts_C, NodePos_C, NodeVel_C, &
                NodeFrc_C, NodeAdm_C, OutputChannelValues_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='HydroDyn_C_CalcOutput_and_AddedMass')
    implicit none
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: HydroDyn_C_CalcOutput_and_AddedMass
 !GCC$ ATTRIBUTES DLLEXPORT :: HydroDyn_C_CalcOutput_and_AddedMass
 #endif
+   integer(c_int),            intent(in   )  :: Handle_C                      !< Instance handle from HydroDyn_C_Init
    real(c_double),            intent(in   )  :: Time_C
    integer(c_int),            intent(in   )  :: NumNodePts_C                 !< Number of mesh points we are transfering motions from and output loads to
    real(c_float),             intent(in   )  :: NodePos_C( 6*NumNodePts_C )  !< A 6xNumNodePts_C array [x,y,z,Rx,Ry,Rz]          -- positions (global)
    real(c_float),             intent(in   )  :: NodeVel_C( 6*NumNodePts_C )  !< A 6xNumNodePts_C array [Vx,Vy,Vz,RVx,RVy,RVz]    -- velocities (global)
    real(c_float),             intent(  out)  :: NodeFrc_C( 6*NumNodePts_C )  !< A 6xNumNodePts_C array [Fx,Fy,Fz,Mx,My,Mz]       -- forces and moments (global)
    real(c_float),             intent(  out)  :: NodeAdm_C((6*NumNodePts_C)*(6*NumNodePts_C))  !< A (6xNumNodePts_C)x(6xNumNodePts_C) array containing the added mass matrix in column-major order -- added mass matrix (global)
-   real(c_float),             intent(  out)  :: OutputChannelValues_C(SeaSt%p%NumOuts+HD%p%NumOuts)
+   real(c_float),             intent(  out)  :: OutputChannelValues_C(*)    !< SeaState followed by HydroDyn output channels
    integer(c_int),            intent(  out)  :: ErrStat_C
    character(kind=c_char),    intent(  out)  :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local variables
+   type(HD_C_InstanceType),   pointer        :: Inst                          !< Instance data for this handle
    real(DbKi)                                :: Time
    integer(IntKi)                            :: iNode,i,j,k,m
    integer(IntKi)                            :: ErrStat                       !< aggregated error status
@@ -891,8 +917,10 @@ SUBROUTINE HydroDyn_C_CalcOutput_and_AddedMass(Time_C, NumNodePts_C, NodePos_C,
    ErrStat  =  ErrID_None
    ErrMsg   =  ""
 
+   call GetInstance(Handle_C, Inst, ErrStat2, ErrMsg2);  if (Failed())  return
+
    ! Sanity check -- number of node points cannot change
-   if ( NumNodePts /= int(NumNodePts_C, IntKi) ) then
+   if ( Inst%NumNodePts /= int(NumNodePts_C, IntKi) ) then
       ErrStat2 =  ErrID_Fatal
       ErrMsg2  =  "Number of node points passed in changed.  This must be constant throughout simulation"
       if (Failed())  return
@@ -902,83 +930,83 @@ SUBROUTINE HydroDyn_C_CalcOutput_and_AddedMass(Time_C, NumNodePts_C, NodePos_C,
    Time = REAL(Time_C,DbKi)
 
    ! Reshape position, velocity, acceleration
-   tmpNodePos(1:6,1:NumNodePts)   = reshape( real(NodePos_C(1:6*NumNodePts),ReKi), (/6,NumNodePts/) )
-   tmpNodeVel(1:6,1:NumNodePts)   = reshape( real(NodeVel_C(1:6*NumNodePts),ReKi), (/6,NumNodePts/) )
-   tmpNodeAcc(1:6,1:NumNodePts)   = 0.0_ReKi
+   Inst%tmpNodePos(1:6,1:Inst%NumNodePts)   = reshape( real(NodePos_C(1:6*Inst%NumNodePts),ReKi), (/6,Inst%NumNodePts/) )
+   Inst%tmpNodeVel(1:6,1:Inst%NumNodePts)   = reshape( real(NodeVel_C(1:6*Inst%NumNodePts),ReKi), (/6,Inst%NumNodePts/) )
+   Inst%tmpNodeAcc(1:6,1:Inst%NumNodePts)   = 0.0_ReKi
 
    ! Transfer motions to input meshes
-   call Set_MotionMesh()           ! update motion mesh with input motion arrays
-   call HD_SetInputMotion( HD%u(1), ErrStat2, ErrMsg2 )  ! transfer input motion mesh to u(1) meshes
+   call Set_MotionMesh(Inst)           ! update motion mesh with input motion arrays
+   call HD_SetInputMotion( Inst, Inst%HD%u(1), ErrStat2, ErrMsg2 )  ! transfer input motion mesh to u(1) meshes
       if (Failed())  return
 
 
    ! Call the main subroutine HydroDyn_CalcOutput to get the resulting forces and moments at time T
-   call HydroDyn_CalcOutput( Time, HD%u(1), HD%p, HD%x(STATE_CURR), HD%xd(STATE_CURR), HD%z(STATE_CURR), HD%OtherStates(STATE_CURR), HD%y, HD%m, ErrStat2, ErrMsg2 )
+   call HydroDyn_CalcOutput( Time, Inst%HD%u(1), Inst%HD%p, Inst%HD%x(STATE_CURR), Inst%HD%xd(STATE_CURR), Inst%HD%z(STATE_CURR), Inst%HD%OtherStates(STATE_CURR), Inst%HD%y, Inst%HD%m, ErrStat2, ErrMsg2 )
       if (Failed())  return
 
 
    ! Transfer resulting load meshes to intermediate mesh
-   call HD_TransferLoads( HD%u(1), HD%y, ErrStat2, ErrMsg2 )
+   call HD_TransferLoads( Inst, Inst%HD%u(1), Inst%HD%y, ErrStat2, ErrMsg2 )
       if (Failed())  return
 
 
    ! Set output force/moment array (without added-mass contributions)
-   call Set_OutputLoadArray( )
+   call Set_OutputLoadArray(Inst)
    ! Reshape for return
-   NodeFrc_C(1:6*NumNodePts) = reshape( real(tmpNodeFrc(1:6,1:NumNodePts), c_float), (/6*NumNodePts/) )
+   NodeFrc_C(1:6*Inst%NumNodePts) = reshape( real(Inst%tmpNodeFrc(1:6,1:Inst%NumNodePts), c_float), (/6*Inst%NumNodePts/) )
 
 
    ! Compute the added-mass matrix of the current time step
-   tmpNodeAdm = 0.0_ReKi
-   Perturbed  = .false.
+   Inst%tmpNodeAdm = 0.0_ReKi
+   Inst%Perturbed  = .false.
 
    ! Contributions from potential-flow bodies - need to perturb the acceleration of one node at a time, but only need to consider nodes with motion mapping to WAMIT mesh
-   if ( HD%u(1)%WAMITMesh%Committed ) then
+   if ( Inst%HD%u(1)%WAMITMesh%Committed ) then
 
       ! Map the potential-flow loads without added-mass contributions and strip-theory contributions to HD_LoadMesh as a baseline
-      call Transfer_Point_to_Point( HD%y%WAMITMesh, HD_LoadMesh, Map_HD_WB_P_2_Load, ErrStat2, ErrMsg2, HD%u(1)%WAMITMesh, HD_MotionMesh )
+      call Transfer_Point_to_Point( Inst%HD%y%WAMITMesh, Inst%HD_LoadMesh, Inst%Map_HD_WB_P_2_Load, ErrStat2, ErrMsg2, Inst%HD%u(1)%WAMITMesh, Inst%HD_MotionMesh )
          if (Failed())  return
 
-      do j=1,HD%u(1)%WAMITMesh%Nnodes
+      do j=1,Inst%HD%u(1)%WAMITMesh%Nnodes
 
-         i = Map_Motion_2_HD_WB_P%MapMotions(j)%OtherMesh_Element
+         i = Inst%Map_Motion_2_HD_WB_P%MapMotions(j)%OtherMesh_Element
 
-         if ( .not. Perturbed(i) ) then  ! Multiple WAMIT mesh nodes can have motion mapping to the same intermediate mesh node. This makes sure each intermediate mesh node is perturbed at most once.
+         if ( .not. Inst%Perturbed(i) ) then  ! Multiple WAMIT mesh nodes can have motion mapping to the same intermediate mesh node. This makes sure each intermediate mesh node is perturbed at most once.
 
             do k=1,6
 
                if (k < 4) then
-                  HD_MotionMesh%TranslationAcc(k,i) = -1.0_ReKi
+                  Inst%HD_MotionMesh%TranslationAcc(k,i) = -1.0_ReKi
                else
-                  HD_MotionMesh%RotationAcc( k-3,i) = -1.0_ReKi
+                  Inst%HD_MotionMesh%RotationAcc( k-3,i) = -1.0_ReKi
                end if
 
-               call Transfer_Point_to_Point( HD_MotionMesh, HD%u(1)%WAMITMesh, Map_Motion_2_HD_WB_P, ErrStat2, ErrMsg2 )
+               call Transfer_Point_to_Point( Inst%HD_MotionMesh, Inst%HD%u(1)%WAMITMesh, Inst%Map_Motion_2_HD_WB_P, ErrStat2, ErrMsg2 )
                   if (Failed())  return
 
-               call HydroDyn_CalcOutput( Time, HD%u(1), HD%p, HD%x(STATE_CURR), HD%xd(STATE_CURR), HD%z(STATE_CURR), HD%OtherStates(STATE_CURR), HD%y, HD%m, ErrStat2, ErrMsg2 )
+               call HydroDyn_CalcOutput( Time, Inst%HD%u(1), Inst%HD%p, Inst%HD%x(STATE_CURR), Inst%HD%xd(STATE_CURR), Inst%HD%z(STATE_CURR), Inst%HD%OtherStates(STATE_CURR), Inst%HD%y, Inst%HD%m, ErrStat2, ErrMsg2 )
                   if (Failed())  return
 
-               call Transfer_Point_to_Point( HD%y%WAMITMesh, HD_LoadMesh_tmp, Map_HD_WB_P_2_Load, ErrStat2, ErrMsg2, HD%u(1)%WAMITMesh, HD_MotionMesh )
+               call Transfer_Point_to_Point( Inst%HD%y%WAMITMesh, Inst%HD_LoadMesh_tmp, Inst%Map_HD_WB_P_2_Load, ErrStat2, ErrMsg2, Inst%HD%u(1)%WAMITMesh, Inst%HD_MotionMesh )
                   if (Failed())  return
 
-               HD_LoadMesh_tmp%Force  = HD_LoadMesh_tmp%Force  - HD_LoadMesh%Force
-               HD_LoadMesh_tmp%Moment = HD_LoadMesh_tmp%Moment - HD_LoadMesh%Moment
+               Inst%HD_LoadMesh_tmp%Force  = Inst%HD_LoadMesh_tmp%Force  - Inst%HD_LoadMesh%Force
+               Inst%HD_LoadMesh_tmp%Moment = Inst%HD_LoadMesh_tmp%Moment - Inst%HD_LoadMesh%Moment
 
-               do m=1,NumNodePts
-                  tmpNodeAdm(6*(m-1)+1:6*(m-1)+3,6*(i-1)+k) = HD_LoadMesh_tmp%Force(:,m)
-                  tmpNodeAdm(6*(m-1)+4:6*(m-1)+6,6*(i-1)+k) = HD_LoadMesh_tmp%Moment(:,m)
+               do m=1,Inst%NumNodePts
+                  Inst%tmpNodeAdm(6*(m-1)+1:6*(m-1)+3,6*(i-1)+k) = Inst%HD_LoadMesh_tmp%Force(:,m)
+                  Inst%tmpNodeAdm(6*(m-1)+4:6*(m-1)+6,6*(i-1)+k) = Inst%HD_LoadMesh_tmp%Moment(:,m)
                enddo
 
                if (k < 4) then
-                  HD_MotionMesh%TranslationAcc(k,i) = 0.0_ReKi
+                  Inst%HD_MotionMesh%TranslationAcc(k,i) = 0.0_ReKi
                else
-                  HD_MotionMesh%RotationAcc( k-3,i) = 0.0_ReKi
+                  Inst%HD_MotionMesh%RotationAcc( k-3,i) = 0.0_ReKi
                end if
 
             enddo
 
-            Perturbed(i) = .true.
+            Inst%Perturbed(i) = .true.
 
          end if   ! not perturbed
 
@@ -987,42 +1015,42 @@ SUBROUTINE HydroDyn_C_CalcOutput_and_AddedMass(Time_C, NumNodePts_C, NodePos_C,
    endif
 
    ! Contributions from strip-theory members - can perturb the acceleration of all nodes at once
-   if ( HD%u(1)%Morison%Mesh%Committed ) then
+   if ( Inst%HD%u(1)%Morison%Mesh%Committed ) then
 
       ! Map the strip-theory loads without added-mass contributions and potential-flow contributions as a baseline
       ! No need to call HydroDyn_CalcOutput here again because the Morison mesh loads have not been modified
-      call Transfer_Point_to_Point( HD%y%Morison%Mesh, HD_LoadMesh, Map_HD_Mo_P_2_Load, ErrStat2, ErrMsg2, HD%u(1)%Morison%Mesh, HD_MotionMesh )
+      call Transfer_Point_to_Point( Inst%HD%y%Morison%Mesh, Inst%HD_LoadMesh, Inst%Map_HD_Mo_P_2_Load, ErrStat2, ErrMsg2, Inst%HD%u(1)%Morison%Mesh, Inst%HD_MotionMesh )
          if (Failed())  return
 
       do k=1,6
 
          if (k < 4) then
-            HD_MotionMesh%TranslationAcc(k,:) = -1.0_ReKi
+            Inst%HD_MotionMesh%TranslationAcc(k,:) = -1.0_ReKi
          else
-            HD_MotionMesh%RotationAcc( k-3,:) = -1.0_ReKi
+            Inst%HD_MotionMesh%RotationAcc( k-3,:) = -1.0_ReKi
          endif
 
-         call Transfer_Point_to_Point( HD_MotionMesh, HD%u(1)%Morison%Mesh, Map_Motion_2_HD_Mo_P, ErrStat2, ErrMsg2 )
+         call Transfer_Point_to_Point( Inst%HD_MotionMesh, Inst%HD%u(1)%Morison%Mesh, Inst%Map_Motion_2_HD_Mo_P, ErrStat2, ErrMsg2 )
             if (Failed())  return
 
-         call HydroDyn_CalcOutput( Time, HD%u(1), HD%p, HD%x(STATE_CURR), HD%xd(STATE_CURR), HD%z(STATE_CURR), HD%OtherStates(STATE_CURR), HD%y, HD%m, ErrStat2, ErrMsg2 )
+         call HydroDyn_CalcOutput( Time, Inst%HD%u(1), Inst%HD%p, Inst%HD%x(STATE_CURR), Inst%HD%xd(STATE_CURR), Inst%HD%z(STATE_CURR), Inst%HD%OtherStates(STATE_CURR), Inst%HD%y, Inst%HD%m, ErrStat2, ErrMsg2 )
             if (Failed())  return
 
-         call Transfer_Point_to_Point( HD%y%Morison%Mesh, HD_LoadMesh_tmp, Map_HD_Mo_P_2_Load, ErrStat2, ErrMsg2, HD%u(1)%Morison%Mesh, HD_MotionMesh )
+         call Transfer_Point_to_Point( Inst%HD%y%Morison%Mesh, Inst%HD_LoadMesh_tmp, Inst%Map_HD_Mo_P_2_Load, ErrStat2, ErrMsg2, Inst%HD%u(1)%Morison%Mesh, Inst%HD_MotionMesh )
             if (Failed())  return
 
-         HD_LoadMesh_tmp%Force  = HD_LoadMesh_tmp%Force  - HD_LoadMesh%Force
-         HD_LoadMesh_tmp%Moment = HD_LoadMesh_tmp%Moment - HD_LoadMesh%Moment
+         Inst%HD_LoadMesh_tmp%Force  = Inst%HD_LoadMesh_tmp%Force  - Inst%HD_LoadMesh%Force
+         Inst%HD_LoadMesh_tmp%Moment = Inst%HD_LoadMesh_tmp%Moment - Inst%HD_LoadMesh%Moment
 
-         do m=1,NumNodePts
-            tmpNodeAdm( (6*(m-1)+1):(6*(m-1)+3), 6*(m-1)+k ) = tmpNodeAdm( (6*(m-1)+1):(6*(m-1)+3), 6*(m-1)+k ) + HD_LoadMesh_tmp%Force(:,m)
-            tmpNodeAdm( (6*(m-1)+4):(6*(m-1)+6), 6*(m-1)+k ) = tmpNodeAdm( (6*(m-1)+4):(6*(m-1)+6), 6*(m-1)+k ) + HD_LoadMesh_tmp%Moment(:,m)
+         do m=1,Inst%NumNodePts
+            Inst%tmpNodeAdm( (6*(m-1)+1):(6*(m-1)+3), 6*(m-1)+k ) = Inst%tmpNodeAdm( (6*(m-1)+1):(6*(m-1)+3), 6*(m-1)+k ) + Inst%HD_LoadMesh_tmp%Force(:,m)
+            Inst%tmpNodeAdm( (6*(m-1)+4):(6*(m-1)+6), 6*(m-1)+k ) = Inst%tmpNodeAdm( (6*(m-1)+4):(6*(m-1)+6), 6*(m-1)+k ) + Inst%HD_LoadMesh_tmp%Moment(:,m)
          enddo
 
          if (k < 4) then
-            HD_MotionMesh%TranslationAcc(k,:) = 0.0_ReKi
+            Inst%HD_MotionMesh%TranslationAcc(k,:) = 0.0_ReKi
          else
-            HD_MotionMesh%RotationAcc( k-3,:) = 0.0_ReKi
+            Inst%HD_MotionMesh%RotationAcc( k-3,:) = 0.0_ReKi
          endif
 
       enddo
@@ -1030,22 +1058,22 @@ SUBROUTINE HydroDyn_C_CalcOutput_and_AddedMass(Time_C, NumNodePts_C, NodePos_C,
    endif
 
    ! Reshape for return
-   NodeAdm_C(1:(6*NumNodePts*6*NumNodePts)) = reshape( real(tmpNodeAdm(1:6*NumNodePts,1:6*NumNodePts), c_float), (/(6*NumNodePts)*(6*NumNodePts)/) )
+   NodeAdm_C(1:(6*Inst%NumNodePts*6*Inst%NumNodePts)) = reshape( real(Inst%tmpNodeAdm(1:6*Inst%NumNodePts,1:6*Inst%NumNodePts), c_float), (/(6*Inst%NumNodePts)*(6*Inst%NumNodePts)/) )
 
    ! call SeaState to get outputs of WaveElev, etc
-   call SeaSt_CalcOutput( Time, SeaSt%u, SeaSt%p, SeaSt%x, SeaSt%xd, SeaSt%z, SeaSt%OtherStates, SeaSt%y, SeaSt%m, ErrStat2, ErrMsg2 )
+   call SeaSt_CalcOutput( Time, Inst%SeaSt%u, Inst%SeaSt%p, Inst%SeaSt%x, Inst%SeaSt%xd, Inst%SeaSt%z, Inst%SeaSt%OtherStates, Inst%SeaSt%y, Inst%SeaSt%m, ErrStat2, ErrMsg2 )
 
    ! Get the output channel info out of y
    k=1
-   if (allocated(SeaSt%y%WriteOutput)) then
-      do i=1,size(SeaSt%y%WriteOutput)
-         OutputChannelValues_C(k) = REAL(SeaSt%y%WriteOutput(i), C_FLOAT)
+   if (allocated(Inst%SeaSt%y%WriteOutput)) then
+      do i=1,size(Inst%SeaSt%y%WriteOutput)
+         OutputChannelValues_C(k) = REAL(Inst%SeaSt%y%WriteOutput(i), C_FLOAT)
          k=k+1
       enddo
    endif
-   if (allocated(HD%y%WriteOutput)) then
-      do i=1,size(HD%y%WriteOutput)
-         OutputChannelValues_C(k) = REAL(HD%y%WriteOutput(i), C_FLOAT)
+   if (allocated(Inst%HD%y%WriteOutput)) then
+      do i=1,size(Inst%HD%y%WriteOutput)
+         OutputChannelValues_C(k) = REAL(Inst%HD%y%WriteOutput(i), C_FLOAT)
          k=k+1
       enddo
    endif
@@ -1069,13 +1097,14 @@ END SUBROUTINE HydroDyn_C_CalcOutput_and_AddedMass
 !! Since we don't really know if we are doing correction steps or not, we will track the previous state and
 !! reset to those if we are repeating a timestep (normally this would be handled by the OF glue code, but since
 !! the states are not passed across the interface, we must handle them here).
-SUBROUTINE HydroDyn_C_UpdateStates( Time_C, TimeNext_C, NumNodePts_C, NodePos_C, NodeVel_C, NodeAcc_C,   &
+SUBROUTINE HydroDyn_C_UpdateStates( Handle_C, Time_C, TimeNext_C, NumNodePts_C, NodePos_C, NodeVel_C, NodeAcc_C,   &
                                     ErrStat_C, ErrMsg_C) BIND (C, NAME='HydroDyn_C_UpdateStates')
    implicit none
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: HydroDyn_C_UpdateStates
 !GCC$ ATTRIBUTES DLLEXPORT :: HydroDyn_C_UpdateStates
 #endif
+   integer(c_int),            intent(in   )  :: Handle_C                      !< Instance handle from HydroDyn_C_Init
    real(c_double),            intent(in   )  :: Time_C
    real(c_double),            intent(in   )  :: TimeNext_C
    integer(c_int),            intent(in   )  :: NumNodePts_C                 !< Number of mesh points we are transfering motions to and output loads to
@@ -1086,6 +1115,7 @@ SUBROUTINE HydroDyn_C_UpdateStates( Time_C, TimeNext_C, NumNodePts_C, NodePos_C,
    character(kind=c_char),    intent(  out)  :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local variables
+   type(HD_C_InstanceType),   pointer        :: Inst                          !< Instance data for this handle
    logical                                   :: CorrectionStep                ! if we are repeating a timestep in UpdateStates, don't update the inputs array
    integer(IntKi)                            :: iNode
    integer(IntKi)                            :: ErrStat                       !< aggregated error status
@@ -1099,8 +1129,10 @@ SUBROUTINE HydroDyn_C_UpdateStates( Time_C, TimeNext_C, NumNodePts_C, NodePos_C,
    ErrMsg   =  ""
    CorrectionStep = .false.
 
+   call GetInstance(Handle_C, Inst, ErrStat2, ErrMsg2);  if (Failed())  return
+
    ! Sanity check -- number of node points cannot change
-   if ( NumNodePts /= int(NumNodePts_C, IntKi) ) then
+   if ( Inst%NumNodePts /= int(NumNodePts_C, IntKi) ) then
       ErrStat2 =  ErrID_Fatal
       ErrMsg2  =  "Number of node points passed in changed.  This must be constant throughout simulation"
       if (Failed())  return
@@ -1128,16 +1160,16 @@ SUBROUTINE HydroDyn_C_UpdateStates( Time_C, TimeNext_C, NumNodePts_C, NodePos_C,
    !        but should not affect any results.
 
    !  Check if we are repeating an UpdateStates call (for example in a predictor/corrector loop)
-   if ( EqualRealNos( real(Time_C,DbKi), InputTimePrev ) ) then
+   if ( EqualRealNos( real(Time_C,DbKi), Inst%InputTimePrev ) ) then
       CorrectionStep = .true.
    else ! Setup time input times array
-      InputTimePrev          = real(Time_C,DbKi)            ! Store for check next time
-      if (InterpOrder>1) then ! quadratic, so keep the old time
-         InputTimes(INPUT_LAST) = ( N_Global - 1 ) * dT_Global    ! u(3) at T-dT
+      Inst%InputTimePrev          = real(Time_C,DbKi)            ! Store for check next time
+      if (Inst%InterpOrder>1) then ! quadratic, so keep the old time
+         Inst%InputTimes(INPUT_LAST) = ( Inst%N_Global - 1 ) * Inst%dT_Global    ! u(3) at T-dT
       endif
-      InputTimes(INPUT_CURR) =   N_Global       * dT_Global       ! u(2) at T
-      InputTimes(INPUT_PRED) = ( N_Global + 1 ) * dT_Global       ! u(1) at T+dT
-      N_Global = N_Global + 1_IntKi                               ! increment counter to T+dT
+      Inst%InputTimes(INPUT_CURR) =   Inst%N_Global       * Inst%dT_Global       ! u(2) at T
+      Inst%InputTimes(INPUT_PRED) = ( Inst%N_Global + 1 ) * Inst%dT_Global       ! u(1) at T+dT
+      Inst%N_Global = Inst%N_Global + 1_IntKi                               ! increment counter to T+dT
    endif
 
 
@@ -1145,44 +1177,44 @@ SUBROUTINE HydroDyn_C_UpdateStates( Time_C, TimeNext_C, NumNodePts_C, NodePos_C,
       ! Step back to previous state because we are doing a correction step
       !     -- repeating the T -> T+dt update with new inputs at T+dt
       !     -- the STATE_CURR contains states at T+dt from the previous call, so revert those
-      CALL HydroDyn_CopyContState   (HD%x(          STATE_LAST), HD%x(          STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-      CALL HydroDyn_CopyDiscState   (HD%xd(         STATE_LAST), HD%xd(         STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-      CALL HydroDyn_CopyConstrState (HD%z(          STATE_LAST), HD%z(          STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-      CALL HydroDyn_CopyOtherState  (HD%OtherStates(STATE_LAST), HD%OtherStates(STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+      CALL HydroDyn_CopyContState   (Inst%HD%x(          STATE_LAST), Inst%HD%x(          STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+      CALL HydroDyn_CopyDiscState   (Inst%HD%xd(         STATE_LAST), Inst%HD%xd(         STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+      CALL HydroDyn_CopyConstrState (Inst%HD%z(          STATE_LAST), Inst%HD%z(          STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+      CALL HydroDyn_CopyOtherState  (Inst%HD%OtherStates(STATE_LAST), Inst%HD%OtherStates(STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
    else
       ! Cycle inputs back one timestep since we are moving forward in time.
-      if (InterpOrder>1) then ! quadratic, so keep the old time
-         call HydroDyn_CopyInput( HD%u(INPUT_CURR), HD%u(INPUT_LAST), MESH_UPDATECOPY, ErrStat2, ErrMsg2);        if (Failed())  return
+      if (Inst%InterpOrder>1) then ! quadratic, so keep the old time
+         call HydroDyn_CopyInput( Inst%HD%u(INPUT_CURR), Inst%HD%u(INPUT_LAST), MESH_UPDATECOPY, ErrStat2, ErrMsg2);        if (Failed())  return
       endif
       ! Move inputs from previous t+dt (now t) to t
-      call HydroDyn_CopyInput( HD%u(INPUT_PRED), HD%u(INPUT_CURR), MESH_UPDATECOPY, ErrStat2, ErrMsg2);           if (Failed())  return
+      call HydroDyn_CopyInput( Inst%HD%u(INPUT_PRED), Inst%HD%u(INPUT_CURR), MESH_UPDATECOPY, ErrStat2, ErrMsg2);           if (Failed())  return
    endif
 
    !-------------------------------------------------------
    ! Set inputs for time T+dt -- u(1)
    !-------------------------------------------------------
    ! Reshape position, velocity, acceleration
-   tmpNodePos(1:6,1:NumNodePts)   = reshape( real(NodePos_C(1:6*NumNodePts),ReKi), (/6,NumNodePts/) )
-   tmpNodeVel(1:6,1:NumNodePts)   = reshape( real(NodeVel_C(1:6*NumNodePts),ReKi), (/6,NumNodePts/) )
-   tmpNodeAcc(1:6,1:NumNodePts)   = reshape( real(NodeAcc_C(1:6*NumNodePts),ReKi), (/6,NumNodePts/) )
+   Inst%tmpNodePos(1:6,1:Inst%NumNodePts)   = reshape( real(NodePos_C(1:6*Inst%NumNodePts),ReKi), (/6,Inst%NumNodePts/) )
+   Inst%tmpNodeVel(1:6,1:Inst%NumNodePts)   = reshape( real(NodeVel_C(1:6*Inst%NumNodePts),ReKi), (/6,Inst%NumNodePts/) )
+   Inst%tmpNodeAcc(1:6,1:Inst%NumNodePts)   = reshape( real(NodeAcc_C(1:6*Inst%NumNodePts),ReKi), (/6,Inst%NumNodePts/) )
 
    ! Transfer motions to input meshes
-   call Set_MotionMesh()                    ! update motion mesh with input motion arrays
-   call HD_SetInputMotion( HD%u(INPUT_PRED), ErrStat2, ErrMsg2 )  ! transfer input motion mesh to u(1) meshes
+   call Set_MotionMesh(Inst)                    ! update motion mesh with input motion arrays
+   call HD_SetInputMotion( Inst, Inst%HD%u(INPUT_PRED), ErrStat2, ErrMsg2 )  ! transfer input motion mesh to u(1) meshes
       if (Failed())  return
 
 
    ! Set copy the current state over to the predicted state for sending to UpdateStates
    !     -- The STATE_PREDicted will get updated in the call.
    !     -- The UpdateStates routine expects this to contain states at T at the start of the call (history not passed in)
-   CALL HydroDyn_CopyContState   (HD%x(          STATE_CURR), HD%x(          STATE_PRED), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-   CALL HydroDyn_CopyDiscState   (HD%xd(         STATE_CURR), HD%xd(         STATE_PRED), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-   CALL HydroDyn_CopyConstrState (HD%z(          STATE_CURR), HD%z(          STATE_PRED), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-   CALL HydroDyn_CopyOtherState  (HD%OtherStates(STATE_CURR), HD%OtherStates(STATE_PRED), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyContState   (Inst%HD%x(          STATE_CURR), Inst%HD%x(          STATE_PRED), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyDiscState   (Inst%HD%xd(         STATE_CURR), Inst%HD%xd(         STATE_PRED), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyConstrState (Inst%HD%z(          STATE_CURR), Inst%HD%z(          STATE_PRED), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyOtherState  (Inst%HD%OtherStates(STATE_CURR), Inst%HD%OtherStates(STATE_PRED), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
 
 
    ! Call the main subroutine HydroDyn_UpdateStates to get the velocities
-   CALL HydroDyn_UpdateStates( InputTimes(INPUT_CURR), N_Global, HD%u, InputTimes, HD%p, HD%x(STATE_PRED), HD%xd(STATE_PRED), HD%z(STATE_PRED), HD%OtherStates(STATE_PRED), HD%m, ErrStat2, ErrMsg2 )
+   CALL HydroDyn_UpdateStates( Inst%InputTimes(INPUT_CURR), Inst%N_Global, Inst%HD%u, Inst%InputTimes, Inst%HD%p, Inst%HD%x(STATE_PRED), Inst%HD%xd(STATE_PRED), Inst%HD%z(STATE_PRED), Inst%HD%OtherStates(STATE_PRED), Inst%HD%m, ErrStat2, ErrMsg2 )
       if (Failed())  return
 
 
@@ -1192,16 +1224,16 @@ SUBROUTINE HydroDyn_C_UpdateStates( Time_C, TimeNext_C, NumNodePts_C, NodePos_C,
    ! move current state at T to previous state at T-dt
    !     -- STATE_LAST now contains info at time T
    !     -- this allows repeating the T --> T+dt update
-   CALL HydroDyn_CopyContState   (HD%x(          STATE_CURR), HD%x(          STATE_LAST), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-   CALL HydroDyn_CopyDiscState   (HD%xd(         STATE_CURR), HD%xd(         STATE_LAST), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-   CALL HydroDyn_CopyConstrState (HD%z(          STATE_CURR), HD%z(          STATE_LAST), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-   CALL HydroDyn_CopyOtherState  (HD%OtherStates(STATE_CURR), HD%OtherStates(STATE_LAST), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyContState   (Inst%HD%x(          STATE_CURR), Inst%HD%x(          STATE_LAST), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyDiscState   (Inst%HD%xd(         STATE_CURR), Inst%HD%xd(         STATE_LAST), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyConstrState (Inst%HD%z(          STATE_CURR), Inst%HD%z(          STATE_LAST), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyOtherState  (Inst%HD%OtherStates(STATE_CURR), Inst%HD%OtherStates(STATE_LAST), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
    ! Update the predicted state as the new current state
    !     -- we have now advanced from T to T+dt.  This allows calling with CalcOuput to get the outputs at T+dt
-   CALL HydroDyn_CopyContState   (HD%x(          STATE_PRED), HD%x(          STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-   CALL HydroDyn_CopyDiscState   (HD%xd(         STATE_PRED), HD%xd(         STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-   CALL HydroDyn_CopyConstrState (HD%z(          STATE_PRED), HD%z(          STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
-   CALL HydroDyn_CopyOtherState  (HD%OtherStates(STATE_PRED), HD%OtherStates(STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyContState   (Inst%HD%x(          STATE_PRED), Inst%HD%x(          STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyDiscState   (Inst%HD%xd(         STATE_PRED), Inst%HD%xd(         STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyConstrState (Inst%HD%z(          STATE_PRED), Inst%HD%z(          STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
+   CALL HydroDyn_CopyOtherState  (Inst%HD%OtherStates(STATE_PRED), Inst%HD%OtherStates(STATE_CURR), MESH_UPDATECOPY, Errstat2, ErrMsg2);  if (Failed())  return
 
 
 
@@ -1220,16 +1252,18 @@ END SUBROUTINE HydroDyn_C_UpdateStates
 !===============================================================================================================
 !  NOTE: the error handling in this routine is slightly different than the other routines
 
-SUBROUTINE HydroDyn_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='HydroDyn_C_End')
+SUBROUTINE HydroDyn_C_End(Handle_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='HydroDyn_C_End')
    implicit none
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: HydroDyn_C_End
 !GCC$ ATTRIBUTES DLLEXPORT :: HydroDyn_C_End
 #endif
+   integer(c_int),          intent(in   ) :: Handle_C
    integer(c_int),          intent(  out) :: ErrStat_C
    character(kind=c_char),  intent(  out) :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local variables
+   type(HD_C_InstanceType), pointer :: Inst                      !< Instance data for this handle
    integer(IntKi)             :: i                                !< generic loop counter
    integer                    :: ErrStat                          !< aggregated error status
    character(ErrMsgLen)       :: ErrMsg                           !< aggregated error message
@@ -1241,20 +1275,26 @@ SUBROUTINE HydroDyn_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='HydroDyn_C_End')
    ErrStat  =  ErrID_None
    ErrMsg   =  ""
 
-   ! clear out any globably allocated helper arrays
-   if (allocated(tmpNodePos))    deallocate(tmpNodePos)
-   if (allocated(tmpNodeVel))    deallocate(tmpNodeVel)
-   if (allocated(tmpNodeAcc))    deallocate(tmpNodeAcc)
-   if (allocated(tmpNodeFrc))    deallocate(tmpNodeFrc)
-   if (allocated(tmpNodeAdm))    deallocate(tmpNodeAdm)
-   if (allocated(perturbed ))    deallocate(perturbed )
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErr(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
+      return
+   endif
+
+   ! clear out any allocated helper arrays
+   if (allocated(Inst%tmpNodePos))    deallocate(Inst%tmpNodePos)
+   if (allocated(Inst%tmpNodeVel))    deallocate(Inst%tmpNodeVel)
+   if (allocated(Inst%tmpNodeAcc))    deallocate(Inst%tmpNodeAcc)
+   if (allocated(Inst%tmpNodeFrc))    deallocate(Inst%tmpNodeFrc)
+   if (allocated(Inst%tmpNodeAdm))    deallocate(Inst%tmpNodeAdm)
+   if (allocated(Inst%perturbed ))    deallocate(Inst%perturbed )
 
    ! Call the main subroutine HydroDyn_End
    !     If u is not allocated, then we didn't get far at all in initialization,
    !     or HD%C_End got called before Init.  We don't want a segfault, so check
    !     for allocation.
-   if (allocated(HD%u)) then
-      call HydroDyn_End( HD%u(1), HD%p, HD%x(STATE_CURR), HD%xd(STATE_CURR), HD%z(STATE_CURR), HD%OtherStates(STATE_CURR), HD%y, HD%m, ErrStat2, ErrMsg2 )
+   if (allocated(Inst%HD%u)) then
+      call HydroDyn_End( Inst%HD%u(1), Inst%HD%p, Inst%HD%x(STATE_CURR), Inst%HD%xd(STATE_CURR), Inst%HD%z(STATE_CURR), Inst%HD%OtherStates(STATE_CURR), Inst%HD%y, Inst%HD%m, ErrStat2, ErrMsg2 )
       call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
    endif
 
@@ -1262,105 +1302,109 @@ SUBROUTINE HydroDyn_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='HydroDyn_C_End')
    !        logic is required here (this isn't necessary in the fortran driver
    !        or in openfast, but may be when this code is called from C, Python,
    !        or some other code using the c-bindings.
-   if (allocated(HD%u)) then
-      do i=2,size(HD%u)
-         call HydroDyn_DestroyInput( HD%u(i), ErrStat2, ErrMsg2 )
+   if (allocated(Inst%HD%u)) then
+      do i=2,size(Inst%HD%u)
+         call HydroDyn_DestroyInput( Inst%HD%u(i), ErrStat2, ErrMsg2 )
          call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
       enddo
-      if (allocated(HD%u))             deallocate(HD%u)
+      if (allocated(Inst%HD%u))             deallocate(Inst%HD%u)
    endif
 
    ! Destroy any other copies of states (rerun on (STATE_CURR) is ok)
-   call HydroDyn_DestroyContState(   HD%x(          STATE_LAST), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyDiscState(   HD%xd(         STATE_LAST), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyConstrState( HD%z(          STATE_LAST), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyOtherState(  HD%OtherStates(STATE_LAST), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyContState(   HD%x(          STATE_CURR), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyDiscState(   HD%xd(         STATE_CURR), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyConstrState( HD%z(          STATE_CURR), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyOtherState(  HD%OtherStates(STATE_CURR), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyContState(   HD%x(          STATE_PRED), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyDiscState(   HD%xd(         STATE_PRED), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyConstrState( HD%z(          STATE_PRED), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call HydroDyn_DestroyOtherState(  HD%OtherStates(STATE_PRED), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyContState(   Inst%HD%x(          STATE_LAST), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyDiscState(   Inst%HD%xd(         STATE_LAST), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyConstrState( Inst%HD%z(          STATE_LAST), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyOtherState(  Inst%HD%OtherStates(STATE_LAST), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyContState(   Inst%HD%x(          STATE_CURR), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyDiscState(   Inst%HD%xd(         STATE_CURR), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyConstrState( Inst%HD%z(          STATE_CURR), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyOtherState(  Inst%HD%OtherStates(STATE_CURR), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyContState(   Inst%HD%x(          STATE_PRED), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyDiscState(   Inst%HD%xd(         STATE_PRED), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyConstrState( Inst%HD%z(          STATE_PRED), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call HydroDyn_DestroyOtherState(  Inst%HD%OtherStates(STATE_PRED), ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
 
    ! Call the main subroutine SeaSt_End
-   call SeaSt_End( SeaSt%u, SeaSt%p, SeaSt%x, SeaSt%xd, SeaSt%z, SeaSt%OtherStates, SeaSt%y, SeaSt%m, ErrStat2, ErrMsg2 )
+   call SeaSt_End( Inst%SeaSt%u, Inst%SeaSt%p, Inst%SeaSt%x, Inst%SeaSt%xd, Inst%SeaSt%z, Inst%SeaSt%OtherStates, Inst%SeaSt%y, Inst%SeaSt%m, ErrStat2, ErrMsg2 )
    call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
    ! Destroy any other copies of states (rerun on (STATE_CURR) is ok)
-   call SeaSt_DestroyContState(   SeaSt%x          , ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call SeaSt_DestroyDiscState(   SeaSt%xd         , ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call SeaSt_DestroyConstrState( SeaSt%z          , ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call SeaSt_DestroyOtherState(  SeaSt%OtherStates, ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call SeaSt_DestroyContState(   Inst%SeaSt%x          , ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call SeaSt_DestroyDiscState(   Inst%SeaSt%xd         , ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call SeaSt_DestroyConstrState( Inst%SeaSt%z          , ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   call SeaSt_DestroyOtherState(  Inst%SeaSt%OtherStates, ErrStat2, ErrMsg2 );  call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
 
    ! if deallocate other items now
-   if (allocated(InputTimes))    deallocate(InputTimes)
+   if (allocated(Inst%InputTimes))    deallocate(Inst%InputTimes)
 
    ! Clear out mesh related data storage
    call ClearMesh()
 
+   ! Release the instance
+   call FreeInstance(Handle_C)
+
    call SetErr(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
 CONTAINS
    !> Don't leave junk in memory.  So destroy meshes and mappings.
    subroutine ClearMesh()
       ! Destroy connection meshes
-      call MeshDestroy( HD_MotionMesh, ErrStat2, ErrMsg2 )
+      call MeshDestroy( Inst%HD_MotionMesh, ErrStat2, ErrMsg2 )
       call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-      call MeshDestroy( HD_LoadMesh, ErrStat2, ErrMsg2 )
+      call MeshDestroy( Inst%HD_LoadMesh, ErrStat2, ErrMsg2 )
       call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
       ! Destroy mesh mappings
-      call NWTC_Library_Destroymeshmaptype( Map_Motion_2_HD_PRP_P, ErrStat2, ErrMsg2 )
+      call NWTC_Library_Destroymeshmaptype( Inst%Map_Motion_2_HD_PRP_P, ErrStat2, ErrMsg2 )
       call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-      call NWTC_Library_Destroymeshmaptype( Map_Motion_2_HD_WB_P , ErrStat2, ErrMsg2 )
+      call NWTC_Library_Destroymeshmaptype( Inst%Map_Motion_2_HD_WB_P , ErrStat2, ErrMsg2 )
       call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-      call NWTC_Library_Destroymeshmaptype( Map_Motion_2_HD_Mo_P , ErrStat2, ErrMsg2 )
+      call NWTC_Library_Destroymeshmaptype( Inst%Map_Motion_2_HD_Mo_P , ErrStat2, ErrMsg2 )
       call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-      call NWTC_Library_Destroymeshmaptype( Map_HD_WB_P_2_Load   , ErrStat2, ErrMsg2 )
+      call NWTC_Library_Destroymeshmaptype( Inst%Map_HD_WB_P_2_Load   , ErrStat2, ErrMsg2 )
       call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-      call NWTC_Library_Destroymeshmaptype( Map_HD_Mo_P_2_Load   , ErrStat2, ErrMsg2 )
+      call NWTC_Library_Destroymeshmaptype( Inst%Map_HD_Mo_P_2_Load   , ErrStat2, ErrMsg2 )
       call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
    end subroutine ClearMesh
 END SUBROUTINE HydroDyn_C_End
 
 
-!> This routine is operating on module level data, hence few inputs
-subroutine Set_MotionMesh()
+!> Set the motion mesh from the temporary node position/velocity/acceleration arrays of an instance
+subroutine Set_MotionMesh(Inst)
+   type(HD_C_InstanceType),   pointer        :: Inst                 !< instance data
    integer(IntKi)                            :: iNode
    real(R8Ki)                                :: theta(3)
    real(R8Ki)                                :: Orient(3,3)
    ! Set mesh corresponding to input motions
-   do iNode=1,NumNodePts
-      theta    = real(tmpNodePos(4:6,iNode),DbKi)    ! convert ReKi to DbKi to avoid roundoff
+   do iNode=1,Inst%NumNodePts
+      theta    = real(Inst%tmpNodePos(4:6,iNode),DbKi)    ! convert ReKi to DbKi to avoid roundoff
       Orient = EulerConstructZYX(theta)
-      HD_MotionMesh%TranslationDisp(1:3,iNode) = tmpNodePos(1:3,iNode) - HD_MotionMesh%Position(1:3,iNode)  ! relative displacement only
-      HD_MotionMesh%Orientation(1:3,1:3,iNode) = Orient
-      HD_MotionMesh%TranslationVel( 1:3,iNode) = tmpNodeVel(1:3,iNode)
-      HD_MotionMesh%RotationVel(    1:3,iNode) = tmpNodeVel(4:6,iNode)
-      HD_MotionMesh%TranslationAcc( 1:3,iNode) = tmpNodeAcc(1:3,iNode)
-      HD_MotionMesh%RotationAcc(    1:3,iNode) = tmpNodeAcc(4:6,iNode)
+      Inst%HD_MotionMesh%TranslationDisp(1:3,iNode) = Inst%tmpNodePos(1:3,iNode) - Inst%HD_MotionMesh%Position(1:3,iNode)  ! relative displacement only
+      Inst%HD_MotionMesh%Orientation(1:3,1:3,iNode) = Orient
+      Inst%HD_MotionMesh%TranslationVel( 1:3,iNode) = Inst%tmpNodeVel(1:3,iNode)
+      Inst%HD_MotionMesh%RotationVel(    1:3,iNode) = Inst%tmpNodeVel(4:6,iNode)
+      Inst%HD_MotionMesh%TranslationAcc( 1:3,iNode) = Inst%tmpNodeAcc(1:3,iNode)
+      Inst%HD_MotionMesh%RotationAcc(    1:3,iNode) = Inst%tmpNodeAcc(4:6,iNode)
    enddo
 end subroutine Set_MotionMesh
 
 !> Map the motion of the intermediate input mesh over to the input meshes
-!! This routine is operating on module level data, hence few inputs
-subroutine HD_SetInputMotion( HD_u_local, ErrStat3, ErrMsg3 )
+subroutine HD_SetInputMotion( Inst, HD_u_local, ErrStat3, ErrMsg3 )
+   type(HD_C_InstanceType),   pointer        :: Inst                 !< instance data
    type(HydroDyn_InputType),  intent(inout)  :: HD_u_local           ! Only one input (probably at T)
    integer(IntKi),            intent(  out)  :: ErrStat3
    character(ErrMsgLen),      intent(  out)  :: ErrMsg3
    !  Principle reference point
-   CALL Transfer_Point_to_Point( HD_MotionMesh, HD_u_local%PRPMesh, Map_Motion_2_HD_PRP_P, ErrStat3, ErrMsg3 )
+   CALL Transfer_Point_to_Point( Inst%HD_MotionMesh, HD_u_local%PRPMesh, Inst%Map_Motion_2_HD_PRP_P, ErrStat3, ErrMsg3 )
       if (ErrStat3 >= AbortErrLev)  return
    !  WAMIT mesh
    if ( HD_u_local%WAMITMesh%Committed ) then
-      call Transfer_Point_to_Point( HD_MotionMesh, HD_u_local%WAMITMesh, Map_Motion_2_HD_WB_P, ErrStat3, ErrMsg3 )
+      call Transfer_Point_to_Point( Inst%HD_MotionMesh, HD_u_local%WAMITMesh, Inst%Map_Motion_2_HD_WB_P, ErrStat3, ErrMsg3 )
          if (ErrStat3 >= AbortErrLev)  return
    endif
    !  Morison mesh
    if ( HD_u_local%Morison%Mesh%Committed ) then
-      call Transfer_Point_to_Point( HD_MotionMesh, HD_u_local%Morison%Mesh, Map_Motion_2_HD_Mo_P, ErrStat3, ErrMsg3 )
+      call Transfer_Point_to_Point( Inst%HD_MotionMesh, HD_u_local%Morison%Mesh, Inst%Map_Motion_2_HD_Mo_P, ErrStat3, ErrMsg3 )
          if (ErrStat3 >= AbortErrLev)  return
    endif
 end subroutine HD_SetInputMotion
@@ -1370,45 +1414,116 @@ end subroutine HD_SetInputMotion
 !! we are mapping two meshes over to a single one, we use an intermediate
 !! temporary mesh -- prevents accidental overwrite of WAMIT loads on HD_LoadMesh
 !! with the mapping of the Morison loads.
-!! This routine is operating on module level data, hence few inputs
-subroutine HD_TransferLoads( HD_u_local, HD_y_local, ErrStat3, ErrMsg3 )
+subroutine HD_TransferLoads( Inst, HD_u_local, HD_y_local, ErrStat3, ErrMsg3 )
+   type(HD_C_InstanceType),   pointer        :: Inst                 !< instance data
    type(HydroDyn_InputType),  intent(in   )  :: HD_u_local           ! Only one input (probably at T)
    type(HydroDyn_OutputType), intent(in   )  :: HD_y_local     ! Only one input (probably at T)
    integer(IntKi),            intent(  out)  :: ErrStat3
    character(ErrMsgLen),      intent(  out)  :: ErrMsg3
 
-   HD_LoadMesh%Force    = 0.0_ReKi
-   HD_LoadMesh%Moment   = 0.0_ReKi
+   Inst%HD_LoadMesh%Force    = 0.0_ReKi
+   Inst%HD_LoadMesh%Moment   = 0.0_ReKi
 
    !  WAMIT mesh
    if ( HD_y_local%WAMITMesh%Committed ) then
-      HD_LoadMesh_tmp%Force    = 0.0_ReKi
-      HD_LoadMesh_tmp%Moment   = 0.0_ReKi
-      call Transfer_Point_to_Point( HD_y_local%WAMITMesh, HD_LoadMesh_tmp, Map_HD_WB_P_2_Load, ErrStat3, ErrMsg3, HD_u_local%WAMITMesh, HD_MotionMesh )
+      Inst%HD_LoadMesh_tmp%Force    = 0.0_ReKi
+      Inst%HD_LoadMesh_tmp%Moment   = 0.0_ReKi
+      call Transfer_Point_to_Point( HD_y_local%WAMITMesh, Inst%HD_LoadMesh_tmp, Inst%Map_HD_WB_P_2_Load, ErrStat3, ErrMsg3, HD_u_local%WAMITMesh, Inst%HD_MotionMesh )
          if (ErrStat3 >= AbortErrLev)  return
-      HD_LoadMesh%Force    = HD_LoadMesh%Force  + HD_LoadMesh_tmp%Force
-      HD_LoadMesh%Moment   = HD_LoadMesh%Moment + HD_LoadMesh_tmp%Moment
+      Inst%HD_LoadMesh%Force    = Inst%HD_LoadMesh%Force  + Inst%HD_LoadMesh_tmp%Force
+      Inst%HD_LoadMesh%Moment   = Inst%HD_LoadMesh%Moment + Inst%HD_LoadMesh_tmp%Moment
    endif
    !  Morison mesh
    if ( HD_y_local%Morison%Mesh%Committed ) then
-      HD_LoadMesh_tmp%Force    = 0.0_ReKi
-      HD_LoadMesh_tmp%Moment   = 0.0_ReKi
-      call Transfer_Point_to_Point( HD_y_local%Morison%Mesh, HD_LoadMesh_tmp, Map_HD_Mo_P_2_Load, ErrStat3, ErrMsg3, HD_u_local%Morison%Mesh, HD_MotionMesh )
+      Inst%HD_LoadMesh_tmp%Force    = 0.0_ReKi
+      Inst%HD_LoadMesh_tmp%Moment   = 0.0_ReKi
+      call Transfer_Point_to_Point( HD_y_local%Morison%Mesh, Inst%HD_LoadMesh_tmp, Inst%Map_HD_Mo_P_2_Load, ErrStat3, ErrMsg3, HD_u_local%Morison%Mesh, Inst%HD_MotionMesh )
          if (ErrStat3 >= AbortErrLev)  return
-      HD_LoadMesh%Force    = HD_LoadMesh%Force  + HD_LoadMesh_tmp%Force
-      HD_LoadMesh%Moment   = HD_LoadMesh%Moment + HD_LoadMesh_tmp%Moment
+      Inst%HD_LoadMesh%Force    = Inst%HD_LoadMesh%Force  + Inst%HD_LoadMesh_tmp%Force
+      Inst%HD_LoadMesh%Moment   = Inst%HD_LoadMesh%Moment + Inst%HD_LoadMesh_tmp%Moment
    endif
 end subroutine HD_TransferLoads
 
 !> Transfer the loads from the load mesh to the temporary array for output
-!! This routine is operating on module level data, hence few inputs
-subroutine Set_OutputLoadArray()
+subroutine Set_OutputLoadArray(Inst)
+   type(HD_C_InstanceType),   pointer        :: Inst                 !< instance data
    integer(IntKi)                            :: iNode
    ! Set mesh corresponding to input motions
-   do iNode=1,NumNodePts
-      tmpNodeFrc(1:3,iNode)   = HD_LoadMesh%Force (1:3,iNode)
-      tmpNodeFrc(4:6,iNode)   = HD_LoadMesh%Moment(1:3,iNode)
+   do iNode=1,Inst%NumNodePts
+      Inst%tmpNodeFrc(1:3,iNode)   = Inst%HD_LoadMesh%Force (1:3,iNode)
+      Inst%tmpNodeFrc(4:6,iNode)   = Inst%HD_LoadMesh%Moment(1:3,iNode)
    enddo
 end subroutine Set_OutputLoadArray
 
+!---------------------------------------------------------------------------------------------------------------
+!> Create a new instance and return its handle.  Slots freed by HydroDyn_C_End are reused.
+subroutine NewInstance(Handle, Inst, ErrStat, ErrMsg)
+   integer(c_int),                     intent(  out) :: Handle      !< handle (index into Instances)
+   type(HD_C_InstanceType), pointer,   intent(  out) :: Inst        !< new instance data
+   integer(IntKi),                     intent(  out) :: ErrStat
+   character(ErrMsgLen),               intent(  out) :: ErrMsg
+   type(HD_C_InstancePtr), allocatable               :: TmpList(:)
+   integer                                           :: i, NumOld, ErrStat2
+   character(*), parameter                           :: RoutineName = 'NewInstance'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   Handle  = 0_c_int
+   Inst    => NULL()
+
+   ! find a free slot, growing the list if there is none
+   NumOld = 0
+   if (allocated(Instances)) NumOld = size(Instances)
+   do i = 1, NumOld
+      if (.not. associated(Instances(i)%Inst)) exit
+   enddo
+   if (i > NumOld) then
+      allocate(TmpList(max(4, 2*NumOld)), STAT=ErrStat2)
+      if (ErrStat2 /= 0) then
+         call SetErrStat(ErrID_Fatal, "Could not allocate instance list", ErrStat, ErrMsg, RoutineName)
+         return
+      endif
+      if (NumOld > 0) TmpList(1:NumOld) = Instances
+      call move_alloc(TmpList, Instances)
+   endif
+
+   allocate(Instances(i)%Inst, STAT=ErrStat2)
+   if (ErrStat2 /= 0) then
+      call SetErrStat(ErrID_Fatal, "Could not allocate instance data", ErrStat, ErrMsg, RoutineName)
+      return
+   endif
+   Inst   => Instances(i)%Inst
+   Handle =  int(i, c_int)
+end subroutine NewInstance
+
+!---------------------------------------------------------------------------------------------------------------
+!> Return the instance data for a handle, or a fatal error if the handle is not in use
+subroutine GetInstance(Handle, Inst, ErrStat, ErrMsg)
+   integer(c_int),                     intent(in   ) :: Handle
+   type(HD_C_InstanceType), pointer,   intent(  out) :: Inst
+   integer(IntKi),                     intent(  out) :: ErrStat
+   character(ErrMsgLen),               intent(  out) :: ErrMsg
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   Inst    => NULL()
+   if (allocated(Instances)) then
+      if (Handle >= 1 .and. Handle <= size(Instances)) Inst => Instances(Handle)%Inst
+   endif
+   if (.not. associated(Inst)) then
+      ErrStat = ErrID_Fatal
+      ErrMsg  = "Invalid HydroDyn instance handle "//trim(Num2LStr(int(Handle,IntKi)))//". Was HydroDyn_C_Init called?"
+   endif
+end subroutine GetInstance
+
+!---------------------------------------------------------------------------------------------------------------
+!> Release the instance data for a handle.  Data inside the instance must already be destroyed.
+subroutine FreeInstance(Handle)
+   integer(c_int),                     intent(in   ) :: Handle
+   if (.not. allocated(Instances)) return
+   if (Handle < 1 .or. Handle > size(Instances)) return
+   if (associated(Instances(Handle)%Inst)) deallocate(Instances(Handle)%Inst)
+   Instances(Handle)%Inst => NULL()
+end subroutine FreeInstance
+
 END MODULE HydroDyn_C_BINDING
@@ -1251,6 +1251,22 @@ SUBROUTINE HydroDyn_ParseInput( InputFileName, OutRootName, FileInfo_In, InputFi
    call ReadOutputListFromFileInfo( FileInfo_In, CurLine, InputFileData%UserOutputs, InputFileData%NUserOutputs, ErrStat2, ErrMsg2, UnEc )
          if (Failed()) return;
 
+   !-------------------------------------------------------------------------------------------------
+   ! Optional advanced options following the end of the output list
+   !-------------------------------------------------------------------------------------------------
+   InputFileData%WAMIT2%QTFCacheDir = ""
+   do I = CurLine, FileInfo_In%NumLines
+      Line = FileInfo_In%Lines(I)
+      call Conv2UC( Line )
+      if ( index(Line, 'QTFCACHE') > 1 ) then
+            ! QTFCache - Directory in which the full difference- and sum-QTF force time series are cached between runs (quoted string; "" to disable)
+         CurLine = I
+         call ParseVar( FileInfo_In, CurLine, 'QTFCache', InputFileData%WAMIT2%QTFCacheDir, ErrStat2, ErrMsg2, UnEc )
+            if (Failed())  return;
+         exit
+      end if
+   end do
+
    
    !-------------------------------------------------------------------------------------------------
    ! This is the end of the input file
@@ -1462,6 +1478,14 @@ SUBROUTINE HydroDynInput_ProcessInitData( InitInp, Interval, InputFileData, ErrS
    !TODO: Move this to where the WAMIT modules are initialized
       InputFileData%WAMIT%WAMITFile    = InputFileData%PotFile(1)
       InputFileData%WAMIT2%WAMITFile   = InputFileData%PotFile(1)
+
+         ! the QTF cache directory is also relative to the location of the main input file
+      IF ( LEN_TRIM( InputFileData%WAMIT2%QTFCacheDir ) > 0 ) THEN
+         IF ( PathIsRelative( InputFileData%WAMIT2%QTFCacheDir ) ) THEN
+            CALL GetPath( TRIM(InitInp%InputFile), TmpPath )
+            InputFileData%WAMIT2%QTFCacheDir = TRIM(TmpPath)//TRIM(InputFileData%WAMIT2%QTFCacheDir)
+         END IF
+      END IF
       
    ELSE
       InputFileData%PotFile            = ""
@@ -940,6 +940,40 @@ subroutine HydroDyn_CopyContState(SrcContStateData, DstContStateData, CtrlCode,
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine HydroDyn_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(HydroDyn_ContinuousStateType), intent(inout) :: ContStateData1
+   type(HydroDyn_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'HydroDyn_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(ContStateData1%WAMIT) .neqv. allocated(ContStateData2%WAMIT)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%WAMIT with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%WAMIT)) then
+      if (any(lbound(ContStateData1%WAMIT) /= lbound(ContStateData2%WAMIT)) .or. any(ubound(ContStateData1%WAMIT) /= ubound(ContStateData2%WAMIT))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%WAMIT with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ContStateData1%WAMIT)
+      UB(1:1) = ubound(ContStateData1%WAMIT)
+      do i1 = LB(1), UB(1)
+         call WAMIT_SwapContState(ContStateData1%WAMIT(i1), ContStateData2%WAMIT(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call Morison_SwapContState(ContStateData1%Morison, ContStateData2%Morison, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine HydroDyn_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(HydroDyn_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1055,6 +1089,44 @@ subroutine HydroDyn_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode,
    end if
 end subroutine
 
+subroutine HydroDyn_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(HydroDyn_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(HydroDyn_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_PtfmRefY(:)
+   character(*), parameter        :: RoutineName = 'HydroDyn_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(DiscStateData1%WAMIT) .neqv. allocated(DiscStateData2%WAMIT)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%WAMIT with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(DiscStateData1%WAMIT)) then
+      if (any(lbound(DiscStateData1%WAMIT) /= lbound(DiscStateData2%WAMIT)) .or. any(ubound(DiscStateData1%WAMIT) /= ubound(DiscStateData2%WAMIT))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%WAMIT with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(DiscStateData1%WAMIT)
+      UB(1:1) = ubound(DiscStateData1%WAMIT)
+      do i1 = LB(1), UB(1)
+         call WAMIT_SwapDiscState(DiscStateData1%WAMIT(i1), DiscStateData2%WAMIT(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call Morison_SwapDiscState(DiscStateData1%Morison, DiscStateData2%Morison, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call move_alloc(DiscStateData1%PtfmRefY, tmp_PtfmRefY)
+   call move_alloc(DiscStateData2%PtfmRefY, DiscStateData1%PtfmRefY)
+   call move_alloc(tmp_PtfmRefY, DiscStateData2%PtfmRefY)
+end subroutine
+
 subroutine HydroDyn_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(HydroDyn_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1148,6 +1220,24 @@ subroutine HydroDyn_CopyConstrState(SrcConstrStateData, DstConstrStateData, Ctrl
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine HydroDyn_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(HydroDyn_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(HydroDyn_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'HydroDyn_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call WAMIT_SwapConstrState(ConstrStateData1%WAMIT, ConstrStateData2%WAMIT, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call Morison_SwapConstrState(ConstrStateData1%Morison, ConstrStateData2%Morison, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine HydroDyn_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(HydroDyn_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1216,6 +1306,40 @@ subroutine HydroDyn_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCod
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine HydroDyn_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(HydroDyn_OtherStateType), intent(inout) :: OtherStateData1
+   type(HydroDyn_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'HydroDyn_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(OtherStateData1%WAMIT) .neqv. allocated(OtherStateData2%WAMIT)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%WAMIT with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%WAMIT)) then
+      if (any(lbound(OtherStateData1%WAMIT) /= lbound(OtherStateData2%WAMIT)) .or. any(ubound(OtherStateData1%WAMIT) /= ubound(OtherStateData2%WAMIT))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%WAMIT with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%WAMIT)
+      UB(1:1) = ubound(OtherStateData1%WAMIT)
+      do i1 = LB(1), UB(1)
+         call WAMIT_SwapOtherState(OtherStateData1%WAMIT(i1), OtherStateData2%WAMIT(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call Morison_SwapOtherState(OtherStateData1%Morison, OtherStateData2%Morison, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine HydroDyn_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(HydroDyn_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1742,6 +1866,39 @@ subroutine HydroDyn_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, Err
    end if
 end subroutine
 
+subroutine HydroDyn_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(HydroDyn_InputType), intent(inout) :: InputData1
+   type(HydroDyn_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_qAddDOF(:)
+   REAL(ReKi), allocatable :: tmp_qAddDOFDot(:)
+   REAL(ReKi), allocatable :: tmp_qAddDOFDotDot(:)
+   character(*), parameter        :: RoutineName = 'HydroDyn_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call Morison_SwapInput(InputData1%Morison, InputData2%Morison, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%WAMITMesh, InputData2%WAMITMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call MeshSwap(InputData1%PRPMesh, InputData2%PRPMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call move_alloc(InputData1%qAddDOF, tmp_qAddDOF)
+   call move_alloc(InputData2%qAddDOF, InputData1%qAddDOF)
+   call move_alloc(tmp_qAddDOF, InputData2%qAddDOF)
+   call move_alloc(InputData1%qAddDOFDot, tmp_qAddDOFDot)
+   call move_alloc(InputData2%qAddDOFDot, InputData1%qAddDOFDot)
+   call move_alloc(tmp_qAddDOFDot, InputData2%qAddDOFDot)
+   call move_alloc(InputData1%qAddDOFDotDot, tmp_qAddDOFDotDot)
+   call move_alloc(InputData2%qAddDOFDotDot, InputData1%qAddDOFDotDot)
+   call move_alloc(tmp_qAddDOFDotDot, InputData2%qAddDOFDotDot)
+end subroutine
+
 subroutine HydroDyn_DestroyInput(InputData, ErrStat, ErrMsg)
    type(HydroDyn_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
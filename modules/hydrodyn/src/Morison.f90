@@ -1795,6 +1795,9 @@ subroutine AllocateMemberDataArrays( member, memberLoads, errStat, errMsg )
    call AllocAry( memberLoads%F_If   , 6, member%NElements+1, 'memberLoads%F_If' , errStat2, errMsg2); call SetErrStat(errStat2, errMsg2, errStat, errMsg, routineName)
    call AllocAry( memberLoads%F_WMG  , 6, member%NElements+1, 'memberLoads%F_WMG', errStat2, errMsg2); call SetErrStat(errStat2, errMsg2, errStat, errMsg, routineName)
    call AllocAry( memberLoads%F_IMG  , 6, member%NElements+1, 'memberLoads%F_IMG', errStat2, errMsg2); call SetErrStat(errStat2, errMsg2, errStat, errMsg, routineName)
+   call AllocAry( memberLoads%F_Nd   , 6, member%NElements+1, 'memberLoads%F_Nd' , errStat2, errMsg2); call SetErrStat(errStat2, errMsg2, errStat, errMsg, routineName)
+   call AllocAry( memberLoads%F_B_End , 6, 2, 'memberLoads%F_B_End' , errStat2, errMsg2); call SetErrStat(errStat2, errMsg2, errStat, errMsg, routineName)
+   call AllocAry( memberLoads%F_BF_End, 6, 2, 'memberLoads%F_BF_End', errStat2, errMsg2); call SetErrStat(errStat2, errMsg2, errStat, errMsg, routineName)
 
    ! Shape dependent variables
    if (member%MSecGeom == MSecGeom_Cyl) then
@@ -1876,6 +1879,9 @@ subroutine AllocateMemberDataArrays( member, memberLoads, errStat, errMsg )
    memberLoads%F_If     = 0.0_ReKi
    memberLoads%F_WMG    = 0.0_ReKi
    memberLoads%F_IMG    = 0.0_ReKi
+   memberLoads%F_Nd     = 0.0_ReKi
+   memberLoads%F_B_End  = 0.0_ReKi
+   memberLoads%F_BF_End = 0.0_ReKi
 
    if (member%MSecGeom == MSecGeom_Cyl) then
       member%dRdl_mg       = 0.0_ReKi
@@ -3478,6 +3484,228 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, errStat,
    INTEGER                                           :: I, J
    REAL(ReKi)                                        :: qdotdot(6)      ! The structural acceleration of a mesh node
       
+   INTEGER                  :: N       ! Number of elements within a given member
+   REAL(ReKi)               :: z_hi
+   INTEGER(IntKi)           :: im    ! counter   
+   REAL(ReKi)               :: AM_End(3,3), An_End(3), DP_Const_End(3), I_MG_End(3,3)
+   LOGICAL                  :: Is1stFloodedMember
+   LOGICAL                  :: calcHstLdsLocal
+   TYPE(GridInterp_MiscVarType) :: WaveField_mThd ! per-thread wave field interpolation scratch for the member loop
+
+   ! Initialize errStat
+   errStat = ErrID_None
+   errMsg  = ""
+
+   ! Determine whether to calculate hydrostatic loads
+   if (present(calcHstLds)) then
+      calcHstLdsLocal = calcHstLds
+   else
+      calcHstLdsLocal = .true.
+   end if
+   
+   !===============================================================================================
+   ! Get displaced positions of the hydrodynamic nodes   
+   CALL GetDisplacedNodePosition( u, p, .FALSE., m%DispNodePosHdn ) ! For hydrodynamic loads; depends on WaveDisp and WaveStMod
+   CALL GetDisplacedNodePosition( u, p, .TRUE. , m%DispNodePosHst ) ! For hydrostatic loads;  always use actual displaced position
+
+   !===============================================================================================
+   ! Calculate the fluid kinematics at all mesh nodes and store for use in the equations below
+   CALL WaveField_GetWaveKin( p%WaveField, m%WaveField_m, Time, m%DispNodePosHdn, .FALSE., .TRUE., m%nodeInWater, m%WaveElev1, m%WaveElev2, m%WaveElev, m%FDynP, m%FV, m%FA, m%FAMCF, ErrStat2, ErrMsg2 )
+     CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   ! Compute fluid velocity relative to the structure
+   DO j = 1, p%NNodes
+      m%vrel(:,j)  = ( m%FV(:,j) - u%Mesh%TranslationVel(:,j) ) * m%nodeInWater(j)
+   END DO
+
+   !===============================================================================================
+   ! Get the instantaneous highest point of internal ballast for each filled group
+   ! This is the elevation with zero internal hydrostatic pressure
+   DO i = 1,p%NFillGroups
+      IF ( p%FilledGroups(i)%IsOpen ) THEN
+         m%zFillGroup(i) = 0.0  ! SWL because ballast group open to the environment follows the external hydrostatic pressure field
+      ELSE
+         Is1stFloodedMember = .true.
+         DO j = 1,p%FilledGroups(i)%FillNumM
+            im = p%FilledGroups(i)%FillMList(j)
+            IF (p%Members(im)%memfloodstatus>0) THEN
+               CALL getMemBallastHiPt(p,m,u,p%Members(im),z_hi,ErrStat2,ErrMsg2); if (Failed()) return
+               IF ( Is1stFloodedMember ) THEN
+                  m%zFillGroup(i) = z_hi
+                  Is1stFloodedMember = .false.
+               ELSE
+                  m%zFillGroup(i) = MAX(m%zFillGroup(i), z_hi)
+               END IF
+            END IF
+         END DO
+      END IF
+   END DO
+
+   ! ==============================================================================================
+   ! Calculate instantaneous loads on each member except for the hydrodynamic loads on member ends.
+   ! This covers aspects of the load calculations previously in CreateDistributedMesh.  
+
+   ! Zero out previous time-steps loads (these are loads which are computed at the member-level and summed onto a node, 
+   !    so they need to be zeroed out before the summations happen)
+   m%F_BF_End    = 0.0_ReKi
+   m%F_B_End     = 0.0_ReKi
+   y%Mesh%Force  = 0.0_ReKi
+   y%Mesh%Moment = 0.0_ReKi
+   
+   ! Members only write to their own load buffers (and a per-thread copy of the wave field interpolation data), so they are
+   ! processed concurrently. The buffers are then summed onto the mesh in member order, so the result does not depend on the
+   ! number of threads.
+   !$OMP PARALLEL DEFAULT(SHARED) PRIVATE(im, ErrStat2, ErrMsg2, WaveField_mThd)
+   WaveField_mThd = m%WaveField_m   ! each thread gets its own wave field interpolation scratch
+   !$OMP DO SCHEDULE(DYNAMIC)
+   DO im = 1, p%NMembers
+      call Morison_CalcMemberLoads( Time, u, p, xd, m, im, calcHstLdsLocal, m%memberLoads(im), WaveField_mThd, ErrStat2, ErrMsg2 )
+      if (ErrStat2 /= ErrID_None) then
+         !$OMP CRITICAL(Morison_MemberLoadsErr)
+         call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         !$OMP END CRITICAL(Morison_MemberLoadsErr)
+      end if
+   END DO
+   !$OMP END DO
+   !$OMP CRITICAL(Morison_MemberLoadsErr)
+   m%WaveField_m%FirstWarn_Clamp = m%WaveField_m%FirstWarn_Clamp .and. WaveField_mThd%FirstWarn_Clamp
+   !$OMP END CRITICAL(Morison_MemberLoadsErr)
+   !$OMP END PARALLEL
+   if (ErrStat >= AbortErrLev) return
+
+   ! Sum the member loads onto the mesh nodes and the member-end loads onto the joints
+   DO im = 1, p%NMembers
+      N = p%Members(im)%NElements
+      DO i = 1, N+1
+         j = p%Members(im)%NodeIndx(i)
+         y%Mesh%Force (:,j) = y%Mesh%Force (:,j) + m%memberLoads(im)%F_Nd(1:3,i)
+         y%Mesh%Moment(:,j) = y%Mesh%Moment(:,j) + m%memberLoads(im)%F_Nd(4:6,i)
+      END DO
+      m%F_B_End (:,p%Members(im)%NodeIndx(  1)) = m%F_B_End (:,p%Members(im)%NodeIndx(  1)) + m%memberLoads(im)%F_B_End (:,1)
+      m%F_B_End (:,p%Members(im)%NodeIndx(N+1)) = m%F_B_End (:,p%Members(im)%NodeIndx(N+1)) + m%memberLoads(im)%F_B_End (:,2)
+      m%F_BF_End(:,p%Members(im)%NodeIndx(  1)) = m%F_BF_End(:,p%Members(im)%NodeIndx(  1)) + m%memberLoads(im)%F_BF_End(:,1)
+      m%F_BF_End(:,p%Members(im)%NodeIndx(N+1)) = m%F_BF_End(:,p%Members(im)%NodeIndx(N+1)) + m%memberLoads(im)%F_BF_End(:,2)
+   END DO
+
+   !---------------------------------------------------------------------------------------------------------------!
+   !                                     External Hydrodynamic Joint Loads - Start                                 !
+   !                                        F_D_End, F_I_End, F_A_End, F_IMG_End                                   !
+   !---------------------------------------------------------------------------------------------------------------!      
+   ! NOTE:  All wave kinematics have already been zeroed out above the SWL or instantaneous wave height (for WaveStMod > 0), 
+   ! so loads derived from the kinematics will be correct without the use of a nodeInWater value, but other loads need to be 
+   ! multiplied by nodeInWater to zero them out above the SWL or instantaneous wave height.
+
+   DO J = 1, p%NJoints
+      ! Obtain the node index because WaveVel, WaveAcc, and WaveDynP are defined in the node indexing scheme, not the markers (No longer relevant?)
+      ! The first NJoints nodes are all the joints with the rest being the internal nodes. See Morison_GenerateSimulationNodes.
+            
+      ! NOTE: 
+      ! The PropPot values are only for members, and when the p%AM_End, p%DP_Const_End, p%Mass_MG_End, and p%I_MG_End are computed at init,
+      ! contributions to these values are added only if the member connecting to the joint is NOT modeled with potential flow theory
+      ! However, the p%An_End term used data from ALL members attached to a node, regardless of the PropPot setting, because the drag force is alway on.
+      ! Therefore, no need to check PropPot here.
+      
+      ! Effect of wave stretching already baked into m%FDynP, m%FA, and m%vrel. No additional modification needed.
+
+      ! Joint yaw offset
+      call YawJoint(p, J,u%PtfmRefY,AM_End,An_End,DP_Const_End,I_MG_End,ErrStat2,ErrMsg2)
+      call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
+      
+      ! Lumped added mass loads
+      qdotdot                 = reshape((/u%Mesh%TranslationAcc(:,J),u%Mesh%RotationAcc(:,J)/),(/6/)) 
+      m%F_A_End(:,J)          = m%nodeInWater(j) * matmul( AM_End, ( - qdotdot(1:3)) )
+         
+      ! TODO: The original code did not multiply by nodeInWater, but should we? GJH
+      ! Should be ok because m%FDynP and m%FA are both zeroed above the SWL (when WaveStMod=0) or the instantaneous free surface (when WaveStMod>0)
+      m%F_I_End(:,J) =   (DP_Const_End * m%FDynP(j) + matmul(AM_End,m%FA(:,j)))
+         
+      ! Marine growth inertia: ends: Section 4.2.2
+      m%F_IMG_End(1:3,j) = -p%Mass_MG_End(j)*qdotdot(1:3)
+      m%F_IMG_End(4:6,j) = -matmul(I_MG_End,qdotdot(4:6)) - cross_product(u%Mesh%RotationVel(:,J),matmul(I_MG_End,u%Mesh%RotationVel(:,J)))
+
+      ! Compute the dot product of the relative velocity vector with the directional Area of the Joint
+      ! m%nodeInWater(j) is probably not necessary because m%vrel is zeroed when the node is out of water
+      vmag  = m%nodeInWater(j) * ( m%vrel(1,j)*An_End(1) + m%vrel(2,j)*An_End(2) + m%vrel(3,j)*An_End(3) )
+      ! High-pass filtering
+      vmagf = p%VRelNFiltConst(J) * (vmag + xd%v_rel_n_FiltStat(J))
+
+      ! Record most up-to-date vmagf and vmag at join J
+      m%v_rel_n(j) = vmag
+      m%v_rel_n_HiPass(j) = vmagf
+
+      ! Evaluate drag force and combine all per-joint loads
+      DO I=1,6
+         IF (I < 4 ) THEN ! Three force components
+            IF ( p%DragMod_End(J) .EQ. 0_IntKi ) THEN
+               ! Note: vmag is zero if node is not in the water
+               m%F_D_End(i,j) = (1.0_ReKi - p%DragLoFSc_End(j)) * An_End(i) * p%DragConst_End(j) * abs(vmagf)*vmagf &   
+                                          + p%DragLoFSc_End(j)  * An_End(i) * p%DragConst_End(j) * abs(vmag )*vmag  
+            ELSE IF (p%DragMod_End(J) .EQ. 1_IntKi) THEN
+               ! Note: vmag is zero if node is not in the water
+               m%F_D_End(i,j) = (1.0_ReKi - p%DragLoFSc_End(j)) * An_End(i) * p%DragConst_End(j) * abs(vmagf)*max(vmagf,0.0_ReKi) &
+                                          + p%DragLoFSc_End(j)  * An_End(i) * p%DragConst_End(j) * abs(vmag) *max(vmag, 0.0_ReKi)
+               m%F_D_End(i,j) = 2.0_ReKi * m%F_D_End(i,j)
+            END IF
+            
+            y%Mesh%Force(i,j)    = y%Mesh%Force(i,j)    + m%F_D_End(i,j) + m%F_I_End(i,j) + p%F_WMG_End(i,j) + m%F_B_End(i,j) + m%F_BF_End(i,j) + m%F_A_End(i,j) + m%F_IMG_End(i,j)
+         ELSE ! Three moment components
+            y%Mesh%Moment(i-3,j) = y%Mesh%Moment(i-3,j) + m%F_B_End(i,j) + m%F_BF_End(i,j)  + m%F_IMG_End(i,j)
+         END IF
+      END DO  ! I=1,6
+         
+   END DO  ! J = 1, p%NJoints
+
+   !---------------------------------------------------------------------------------------------------------------!
+   !                                      External Hydrodynamic Joint Loads - End                                  !
+   !---------------------------------------------------------------------------------------------------------------!    
+   ! Map calculated results into the y%WriteOutput Array
+   CALL MrsnOut_MapOutputs(y, p, u, m)
+
+
+   ! map the motion to the visulization mesh
+   if (p%VisMeshes) then
+      !FIXME: error handling is incorrect here (overwrites all previous errors/warnings)
+      call Transfer_Point_to_Line2( u%Mesh, y%VisMesh, m%VisMeshMap, ErrStat, ErrMsg )
+   endif
+
+
+   CONTAINS
+
+   logical function Failed()
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      Failed = ErrStat >= AbortErrLev
+      !if (Failed) then
+      !   call FailCleanup()
+      !endif
+   end function Failed
+
+END SUBROUTINE Morison_CalcOutput
+
+!----------------------------------------------------------------------------------------------------------------------------------
+!> Calculates the loads on member im, except for the hydrodynamic loads on the member ends, and lumps them onto the member nodes.
+!! The loads are only accumulated in memberLoads (and WaveField_m is updated), so members can be processed concurrently; the
+!! caller sums memberLoads%F_Nd, memberLoads%F_B_End, and memberLoads%F_BF_End onto the mesh and joint loads afterwards.
+SUBROUTINE Morison_CalcMemberLoads( Time, u, p, xd, m, im, calcHstLds, memberLoads, WaveField_m, errStat, errMsg )
+!..................................................................................................................................
+
+   REAL(DbKi),                        INTENT(IN   )  :: Time        !< Current simulation time in seconds
+   TYPE(Morison_InputType),           INTENT(IN   )  :: u           !< Inputs at Time
+   TYPE(Morison_ParameterType),       INTENT(IN   )  :: p           !< Parameters
+   TYPE(Morison_DiscreteStateType),   INTENT(IN   )  :: xd          !< Discrete states at Time
+   TYPE(Morison_MiscVarType),         INTENT(IN   )  :: m           !< Misc/optimization variables (node positions and wave kinematics at Time)
+   INTEGER(IntKi),                    INTENT(IN   )  :: im          !< Member number
+   LOGICAL,                           INTENT(IN   )  :: calcHstLds  !< Flag to calculate the hydrostatic loads
+   TYPE(Morison_MemberLoads),         INTENT(INOUT)  :: memberLoads !< Loads on member im
+   TYPE(GridInterp_MiscVarType),      INTENT(INOUT)  :: WaveField_m !< Wave field interpolation misc/optimization variables
+   INTEGER(IntKi),                    INTENT(  OUT)  :: errStat     !< Error status of the operation
+   CHARACTER(*),                      INTENT(  OUT)  :: errMsg      !< Error message if errStat /= ErrID_None
+
+   ! Local variables
+   INTEGER(IntKi)                                    :: errStat2    ! Error status of the operation (occurs after initial error)
+   CHARACTER(errMsgLen)                              :: errMsg2     ! Error message if errStat2 /= ErrID_None
+   character(*), parameter                           :: RoutineName = 'Morison_CalcMemberLoads'
+      
+   INTEGER                                           :: I
+      
    TYPE(Morison_MemberType) :: mem     ! the current member
    INTEGER                  :: N       ! Number of elements within a given member
    REAL(ReKi)               :: dl      ! Element length within a given member, m
@@ -3489,19 +3717,15 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, errStat,
    REAL(ReKi)               :: sinBeta, sinBeta1, sinBeta2
    REAL(ReKi)               :: cosBeta, cosBeta1, cosBeta2
    REAL(ReKi)               :: CMatrix(3,3), CMatrix1(3,3), CMatrix2(3,3), CTrans(3,3) ! Direction cosine matrix for element, and its transpose
-   REAL(ReKi)               :: l, z1, z2, zMid, r1, r2, r1b, r2b, r1In, r2In, rMidIn, z_hi, zFillGroup
-   REAL(ReKi)               :: Sa1, Sa2, Sa1b, Sa2b, SaMidb, Sa1In, Sa2In, SaMidIn
-   REAL(ReKi)               :: Sb1, Sb2, Sb1b, Sb2b, SbMidb, Sb1In, Sb2In, SbMidIn
+   REAL(ReKi)               :: l, z1, z2, zMid, r1, r2, r1b, r2b, r1In, r2In, rMidIn, zFillGroup
+   REAL(ReKi)               :: Sa1, Sa2, Sa1b, Sa2b, Sa1In, Sa2In, SaMidIn
+   REAL(ReKi)               :: Sb1, Sb2, Sb1b, Sb2b, Sb1In, Sb2In, SbMidIn
    REAL(ReKi)               :: dRdl_mg,   dSadl_mg,   dSbdl_mg    ! shorthand for taper including marine growth of element i
    REAL(ReKi)               :: dRdl_mg_b, dSadl_mg_b, dSbdl_mg_b  ! shorthand for taper including marine growth of element i with radius scaling by sqrt(Cb)
    REAL(ReKi)               :: RMGFSInt, SaMGFSInt, SbMGFSInt     ! Member radius with marine growth at the intersection with the instantaneous free surface
    REAL(ReKi)               :: g     ! gravity constant
    REAL(ReKi)               :: k_hat(3), k_hat1(3), k_hat2(3) ! Elemental unit vector pointing from 1st node to 2nd node of the element
    REAL(ReKi)               :: n_hat(3) ! Free surface unit normal vector pointing from water to air
-   REAL(ReKi)               :: Fr    !radial component of buoyant force
-   REAL(ReKi)               :: Fl    !axial component of buoyant force
-   REAL(ReKi)               :: Moment     !moment induced about the center of the cylinder's bottom face
-   INTEGER(IntKi)           :: im    ! counter   
    REAL(ReKi)               :: a_s1(3)       
    REAL(ReKi)               :: alpha_s1(3)
    REAL(ReKi)               :: omega_s1(3)
@@ -3510,10 +3734,9 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, errStat,
    REAL(ReKi)               :: omega_s2(3)
    REAL(ReKi)               :: pos1(3), pos2(3)
    REAL(ReKi)               :: Imat(3,3)
-   REAL(ReKi)               :: iArm(3), iTerm(3), h_c, dRdl_p, dRdl_pp, dSadl_p, dSadl_pp, dSbdl_p, dSbdl_pp, f_hydro(3), Am(3,3), lstar, deltal, deltalLeft, deltalRight
+   REAL(ReKi)               :: iArm(3), iTerm(3), h_c, dRdl_p, dRdl_pp, dSadl_p, dSadl_pp, dSbdl_p, dSbdl_pp, f_hydro(3), Am(3,3), deltal, deltalLeft, deltalRight
    REAL(ReKi)               :: h, h_c_AM, deltal_AM
    REAL(ReKi)               :: F_WMG(6), F_IMG(6), F_If(6), F_B0(6), F_B1(6), F_B2(6), F_B_End(6)
-   REAL(ReKi)               :: AM_End(3,3), An_End(3), DP_Const_End(3), I_MG_End(3,3)
 
    ! Local variables needed for wave stretching and load smoothing/redistribution
    INTEGER(IntKi)           :: FSElem
@@ -3539,142 +3762,271 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, errStat,
    REAL(ReKi)               :: FDynPFSInt
    REAL(ReKi)               :: vrelFSInt(3)
    REAL(ReKi)               :: FAMCFFSInt(3)
-   REAL(ReKi)               :: CdFSInt, CdAFSInt, CdBFSInt, AxCdFSInt, CaFSInt, CaAFSInt, CaBFSInt, AxCaFSInt, CpFSInt, AxCpFSInt
+   REAL(ReKi)               :: CdFSInt, AxCdFSInt, CaFSInt, CaAFSInt, CaBFSInt, AxCaFSInt, CpFSInt, AxCpFSInt
    INTEGER(IntKi)           :: MemSubStat, NumFSX
    REAL(DbKi)               :: theta1, theta2
    REAL(ReKi)               :: x_hat(3), x_hat1(3), x_hat2(3), y_hat(3), y_hat1(3), y_hat2(3), z_hat(3), posMid(3), zetaMid, FSPt(3)
    INTEGER(IntKi)           :: secStat
    INTEGER(IntKi)           :: nodeInWater
    REAL(SiKi)               :: WaveElev1, WaveElev2, WaveElev, FDynP, FV(3), FA(3), FAMCF(3)
-   LOGICAL                  :: Is1stElement, Is1stFloodedMember
-   LOGICAL                  :: calcHstLdsLocal
+   LOGICAL                  :: Is1stElement
 
-   ! Initialize errStat
    errStat = ErrID_None
    errMsg  = ""
    Imat    = 0.0_ReKi
    g       = p%Gravity
 
-   ! Determine whether to calculate hydrostatic loads
-   if (present(calcHstLds)) then
-      calcHstLdsLocal = calcHstLds
-   else
-      calcHstLdsLocal = .true.
-   end if
-   
-   !===============================================================================================
-   ! Get displaced positions of the hydrodynamic nodes   
-   CALL GetDisplacedNodePosition( u, p, .FALSE., m%DispNodePosHdn ) ! For hydrodynamic loads; depends on WaveDisp and WaveStMod
-   CALL GetDisplacedNodePosition( u, p, .TRUE. , m%DispNodePosHst ) ! For hydrostatic loads;  always use actual displaced position
+   mem = p%Members(im)
+   N   = mem%NElements
+   call YawMember(mem, u%PtfmRefY, ErrStat2, ErrMsg2)
+   call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
-   !===============================================================================================
-   ! Calculate the fluid kinematics at all mesh nodes and store for use in the equations below
-   CALL WaveField_GetWaveKin( p%WaveField, m%WaveField_m, Time, m%DispNodePosHdn, .FALSE., .TRUE., m%nodeInWater, m%WaveElev1, m%WaveElev2, m%WaveElev, m%FDynP, m%FV, m%FA, m%FAMCF, ErrStat2, ErrMsg2 )
-     CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   ! Compute fluid velocity relative to the structure
-   DO j = 1, p%NNodes
-      m%vrel(:,j)  = ( m%FV(:,j) - u%Mesh%TranslationVel(:,j) ) * m%nodeInWater(j)
-   END DO
-
-   !===============================================================================================
-   ! Get the instantaneous highest point of internal ballast for each filled group
-   ! This is the elevation with zero internal hydrostatic pressure
-   DO i = 1,p%NFillGroups
-      IF ( p%FilledGroups(i)%IsOpen ) THEN
-         m%zFillGroup(i) = 0.0  ! SWL because ballast group open to the environment follows the external hydrostatic pressure field
+   !zero member loads
+   memberLoads%F_B      = 0.0_ReKi
+   memberLoads%F_BF     = 0.0_ReKi
+   memberLoads%F_D      = 0.0_ReKi
+   memberLoads%F_A      = 0.0_ReKi
+   memberLoads%F_I      = 0.0_ReKi
+   memberLoads%F_WMG    = 0.0_ReKi
+   memberLoads%F_IMG    = 0.0_ReKi
+   memberLoads%F_If     = 0.0_ReKi
+   memberLoads%F_Nd     = 0.0_ReKi
+   memberLoads%F_B_End  = 0.0_ReKi
+   memberLoads%F_BF_End = 0.0_ReKi
+
+   ! Determine member submergence status
+   IF ( p%WaveField%WaveStMod .EQ. 0_IntKi ) THEN ! No wave stretching - Only need to check the two ends
+      IF ( m%nodeInWater(mem%NodeIndx(1)) .NE. m%nodeInWater(mem%NodeIndx(N+1)) ) THEN
+         MemSubStat = 1_IntKi  ! Member centerline crosses the SWL once
+      ELSE IF ( m%nodeInWater(mem%NodeIndx(1)) .EQ. 0_IntKi ) THEN
+         MemSubStat = 3_IntKi  ! Member centerline completely above water
       ELSE
-         Is1stFloodedMember = .true.
-         DO j = 1,p%FilledGroups(i)%FillNumM
-            im = p%FilledGroups(i)%FillMList(j)
-            IF (p%Members(im)%memfloodstatus>0) THEN
-               CALL getMemBallastHiPt(p,m,u,p%Members(im),z_hi,ErrStat2,ErrMsg2); if (Failed()) return
-               IF ( Is1stFloodedMember ) THEN
-                  m%zFillGroup(i) = z_hi
-                  Is1stFloodedMember = .false.
-               ELSE
-                  m%zFillGroup(i) = MAX(m%zFillGroup(i), z_hi)
-               END IF
-            END IF
-         END DO
+         MemSubStat = 0_IntKi  ! Member centerline fully submerged
+      END IF 
+   ELSE IF ( p%WaveField%WaveStMod > 0_IntKi ) THEN ! Has wave stretching - Need to check every node
+      NumFSX = 0_IntKi ! Number of free-surface crossing
+      DO i = 1, N ! loop through member elements
+         IF ( m%nodeInWater(mem%NodeIndx(i)) .NE. m%nodeInWater(mem%NodeIndx(i+1)) ) THEN
+            NumFSX = NumFSX + 1
+         END IF
+      END DO
+      IF (NumFSX .EQ. 1_IntKi) THEN
+         MemSubStat = 1_IntKi  ! Member centerline crosses the free surface once
+      ELSE IF (NumFSX .GT. 1_IntKi) THEN
+         MemSubStat = 2_IntKi  ! Member centerline crosses the free surface multiple time
+      ELSE ! Member centerline does not cross the free surface
+         IF ( m%nodeInWater(mem%NodeIndx(1)) .EQ. 0_IntKi ) THEN
+            MemSubStat = 3_IntKi  ! Member centerline completely above water
+         ELSE
+            MemSubStat = 0_IntKi  ! Member centerline completely submerged
+         END IF
       END IF
-   END DO
+   END IF
 
-   ! ==============================================================================================
-   ! Calculate instantaneous loads on each member except for the hydrodynamic loads on member ends.
-   ! This covers aspects of the load calculations previously in CreateDistributedMesh.  
+   !---------------- Marine growth and Buoyancy: Sides: Only if member not modeled with potential flow theory ----------------  
+   IF ( .NOT. mem%PropPot ) THEN ! Member is NOT modeled with Potential Flow Theory
+      DO i = max(mem%i_floor,1), N    ! loop through member elements that are not completely buried in the seabed
+      
+         ! calculate instantaneous incline angle and heading, and related trig values
+         ! the first and last NodeIndx values point to the corresponding Joint nodes indices which are at the start of the Mesh
+         pos1    = m%DispNodePosHst(:, mem%NodeIndx(i  ))
+         pos2    = m%DispNodePosHst(:, mem%NodeIndx(i+1))
 
-   ! Zero out previous time-steps loads (these are loads which are computed at the member-level and summed onto a node, 
-   !    so they need to be zeroed out before the summations happen)
-   m%F_BF_End    = 0.0_ReKi
-   m%F_B_End     = 0.0_ReKi
-   y%Mesh%Force  = 0.0_ReKi
-   y%Mesh%Moment = 0.0_ReKi
-   
-   ! Loop through each member
-   DO im = 1, p%NMembers    
-      mem = p%Members(im)
-      N   = mem%NElements
-      call YawMember(mem, u%PtfmRefY, ErrStat2, ErrMsg2)
-      call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-
-      !zero member loads
-      m%memberLoads(im)%F_B   = 0.0_ReKi
-      m%memberLoads(im)%F_BF  = 0.0_ReKi
-      m%memberLoads(im)%F_D   = 0.0_ReKi
-      m%memberLoads(im)%F_A   = 0.0_ReKi
-      m%memberLoads(im)%F_I   = 0.0_ReKi
-      m%memberLoads(im)%F_WMG = 0.0_ReKi
-      m%memberLoads(im)%F_IMG = 0.0_ReKi
-      m%memberLoads(im)%F_If  = 0.0_ReKi
-
-      ! Determine member submergence status
-      IF ( p%WaveField%WaveStMod .EQ. 0_IntKi ) THEN ! No wave stretching - Only need to check the two ends
-         IF ( m%nodeInWater(mem%NodeIndx(1)) .NE. m%nodeInWater(mem%NodeIndx(N+1)) ) THEN
-            MemSubStat = 1_IntKi  ! Member centerline crosses the SWL once
-         ELSE IF ( m%nodeInWater(mem%NodeIndx(1)) .EQ. 0_IntKi ) THEN
-            MemSubStat = 3_IntKi  ! Member centerline completely above water
-         ELSE
-            MemSubStat = 0_IntKi  ! Member centerline fully submerged
-         END IF 
-      ELSE IF ( p%WaveField%WaveStMod > 0_IntKi ) THEN ! Has wave stretching - Need to check every node
-         NumFSX = 0_IntKi ! Number of free-surface crossing
-         DO i = 1, N ! loop through member elements
-            IF ( m%nodeInWater(mem%NodeIndx(i)) .NE. m%nodeInWater(mem%NodeIndx(i+1)) ) THEN
-               NumFSX = NumFSX + 1
+         call GetOrientationAngles( pos1, pos2, phi, sinPhi, cosPhi, tanPhi, sinBeta, cosBeta, k_hat, errStat2, errMsg2 )
+           call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         ! Compute element to global DirCos matrix for undisplaced structure first
+         call Morison_DirCosMtrx( u%Mesh%Position(:,mem%NodeIndx(i  )), u%Mesh%Position(:,mem%NodeIndx(i+1)), mem%MSpinOrient, CMatrix )
+         ! Prepend body motion - Assuming the rotation of the starting node is representative of the whole element
+         CMatrix = matmul(transpose(u%Mesh%Orientation(:,:,mem%NodeIndx(i))),CMatrix)
+         CTrans  = transpose(CMatrix)
+         ! Note: CMatrix is element local to global displaced. CTrans is the opposite.
+         ! save some commonly used variables   
+         dl        = mem%dl
+         a_s1      = u%Mesh%TranslationAcc(:, mem%NodeIndx(i  ))
+         alpha_s1  = u%Mesh%RotationAcc   (:, mem%NodeIndx(i  ))
+         omega_s1  = u%Mesh%RotationVel   (:, mem%NodeIndx(i  ))
+         a_s2      = u%Mesh%TranslationAcc(:, mem%NodeIndx(i+1))
+         alpha_s2  = u%Mesh%RotationAcc   (:, mem%NodeIndx(i+1))
+         omega_s2  = u%Mesh%RotationVel   (:, mem%NodeIndx(i+1))
+         IF (mem%MSecGeom == MSecGeom_Cyl) THEN
+            r1         = mem%RMG(i  )      ! outer radius at element nodes including marine growth
+            r2         = mem%RMG(i+1)
+            r1b        = mem%RMGB(i  )     ! outer radius at element nodes including marine growth scaled by sqrt(Cb)
+            r2b        = mem%RMGB(i+1)
+            dRdl_mg    = mem%dRdl_mg(i)    ! Taper of element including marine growth
+            dRdl_mg_b  = mem%dRdl_mg_b(i)  ! Taper of element including marine growth with radius scaling by sqrt(Cb)
+         ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
+            Sa1        = mem%SaMG(i  )     ! outer side A at element nodes including marine growth
+            Sa2        = mem%SaMG(i+1)
+            Sb1        = mem%SbMG(i  )     ! outer side B at element nodes including marine growth
+            Sb2        = mem%SbMG(i+1)
+            Sa1b       = mem%SaMGB(i  )    ! outer side A at element nodes including marine growth scaled by sqrt(Cb)
+            Sa2b       = mem%SaMGB(i+1)
+            Sb1b       = mem%SbMGB(i  )    ! outer side B at element nodes including marine growth scaled by sqrt(Cb)
+            Sb2b       = mem%SbMGB(i+1)
+            dSadl_mg   = mem%dSadl_mg(i)   ! Taper of element side A including marine growth
+            dSadl_mg_b = mem%dSadl_mg_b(i) ! Taper of element side A including marine growth with radius scaling by sqrt(Cb)
+            dSbdl_mg   = mem%dSbdl_mg(i)   ! Taper of element side B including marine growth
+            dSbdl_mg_b = mem%dSbdl_mg_b(i) ! Taper of element side B including marine growth with radius scaling by sqrt(Cb)
+         END IF
+
+         ! ------------------ marine growth: Sides: Section 4.1.2 --------------------  
+         ! ----- marine growth weight
+         F_WMG = 0.0_ReKi
+
+         ! lower node
+         F_WMG(3) = - mem%m_mg_l(i)*g ! weight force  : Note: this is a constant
+         F_WMG(4) = - mem%m_mg_l(i)*g * mem%h_cmg_l(i)* sinPhi * sinBeta! weight force
+         F_WMG(5) =   mem%m_mg_l(i)*g * mem%h_cmg_l(i)* sinPhi * cosBeta! weight force
+         memberLoads%F_WMG(:,i) = memberLoads%F_WMG(:,i) + F_WMG
+         memberLoads%F_Nd(1:3,i) = memberLoads%F_Nd(1:3,i) + F_WMG(1:3)
+         memberLoads%F_Nd(4:6,i) = memberLoads%F_Nd(4:6,i) + F_WMG(4:6)
+         
+         ! upper node
+         F_WMG(3) = - mem%m_mg_u(i)*g ! weight force  : Note: this is a constant 
+         F_WMG(4) = - mem%m_mg_u(i)*g * mem%h_cmg_u(i)* sinPhi * sinBeta! weight force
+         F_WMG(5) =   mem%m_mg_u(i)*g * mem%h_cmg_u(i)* sinPhi * cosBeta! weight force
+         memberLoads%F_WMG(:,i+1) = memberLoads%F_WMG(:,i+1) + F_WMG  
+         memberLoads%F_Nd(1:3,i+1) = memberLoads%F_Nd(1:3,i+1) + F_WMG(1:3)
+         memberLoads%F_Nd(4:6,i+1) = memberLoads%F_Nd(4:6,i+1) + F_WMG(4:6)
+         
+         ! ----- marine growth inertial load
+         ! lower node
+         Imat      = 0.0_ReKi
+         IF (mem%MSecGeom == MSecGeom_Cyl) THEN
+            Imat(1,1) = mem%I_rmg_l(i)
+            Imat(2,2) = mem%I_rmg_l(i)
+         ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
+            Imat(1,1) = mem%I_xmg_l(i)
+            Imat(2,2) = mem%I_ymg_l(i)
+         END IF
+         Imat(3,3) = mem%I_lmg_l(i)
+         Imat      =  matmul(matmul(CMatrix, Imat), CTrans)
+         iArm = mem%h_cmg_l(i) * k_hat
+         iTerm     = ( -a_s1 - cross_product(omega_s1, cross_product(omega_s1,iArm )) - cross_product(alpha_s1,iArm) ) * mem%m_mg_l(i)
+         F_IMG(1:3) = iTerm
+         F_IMG(4:6) = - matmul(Imat, alpha_s1) - cross_product(iArm,a_s1 * mem%m_mg_l(i)) &
+                      - cross_product(omega_s1,matmul(Imat,omega_s1))
+         memberLoads%F_IMG(:,i) = memberLoads%F_IMG(:,i) + F_IMG
+         memberLoads%F_Nd(1:3,i) = memberLoads%F_Nd(1:3,i) + F_IMG(1:3)
+         memberLoads%F_Nd(4:6,i) = memberLoads%F_Nd(4:6,i) + F_IMG(4:6)
+
+         ! upper node
+         Imat      = 0.0_ReKi
+         IF (mem%MSecGeom == MSecGeom_Cyl) THEN
+            Imat(1,1) = mem%I_rmg_u(i)
+            Imat(2,2) = mem%I_rmg_u(i)
+         ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
+            Imat(1,1) = mem%I_xmg_u(i)
+            Imat(2,2) = mem%I_ymg_u(i)
+         END IF
+         Imat(3,3) = mem%I_lmg_u(i)
+         Imat      =  matmul(matmul(CMatrix, Imat), CTrans)
+         iArm = mem%h_cmg_u(i) * k_hat
+         iTerm     = ( -a_s2 - cross_product(omega_s2, cross_product(omega_s2,iArm )) - cross_product(alpha_s2,iArm) ) * mem%m_mg_u(i)
+         F_IMG(1:3) = iTerm
+         F_IMG(4:6) = - matmul(Imat, alpha_s2) - cross_product(iArm,a_s2 * mem%m_mg_u(i)) &
+                      - cross_product(omega_s2,matmul(Imat,omega_s2))
+         memberLoads%F_IMG(:,i+1) = memberLoads%F_IMG(:,i+1) + F_IMG
+         memberLoads%F_Nd(1:3,i+1) = memberLoads%F_Nd(1:3,i+1) + F_IMG(1:3)
+         memberLoads%F_Nd(4:6,i+1) = memberLoads%F_Nd(4:6,i+1) + F_IMG(4:6)
+
+         ! ------------------- buoyancy loads: sides: Sections 3.1 and 3.2 ------------------------
+
+         ! Skip hydrostatic load calculation if flag is false
+         if (.not. calcHstLds) cycle  
+
+         ! Select hydrostatic load calculation method
+         select case (mem%MHstLMod)
+
+         ! Standard hydrostatic load calculation
+         case (1)
+
+            IF ( p%HstMod > 0_IntKi ) THEN ! If wave stretching is enabled, compute buoyancy up to free surface
+               CALL GetTotalWaveElev(p, WaveField_m, Time, pos1, Zeta1, ErrStat2, ErrMsg2 )
+               CALL GetTotalWaveElev(p, WaveField_m, Time, pos2, Zeta2, ErrStat2, ErrMsg2 )
+                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            ELSE ! Without wave stretching, compute buoyancy based on SWL
+               Zeta1 = 0.0_ReKi
+               Zeta2 = 0.0_ReKi
             END IF
-         END DO
-         IF (NumFSX .EQ. 1_IntKi) THEN
-            MemSubStat = 1_IntKi  ! Member centerline crosses the free surface once
-         ELSE IF (NumFSX .GT. 1_IntKi) THEN
-            MemSubStat = 2_IntKi  ! Member centerline crosses the free surface multiple time
-         ELSE ! Member centerline does not cross the free surface
-            IF ( m%nodeInWater(mem%NodeIndx(1)) .EQ. 0_IntKi ) THEN
-               MemSubStat = 3_IntKi  ! Member centerline completely above water
+            Is1stElement = ( i .EQ. 1)
+            CALL getElementHstLds_Mod1(p, WaveField_m, mem, Time, pos1, pos2, Zeta1, Zeta2, k_hat, r1b, r2b, dl, mem%alpha(i), Is1stElement, F_B0, F_B1, F_B2, ErrStat2, ErrMsg2 )
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            ! Add nodal loads to mesh
+            IF ( .NOT. Is1stElement ) THEN
+               memberLoads%F_B(:, i-1) = memberLoads%F_B(:, i-1) + F_B0
+               memberLoads%F_Nd(1:3,i-1) = memberLoads%F_Nd(1:3,i-1) + F_B0(1:3)
+               memberLoads%F_Nd(4:6,i-1) = memberLoads%F_Nd(4:6,i-1) + F_B0(4:6)
+            END IF
+            memberLoads%F_B(:, i  ) = memberLoads%F_B(:, i  ) + F_B1
+            memberLoads%F_B(:, i+1) = memberLoads%F_B(:, i+1) + F_B2
+            memberLoads%F_Nd(1:3,i  ) = memberLoads%F_Nd(1:3,i  ) + F_B1(1:3)
+            memberLoads%F_Nd(4:6,i  ) = memberLoads%F_Nd(4:6,i  ) + F_B1(4:6)
+            memberLoads%F_Nd(1:3,i+1) = memberLoads%F_Nd(1:3,i+1) + F_B2(1:3)
+            memberLoads%F_Nd(4:6,i+1) = memberLoads%F_Nd(4:6,i+1) + F_B2(4:6)
+         
+         ! Alternative hydrostatic load calculation
+         case (2)
+
+            ! Get free surface elevation and normal at the element midpoint (both assumed constant over the element)
+            posMid = 0.5 * (pos1+pos2)
+
+            IF (p%HstMod > 0_IntKi) THEN
+               CALL GetTotalWaveElev(p, WaveField_m, Time, posMid, ZetaMid, ErrStat2, ErrMsg2 )
+                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+               CALL GetFreeSurfaceNormal( p, WaveField_m, Time, posMid, n_hat, ErrStat2, ErrMsg2 )
+                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+               FSPt = (/posMid(1),posMid(2),ZetaMid/) ! Reference point on the free surface
             ELSE
-               MemSubStat = 0_IntKi  ! Member centerline completely submerged
+               FSPt = (/posMid(1),posMid(2),0.0_ReKi/)
+               n_hat = (/0.0,0.0,1.0/)
             END IF
-         END IF
-      END IF
 
-      !---------------- Marine growth and Buoyancy: Sides: Only if member not modeled with potential flow theory ----------------  
-      IF ( .NOT. mem%PropPot ) THEN ! Member is NOT modeled with Potential Flow Theory
-         DO i = max(mem%i_floor,1), N    ! loop through member elements that are not completely buried in the seabed
-         
+            IF (mem%MSecGeom == MSecGeom_Cyl) THEN
+               CALL GetSectionUnitVectors_Cyl( k_hat, y_hat, z_hat )
+               CALL getElementHstLds_Mod2_Cyl( p, pos1, pos2, FSPt, k_hat, y_hat, z_hat, n_hat, r1b, r2b, dl, F_B1, F_B2, ErrStat2, ErrMsg2)
+            ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
+               CALL GetSectionUnitVectors_Rec( CMatrix, x_hat, y_hat )
+               CALL getElementHstLds_Mod2_Rec( p, pos1, pos2, FSPt, k_hat, x_hat, y_hat, n_hat, Sa1b, Sa2b, Sb1b, Sb2b, dl, F_B1, F_B2, ErrStat2, ErrMsg2)
+            END IF
+
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+
+            ! Add nodal loads to mesh
+            memberLoads%F_B(:,i  ) = memberLoads%F_B(:,i  ) + F_B1
+            memberLoads%F_B(:,i+1) = memberLoads%F_B(:,i+1) + F_B2
+            memberLoads%F_Nd(1:3,i  ) = memberLoads%F_Nd(1:3,i  ) + F_B1(1:3)
+            memberLoads%F_Nd(4:6,i  ) = memberLoads%F_Nd(4:6,i  ) + F_B1(4:6)
+            memberLoads%F_Nd(1:3,i+1) = memberLoads%F_Nd(1:3,i+1) + F_B2(1:3)
+            memberLoads%F_Nd(4:6,i+1) = memberLoads%F_Nd(4:6,i+1) + F_B2(4:6)
+
+         end select ! MHstLMod
+      END DO ! i = max(mem%i_floor,1), N    ! loop through member elements that are not fully buried in the seabed
+   END IF ! NOT Modeled with Potential flow theory
+
+   ! --------------------------- flooded ballast: sides: Always compute regardless of PropPot setting ------------------------------
+   ! NOTE: For memfloodstatus and floodstatus: 0 = fully buried or not ballasted, 1 = fully flooded, 2 = partially flooded
+   IF ( mem%memfloodstatus > 0 ) THEN  ! Fully or partially flooded member
+      zFillGroup = m%zFillGroup(mem%MmbrFilledIDIndx)
+      DO i = max(mem%i_floor,1), N    ! loop through member elements that are not completely buried in the seabed
+         IF (mem%floodstatus(i)>0) THEN
             ! calculate instantaneous incline angle and heading, and related trig values
             ! the first and last NodeIndx values point to the corresponding Joint nodes indices which are at the start of the Mesh
-            pos1    = m%DispNodePosHst(:, mem%NodeIndx(i  ))
-            pos2    = m%DispNodePosHst(:, mem%NodeIndx(i+1))
+            pos1 = m%DispNodePosHst(:,mem%NodeIndx(i  ))
+            pos2 = m%DispNodePosHst(:,mem%NodeIndx(i+1))
 
-            call GetOrientationAngles( pos1, pos2, phi, sinPhi, cosPhi, tanPhi, sinBeta, cosBeta, k_hat, errStat2, errMsg2 )
-              call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            call GetOrientationAngles( pos1, pos2, phi, sinPhi, cosPhi, tanPhi, sinBeta, cosBeta, k_hat, errStat2, errMsg2 ); if (Failed()) return
             ! Compute element to global DirCos matrix for undisplaced structure first
             call Morison_DirCosMtrx( u%Mesh%Position(:,mem%NodeIndx(i  )), u%Mesh%Position(:,mem%NodeIndx(i+1)), mem%MSpinOrient, CMatrix )
             ! Prepend body motion - Assuming the rotation of the starting node is representative of the whole element
             CMatrix = matmul(transpose(u%Mesh%Orientation(:,:,mem%NodeIndx(i))),CMatrix)
             CTrans  = transpose(CMatrix)
             ! Note: CMatrix is element local to global displaced. CTrans is the opposite.
-            ! save some commonly used variables   
+            ! save some commonly used variables
             dl        = mem%dl
+            z1        = pos1(3)          ! get displaced node z locations
+            z2        = pos2(3)
             a_s1      = u%Mesh%TranslationAcc(:, mem%NodeIndx(i  ))
             alpha_s1  = u%Mesh%RotationAcc   (:, mem%NodeIndx(i  ))
             omega_s1  = u%Mesh%RotationVel   (:, mem%NodeIndx(i  ))
@@ -3682,1109 +4034,837 @@ SUBROUTINE Morison_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, errStat,
             alpha_s2  = u%Mesh%RotationAcc   (:, mem%NodeIndx(i+1))
             omega_s2  = u%Mesh%RotationVel   (:, mem%NodeIndx(i+1))
             IF (mem%MSecGeom == MSecGeom_Cyl) THEN
-               r1         = mem%RMG(i  )      ! outer radius at element nodes including marine growth
-               r2         = mem%RMG(i+1)
-               r1b        = mem%RMGB(i  )     ! outer radius at element nodes including marine growth scaled by sqrt(Cb)
-               r2b        = mem%RMGB(i+1)
-               dRdl_mg    = mem%dRdl_mg(i)    ! Taper of element including marine growth
-               dRdl_mg_b  = mem%dRdl_mg_b(i)  ! Taper of element including marine growth with radius scaling by sqrt(Cb)
+               r1In = mem%Rin(i  )      ! outer radius at element nodes including marine growth
+               r2In = mem%Rin(i+1)
+               IF ( mem%floodstatus(i) == 1 ) THEN    ! Fully flooded element
+                  zMid   = 0.5 * (z1   + z2  )
+                  rMidIn = 0.5 * (r1In + r2In)
+               ELSE                                   ! Partially flooded element
+                  zMid   = z1 + mem%h_fill * k_hat(3)
+                  l      = mem%h_fill/mem%dl
+                  rMidIn = r1In * (1.0-l) + r2In * l
+               END IF
             ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
-               Sa1        = mem%SaMG(i  )     ! outer side A at element nodes including marine growth
-               Sa2        = mem%SaMG(i+1)
-               Sb1        = mem%SbMG(i  )     ! outer side B at element nodes including marine growth
-               Sb2        = mem%SbMG(i+1)
-               Sa1b       = mem%SaMGB(i  )    ! outer side A at element nodes including marine growth scaled by sqrt(Cb)
-               Sa2b       = mem%SaMGB(i+1)
-               Sb1b       = mem%SbMGB(i  )    ! outer side B at element nodes including marine growth scaled by sqrt(Cb)
-               Sb2b       = mem%SbMGB(i+1)
-               dSadl_mg   = mem%dSadl_mg(i)   ! Taper of element side A including marine growth
-               dSadl_mg_b = mem%dSadl_mg_b(i) ! Taper of element side A including marine growth with radius scaling by sqrt(Cb)
-               dSbdl_mg   = mem%dSbdl_mg(i)   ! Taper of element side B including marine growth
-               dSbdl_mg_b = mem%dSbdl_mg_b(i) ! Taper of element side B including marine growth with radius scaling by sqrt(Cb)
+               Sa1In      = mem%Sain(i  )     ! outer side A at element nodes including marine growth
+               Sa2In      = mem%Sain(i+1)
+               Sb1In      = mem%Sbin(i  )     ! outer side B at element nodes including marine growth
+               Sb2In      = mem%Sbin(i+1)
+               IF ( mem%floodstatus(i) == 1 ) THEN    ! Fully flooded element
+                  zMid    = 0.5 * (z1   + z2  )
+                  SaMidIn = 0.5 * (Sa1In + Sa2In)
+                  SbMidIn = 0.5 * (Sb1In + Sb2In)
+               ELSE                                   ! Partially flooded element
+                  zMid    = z1 + mem%h_fill * k_hat(3)
+                  l       = mem%h_fill/mem%dl
+                  SaMidIn = Sa1In * (1.0-l) + Sa2In * l
+                  SbMidIn = Sb1In * (1.0-l) + Sb2In * l
+               END IF
             END IF
 
-            ! ------------------ marine growth: Sides: Section 4.1.2 --------------------  
-            ! ----- marine growth weight
-            F_WMG = 0.0_ReKi
-
-            ! lower node
-            F_WMG(3) = - mem%m_mg_l(i)*g ! weight force  : Note: this is a constant
-            F_WMG(4) = - mem%m_mg_l(i)*g * mem%h_cmg_l(i)* sinPhi * sinBeta! weight force
-            F_WMG(5) =   mem%m_mg_l(i)*g * mem%h_cmg_l(i)* sinPhi * cosBeta! weight force
-            m%memberLoads(im)%F_WMG(:,i) = m%memberLoads(im)%F_WMG(:,i) + F_WMG
-            y%Mesh%Force (:,mem%NodeIndx(i)) = y%Mesh%Force (:,mem%NodeIndx(i)) + F_WMG(1:3)
-            y%Mesh%Moment(:,mem%NodeIndx(i)) = y%Mesh%Moment(:,mem%NodeIndx(i)) + F_WMG(4:6)
-            
-            ! upper node
-            F_WMG(3) = - mem%m_mg_u(i)*g ! weight force  : Note: this is a constant 
-            F_WMG(4) = - mem%m_mg_u(i)*g * mem%h_cmg_u(i)* sinPhi * sinBeta! weight force
-            F_WMG(5) =   mem%m_mg_u(i)*g * mem%h_cmg_u(i)* sinPhi * cosBeta! weight force
-            m%memberLoads(im)%F_WMG(:,i+1) = m%memberLoads(im)%F_WMG(:,i+1) + F_WMG  
-            y%Mesh%Force (:,mem%NodeIndx(i+1)) = y%Mesh%Force (:,mem%NodeIndx(i+1)) + F_WMG(1:3)
-            y%Mesh%Moment(:,mem%NodeIndx(i+1)) = y%Mesh%Moment(:,mem%NodeIndx(i+1)) + F_WMG(4:6)
-            
-            ! ----- marine growth inertial load
+            ! ------------------ flooded ballast inertia: sides: Section 6.1.1 : Always compute regardless of PropPot setting ---------------------
             ! lower node
             Imat      = 0.0_ReKi
             IF (mem%MSecGeom == MSecGeom_Cyl) THEN
-               Imat(1,1) = mem%I_rmg_l(i)
-               Imat(2,2) = mem%I_rmg_l(i)
+               Imat(1,1) = mem%I_rfb_l(i)
+               Imat(2,2) = mem%I_rfb_l(i)
             ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
-               Imat(1,1) = mem%I_xmg_l(i)
-               Imat(2,2) = mem%I_ymg_l(i)
+               Imat(1,1) = mem%I_xfb_l(i)
+               Imat(2,2) = mem%I_yfb_l(i)
             END IF
-            Imat(3,3) = mem%I_lmg_l(i)
+            Imat(3,3) = mem%I_lfb_l(i)
             Imat      =  matmul(matmul(CMatrix, Imat), CTrans)
-            iArm = mem%h_cmg_l(i) * k_hat
-            iTerm     = ( -a_s1 - cross_product(omega_s1, cross_product(omega_s1,iArm )) - cross_product(alpha_s1,iArm) ) * mem%m_mg_l(i)
-            F_IMG(1:3) = iTerm
-            F_IMG(4:6) = - matmul(Imat, alpha_s1) - cross_product(iArm,a_s1 * mem%m_mg_l(i)) &
+            iArm = mem%h_cfb_l(i) * k_hat
+            iTerm     = ( -a_s1  - cross_product(omega_s1, cross_product(omega_s1,iArm ))  -  cross_product(alpha_s1,iArm) ) * mem%m_fb_l(i)
+            F_If(1:3) =  iTerm
+            F_If(4:6) =  - matmul(Imat, alpha_s1) - cross_product(iArm,a_s1 * mem%m_fb_l(i)) &
                          - cross_product(omega_s1,matmul(Imat,omega_s1))
-            m%memberLoads(im)%F_IMG(:,i) = m%memberLoads(im)%F_IMG(:,i) + F_IMG
-            y%Mesh%Force (:,mem%NodeIndx(i)) = y%Mesh%Force (:,mem%NodeIndx(i)) + F_IMG(1:3)
-            y%Mesh%Moment(:,mem%NodeIndx(i)) = y%Mesh%Moment(:,mem%NodeIndx(i)) + F_IMG(4:6)
+            memberLoads%F_If(:,i) = memberLoads%F_If(:,i) + F_If
+            memberLoads%F_Nd(1:3,i) = memberLoads%F_Nd(1:3,i) + F_If(1:3)
+            memberLoads%F_Nd(4:6,i) = memberLoads%F_Nd(4:6,i) + F_If(4:6)
 
             ! upper node
             Imat      = 0.0_ReKi
             IF (mem%MSecGeom == MSecGeom_Cyl) THEN
-               Imat(1,1) = mem%I_rmg_u(i)
-               Imat(2,2) = mem%I_rmg_u(i)
+               Imat(1,1) = mem%I_rfb_u(i)
+               Imat(2,2) = mem%I_rfb_u(i)
             ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
-               Imat(1,1) = mem%I_xmg_u(i)
-               Imat(2,2) = mem%I_ymg_u(i)
+               Imat(1,1) = mem%I_xfb_u(i)
+               Imat(2,2) = mem%I_yfb_u(i)
             END IF
-            Imat(3,3) = mem%I_lmg_u(i)
+            Imat(3,3) = mem%I_lfb_u(i)
             Imat      =  matmul(matmul(CMatrix, Imat), CTrans)
-            iArm = mem%h_cmg_u(i) * k_hat
-            iTerm     = ( -a_s2 - cross_product(omega_s2, cross_product(omega_s2,iArm )) - cross_product(alpha_s2,iArm) ) * mem%m_mg_u(i)
-            F_IMG(1:3) = iTerm
-            F_IMG(4:6) = - matmul(Imat, alpha_s2) - cross_product(iArm,a_s2 * mem%m_mg_u(i)) &
-                         - cross_product(omega_s2,matmul(Imat,omega_s2))
-            m%memberLoads(im)%F_IMG(:,i+1) = m%memberLoads(im)%F_IMG(:,i+1) + F_IMG
-            y%Mesh%Force (:,mem%NodeIndx(i+1)) = y%Mesh%Force (:,mem%NodeIndx(i+1)) + F_IMG(1:3)
-            y%Mesh%Moment(:,mem%NodeIndx(i+1)) = y%Mesh%Moment(:,mem%NodeIndx(i+1)) + F_IMG(4:6)
-
-            ! ------------------- buoyancy loads: sides: Sections 3.1 and 3.2 ------------------------
-
-            ! Skip hydrostatic load calculation if flag is false
-            if (.not. calcHstLdsLocal) cycle  
-
-            ! Select hydrostatic load calculation method
-            select case (mem%MHstLMod)
-
-            ! Standard hydrostatic load calculation
-            case (1)
-
-               IF ( p%HstMod > 0_IntKi ) THEN ! If wave stretching is enabled, compute buoyancy up to free surface
-                  CALL GetTotalWaveElev(p, m, Time, pos1, Zeta1, ErrStat2, ErrMsg2 )
-                  CALL GetTotalWaveElev(p, m, Time, pos2, Zeta2, ErrStat2, ErrMsg2 )
-                    CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               ELSE ! Without wave stretching, compute buoyancy based on SWL
-                  Zeta1 = 0.0_ReKi
-                  Zeta2 = 0.0_ReKi
-               END IF
-               Is1stElement = ( i .EQ. 1)
-               CALL getElementHstLds_Mod1(p, m, mem, Time, pos1, pos2, Zeta1, Zeta2, k_hat, r1b, r2b, dl, mem%alpha(i), Is1stElement, F_B0, F_B1, F_B2, ErrStat2, ErrMsg2 )
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               ! Add nodal loads to mesh
-               IF ( .NOT. Is1stElement ) THEN
-                  m%memberLoads(im)%F_B(:, i-1) = m%memberLoads(im)%F_B(:, i-1) + F_B0
-                  y%Mesh%Force (:,mem%NodeIndx(i-1)) = y%Mesh%Force (:,mem%NodeIndx(i-1)) + F_B0(1:3)
-                  y%Mesh%Moment(:,mem%NodeIndx(i-1)) = y%Mesh%Moment(:,mem%NodeIndx(i-1)) + F_B0(4:6)
-               END IF
-               m%memberLoads(im)%F_B(:, i  ) = m%memberLoads(im)%F_B(:, i  ) + F_B1
-               m%memberLoads(im)%F_B(:, i+1) = m%memberLoads(im)%F_B(:, i+1) + F_B2
-               y%Mesh%Force (:,mem%NodeIndx(i  )) = y%Mesh%Force (:,mem%NodeIndx(i  )) + F_B1(1:3)
-               y%Mesh%Moment(:,mem%NodeIndx(i  )) = y%Mesh%Moment(:,mem%NodeIndx(i  )) + F_B1(4:6)
-               y%Mesh%Force (:,mem%NodeIndx(i+1)) = y%Mesh%Force (:,mem%NodeIndx(i+1)) + F_B2(1:3)
-               y%Mesh%Moment(:,mem%NodeIndx(i+1)) = y%Mesh%Moment(:,mem%NodeIndx(i+1)) + F_B2(4:6)
-            
-            ! Alternative hydrostatic load calculation
-            case (2)
-
-               ! Get free surface elevation and normal at the element midpoint (both assumed constant over the element)
-               posMid = 0.5 * (pos1+pos2)
-
-               IF (p%HstMod > 0_IntKi) THEN
-                  CALL GetTotalWaveElev(p, m, Time, posMid, ZetaMid, ErrStat2, ErrMsg2 )
-                    CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-                  CALL GetFreeSurfaceNormal( p, m, Time, posMid, n_hat, ErrStat2, ErrMsg2 )
-                    CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-                  FSPt = (/posMid(1),posMid(2),ZetaMid/) ! Reference point on the free surface
-               ELSE
-                  FSPt = (/posMid(1),posMid(2),0.0_ReKi/)
-                  n_hat = (/0.0,0.0,1.0/)
-               END IF
-
-               IF (mem%MSecGeom == MSecGeom_Cyl) THEN
-                  CALL GetSectionUnitVectors_Cyl( k_hat, y_hat, z_hat )
-                  CALL getElementHstLds_Mod2_Cyl( p, pos1, pos2, FSPt, k_hat, y_hat, z_hat, n_hat, r1b, r2b, dl, F_B1, F_B2, ErrStat2, ErrMsg2)
-               ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
-                  CALL GetSectionUnitVectors_Rec( CMatrix, x_hat, y_hat )
-                  CALL getElementHstLds_Mod2_Rec( p, pos1, pos2, FSPt, k_hat, x_hat, y_hat, n_hat, Sa1b, Sa2b, Sb1b, Sb2b, dl, F_B1, F_B2, ErrStat2, ErrMsg2)
-               END IF
-
-               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-
-               ! Add nodal loads to mesh
-               m%memberLoads(im)%F_B(:,i  ) = m%memberLoads(im)%F_B(:,i  ) + F_B1
-               m%memberLoads(im)%F_B(:,i+1) = m%memberLoads(im)%F_B(:,i+1) + F_B2
-               y%Mesh%Force (:,mem%NodeIndx(i  )) = y%Mesh%Force (:,mem%NodeIndx(i  )) + F_B1(1:3)
-               y%Mesh%Moment(:,mem%NodeIndx(i  )) = y%Mesh%Moment(:,mem%NodeIndx(i  )) + F_B1(4:6)
-               y%Mesh%Force (:,mem%NodeIndx(i+1)) = y%Mesh%Force (:,mem%NodeIndx(i+1)) + F_B2(1:3)
-               y%Mesh%Moment(:,mem%NodeIndx(i+1)) = y%Mesh%Moment(:,mem%NodeIndx(i+1)) + F_B2(4:6)
-
-            end select ! MHstLMod
-         END DO ! i = max(mem%i_floor,1), N    ! loop through member elements that are not fully buried in the seabed
-      END IF ! NOT Modeled with Potential flow theory
-
-      ! --------------------------- flooded ballast: sides: Always compute regardless of PropPot setting ------------------------------
-      ! NOTE: For memfloodstatus and floodstatus: 0 = fully buried or not ballasted, 1 = fully flooded, 2 = partially flooded
-      IF ( mem%memfloodstatus > 0 ) THEN  ! Fully or partially flooded member
-         zFillGroup = m%zFillGroup(mem%MmbrFilledIDIndx)
-         DO i = max(mem%i_floor,1), N    ! loop through member elements that are not completely buried in the seabed
-            IF (mem%floodstatus(i)>0) THEN
-               ! calculate instantaneous incline angle and heading, and related trig values
-               ! the first and last NodeIndx values point to the corresponding Joint nodes indices which are at the start of the Mesh
-               pos1 = m%DispNodePosHst(:,mem%NodeIndx(i  ))
-               pos2 = m%DispNodePosHst(:,mem%NodeIndx(i+1))
-
-               call GetOrientationAngles( pos1, pos2, phi, sinPhi, cosPhi, tanPhi, sinBeta, cosBeta, k_hat, errStat2, errMsg2 ); if (Failed()) return
-               ! Compute element to global DirCos matrix for undisplaced structure first
-               call Morison_DirCosMtrx( u%Mesh%Position(:,mem%NodeIndx(i  )), u%Mesh%Position(:,mem%NodeIndx(i+1)), mem%MSpinOrient, CMatrix )
-               ! Prepend body motion - Assuming the rotation of the starting node is representative of the whole element
-               CMatrix = matmul(transpose(u%Mesh%Orientation(:,:,mem%NodeIndx(i))),CMatrix)
-               CTrans  = transpose(CMatrix)
-               ! Note: CMatrix is element local to global displaced. CTrans is the opposite.
-               ! save some commonly used variables
-               dl        = mem%dl
-               z1        = pos1(3)          ! get displaced node z locations
-               z2        = pos2(3)
-               a_s1      = u%Mesh%TranslationAcc(:, mem%NodeIndx(i  ))
-               alpha_s1  = u%Mesh%RotationAcc   (:, mem%NodeIndx(i  ))
-               omega_s1  = u%Mesh%RotationVel   (:, mem%NodeIndx(i  ))
-               a_s2      = u%Mesh%TranslationAcc(:, mem%NodeIndx(i+1))
-               alpha_s2  = u%Mesh%RotationAcc   (:, mem%NodeIndx(i+1))
-               omega_s2  = u%Mesh%RotationVel   (:, mem%NodeIndx(i+1))
-               IF (mem%MSecGeom == MSecGeom_Cyl) THEN
-                  r1In = mem%Rin(i  )      ! outer radius at element nodes including marine growth
-                  r2In = mem%Rin(i+1)
-                  IF ( mem%floodstatus(i) == 1 ) THEN    ! Fully flooded element
-                     zMid   = 0.5 * (z1   + z2  )
-                     rMidIn = 0.5 * (r1In + r2In)
-                  ELSE                                   ! Partially flooded element
-                     zMid   = z1 + mem%h_fill * k_hat(3)
-                     l      = mem%h_fill/mem%dl
-                     rMidIn = r1In * (1.0-l) + r2In * l
-                  END IF
-               ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
-                  Sa1In      = mem%Sain(i  )     ! outer side A at element nodes including marine growth
-                  Sa2In      = mem%Sain(i+1)
-                  Sb1In      = mem%Sbin(i  )     ! outer side B at element nodes including marine growth
-                  Sb2In      = mem%Sbin(i+1)
-                  IF ( mem%floodstatus(i) == 1 ) THEN    ! Fully flooded element
-                     zMid    = 0.5 * (z1   + z2  )
-                     SaMidIn = 0.5 * (Sa1In + Sa2In)
-                     SbMidIn = 0.5 * (Sb1In + Sb2In)
-                  ELSE                                   ! Partially flooded element
-                     zMid    = z1 + mem%h_fill * k_hat(3)
-                     l       = mem%h_fill/mem%dl
-                     SaMidIn = Sa1In * (1.0-l) + Sa2In * l
-                     SbMidIn = Sb1In * (1.0-l) + Sb2In * l
-                  END IF
-               END IF
-
-               ! ------------------ flooded ballast inertia: sides: Section 6.1.1 : Always compute regardless of PropPot setting ---------------------
-               ! lower node
-               Imat      = 0.0_ReKi
-               IF (mem%MSecGeom == MSecGeom_Cyl) THEN
-                  Imat(1,1) = mem%I_rfb_l(i)
-                  Imat(2,2) = mem%I_rfb_l(i)
-               ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
-                  Imat(1,1) = mem%I_xfb_l(i)
-                  Imat(2,2) = mem%I_yfb_l(i)
-               END IF
-               Imat(3,3) = mem%I_lfb_l(i)
-               Imat      =  matmul(matmul(CMatrix, Imat), CTrans)
-               iArm = mem%h_cfb_l(i) * k_hat
-               iTerm     = ( -a_s1  - cross_product(omega_s1, cross_product(omega_s1,iArm ))  -  cross_product(alpha_s1,iArm) ) * mem%m_fb_l(i)
-               F_If(1:3) =  iTerm
-               F_If(4:6) =  - matmul(Imat, alpha_s1) - cross_product(iArm,a_s1 * mem%m_fb_l(i)) &
-                            - cross_product(omega_s1,matmul(Imat,omega_s1))
-               m%memberLoads(im)%F_If(:,i) = m%memberLoads(im)%F_If(:,i) + F_If
-               y%Mesh%Force (:,mem%NodeIndx(i)) = y%Mesh%Force (:,mem%NodeIndx(i)) + F_If(1:3)
-               y%Mesh%Moment(:,mem%NodeIndx(i)) = y%Mesh%Moment(:,mem%NodeIndx(i)) + F_If(4:6)
-
-               ! upper node
-               Imat      = 0.0_ReKi
-               IF (mem%MSecGeom == MSecGeom_Cyl) THEN
-                  Imat(1,1) = mem%I_rfb_u(i)
-                  Imat(2,2) = mem%I_rfb_u(i)
-               ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
-                  Imat(1,1) = mem%I_xfb_u(i)
-                  Imat(2,2) = mem%I_yfb_u(i)
+            iArm = mem%h_cfb_u(i) * k_hat
+            iTerm     = ( -a_s2  - cross_product(omega_s2, cross_product(omega_s2,iArm ))  -  cross_product(alpha_s2,iArm) ) * mem%m_fb_u(i)
+            F_If(1:3) = iTerm
+            F_If(4:6) = - matmul(Imat, alpha_s2) - cross_product(iArm,a_s2 * mem%m_fb_u(i)) &
+                        - cross_product(omega_s2,matmul(Imat,omega_s2))
+            memberLoads%F_If(:,i+1) = memberLoads%F_If(:,i+1) + F_If
+            memberLoads%F_Nd(1:3,i+1) = memberLoads%F_Nd(1:3,i+1) + F_If(1:3)
+            memberLoads%F_Nd(4:6,i+1) = memberLoads%F_Nd(4:6,i+1) + F_If(4:6)
+
+            ! ------------------ flooded ballast weight : sides : Section 5.1.2 & 5.2.2  : Always compute regardless of PropPot setting ---------------------
+            F_B1 = 0.0
+            F_B2 = 0.0
+            IF (mem%MSecGeom == MSecGeom_Cyl) THEN
+               F_B1(3)   = - p%gravity * mem%m_fb_l(i)
+               F_B1(1:3) = F_B1(1:3) + mem%FillDens * p%gravity * pi * ( rMidIn*rMidIn*(zMid-zFillGroup) - r1In*r1In*(z1-zFillGroup) ) * k_hat
+               F_B1(4:6) = -( p%gravity * mem%m_fb_l(i) * mem%h_cfb_l(i) + mem%FillDens * p%gravity * 0.25*pi*(rMidIn**4-r1In**4) ) * Cross_Product(k_hat,(/0.0,0.0,1.0/))
+               IF ( mem%FloodStatus(i) == 1 ) THEN
+                  F_B2(3)   = - p%gravity * mem%m_fb_u(i)
+                  F_B2(1:3) = F_B2(1:3) + mem%FillDens * p%gravity * pi * ( r2In*r2In*(z2-zFillGroup) - rMidIn*rMidIn*(zMid-zFillGroup) ) * k_hat
+                  F_B2(4:6) = -( p%gravity * mem%m_fb_u(i) * mem%h_cfb_u(i) + mem%FillDens * p%gravity * 0.25*pi*(r2In**4-rMidIn**4) ) * Cross_Product(k_hat,(/0.0,0.0,1.0/))
+               ELSE IF ( i == mem%elem_fill ) THEN ! Need to include end load here
+                  F_B1(1:3) = F_B1(1:3) + mem%FillDens * p%gravity *        pi * rMidIn**2* (zFillGroup - zMid) * k_hat
+                  F_B1(4:6) = F_B1(4:6) + mem%FillDens * p%gravity * 0.25 * pi * rMidIn**4* Cross_Product(k_hat,(/0.0,0.0,1.0/))
                END IF
-               Imat(3,3) = mem%I_lfb_u(i)
-               Imat      =  matmul(matmul(CMatrix, Imat), CTrans)
-               iArm = mem%h_cfb_u(i) * k_hat
-               iTerm     = ( -a_s2  - cross_product(omega_s2, cross_product(omega_s2,iArm ))  -  cross_product(alpha_s2,iArm) ) * mem%m_fb_u(i)
-               F_If(1:3) = iTerm
-               F_If(4:6) = - matmul(Imat, alpha_s2) - cross_product(iArm,a_s2 * mem%m_fb_u(i)) &
-                           - cross_product(omega_s2,matmul(Imat,omega_s2))
-               m%memberLoads(im)%F_If(:,i+1) = m%memberLoads(im)%F_If(:,i+1) + F_If
-               y%Mesh%Force (:,mem%NodeIndx(i+1)) = y%Mesh%Force (:,mem%NodeIndx(i+1)) + F_If(1:3)
-               y%Mesh%Moment(:,mem%NodeIndx(i+1)) = y%Mesh%Moment(:,mem%NodeIndx(i+1)) + F_If(4:6)
-
-               ! ------------------ flooded ballast weight : sides : Section 5.1.2 & 5.2.2  : Always compute regardless of PropPot setting ---------------------
-               F_B1 = 0.0
-               F_B2 = 0.0
-               IF (mem%MSecGeom == MSecGeom_Cyl) THEN
-                  F_B1(3)   = - p%gravity * mem%m_fb_l(i)
-                  F_B1(1:3) = F_B1(1:3) + mem%FillDens * p%gravity * pi * ( rMidIn*rMidIn*(zMid-zFillGroup) - r1In*r1In*(z1-zFillGroup) ) * k_hat
-                  F_B1(4:6) = -( p%gravity * mem%m_fb_l(i) * mem%h_cfb_l(i) + mem%FillDens * p%gravity * 0.25*pi*(rMidIn**4-r1In**4) ) * Cross_Product(k_hat,(/0.0,0.0,1.0/))
-                  IF ( mem%FloodStatus(i) == 1 ) THEN
-                     F_B2(3)   = - p%gravity * mem%m_fb_u(i)
-                     F_B2(1:3) = F_B2(1:3) + mem%FillDens * p%gravity * pi * ( r2In*r2In*(z2-zFillGroup) - rMidIn*rMidIn*(zMid-zFillGroup) ) * k_hat
-                     F_B2(4:6) = -( p%gravity * mem%m_fb_u(i) * mem%h_cfb_u(i) + mem%FillDens * p%gravity * 0.25*pi*(r2In**4-rMidIn**4) ) * Cross_Product(k_hat,(/0.0,0.0,1.0/))
-                  ELSE IF ( i == mem%elem_fill ) THEN ! Need to include end load here
-                     F_B1(1:3) = F_B1(1:3) + mem%FillDens * p%gravity *        pi * rMidIn**2* (zFillGroup - zMid) * k_hat
-                     F_B1(4:6) = F_B1(4:6) + mem%FillDens * p%gravity * 0.25 * pi * rMidIn**4* Cross_Product(k_hat,(/0.0,0.0,1.0/))
-                  END IF
-               ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
-                  CALL GetSectionUnitVectors_Rec( CMatrix, x_hat, y_hat )
-                  F_B1(3)   = - p%gravity * mem%m_fb_l(i)
-                  F_B1(1:3) = F_B1(1:3) + mem%FillDens * p%gravity * ( SaMidIn*SbMidIn*(zMid-zFillGroup) - Sa1In*Sb1In*(z1-zFillGroup) ) * k_hat
-                  F_B1(4:6) = - p%gravity * mem%m_fb_l(i) * mem%h_cfb_l(i) * Cross_Product(k_hat,(/0.0,0.0,1.0/)) &
-                              + mem%FillDens * p%gravity / 12.0 * ( (Sa1In**3*Sb1In*x_hat(3)*y_hat - Sa1In*Sb1In**3*y_hat(3)*x_hat ) - &
-                                                                    (SaMidIn**3*SbMidIn*x_hat(3)*y_hat - SaMidIn*SbMidIn**3*y_hat(3)*x_hat ) )
-                  IF ( mem%FloodStatus(i) == 1 ) THEN
-                     F_B2(3)   = - p%gravity * mem%m_fb_u(i)
-                     F_B2(1:3) = F_B2(1:3) + mem%FillDens * p%gravity * ( Sa2In*Sb2In*(z2-zFillGroup) - SaMidIn*SbMidIn*(zMid-zFillGroup) ) * k_hat
-                     F_B2(4:6) = - p%gravity * mem%m_fb_u(i) * mem%h_cfb_u(i) * Cross_Product(k_hat,(/0.0,0.0,1.0/)) &
-                                 + mem%FillDens * p%gravity / 12.0 * ( (SaMidIn**3*SbMidIn*x_hat(3)*y_hat - SaMidIn*SbMidIn**3*y_hat(3)*x_hat ) - &
-                                                                       (Sa2In**3*Sb2In*x_hat(3)*y_hat - Sa2In*Sb2In**3*y_hat(3)*x_hat ) )
-                  ELSE IF ( i == mem%elem_fill ) THEN ! Need to include end load here
-                     F_B1(1:3) = F_B1(1:3) + mem%FillDens * p%gravity * SaMidIn*SbMidIn*(zFillGroup-zMid) * k_hat
-                     F_B1(4:6) = F_B1(4:6) + mem%FillDens * p%gravity / 12.0 * (SaMidIn**3*SbMidIn*x_hat(3)*y_hat - SaMidIn*SbMidIn**3*y_hat(3)*x_hat)
-                  END IF
+            ELSE IF (mem%MSecGeom == MSecGeom_Rec) THEN
+               CALL GetSectionUnitVectors_Rec( CMatrix, x_hat, y_hat )
+               F_B1(3)   = - p%gravity * mem%m_fb_l(i)
+               F_B1(1:3) = F_B1(1:3) + mem%FillDens * p%gravity * ( SaMidIn*SbMidIn*(zMid-zFillGroup) - Sa1In*Sb1In*(z1-zFillGroup) ) * k_hat
+               F_B1(4:6) = - p%gravity * mem%m_fb_l(i) * mem%h_cfb_l(i) * Cross_Product(k_hat,(/0.0,0.0,1.0/)) &
+                           + mem%FillDens * p%gravity / 12.0 * ( (Sa1In**3*Sb1In*x_hat(3)*y_hat - Sa1In*Sb1In**3*y_hat(3)*x_hat ) - &
+                                                                 (SaMidIn**3*SbMidIn*x_hat(3)*y_hat - SaMidIn*SbMidIn**3*y_hat(3)*x_hat ) )
+               IF ( mem%FloodStatus(i) == 1 ) THEN
+                  F_B2(3)   = - p%gravity * mem%m_fb_u(i)
+                  F_B2(1:3) = F_B2(1:3) + mem%FillDens * p%gravity * ( Sa2In*Sb2In*(z2-zFillGroup) - SaMidIn*SbMidIn*(zMid-zFillGroup) ) * k_hat
+                  F_B2(4:6) = - p%gravity * mem%m_fb_u(i) * mem%h_cfb_u(i) * Cross_Product(k_hat,(/0.0,0.0,1.0/)) &
+                              + mem%FillDens * p%gravity / 12.0 * ( (SaMidIn**3*SbMidIn*x_hat(3)*y_hat - SaMidIn*SbMidIn**3*y_hat(3)*x_hat ) - &
+                                                                    (Sa2In**3*Sb2In*x_hat(3)*y_hat - Sa2In*Sb2In**3*y_hat(3)*x_hat ) )
+               ELSE IF ( i == mem%elem_fill ) THEN ! Need to include end load here
+                  F_B1(1:3) = F_B1(1:3) + mem%FillDens * p%gravity * SaMidIn*SbMidIn*(zFillGroup-zMid) * k_hat
+                  F_B1(4:6) = F_B1(4:6) + mem%FillDens * p%gravity / 12.0 * (SaMidIn**3*SbMidIn*x_hat(3)*y_hat - SaMidIn*SbMidIn**3*y_hat(3)*x_hat)
                END IF
+            END IF
 
-               m%memberLoads(im)%F_BF(:, i  ) = m%memberLoads(im)%F_BF(:, i  ) + F_B1
-               m%memberLoads(im)%F_BF(:, i+1) = m%memberLoads(im)%F_BF(:, i+1) + F_B2
-               y%Mesh%Force (:,mem%NodeIndx(i  )) = y%Mesh%Force (:,mem%NodeIndx(i  )) + F_B1(1:3)
-               y%Mesh%Moment(:,mem%NodeIndx(i  )) = y%Mesh%Moment(:,mem%NodeIndx(i  )) + F_B1(4:6)
-               y%Mesh%Force (:,mem%NodeIndx(i+1)) = y%Mesh%Force (:,mem%NodeIndx(i+1)) + F_B2(1:3)
-               y%Mesh%Moment(:,mem%NodeIndx(i+1)) = y%Mesh%Moment(:,mem%NodeIndx(i+1)) + F_B2(4:6)
-
-            END IF                                     ! mem%floodstatus(i) > 0
-         END DO ! i = max(mem%i_floor,1), N        ! loop through member elements that are not fully buried in the seabed
-      END IF                                    ! Fully or partially flooded member
-
-      !-----------------------------------------------------------------------------------------------------!
-      !                               External Hydrodynamic Side Loads - Start                              !
-      !-----------------------------------------------------------------------------------------------------!
-      IF ( p%WaveField%WaveStMod > 0 .AND. MemSubStat == 1 .AND. (m%NodeInWater(mem%NodeIndx(N+1)).EQ.0_IntKi) ) THEN 
-      !----------------------------Apply load smoothing----------------------------!
-      ! only when:
-      ! 1. wave stretching is enabled
-      ! 2. member centerline crosses the free surface exactly once
-      ! 3. the last node is out of water, which implies the first node is in water
-                
-        FSElem = -1 ! Initialize the No. of the partially wetted element as -1
+            memberLoads%F_BF(:, i  ) = memberLoads%F_BF(:, i  ) + F_B1
+            memberLoads%F_BF(:, i+1) = memberLoads%F_BF(:, i+1) + F_B2
+            memberLoads%F_Nd(1:3,i  ) = memberLoads%F_Nd(1:3,i  ) + F_B1(1:3)
+            memberLoads%F_Nd(4:6,i  ) = memberLoads%F_Nd(4:6,i  ) + F_B1(4:6)
+            memberLoads%F_Nd(1:3,i+1) = memberLoads%F_Nd(1:3,i+1) + F_B2(1:3)
+            memberLoads%F_Nd(4:6,i+1) = memberLoads%F_Nd(4:6,i+1) + F_B2(4:6)
+
+         END IF                                     ! mem%floodstatus(i) > 0
+      END DO ! i = max(mem%i_floor,1), N        ! loop through member elements that are not fully buried in the seabed
+   END IF                                    ! Fully or partially flooded member
+
+   !-----------------------------------------------------------------------------------------------------!
+   !                               External Hydrodynamic Side Loads - Start                              !
+   !-----------------------------------------------------------------------------------------------------!
+   IF ( p%WaveField%WaveStMod > 0 .AND. MemSubStat == 1 .AND. (m%NodeInWater(mem%NodeIndx(N+1)).EQ.0_IntKi) ) THEN 
+   !----------------------------Apply load smoothing----------------------------!
+   ! only when:
+   ! 1. wave stretching is enabled
+   ! 2. member centerline crosses the free surface exactly once
+   ! 3. the last node is out of water, which implies the first node is in water
+             
+     FSElem = -1 ! Initialize the No. of the partially wetted element as -1
+   
+     DO i = mem%i_floor+1,N ! loop through member nodes starting from the first node above seabed, but skip the last node which should not be submerged anyways
+        
+        ! Get positions of node i and i+1
+        pos1 = m%DispNodePosHdn(:,mem%NodeIndx(i  ))
+        pos2 = m%DispNodePosHdn(:,mem%NodeIndx(i+1))
+
+        ! Free surface elevation above or below node i and i+1
+        Zeta1 = m%WaveElev(mem%NodeIndx(i))
+        Zeta2 = m%WaveElev(mem%NodeIndx(i+1))
+
+        ! Compute deltal and h_c
+        IF ( i == 1 ) THEN ! First node
+           deltal = mem%dl/2.0_ReKi
+           h_c    = mem%dl/4.0_ReKi
+        ELSE IF ( i == mem%i_floor + 1 ) THEN ! This node is the upper node of an element which crosses the seabed
+           ! Superceded by i==1 above if mem%i_floor = 0
+           deltal = mem%dl/2.0_ReKi - mem%h_floor
+           h_c    = 0.5_ReKi*(mem%dl/2.0_ReKi + mem%h_floor)
+        ELSE
+           ! This node is an interior node. Note: Element crossing the free surface will be handled at the end in conjunction with wave stretching
+           deltal = mem%dl
+           h_c    = 0.0_ReKi           
+        END IF ! Note: No need to consider i==N+1 because we do not allow the top node to become submerged. The loop also does not reach N+1.
+        
+        IF ( pos1(3) <= Zeta1 .AND. pos2(3) > Zeta2 ) THEN ! element is partially wetted
+          ! Record the number of the partially wetted element
+          FSElem = i
+          ! Calculate submergence ratio
+          SubRatio = ( Zeta1-pos1(3) ) / ( (Zeta1-pos1(3)) - (Zeta2-pos2(3)) )
+          ! Calculate the position of the intersection between the free surface and the element
+          FSInt = SubRatio * (pos2-pos1) + pos1
+        END IF
       
-        DO i = mem%i_floor+1,N ! loop through member nodes starting from the first node above seabed, but skip the last node which should not be submerged anyways
-           
-           ! Get positions of node i and i+1
-           pos1 = m%DispNodePosHdn(:,mem%NodeIndx(i  ))
-           pos2 = m%DispNodePosHdn(:,mem%NodeIndx(i+1))
-
-           ! Free surface elevation above or below node i and i+1
-           Zeta1 = m%WaveElev(mem%NodeIndx(i))
-           Zeta2 = m%WaveElev(mem%NodeIndx(i+1))
-
-           ! Compute deltal and h_c
-           IF ( i == 1 ) THEN ! First node
-              deltal = mem%dl/2.0_ReKi
-              h_c    = mem%dl/4.0_ReKi
-           ELSE IF ( i == mem%i_floor + 1 ) THEN ! This node is the upper node of an element which crosses the seabed
-              ! Superceded by i==1 above if mem%i_floor = 0
-              deltal = mem%dl/2.0_ReKi - mem%h_floor
-              h_c    = 0.5_ReKi*(mem%dl/2.0_ReKi + mem%h_floor)
+        ! Compute the slope of member radius/side length
+        IF (mem%MSecGeom==MSecGeom_Cyl) THEN
+           IF (i == 1) THEN
+              dRdl_p  = abs(mem%dRdl_mg(i))
+              dRdl_pp = mem%dRdl_mg(i)
+           ELSE IF ( i > 1 .AND. i < (N+1)) THEN
+              dRdl_p  = 0.5*( abs(mem%dRdl_mg(i-1)) + abs(mem%dRdl_mg(i)) )
+              dRdl_pp = 0.5*( mem%dRdl_mg(i-1) + mem%dRdl_mg(i) )
            ELSE
-              ! This node is an interior node. Note: Element crossing the free surface will be handled at the end in conjunction with wave stretching
-              deltal = mem%dl
-              h_c    = 0.0_ReKi           
-           END IF ! Note: No need to consider i==N+1 because we do not allow the top node to become submerged. The loop also does not reach N+1.
-           
-           IF ( pos1(3) <= Zeta1 .AND. pos2(3) > Zeta2 ) THEN ! element is partially wetted
-             ! Record the number of the partially wetted element
-             FSElem = i
-             ! Calculate submergence ratio
-             SubRatio = ( Zeta1-pos1(3) ) / ( (Zeta1-pos1(3)) - (Zeta2-pos2(3)) )
-             ! Calculate the position of the intersection between the free surface and the element
-             FSInt = SubRatio * (pos2-pos1) + pos1
+              dRdl_p  = abs(mem%dRdl_mg(N))
+              dRdl_pp = mem%dRdl_mg(N)
            END IF
-         
-           ! Compute the slope of member radius/side length
-           IF (mem%MSecGeom==MSecGeom_Cyl) THEN
-              IF (i == 1) THEN
-                 dRdl_p  = abs(mem%dRdl_mg(i))
-                 dRdl_pp = mem%dRdl_mg(i)
-              ELSE IF ( i > 1 .AND. i < (N+1)) THEN
-                 dRdl_p  = 0.5*( abs(mem%dRdl_mg(i-1)) + abs(mem%dRdl_mg(i)) )
-                 dRdl_pp = 0.5*( mem%dRdl_mg(i-1) + mem%dRdl_mg(i) )
-              ELSE
-                 dRdl_p  = abs(mem%dRdl_mg(N))
-                 dRdl_pp = mem%dRdl_mg(N)
-              END IF
-           ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
-              IF (i == 1) THEN
-                 dSadl_p  = abs(mem%dSadl_mg(i))
-                 dSadl_pp = mem%dSadl_mg(i)
-                 dSbdl_p  = abs(mem%dSbdl_mg(i))
-                 dSbdl_pp = mem%dSbdl_mg(i)
-              ELSE IF ( i > 1 .AND. i < (N+1)) THEN
-                 dSadl_p  = 0.5*( abs(mem%dSadl_mg(i-1)) + abs(mem%dSadl_mg(i)) )
-                 dSadl_pp = 0.5*( mem%dSadl_mg(i-1) + mem%dSadl_mg(i) )
-                 dSbdl_p  = 0.5*( abs(mem%dSbdl_mg(i-1)) + abs(mem%dSbdl_mg(i)) )
-                 dSbdl_pp = 0.5*( mem%dSbdl_mg(i-1) + mem%dSbdl_mg(i) )
-              ELSE
-                 dSadl_p  = abs(mem%dSadl_mg(N))
-                 dSadl_pp = mem%dSadl_mg(N)
-                 dSbdl_p  = abs(mem%dSbdl_mg(N))
-                 dSbdl_pp = mem%dSbdl_mg(N)
-              END IF
+        ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
+           IF (i == 1) THEN
+              dSadl_p  = abs(mem%dSadl_mg(i))
+              dSadl_pp = mem%dSadl_mg(i)
+              dSbdl_p  = abs(mem%dSbdl_mg(i))
+              dSbdl_pp = mem%dSbdl_mg(i)
+           ELSE IF ( i > 1 .AND. i < (N+1)) THEN
+              dSadl_p  = 0.5*( abs(mem%dSadl_mg(i-1)) + abs(mem%dSadl_mg(i)) )
+              dSadl_pp = 0.5*( mem%dSadl_mg(i-1) + mem%dSadl_mg(i) )
+              dSbdl_p  = 0.5*( abs(mem%dSbdl_mg(i-1)) + abs(mem%dSbdl_mg(i)) )
+              dSbdl_pp = 0.5*( mem%dSbdl_mg(i-1) + mem%dSbdl_mg(i) )
+           ELSE
+              dSadl_p  = abs(mem%dSadl_mg(N))
+              dSadl_pp = mem%dSadl_mg(N)
+              dSbdl_p  = abs(mem%dSbdl_mg(N))
+              dSbdl_pp = mem%dSbdl_mg(N)
            END IF
+        END IF
 
-           !-------------------- hydrodynamic drag loads: sides: Section 7.1.2 ------------------------!
-           vec = matmul( mem%Ak,m%vrel(:,mem%NodeIndx(i)) )
+        !-------------------- hydrodynamic drag loads: sides: Section 7.1.2 ------------------------!
+        vec = matmul( mem%Ak,m%vrel(:,mem%NodeIndx(i)) )
+        IF (mem%MSecGeom==MSecGeom_Cyl) THEN
+           f_hydro = mem%Cd(i)*p%WaveField%WtrDens*mem%RMG(i)*TwoNorm(vec)*vec  +  &                                              ! radial part
+                     0.5*mem%AxCd(i)*p%WaveField%WtrDens * pi*mem%RMG(i)*dRdl_p * &                                               ! axial part
+                     abs(dot_product( mem%k, m%vrel(:,mem%NodeIndx(i)) )) * matmul( mem%kkt, m%vrel(:,mem%NodeIndx(i)) )          ! axial part cont'd
+        ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
+           Call GetDistDrag_Rec(p, m, WaveField_m, u, xd, Time,mem,i,dSadl_p,dSbdl_p,f_hydro,ErrStat2,ErrMsg2); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+        END IF
+        CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, memberLoads%F_D(:, i) )
+        memberLoads%F_Nd(1:3,i) = memberLoads%F_Nd(1:3,i) + memberLoads%F_D(1:3, i)
+        memberLoads%F_Nd(4:6,i) = memberLoads%F_Nd(4:6,i) + memberLoads%F_D(4:6, i)
+        IF (i == FSElem) THEN ! Save the distributed load at the first node below the free surface
+          F_D0 = f_hydro
+        END IF
+        
+        IF ( .NOT. mem%PropPot ) THEN
+           !-------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------!
            IF (mem%MSecGeom==MSecGeom_Cyl) THEN
-              f_hydro = mem%Cd(i)*p%WaveField%WtrDens*mem%RMG(i)*TwoNorm(vec)*vec  +  &                                              ! radial part
-                        0.5*mem%AxCd(i)*p%WaveField%WtrDens * pi*mem%RMG(i)*dRdl_p * &                                               ! axial part
-                        abs(dot_product( mem%k, m%vrel(:,mem%NodeIndx(i)) )) * matmul( mem%kkt, m%vrel(:,mem%NodeIndx(i)) )          ! axial part cont'd
+              Am = mem%Ca(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*mem%Ak + 2.0*mem%AxCa(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p*mem%kkt
+              f_hydro = -matmul( Am, u%Mesh%TranslationAcc(:,mem%NodeIndx(i)) )
            ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
-              Call GetDistDrag_Rec(p, m, u, xd, Time,mem,i,dSadl_p,dSbdl_p,f_hydro,ErrStat2,ErrMsg2); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-           END IF
-           CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, m%memberLoads(im)%F_D(:, i) )
-           y%Mesh%Force (:,mem%NodeIndx(i)) = y%Mesh%Force (:,mem%NodeIndx(i)) + m%memberLoads(im)%F_D(1:3, i)
-           y%Mesh%Moment(:,mem%NodeIndx(i)) = y%Mesh%Moment(:,mem%NodeIndx(i)) + m%memberLoads(im)%F_D(4:6, i)
-           IF (i == FSElem) THEN ! Save the distributed load at the first node below the free surface
-             F_D0 = f_hydro
+              f_hydro = -p%WaveField%WtrDens*mem%CaB(i) * 0.25*pi*mem%SbMG(i)*mem%SbMG(i) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%x_hat)*mem%x_hat &
+                        -p%WaveField%WtrDens*mem%CaA(i) * 0.25*pi*mem%SaMG(i)*mem%SaMG(i) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%y_hat)*mem%y_hat &
+                    -0.5*p%WaveField%WtrDens*mem%AxCa(i) * (dSbdl_p*mem%SaMG(i)+dSadl_p*mem%SbMG(i))*SQRT(mem%SaMG(i)*mem%SbMG(i)) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%k)*mem%k
            END IF
-           
-           IF ( .NOT. mem%PropPot ) THEN
-              !-------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------!
-              IF (mem%MSecGeom==MSecGeom_Cyl) THEN
-                 Am = mem%Ca(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*mem%Ak + 2.0*mem%AxCa(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p*mem%kkt
-                 f_hydro = -matmul( Am, u%Mesh%TranslationAcc(:,mem%NodeIndx(i)) )
-              ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
-                 f_hydro = -p%WaveField%WtrDens*mem%CaB(i) * 0.25*pi*mem%SbMG(i)*mem%SbMG(i) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%x_hat)*mem%x_hat &
-                           -p%WaveField%WtrDens*mem%CaA(i) * 0.25*pi*mem%SaMG(i)*mem%SaMG(i) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%y_hat)*mem%y_hat &
-                       -0.5*p%WaveField%WtrDens*mem%AxCa(i) * (dSbdl_p*mem%SaMG(i)+dSadl_p*mem%SbMG(i))*SQRT(mem%SaMG(i)*mem%SbMG(i)) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%k)*mem%k
-              END IF
-              IF ( p%AMMod .EQ. 0_IntKi ) THEN ! Compute added-mass force up to the SWL
-                 z1 = u%Mesh%Position(3, mem%NodeIndx(i)) - p%WaveField%MSL2SWL ! Undisplaced z-position of the current node
-                 IF ( z1 > 0.0_ReKi ) THEN ! Node is above SWL undisplaced; zero added-mass force
-                    f_hydro = 0.0_ReKi
-                    CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, m%memberLoads(im)%F_A(:, i) )
-                 ELSE
-                    ! Need to compute deltal_AM and h_c_AM based on the formulation without wave stretching.
-                    z2 = u%Mesh%Position(3, mem%NodeIndx(i+1)) - p%WaveField%MSL2SWL ! Undisplaced z-position of the next node
-                    IF ( z2 > 0.0_ReKi ) THEN ! Element i crosses the SWL
-                       h = -z1 / mem%cosPhi_ref ! Length of Element i between SWL and node i, h>=0
-                       deltal_AM = mem%dl/2.0 + h
-                       h_c_AM    = 0.5*(h-mem%dl/2.0)
-                    ELSE
-                       deltal_AM = deltal;
-                       h_c_AM    = h_c
-                    END IF
-                    ! Note: Do not overwrite deltal and h_c here. Still need them for the fluid inertia and drag forces.
-                    CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal_AM, h_c_AM, m%memberLoads(im)%F_A(:, i) )
-                 END IF
-              ELSE ! Compute added-mass force up to the instantaneous free surface
-                 f_hydro = f_hydro * m%nodeInWater(mem%NodeIndx(i)) ! Zero the force if node above free surface
-                 CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, m%memberLoads(im)%F_A(:, i) )
-                 IF (i == FSElem) THEN ! Save the distributed load at the first node below the free surface
-                    F_A0 = f_hydro
-                 END IF
-              END IF ! AMMod 0 or 1
-              y%Mesh%Force (:,mem%NodeIndx(i)) = y%Mesh%Force (:,mem%NodeIndx(i)) + m%memberLoads(im)%F_A(1:3, i)
-              y%Mesh%Moment(:,mem%NodeIndx(i)) = y%Mesh%Moment(:,mem%NodeIndx(i)) + m%memberLoads(im)%F_A(4:6, i)
-              
-              !--------------------- hydrodynamic inertia loads: sides: Section 7.1.4 --------------------------!
-              IF (mem%MSecGeom==MSecGeom_Cyl) THEN
-                 IF (mem%PropMCF) THEN
-                    f_hydro=                     p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)       * matmul( mem%Ak,  m%FAMCF(:,mem%NodeIndx(i)) ) + &
-                                 2.0*mem%AxCa(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p * matmul( mem%kkt, m%FA(:,mem%NodeIndx(i)) ) + &
-                                 2.0*m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)*pi*mem%RMG(i)*dRdl_pp*mem%k
+           IF ( p%AMMod .EQ. 0_IntKi ) THEN ! Compute added-mass force up to the SWL
+              z1 = u%Mesh%Position(3, mem%NodeIndx(i)) - p%WaveField%MSL2SWL ! Undisplaced z-position of the current node
+              IF ( z1 > 0.0_ReKi ) THEN ! Node is above SWL undisplaced; zero added-mass force
+                 f_hydro = 0.0_ReKi
+                 CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, memberLoads%F_A(:, i) )
+              ELSE
+                 ! Need to compute deltal_AM and h_c_AM based on the formulation without wave stretching.
+                 z2 = u%Mesh%Position(3, mem%NodeIndx(i+1)) - p%WaveField%MSL2SWL ! Undisplaced z-position of the next node
+                 IF ( z2 > 0.0_ReKi ) THEN ! Element i crosses the SWL
+                    h = -z1 / mem%cosPhi_ref ! Length of Element i between SWL and node i, h>=0
+                    deltal_AM = mem%dl/2.0 + h
+                    h_c_AM    = 0.5*(h-mem%dl/2.0)
                  ELSE
-                    f_hydro=(mem%Ca(i)+mem%Cp(i))*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)        * matmul( mem%Ak,  m%FA(:,mem%NodeIndx(i)) ) + &
-                                 2.0*mem%AxCa(i) *p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p * matmul( mem%kkt, m%FA(:,mem%NodeIndx(i)) ) + &
-                                 2.0*m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)*pi*mem%RMG(i)*dRdl_pp*mem%k
+                    deltal_AM = deltal;
+                    h_c_AM    = h_c
                  END IF
-              ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
-                 ! Note: MacCamy-Fuchs correction cannot be applied to rectangular members
-                 f_hydro= mem%Cp(i)*p%WaveField%WtrDens* mem%SaMG(i)*mem%SbMG(i) * matmul( mem%Ak,  m%FA(:,mem%NodeIndx(i)) ) + &                            ! transver FK component
-                          m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)* (mem%SaMG(i)*dSbdl_pp+dSadl_pp*mem%SbMG(i)) *mem%k + &                                       ! axial FK component
-                          p%WaveField%WtrDens*mem%CaB(i) * 0.25*pi*mem%SbMG(i)*mem%SbMG(i) * Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%x_hat)*mem%x_hat + &    ! x-component of diffraction part
-                          p%WaveField%WtrDens*mem%CaA(i) * 0.25*pi*mem%SaMG(i)*mem%SaMG(i) * Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%y_hat)*mem%y_hat + &    ! y-component of diffraction part
-                      0.5*p%WaveField%WtrDens*mem%AxCa(i) * (dSbdl_p*mem%SaMG(i)+dSadl_p*mem%SbMG(i))*SQRT(mem%SaMG(i)*mem%SbMG(i)) * &                      ! axial component of diffraction part
-                          Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%k)*mem%k                                                                                   ! axial component of diffraction part cont'd
+                 ! Note: Do not overwrite deltal and h_c here. Still need them for the fluid inertia and drag forces.
+                 CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal_AM, h_c_AM, memberLoads%F_A(:, i) )
               END IF
-              CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, m%memberLoads(im)%F_I(:, i) )
-              y%Mesh%Force (:,mem%NodeIndx(i)) = y%Mesh%Force (:,mem%NodeIndx(i)) + m%memberLoads(im)%F_I(1:3, i)
-              y%Mesh%Moment(:,mem%NodeIndx(i)) = y%Mesh%Moment(:,mem%NodeIndx(i)) + m%memberLoads(im)%F_I(4:6, i)
+           ELSE ! Compute added-mass force up to the instantaneous free surface
+              f_hydro = f_hydro * m%nodeInWater(mem%NodeIndx(i)) ! Zero the force if node above free surface
+              CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, memberLoads%F_A(:, i) )
               IF (i == FSElem) THEN ! Save the distributed load at the first node below the free surface
-                 F_I0 = f_hydro
+                 F_A0 = f_hydro
+              END IF
+           END IF ! AMMod 0 or 1
+           memberLoads%F_Nd(1:3,i) = memberLoads%F_Nd(1:3,i) + memberLoads%F_A(1:3, i)
+           memberLoads%F_Nd(4:6,i) = memberLoads%F_Nd(4:6,i) + memberLoads%F_A(4:6, i)
+           
+           !--------------------- hydrodynamic inertia loads: sides: Section 7.1.4 --------------------------!
+           IF (mem%MSecGeom==MSecGeom_Cyl) THEN
+              IF (mem%PropMCF) THEN
+                 f_hydro=                     p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)       * matmul( mem%Ak,  m%FAMCF(:,mem%NodeIndx(i)) ) + &
+                              2.0*mem%AxCa(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p * matmul( mem%kkt, m%FA(:,mem%NodeIndx(i)) ) + &
+                              2.0*m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)*pi*mem%RMG(i)*dRdl_pp*mem%k
+              ELSE
+                 f_hydro=(mem%Ca(i)+mem%Cp(i))*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)        * matmul( mem%Ak,  m%FA(:,mem%NodeIndx(i)) ) + &
+                              2.0*mem%AxCa(i) *p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p * matmul( mem%kkt, m%FA(:,mem%NodeIndx(i)) ) + &
+                              2.0*m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)*pi*mem%RMG(i)*dRdl_pp*mem%k
               END IF
+           ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
+              ! Note: MacCamy-Fuchs correction cannot be applied to rectangular members
+              f_hydro= mem%Cp(i)*p%WaveField%WtrDens* mem%SaMG(i)*mem%SbMG(i) * matmul( mem%Ak,  m%FA(:,mem%NodeIndx(i)) ) + &                            ! transver FK component
+                       m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)* (mem%SaMG(i)*dSbdl_pp+dSadl_pp*mem%SbMG(i)) *mem%k + &                                       ! axial FK component
+                       p%WaveField%WtrDens*mem%CaB(i) * 0.25*pi*mem%SbMG(i)*mem%SbMG(i) * Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%x_hat)*mem%x_hat + &    ! x-component of diffraction part
+                       p%WaveField%WtrDens*mem%CaA(i) * 0.25*pi*mem%SaMG(i)*mem%SaMG(i) * Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%y_hat)*mem%y_hat + &    ! y-component of diffraction part
+                   0.5*p%WaveField%WtrDens*mem%AxCa(i) * (dSbdl_p*mem%SaMG(i)+dSadl_p*mem%SbMG(i))*SQRT(mem%SaMG(i)*mem%SbMG(i)) * &                      ! axial component of diffraction part
+                       Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%k)*mem%k                                                                                   ! axial component of diffraction part cont'd
+           END IF
+           CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, memberLoads%F_I(:, i) )
+           memberLoads%F_Nd(1:3,i) = memberLoads%F_Nd(1:3,i) + memberLoads%F_I(1:3, i)
+           memberLoads%F_Nd(4:6,i) = memberLoads%F_Nd(4:6,i) + memberLoads%F_I(4:6, i)
+           IF (i == FSElem) THEN ! Save the distributed load at the first node below the free surface
+              F_I0 = f_hydro
            END IF
-           
-        END DO ! i =1,N+1    ! loop through member nodes  
-
-        !----------------------------------------------------------------------------------------------------!
-        ! Compute the distributed loads at the point of intersection between the member and the free surface !
-        !----------------------------------------------------------------------------------------------------!   
-        ! Get wave kinematics at the free-surface intersection. Set forceNodeInWater=.TRUE. to guarantee the free-surface intersection is in water.
-        CALL WaveField_GetNodeWaveKin( p%WaveField, m%WaveField_m, Time, FSInt, .TRUE., .TRUE., nodeInWater, WaveElev1, WaveElev2, WaveElev, FDynP, FV, FA, FAMCF, ErrStat2, ErrMsg2 )
-          CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-        FDynPFSInt = REAL(FDynP,ReKi)
-        FVFSInt    = REAL(FV,   ReKi)
-        FAFSInt    = REAL(FA,   ReKi)
-        IF ( mem%PropMCF .AND. ( .NOT. mem%PropPot ) ) THEN
-           FAMCFFSInt = REAL(FAMCF,ReKi)
         END IF
-        ! Structure translational acceleration at the free surface intersection
-        SAFSInt = SubRatio  * u%Mesh%TranslationAcc(:,mem%NodeIndx(FSElem+1)) + &
-             (1.0-SubRatio) * u%Mesh%TranslationAcc(:,mem%NodeIndx(FSElem  ))
-
-        ! Viscous drag:
-        ! Compute relative velocity at the free surface intersection. 
-        ! Linear interpolation between the two nodes of the element is used to estimate velocity of the structure
-        vrelFSInt = FVFSInt - ( & 
-               SubRatio  * u%Mesh%TranslationVel(:,mem%NodeIndx(FSElem+1)) + &
-          (1.0-SubRatio) * u%Mesh%TranslationVel(:,mem%NodeIndx(FSElem  ))   &
-        )
+        
+     END DO ! i =1,N+1    ! loop through member nodes  
+
+     !----------------------------------------------------------------------------------------------------!
+     ! Compute the distributed loads at the point of intersection between the member and the free surface !
+     !----------------------------------------------------------------------------------------------------!   
+     ! Get wave kinematics at the free-surface intersection. Set forceNodeInWater=.TRUE. to guarantee the free-surface intersection is in water.
+     CALL WaveField_GetNodeWaveKin( p%WaveField, WaveField_m, Time, FSInt, .TRUE., .TRUE., nodeInWater, WaveElev1, WaveElev2, WaveElev, FDynP, FV, FA, FAMCF, ErrStat2, ErrMsg2 )
+       CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+     FDynPFSInt = REAL(FDynP,ReKi)
+     FVFSInt    = REAL(FV,   ReKi)
+     FAFSInt    = REAL(FA,   ReKi)
+     IF ( mem%PropMCF .AND. ( .NOT. mem%PropPot ) ) THEN
+        FAMCFFSInt = REAL(FAMCF,ReKi)
+     END IF
+     ! Structure translational acceleration at the free surface intersection
+     SAFSInt = SubRatio  * u%Mesh%TranslationAcc(:,mem%NodeIndx(FSElem+1)) + &
+          (1.0-SubRatio) * u%Mesh%TranslationAcc(:,mem%NodeIndx(FSElem  ))
+
+     ! Viscous drag:
+     ! Compute relative velocity at the free surface intersection. 
+     ! Linear interpolation between the two nodes of the element is used to estimate velocity of the structure
+     vrelFSInt = FVFSInt - ( & 
+            SubRatio  * u%Mesh%TranslationVel(:,mem%NodeIndx(FSElem+1)) + &
+       (1.0-SubRatio) * u%Mesh%TranslationVel(:,mem%NodeIndx(FSElem  ))   &
+     )
+
+     IF (mem%MSecGeom==MSecGeom_Cyl) THEN
+        dRdl_p  = abs(mem%dRdl_mg(FSElem))
+        dRdl_pp =     mem%dRdl_mg(FSElem)
+        RMGFSInt  = SubRatio * mem%RMG( FSElem+1) + (1.0-SubRatio) * mem%RMG( FSElem)
+        CdFSInt   = SubRatio * mem%Cd(  FSElem+1) + (1.0-SubRatio) * mem%Cd(  FSElem)
+        AxCdFSInt = SubRatio * mem%AxCd(FSElem+1) + (1.0-SubRatio) * mem%AxCd(FSElem)
+        CaFSInt   = SubRatio * mem%Ca(  FSElem+1) + (1.0-SubRatio) * mem%Ca(  FSElem)
+        AxCaFSInt = SubRatio * mem%AxCa(FSElem+1) + (1.0-SubRatio) * mem%AxCa(FSElem)
+        CpFSInt   = SubRatio * mem%Cp(  FSElem+1) + (1.0-SubRatio) * mem%Cp(  FSElem)
+        AxCpFSInt = SubRatio * mem%AxCp(FSElem+1) + (1.0-SubRatio) * mem%AxCp(FSElem)
+
+        vec = matmul( mem%Ak,vrelFSInt )
+        F_DS = CdFSInt*p%WaveField%WtrDens*RMGFSInt*TwoNorm(vec)*vec  +  &
+                  0.5*AxCdFSInt*p%WaveField%WtrDens*pi*RMGFSInt*dRdl_p * &
+                  abs(dot_product( mem%k, vrelFSInt )) * matmul( mem%kkt, vrelFSInt )
 
-        IF (mem%MSecGeom==MSecGeom_Cyl) THEN
-           dRdl_p  = abs(mem%dRdl_mg(FSElem))
-           dRdl_pp =     mem%dRdl_mg(FSElem)
-           RMGFSInt  = SubRatio * mem%RMG( FSElem+1) + (1.0-SubRatio) * mem%RMG( FSElem)
-           CdFSInt   = SubRatio * mem%Cd(  FSElem+1) + (1.0-SubRatio) * mem%Cd(  FSElem)
-           AxCdFSInt = SubRatio * mem%AxCd(FSElem+1) + (1.0-SubRatio) * mem%AxCd(FSElem)
-           CaFSInt   = SubRatio * mem%Ca(  FSElem+1) + (1.0-SubRatio) * mem%Ca(  FSElem)
-           AxCaFSInt = SubRatio * mem%AxCa(FSElem+1) + (1.0-SubRatio) * mem%AxCa(FSElem)
-           CpFSInt   = SubRatio * mem%Cp(  FSElem+1) + (1.0-SubRatio) * mem%Cp(  FSElem)
-           AxCpFSInt = SubRatio * mem%AxCp(FSElem+1) + (1.0-SubRatio) * mem%AxCp(FSElem)
-
-           vec = matmul( mem%Ak,vrelFSInt )
-           F_DS = CdFSInt*p%WaveField%WtrDens*RMGFSInt*TwoNorm(vec)*vec  +  &
-                     0.5*AxCdFSInt*p%WaveField%WtrDens*pi*RMGFSInt*dRdl_p * &
-                     abs(dot_product( mem%k, vrelFSInt )) * matmul( mem%kkt, vrelFSInt )
-
-           ! Hydrodynamic added mass and inertia loads
-           IF ( .NOT. mem%PropPot ) THEN
-
-              ! ------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------
-              IF (p%AMMod > 0_IntKi) THEN
-                 Am =      CaFSInt*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt*mem%Ak + &
-                     2.0*AxCaFSInt*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt*dRdl_p*mem%kkt
-                 F_AS = -matmul( Am, SAFSInt )
-              END IF
+        ! Hydrodynamic added mass and inertia loads
+        IF ( .NOT. mem%PropPot ) THEN
 
-              ! ------------------- hydrodynamic inertia loads: sides: Section 7.1.4 ------------------------
-              IF ( mem%PropMCF) THEN
-                 F_IS=                  p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt   * matmul( mem%Ak,  FAMCFFSInt ) + &
-                          2.0*AxCaFSInt*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt*dRdl_p  * matmul( mem%kkt, FAFSInt ) + &
-                          2.0*AxCpFSInt          *pi*RMGFSInt                *dRdl_pp * FDynPFSInt*mem%k
-              ELSE
-                 F_IS=(CaFSInt+CpFSInt)*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt   * matmul( mem%Ak,  FAFSInt ) + &
-                          2.0*AxCaFSInt*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt*dRdl_p  * matmul( mem%kkt, FAFSInt ) + &
-                          2.0*AxCpFSInt          *pi*RMGFSInt                *dRdl_pp * FDynPFSInt*mem%k
-              END IF
+           ! ------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------
+           IF (p%AMMod > 0_IntKi) THEN
+              Am =      CaFSInt*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt*mem%Ak + &
+                  2.0*AxCaFSInt*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt*dRdl_p*mem%kkt
+              F_AS = -matmul( Am, SAFSInt )
            END IF
-        ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
-           dSadl_p  = abs(mem%dSadl_mg(FSElem))
-           dSadl_pp =     mem%dSadl_mg(FSElem)
-           dSbdl_p  = abs(mem%dSbdl_mg(FSElem))
-           dSbdl_pp =     mem%dSbdl_mg(FSElem)
-           SaMGFSInt = SubRatio * mem%SaMG(FSElem+1) + (1.0-SubRatio) * mem%SaMG(FSElem)
-           SbMGFSInt = SubRatio * mem%SbMG(FSElem+1) + (1.0-SubRatio) * mem%SbMG(FSElem)
-           ! CdAFSInt  = SubRatio * mem%CdA( FSElem+1) + (1.0-SubRatio) * mem%CdA( FSElem)
-           ! CdBFSInt  = SubRatio * mem%CdB( FSElem+1) + (1.0-SubRatio) * mem%CdB( FSElem)
-           ! AxCdFSInt = SubRatio * mem%AxCd(FSElem+1) + (1.0-SubRatio) * mem%AxCd(FSElem)
-           CaAFSInt  = SubRatio * mem%CaA( FSElem+1) + (1.0-SubRatio) * mem%CaA( FSElem)
-           CaBFSInt  = SubRatio * mem%CaB( FSElem+1) + (1.0-SubRatio) * mem%CaB( FSElem)
-           AxCaFSInt = SubRatio * mem%AxCa(FSElem+1) + (1.0-SubRatio) * mem%AxCa(FSElem)
-           CpFSInt   = SubRatio * mem%Cp(  FSElem+1) + (1.0-SubRatio) * mem%Cp(  FSElem)
-           AxCpFSInt = SubRatio * mem%AxCp(FSElem+1) + (1.0-SubRatio) * mem%AxCp(FSElem)
-
-           Call GetDistDrag_Rec(p, m, u, xd, Time,mem,FSElem,dSadl_p,dSbdl_p,F_DS,ErrStat2,ErrMsg2,SubRatio,vrelFSInt)
-            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
-           ! Hydrodynamic added mass and inertia loads
-           IF ( .NOT. mem%PropPot ) THEN
+           ! ------------------- hydrodynamic inertia loads: sides: Section 7.1.4 ------------------------
+           IF ( mem%PropMCF) THEN
+              F_IS=                  p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt   * matmul( mem%Ak,  FAMCFFSInt ) + &
+                       2.0*AxCaFSInt*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt*dRdl_p  * matmul( mem%kkt, FAFSInt ) + &
+                       2.0*AxCpFSInt          *pi*RMGFSInt                *dRdl_pp * FDynPFSInt*mem%k
+           ELSE
+              F_IS=(CaFSInt+CpFSInt)*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt   * matmul( mem%Ak,  FAFSInt ) + &
+                       2.0*AxCaFSInt*p%WaveField%WtrDens*pi*RMGFSInt*RMGFSInt*dRdl_p  * matmul( mem%kkt, FAFSInt ) + &
+                       2.0*AxCpFSInt          *pi*RMGFSInt                *dRdl_pp * FDynPFSInt*mem%k
+           END IF
+        END IF
+     ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
+        dSadl_p  = abs(mem%dSadl_mg(FSElem))
+        dSadl_pp =     mem%dSadl_mg(FSElem)
+        dSbdl_p  = abs(mem%dSbdl_mg(FSElem))
+        dSbdl_pp =     mem%dSbdl_mg(FSElem)
+        SaMGFSInt = SubRatio * mem%SaMG(FSElem+1) + (1.0-SubRatio) * mem%SaMG(FSElem)
+        SbMGFSInt = SubRatio * mem%SbMG(FSElem+1) + (1.0-SubRatio) * mem%SbMG(FSElem)
+        ! CdAFSInt  = SubRatio * mem%CdA( FSElem+1) + (1.0-SubRatio) * mem%CdA( FSElem)
+        ! CdBFSInt  = SubRatio * mem%CdB( FSElem+1) + (1.0-SubRatio) * mem%CdB( FSElem)
+        ! AxCdFSInt = SubRatio * mem%AxCd(FSElem+1) + (1.0-SubRatio) * mem%AxCd(FSElem)
+        CaAFSInt  = SubRatio * mem%CaA( FSElem+1) + (1.0-SubRatio) * mem%CaA( FSElem)
+        CaBFSInt  = SubRatio * mem%CaB( FSElem+1) + (1.0-SubRatio) * mem%CaB( FSElem)
+        AxCaFSInt = SubRatio * mem%AxCa(FSElem+1) + (1.0-SubRatio) * mem%AxCa(FSElem)
+        CpFSInt   = SubRatio * mem%Cp(  FSElem+1) + (1.0-SubRatio) * mem%Cp(  FSElem)
+        AxCpFSInt = SubRatio * mem%AxCp(FSElem+1) + (1.0-SubRatio) * mem%AxCp(FSElem)
+
+        Call GetDistDrag_Rec(p, m, WaveField_m, u, xd, Time,mem,FSElem,dSadl_p,dSbdl_p,F_DS,ErrStat2,ErrMsg2,SubRatio,vrelFSInt)
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
-              ! ------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------
-              IF (p%AMMod > 0_IntKi) THEN
-                 F_AS = -p%WaveField%WtrDens*CaBFSInt * 0.25*pi*SbMGFSInt*SbMGFSInt * Dot_Product(SAFSInt,mem%x_hat)*mem%x_hat &
-                        -p%WaveField%WtrDens*CaAFSInt * 0.25*pi*SaMGFSInt*SaMGFSInt * Dot_Product(SAFSInt,mem%y_hat)*mem%y_hat &
-                    -0.5*p%WaveField%WtrDens*AxCaFSInt * (dSbdl_p*SaMGFSInt+dSadl_p*SbMGFSInt)*SQRT(SaMGFSInt*SbMGFSInt) * Dot_Product(SAFSInt,mem%k)*mem%k
-              END IF
-         
-              ! ------------------- hydrodynamic inertia loads: sides: Section 7.1.4 ------------------------
-              F_IS= CpFSInt*p%WaveField%WtrDens* SaMGFSInt*SbMGFSInt * matmul( mem%Ak,  FAFSInt ) + &                            ! transver FK component
-                    FDynPFSInt*AxCpFSInt* (SaMGFSInt*dSbdl_pp+dSadl_pp*SbMGFSInt) *mem%k + &                                     ! axial FK component
-                    p%WaveField%WtrDens*CaBFSInt * 0.25*pi*SbMGFSInt*SbMGFSInt * Dot_Product(FAFSInt,mem%x_hat)*mem%x_hat + &    ! x-component of diffraction part
-                    p%WaveField%WtrDens*CaAFSInt * 0.25*pi*SaMGFSInt*SaMGFSInt * Dot_Product(FAFSInt,mem%y_hat)*mem%y_hat + &    ! y-component of diffraction part
-                0.5*p%WaveField%WtrDens*AxCaFSInt * (dSbdl_p*SaMGFSInt+dSadl_p*SbMGFSInt)*SQRT(SaMGFSInt*SbMGFSInt) * &          ! axial component of diffraction part
-                    Dot_Product(FAFSInt,mem%k)*mem%k                                                                             ! axial component of diffraction part cont'd
+        ! Hydrodynamic added mass and inertia loads
+        IF ( .NOT. mem%PropPot ) THEN
 
+           ! ------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------
+           IF (p%AMMod > 0_IntKi) THEN
+              F_AS = -p%WaveField%WtrDens*CaBFSInt * 0.25*pi*SbMGFSInt*SbMGFSInt * Dot_Product(SAFSInt,mem%x_hat)*mem%x_hat &
+                     -p%WaveField%WtrDens*CaAFSInt * 0.25*pi*SaMGFSInt*SaMGFSInt * Dot_Product(SAFSInt,mem%y_hat)*mem%y_hat &
+                 -0.5*p%WaveField%WtrDens*AxCaFSInt * (dSbdl_p*SaMGFSInt+dSadl_p*SbMGFSInt)*SQRT(SaMGFSInt*SbMGFSInt) * Dot_Product(SAFSInt,mem%k)*mem%k
            END IF
+      
+           ! ------------------- hydrodynamic inertia loads: sides: Section 7.1.4 ------------------------
+           F_IS= CpFSInt*p%WaveField%WtrDens* SaMGFSInt*SbMGFSInt * matmul( mem%Ak,  FAFSInt ) + &                            ! transver FK component
+                 FDynPFSInt*AxCpFSInt* (SaMGFSInt*dSbdl_pp+dSadl_pp*SbMGFSInt) *mem%k + &                                     ! axial FK component
+                 p%WaveField%WtrDens*CaBFSInt * 0.25*pi*SbMGFSInt*SbMGFSInt * Dot_Product(FAFSInt,mem%x_hat)*mem%x_hat + &    ! x-component of diffraction part
+                 p%WaveField%WtrDens*CaAFSInt * 0.25*pi*SaMGFSInt*SaMGFSInt * Dot_Product(FAFSInt,mem%y_hat)*mem%y_hat + &    ! y-component of diffraction part
+             0.5*p%WaveField%WtrDens*AxCaFSInt * (dSbdl_p*SaMGFSInt+dSadl_p*SbMGFSInt)*SQRT(SaMGFSInt*SbMGFSInt) * &          ! axial component of diffraction part
+                 Dot_Product(FAFSInt,mem%k)*mem%k                                                                             ! axial component of diffraction part cont'd
+
         END IF
-        !----------------------------------------------------------------------------------------------------!
-        !                         Perform the load redistribution for smooth time series                     !
-        !----------------------------------------------------------------------------------------------------!
-        ! Evaluate the load redistribution function
-        f_redist = 0.0_ReKi
-        IF (FSElem > 1_IntKi) THEN ! At least one fully submerged element
-           f_redist = 2.0_ReKi * SubRatio**3 - 3.5_ReKi * SubRatio**2 + SubRatio + 0.5_ReKi
-        END IF
-        
-        ! deltal = mem%dl and h_c = 0 should always be used here by design. Moment correction will be applied separately
-        deltal = mem%dl
-        h_c    = 0.0_ReKi
-        
-        ! Viscous drag
-        ! Apply load redistribution to the first node below the free surface
-        Df_hydro = ((SubRatio-1.0_ReKi)/(2.0_ReKi)-f_redist)*F_D0 + SubRatio/2.0_ReKi*F_DS
+     END IF
+     !----------------------------------------------------------------------------------------------------!
+     !                         Perform the load redistribution for smooth time series                     !
+     !----------------------------------------------------------------------------------------------------!
+     ! Evaluate the load redistribution function
+     f_redist = 0.0_ReKi
+     IF (FSElem > 1_IntKi) THEN ! At least one fully submerged element
+        f_redist = 2.0_ReKi * SubRatio**3 - 3.5_ReKi * SubRatio**2 + SubRatio + 0.5_ReKi
+     END IF
+     
+     ! deltal = mem%dl and h_c = 0 should always be used here by design. Moment correction will be applied separately
+     deltal = mem%dl
+     h_c    = 0.0_ReKi
+     
+     ! Viscous drag
+     ! Apply load redistribution to the first node below the free surface
+     Df_hydro = ((SubRatio-1.0_ReKi)/(2.0_ReKi)-f_redist)*F_D0 + SubRatio/2.0_ReKi*F_DS
+     CALL LumpDistrHydroLoads( Df_hydro, mem%k, deltal, h_c, Df_hydro_lumped)
+     memberLoads%F_D(:, FSElem) = memberLoads%F_D(:, FSElem) + Df_hydro_lumped
+     memberLoads%F_Nd(1:3,FSElem) = memberLoads%F_Nd(1:3,FSElem) + Df_hydro_lumped(1:3)
+     memberLoads%F_Nd(4:6,FSElem) = memberLoads%F_Nd(4:6,FSElem) + Df_hydro_lumped(4:6)
+     
+     ! Apply load redistribution to the second node below the free surface
+     IF (FSElem > 1_IntKi) THEN ! Note: Only need to modify the loads on the second node below the free surface when there is at least one fully submerged element.
+        Df_hydro = f_redist * F_D0
         CALL LumpDistrHydroLoads( Df_hydro, mem%k, deltal, h_c, Df_hydro_lumped)
-        m%memberLoads(im)%F_D(:, FSElem) = m%memberLoads(im)%F_D(:, FSElem) + Df_hydro_lumped
-        y%Mesh%Force (:,mem%NodeIndx(FSElem)) = y%Mesh%Force (:,mem%NodeIndx(FSElem)) + Df_hydro_lumped(1:3)
-        y%Mesh%Moment(:,mem%NodeIndx(FSElem)) = y%Mesh%Moment(:,mem%NodeIndx(FSElem)) + Df_hydro_lumped(4:6)
-        
-        ! Apply load redistribution to the second node below the free surface
-        IF (FSElem > 1_IntKi) THEN ! Note: Only need to modify the loads on the second node below the free surface when there is at least one fully submerged element.
-           Df_hydro = f_redist * F_D0
-           CALL LumpDistrHydroLoads( Df_hydro, mem%k, deltal, h_c, Df_hydro_lumped)
-           m%memberLoads(im)%F_D(:, FSElem-1) = m%memberLoads(im)%F_D(:, FSElem-1) + Df_hydro_lumped
-           y%Mesh%Force (:,mem%NodeIndx(FSElem-1)) = y%Mesh%Force (:,mem%NodeIndx(FSElem-1)) + Df_hydro_lumped(1:3)
-           y%Mesh%Moment(:,mem%NodeIndx(FSElem-1)) = y%Mesh%Moment(:,mem%NodeIndx(FSElem-1)) + Df_hydro_lumped(4:6)
-        END IF
+        memberLoads%F_D(:, FSElem-1) = memberLoads%F_D(:, FSElem-1) + Df_hydro_lumped
+        memberLoads%F_Nd(1:3,FSElem-1) = memberLoads%F_Nd(1:3,FSElem-1) + Df_hydro_lumped(1:3)
+        memberLoads%F_Nd(4:6,FSElem-1) = memberLoads%F_Nd(4:6,FSElem-1) + Df_hydro_lumped(4:6)
+     END IF
 
-        ! Hydrodynamic added mass and inertia loads
-        IF ( .NOT. mem%PropPot ) THEN
-           
-           IF ( p%AMMod > 0_IntKi ) THEN
-              !-------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------!
-              ! Apply load redistribution to the first node below the free surface
-              Df_hydro = ((SubRatio-1.0_ReKi)/(2.0_ReKi)-f_redist)*F_A0 + SubRatio/2.0_ReKi*F_AS
-              CALL LumpDistrHydroLoads( Df_hydro, mem%k, deltal, h_c, Df_hydro_lumped)
-              m%memberLoads(im)%F_A(:, FSElem) = m%memberLoads(im)%F_A(:, FSElem) + Df_hydro_lumped
-              y%Mesh%Force (:,mem%NodeIndx(FSElem)) = y%Mesh%Force (:,mem%NodeIndx(FSElem)) + Df_hydro_lumped(1:3)
-              y%Mesh%Moment(:,mem%NodeIndx(FSElem)) = y%Mesh%Moment(:,mem%NodeIndx(FSElem)) + Df_hydro_lumped(4:6)
+     ! Hydrodynamic added mass and inertia loads
+     IF ( .NOT. mem%PropPot ) THEN
         
-              ! Apply load redistribution to the second node below the free surface
-              IF (FSElem > 1_IntKi) THEN
-                  Df_hydro = f_redist * F_A0
-                  CALL LumpDistrHydroLoads( Df_hydro, mem%k, deltal, h_c, Df_hydro_lumped)
-                  m%memberLoads(im)%F_A(:, FSElem-1) = m%memberLoads(im)%F_A(:, FSElem-1) + Df_hydro_lumped
-                  y%Mesh%Force (:,mem%NodeIndx(FSElem-1)) = y%Mesh%Force (:,mem%NodeIndx(FSElem-1)) + Df_hydro_lumped(1:3)
-                  y%Mesh%Moment(:,mem%NodeIndx(FSElem-1)) = y%Mesh%Moment(:,mem%NodeIndx(FSElem-1)) + Df_hydro_lumped(4:6)
-              END IF
-           END IF
-           
-           !-------------------- hydrodynamic inertia loads: sides: Section 7.1.4 --------------------------!
+        IF ( p%AMMod > 0_IntKi ) THEN
+           !-------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------!
            ! Apply load redistribution to the first node below the free surface
-           Df_hydro = ((SubRatio-1.0_ReKi)/(2.0_ReKi)-f_redist)*F_I0 + SubRatio/2.0_ReKi*F_IS
+           Df_hydro = ((SubRatio-1.0_ReKi)/(2.0_ReKi)-f_redist)*F_A0 + SubRatio/2.0_ReKi*F_AS
            CALL LumpDistrHydroLoads( Df_hydro, mem%k, deltal, h_c, Df_hydro_lumped)
-           m%memberLoads(im)%F_I(:, FSElem) = m%memberLoads(im)%F_I(:, FSElem) + Df_hydro_lumped
-           y%Mesh%Force (:,mem%NodeIndx(FSElem)) = y%Mesh%Force (:,mem%NodeIndx(FSElem)) + Df_hydro_lumped(1:3)
-           y%Mesh%Moment(:,mem%NodeIndx(FSElem)) = y%Mesh%Moment(:,mem%NodeIndx(FSElem)) + Df_hydro_lumped(4:6)
-        
+           memberLoads%F_A(:, FSElem) = memberLoads%F_A(:, FSElem) + Df_hydro_lumped
+           memberLoads%F_Nd(1:3,FSElem) = memberLoads%F_Nd(1:3,FSElem) + Df_hydro_lumped(1:3)
+           memberLoads%F_Nd(4:6,FSElem) = memberLoads%F_Nd(4:6,FSElem) + Df_hydro_lumped(4:6)
+     
            ! Apply load redistribution to the second node below the free surface
            IF (FSElem > 1_IntKi) THEN
-               Df_hydro = f_redist * F_I0
+               Df_hydro = f_redist * F_A0
                CALL LumpDistrHydroLoads( Df_hydro, mem%k, deltal, h_c, Df_hydro_lumped)
-               m%memberLoads(im)%F_I(:, FSElem-1) = m%memberLoads(im)%F_I(:, FSElem-1) + Df_hydro_lumped
-               y%Mesh%Force (:,mem%NodeIndx(FSElem-1)) = y%Mesh%Force (:,mem%NodeIndx(FSElem-1)) + Df_hydro_lumped(1:3)
-               y%Mesh%Moment(:,mem%NodeIndx(FSElem-1)) = y%Mesh%Moment(:,mem%NodeIndx(FSElem-1)) + Df_hydro_lumped(4:6)
-           END IF
-        END IF
-
-        !----------------------------------------------------------------------------------------------------!
-        !                     Perform moment correction to compensate for load redistribution                !
-        !----------------------------------------------------------------------------------------------------!
-        ! Moment correction to the first and second nodes below the free surface
-        F_S = F_DS
-        F_0 = F_D0
-        IF ( .NOT. mem%PropPot) THEN
-           F_S = F_S + F_IS
-           F_0 = F_0 + F_I0
-           IF ( p%AMMod > 0_IntKi) THEN
-              F_S = F_S + F_AS
-              F_0 = F_0 + F_A0
+               memberLoads%F_A(:, FSElem-1) = memberLoads%F_A(:, FSElem-1) + Df_hydro_lumped
+               memberLoads%F_Nd(1:3,FSElem-1) = memberLoads%F_Nd(1:3,FSElem-1) + Df_hydro_lumped(1:3)
+               memberLoads%F_Nd(4:6,FSElem-1) = memberLoads%F_Nd(4:6,FSElem-1) + Df_hydro_lumped(4:6)
            END IF
         END IF
-        ! First node below the free surface
-        DM_hydro = 0.5_ReKi * SubRatio**2 * deltal * cross_product(mem%k, F_S)
-        y%Mesh%Moment(:,mem%NodeIndx(FSElem))   = y%Mesh%Moment(:,mem%NodeIndx(FSElem))   + DM_hydro * deltal
-        ! Second node below the free surface
+        
+        !-------------------- hydrodynamic inertia loads: sides: Section 7.1.4 --------------------------!
+        ! Apply load redistribution to the first node below the free surface
+        Df_hydro = ((SubRatio-1.0_ReKi)/(2.0_ReKi)-f_redist)*F_I0 + SubRatio/2.0_ReKi*F_IS
+        CALL LumpDistrHydroLoads( Df_hydro, mem%k, deltal, h_c, Df_hydro_lumped)
+        memberLoads%F_I(:, FSElem) = memberLoads%F_I(:, FSElem) + Df_hydro_lumped
+        memberLoads%F_Nd(1:3,FSElem) = memberLoads%F_Nd(1:3,FSElem) + Df_hydro_lumped(1:3)
+        memberLoads%F_Nd(4:6,FSElem) = memberLoads%F_Nd(4:6,FSElem) + Df_hydro_lumped(4:6)
+     
+        ! Apply load redistribution to the second node below the free surface
         IF (FSElem > 1_IntKi) THEN
-            DM_hydro =               f_redist * deltal * cross_product(mem%k, F_0)
-            y%Mesh%Moment(:,mem%NodeIndx(FSElem-1)) = y%Mesh%Moment(:,mem%NodeIndx(FSElem-1)) + DM_hydro * deltal
+            Df_hydro = f_redist * F_I0
+            CALL LumpDistrHydroLoads( Df_hydro, mem%k, deltal, h_c, Df_hydro_lumped)
+            memberLoads%F_I(:, FSElem-1) = memberLoads%F_I(:, FSElem-1) + Df_hydro_lumped
+            memberLoads%F_Nd(1:3,FSElem-1) = memberLoads%F_Nd(1:3,FSElem-1) + Df_hydro_lumped(1:3)
+            memberLoads%F_Nd(4:6,FSElem-1) = memberLoads%F_Nd(4:6,FSElem-1) + Df_hydro_lumped(4:6)
         END IF
-
-      ELSE IF ( MemSubStat .NE. 3_IntKi) THEN ! Skip members with centerline completely out of water
-        !----------------------------No load smoothing----------------------------!
-        DO i = mem%i_floor+1,N+1    ! loop through member nodes starting from the first node above seabed
-           z1   = m%DispNodePosHdn(3, mem%NodeIndx(i))
-           pos1 = m%DispNodePosHdn(:, mem%NodeIndx(i))
-           !---------------------------------------------Compute deltal and h_c------------------------------------------!
-           ! Cannot make any assumption about WaveStMod and member orientation 
-           IF ( m%NodeInWater(mem%NodeIndx(i)) .EQ. 0_IntKi ) THEN ! Node is out of water
-              deltal = 0.0_ReKi
-              h_c    = 0.0_ReKi
-           ELSE ! Node in water
-              ! Look to the "left" toward node 1
-              IF ( i == 1 ) THEN ! First node. Note: Having i == 1 also implies mem%i_floor = 0.
-                 deltalLeft = 0.0_ReKi
-              ELSE IF ( i == mem%i_floor+1 ) THEN ! First node above seabed.
-                 ! Note: This part is superceded by i==1 above when mem%i_floor = 0.
-                 !       This is the correct behavior.
-                 deltalLeft = -mem%h_floor
-              ELSE ! Regular internal node
-                 IF ( m%NodeInWater(mem%NodeIndx(i-1)) .EQ. 1_IntKi ) THEN ! Node to the left is submerged
-                    deltalLeft = 0.5_ReKi * mem%dl
-                 ELSE ! Element i-1 crosses the free surface
-                    z2 = m%DispNodePosHdn(3, mem%NodeIndx(i-1))
-                    IF ( p%WaveField%WaveStMod > 0_IntKi ) THEN ! Wave stretching enabled
-                       zeta1 = m%WaveElev(mem%NodeIndx(i  ))
-                       zeta2 = m%WaveElev(mem%NodeIndx(i-1))
-                    ELSE
-                       zeta1 = 0.0_ReKi
-                       zeta2 = 0.0_ReKi
-                    END IF
-                    SubRatio = (zeta1-z1)/((zeta1-z1)-(zeta2-z2))
-                    deltalLeft = SubRatio * mem%dl ! Portion of element i-1 in water
+     END IF
+
+     !----------------------------------------------------------------------------------------------------!
+     !                     Perform moment correction to compensate for load redistribution                !
+     !----------------------------------------------------------------------------------------------------!
+     ! Moment correction to the first and second nodes below the free surface
+     F_S = F_DS
+     F_0 = F_D0
+     IF ( .NOT. mem%PropPot) THEN
+        F_S = F_S + F_IS
+        F_0 = F_0 + F_I0
+        IF ( p%AMMod > 0_IntKi) THEN
+           F_S = F_S + F_AS
+           F_0 = F_0 + F_A0
+        END IF
+     END IF
+     ! First node below the free surface
+     DM_hydro = 0.5_ReKi * SubRatio**2 * deltal * cross_product(mem%k, F_S)
+     memberLoads%F_Nd(4:6,FSElem)   = memberLoads%F_Nd(4:6,FSElem)   + DM_hydro * deltal
+     ! Second node below the free surface
+     IF (FSElem > 1_IntKi) THEN
+         DM_hydro =               f_redist * deltal * cross_product(mem%k, F_0)
+         memberLoads%F_Nd(4:6,FSElem-1) = memberLoads%F_Nd(4:6,FSElem-1) + DM_hydro * deltal
+     END IF
+
+   ELSE IF ( MemSubStat .NE. 3_IntKi) THEN ! Skip members with centerline completely out of water
+     !----------------------------No load smoothing----------------------------!
+     DO i = mem%i_floor+1,N+1    ! loop through member nodes starting from the first node above seabed
+        z1   = m%DispNodePosHdn(3, mem%NodeIndx(i))
+        pos1 = m%DispNodePosHdn(:, mem%NodeIndx(i))
+        !---------------------------------------------Compute deltal and h_c------------------------------------------!
+        ! Cannot make any assumption about WaveStMod and member orientation 
+        IF ( m%NodeInWater(mem%NodeIndx(i)) .EQ. 0_IntKi ) THEN ! Node is out of water
+           deltal = 0.0_ReKi
+           h_c    = 0.0_ReKi
+        ELSE ! Node in water
+           ! Look to the "left" toward node 1
+           IF ( i == 1 ) THEN ! First node. Note: Having i == 1 also implies mem%i_floor = 0.
+              deltalLeft = 0.0_ReKi
+           ELSE IF ( i == mem%i_floor+1 ) THEN ! First node above seabed.
+              ! Note: This part is superceded by i==1 above when mem%i_floor = 0.
+              !       This is the correct behavior.
+              deltalLeft = -mem%h_floor
+           ELSE ! Regular internal node
+              IF ( m%NodeInWater(mem%NodeIndx(i-1)) .EQ. 1_IntKi ) THEN ! Node to the left is submerged
+                 deltalLeft = 0.5_ReKi * mem%dl
+              ELSE ! Element i-1 crosses the free surface
+                 z2 = m%DispNodePosHdn(3, mem%NodeIndx(i-1))
+                 IF ( p%WaveField%WaveStMod > 0_IntKi ) THEN ! Wave stretching enabled
+                    zeta1 = m%WaveElev(mem%NodeIndx(i  ))
+                    zeta2 = m%WaveElev(mem%NodeIndx(i-1))
+                 ELSE
+                    zeta1 = 0.0_ReKi
+                    zeta2 = 0.0_ReKi
                  END IF
+                 SubRatio = (zeta1-z1)/((zeta1-z1)-(zeta2-z2))
+                 deltalLeft = SubRatio * mem%dl ! Portion of element i-1 in water
               END IF
-              ! Look to the "right" toward node N+1
-              IF ( i == N+1 ) THEN ! Last node
-                 deltalRight = 0.0_ReKi
-              ELSE ! Regular internal node
-                 IF ( m%NodeInWater(mem%NodeIndx(i+1)) .EQ. 1_IntKi ) THEN ! Node to the right is submerged
-                    deltalRight = 0.5_ReKi * mem%dl
-                 ELSE ! Element i crosses the free surface
-                    z2 = m%DispNodePosHdn(3, mem%NodeIndx(i+1))
-                    IF ( p%WaveField%WaveStMod > 0_IntKi ) THEN ! Wave stretching enabled
-                       zeta1 = m%WaveElev(mem%NodeIndx(i  ))
-                       zeta2 = m%WaveElev(mem%NodeIndx(i+1))
-                    ELSE
-                       zeta1 = 0.0_ReKi
-                       zeta2 = 0.0_ReKi
-                    END IF
-                    SubRatio = (zeta1-z1)/((zeta1-z1)-(zeta2-z2))
-                    deltalRight = SubRatio * mem%dl ! Portion of element i in water
+           END IF
+           ! Look to the "right" toward node N+1
+           IF ( i == N+1 ) THEN ! Last node
+              deltalRight = 0.0_ReKi
+           ELSE ! Regular internal node
+              IF ( m%NodeInWater(mem%NodeIndx(i+1)) .EQ. 1_IntKi ) THEN ! Node to the right is submerged
+                 deltalRight = 0.5_ReKi * mem%dl
+              ELSE ! Element i crosses the free surface
+                 z2 = m%DispNodePosHdn(3, mem%NodeIndx(i+1))
+                 IF ( p%WaveField%WaveStMod > 0_IntKi ) THEN ! Wave stretching enabled
+                    zeta1 = m%WaveElev(mem%NodeIndx(i  ))
+                    zeta2 = m%WaveElev(mem%NodeIndx(i+1))
+                 ELSE
+                    zeta1 = 0.0_ReKi
+                    zeta2 = 0.0_ReKi
                  END IF
+                 SubRatio = (zeta1-z1)/((zeta1-z1)-(zeta2-z2))
+                 deltalRight = SubRatio * mem%dl ! Portion of element i in water
               END IF
-              ! Combine left and right contributions
-              deltal =              deltalRight + deltalLeft
-              h_c    = 0.5_ReKi * ( deltalRight - deltalLeft )
            END IF
+           ! Combine left and right contributions
+           deltal =              deltalRight + deltalLeft
+           h_c    = 0.5_ReKi * ( deltalRight - deltalLeft )
+        END IF
 
-           ! Compute the slope of member radius/side length
-           IF (mem%MSecGeom==MSecGeom_Cyl) THEN
-              IF (i == 1) THEN
-                 dRdl_p  = abs(mem%dRdl_mg(i))
-                 dRdl_pp = mem%dRdl_mg(i)
-              ELSE IF ( i > 1 .AND. i < (N+1)) THEN
-                 dRdl_p  = 0.5*( abs(mem%dRdl_mg(i-1)) + abs(mem%dRdl_mg(i)) )
-                 dRdl_pp = 0.5*( mem%dRdl_mg(i-1) + mem%dRdl_mg(i) )
-              ELSE
-                 dRdl_p  = abs(mem%dRdl_mg(N))
-                 dRdl_pp = mem%dRdl_mg(N)
-              END IF
-           ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
-              IF (i == 1) THEN
-                 dSadl_p  = abs(mem%dSadl_mg(i))
-                 dSadl_pp = mem%dSadl_mg(i)
-                 dSbdl_p  = abs(mem%dSbdl_mg(i))
-                 dSbdl_pp = mem%dSbdl_mg(i)
-              ELSE IF ( i > 1 .AND. i < (N+1)) THEN
-                 dSadl_p  = 0.5*( abs(mem%dSadl_mg(i-1)) + abs(mem%dSadl_mg(i)) )
-                 dSadl_pp = 0.5*( mem%dSadl_mg(i-1) + mem%dSadl_mg(i) )
-                 dSbdl_p  = 0.5*( abs(mem%dSbdl_mg(i-1)) + abs(mem%dSbdl_mg(i)) )
-                 dSbdl_pp = 0.5*( mem%dSbdl_mg(i-1) + mem%dSbdl_mg(i) )
-              ELSE
-                 dSadl_p  = abs(mem%dSadl_mg(N))
-                 dSadl_pp = mem%dSadl_mg(N)
-                 dSbdl_p  = abs(mem%dSbdl_mg(N))
-                 dSbdl_pp = mem%dSbdl_mg(N)
-              END IF
+        ! Compute the slope of member radius/side length
+        IF (mem%MSecGeom==MSecGeom_Cyl) THEN
+           IF (i == 1) THEN
+              dRdl_p  = abs(mem%dRdl_mg(i))
+              dRdl_pp = mem%dRdl_mg(i)
+           ELSE IF ( i > 1 .AND. i < (N+1)) THEN
+              dRdl_p  = 0.5*( abs(mem%dRdl_mg(i-1)) + abs(mem%dRdl_mg(i)) )
+              dRdl_pp = 0.5*( mem%dRdl_mg(i-1) + mem%dRdl_mg(i) )
+           ELSE
+              dRdl_p  = abs(mem%dRdl_mg(N))
+              dRdl_pp = mem%dRdl_mg(N)
+           END IF
+        ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
+           IF (i == 1) THEN
+              dSadl_p  = abs(mem%dSadl_mg(i))
+              dSadl_pp = mem%dSadl_mg(i)
+              dSbdl_p  = abs(mem%dSbdl_mg(i))
+              dSbdl_pp = mem%dSbdl_mg(i)
+           ELSE IF ( i > 1 .AND. i < (N+1)) THEN
+              dSadl_p  = 0.5*( abs(mem%dSadl_mg(i-1)) + abs(mem%dSadl_mg(i)) )
+              dSadl_pp = 0.5*( mem%dSadl_mg(i-1) + mem%dSadl_mg(i) )
+              dSbdl_p  = 0.5*( abs(mem%dSbdl_mg(i-1)) + abs(mem%dSbdl_mg(i)) )
+              dSbdl_pp = 0.5*( mem%dSbdl_mg(i-1) + mem%dSbdl_mg(i) )
+           ELSE
+              dSadl_p  = abs(mem%dSadl_mg(N))
+              dSadl_pp = mem%dSadl_mg(N)
+              dSbdl_p  = abs(mem%dSbdl_mg(N))
+              dSbdl_pp = mem%dSbdl_mg(N)
            END IF
+        END IF
+      
+        !--------------------- hydrodynamic drag loads: sides: Section 7.1.2 --------------------------------! 
+        vec = matmul( mem%Ak,m%vrel(:,mem%NodeIndx(i)) )
+        IF (mem%MSecGeom==MSecGeom_Cyl) THEN
+           f_hydro = mem%Cd(i)*p%WaveField%WtrDens*mem%RMG(i)*TwoNorm(vec)*vec  +  &                                              ! radial part
+                     0.5*mem%AxCd(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*dRdl_p * &                                                 ! axial part
+                     abs(dot_product( mem%k, m%vrel(:,mem%NodeIndx(i)) )) * matmul( mem%kkt, m%vrel(:,mem%NodeIndx(i)) )          ! axial part cont'd
+        ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
+           Call GetDistDrag_Rec(p, m, WaveField_m, u, xd, Time,mem,i,dSadl_p,dSbdl_p,f_hydro,ErrStat2,ErrMsg2)
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+        END IF
+        CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, memberLoads%F_D(:, i) )
+        memberLoads%F_Nd(1:3,i) = memberLoads%F_Nd(1:3,i) + memberLoads%F_D(1:3, i)
+        memberLoads%F_Nd(4:6,i) = memberLoads%F_Nd(4:6,i) + memberLoads%F_D(4:6, i)
          
-           !--------------------- hydrodynamic drag loads: sides: Section 7.1.2 --------------------------------! 
-           vec = matmul( mem%Ak,m%vrel(:,mem%NodeIndx(i)) )
+        IF ( .NOT. mem%PropPot ) THEN
+           !-------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------!
            IF (mem%MSecGeom==MSecGeom_Cyl) THEN
-              f_hydro = mem%Cd(i)*p%WaveField%WtrDens*mem%RMG(i)*TwoNorm(vec)*vec  +  &                                              ! radial part
-                        0.5*mem%AxCd(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*dRdl_p * &                                                 ! axial part
-                        abs(dot_product( mem%k, m%vrel(:,mem%NodeIndx(i)) )) * matmul( mem%kkt, m%vrel(:,mem%NodeIndx(i)) )          ! axial part cont'd
+              Am = mem%Ca(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*mem%Ak + 2.0*mem%AxCa(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p*mem%kkt
+              f_hydro = -matmul( Am, u%Mesh%TranslationAcc(:,mem%NodeIndx(i)) )
            ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
-              Call GetDistDrag_Rec(p, m, u, xd, Time,mem,i,dSadl_p,dSbdl_p,f_hydro,ErrStat2,ErrMsg2)
-               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+              f_hydro = -p%WaveField%WtrDens*mem%CaB(i) * 0.25*pi*mem%SbMG(i)*mem%SbMG(i) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%x_hat)*mem%x_hat &
+                        -p%WaveField%WtrDens*mem%CaA(i) * 0.25*pi*mem%SaMG(i)*mem%SaMG(i) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%y_hat)*mem%y_hat &
+                    -0.5*p%WaveField%WtrDens*mem%AxCa(i) * (dSbdl_p*mem%SaMG(i)+dSadl_p*mem%SbMG(i))*SQRT(mem%SaMG(i)*mem%SbMG(i)) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%k)*mem%k
            END IF
-           CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, m%memberLoads(im)%F_D(:, i) )
-           y%Mesh%Force (:,mem%NodeIndx(i)) = y%Mesh%Force (:,mem%NodeIndx(i)) + m%memberLoads(im)%F_D(1:3, i)
-           y%Mesh%Moment(:,mem%NodeIndx(i)) = y%Mesh%Moment(:,mem%NodeIndx(i)) + m%memberLoads(im)%F_D(4:6, i)
-            
-           IF ( .NOT. mem%PropPot ) THEN
-              !-------------------- hydrodynamic added mass loads: sides: Section 7.1.3 ------------------------!
-              IF (mem%MSecGeom==MSecGeom_Cyl) THEN
-                 Am = mem%Ca(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*mem%Ak + 2.0*mem%AxCa(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p*mem%kkt
-                 f_hydro = -matmul( Am, u%Mesh%TranslationAcc(:,mem%NodeIndx(i)) )
-              ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
-                 f_hydro = -p%WaveField%WtrDens*mem%CaB(i) * 0.25*pi*mem%SbMG(i)*mem%SbMG(i) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%x_hat)*mem%x_hat &
-                           -p%WaveField%WtrDens*mem%CaA(i) * 0.25*pi*mem%SaMG(i)*mem%SaMG(i) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%y_hat)*mem%y_hat &
-                       -0.5*p%WaveField%WtrDens*mem%AxCa(i) * (dSbdl_p*mem%SaMG(i)+dSadl_p*mem%SbMG(i))*SQRT(mem%SaMG(i)*mem%SbMG(i)) * Dot_Product(u%Mesh%TranslationAcc(:,mem%NodeIndx(i)),mem%k)*mem%k
-              END IF
-              IF ( p%AMMod .EQ. 0_IntKi ) THEN ! Always compute added-mass force on nodes below SWL when undisplaced
-                 z1 = u%Mesh%Position(3, mem%NodeIndx(i)) - p%WaveField%MSL2SWL ! Undisplaced z-position of the current node
-                 IF ( z1 > 0.0_ReKi ) THEN ! Node is above SWL when undisplaced; zero added-mass force
-                    f_hydro = 0.0_ReKi
-                    CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, m%memberLoads(im)%F_A(:, i) )
-                 ELSE ! Node at or below SWL when undisplaced
-                    IF ( i == 1 ) THEN
-                       deltalLeft = 0.0_ReKi
-                    ELSE IF ( i == mem%i_floor+1 ) THEN
-                       deltalLeft = -mem%h_floor
-                    ELSE
-                       deltalLeft = 0.5_ReKi * mem%dl
-                    END IF
-                    IF ( i == N+1 ) THEN
-                       deltalRight = 0.0_ReKi
-                    ELSE
-                       z2 = u%Mesh%Position(3, mem%NodeIndx(i+1)) - p%WaveField%MSL2SWL
-                       IF ( z2 > 0.0_ReKi ) THEN ! Element i crosses the SWL
-                          deltalRight = -z1 / mem%cosPhi_ref
-                       ELSE
-                          deltalRight = 0.5_ReKi * mem%dl
-                       END IF
-                    END IF
-                    deltal_AM =              deltalRight + deltalLeft
-                    h_c_AM    = 0.5_ReKi * ( deltalRight - deltalLeft )
-                    CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal_AM, h_c_AM, m%memberLoads(im)%F_A(:, i) )
+           IF ( p%AMMod .EQ. 0_IntKi ) THEN ! Always compute added-mass force on nodes below SWL when undisplaced
+              z1 = u%Mesh%Position(3, mem%NodeIndx(i)) - p%WaveField%MSL2SWL ! Undisplaced z-position of the current node
+              IF ( z1 > 0.0_ReKi ) THEN ! Node is above SWL when undisplaced; zero added-mass force
+                 f_hydro = 0.0_ReKi
+                 CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, memberLoads%F_A(:, i) )
+              ELSE ! Node at or below SWL when undisplaced
+                 IF ( i == 1 ) THEN
+                    deltalLeft = 0.0_ReKi
+                 ELSE IF ( i == mem%i_floor+1 ) THEN
+                    deltalLeft = -mem%h_floor
+                 ELSE
+                    deltalLeft = 0.5_ReKi * mem%dl
                  END IF
-              ELSE ! Compute added-mass force on the instantaneous wetted section of the member
-                 f_hydro = f_hydro * m%nodeInWater(mem%NodeIndx(i)) ! Zero the force if node above free surface
-                 CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, m%memberLoads(im)%F_A(:, i) )
-              END IF ! AMMod 0 or 1
-              y%Mesh%Force (:,mem%NodeIndx(i)) = y%Mesh%Force (:,mem%NodeIndx(i)) + m%memberLoads(im)%F_A(1:3, i)
-              y%Mesh%Moment(:,mem%NodeIndx(i)) = y%Mesh%Moment(:,mem%NodeIndx(i)) + m%memberLoads(im)%F_A(4:6, i)
-              
-              !-------------------- hydrodynamic inertia loads: sides: Section 7.1.4 ---------------------------!
-              IF (mem%MSecGeom==MSecGeom_Cyl) THEN
-                 IF ( mem%PropMCF ) THEN
-                    f_hydro=                     p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)        * matmul( mem%Ak,  m%FAMCF(:,mem%NodeIndx(i)) ) + &
-                                 2.0*mem%AxCa(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p * matmul( mem%kkt, m%FA(:,mem%NodeIndx(i)) ) + &
-                                 2.0*m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)*pi*mem%RMG(i)*dRdl_pp*mem%k
+                 IF ( i == N+1 ) THEN
+                    deltalRight = 0.0_ReKi
                  ELSE
-                    f_hydro=(mem%Ca(i)+mem%Cp(i))*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)       * matmul( mem%Ak,  m%FA(:,mem%NodeIndx(i)) ) + &
-                                 2.0*mem%AxCa(i) *p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p * matmul( mem%kkt, m%FA(:,mem%NodeIndx(i)) ) + &
-                                 2.0*m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)*pi*mem%RMG(i)*dRdl_pp*mem%k
+                    z2 = u%Mesh%Position(3, mem%NodeIndx(i+1)) - p%WaveField%MSL2SWL
+                    IF ( z2 > 0.0_ReKi ) THEN ! Element i crosses the SWL
+                       deltalRight = -z1 / mem%cosPhi_ref
+                    ELSE
+                       deltalRight = 0.5_ReKi * mem%dl
+                    END IF
                  END IF
-              ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
-                 ! Note: MacCamy-Fuchs correction cannot be applied to rectangular members
-                 f_hydro= mem%Cp(i)*p%WaveField%WtrDens* mem%SaMG(i)*mem%SbMG(i) * matmul( mem%Ak,  m%FA(:,mem%NodeIndx(i)) ) + &                            ! transver FK component
-                          m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)* (mem%SaMG(i)*dSbdl_pp+dSadl_pp*mem%SbMG(i)) *mem%k + &                                       ! axial FK component
-                          p%WaveField%WtrDens*mem%CaB(i) * 0.25*pi*mem%SbMG(i)*mem%SbMG(i) * Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%x_hat)*mem%x_hat + &    ! x-component of diffraction part
-                          p%WaveField%WtrDens*mem%CaA(i) * 0.25*pi*mem%SaMG(i)*mem%SaMG(i) * Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%y_hat)*mem%y_hat + &    ! y-component of diffraction part
-                      0.5*p%WaveField%WtrDens*mem%AxCa(i) * (dSbdl_p*mem%SaMG(i)+dSadl_p*mem%SbMG(i))*SQRT(mem%SaMG(i)*mem%SbMG(i)) * &                      ! axial component of diffraction part
-                          Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%k)*mem%k                                                                                   ! axial component of diffraction part cont'd
+                 deltal_AM =              deltalRight + deltalLeft
+                 h_c_AM    = 0.5_ReKi * ( deltalRight - deltalLeft )
+                 CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal_AM, h_c_AM, memberLoads%F_A(:, i) )
+              END IF
+           ELSE ! Compute added-mass force on the instantaneous wetted section of the member
+              f_hydro = f_hydro * m%nodeInWater(mem%NodeIndx(i)) ! Zero the force if node above free surface
+              CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, memberLoads%F_A(:, i) )
+           END IF ! AMMod 0 or 1
+           memberLoads%F_Nd(1:3,i) = memberLoads%F_Nd(1:3,i) + memberLoads%F_A(1:3, i)
+           memberLoads%F_Nd(4:6,i) = memberLoads%F_Nd(4:6,i) + memberLoads%F_A(4:6, i)
+           
+           !-------------------- hydrodynamic inertia loads: sides: Section 7.1.4 ---------------------------!
+           IF (mem%MSecGeom==MSecGeom_Cyl) THEN
+              IF ( mem%PropMCF ) THEN
+                 f_hydro=                     p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)        * matmul( mem%Ak,  m%FAMCF(:,mem%NodeIndx(i)) ) + &
+                              2.0*mem%AxCa(i)*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p * matmul( mem%kkt, m%FA(:,mem%NodeIndx(i)) ) + &
+                              2.0*m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)*pi*mem%RMG(i)*dRdl_pp*mem%k
+              ELSE
+                 f_hydro=(mem%Ca(i)+mem%Cp(i))*p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)       * matmul( mem%Ak,  m%FA(:,mem%NodeIndx(i)) ) + &
+                              2.0*mem%AxCa(i) *p%WaveField%WtrDens*pi*mem%RMG(i)*mem%RMG(i)*dRdl_p * matmul( mem%kkt, m%FA(:,mem%NodeIndx(i)) ) + &
+                              2.0*m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)*pi*mem%RMG(i)*dRdl_pp*mem%k
               END IF
-              CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, m%memberLoads(im)%F_I(:, i) )
-              y%Mesh%Force (:,mem%NodeIndx(i)) = y%Mesh%Force (:,mem%NodeIndx(i)) + m%memberLoads(im)%F_I(1:3, i)
-              y%Mesh%Moment(:,mem%NodeIndx(i)) = y%Mesh%Moment(:,mem%NodeIndx(i)) + m%memberLoads(im)%F_I(4:6, i)
+           ELSE IF (mem%MSecGeom==MSecGeom_Rec) THEN
+              ! Note: MacCamy-Fuchs correction cannot be applied to rectangular members
+              f_hydro= mem%Cp(i)*p%WaveField%WtrDens* mem%SaMG(i)*mem%SbMG(i) * matmul( mem%Ak,  m%FA(:,mem%NodeIndx(i)) ) + &                            ! transver FK component
+                       m%FDynP(mem%NodeIndx(i))*mem%AxCp(i)* (mem%SaMG(i)*dSbdl_pp+dSadl_pp*mem%SbMG(i)) *mem%k + &                                       ! axial FK component
+                       p%WaveField%WtrDens*mem%CaB(i) * 0.25*pi*mem%SbMG(i)*mem%SbMG(i) * Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%x_hat)*mem%x_hat + &    ! x-component of diffraction part
+                       p%WaveField%WtrDens*mem%CaA(i) * 0.25*pi*mem%SaMG(i)*mem%SaMG(i) * Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%y_hat)*mem%y_hat + &    ! y-component of diffraction part
+                   0.5*p%WaveField%WtrDens*mem%AxCa(i) * (dSbdl_p*mem%SaMG(i)+dSadl_p*mem%SbMG(i))*SQRT(mem%SaMG(i)*mem%SbMG(i)) * &                      ! axial component of diffraction part
+                       Dot_Product(m%FA(:,mem%NodeIndx(i)),mem%k)*mem%k                                                                                   ! axial component of diffraction part cont'd
            END IF
+           CALL LumpDistrHydroLoads( f_hydro, mem%k, deltal, h_c, memberLoads%F_I(:, i) )
+           memberLoads%F_Nd(1:3,i) = memberLoads%F_Nd(1:3,i) + memberLoads%F_I(1:3, i)
+           memberLoads%F_Nd(4:6,i) = memberLoads%F_Nd(4:6,i) + memberLoads%F_I(4:6, i)
+        END IF
 
-        END DO ! i = 1,N+1    ! loop through member nodes       
-      
-      END IF ! Check if the member is surface piercing
-      !-----------------------------------------------------------------------------------------------------!
-      !                                External Hydrodynamic Side Loads - End                               !
-      !-----------------------------------------------------------------------------------------------------!
-
-      !-----------------------------------------------------------------------------------------------------!
-      !             Any end plate loads that are modeled on a per-member basis: F_B and F_BF                !
-      !-----------------------------------------------------------------------------------------------------!
-      ! reassign convenience variables to correspond to member ends
-      ! We need to subtract the MSL2SWL offset to place this  in the SWL reference system
-      pos1 = m%DispNodePosHst(:,mem%NodeIndx(1))
-      pos2 = m%DispNodePosHst(:,mem%NodeIndx(2))
-      call GetOrientationAngles( pos1, pos2, phi1, sinPhi1, cosPhi1, tanPhi, sinBeta1, cosBeta1, k_hat1, errStat2, errMsg2 )
+     END DO ! i = 1,N+1    ! loop through member nodes       
+   
+   END IF ! Check if the member is surface piercing
+   !-----------------------------------------------------------------------------------------------------!
+   !                                External Hydrodynamic Side Loads - End                               !
+   !-----------------------------------------------------------------------------------------------------!
+
+   !-----------------------------------------------------------------------------------------------------!
+   !             Any end plate loads that are modeled on a per-member basis: F_B and F_BF                !
+   !-----------------------------------------------------------------------------------------------------!
+   ! reassign convenience variables to correspond to member ends
+   ! We need to subtract the MSL2SWL offset to place this  in the SWL reference system
+   pos1 = m%DispNodePosHst(:,mem%NodeIndx(1))
+   pos2 = m%DispNodePosHst(:,mem%NodeIndx(2))
+   call GetOrientationAngles( pos1, pos2, phi1, sinPhi1, cosPhi1, tanPhi, sinBeta1, cosBeta1, k_hat1, errStat2, errMsg2 )
+     call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   if ( N == 1 ) then       ! Only one element in member
+      sinPhi2  = sinPhi1
+      cosPhi2  = cosPhi1
+      sinBeta2 = sinBeta1
+      cosBeta2 = cosBeta1
+      k_hat2   = k_hat1
+   else
+      !  We need to subtract the MSL2SWL offset to place this  in the SWL reference system
+      pos1 = m%DispNodePosHst(:, mem%NodeIndx(N  ))
+      pos2 = m%DispNodePosHst(:, mem%NodeIndx(N+1))
+      call GetOrientationAngles( pos1, pos2, phi2, sinPhi2, cosPhi2, tanPhi, sinBeta2, cosBeta2, k_hat2, errStat2, errMsg2 )
         call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-      if ( N == 1 ) then       ! Only one element in member
-         sinPhi2  = sinPhi1
-         cosPhi2  = cosPhi1
-         sinBeta2 = sinBeta1
-         cosBeta2 = cosBeta1
-         k_hat2   = k_hat1
-      else
-         !  We need to subtract the MSL2SWL offset to place this  in the SWL reference system
-         pos1 = m%DispNodePosHst(:, mem%NodeIndx(N  ))
-         pos2 = m%DispNodePosHst(:, mem%NodeIndx(N+1))
-         call GetOrientationAngles( pos1, pos2, phi2, sinPhi2, cosPhi2, tanPhi, sinBeta2, cosBeta2, k_hat2, errStat2, errMsg2 )
-           call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-      end if
-      ! z-coordinates of the two ends of the member
-      z1 = m%DispNodePosHst(3,mem%NodeIndx(  1))
-      z2 = m%DispNodePosHst(3,mem%NodeIndx(N+1))
-      
-      if (mem%MSecGeom == MSecGeom_Rec) then
-         ! Compute total orientation matrix of starting and ending joints
-         call Morison_DirCosMtrx( u%Mesh%Position(:,mem%NodeIndx(1)), u%Mesh%Position(:,mem%NodeIndx(N+1)), mem%MSpinOrient, CMatrix )
-         CMatrix1 = matmul(transpose(u%Mesh%Orientation(:,:,mem%NodeIndx(1  ))),CMatrix)
-         CALL GetSectionUnitVectors_Rec( CMatrix1, x_hat1, y_hat1 )
-         CMatrix2 = matmul(transpose(u%Mesh%Orientation(:,:,mem%NodeIndx(N+1))),CMatrix)
-         CALL GetSectionUnitVectors_Rec( CMatrix2, x_hat2, y_hat2 )
-      end if
+   end if
+   ! z-coordinates of the two ends of the member
+   z1 = m%DispNodePosHst(3,mem%NodeIndx(  1))
+   z2 = m%DispNodePosHst(3,mem%NodeIndx(N+1))
+   
+   if (mem%MSecGeom == MSecGeom_Rec) then
+      ! Compute total orientation matrix of starting and ending joints
+      call Morison_DirCosMtrx( u%Mesh%Position(:,mem%NodeIndx(1)), u%Mesh%Position(:,mem%NodeIndx(N+1)), mem%MSpinOrient, CMatrix )
+      CMatrix1 = matmul(transpose(u%Mesh%Orientation(:,:,mem%NodeIndx(1  ))),CMatrix)
+      CALL GetSectionUnitVectors_Rec( CMatrix1, x_hat1, y_hat1 )
+      CMatrix2 = matmul(transpose(u%Mesh%Orientation(:,:,mem%NodeIndx(N+1))),CMatrix)
+      CALL GetSectionUnitVectors_Rec( CMatrix2, x_hat2, y_hat2 )
+   end if
 
 
-      !----------------------------------- filled buoyancy loads: starts -----------------------------------!
-      if ( mem%memfloodstatus > 0 ) then
+   !----------------------------------- filled buoyancy loads: starts -----------------------------------!
+   if ( mem%memfloodstatus > 0 ) then
 
-         if ( mem%i_floor == 0 ) then                                                ! If the member is not buried in the seabed, compute the internal hydrostatic load on the starting endplate
-            if ( mem%MSecGeom == MSecGeom_Cyl ) then
-               m%F_BF_End(1:3, mem%NodeIndx(  1)) = m%F_BF_End(1:3, mem%NodeIndx(  1)) - mem%FillDens * g *        pi * mem%Rin(  1)**2* (zFillGroup - z1) * k_hat1
-               m%F_BF_End(4:6, mem%NodeIndx(  1)) = m%F_BF_End(4:6, mem%NodeIndx(  1)) - mem%FillDens * g * 0.25 * pi * mem%Rin(  1)**4* Cross_Product(k_hat1,(/0.0,0.0,1.0/))
-            else if ( mem%MSecGeom == MSecGeom_Rec ) then
-               m%F_BF_End(1:3, mem%NodeIndx(  1)) = m%F_BF_End(1:3, mem%NodeIndx(  1)) - mem%FillDens * g *         mem%SaIn(  1)   *mem%SbIn(  1)* (zFillGroup - z1) * k_hat1
-               m%F_BF_End(4:6, mem%NodeIndx(  1)) = m%F_BF_End(4:6, mem%NodeIndx(  1)) - mem%FillDens * g / 12.0 * (mem%SaIn(  1)**3*mem%SbIn(  1)*x_hat1(3)*y_hat1 - mem%SaIn(1)*mem%SbIn(1)**3*y_hat1(3)*x_hat1)
-            end if
+      if ( mem%i_floor == 0 ) then                                                ! If the member is not buried in the seabed, compute the internal hydrostatic load on the starting endplate
+         if ( mem%MSecGeom == MSecGeom_Cyl ) then
+            memberLoads%F_BF_End(1:3,1) = memberLoads%F_BF_End(1:3,1) - mem%FillDens * g *        pi * mem%Rin(  1)**2* (zFillGroup - z1) * k_hat1
+            memberLoads%F_BF_End(4:6,1) = memberLoads%F_BF_End(4:6,1) - mem%FillDens * g * 0.25 * pi * mem%Rin(  1)**4* Cross_Product(k_hat1,(/0.0,0.0,1.0/))
+         else if ( mem%MSecGeom == MSecGeom_Rec ) then
+            memberLoads%F_BF_End(1:3,1) = memberLoads%F_BF_End(1:3,1) - mem%FillDens * g *         mem%SaIn(  1)   *mem%SbIn(  1)* (zFillGroup - z1) * k_hat1
+            memberLoads%F_BF_End(4:6,1) = memberLoads%F_BF_End(4:6,1) - mem%FillDens * g / 12.0 * (mem%SaIn(  1)**3*mem%SbIn(  1)*x_hat1(3)*y_hat1 - mem%SaIn(1)*mem%SbIn(1)**3*y_hat1(3)*x_hat1)
          end if
+      end if
 
-         if ( (mem%i_floor<mem%NElements+1) .and. (mem%memfloodstatus==1) ) then     ! If the member is not fully buried in the seabed and fully filled, compute the internal hydrostatic load on the ending endplate
-            ! Note: If member is not fully filled, the endplate load is added to the appropriate member internal node under F_BF above
-            if ( mem%MSecGeom == MSecGeom_Cyl ) then
-               m%F_BF_End(1:3, mem%NodeIndx(N+1)) = m%F_BF_End(1:3, mem%NodeIndx(N+1)) + mem%FillDens * g *        pi * mem%Rin(N+1)**2* (zFillGroup - z2) * k_hat2
-               m%F_BF_End(4:6, mem%NodeIndx(N+1)) = m%F_BF_End(4:6, mem%NodeIndx(N+1)) + mem%FillDens * g * 0.25 * pi * mem%Rin(N+1)**4* Cross_Product(k_hat2,(/0.0,0.0,1.0/))
-            else if ( mem%MSecGeom == MSecGeom_Rec ) then
-               m%F_BF_End(1:3, mem%NodeIndx(N+1)) = m%F_BF_End(1:3, mem%NodeIndx(N+1)) + mem%FillDens * g *         mem%SaIn(N+1)   *mem%SbIn(N+1)* (zFillGroup - z2) * k_hat2
-               m%F_BF_End(4:6, mem%NodeIndx(N+1)) = m%F_BF_End(4:6, mem%NodeIndx(N+1)) + mem%FillDens * g / 12.0 * (mem%SaIn(N+1)**3*mem%SbIn(N+1)*x_hat2(3)*y_hat2 - mem%SaIn(N+1)*mem%SbIn(N+1)**3*y_hat2(3)*x_hat2)
-            end if
+      if ( (mem%i_floor<mem%NElements+1) .and. (mem%memfloodstatus==1) ) then     ! If the member is not fully buried in the seabed and fully filled, compute the internal hydrostatic load on the ending endplate
+         ! Note: If member is not fully filled, the endplate load is added to the appropriate member internal node under F_BF above
+         if ( mem%MSecGeom == MSecGeom_Cyl ) then
+            memberLoads%F_BF_End(1:3,2) = memberLoads%F_BF_End(1:3,2) + mem%FillDens * g *        pi * mem%Rin(N+1)**2* (zFillGroup - z2) * k_hat2
+            memberLoads%F_BF_End(4:6,2) = memberLoads%F_BF_End(4:6,2) + mem%FillDens * g * 0.25 * pi * mem%Rin(N+1)**4* Cross_Product(k_hat2,(/0.0,0.0,1.0/))
+         else if ( mem%MSecGeom == MSecGeom_Rec ) then
+            memberLoads%F_BF_End(1:3,2) = memberLoads%F_BF_End(1:3,2) + mem%FillDens * g *         mem%SaIn(N+1)   *mem%SbIn(N+1)* (zFillGroup - z2) * k_hat2
+            memberLoads%F_BF_End(4:6,2) = memberLoads%F_BF_End(4:6,2) + mem%FillDens * g / 12.0 * (mem%SaIn(N+1)**3*mem%SbIn(N+1)*x_hat2(3)*y_hat2 - mem%SaIn(N+1)*mem%SbIn(N+1)**3*y_hat2(3)*x_hat2)
          end if
+      end if
 
-       end if
-
-      !------------------------------------ filled buoyancy loads: ends ------------------------------------!
-
-      ! --- no inertia loads from water ballast modeled on ends
+    end if
+
+   !------------------------------------ filled buoyancy loads: ends ------------------------------------!
+
+   ! --- no inertia loads from water ballast modeled on ends
+
+   !---------------------------------- external buoyancy loads: starts ----------------------------------!
+   if ( (.not. mem%PropPot) .AND. (mem%MHstLMod /= 0) ) then
+      ! Get positions and scaled radii of member end nodes
+      pos1 = m%DispNodePosHst(:,mem%NodeIndx(  1))
+      pos2 = m%DispNodePosHst(:,mem%NodeIndx(N+1))
+      if (mem%MSecGeom==MSecGeom_Cyl) then
+         r1      = mem%RMGB(  1)
+         r2      = mem%RMGB(N+1)
+      else if (mem%MSecGeom==MSecGeom_Rec) then
+         Sa1     = mem%SaMGB(  1)
+         Sa2     = mem%SaMGB(N+1)
+         Sb1     = mem%SbMGB(  1)
+         Sb2     = mem%SbMGB(N+1)
+      end if
+      if (mem%i_floor == 0) then  ! both ends above or at seabed
+         ! Compute loads on the end plate of node 1
+         IF (p%HstMod > 0_IntKi) THEN
+            CALL GetTotalWaveElev(p, WaveField_m, Time, pos1, Zeta1, ErrStat2, ErrMsg2)
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            CALL GetFreeSurfaceNormal(p, WaveField_m, Time, pos1, n_hat, ErrStat2, ErrMsg2)
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            FSPt = (/pos1(1),pos1(2),Zeta1/) ! Reference point on the free surface
+         ELSE
+            FSPt = (/pos1(1),pos1(2),0.0_ReKi/)
+            n_hat = (/0.0,0.0,1.0/)
+         END IF
 
-      !---------------------------------- external buoyancy loads: starts ----------------------------------!
-      if ( (.not. mem%PropPot) .AND. (mem%MHstLMod /= 0) ) then
-         ! Get positions and scaled radii of member end nodes
-         pos1 = m%DispNodePosHst(:,mem%NodeIndx(  1))
-         pos2 = m%DispNodePosHst(:,mem%NodeIndx(N+1))
          if (mem%MSecGeom==MSecGeom_Cyl) then
-            r1      = mem%RMGB(  1)
-            r2      = mem%RMGB(N+1)
+            CALL GetSectionUnitVectors_Cyl( k_hat1, y_hat, z_hat )
+            CALL GetSectionFreeSurfaceIntersects_Cyl( REAL(pos1,DbKi), REAL(FSPt,DbKi), k_hat1, y_hat, z_hat, n_hat, REAL(r1,DbKi), theta1, theta2, secStat)
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            CALL GetEndPlateHstLds_Cyl(p, pos1, k_hat1, y_hat, z_hat, r1, theta1, theta2, F_B_End)
+            IF (mem%MHstLMod == 1) THEN ! Check for partially wetted end plates
+               IF ( .NOT.( EqualRealNos((theta2-theta1),0.0_DbKi) .OR. EqualRealNos((theta2-theta1),2.0_DbKi*PI_D) ) ) THEN
+                   CALL SetErrStat(ErrID_Warn, 'End plate is partially wetted with MHstLMod = 1. The buoyancy load and distribution potentially have large error. This has happened to the first node of Member ID ' //trim(num2lstr(mem%MemberID)), errStat, errMsg, RoutineName )
+               END IF
+            END IF
          else if (mem%MSecGeom==MSecGeom_Rec) then
-            Sa1     = mem%SaMGB(  1)
-            Sa2     = mem%SaMGB(N+1)
-            Sb1     = mem%SbMGB(  1)
-            Sb2     = mem%SbMGB(N+1)
+            CALL GetSectionUnitVectors_Rec( CMatrix1, x_hat, y_hat )
+            CALL GetEndPlateHstLds_Rec(p, pos1, k_hat1, x_hat, y_hat, Sa1, Sb1, FSPt, n_hat, F_B_End)
          end if
-         if (mem%i_floor == 0) then  ! both ends above or at seabed
-            ! Compute loads on the end plate of node 1
-            IF (p%HstMod > 0_IntKi) THEN
-               CALL GetTotalWaveElev(p, m, Time, pos1, Zeta1, ErrStat2, ErrMsg2)
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               CALL GetFreeSurfaceNormal(p, m, Time, pos1, n_hat, ErrStat2, ErrMsg2)
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               FSPt = (/pos1(1),pos1(2),Zeta1/) ! Reference point on the free surface
-            ELSE
-               FSPt = (/pos1(1),pos1(2),0.0_ReKi/)
-               n_hat = (/0.0,0.0,1.0/)
-            END IF
-
-            if (mem%MSecGeom==MSecGeom_Cyl) then
-               CALL GetSectionUnitVectors_Cyl( k_hat1, y_hat, z_hat )
-               CALL GetSectionFreeSurfaceIntersects_Cyl( REAL(pos1,DbKi), REAL(FSPt,DbKi), k_hat1, y_hat, z_hat, n_hat, REAL(r1,DbKi), theta1, theta2, secStat)
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               CALL GetEndPlateHstLds_Cyl(p, pos1, k_hat1, y_hat, z_hat, r1, theta1, theta2, F_B_End)
-               IF (mem%MHstLMod == 1) THEN ! Check for partially wetted end plates
-                  IF ( .NOT.( EqualRealNos((theta2-theta1),0.0_DbKi) .OR. EqualRealNos((theta2-theta1),2.0_DbKi*PI_D) ) ) THEN
-                      CALL SetErrStat(ErrID_Warn, 'End plate is partially wetted with MHstLMod = 1. The buoyancy load and distribution potentially have large error. This has happened to the first node of Member ID ' //trim(num2lstr(mem%MemberID)), errStat, errMsg, RoutineName )
-                  END IF
-               END IF
-            else if (mem%MSecGeom==MSecGeom_Rec) then
-               CALL GetSectionUnitVectors_Rec( CMatrix1, x_hat, y_hat )
-               CALL GetEndPlateHstLds_Rec(p, pos1, k_hat1, x_hat, y_hat, Sa1, Sb1, FSPt, n_hat, F_B_End)
-            end if
-            m%F_B_End(:, mem%NodeIndx(  1)) = m%F_B_End(:, mem%NodeIndx(  1)) + F_B_End
+         memberLoads%F_B_End(:,1) = memberLoads%F_B_End(:,1) + F_B_End
 
-            ! Compute loads on the end plate of node N+1
-            IF (p%HstMod > 0_IntKi) THEN
-               CALL GetTotalWaveElev(p, m, Time, pos2, Zeta2, ErrStat2, ErrMsg2)
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               CALL GetFreeSurfaceNormal(p, m, Time, pos2, n_hat, ErrStat2, ErrMsg2)
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               FSPt = (/pos2(1),pos2(2),Zeta2/) ! Reference point on the free surface
-            ELSE
-               FSPt = (/pos2(1),pos2(2),0.0_ReKi/)
-               n_hat = (/0.0,0.0,1.0/)
-            END IF
+         ! Compute loads on the end plate of node N+1
+         IF (p%HstMod > 0_IntKi) THEN
+            CALL GetTotalWaveElev(p, WaveField_m, Time, pos2, Zeta2, ErrStat2, ErrMsg2)
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            CALL GetFreeSurfaceNormal(p, WaveField_m, Time, pos2, n_hat, ErrStat2, ErrMsg2)
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            FSPt = (/pos2(1),pos2(2),Zeta2/) ! Reference point on the free surface
+         ELSE
+            FSPt = (/pos2(1),pos2(2),0.0_ReKi/)
+            n_hat = (/0.0,0.0,1.0/)
+         END IF
 
-            if (mem%MSecGeom==MSecGeom_Cyl) then
-               CALL GetSectionUnitVectors_Cyl( k_hat2, y_hat, z_hat )
-               CALL GetSectionFreeSurfaceIntersects_Cyl( REAL(pos2,DbKi), REAL(FSPt,DbKi), k_hat2, y_hat, z_hat, n_hat, REAL(r2,DbKi), theta1, theta2, secStat)
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               CALL GetEndPlateHstLds_Cyl(p, pos2, k_hat2, y_hat, z_hat, r2, theta1, theta2, F_B_End)
-               IF (mem%MHstLMod == 1) THEN ! Check for partially wetted end plates
-                  IF ( .NOT.( EqualRealNos((theta2-theta1),0.0_DbKi) .OR. EqualRealNos((theta2-theta1),2.0_DbKi*PI_D) ) ) THEN
-                      CALL SetErrStat(ErrID_Warn, 'End plate is partially wetted with MHstLMod = 1. The buoyancy load and distribution potentially have large error. This has happened to the last node of Member ID ' //trim(num2lstr(mem%MemberID)), errStat, errMsg, RoutineName )
-                  END IF
+         if (mem%MSecGeom==MSecGeom_Cyl) then
+            CALL GetSectionUnitVectors_Cyl( k_hat2, y_hat, z_hat )
+            CALL GetSectionFreeSurfaceIntersects_Cyl( REAL(pos2,DbKi), REAL(FSPt,DbKi), k_hat2, y_hat, z_hat, n_hat, REAL(r2,DbKi), theta1, theta2, secStat)
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            CALL GetEndPlateHstLds_Cyl(p, pos2, k_hat2, y_hat, z_hat, r2, theta1, theta2, F_B_End)
+            IF (mem%MHstLMod == 1) THEN ! Check for partially wetted end plates
+               IF ( .NOT.( EqualRealNos((theta2-theta1),0.0_DbKi) .OR. EqualRealNos((theta2-theta1),2.0_DbKi*PI_D) ) ) THEN
+                   CALL SetErrStat(ErrID_Warn, 'End plate is partially wetted with MHstLMod = 1. The buoyancy load and distribution potentially have large error. This has happened to the last node of Member ID ' //trim(num2lstr(mem%MemberID)), errStat, errMsg, RoutineName )
                END IF
-            else if (mem%MSecGeom==MSecGeom_Rec) then
-               CALL GetSectionUnitVectors_Rec( CMatrix2, x_hat, y_hat )
-               CALL GetEndPlateHstLds_Rec(p, pos2, k_hat2, x_hat, y_hat, Sa2, Sb2, FSPt, n_hat, F_B_End)
-            end if
-            m%F_B_End(:, mem%NodeIndx(N+1)) = m%F_B_End(:, mem%NodeIndx(N+1)) - F_B_End
-
-         elseif ( mem%doEndBuoyancy ) then ! The member crosses the seabed line so only the upper end potentially have hydrostatic load
-            ! Only compute the loads on the end plate of node N+1
-            IF (p%HstMod > 0_IntKi) THEN
-               CALL GetTotalWaveElev(p, m, Time, pos2, Zeta2, ErrStat2, ErrMsg2)
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               CALL GetFreeSurfaceNormal(p, m, Time, pos2, n_hat, ErrStat2, ErrMsg2)
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               FSPt = (/pos2(1),pos2(2),Zeta2/) ! Reference point on the free surface
-            ELSE
-               FSPt = (/pos2(1),pos2(2),0.0_ReKi/)
-               n_hat = (/0.0,0.0,1.0/)
             END IF
-
-            if (mem%MSecGeom==MSecGeom_Cyl) then
-               CALL GetSectionUnitVectors_Cyl( k_hat2, y_hat, z_hat )
-               CALL GetSectionFreeSurfaceIntersects_Cyl( REAL(pos2,DbKi), REAL(FSPt,DbKi), k_hat2, y_hat, z_hat, n_hat, REAL(r2,DbKi), theta1, theta2, secStat)
-                 CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               CALL GetEndPlateHstLds_Cyl(p, pos2, k_hat2, y_hat, z_hat, r2, theta1, theta2, F_B_End)
-               IF (mem%MHstLMod == 1) THEN ! Check for partially wetted end plates
-                  IF ( .NOT.( EqualRealNos((theta2-theta1),0.0_DbKi) .OR. EqualRealNos((theta2-theta1),2.0_DbKi*PI_D) ) ) THEN
-                      CALL SetErrStat(ErrID_Warn, 'End plate is partially wetted with MHstLMod = 1. The buoyancy load and distribution potentially have large error. This has happened to the last node of Member ID ' //trim(num2lstr(mem%MemberID)), errStat, errMsg, RoutineName )
-                  END IF
-               END IF
-            else if (mem%MSecGeom==MSecGeom_Rec) then
-               CALL GetSectionUnitVectors_Rec( CMatrix2, x_hat, y_hat )
-               CALL GetEndPlateHstLds_Rec(p, pos2, k_hat2, x_hat, y_hat, Sa2, Sb2, FSPt, n_hat, F_B_End)
-            end if
-            m%F_B_End(:, mem%NodeIndx(N+1)) = m%F_B_End(:, mem%NodeIndx(N+1)) - F_B_End
-
-         ! else
-            ! entire member is buried below the seabed
+         else if (mem%MSecGeom==MSecGeom_Rec) then
+            CALL GetSectionUnitVectors_Rec( CMatrix2, x_hat, y_hat )
+            CALL GetEndPlateHstLds_Rec(p, pos2, k_hat2, x_hat, y_hat, Sa2, Sb2, FSPt, n_hat, F_B_End)
          end if
+         memberLoads%F_B_End(:,2) = memberLoads%F_B_End(:,2) - F_B_End
 
-      end if   ! PropPot
-      !----------------------------------- external buoyancy loads: ends -----------------------------------!
-
-   end do ! im - looping through members
-
-   !---------------------------------------------------------------------------------------------------------------!
-   !                                     External Hydrodynamic Joint Loads - Start                                 !
-   !                                        F_D_End, F_I_End, F_A_End, F_IMG_End                                   !
-   !---------------------------------------------------------------------------------------------------------------!      
-   ! NOTE:  All wave kinematics have already been zeroed out above the SWL or instantaneous wave height (for WaveStMod > 0), 
-   ! so loads derived from the kinematics will be correct without the use of a nodeInWater value, but other loads need to be 
-   ! multiplied by nodeInWater to zero them out above the SWL or instantaneous wave height.
-
-   DO J = 1, p%NJoints
-      ! Obtain the node index because WaveVel, WaveAcc, and WaveDynP are defined in the node indexing scheme, not the markers (No longer relevant?)
-      ! The first NJoints nodes are all the joints with the rest being the internal nodes. See Morison_GenerateSimulationNodes.
-            
-      ! NOTE: 
-      ! The PropPot values are only for members, and when the p%AM_End, p%DP_Const_End, p%Mass_MG_End, and p%I_MG_End are computed at init,
-      ! contributions to these values are added only if the member connecting to the joint is NOT modeled with potential flow theory
-      ! However, the p%An_End term used data from ALL members attached to a node, regardless of the PropPot setting, because the drag force is alway on.
-      ! Therefore, no need to check PropPot here.
-      
-      ! Effect of wave stretching already baked into m%FDynP, m%FA, and m%vrel. No additional modification needed.
-
-      ! Joint yaw offset
-      call YawJoint(p, J,u%PtfmRefY,AM_End,An_End,DP_Const_End,I_MG_End,ErrStat2,ErrMsg2)
-      call SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
-      
-      ! Lumped added mass loads
-      qdotdot                 = reshape((/u%Mesh%TranslationAcc(:,J),u%Mesh%RotationAcc(:,J)/),(/6/)) 
-      m%F_A_End(:,J)          = m%nodeInWater(j) * matmul( AM_End, ( - qdotdot(1:3)) )
-         
-      ! TODO: The original code did not multiply by nodeInWater, but should we? GJH
-      ! Should be ok because m%FDynP and m%FA are both zeroed above the SWL (when WaveStMod=0) or the instantaneous free surface (when WaveStMod>0)
-      m%F_I_End(:,J) =   (DP_Const_End * m%FDynP(j) + matmul(AM_End,m%FA(:,j)))
-         
-      ! Marine growth inertia: ends: Section 4.2.2
-      m%F_IMG_End(1:3,j) = -p%Mass_MG_End(j)*qdotdot(1:3)
-      m%F_IMG_End(4:6,j) = -matmul(I_MG_End,qdotdot(4:6)) - cross_product(u%Mesh%RotationVel(:,J),matmul(I_MG_End,u%Mesh%RotationVel(:,J)))
-
-      ! Compute the dot product of the relative velocity vector with the directional Area of the Joint
-      ! m%nodeInWater(j) is probably not necessary because m%vrel is zeroed when the node is out of water
-      vmag  = m%nodeInWater(j) * ( m%vrel(1,j)*An_End(1) + m%vrel(2,j)*An_End(2) + m%vrel(3,j)*An_End(3) )
-      ! High-pass filtering
-      vmagf = p%VRelNFiltConst(J) * (vmag + xd%v_rel_n_FiltStat(J))
-
-      ! Record most up-to-date vmagf and vmag at join J
-      m%v_rel_n(j) = vmag
-      m%v_rel_n_HiPass(j) = vmagf
-
-      ! Evaluate drag force and combine all per-joint loads
-      DO I=1,6
-         IF (I < 4 ) THEN ! Three force components
-            IF ( p%DragMod_End(J) .EQ. 0_IntKi ) THEN
-               ! Note: vmag is zero if node is not in the water
-               m%F_D_End(i,j) = (1.0_ReKi - p%DragLoFSc_End(j)) * An_End(i) * p%DragConst_End(j) * abs(vmagf)*vmagf &   
-                                          + p%DragLoFSc_End(j)  * An_End(i) * p%DragConst_End(j) * abs(vmag )*vmag  
-            ELSE IF (p%DragMod_End(J) .EQ. 1_IntKi) THEN
-               ! Note: vmag is zero if node is not in the water
-               m%F_D_End(i,j) = (1.0_ReKi - p%DragLoFSc_End(j)) * An_End(i) * p%DragConst_End(j) * abs(vmagf)*max(vmagf,0.0_ReKi) &
-                                          + p%DragLoFSc_End(j)  * An_End(i) * p%DragConst_End(j) * abs(vmag) *max(vmag, 0.0_ReKi)
-               m%F_D_End(i,j) = 2.0_ReKi * m%F_D_End(i,j)
-            END IF
-            
-            y%Mesh%Force(i,j)    = y%Mesh%Force(i,j)    + m%F_D_End(i,j) + m%F_I_End(i,j) + p%F_WMG_End(i,j) + m%F_B_End(i,j) + m%F_BF_End(i,j) + m%F_A_End(i,j) + m%F_IMG_End(i,j)
-         ELSE ! Three moment components
-            y%Mesh%Moment(i-3,j) = y%Mesh%Moment(i-3,j) + m%F_B_End(i,j) + m%F_BF_End(i,j)  + m%F_IMG_End(i,j)
+      elseif ( mem%doEndBuoyancy ) then ! The member crosses the seabed line so only the upper end potentially have hydrostatic load
+         ! Only compute the loads on the end plate of node N+1
+         IF (p%HstMod > 0_IntKi) THEN
+            CALL GetTotalWaveElev(p, WaveField_m, Time, pos2, Zeta2, ErrStat2, ErrMsg2)
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            CALL GetFreeSurfaceNormal(p, WaveField_m, Time, pos2, n_hat, ErrStat2, ErrMsg2)
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            FSPt = (/pos2(1),pos2(2),Zeta2/) ! Reference point on the free surface
+         ELSE
+            FSPt = (/pos2(1),pos2(2),0.0_ReKi/)
+            n_hat = (/0.0,0.0,1.0/)
          END IF
-      END DO  ! I=1,6
-         
-   END DO  ! J = 1, p%NJoints
-
-   !---------------------------------------------------------------------------------------------------------------!
-   !                                      External Hydrodynamic Joint Loads - End                                  !
-   !---------------------------------------------------------------------------------------------------------------!    
-   ! Map calculated results into the y%WriteOutput Array
-   CALL MrsnOut_MapOutputs(y, p, u, m)
 
+         if (mem%MSecGeom==MSecGeom_Cyl) then
+            CALL GetSectionUnitVectors_Cyl( k_hat2, y_hat, z_hat )
+            CALL GetSectionFreeSurfaceIntersects_Cyl( REAL(pos2,DbKi), REAL(FSPt,DbKi), k_hat2, y_hat, z_hat, n_hat, REAL(r2,DbKi), theta1, theta2, secStat)
+              CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            CALL GetEndPlateHstLds_Cyl(p, pos2, k_hat2, y_hat, z_hat, r2, theta1, theta2, F_B_End)
+            IF (mem%MHstLMod == 1) THEN ! Check for partially wetted end plates
+               IF ( .NOT.( EqualRealNos((theta2-theta1),0.0_DbKi) .OR. EqualRealNos((theta2-theta1),2.0_DbKi*PI_D) ) ) THEN
+                   CALL SetErrStat(ErrID_Warn, 'End plate is partially wetted with MHstLMod = 1. The buoyancy load and distribution potentially have large error. This has happened to the last node of Member ID ' //trim(num2lstr(mem%MemberID)), errStat, errMsg, RoutineName )
+               END IF
+            END IF
+         else if (mem%MSecGeom==MSecGeom_Rec) then
+            CALL GetSectionUnitVectors_Rec( CMatrix2, x_hat, y_hat )
+            CALL GetEndPlateHstLds_Rec(p, pos2, k_hat2, x_hat, y_hat, Sa2, Sb2, FSPt, n_hat, F_B_End)
+         end if
+         memberLoads%F_B_End(:,2) = memberLoads%F_B_End(:,2) - F_B_End
 
-   ! map the motion to the visulization mesh
-   if (p%VisMeshes) then
-      !FIXME: error handling is incorrect here (overwrites all previous errors/warnings)
-      call Transfer_Point_to_Line2( u%Mesh, y%VisMesh, m%VisMeshMap, ErrStat, ErrMsg )
-   endif
+      ! else
+         ! entire member is buried below the seabed
+      end if
 
+   end if   ! PropPot
+   !----------------------------------- external buoyancy loads: ends -----------------------------------!
 
-   CONTAINS
+CONTAINS
 
    logical function Failed()
       CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
       Failed = ErrStat >= AbortErrLev
-      !if (Failed) then
-      !   call FailCleanup()
-      !endif
    end function Failed
 
-END SUBROUTINE Morison_CalcOutput
+END SUBROUTINE Morison_CalcMemberLoads
 
-   SUBROUTINE GetTotalWaveElev(p, m, Time, pos, Zeta, ErrStat, ErrMsg )
-      TYPE(Morison_ParameterType), INTENT( IN    ) :: p
-      TYPE(Morison_MiscVarType),   INTENT( INOUT ) :: m
+   SUBROUTINE GetTotalWaveElev(p, WaveField_m, Time, pos, Zeta, ErrStat, ErrMsg )
+      TYPE(Morison_ParameterType),  INTENT( IN    ) :: p
+      TYPE(GridInterp_MiscVarType), INTENT( INOUT ) :: WaveField_m
       REAL(DbKi),      INTENT( IN    ) :: Time
       REAL(ReKi),      INTENT( IN    ) :: pos(*)  ! Position at which free-surface elevation is to be calculated. Third entry ignored if present.
       REAL(ReKi),      INTENT(   OUT ) :: Zeta    ! Total free-surface elevation with first- and second-order contribution (if present)
@@ -4796,14 +4876,14 @@ END SUBROUTINE Morison_CalcOutput
       ErrStat   = ErrID_None
       ErrMsg    = ""
 
-      Zeta = WaveField_GetNodeTotalWaveElev( p%WaveField, m%WaveField_m, Time, pos, ErrStat2, ErrMsg2 )
+      Zeta = WaveField_GetNodeTotalWaveElev( p%WaveField, WaveField_m, Time, pos, ErrStat2, ErrMsg2 )
         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
    END SUBROUTINE GetTotalWaveElev
 
-   SUBROUTINE GetFreeSurfaceNormal(p, m, Time, pos, n, ErrStat, ErrMsg)
-      TYPE(Morison_ParameterType), INTENT( IN    ) :: p
-      TYPE(Morison_MiscVarType),   INTENT( INOUT ) :: m
+   SUBROUTINE GetFreeSurfaceNormal(p, WaveField_m, Time, pos, n, ErrStat, ErrMsg)
+      TYPE(Morison_ParameterType),  INTENT( IN    ) :: p
+      TYPE(GridInterp_MiscVarType), INTENT( INOUT ) :: WaveField_m
       REAL(DbKi),      INTENT( In    ) :: Time
       REAL(ReKi),      INTENT( In    ) :: pos(:)  ! Position at which free-surface normal is to be calculated. Third entry ignored if present.
       REAL(ReKi),      INTENT(   OUT ) :: n(3)    ! Free-surface normal vector
@@ -4815,7 +4895,7 @@ END SUBROUTINE Morison_CalcOutput
       ErrStat   = ErrID_None
       ErrMsg    = ""
 
-      CALL WaveField_GetNodeWaveNormal( p%WaveField, m%WaveField_m, Time, pos, n, ErrStat2, ErrMsg2 )
+      CALL WaveField_GetNodeWaveNormal( p%WaveField, WaveField_m, Time, pos, n, ErrStat2, ErrMsg2 )
         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
    END SUBROUTINE GetFreeSurfaceNormal
@@ -5862,10 +5942,10 @@ END SUBROUTINE Morison_CalcOutput
 
    END SUBROUTINE GetHstLdsOnTrapezoid
 
-   SUBROUTINE getElementHstLds_Mod1(p, m, mem, Time, pos1, pos2, Zeta1, Zeta2, k_hat, r1, r2, dl, alphaIn, Is1stElement, F_B0, F_B1, F_B2, ErrStat, ErrMsg )
+   SUBROUTINE getElementHstLds_Mod1(p, WaveField_m, mem, Time, pos1, pos2, Zeta1, Zeta2, k_hat, r1, r2, dl, alphaIn, Is1stElement, F_B0, F_B1, F_B2, ErrStat, ErrMsg )
       
       TYPE(Morison_ParameterType), INTENT( IN    ) :: p
-      TYPE(Morison_MiscVarType), INTENT( INOUT ) :: m
+      TYPE(GridInterp_MiscVarType), INTENT( INOUT ) :: WaveField_m
       TYPE(Morison_MemberType), intent(in) :: mem
       REAL(DbKi),      INTENT( IN    ) :: Time
       REAL(ReKi),      INTENT( IN    ) :: pos1(3)
@@ -5940,7 +6020,7 @@ END SUBROUTINE Morison_CalcOutput
          rh       = r1 + h0*dRdl
          ! Estimate the free-surface normal at the free-surface intersection, n_hat
          IF (p%HstMod > 0_IntKi) THEN ! If wave stretching is enabled, compute free surface normal
-            CALL GetFreeSurfaceNormal(p, m, Time, FSInt, n_hat, ErrStat2, ErrMsg2 )
+            CALL GetFreeSurfaceNormal(p, WaveField_m, Time, FSInt, n_hat, ErrStat2, ErrMsg2 )
               CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
          ELSE ! Without wave stretching, use the normal of the SWL
             n_hat = (/0.0_ReKi,0.0_ReKi,1.0_ReKi/)
@@ -6167,10 +6247,11 @@ END SUBROUTINE Morison_CalcOutput
    END SUBROUTINE getMemBallastHiPt
 
 
-   SUBROUTINE GetDistDrag_Rec(p, m, u, xd, Time, mem, i, dSadl_p, dSbdl_p, f_hydro, ErrStat, ErrMsg, SubRatio, vrelFSInt)
+   SUBROUTINE GetDistDrag_Rec(p, m, WaveField_m, u, xd, Time, mem, i, dSadl_p, dSbdl_p, f_hydro, ErrStat, ErrMsg, SubRatio, vrelFSInt)
       ! Compute the distributed (axial and transverse) drag per unit length for rectangular sections
       TYPE(Morison_ParameterType), intent(in   ) :: p            !< Morison parameters
-      Type(Morison_MiscVarType),intent(inout) :: m            !< Miscellaneous variables
+      Type(Morison_MiscVarType),intent(in   ) :: m            !< Miscellaneous variables
+      Type(GridInterp_MiscVarType), intent(inout) :: WaveField_m !< Wave field interpolation misc/optimization variables
       Type(Morison_InputType) , intent(in   ) :: u            !< Morison inputs
       Type(Morison_DiscreteStateType), intent(in   ) :: xd    !< Current discrete state
       Real(DbKi)              , intent(in   ) :: Time         !< Current simulation time in seconds
@@ -6316,7 +6397,7 @@ END SUBROUTINE Morison_CalcOutput
             SVFC  = STV + cross_product( SRV, rToFC(1:3,fNo) )
 
             ! Compute fluid velocity at face center
-            Call WaveField_GetNodeWaveVel( p%WaveField, m%WaveField_m, Time, posFC, .TRUE., .TRUE., tmpNodeInWater, FVFC, ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            Call WaveField_GetNodeWaveVel( p%WaveField, WaveField_m, Time, posFC, .TRUE., .TRUE., tmpNodeInWater, FVFC, ErrStat2, ErrMsg2 ); CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
             ! Note: We force each face center to also be wetted if the center node is wetted. Otherwise, the load-smoothing procedure might not work
 
             ! Compute the face-normal component of the relative fluid velocity (fluid-structure) at face center
@@ -297,6 +297,9 @@ IMPLICIT NONE
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: FV      !< Fluid velocity at line element node at time t, which may not correspond to the WaveTime array of times [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: FA      !< Fluid acceleration at line element node at time t, which may not correspond to the WaveTime array of times [-]
     REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: F_DP      !< Lumped dynamic pressure loads at time t, which may not correspond to the WaveTime array of times [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: F_Nd      !< Member-based total loads lumped onto the member nodes, summed onto the output mesh after all members are processed [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: F_B_End      !< Member-based buoyancy loads on the first and last member end plates, summed onto the joints [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: F_BF_End      !< Member-based flooded ballast loads on the first and last member end plates, summed onto the joints [-]
   END TYPE Morison_MemberLoads
 ! =======================
 ! =========  Morison_CoefMembersCyl  =======
@@ -2632,6 +2635,42 @@ subroutine Morison_CopyMemberLoads(SrcMemberLoadsData, DstMemberLoadsData, CtrlC
       end if
       DstMemberLoadsData%F_DP = SrcMemberLoadsData%F_DP
    end if
+   if (allocated(SrcMemberLoadsData%F_Nd)) then
+      LB(1:2) = lbound(SrcMemberLoadsData%F_Nd)
+      UB(1:2) = ubound(SrcMemberLoadsData%F_Nd)
+      if (.not. allocated(DstMemberLoadsData%F_Nd)) then
+         allocate(DstMemberLoadsData%F_Nd(LB(1):UB(1),LB(2):UB(2)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstMemberLoadsData%F_Nd.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstMemberLoadsData%F_Nd = SrcMemberLoadsData%F_Nd
+   end if
+   if (allocated(SrcMemberLoadsData%F_B_End)) then
+      LB(1:2) = lbound(SrcMemberLoadsData%F_B_End)
+      UB(1:2) = ubound(SrcMemberLoadsData%F_B_End)
+      if (.not. allocated(DstMemberLoadsData%F_B_End)) then
+         allocate(DstMemberLoadsData%F_B_End(LB(1):UB(1),LB(2):UB(2)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstMemberLoadsData%F_B_End.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstMemberLoadsData%F_B_End = SrcMemberLoadsData%F_B_End
+   end if
+   if (allocated(SrcMemberLoadsData%F_BF_End)) then
+      LB(1:2) = lbound(SrcMemberLoadsData%F_BF_End)
+      UB(1:2) = ubound(SrcMemberLoadsData%F_BF_End)
+      if (.not. allocated(DstMemberLoadsData%F_BF_End)) then
+         allocate(DstMemberLoadsData%F_BF_End(LB(1):UB(1),LB(2):UB(2)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstMemberLoadsData%F_BF_End.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstMemberLoadsData%F_BF_End = SrcMemberLoadsData%F_BF_End
+   end if
 end subroutine
 
 subroutine Morison_DestroyMemberLoads(MemberLoadsData, ErrStat, ErrMsg)
@@ -2674,6 +2713,15 @@ subroutine Morison_DestroyMemberLoads(MemberLoadsData, ErrStat, ErrMsg)
    if (allocated(MemberLoadsData%F_DP)) then
       deallocate(MemberLoadsData%F_DP)
    end if
+   if (allocated(MemberLoadsData%F_Nd)) then
+      deallocate(MemberLoadsData%F_Nd)
+   end if
+   if (allocated(MemberLoadsData%F_B_End)) then
+      deallocate(MemberLoadsData%F_B_End)
+   end if
+   if (allocated(MemberLoadsData%F_BF_End)) then
+      deallocate(MemberLoadsData%F_BF_End)
+   end if
 end subroutine
 
 subroutine Morison_PackMemberLoads(RF, Indata)
@@ -2692,6 +2740,9 @@ subroutine Morison_PackMemberLoads(RF, Indata)
    call RegPackAlloc(RF, InData%FV)
    call RegPackAlloc(RF, InData%FA)
    call RegPackAlloc(RF, InData%F_DP)
+   call RegPackAlloc(RF, InData%F_Nd)
+   call RegPackAlloc(RF, InData%F_B_End)
+   call RegPackAlloc(RF, InData%F_BF_End)
    if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
@@ -2714,6 +2765,9 @@ subroutine Morison_UnPackMemberLoads(RF, OutData)
    call RegUnpackAlloc(RF, OutData%FV); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%FA); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%F_DP); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%F_Nd); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%F_B_End); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%F_BF_End); if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
 subroutine Morison_CopyCoefMembersCyl(SrcCoefMembersCylData, DstCoefMembersCylData, CtrlCode, ErrStat, ErrMsg)
@@ -4257,6 +4311,20 @@ subroutine Morison_CopyContState(SrcContStateData, DstContStateData, CtrlCode, E
    DstContStateData%DummyContState = SrcContStateData%DummyContState
 end subroutine
 
+subroutine Morison_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(Morison_ContinuousStateType), intent(inout) :: ContStateData1
+   type(Morison_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyContState
+   character(*), parameter        :: RoutineName = 'Morison_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyContState = ContStateData1%DummyContState
+   ContStateData1%DummyContState = ContStateData2%DummyContState
+   ContStateData2%DummyContState = tmp_DummyContState
+end subroutine
+
 subroutine Morison_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(Morison_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4320,6 +4388,24 @@ subroutine Morison_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, E
    end if
 end subroutine
 
+subroutine Morison_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(Morison_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(Morison_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_V_rel_n_FiltStat(:)
+   REAL(ReKi), allocatable :: tmp_MV_rel_n_FiltStat(:,:)
+   character(*), parameter        :: RoutineName = 'Morison_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(DiscStateData1%V_rel_n_FiltStat, tmp_V_rel_n_FiltStat)
+   call move_alloc(DiscStateData2%V_rel_n_FiltStat, DiscStateData1%V_rel_n_FiltStat)
+   call move_alloc(tmp_V_rel_n_FiltStat, DiscStateData2%V_rel_n_FiltStat)
+   call move_alloc(DiscStateData1%MV_rel_n_FiltStat, tmp_MV_rel_n_FiltStat)
+   call move_alloc(DiscStateData2%MV_rel_n_FiltStat, DiscStateData1%MV_rel_n_FiltStat)
+   call move_alloc(tmp_MV_rel_n_FiltStat, DiscStateData2%MV_rel_n_FiltStat)
+end subroutine
+
 subroutine Morison_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(Morison_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4369,6 +4455,20 @@ subroutine Morison_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlC
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine Morison_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(Morison_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(Morison_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'Morison_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine Morison_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(Morison_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4407,6 +4507,20 @@ subroutine Morison_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode
    DstOtherStateData%DummyOtherState = SrcOtherStateData%DummyOtherState
 end subroutine
 
+subroutine Morison_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(Morison_OtherStateType), intent(inout) :: OtherStateData1
+   type(Morison_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   INTEGER(IntKi) :: tmp_DummyOtherState
+   character(*), parameter        :: RoutineName = 'Morison_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyOtherState = OtherStateData1%DummyOtherState
+   OtherStateData1%DummyOtherState = OtherStateData2%DummyOtherState
+   OtherStateData2%DummyOtherState = tmp_DummyOtherState
+end subroutine
+
 subroutine Morison_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(Morison_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -5426,6 +5540,25 @@ subroutine Morison_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrM
    DstInputData%PtfmRefY = SrcInputData%PtfmRefY
 end subroutine
 
+subroutine Morison_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(Morison_InputType), intent(inout) :: InputData1
+   type(Morison_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_PtfmRefY
+   character(*), parameter        :: RoutineName = 'Morison_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%Mesh, InputData2%Mesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   tmp_PtfmRefY = InputData1%PtfmRefY
+   InputData1%PtfmRefY = InputData2%PtfmRefY
+   InputData2%PtfmRefY = tmp_PtfmRefY
+end subroutine
+
 subroutine Morison_DestroyInput(InputData, ErrStat, ErrMsg)
    type(Morison_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
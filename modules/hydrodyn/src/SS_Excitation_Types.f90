@@ -306,6 +306,20 @@ subroutine SS_Exc_CopyContState(SrcContStateData, DstContStateData, CtrlCode, Er
    end if
 end subroutine
 
+subroutine SS_Exc_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(SS_Exc_ContinuousStateType), intent(inout) :: ContStateData1
+   type(SS_Exc_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki), allocatable :: tmp_x(:)
+   character(*), parameter        :: RoutineName = 'SS_Exc_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%x, tmp_x)
+   call move_alloc(ContStateData2%x, ContStateData1%x)
+   call move_alloc(tmp_x, ContStateData2%x)
+end subroutine
+
 subroutine SS_Exc_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(SS_Exc_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -350,6 +364,20 @@ subroutine SS_Exc_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, Er
    DstDiscStateData%DummyDiscState = SrcDiscStateData%DummyDiscState
 end subroutine
 
+subroutine SS_Exc_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(SS_Exc_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(SS_Exc_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyDiscState
+   character(*), parameter        :: RoutineName = 'SS_Exc_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscState = DiscStateData1%DummyDiscState
+   DiscStateData1%DummyDiscState = DiscStateData2%DummyDiscState
+   DiscStateData2%DummyDiscState = tmp_DummyDiscState
+end subroutine
+
 subroutine SS_Exc_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(SS_Exc_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -388,6 +416,20 @@ subroutine SS_Exc_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCo
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine SS_Exc_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(SS_Exc_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(SS_Exc_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'SS_Exc_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine SS_Exc_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(SS_Exc_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -437,6 +479,31 @@ subroutine SS_Exc_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode,
    end do
 end subroutine
 
+subroutine SS_Exc_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(SS_Exc_OtherStateType), intent(inout) :: OtherStateData1
+   type(SS_Exc_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   INTEGER(IntKi) :: tmp_n
+   character(*), parameter        :: RoutineName = 'SS_Exc_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_n = OtherStateData1%n
+   OtherStateData1%n = OtherStateData2%n
+   OtherStateData2%n = tmp_n
+   LB(1:1) = lbound(OtherStateData1%xdot)
+   UB(1:1) = ubound(OtherStateData1%xdot)
+   do i1 = LB(1), UB(1)
+      call SS_Exc_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      if (ErrStat >= AbortErrLev) return
+   end do
+end subroutine
+
 subroutine SS_Exc_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(SS_Exc_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -717,6 +784,20 @@ subroutine SS_Exc_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMs
    end if
 end subroutine
 
+subroutine SS_Exc_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(SS_Exc_InputType), intent(inout) :: InputData1
+   type(SS_Exc_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_PtfmPos(:,:)
+   character(*), parameter        :: RoutineName = 'SS_Exc_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(InputData1%PtfmPos, tmp_PtfmPos)
+   call move_alloc(InputData2%PtfmPos, InputData1%PtfmPos)
+   call move_alloc(tmp_PtfmPos, InputData2%PtfmPos)
+end subroutine
+
 subroutine SS_Exc_DestroyInput(InputData, ErrStat, ErrMsg)
    type(SS_Exc_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -67,6 +67,7 @@ MODULE WAMIT2
                                                                               !< This holds the name of the program, version info, and date.
 
    REAL(SiKi), PARAMETER, PRIVATE                        :: OnePlusEps  = 1.0 + EPSILON(OnePlusEps)   ! The number slighty greater than unity in the precision of SiKi.
+   INTEGER(B4Ki), PARAMETER, PRIVATE                     :: QTFCacheVer = 1                           ! Version of the QTF force cache file layout (update if the layout or the force calculation changes)
 
 
       ! ..... Public Subroutines ...................................................................................................
@@ -235,6 +236,11 @@ SUBROUTINE WAMIT2_Init( InitInp, p, y, m, ErrStat, ErrMsg )
       REAL(SiKi),    ALLOCATABLE                         :: DiffQTFForce(:,:)      !< DiffQTF force array.    Index 1: Time,  Index 2: force component
       REAL(SiKi),    ALLOCATABLE                         :: SumQTFForce(:,:)       !< SumQTF force array.     Index 1: Time,  Index 2: force component
 
+         ! QTF force cache
+      CHARACTER(1024)                                    :: CacheFile            !< Name of the cache file for the current QTF method ("" when caching is disabled)
+      INTEGER(B8Ki)                                      :: CacheKey(2)          !< Hash of all inputs to the current QTF force calculation
+      LOGICAL                                            :: CacheHit             !< The QTF force was read from the cache file
+
          ! Temporary error trapping variables
       INTEGER(IntKi)                                     :: ErrStatTmp           !< Temporary variable for holding the error status  returned from a CALL statement
       CHARACTER(2048)                                    :: ErrMsgTmp            !< Temporary variable for holding the error message returned from a CALL statement
@@ -552,28 +558,60 @@ SUBROUTINE WAMIT2_Init( InitInp, p, y, m, ErrStat, ErrMsg )
          !> If the DiffQTF method will be used, call the subroutine to calculate the force time series
          !! Note that the MnDrift calculation is included.
       IF ( p%DiffQTFF ) THEN
-            ! Tell our nice users what is about to happen that may take a while:
-         CALL WrScr ( ' Calculating second order difference-frequency force using the full quadratic transfer function.' )
+            ! Look for a previously computed force time series from identical inputs
+         CacheHit = .FALSE.
+         IF ( LEN_TRIM(InitInp%QTFCacheDir) > 0 ) THEN
+            CALL QTFCache_FileName( InitInp, p, 'DiffQTF', DiffQTFData%Data4D, p%DiffQTFDims, CacheFile, CacheKey )
+            CALL QTFCache_Read( CacheFile, CacheKey, InitInp%WaveField%NStepWave, 6*p%NBody, DiffQTFForce, CacheHit )
+         ENDIF
 
-         CALL DiffQTF_InitCalc( InitInp, p, DiffQTFData, DiffQTFForce, ErrMsgTmp, ErrStatTmp )
-         CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, RoutineName )
-         IF ( ErrStat >= AbortErrLev ) THEN
-            CALL CleanUp()
-            RETURN
+         IF ( CacheHit ) THEN
+            CALL WrScr ( ' Read second order difference-frequency force from cache file "'//TRIM(CacheFile)//'".' )
+         ELSE
+               ! Tell our nice users what is about to happen that may take a while:
+            CALL WrScr ( ' Calculating second order difference-frequency force using the full quadratic transfer function.' )
+
+            CALL DiffQTF_InitCalc( InitInp, p, DiffQTFData, DiffQTFForce, ErrMsgTmp, ErrStatTmp )
+            CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, RoutineName )
+            IF ( ErrStat >= AbortErrLev ) THEN
+               CALL CleanUp()
+               RETURN
+            ENDIF
+
+            IF ( LEN_TRIM(InitInp%QTFCacheDir) > 0 ) THEN
+               CALL QTFCache_Write( CacheFile, CacheKey, DiffQTFForce, ErrStatTmp, ErrMsgTmp )
+               CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, RoutineName )
+            ENDIF
          ENDIF
       ENDIF
 
 
          !> If the SumQTF method will be used, call the subroutine to calculate the force time series
       IF ( p%SumQTFF ) THEN
-            ! Tell our nice users what is about to happen that may take a while:
-         CALL WrScr ( ' Calculating second order sum-frequency force using the full quadratic transfer function.' )
+            ! Look for a previously computed force time series from identical inputs
+         CacheHit = .FALSE.
+         IF ( LEN_TRIM(InitInp%QTFCacheDir) > 0 ) THEN
+            CALL QTFCache_FileName( InitInp, p, 'SumQTF', SumQTFData%Data4D, p%SumQTFDims, CacheFile, CacheKey )
+            CALL QTFCache_Read( CacheFile, CacheKey, InitInp%WaveField%NStepWave, 6*p%NBody, SumQTFForce, CacheHit )
+         ENDIF
 
-         CALL SumQTF_InitCalc( InitInp, p, SumQTFData, SumQTFForce, ErrMsgTmp, ErrStatTmp )
-         CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, RoutineName )
-         IF ( ErrStat >= AbortErrLev ) THEN
-            CALL CleanUp()
-            RETURN
+         IF ( CacheHit ) THEN
+            CALL WrScr ( ' Read second order sum-frequency force from cache file "'//TRIM(CacheFile)//'".' )
+         ELSE
+               ! Tell our nice users what is about to happen that may take a while:
+            CALL WrScr ( ' Calculating second order sum-frequency force using the full quadratic transfer function.' )
+
+            CALL SumQTF_InitCalc( InitInp, p, SumQTFData, SumQTFForce, ErrMsgTmp, ErrStatTmp )
+            CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, RoutineName )
+            IF ( ErrStat >= AbortErrLev ) THEN
+               CALL CleanUp()
+               RETURN
+            ENDIF
+
+            IF ( LEN_TRIM(InitInp%QTFCacheDir) > 0 ) THEN
+               CALL QTFCache_Write( CacheFile, CacheKey, SumQTFForce, ErrStatTmp, ErrMsgTmp )
+               CALL SetErrStat( ErrStatTmp, ErrMsgTmp, ErrStat, ErrMsg, RoutineName )
+            ENDIF
          ENDIF
       ENDIF
 
@@ -737,6 +775,165 @@ SUBROUTINE WAMIT2_Init( InitInp, p, y, m, ErrStat, ErrMsg )
 END SUBROUTINE WAMIT2_Init
 
 
+   !-------------------------------------------------------------------------------------------------------------------------------
+   !> This subroutine builds the name of the cache file for the full difference- or sum-QTF force time series.  The name contains
+   !! a 64-bit key hashed from everything the force calculation depends on: the QTF data read from the WAMIT file, the complex
+   !! wave amplitudes and directions of the incident wave (which covers the wave spectrum, seed, and frequency discretization),
+   !! the frequency cutoffs, the water depth and gravity, and the body reference positions.  The key is also stored in the file
+   !! header so that a stale or mismatched file is never used.
+   SUBROUTINE QTFCache_FileName( InitInp, p, MethodName, Data4D, Dims, FileName, Key )
+
+      TYPE(WAMIT2_InitInputType),         INTENT(IN   )  :: InitInp              !< Input data for initialization routine
+      TYPE(WAMIT2_ParameterType),         INTENT(IN   )  :: p                    !< Parameters
+      CHARACTER(*),                       INTENT(IN   )  :: MethodName           !< Name of the QTF method ('DiffQTF' or 'SumQTF')
+      TYPE(W2_InitData4D_Type),           INTENT(IN   )  :: Data4D               !< The QTF data read from the WAMIT file
+      LOGICAL,                            INTENT(IN   )  :: Dims(6)              !< Flags for which dimensions are calculated
+      CHARACTER(*),                       INTENT(  OUT)  :: FileName             !< Name of the cache file
+      INTEGER(B8Ki),                      INTENT(  OUT)  :: Key(2)               !< Two independent 32-bit hashes of the inputs
+
+      CHARACTER(16)                                      :: KeyStr               !< Key in hexadecimal
+      INTEGER(IntKi)                                     :: I                    !< Generic counter
+
+         ! FNV-1a offset bases
+      Key(1) = 2166136261_B8Ki
+      Key(2) = 3735928559_B8Ki
+
+      CALL QTFCache_Hash( Key, [ QTFCacheVer, ( INT(ICHAR(MethodName(I:I)),B4Ki), I=1,LEN(MethodName) ) ] )
+
+         ! QTF data from the WAMIT file
+      CALL QTFCache_Hash( Key, [ INT(Data4D%NumWvFreq1,B4Ki), INT(Data4D%NumWvFreq2,B4Ki), INT(Data4D%NumWvDir1,B4Ki), &
+                                 INT(Data4D%NumWvDir2,B4Ki), INT(Data4D%NumBodies,B4Ki) ] )
+      CALL QTFCache_Hash( Key, TRANSFER( Data4D%WvFreq1, [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, TRANSFER( Data4D%WvFreq2, [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, TRANSFER( Data4D%WvDir1,  [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, TRANSFER( Data4D%WvDir2,  [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, MERGE( 1_B4Ki, 0_B4Ki, Data4D%LoadComponents ) )
+      CALL QTFCache_Hash( Key, TRANSFER( Data4D%DataSet, [0_B4Ki] ) )
+
+         ! Incident wave
+      CALL QTFCache_Hash( Key, [ INT(InitInp%WaveField%NStepWave,B4Ki), INT(InitInp%WaveField%NStepWave2,B4Ki) ] )
+      CALL QTFCache_Hash( Key, TRANSFER( [ InitInp%WaveField%WaveDOmega, InitInp%WaveField%WvLowCOffD, InitInp%WaveField%WvHiCOffD,  &
+                                           InitInp%WaveField%WvLowCOffS, InitInp%WaveField%WvHiCOffS ], [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, TRANSFER( InitInp%WaveField%EffWtrDpth, [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, TRANSFER( InitInp%WaveField%WaveElevC0, [0_B4Ki] ) )
+      IF ( ALLOCATED( InitInp%WaveField%WaveDirArr ) ) CALL QTFCache_Hash( Key, TRANSFER( InitInp%WaveField%WaveDirArr, [0_B4Ki] ) )
+
+         ! Bodies and environment
+      CALL QTFCache_Hash( Key, [ INT(p%NBody,B4Ki), INT(p%NBodyMod,B4Ki), MERGE( 1_B4Ki, 0_B4Ki, Dims ), MERGE( 1_B4Ki, 0_B4Ki, p%MnDriftDims ) ] )
+      CALL QTFCache_Hash( Key, TRANSFER( InitInp%Gravity,      [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, TRANSFER( InitInp%PtfmRefY,     [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, TRANSFER( InitInp%PtfmRefxt,    [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, TRANSFER( InitInp%PtfmRefyt,    [0_B4Ki] ) )
+      CALL QTFCache_Hash( Key, TRANSFER( InitInp%PtfmRefztRot, [0_B4Ki] ) )
+
+      WRITE( KeyStr, '(Z8.8,Z8.8)' ) Key(1), Key(2)
+      FileName = TRIM(InitInp%QTFCacheDir)
+      IF ( LEN_TRIM(FileName) > 0 ) THEN
+         IF ( FileName(LEN_TRIM(FileName):LEN_TRIM(FileName)) /= PathSep ) FileName = TRIM(FileName)//PathSep
+      ENDIF
+      FileName = TRIM(FileName)//MethodName//'_'//KeyStr//'.bin'
+
+   END SUBROUTINE QTFCache_FileName
+
+
+   !-------------------------------------------------------------------------------------------------------------------------------
+   !> This subroutine adds an array of 32-bit words to a pair of 32-bit hashes (FNV-1a and a multiplicative hash), held in 64-bit
+   !! integers so that no intermediate product overflows.
+   SUBROUTINE QTFCache_Hash( Key, Words )
+
+      INTEGER(B8Ki),                      INTENT(INOUT)  :: Key(2)               !< Two independent 32-bit hashes
+      INTEGER(B4Ki),                      INTENT(IN   )  :: Words(:)             !< Data to add to the hashes
+
+      INTEGER(B8Ki), PARAMETER                           :: Mask32 = 4294967295_B8Ki
+      INTEGER(B8Ki)                                      :: W                    !< Current word as an unsigned 32-bit value
+      INTEGER(IntKi)                                     :: I                    !< Generic counter
+
+      DO I = 1,SIZE(Words)
+         W      = IAND( INT(Words(I),B8Ki), Mask32 )
+         Key(1) = IAND( IEOR( Key(1), W ) * 16777619_B8Ki, Mask32 )
+         Key(2) = IAND( IAND( Key(2) + W, Mask32 ) * 1099087573_B8Ki, Mask32 )
+         Key(2) = IEOR( Key(2), ISHFT( Key(2), -15 ) )
+      ENDDO
+
+   END SUBROUTINE QTFCache_Hash
+
+
+   !-------------------------------------------------------------------------------------------------------------------------------
+   !> This subroutine reads a QTF force time series from the cache file, if it exists and its header matches the expected key
+   !! and dimensions.  Any problem reading the file is treated as a cache miss.
+   SUBROUTINE QTFCache_Read( FileName, Key, NStepWave, NLoads, Force, Found )
+
+      CHARACTER(*),                       INTENT(IN   )  :: FileName             !< Name of the cache file
+      INTEGER(B8Ki),                      INTENT(IN   )  :: Key(2)               !< Expected key
+      INTEGER(IntKi),                     INTENT(IN   )  :: NStepWave            !< Number of wave time steps
+      INTEGER(IntKi),                     INTENT(IN   )  :: NLoads               !< Number of load components
+      REAL(SiKi),  ALLOCATABLE,           INTENT(INOUT)  :: Force(:,:)           !< Force data.  Index 1 is the timestep, index 2 is the load component.
+      LOGICAL,                            INTENT(  OUT)  :: Found                !< The force was read from the cache file
+
+      INTEGER(IntKi)                                     :: Un                   !< Unit number of the cache file
+      INTEGER(IntKi)                                     :: IOS                  !< I/O status
+      INTEGER(B4Ki)                                      :: FileVer              !< Version in the file header
+      INTEGER(B8Ki)                                      :: FileKey(2)           !< Key in the file header
+      INTEGER(B4Ki)                                      :: FileDims(2)          !< Dimensions in the file header
+      INTEGER(IntKi)                                     :: ErrStatTmp
+      CHARACTER(ErrMsgLen)                               :: ErrMsgTmp
+      LOGICAL                                            :: Exists
+
+      Found = .FALSE.
+      INQUIRE( FILE=TRIM(FileName), EXIST=Exists )
+      IF ( .NOT. Exists ) RETURN
+
+      CALL GetNewUnit( Un, ErrStatTmp, ErrMsgTmp )
+      OPEN( Un, FILE=TRIM(FileName), STATUS='OLD', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='READ', IOSTAT=IOS )
+      IF ( IOS /= 0 ) RETURN
+
+      READ( Un, IOSTAT=IOS ) FileVer, FileKey, FileDims
+      IF ( IOS == 0 .AND. FileVer == QTFCacheVer .AND. ALL( FileKey == Key ) .AND. FileDims(1) == NStepWave .AND. FileDims(2) == NLoads ) THEN
+         IF ( ALLOCATED(Force) ) DEALLOCATE(Force)
+         ALLOCATE( Force( 0:NStepWave, NLoads ), STAT=IOS )
+         IF ( IOS == 0 ) THEN
+            READ( Un, IOSTAT=IOS ) Force
+            Found = IOS == 0
+            IF ( .NOT. Found ) DEALLOCATE(Force)
+         ENDIF
+      ENDIF
+
+      CLOSE( Un )
+
+   END SUBROUTINE QTFCache_Read
+
+
+   !-------------------------------------------------------------------------------------------------------------------------------
+   !> This subroutine writes a QTF force time series to the cache file.  Failure to write the file only results in a warning.
+   SUBROUTINE QTFCache_Write( FileName, Key, Force, ErrStat, ErrMsg )
+
+      CHARACTER(*),                       INTENT(IN   )  :: FileName             !< Name of the cache file
+      INTEGER(B8Ki),                      INTENT(IN   )  :: Key(2)               !< Key of the inputs to the force calculation
+      REAL(SiKi),                         INTENT(IN   )  :: Force(0:,:)          !< Force data.  Index 1 is the timestep, index 2 is the load component.
+      INTEGER(IntKi),                     INTENT(  OUT)  :: ErrStat              !< Error status of the operation
+      CHARACTER(*),                       INTENT(  OUT)  :: ErrMsg               !< Error message if ErrStat /= ErrID_None
+
+      INTEGER(IntKi)                                     :: Un                   !< Unit number of the cache file
+      INTEGER(IntKi)                                     :: IOS                  !< I/O status
+
+      ErrStat = ErrID_None
+      ErrMsg  = ""
+
+      CALL GetNewUnit( Un, ErrStat, ErrMsg )
+      OPEN( Un, FILE=TRIM(FileName), STATUS='REPLACE', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='WRITE', IOSTAT=IOS )
+      IF ( IOS == 0 ) THEN
+         WRITE( Un, IOSTAT=IOS ) QTFCacheVer, Key, INT(UBOUND(Force,1),B4Ki), INT(SIZE(Force,2),B4Ki), Force
+         CLOSE( Un )
+      ENDIF
+
+      IF ( IOS /= 0 ) THEN
+         ErrStat = ErrID_Warn
+         ErrMsg  = ' Could not write the QTF force cache file "'//TRIM(FileName)//'".'
+      ENDIF
+
+   END SUBROUTINE QTFCache_Write
+
+
    !-------------------------------------------------------------------------------------------------------------------------------
    !> This subroutine calculates the force time series using the MnDrift calculation.
    !! The data is stored in either 3D or 4D arrays depending on the file type used.
@@ -1868,7 +2065,12 @@ END SUBROUTINE WAMIT2_Init
                   ! To make things run slightly quicker, copy the data we will be interpolating over into the temporary arrays
                TmpData4D = DiffQTFData%Data4D%DataSet(:,:,:,:,Idx)
 
-                  ! Outer loop to create the TmpComplexArr
+                  ! Outer loop to create the TmpComplexArr.  Each difference frequency is independent of the others, so the rows
+                  ! are distributed over the threads (dynamic schedule since the inner sum is over a triangular area).
+               !$OMP PARALLEL DO DEFAULT(SHARED) SCHEDULE(DYNAMIC) &
+               !$OMP PRIVATE(K, OmegaDiff, TmpHMinusC, Omega1, Omega2, aWaveElevC1, aWaveElevC2, Coord4, dirInRange, tmpDir, QTF_Value, &
+               !$OMP         WaveNmbr1, WaveNmbr2, TmpReal1, TmpReal2, PhaseShiftXY, ErrStatTmp, ErrMsgTmp) &
+               !$OMP FIRSTPRIVATE(LastIndex4)
                DO J=1,InitInp%WaveField%NStepWave2-1
 
                      ! Calculate the frequency  -- This is the difference frequency.
@@ -1904,16 +2106,18 @@ END SUBROUTINE WAMIT2_Init
                         dirInRange = GetAngleInRange(Coord4(3),W2WvDir1Range(1),W2WvDir1Range(2),tmpDir); Coord4(3) = tmpDir
                         dirInRange = GetAngleInRange(Coord4(4),W2WvDir2Range(1),W2WvDir2Range(2),tmpDir); Coord4(4) = tmpDir
                         IF (.NOT. dirInRange) THEN ! Somewhat redundant check. Can be removed in the future.
+                           !$OMP CRITICAL(DiffQTF_ErrStat)  ! Needed to avoid data race on ErrStat and ErrMsg
                            CALL SetErrStat(ErrID_Fatal,' Wave heading out of range.', ErrStat, ErrMsg, RoutineName)
+                           !$OMP END CRITICAL(DiffQTF_ErrStat)
                         END IF
 
                            ! get the interpolated value for F(omega1,omega2,beta1,beta2)  --> QTF_Value
                         CALL WAMIT_Interp4D_Cplx( Coord4, TmpData4D, DiffQTFData%Data4D%WvFreq1, DiffQTFData%Data4D%WvFreq2, &
                                              DiffQTFData%Data4D%WvDir1, DiffQTFData%Data4D%WvDir2, LastIndex4, QTF_Value, ErrStatTmp, ErrMsgTmp )
-                        CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,RoutineName)
-                        IF (ErrStat >= AbortErrLev ) THEN
-                           call cleanup()
-                           RETURN
+                        IF (ErrStatTmp /= ErrID_None) THEN  ! we cannot leave the parallel loop, so errors are checked after it
+                           !$OMP CRITICAL(DiffQTF_ErrStat)
+                           CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,RoutineName)
+                           !$OMP END CRITICAL(DiffQTF_ErrStat)
                         ENDIF
 
                         !--------------------------
@@ -1957,6 +2161,12 @@ END SUBROUTINE WAMIT2_Init
 
 
                ENDDO
+               !$OMP END PARALLEL DO
+
+               IF (ErrStat >= AbortErrLev ) THEN
+                  call cleanup()
+                  RETURN
+               ENDIF
             ENDIF    ! Load component to calculate
          ENDDO ! ThisDim -- The current dimension
 
@@ -2288,6 +2498,10 @@ END SUBROUTINE WAMIT2_Init
                   ! The limits look a little funny.  But remember we are placing the value in the 2*J location,
                   ! so we cannot overun the end of the array, and the highest frequency must be zero.  The
                   ! floor function is just in case (NStepWave2 - 1) is an odd number
+               !$OMP PARALLEL DO DEFAULT(SHARED) &
+               !$OMP PRIVATE(Omega1, OmegaSum, aWaveElevC1, Coord4, dirInRange, tmpDir, QTF_Value, WaveNmbr1, TmpReal1, PhaseShiftXY, &
+               !$OMP         ErrStatTmp, ErrMsgTmp) &
+               !$OMP FIRSTPRIVATE(LastIndex4)
                DO J=1,FLOOR(REAL(InitInp%WaveField%NStepWave2-1)/2.0_SiKi)
 
                      ! The frequency
@@ -2312,16 +2526,18 @@ END SUBROUTINE WAMIT2_Init
                      dirInRange = GetAngleInRange(Coord4(3),W2WvDir1Range(1),W2WvDir1Range(2),tmpDir); Coord4(3) = tmpDir
                      dirInRange = GetAngleInRange(Coord4(4),W2WvDir2Range(1),W2WvDir2Range(2),tmpDir); Coord4(4) = tmpDir
                      IF (.NOT. dirInRange) THEN ! Somewhat redundant check. Can be removed in the future.
+                        !$OMP CRITICAL(SumQTF_ErrStat)  ! Needed to avoid data race on ErrStat and ErrMsg
                         CALL SetErrStat(ErrID_Fatal,' Wave heading out of range.', ErrStat, ErrMsg, RoutineName)
+                        !$OMP END CRITICAL(SumQTF_ErrStat)
                      END IF
 
                         ! get the interpolated value for F(omega1,omega2,beta1,beta2)  --> QTF_Value
                      CALL WAMIT_Interp4D_Cplx( Coord4, TmpData4D, SumQTFData%Data4D%WvFreq1, SumQTFData%Data4D%WvFreq2, &
                                           SumQTFData%Data4D%WvDir1, SumQTFData%Data4D%WvDir2, LastIndex4, QTF_Value, ErrStatTmp, ErrMsgTmp )
-                     CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,RoutineName)
-                     IF (ErrStat >= AbortErrLev ) THEN
-                        IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
-                        RETURN
+                     IF (ErrStatTmp /= ErrID_None) THEN  ! we cannot leave the parallel loop, so errors are checked after it
+                        !$OMP CRITICAL(SumQTF_ErrStat)
+                        CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,RoutineName)
+                        !$OMP END CRITICAL(SumQTF_ErrStat)
                      ENDIF
 
                      !--------------------------
@@ -2353,6 +2569,12 @@ END SUBROUTINE WAMIT2_Init
 
                   ENDIF    ! Check on the limits
                ENDDO       ! First term calculation
+               !$OMP END PARALLEL DO
+
+               IF (ErrStat >= AbortErrLev ) THEN
+                  IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
+                  RETURN
+               ENDIF
 
 
                !---------------------------------------------------------------------------------
@@ -2390,7 +2612,13 @@ END SUBROUTINE WAMIT2_Init
 
 
 
-                  ! Outer loop to create the Term2ArrayC. This is stepwise through the sum frequencies.
+                  ! Outer loop to create the Term2ArrayC. This is stepwise through the sum frequencies.  Each sum frequency is
+                  ! independent of the others, so the rows are distributed over the threads (dynamic schedule since the inner
+                  ! sum gets longer with the sum frequency).
+               !$OMP PARALLEL DO DEFAULT(SHARED) SCHEDULE(DYNAMIC) &
+               !$OMP PRIVATE(K, OmegaSum, TmpHPlusC, Omega1, Omega2, aWaveElevC1, aWaveElevC2, Coord4, dirInRange, tmpDir, QTF_Value, &
+               !$OMP         WaveNmbr1, WaveNmbr2, TmpReal1, TmpReal2, PhaseShiftXY, ErrStatTmp, ErrMsgTmp) &
+               !$OMP FIRSTPRIVATE(LastIndex4)
                DO J=1,InitInp%WaveField%NStepWave2
 
                      ! Calculate the frequency  -- This is the sum frequency.
@@ -2433,16 +2661,18 @@ END SUBROUTINE WAMIT2_Init
                         dirInRange = GetAngleInRange(Coord4(3),W2WvDir1Range(1),W2WvDir1Range(2),tmpDir); Coord4(3) = tmpDir
                         dirInRange = GetAngleInRange(Coord4(4),W2WvDir2Range(1),W2WvDir2Range(2),tmpDir); Coord4(4) = tmpDir
                         IF (.NOT. dirInRange) THEN ! Somewhat redundant check. Can be removed in the future.
+                           !$OMP CRITICAL(SumQTF_ErrStat)  ! Needed to avoid data race on ErrStat and ErrMsg
                            CALL SetErrStat(ErrID_Fatal,' Wave heading out of range.', ErrStat, ErrMsg, RoutineName)
+                           !$OMP END CRITICAL(SumQTF_ErrStat)
                         END IF
 
                            ! get the interpolated value for F(omega1,omega2,beta1,beta2)  --> QTF_Value
                         CALL WAMIT_Interp4D_Cplx( Coord4, TmpData4D, SumQTFData%Data4D%WvFreq1, SumQTFData%Data4D%WvFreq2, &
                                              SumQTFData%Data4D%WvDir1, SumQTFData%Data4D%WvDir2, LastIndex4, QTF_Value, ErrStatTmp, ErrMsgTmp )
-                        CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,RoutineName)
-                        IF (ErrStat >= AbortErrLev ) THEN
-                           IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
-                           RETURN
+                        IF (ErrStatTmp /= ErrID_None) THEN  ! we cannot leave the parallel loop, so errors are checked after it
+                           !$OMP CRITICAL(SumQTF_ErrStat)
+                           CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,RoutineName)
+                           !$OMP END CRITICAL(SumQTF_ErrStat)
                         ENDIF
 
                         !--------------------------
@@ -2479,6 +2709,12 @@ END SUBROUTINE WAMIT2_Init
                   ENDIF    ! Check on the limits
 
                ENDDO       ! Second term calculation -- frequency step on the sum frequency
+               !$OMP END PARALLEL DO
+
+               IF (ErrStat >= AbortErrLev ) THEN
+                  IF (ALLOCATED(TmpData4D))        DEALLOCATE(TmpData4D,STAT=ErrStatTmp)
+                  RETURN
+               ENDIF
             ENDIF    ! Load component to calculate
          ENDDO ! ThisDim -- current dimension
 
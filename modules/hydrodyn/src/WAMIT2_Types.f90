@@ -59,6 +59,7 @@ IMPLICIT NONE
     LOGICAL  :: NewmanAppF = .false.      !< Flag indicating Newman approximation should be calculated [-]
     LOGICAL  :: DiffQTFF = .false.      !< Flag indicating the full difference QTF should be calculated [-]
     LOGICAL  :: SumQTFF = .false.      !< Flag indicating the full    sum     QTF should be calculated [-]
+    CHARACTER(1024)  :: QTFCacheDir      !< Directory in which the full difference- and sum-QTF force time series are cached between runs (empty to disable caching) [-]
   END TYPE WAMIT2_InitInputType
 ! =======================
 ! =========  WAMIT2_MiscVarType  =======
@@ -173,6 +174,7 @@ subroutine WAMIT2_CopyInitInput(SrcInitInputData, DstInitInputData, CtrlCode, Er
    DstInitInputData%NewmanAppF = SrcInitInputData%NewmanAppF
    DstInitInputData%DiffQTFF = SrcInitInputData%DiffQTFF
    DstInitInputData%SumQTFF = SrcInitInputData%SumQTFF
+   DstInitInputData%QTFCacheDir = SrcInitInputData%QTFCacheDir
 end subroutine
 
 subroutine WAMIT2_DestroyInitInput(InitInputData, ErrStat, ErrMsg)
@@ -233,6 +235,7 @@ subroutine WAMIT2_PackInitInput(RF, Indata)
    call RegPack(RF, InData%NewmanAppF)
    call RegPack(RF, InData%DiffQTFF)
    call RegPack(RF, InData%SumQTFF)
+   call RegPack(RF, InData%QTFCacheDir)
    if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
@@ -285,6 +288,7 @@ subroutine WAMIT2_UnPackInitInput(RF, OutData)
    call RegUnpack(RF, OutData%NewmanAppF); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%DiffQTFF); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%SumQTFF); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%QTFCacheDir); if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
 subroutine WAMIT2_CopyMisc(SrcMiscData, DstMiscData, CtrlCode, ErrStat, ErrMsg)
@@ -452,6 +452,27 @@ subroutine WAMIT_CopyContState(SrcContStateData, DstContStateData, CtrlCode, Err
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine WAMIT_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(WAMIT_ContinuousStateType), intent(inout) :: ContStateData1
+   type(WAMIT_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'WAMIT_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call SS_Rad_SwapContState(ContStateData1%SS_Rdtn, ContStateData2%SS_Rdtn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call SS_Exc_SwapContState(ContStateData1%SS_Exctn, ContStateData2%SS_Exctn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call Conv_Rdtn_SwapContState(ContStateData1%Conv_Rdtn, ContStateData2%Conv_Rdtn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine WAMIT_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(WAMIT_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -525,6 +546,31 @@ subroutine WAMIT_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, Err
    end if
 end subroutine
 
+subroutine WAMIT_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(WAMIT_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(WAMIT_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_BdyPosFilt(:,:,:)
+   character(*), parameter        :: RoutineName = 'WAMIT_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call Conv_Rdtn_SwapDiscState(DiscStateData1%Conv_Rdtn, DiscStateData2%Conv_Rdtn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call SS_Rad_SwapDiscState(DiscStateData1%SS_Rdtn, DiscStateData2%SS_Rdtn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call SS_Exc_SwapDiscState(DiscStateData1%SS_Exctn, DiscStateData2%SS_Exctn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call move_alloc(DiscStateData1%BdyPosFilt, tmp_BdyPosFilt)
+   call move_alloc(DiscStateData2%BdyPosFilt, DiscStateData1%BdyPosFilt)
+   call move_alloc(tmp_BdyPosFilt, DiscStateData2%BdyPosFilt)
+end subroutine
+
 subroutine WAMIT_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(WAMIT_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -593,6 +639,27 @@ subroutine WAMIT_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCod
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine WAMIT_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(WAMIT_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(WAMIT_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'WAMIT_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call Conv_Rdtn_SwapConstrState(ConstrStateData1%Conv_Rdtn, ConstrStateData2%Conv_Rdtn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call SS_Rad_SwapConstrState(ConstrStateData1%SS_Rdtn, ConstrStateData2%SS_Rdtn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call SS_Exc_SwapConstrState(ConstrStateData1%SS_Exctn, ConstrStateData2%SS_Exctn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine WAMIT_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(WAMIT_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -653,6 +720,27 @@ subroutine WAMIT_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode,
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine WAMIT_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(WAMIT_OtherStateType), intent(inout) :: OtherStateData1
+   type(WAMIT_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'WAMIT_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call SS_Rad_SwapOtherState(OtherStateData1%SS_Rdtn, OtherStateData2%SS_Rdtn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call SS_Exc_SwapOtherState(OtherStateData1%SS_Exctn, OtherStateData2%SS_Exctn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call Conv_Rdtn_SwapOtherState(OtherStateData1%Conv_Rdtn, OtherStateData2%Conv_Rdtn, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine WAMIT_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(WAMIT_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1185,6 +1273,37 @@ subroutine WAMIT_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg
    end if
 end subroutine
 
+subroutine WAMIT_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(WAMIT_InputType), intent(inout) :: InputData1
+   type(WAMIT_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_PtfmRefY
+   REAL(ReKi), allocatable :: tmp_qAddDOF(:)
+   REAL(ReKi), allocatable :: tmp_qAddDOFDot(:)
+   REAL(ReKi), allocatable :: tmp_qAddDOFDotDot(:)
+   character(*), parameter        :: RoutineName = 'WAMIT_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%Mesh, InputData2%Mesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   tmp_PtfmRefY = InputData1%PtfmRefY
+   InputData1%PtfmRefY = InputData2%PtfmRefY
+   InputData2%PtfmRefY = tmp_PtfmRefY
+   call move_alloc(InputData1%qAddDOF, tmp_qAddDOF)
+   call move_alloc(InputData2%qAddDOF, InputData1%qAddDOF)
+   call move_alloc(tmp_qAddDOF, InputData2%qAddDOF)
+   call move_alloc(InputData1%qAddDOFDot, tmp_qAddDOFDot)
+   call move_alloc(InputData2%qAddDOFDot, InputData1%qAddDOFDot)
+   call move_alloc(tmp_qAddDOFDot, InputData2%qAddDOFDot)
+   call move_alloc(InputData1%qAddDOFDotDot, tmp_qAddDOFDotDot)
+   call move_alloc(InputData2%qAddDOFDotDot, InputData1%qAddDOFDotDot)
+   call move_alloc(tmp_qAddDOFDotDot, InputData2%qAddDOFDotDot)
+end subroutine
+
 subroutine WAMIT_DestroyInput(InputData, ErrStat, ErrMsg)
    type(WAMIT_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -663,6 +663,24 @@ subroutine IceD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrS
    DstContStateData%dqdt = SrcContStateData%dqdt
 end subroutine
 
+subroutine IceD_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(IceD_ContinuousStateType), intent(inout) :: ContStateData1
+   type(IceD_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_q
+   REAL(ReKi) :: tmp_dqdt
+   character(*), parameter        :: RoutineName = 'IceD_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_q = ContStateData1%q
+   ContStateData1%q = ContStateData2%q
+   ContStateData2%q = tmp_q
+   tmp_dqdt = ContStateData1%dqdt
+   ContStateData1%dqdt = ContStateData2%dqdt
+   ContStateData2%dqdt = tmp_dqdt
+end subroutine
+
 subroutine IceD_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(IceD_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -703,6 +721,20 @@ subroutine IceD_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrS
    DstDiscStateData%DummyDiscState = SrcDiscStateData%DummyDiscState
 end subroutine
 
+subroutine IceD_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(IceD_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(IceD_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyDiscState
+   character(*), parameter        :: RoutineName = 'IceD_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscState = DiscStateData1%DummyDiscState
+   DiscStateData1%DummyDiscState = DiscStateData2%DummyDiscState
+   DiscStateData2%DummyDiscState = tmp_DummyDiscState
+end subroutine
+
 subroutine IceD_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(IceD_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -741,6 +773,20 @@ subroutine IceD_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine IceD_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(IceD_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(IceD_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'IceD_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine IceD_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(IceD_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -840,6 +886,73 @@ subroutine IceD_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, E
    DstOtherStateData%n = SrcOtherStateData%n
 end subroutine
 
+subroutine IceD_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(IceD_OtherStateType), intent(inout) :: OtherStateData1
+   type(IceD_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   INTEGER(IntKi) :: tmp_IceTthNo2
+   INTEGER(IntKi), allocatable :: tmp_Nc(:)
+   REAL(ReKi), allocatable :: tmp_Psum(:)
+   INTEGER(IntKi), allocatable :: tmp_IceTthNo(:)
+   REAL(ReKi) :: tmp_Beta
+   REAL(DbKi) :: tmp_Tinit
+   INTEGER(IntKi) :: tmp_Splitf
+   REAL(ReKi) :: tmp_dxc
+   INTEGER(IntKi) :: tmp_n
+   character(*), parameter        :: RoutineName = 'IceD_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_IceTthNo2 = OtherStateData1%IceTthNo2
+   OtherStateData1%IceTthNo2 = OtherStateData2%IceTthNo2
+   OtherStateData2%IceTthNo2 = tmp_IceTthNo2
+   call move_alloc(OtherStateData1%Nc, tmp_Nc)
+   call move_alloc(OtherStateData2%Nc, OtherStateData1%Nc)
+   call move_alloc(tmp_Nc, OtherStateData2%Nc)
+   call move_alloc(OtherStateData1%Psum, tmp_Psum)
+   call move_alloc(OtherStateData2%Psum, OtherStateData1%Psum)
+   call move_alloc(tmp_Psum, OtherStateData2%Psum)
+   call move_alloc(OtherStateData1%IceTthNo, tmp_IceTthNo)
+   call move_alloc(OtherStateData2%IceTthNo, OtherStateData1%IceTthNo)
+   call move_alloc(tmp_IceTthNo, OtherStateData2%IceTthNo)
+   tmp_Beta = OtherStateData1%Beta
+   OtherStateData1%Beta = OtherStateData2%Beta
+   OtherStateData2%Beta = tmp_Beta
+   tmp_Tinit = OtherStateData1%Tinit
+   OtherStateData1%Tinit = OtherStateData2%Tinit
+   OtherStateData2%Tinit = tmp_Tinit
+   tmp_Splitf = OtherStateData1%Splitf
+   OtherStateData1%Splitf = OtherStateData2%Splitf
+   OtherStateData2%Splitf = tmp_Splitf
+   tmp_dxc = OtherStateData1%dxc
+   OtherStateData1%dxc = OtherStateData2%dxc
+   OtherStateData2%dxc = tmp_dxc
+   if (allocated(OtherStateData1%xdot) .neqv. allocated(OtherStateData2%xdot)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%xdot with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%xdot)) then
+      if (any(lbound(OtherStateData1%xdot) /= lbound(OtherStateData2%xdot)) .or. any(ubound(OtherStateData1%xdot) /= ubound(OtherStateData2%xdot))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%xdot with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%xdot)
+      UB(1:1) = ubound(OtherStateData1%xdot)
+      do i1 = LB(1), UB(1)
+         call IceD_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   tmp_n = OtherStateData1%n
+   OtherStateData1%n = OtherStateData2%n
+   OtherStateData2%n = tmp_n
+end subroutine
+
 subroutine IceD_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(IceD_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1302,6 +1415,21 @@ subroutine IceD_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine IceD_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(IceD_InputType), intent(inout) :: InputData1
+   type(IceD_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'IceD_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%PointMesh, InputData2%PointMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine IceD_DestroyInput(InputData, ErrStat, ErrMsg)
    type(IceD_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
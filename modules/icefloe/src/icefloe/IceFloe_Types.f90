@@ -274,6 +274,20 @@ subroutine IceFloe_CopyContState(SrcContStateData, DstContStateData, CtrlCode, E
    DstContStateData%DummyContStateVar = SrcContStateData%DummyContStateVar
 end subroutine
 
+subroutine IceFloe_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(IceFloe_ContinuousStateType), intent(inout) :: ContStateData1
+   type(IceFloe_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyContStateVar
+   character(*), parameter        :: RoutineName = 'IceFloe_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyContStateVar = ContStateData1%DummyContStateVar
+   ContStateData1%DummyContStateVar = ContStateData2%DummyContStateVar
+   ContStateData2%DummyContStateVar = tmp_DummyContStateVar
+end subroutine
+
 subroutine IceFloe_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(IceFloe_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -312,6 +326,20 @@ subroutine IceFloe_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, E
    DstDiscStateData%DummyDiscStateVar = SrcDiscStateData%DummyDiscStateVar
 end subroutine
 
+subroutine IceFloe_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(IceFloe_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(IceFloe_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyDiscStateVar
+   character(*), parameter        :: RoutineName = 'IceFloe_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscStateVar = DiscStateData1%DummyDiscStateVar
+   DiscStateData1%DummyDiscStateVar = DiscStateData2%DummyDiscStateVar
+   DiscStateData2%DummyDiscStateVar = tmp_DummyDiscStateVar
+end subroutine
+
 subroutine IceFloe_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(IceFloe_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -350,6 +378,20 @@ subroutine IceFloe_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlC
    DstConstrStateData%DummyConstrStateVar = SrcConstrStateData%DummyConstrStateVar
 end subroutine
 
+subroutine IceFloe_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(IceFloe_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(IceFloe_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyConstrStateVar
+   character(*), parameter        :: RoutineName = 'IceFloe_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrStateVar = ConstrStateData1%DummyConstrStateVar
+   ConstrStateData1%DummyConstrStateVar = ConstrStateData2%DummyConstrStateVar
+   ConstrStateData2%DummyConstrStateVar = tmp_DummyConstrStateVar
+end subroutine
+
 subroutine IceFloe_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(IceFloe_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -388,6 +430,20 @@ subroutine IceFloe_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode
    DstOtherStateData%DummyOtherState = SrcOtherStateData%DummyOtherState
 end subroutine
 
+subroutine IceFloe_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(IceFloe_OtherStateType), intent(inout) :: OtherStateData1
+   type(IceFloe_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   INTEGER(IntKi) :: tmp_DummyOtherState
+   character(*), parameter        :: RoutineName = 'IceFloe_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyOtherState = OtherStateData1%DummyOtherState
+   OtherStateData1%DummyOtherState = OtherStateData2%DummyOtherState
+   OtherStateData2%DummyOtherState = tmp_DummyOtherState
+end subroutine
+
 subroutine IceFloe_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(IceFloe_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -583,6 +639,21 @@ subroutine IceFloe_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrM
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine IceFloe_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(IceFloe_InputType), intent(inout) :: InputData1
+   type(IceFloe_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'IceFloe_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%iceMesh, InputData2%iceMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine IceFloe_DestroyInput(InputData, ErrStat, ErrMsg)
    type(IceFloe_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -36,45 +36,62 @@ MODULE InflowWind_C_BINDING
    PUBLIC :: IfW_C_GetFlowFieldPointer
    PUBLIC :: IfW_C_SetFlowFieldPointer
    PUBLIC :: IfW_C_GetWindVel
+   PUBLIC :: IfW_C_GetWindVelPts
 
    !------------------------------------------------------------------------------------
    !  Version info for display
    type(ProgDesc), parameter              :: version   = ProgDesc( 'InflowWind library', '', '' )
 
    !------------------------------------------------------------------------------------
-   !  Debugging: DebugLevel -- passed at PreInit
-   !     0  - none
-   !     1  - some summary info
-   !     2  - above + all position/orientation info
-   !     3  - above + input files (if direct passed)
-   !     4  - above + meshes
-   integer(IntKi)                         :: DebugLevel = 0
-
-   !------------------------------------------------------------------------------------
-   ! Primary IfW data derived types
-   type(InflowWind_InputType)                    :: InputData         !< Inputs to InflowWind
-   type(InflowWind_InitInputType)                :: InitInp
-   type(InflowWind_InitOutputType)               :: InitOutData       !< Initial output data -- Names, units, and version info.
-   type(InflowWind_ParameterType)                :: p                 !< Parameters
-   type(InflowWind_ContinuousStateType)          :: ContStates        !< Initial continuous states
-   type(InflowWind_DiscreteStateType)            :: DiscStates        !< Initial discrete states
-   type(InflowWind_ConstraintStateType)          :: ConstrStates      !< Constraint states at Time
-   type(InflowWind_OtherStateType)               :: OtherStates       !< Initial other/optimization states
-   type(InflowWind_OutputType)                   :: y                 !< Initial output (outputs are not calculated; only the output mesh is initialized)
-   type(InflowWind_MiscVarType)                  :: m                 !< Misc variables for optimization (not copied in glue code)
+   !  Instances
+   !     Each call to IfW_C_Init creates a new instance holding all the data below
+   !     and returns an integer handle to it.  All other IfW_C_* routines take that
+   !     handle as their first argument, so several independent InflowWind instances
+   !     can be used from one process.  Calls on different handles may be made from
+   !     separate threads at the same time.  IfW_C_Init and IfW_C_End change the
+   !     instance list and must not overlap with any other call into this library.
+   type :: IfW_C_InstanceType
+      !  Debugging: DebugLevel -- passed at Init
+      !     0  - none
+      !     1  - some summary info
+      !     2  - above + all position/orientation info
+      !     3  - above + input files (if direct passed)
+      !     4  - above + meshes
+      integer(IntKi)                                :: DebugLevel = 0
+
+      ! Primary IfW data derived types
+      type(InflowWind_InputType)                    :: InputData         !< Inputs to InflowWind
+      type(InflowWind_InitInputType)                :: InitInp
+      type(InflowWind_InitOutputType)               :: InitOutData       !< Initial output data -- Names, units, and version info.
+      type(InflowWind_ParameterType)                :: p                 !< Parameters
+      type(InflowWind_ContinuousStateType)          :: ContStates        !< Initial continuous states
+      type(InflowWind_DiscreteStateType)            :: DiscStates        !< Initial discrete states
+      type(InflowWind_ConstraintStateType)          :: ConstrStates      !< Constraint states at Time
+      type(InflowWind_OtherStateType)               :: OtherStates       !< Initial other/optimization states
+      type(InflowWind_OutputType)                   :: y                 !< Initial output (outputs are not calculated; only the output mesh is initialized)
+      type(InflowWind_MiscVarType)                  :: m                 !< Misc variables for optimization (not copied in glue code)
+   end type IfW_C_InstanceType
+
+   !> Instances are held through pointers so that they never move when the list grows
+   type :: IfW_C_InstancePtr
+      type(IfW_C_InstanceType), pointer             :: Inst => NULL()
+   end type IfW_C_InstancePtr
+
+   type(IfW_C_InstancePtr), allocatable          :: Instances(:)      !< Instance list; the handle is the index into this array
 
 CONTAINS
 
 !===============================================================================================================
 !--------------------------------------------- IFW INIT --------------------------------------------------------
 !===============================================================================================================
-SUBROUTINE IfW_C_Init(IfWinputFilePassed, IfWinputFileString_C, IfWinputFileStringLength_C, OutRootName_C,           &
+SUBROUTINE IfW_C_Init(Handle_C, IfWinputFilePassed, IfWinputFileString_C, IfWinputFileStringLength_C, OutRootName_C,           &
                      NumWindPts_C, DT_C, DebugLevel_in, NumChannels_C, OutputChannelNames_C, OutputChannelUnits_C,   &
                      ErrStat_C, ErrMsg_C) BIND (C, NAME='IfW_C_Init')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: IfW_C_Init
 !GCC$ ATTRIBUTES DLLEXPORT :: IfW_C_Init
 #endif
+   integer(c_int),            intent(  out)  :: Handle_C                               !< Handle to the new instance, passed to all other IfW_C_* routines
    integer(c_int),            intent(in   )  :: IfWinputFilePassed                     !< Write VTK outputs [0: none, 1: init only, 2: animation]
    type(c_ptr),               intent(in   )  :: IfWinputFileString_C                   !< Input file as a single string with lines deliniated by C_NULL_CHAR
    integer(c_int),            intent(in   )  :: IfWinputFileStringLength_C             !< length of the input file string
@@ -92,6 +109,7 @@ SUBROUTINE IfW_C_Init(IfWinputFilePassed, IfWinputFileString_C, IfWinputFileStri
    character(IntfStrLen)                                            :: OutRootName       !< Root name to use for echo files and other
    character(IntfStrLen)                                            :: TmpFileName                !< Temporary file name if not passing AD or IfW input file contents directly
    character(kind=c_char, len=IfWinputFileStringLength_C), pointer  :: IfWinputFileString         !< Input file as a single string with NULL chracter separating lines
+   type(IfW_C_InstanceType),                               pointer  :: Inst                       !< Instance data for this handle
 
    real(DbKi)                                                       :: TimeInterval
    integer                                                          :: ErrStat                    !< aggregated error message
@@ -105,8 +123,9 @@ SUBROUTINE IfW_C_Init(IfWinputFilePassed, IfWinputFileString_C, IfWinputFileStri
    ErrStat  =  ErrID_None
    ErrMsg   =  ""
 
-   ! clear out any leftover memory that might be allocated from a previous call
-   call MemClear(ErrStat2, ErrMsg2);   if (Failed()) return
+   ! create a new instance.  The handle is returned even if initialization fails
+   ! below so that IfW_C_End can clean up whatever was allocated.
+   call NewInstance(Handle_C, Inst, ErrStat2, ErrMsg2);   if (Failed()) return
 
    CALL NWTC_Init( ProgNameIn=version%Name )
    CALL DispCopyrightLicense( version%Name )
@@ -114,7 +133,7 @@ SUBROUTINE IfW_C_Init(IfWinputFilePassed, IfWinputFileString_C, IfWinputFileStri
 
 
    ! interface debugging
-   DebugLevel = int(DebugLevel_in,IntKi)
+   Inst%DebugLevel = int(DebugLevel_in,IntKi)
 
    ! Input files
    OutRootName = TRANSFER( OutRootName_C, OutRootName )
@@ -122,12 +141,12 @@ SUBROUTINE IfW_C_Init(IfWinputFilePassed, IfWinputFileString_C, IfWinputFileStri
    if ( i > 0 ) OutRootName = OutRootName(1:I)        ! remove it
 
    ! if non-zero, show all passed data here.  Then check valid values
-   if (DebugLevel /= 0_IntKi) then
-      call WrScr("   Interface debugging level "//trim(Num2Lstr(DebugLevel))//" requested.")
+   if (Inst%DebugLevel /= 0_IntKi) then
+      call WrScr("   Interface debugging level "//trim(Num2Lstr(Inst%DebugLevel))//" requested.")
       call ShowPassedData()
    endif
    ! check valid debug level
-   if (DebugLevel < 0_IntKi) then
+   if (Inst%DebugLevel < 0_IntKi) then
       ErrStat2 = ErrID_Fatal
       ErrMsg2  = "Interface debug level must be 0 or greater"//NewLine// &
          "  0  - none"//NewLine// &
@@ -139,51 +158,51 @@ SUBROUTINE IfW_C_Init(IfWinputFilePassed, IfWinputFileString_C, IfWinputFileStri
    endif
 
    ! For debugging the interface:
-   if (DebugLevel > 0) call ShowPassedData()
+   if (Inst%DebugLevel > 0) call ShowPassedData()
 
    ! Get fortran pointer to C_NULL_CHAR deliniated input file as a string 
    CALL C_F_pointer(IfWinputFileString_C, IfWinputFileString)
 
    ! Format IfW input file contents
    if (IfWinputFilePassed==1_c_int) then
-      InitInp%FilePassingMethod   = 1_IntKi                 ! Don't try to read an input -- use passed data instead (blades and AF tables not passed) using FileInfoType
-      InitInp%InputFileName       = "passed_ifw_file"       ! not actually used
-      call InitFileInfo(IfWinputFileString, InitInp%PassedFileInfo, ErrStat2, ErrMsg2); if (Failed())  return
+      Inst%InitInp%FilePassingMethod   = 1_IntKi                 ! Don't try to read an input -- use passed data instead (blades and AF tables not passed) using FileInfoType
+      Inst%InitInp%InputFileName       = "passed_ifw_file"       ! not actually used
+      call InitFileInfo(IfWinputFileString, Inst%InitInp%PassedFileInfo, ErrStat2, ErrMsg2); if (Failed())  return
    else
-      InitInp%FilePassingMethod   = 0_IntKi                 ! Read input info from a primary input file
+      Inst%InitInp%FilePassingMethod   = 0_IntKi                 ! Read input info from a primary input file
       i = min(IntfStrLen,IfWinputFileStringLength_C)
       TmpFileName = ''
       TmpFileName(1:i) = IfWinputFileString(1:i)
       i = INDEX(TmpFileName,C_NULL_CHAR) - 1                ! if this has a c null character at the end...
       if ( i > 0 ) TmpFileName = TmpFileName(1:I)           ! remove it
-      InitInp%InputFileName  = TmpFileName
+      Inst%InitInp%InputFileName  = TmpFileName
    endif
 
    ! For diagnostic purposes, the following can be used to display the contents
    ! of the InFileInfo data structure.
    !     CU is the screen -- system dependent.
-   if (DebugLevel >= 3) then
-      if (IfWinputFilePassed==1_c_int)    call Print_FileInfo_Struct( CU, InitInp%PassedFileInfo )
+   if (Inst%DebugLevel >= 3) then
+      if (IfWinputFilePassed==1_c_int)    call Print_FileInfo_Struct( CU, Inst%InitInp%PassedFileInfo )
    endif
 
    ! Set other inputs for calling InflowWind_Init
-   InitInp%NumWindPoints         = int(NumWindPts_C, IntKi)
-   InitInp%RootName              = OutRootName        ! used for making echo files
+   Inst%InitInp%NumWindPoints         = int(NumWindPts_C, IntKi)
+   Inst%InitInp%RootName              = OutRootName        ! used for making echo files
    TimeInterval                  = REAL(DT_C, DbKi)
 
    ! Call the main subroutine InflowWind_Init - only need InitInp and TimeInterval as inputs, the rest are set by InflowWind_Init
-   CALL InflowWind_Init( InitInp, InputData, p, ContStates, DiscStates, ConstrStates, OtherStates, y, m, TimeInterval, InitOutData, ErrStat2, ErrMsg2 )
+   CALL InflowWind_Init( Inst%InitInp, Inst%InputData, Inst%p, Inst%ContStates, Inst%DiscStates, Inst%ConstrStates, Inst%OtherStates, Inst%y, Inst%m, TimeInterval, Inst%InitOutData, ErrStat2, ErrMsg2 )
       if (Failed()) return
 
    ! Number of channels
-   NumChannels_C = size(InitOutData%WriteOutputHdr)
+   NumChannels_C = size(Inst%InitOutData%WriteOutputHdr)
 
    ! transfer the output channel names and units to c_char arrays for returning
    k=1
    do i=1,NumChannels_C
       do j=1,ChanLen    ! max length of channel name.  Same for units
-         OutputChannelNames_C(k)=InitOutData%WriteOutputHdr(i)(j:j)
-         OutputChannelUnits_C(k)=InitOutData%WriteOutputUnt(i)(j:j)
+         OutputChannelNames_C(k)=Inst%InitOutData%WriteOutputHdr(i)(j:j)
+         OutputChannelUnits_C(k)=Inst%InitOutData%WriteOutputUnt(i)(j:j)
          k=k+1
       enddo
    enddo
@@ -237,19 +256,22 @@ END SUBROUTINE IfW_C_Init
 !--------------------------------------------- IFW CALCOUTPUT --------------------------------------------------
 !===============================================================================================================
 
-SUBROUTINE IfW_C_CalcOutput(Time_C,Pos_C,Vel_C,OutputChannelValues_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_CalcOutput')
+SUBROUTINE IfW_C_CalcOutput(Handle_C,Time_C,Pos_C,Vel_C,OutputChannelValues_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_CalcOutput')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: IfW_C_CalcOutput
 !GCC$ ATTRIBUTES DLLEXPORT :: IfW_C_CalcOutput
 #endif
+   INTEGER(C_INT)                , INTENT(IN   )      :: Handle_C
    REAL(C_DOUBLE)                , INTENT(IN   )      :: Time_C
-   REAL(C_FLOAT)                 , INTENT(IN   )      :: Pos_C(3*InitInp%NumWindPoints)
-   REAL(C_FLOAT)                 , INTENT(  OUT)      :: Vel_C(3*InitInp%NumWindPoints)
-   REAL(C_FLOAT)                 , INTENT(  OUT)      :: OutputChannelValues_C(p%NumOuts)
+   REAL(C_FLOAT)                 , INTENT(IN   )      :: Pos_C(*)                         !< 3*NumWindPts
+   REAL(C_FLOAT)                 , INTENT(  OUT)      :: Vel_C(*)                         !< 3*NumWindPts
+   REAL(C_FLOAT)                 , INTENT(  OUT)      :: OutputChannelValues_C(*)         !< NumChannels
    INTEGER(C_INT)                , INTENT(  OUT)      :: ErrStat_C
    CHARACTER(KIND=C_CHAR)        , INTENT(  OUT)      :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local variables
+   TYPE(IfW_C_InstanceType), POINTER                  :: Inst                             !< Instance data for this handle
+   INTEGER                                            :: NumPts                           !< Number of wind points for this instance
    REAL(DbKi)                                         :: Time
    INTEGER                                            :: ErrStat                          !< aggregated error message
    CHARACTER(ErrMsgLen)                               :: ErrMsg                           !< aggregated error message
@@ -261,25 +283,28 @@ SUBROUTINE IfW_C_CalcOutput(Time_C,Pos_C,Vel_C,OutputChannelValues_C,ErrStat_C,E
    ErrStat  =  ErrID_None
    ErrMsg   =  ""
 
+   call GetInstance(Handle_C, Inst, ErrStat2, ErrMsg2);  if (Failed())  return
+   NumPts = Inst%InitInp%NumWindPoints
+
    ! Interface debugging
-   if (DebugLevel > 0) call ShowPassedData()
+   if (Inst%DebugLevel > 0) call ShowPassedData()
 
    ! Convert the inputs from C to Fortran
    Time = REAL(Time_C,DbKi)
-   InputData%PositionXYZ = reshape( real(Pos_C,ReKi), (/3, InitInp%NumWindPoints/) )
+   Inst%InputData%PositionXYZ = reshape( real(Pos_C(1:3*NumPts),ReKi), (/3, NumPts/) )
 
    ! Call the main subroutine InflowWind_CalcOutput to get the velocities
-   CALL InflowWind_CalcOutput( Time, InputData, p, ContStates, DiscStates, ConstrStates, OtherStates, y, m, ErrStat2, ErrMsg2 )
+   CALL InflowWind_CalcOutput( Time, Inst%InputData, Inst%p, Inst%ContStates, Inst%DiscStates, Inst%ConstrStates, Inst%OtherStates, Inst%y, Inst%m, ErrStat2, ErrMsg2 )
       if (Failed())  return
 
    ! Get velocities out of y and flatten them (still in same spot in memory)
-   Vel_C = reshape( REAL(y%VelocityUVW, C_FLOAT), (/3*InitInp%NumWindPoints/) ) ! VelocityUVW is 2D array of ReKi (might need reshape or make into pointer); size [3,N]
+   Vel_C(1:3*NumPts) = reshape( REAL(Inst%y%VelocityUVW, C_FLOAT), (/3*NumPts/) ) ! VelocityUVW is 2D array of ReKi (might need reshape or make into pointer); size [3,N]
 
    ! Interface debugging
-   if (DebugLevel > 0) call ShowReturnData()
+   if (Inst%DebugLevel > 0) call ShowReturnData()
 
    ! Get the output channel info out of y
-   OutputChannelValues_C = REAL(y%WriteOutput, C_FLOAT)
+   OutputChannelValues_C(1:Inst%p%NumOuts) = REAL(Inst%y%WriteOutput, C_FLOAT)
 
    call SetErrStat_F2C(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
 
@@ -299,7 +324,7 @@ CONTAINS
       call WrScr("Interface debugging:  IfW_C_CalcOutput")
       call WrScr("   --------------------------------------------------------")
       call WrScr("   Time_C                 -> "//trim(Num2LStr(Time_C)))
-      do i=1,InitInp%NumWindPoints
+      do i=1,NumPts
          write(TmpCh, '(i4)') i
          call WrScr("   Pos_C("//TmpCh//")            -> ("//trim(Num2LStr(Pos_C((i-1)*3+1)))//","//trim(Num2LStr(Pos_C((i-1)*3+2)))//","//trim(Num2LStr(Pos_C((i-1)*3+3)))//")")
       enddo
@@ -307,7 +332,7 @@ CONTAINS
    subroutine ShowReturnData()
       integer(IntKi) :: i
       character(4)   :: TmpCh
-      do i=1,InitInp%NumWindPoints
+      do i=1,NumPts
          call WrScr("   Vel_C("//TmpCh//")            <- ("//trim(Num2LStr(Vel_C((i-1)*3+1)))//","//trim(Num2LStr(Vel_C((i-1)*3+2)))//","//trim(Num2LStr(Vel_C((i-1)*3+3)))//")")
       enddo
       call WrScr("-----------------------------------------------------------")
@@ -317,13 +342,15 @@ END SUBROUTINE IfW_C_CalcOutput
 !===============================================================================================================
 !--------------------------------------------------- IFW END ---------------------------------------------------
 !===============================================================================================================
-subroutine IfW_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_End')
+subroutine IfW_C_End(Handle_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_End')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: IfW_C_End
 !GCC$ ATTRIBUTES DLLEXPORT :: IfW_C_End
 #endif
+   integer(c_int),         intent(in   )  :: Handle_C
    integer(c_int),         intent(  out)  :: ErrStat_C
    character(kind=c_char), intent(  out)  :: ErrMsg_C(ErrMsgLen_C)
+   type(IfW_C_InstanceType), pointer      :: Inst
    integer                                :: ErrStat,ErrStat2
    character(ErrMsgLen)                   :: ErrMsg,ErrMsg2
    character(*), parameter                :: RoutineName = 'IfW_C_End'
@@ -331,20 +358,30 @@ subroutine IfW_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_End')
    ErrStat = ErrID_None
    ErrMsg = ""
 
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
+      return
+   endif
+
    ! Call the main subroutine InflowWind_End
-   call InflowWind_End( InputData, p, ContStates, DiscStates, ConstrStates, OtherStates, y, m, ErrStat2, ErrMsg2 )
+   call InflowWind_End( Inst%InputData, Inst%p, Inst%ContStates, Inst%DiscStates, Inst%ConstrStates, Inst%OtherStates, Inst%y, Inst%m, ErrStat2, ErrMsg2 )
    call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
    ! Clear extra memory within library
-   call MemClear(ErrStat2, ErrMsg2)
+   call MemClear(Inst, ErrStat2, ErrMsg2)
    call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
 
+   ! Release the instance; the handle is no longer valid after this
+   call FreeInstance(Handle_C)
+
    call SetErrStat_F2C(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
 end subroutine IfW_C_End
 
 
 !> basic routine to get the wind velocity at a single point in time and space
-subroutine IfW_C_GetWindVel(Time_C,Pos_C,Vel_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_GetWindVel')
+subroutine IfW_C_GetWindVel(Handle_C,Time_C,Pos_C,Vel_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_GetWindVel')
+   integer(c_int),               intent(in   )  :: Handle_C
    real(c_double),               intent(in   )  :: Time_C
    real(c_float),                intent(in   )  :: Pos_C(3)
    real(c_float),                intent(  out)  :: Vel_C(3)
@@ -354,6 +391,7 @@ subroutine IfW_C_GetWindVel(Time_C,Pos_C,Vel_C,ErrStat_C,ErrMsg_C) BIND (C, NAME
    integer                                      :: ErrStat, ErrStat2
    character(ErrMsgLen)                         :: ErrMsg,  ErrMsg2
    character(*), parameter                      :: RoutineName = 'IfW_C_GetWindVel'
+   type(IfW_C_InstanceType), pointer            :: Inst
    integer(intKi)                               :: StartNode
    real(ReKi)                                   :: Pos(3,1), Vel(3,1), PosOffset(3)
    real(ReKi), allocatable                      :: NoAcc(:,:)
@@ -361,10 +399,14 @@ subroutine IfW_C_GetWindVel(Time_C,Pos_C,Vel_C,ErrStat_C,ErrMsg_C) BIND (C, NAME
    ErrStat = ErrID_None
    ErrMsg = ""
 
+   Vel_C   = 0.0_c_float
+   call GetInstance(Handle_C, Inst, ErrStat2, ErrMsg2)
+   if (Failed()) return
+
    ! Interface debugging
-   if (DebugLevel > 0) call ShowPassedData()
+   if (Inst%DebugLevel > 0) call ShowPassedData()
 
-   if (.not. associated(p%FlowField)) then
+   if (.not. associated(Inst%p%FlowField)) then
       ErrStat = ErrID_Fatal
       ErrMsg  = "Invalid pointer to FlowField data. Is the data initialized?"
       Vel_C   = 0.0_c_float
@@ -380,12 +422,12 @@ subroutine IfW_C_GetWindVel(Time_C,Pos_C,Vel_C,ErrStat_C,ErrMsg_C) BIND (C, NAME
    Pos(1:3,1) = real(Pos_C,ReKi)
 
    ! call wind routine to get single point velocity
-   call IfW_FlowField_GetVelAcc(p%FlowField, StartNode, Time, Pos, Vel,  NoAcc, ErrStat2, ErrMsg2)
+   call IfW_FlowField_GetVelAcc(Inst%p%FlowField, StartNode, Time, Pos, Vel,  NoAcc, ErrStat2, ErrMsg2)
    if (Failed()) return
    Vel_C = real(Vel(1:3,1), c_float)
 
    ! Interface debugging
-   if (DebugLevel > 0) call ShowReturnData()
+   if (Inst%DebugLevel > 0) call ShowReturnData()
 
    call SetErrStat_F2C(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
 contains
@@ -411,45 +453,192 @@ contains
 end subroutine IfW_C_GetWindVel
 
 
+!> Get the wind velocity at NumPts_C points at a single time.  Positions are passed as a flat 3xNumPts_C
+!! array and velocities are returned the same way.  Points are split into blocks that are evaluated
+!! concurrently when OpenMP is enabled (the FlowField data is only read).
+subroutine IfW_C_GetWindVelPts(Handle_C,NumPts_C,Time_C,Pos_C,Vel_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_GetWindVelPts')
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: IfW_C_GetWindVelPts
+!GCC$ ATTRIBUTES DLLEXPORT :: IfW_C_GetWindVelPts
+#endif
+   integer(c_int),               intent(in   )  :: Handle_C
+   integer(c_int),               intent(in   )  :: NumPts_C
+   real(c_double),               intent(in   )  :: Time_C
+   real(c_float),                intent(in   )  :: Pos_C(3*NumPts_C)
+   real(c_float),                intent(  out)  :: Vel_C(3*NumPts_C)
+   integer(c_int),               intent(  out)  :: ErrStat_C
+   character(kind=c_char),       intent(  out)  :: ErrMsg_C(ErrMsgLen_C)
+   integer(IntKi), parameter                    :: BlockSize = 256      !< points per block handed to IfW_FlowField_GetVelAcc
+   real(dbki)                                   :: Time
+   integer                                      :: ErrStat, ErrStat2
+   character(ErrMsgLen)                         :: ErrMsg,  ErrMsg2
+   character(*), parameter                      :: RoutineName = 'IfW_C_GetWindVelPts'
+   type(IfW_C_InstanceType), pointer            :: Inst
+   integer(IntKi)                               :: NumPts, iBlock, i1, i2
+   real(ReKi), allocatable                      :: Pos(:,:), Vel(:,:)
+   real(ReKi), allocatable                      :: NoAcc(:,:)
+
+   ErrStat = ErrID_None
+   ErrMsg = ""
+
+   NumPts = int(NumPts_C, IntKi)
+   if (NumPts > 0) Vel_C = 0.0_c_float
+   call GetInstance(Handle_C, Inst, ErrStat2, ErrMsg2)
+   if (Failed()) return
+
+   if (.not. associated(Inst%p%FlowField)) then
+      ErrStat2 = ErrID_Fatal
+      ErrMsg2  = "Invalid pointer to FlowField data. Is the data initialized?"
+      if (Failed()) return
+   endif
+
+   ! Convert the inputs from C to Fortran
+   Time = REAL(Time_C,DbKi)
+
+   ! Each block starts at node i1 so that point-based (external) wind fields index correctly
+   !$OMP PARALLEL DO DEFAULT(SHARED) PRIVATE(iBlock, i1, i2, Pos, Vel, NoAcc, ErrStat2, ErrMsg2) SCHEDULE(DYNAMIC)
+   do iBlock = 1, (NumPts + BlockSize - 1) / BlockSize
+      i1 = (iBlock - 1) * BlockSize + 1
+      i2 = min(iBlock * BlockSize, NumPts)
+      allocate(Pos(3, i2-i1+1), Vel(3, i2-i1+1))
+      Pos = reshape( real(Pos_C(3*i1-2:3*i2), ReKi), (/3, i2-i1+1/) )
+      call IfW_FlowField_GetVelAcc(Inst%p%FlowField, i1, Time, Pos, Vel, NoAcc, ErrStat2, ErrMsg2)
+      if (ErrStat2 /= ErrID_None) then
+         !$OMP CRITICAL(IfW_C_Pts)
+         call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         !$OMP END CRITICAL(IfW_C_Pts)
+      endif
+      Vel_C(3*i1-2:3*i2) = reshape( real(Vel, c_float), (/3*(i2-i1+1)/) )
+      deallocate(Pos, Vel)
+   enddo
+   !$OMP END PARALLEL DO
+
+   call SetErrStat_F2C(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
+contains
+   logical function Failed()
+      call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      Failed = ErrStat >= AbortErrLev
+      if (Failed)    call SetErrStat_F2C(ErrStat,ErrMsg,ErrStat_C,ErrMsg_C)
+   end function Failed
+end subroutine IfW_C_GetWindVelPts
+
+
 !> clear local memory that isn't stored in `_End` routine
-subroutine MemClear(ErrStat,ErrMsg)
+subroutine MemClear(Inst,ErrStat,ErrMsg)
+   type(IfW_C_InstanceType), intent(inout) :: Inst
    integer,                intent(  out)  :: ErrStat
    character(ErrMsgLen),   intent(  out)  :: ErrMsg
-   call InflowWind_DestroyInitInput( InitInp,     ErrStat, ErrMsg)
-   call InflowWind_DestroyInitOutput(InitOutData, ErrStat, ErrMsg)
+   call InflowWind_DestroyInitInput( Inst%InitInp,     ErrStat, ErrMsg)
+   call InflowWind_DestroyInitOutput(Inst%InitOutData, ErrStat, ErrMsg)
 end subroutine MemClear
 
+!> Create a new instance and return its handle.  Slots freed by IfW_C_End are reused.
+subroutine NewInstance(Handle, Inst, ErrStat, ErrMsg)
+   integer(c_int),                     intent(  out) :: Handle      !< handle (index into Instances)
+   type(IfW_C_InstanceType), pointer,  intent(  out) :: Inst        !< new instance data
+   integer,                            intent(  out) :: ErrStat
+   character(ErrMsgLen),               intent(  out) :: ErrMsg
+   type(IfW_C_InstancePtr), allocatable             :: TmpList(:)
+   integer                                          :: i, NumOld, ErrStat2
+   character(*), parameter                          :: RoutineName = 'NewInstance'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   Handle  = 0_c_int
+   Inst    => NULL()
+
+   ! find a free slot, growing the list if there is none
+   NumOld = 0
+   if (allocated(Instances)) NumOld = size(Instances)
+   do i = 1, NumOld
+      if (.not. associated(Instances(i)%Inst)) exit
+   enddo
+   if (i > NumOld) then
+      allocate(TmpList(max(4, 2*NumOld)), STAT=ErrStat2)
+      if (ErrStat2 /= 0) then
+         call SetErrStat(ErrID_Fatal, "Could not allocate instance list", ErrStat, ErrMsg, RoutineName)
+         return
+      endif
+      if (NumOld > 0) TmpList(1:NumOld) = Instances
+      call move_alloc(TmpList, Instances)
+   endif
+
+   allocate(Instances(i)%Inst, STAT=ErrStat2)
+   if (ErrStat2 /= 0) then
+      call SetErrStat(ErrID_Fatal, "Could not allocate instance data", ErrStat, ErrMsg, RoutineName)
+      return
+   endif
+   Inst   => Instances(i)%Inst
+   Handle =  int(i, c_int)
+end subroutine NewInstance
+
+!> Return the instance data for a handle, or a fatal error if the handle is not in use
+subroutine GetInstance(Handle, Inst, ErrStat, ErrMsg)
+   integer(c_int),                     intent(in   ) :: Handle
+   type(IfW_C_InstanceType), pointer,  intent(  out) :: Inst
+   integer,                            intent(  out) :: ErrStat
+   character(ErrMsgLen),               intent(  out) :: ErrMsg
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   Inst    => NULL()
+   if (allocated(Instances)) then
+      if (Handle >= 1 .and. Handle <= size(Instances)) Inst => Instances(Handle)%Inst
+   endif
+   if (.not. associated(Inst)) then
+      ErrStat = ErrID_Fatal
+      ErrMsg  = "Invalid InflowWind instance handle "//trim(Num2LStr(int(Handle,IntKi)))//". Was IfW_C_Init called?"
+   endif
+end subroutine GetInstance
+
+!> Release the instance data for a handle.  Data inside the instance must already be destroyed.
+subroutine FreeInstance(Handle)
+   integer(c_int),                     intent(in   ) :: Handle
+   if (.not. allocated(Instances)) return
+   if (Handle < 1 .or. Handle > size(Instances)) return
+   if (associated(Instances(Handle)%Inst)) deallocate(Instances(Handle)%Inst)
+   Instances(Handle)%Inst => NULL()
+end subroutine FreeInstance
+
 
 
 !> return the pointer to the WaveField data
-subroutine IfW_C_GetFlowFieldPointer(FlowFieldPointer_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_GetFlowFieldPointer')
+subroutine IfW_C_GetFlowFieldPointer(Handle_C,FlowFieldPointer_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_GetFlowFieldPointer')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: IfW_C_GetFlowFieldPointer
 !GCC$ ATTRIBUTES DLLEXPORT :: IfW_C_GetFlowFieldPointer
 #endif
+   integer(c_int),            intent(in   )  :: Handle_C
    type(c_ptr),               intent(  out)  :: FlowFieldPointer_C
    integer(c_int),            intent(  out)  :: ErrStat_C
    character(kind=c_char),    intent(  out)  :: ErrMsg_C(ErrMsgLen_C)
    integer                                   :: ErrStat
    character(ErrMsgLen)                      :: ErrMsg
    character(*),              parameter      :: RoutineName = 'IfW_C_GetFlowFieldPointer'
+   type(IfW_C_InstanceType),  pointer        :: Inst
    ErrStat = ErrID_None
    ErrMSg = ""
-   if (associated(p%FlowField)) then
-      FlowFieldPointer_C = C_LOC(p%FlowField)
+   FlowFieldPointer_C = C_NULL_PTR
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
+      return
+   endif
+   if (associated(Inst%p%FlowField)) then
+      FlowFieldPointer_C = C_LOC(Inst%p%FlowField)
    else
       FlowFieldPointer_C = C_NULL_PTR
       call SetErrStat(ErrID_Fatal,"Pointer to FlowField data not valid: data not initialized",ErrStat,ErrMsg,RoutineName)
    endif
    call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
-   if (DebugLevel > 1) call ShowPassedData()
+   if (Inst%DebugLevel > 1) call ShowPassedData()
    return
 contains
    subroutine ShowPassedData()
       call WrScr("-----------------------------------------------------------")
       call WrScr("Interface debugging:  IfW_C_GetFlowFieldPointer")
       call WrScr("   --------------------------------------------------------")
-      call WrScr("   FlowFieldPointer_C       -> "//trim(Num2LStr(loc(p%FlowField))))
+      call WrScr("   FlowFieldPointer_C       -> "//trim(Num2LStr(loc(Inst%p%FlowField))))
       call WrScr("-----------------------------------------------------------")
    end subroutine ShowPassedData
 end subroutine
@@ -458,37 +647,44 @@ end subroutine
 !FIXME: this will require changes to IfW_C_Init to instantiate an empty IfW instance
 !        so before exposing this publicly, the initialization should be updated.
 !> set the pointer to the FlowField data
-subroutine IfW_C_SetFlowFieldPointer(FlowFieldPointer_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_SetFlowFieldPointer')
+subroutine IfW_C_SetFlowFieldPointer(Handle_C,FlowFieldPointer_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='IfW_C_SetFlowFieldPointer')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: IfW_C_SetFlowFieldPointer
 !GCC$ ATTRIBUTES DLLEXPORT :: IfW_C_SetFlowFieldPointer
 #endif
+   integer(c_int),            intent(in   )  :: Handle_C
    type(c_ptr),               intent(in   )  :: FlowFieldPointer_C
    integer(c_int),            intent(  out)  :: ErrStat_C
    character(kind=c_char),    intent(  out)  :: ErrMsg_C(ErrMsgLen_C)
    integer                                   :: ErrStat
    character(ErrMsgLen)                      :: ErrMsg
    character(*),              parameter      :: RoutineName = 'IfW_C_SetFlowFieldPointer'
+   type(IfW_C_InstanceType),  pointer        :: Inst
    ErrStat = ErrID_None
    ErrMSg = ""
-   call C_F_POINTER(FlowFieldPointer_C, p%FlowField)
-   if (associated(p%FlowField)) then
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
+      return
+   endif
+   call C_F_POINTER(FlowFieldPointer_C, Inst%p%FlowField)
+   if (associated(Inst%p%FlowField)) then
       ! basic sanity check
-      if (p%FlowField%FieldType <= 0_IntKi) then
+      if (Inst%p%FlowField%FieldType <= 0_IntKi) then
          call SetErrStat(ErrID_Fatal,"Invalid pointer passed in, or FlowField not initialized",ErrStat,ErrMsg,RoutineName)
       endif
    else
       call SetErrStat(ErrID_Fatal,"Invalid pointer passed in, or FlowField not initialized",ErrStat,ErrMsg,RoutineName)
    endif
    call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
-   if (DebugLevel > 1) call ShowPassedData()
+   if (Inst%DebugLevel > 1) call ShowPassedData()
    return
 contains
    subroutine ShowPassedData()
       call WrScr("-----------------------------------------------------------")
       call WrScr("Interface debugging:  IfW_C_SetFlowFieldPointer")
       call WrScr("   --------------------------------------------------------")
-      call WrScr("   FlowFieldPointer_C       <- "//trim(Num2LStr(loc(p%FlowField))))
+      call WrScr("   FlowFieldPointer_C       <- "//trim(Num2LStr(loc(Inst%p%FlowField))))
       call WrScr("-----------------------------------------------------------")
    end subroutine ShowPassedData
 end subroutine
@@ -1007,6 +1007,33 @@ subroutine InflowWind_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, E
    DstInputData%HubOrientation = SrcInputData%HubOrientation
 end subroutine
 
+subroutine InflowWind_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(InflowWind_InputType), intent(inout) :: InputData1
+   type(InflowWind_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_PositionXYZ(:,:)
+   REAL(ReKi) :: tmp_HubPosition(1:3)
+   REAL(ReKi) :: tmp_HubOrientation(1:3,1:3)
+   character(*), parameter        :: RoutineName = 'InflowWind_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(InputData1%PositionXYZ, tmp_PositionXYZ)
+   call move_alloc(InputData2%PositionXYZ, InputData1%PositionXYZ)
+   call move_alloc(tmp_PositionXYZ, InputData2%PositionXYZ)
+   call Lidar_SwapInput(InputData1%lidar, InputData2%lidar, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   tmp_HubPosition = InputData1%HubPosition
+   InputData1%HubPosition = InputData2%HubPosition
+   InputData2%HubPosition = tmp_HubPosition
+   tmp_HubOrientation = InputData1%HubOrientation
+   InputData1%HubOrientation = InputData2%HubOrientation
+   InputData2%HubOrientation = tmp_HubOrientation
+end subroutine
+
 subroutine InflowWind_DestroyInput(InputData, ErrStat, ErrMsg)
    type(InflowWind_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1168,6 +1195,20 @@ subroutine InflowWind_CopyContState(SrcContStateData, DstContStateData, CtrlCode
    DstContStateData%DummyContState = SrcContStateData%DummyContState
 end subroutine
 
+subroutine InflowWind_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(InflowWind_ContinuousStateType), intent(inout) :: ContStateData1
+   type(InflowWind_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyContState
+   character(*), parameter        :: RoutineName = 'InflowWind_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyContState = ContStateData1%DummyContState
+   ContStateData1%DummyContState = ContStateData2%DummyContState
+   ContStateData2%DummyContState = tmp_DummyContState
+end subroutine
+
 subroutine InflowWind_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(InflowWind_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1206,6 +1247,20 @@ subroutine InflowWind_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode
    DstDiscStateData%DummyDiscState = SrcDiscStateData%DummyDiscState
 end subroutine
 
+subroutine InflowWind_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(InflowWind_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(InflowWind_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyDiscState
+   character(*), parameter        :: RoutineName = 'InflowWind_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscState = DiscStateData1%DummyDiscState
+   DiscStateData1%DummyDiscState = DiscStateData2%DummyDiscState
+   DiscStateData2%DummyDiscState = tmp_DummyDiscState
+end subroutine
+
 subroutine InflowWind_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(InflowWind_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1244,6 +1299,20 @@ subroutine InflowWind_CopyConstrState(SrcConstrStateData, DstConstrStateData, Ct
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine InflowWind_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(InflowWind_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(InflowWind_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'InflowWind_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine InflowWind_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(InflowWind_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1282,6 +1351,20 @@ subroutine InflowWind_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlC
    DstOtherStateData%DummyOtherState = SrcOtherStateData%DummyOtherState
 end subroutine
 
+subroutine InflowWind_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(InflowWind_OtherStateType), intent(inout) :: OtherStateData1
+   type(InflowWind_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyOtherState
+   character(*), parameter        :: RoutineName = 'InflowWind_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyOtherState = OtherStateData1%DummyOtherState
+   OtherStateData1%DummyOtherState = OtherStateData2%DummyOtherState
+   OtherStateData2%DummyOtherState = tmp_DummyOtherState
+end subroutine
+
 subroutine InflowWind_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(InflowWind_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -280,6 +280,36 @@ subroutine Lidar_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg
    DstInputData%HubDisplacementZ = SrcInputData%HubDisplacementZ
 end subroutine
 
+subroutine Lidar_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(Lidar_InputType), intent(inout) :: InputData1
+   type(Lidar_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_PulseLidEl
+   REAL(ReKi) :: tmp_PulseLidAz
+   REAL(ReKi) :: tmp_HubDisplacementX
+   REAL(ReKi) :: tmp_HubDisplacementY
+   REAL(ReKi) :: tmp_HubDisplacementZ
+   character(*), parameter        :: RoutineName = 'Lidar_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_PulseLidEl = InputData1%PulseLidEl
+   InputData1%PulseLidEl = InputData2%PulseLidEl
+   InputData2%PulseLidEl = tmp_PulseLidEl
+   tmp_PulseLidAz = InputData1%PulseLidAz
+   InputData1%PulseLidAz = InputData2%PulseLidAz
+   InputData2%PulseLidAz = tmp_PulseLidAz
+   tmp_HubDisplacementX = InputData1%HubDisplacementX
+   InputData1%HubDisplacementX = InputData2%HubDisplacementX
+   InputData2%HubDisplacementX = tmp_HubDisplacementX
+   tmp_HubDisplacementY = InputData1%HubDisplacementY
+   InputData1%HubDisplacementY = InputData2%HubDisplacementY
+   InputData2%HubDisplacementY = tmp_HubDisplacementY
+   tmp_HubDisplacementZ = InputData1%HubDisplacementZ
+   InputData1%HubDisplacementZ = InputData2%HubDisplacementZ
+   InputData2%HubDisplacementZ = tmp_HubDisplacementZ
+end subroutine
+
 subroutine Lidar_DestroyInput(InputData, ErrStat, ErrMsg)
    type(Lidar_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -566,6 +566,20 @@ subroutine LD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSta
    end if
 end subroutine
 
+subroutine LD_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(LD_ContinuousStateType), intent(inout) :: ContStateData1
+   type(LD_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_q(:)
+   character(*), parameter        :: RoutineName = 'LD_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%q, tmp_q)
+   call move_alloc(ContStateData2%q, ContStateData1%q)
+   call move_alloc(tmp_q, ContStateData2%q)
+end subroutine
+
 subroutine LD_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(LD_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -610,6 +624,20 @@ subroutine LD_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSta
    DstDiscStateData%Dummy = SrcDiscStateData%Dummy
 end subroutine
 
+subroutine LD_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(LD_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(LD_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_Dummy
+   character(*), parameter        :: RoutineName = 'LD_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Dummy = DiscStateData1%Dummy
+   DiscStateData1%Dummy = DiscStateData2%Dummy
+   DiscStateData2%Dummy = tmp_Dummy
+end subroutine
+
 subroutine LD_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(LD_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -648,6 +676,20 @@ subroutine LD_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%Dummy = SrcConstrStateData%Dummy
 end subroutine
 
+subroutine LD_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(LD_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(LD_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_Dummy
+   character(*), parameter        :: RoutineName = 'LD_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Dummy = ConstrStateData1%Dummy
+   ConstrStateData1%Dummy = ConstrStateData2%Dummy
+   ConstrStateData2%Dummy = tmp_Dummy
+end subroutine
+
 subroutine LD_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(LD_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -707,6 +749,45 @@ subroutine LD_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Err
    DstOtherStateData%iMotionInterpLast = SrcOtherStateData%iMotionInterpLast
 end subroutine
 
+subroutine LD_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(LD_OtherStateType), intent(inout) :: OtherStateData1
+   type(LD_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   INTEGER(IntKi) :: tmp_n
+   INTEGER(IntKi) :: tmp_iMotionInterpLast
+   character(*), parameter        :: RoutineName = 'LD_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(OtherStateData1%xdot) .neqv. allocated(OtherStateData2%xdot)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%xdot with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%xdot)) then
+      if (any(lbound(OtherStateData1%xdot) /= lbound(OtherStateData2%xdot)) .or. any(ubound(OtherStateData1%xdot) /= ubound(OtherStateData2%xdot))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%xdot with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%xdot)
+      UB(1:1) = ubound(OtherStateData1%xdot)
+      do i1 = LB(1), UB(1)
+         call LD_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   tmp_n = OtherStateData1%n
+   OtherStateData1%n = OtherStateData2%n
+   OtherStateData2%n = tmp_n
+   tmp_iMotionInterpLast = OtherStateData1%iMotionInterpLast
+   OtherStateData1%iMotionInterpLast = OtherStateData2%iMotionInterpLast
+   OtherStateData2%iMotionInterpLast = tmp_iMotionInterpLast
+end subroutine
+
 subroutine LD_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(LD_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1125,6 +1206,20 @@ subroutine LD_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine LD_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(LD_InputType), intent(inout) :: InputData1
+   type(LD_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_Fext(:)
+   character(*), parameter        :: RoutineName = 'LD_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(InputData1%Fext, tmp_Fext)
+   call move_alloc(InputData2%Fext, InputData1%Fext)
+   call move_alloc(tmp_Fext, InputData2%Fext)
+end subroutine
+
 subroutine LD_DestroyInput(InputData, ErrStat, ErrMsg)
    type(LD_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -190,6 +190,16 @@ IMPLICIT NONE
     REAL(KIND=C_DOUBLE) :: rho_sea 
     REAL(KIND=C_DOUBLE) :: dt 
     INTEGER(KIND=C_INT) :: numOuts 
+    LOGICAL(KIND=C_BOOL) :: UseLookup 
+    TYPE(C_ptr) :: LkpN = C_NULL_PTR 
+    INTEGER(C_int) :: LkpN_Len = 0 
+    TYPE(C_ptr) :: LkpMin = C_NULL_PTR 
+    INTEGER(C_int) :: LkpMin_Len = 0 
+    TYPE(C_ptr) :: LkpDelta = C_NULL_PTR 
+    INTEGER(C_int) :: LkpDelta_Len = 0 
+    INTEGER(KIND=C_INT) :: LkpNOut 
+    TYPE(C_ptr) :: LkpTable = C_NULL_PTR 
+    INTEGER(C_int) :: LkpTable_Len = 0 
   END TYPE MAP_ParameterType_C
   TYPE, PUBLIC :: MAP_ParameterType
     TYPE( MAP_ParameterType_C ) :: C_obj
@@ -200,6 +210,12 @@ IMPLICIT NONE
     CHARACTER(255) , DIMENSION(1:500)  :: InputLines      !< input file line for restart [-]
     CHARACTER(1) , DIMENSION(1:500)  :: InputLineType      !< input file line type for restart [-]
     INTEGER(IntKi)  :: numOuts = 0      !< Number of write outputs [-]
+    LOGICAL  :: UseLookup = .FALSE.      !< Interpolate the outputs from a precomputed lookup table instead of solving the catenary equations [-]
+    INTEGER(KIND=C_INT) , DIMENSION(:), POINTER  :: LkpN => NULL()      !< Number of lookup-table samples per platform DOF (surge, sway, heave, roll, pitch, yaw) [-]
+    REAL(KIND=C_DOUBLE) , DIMENSION(:), POINTER  :: LkpMin => NULL()      !< Lower bound of the lookup-table offset box per platform DOF [[m, rad]]
+    REAL(KIND=C_DOUBLE) , DIMENSION(:), POINTER  :: LkpDelta => NULL()      !< Lookup-table grid spacing per platform DOF (zero for DOFs with a single sample) [[m, rad]]
+    INTEGER(IntKi)  :: LkpNOut = 0      !< Number of tabulated values per grid point (3 per fairlead, WriteOutput, constraint states) [-]
+    REAL(KIND=C_DOUBLE) , DIMENSION(:), POINTER  :: LkpTable => NULL()      !< Sampled solution (Fx, Fy, Fz at each fairlead, WriteOutput, then H, V, x, y, z constraint states), LkpNOut values per grid point with surge varying fastest [-]
   END TYPE MAP_ParameterType
 ! =======================
 ! =========  MAP_InputType_C  =======
@@ -567,6 +583,24 @@ subroutine MAP_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSt
    DstContStateData%C_obj%dummy = SrcContStateData%C_obj%dummy
 end subroutine
 
+subroutine MAP_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(MAP_ContinuousStateType), intent(inout) :: ContStateData1
+   type(MAP_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki) :: tmp_dummy
+   type(MAP_ContinuousStateType_C) :: tmp_C_obj
+   character(*), parameter        :: RoutineName = 'MAP_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = ContStateData1%dummy
+   ContStateData1%dummy = ContStateData2%dummy
+   ContStateData2%dummy = tmp_dummy
+   tmp_C_obj = ContStateData1%C_obj
+   ContStateData1%C_obj = ContStateData2%C_obj
+   ContStateData2%C_obj = tmp_C_obj
+end subroutine
+
 subroutine MAP_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(MAP_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -643,6 +677,24 @@ subroutine MAP_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSt
    DstDiscStateData%C_obj%dummy = SrcDiscStateData%C_obj%dummy
 end subroutine
 
+subroutine MAP_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(MAP_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(MAP_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki) :: tmp_dummy
+   type(MAP_DiscreteStateType_C) :: tmp_C_obj
+   character(*), parameter        :: RoutineName = 'MAP_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = DiscStateData1%dummy
+   DiscStateData1%dummy = DiscStateData2%dummy
+   DiscStateData2%dummy = tmp_dummy
+   tmp_C_obj = DiscStateData1%C_obj
+   DiscStateData1%C_obj = DiscStateData2%C_obj
+   DiscStateData2%C_obj = tmp_C_obj
+end subroutine
+
 subroutine MAP_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(MAP_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -959,6 +1011,84 @@ subroutine MAP_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Er
    end if
 end subroutine
 
+subroutine MAP_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(MAP_OtherStateType), intent(inout) :: OtherStateData1
+   type(MAP_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(KIND=C_DOUBLE), pointer :: tmp_H(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_V(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_Ha(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_Va(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_x(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_y(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_z(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_xa(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_ya(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_za(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_Fx_connect(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_Fy_connect(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_Fz_connect(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_Fx_anchor(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_Fy_anchor(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_Fz_anchor(:)
+   type(MAP_OtherStateType_C) :: tmp_C_obj
+   character(*), parameter        :: RoutineName = 'MAP_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_H => OtherStateData1%H
+   OtherStateData1%H => OtherStateData2%H
+   OtherStateData2%H => tmp_H
+   tmp_V => OtherStateData1%V
+   OtherStateData1%V => OtherStateData2%V
+   OtherStateData2%V => tmp_V
+   tmp_Ha => OtherStateData1%Ha
+   OtherStateData1%Ha => OtherStateData2%Ha
+   OtherStateData2%Ha => tmp_Ha
+   tmp_Va => OtherStateData1%Va
+   OtherStateData1%Va => OtherStateData2%Va
+   OtherStateData2%Va => tmp_Va
+   tmp_x => OtherStateData1%x
+   OtherStateData1%x => OtherStateData2%x
+   OtherStateData2%x => tmp_x
+   tmp_y => OtherStateData1%y
+   OtherStateData1%y => OtherStateData2%y
+   OtherStateData2%y => tmp_y
+   tmp_z => OtherStateData1%z
+   OtherStateData1%z => OtherStateData2%z
+   OtherStateData2%z => tmp_z
+   tmp_xa => OtherStateData1%xa
+   OtherStateData1%xa => OtherStateData2%xa
+   OtherStateData2%xa => tmp_xa
+   tmp_ya => OtherStateData1%ya
+   OtherStateData1%ya => OtherStateData2%ya
+   OtherStateData2%ya => tmp_ya
+   tmp_za => OtherStateData1%za
+   OtherStateData1%za => OtherStateData2%za
+   OtherStateData2%za => tmp_za
+   tmp_Fx_connect => OtherStateData1%Fx_connect
+   OtherStateData1%Fx_connect => OtherStateData2%Fx_connect
+   OtherStateData2%Fx_connect => tmp_Fx_connect
+   tmp_Fy_connect => OtherStateData1%Fy_connect
+   OtherStateData1%Fy_connect => OtherStateData2%Fy_connect
+   OtherStateData2%Fy_connect => tmp_Fy_connect
+   tmp_Fz_connect => OtherStateData1%Fz_connect
+   OtherStateData1%Fz_connect => OtherStateData2%Fz_connect
+   OtherStateData2%Fz_connect => tmp_Fz_connect
+   tmp_Fx_anchor => OtherStateData1%Fx_anchor
+   OtherStateData1%Fx_anchor => OtherStateData2%Fx_anchor
+   OtherStateData2%Fx_anchor => tmp_Fx_anchor
+   tmp_Fy_anchor => OtherStateData1%Fy_anchor
+   OtherStateData1%Fy_anchor => OtherStateData2%Fy_anchor
+   OtherStateData2%Fy_anchor => tmp_Fy_anchor
+   tmp_Fz_anchor => OtherStateData1%Fz_anchor
+   OtherStateData1%Fz_anchor => OtherStateData2%Fz_anchor
+   OtherStateData2%Fz_anchor => tmp_Fz_anchor
+   tmp_C_obj = OtherStateData1%C_obj
+   OtherStateData1%C_obj = OtherStateData2%C_obj
+   OtherStateData2%C_obj = tmp_C_obj
+end subroutine
+
 subroutine MAP_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(MAP_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1639,6 +1769,40 @@ subroutine MAP_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    end if
 end subroutine
 
+subroutine MAP_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(MAP_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(MAP_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(KIND=C_DOUBLE), pointer :: tmp_H(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_V(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_x(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_y(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_z(:)
+   type(MAP_ConstraintStateType_C) :: tmp_C_obj
+   character(*), parameter        :: RoutineName = 'MAP_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_H => ConstrStateData1%H
+   ConstrStateData1%H => ConstrStateData2%H
+   ConstrStateData2%H => tmp_H
+   tmp_V => ConstrStateData1%V
+   ConstrStateData1%V => ConstrStateData2%V
+   ConstrStateData2%V => tmp_V
+   tmp_x => ConstrStateData1%x
+   ConstrStateData1%x => ConstrStateData2%x
+   ConstrStateData2%x => tmp_x
+   tmp_y => ConstrStateData1%y
+   ConstrStateData1%y => ConstrStateData2%y
+   ConstrStateData2%y => tmp_y
+   tmp_z => ConstrStateData1%z
+   ConstrStateData1%z => ConstrStateData2%z
+   ConstrStateData2%z => tmp_z
+   tmp_C_obj = ConstrStateData1%C_obj
+   ConstrStateData1%C_obj = ConstrStateData2%C_obj
+   ConstrStateData2%C_obj = tmp_C_obj
+end subroutine
+
 subroutine MAP_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(MAP_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1874,6 +2038,8 @@ subroutine MAP_CopyParam(SrcParamData, DstParamData, CtrlCode, ErrStat, ErrMsg)
    integer(IntKi),  intent(in   ) :: CtrlCode
    integer(IntKi),  intent(  out) :: ErrStat
    character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
    character(*), parameter        :: RoutineName = 'MAP_CopyParam'
    ErrStat = ErrID_None
    ErrMsg  = ''
@@ -1889,6 +2055,70 @@ subroutine MAP_CopyParam(SrcParamData, DstParamData, CtrlCode, ErrStat, ErrMsg)
    DstParamData%InputLineType = SrcParamData%InputLineType
    DstParamData%numOuts = SrcParamData%numOuts
    DstParamData%C_obj%numOuts = SrcParamData%C_obj%numOuts
+   DstParamData%UseLookup = SrcParamData%UseLookup
+   DstParamData%C_obj%UseLookup = SrcParamData%C_obj%UseLookup
+   if (associated(SrcParamData%LkpN)) then
+      LB(1:1) = lbound(SrcParamData%LkpN)
+      UB(1:1) = ubound(SrcParamData%LkpN)
+      if (.not. associated(DstParamData%LkpN)) then
+         allocate(DstParamData%LkpN(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%LkpN.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+         DstParamData%C_obj%LkpN_Len = size(DstParamData%LkpN)
+         if (DstParamData%C_obj%LkpN_Len > 0) &
+            DstParamData%C_obj%LkpN = c_loc(DstParamData%LkpN(LB(1)))
+      end if
+      DstParamData%LkpN = SrcParamData%LkpN
+   end if
+   if (associated(SrcParamData%LkpMin)) then
+      LB(1:1) = lbound(SrcParamData%LkpMin)
+      UB(1:1) = ubound(SrcParamData%LkpMin)
+      if (.not. associated(DstParamData%LkpMin)) then
+         allocate(DstParamData%LkpMin(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%LkpMin.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+         DstParamData%C_obj%LkpMin_Len = size(DstParamData%LkpMin)
+         if (DstParamData%C_obj%LkpMin_Len > 0) &
+            DstParamData%C_obj%LkpMin = c_loc(DstParamData%LkpMin(LB(1)))
+      end if
+      DstParamData%LkpMin = SrcParamData%LkpMin
+   end if
+   if (associated(SrcParamData%LkpDelta)) then
+      LB(1:1) = lbound(SrcParamData%LkpDelta)
+      UB(1:1) = ubound(SrcParamData%LkpDelta)
+      if (.not. associated(DstParamData%LkpDelta)) then
+         allocate(DstParamData%LkpDelta(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%LkpDelta.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+         DstParamData%C_obj%LkpDelta_Len = size(DstParamData%LkpDelta)
+         if (DstParamData%C_obj%LkpDelta_Len > 0) &
+            DstParamData%C_obj%LkpDelta = c_loc(DstParamData%LkpDelta(LB(1)))
+      end if
+      DstParamData%LkpDelta = SrcParamData%LkpDelta
+   end if
+   DstParamData%LkpNOut = SrcParamData%LkpNOut
+   DstParamData%C_obj%LkpNOut = SrcParamData%C_obj%LkpNOut
+   if (associated(SrcParamData%LkpTable)) then
+      LB(1:1) = lbound(SrcParamData%LkpTable)
+      UB(1:1) = ubound(SrcParamData%LkpTable)
+      if (.not. associated(DstParamData%LkpTable)) then
+         allocate(DstParamData%LkpTable(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstParamData%LkpTable.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+         DstParamData%C_obj%LkpTable_Len = size(DstParamData%LkpTable)
+         if (DstParamData%C_obj%LkpTable_Len > 0) &
+            DstParamData%C_obj%LkpTable = c_loc(DstParamData%LkpTable(LB(1)))
+      end if
+      DstParamData%LkpTable = SrcParamData%LkpTable
+   end if
 end subroutine
 
 subroutine MAP_DestroyParam(ParamData, ErrStat, ErrMsg)
@@ -1898,12 +2128,37 @@ subroutine MAP_DestroyParam(ParamData, ErrStat, ErrMsg)
    character(*), parameter        :: RoutineName = 'MAP_DestroyParam'
    ErrStat = ErrID_None
    ErrMsg  = ''
+   if (associated(ParamData%LkpN)) then
+      deallocate(ParamData%LkpN)
+      ParamData%LkpN => null()
+      ParamData%C_obj%LkpN = c_null_ptr
+      ParamData%C_obj%LkpN_Len = 0
+   end if
+   if (associated(ParamData%LkpMin)) then
+      deallocate(ParamData%LkpMin)
+      ParamData%LkpMin => null()
+      ParamData%C_obj%LkpMin = c_null_ptr
+      ParamData%C_obj%LkpMin_Len = 0
+   end if
+   if (associated(ParamData%LkpDelta)) then
+      deallocate(ParamData%LkpDelta)
+      ParamData%LkpDelta => null()
+      ParamData%C_obj%LkpDelta = c_null_ptr
+      ParamData%C_obj%LkpDelta_Len = 0
+   end if
+   if (associated(ParamData%LkpTable)) then
+      deallocate(ParamData%LkpTable)
+      ParamData%LkpTable => null()
+      ParamData%C_obj%LkpTable = c_null_ptr
+      ParamData%C_obj%LkpTable_Len = 0
+   end if
 end subroutine
 
 subroutine MAP_PackParam(RF, Indata)
    type(RegFile), intent(inout) :: RF
    type(MAP_ParameterType), intent(in) :: InData
    character(*), parameter         :: RoutineName = 'MAP_PackParam'
+   logical         :: PtrInIndex
    if (RF%ErrStat >= AbortErrLev) return
    call RegPack(RF, InData%g)
    call RegPack(RF, InData%depth)
@@ -1912,6 +2167,12 @@ subroutine MAP_PackParam(RF, Indata)
    call RegPack(RF, InData%InputLines)
    call RegPack(RF, InData%InputLineType)
    call RegPack(RF, InData%numOuts)
+   call RegPack(RF, InData%UseLookup)
+   call RegPackPtr(RF, InData%LkpN)
+   call RegPackPtr(RF, InData%LkpMin)
+   call RegPackPtr(RF, InData%LkpDelta)
+   call RegPack(RF, InData%LkpNOut)
+   call RegPackPtr(RF, InData%LkpTable)
    if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
@@ -1919,6 +2180,11 @@ subroutine MAP_UnPackParam(RF, OutData)
    type(RegFile), intent(inout)    :: RF
    type(MAP_ParameterType), intent(inout) :: OutData
    character(*), parameter            :: RoutineName = 'MAP_UnPackParam'
+   integer(B4Ki)   :: LB(1), UB(1)
+   integer(IntKi)  :: stat
+   logical         :: IsAllocAssoc
+   integer(B8Ki)   :: PtrIdx
+   type(c_ptr)     :: Ptr
    if (RF%ErrStat /= ErrID_None) return
    call RegUnpack(RF, OutData%g); if (RegCheckErr(RF, RoutineName)) return
    OutData%C_obj%g = OutData%g
@@ -1932,6 +2198,30 @@ subroutine MAP_UnPackParam(RF, OutData)
    call RegUnpack(RF, OutData%InputLineType); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%numOuts); if (RegCheckErr(RF, RoutineName)) return
    OutData%C_obj%numOuts = OutData%numOuts
+   call RegUnpack(RF, OutData%UseLookup); if (RegCheckErr(RF, RoutineName)) return
+   OutData%C_obj%UseLookup = OutData%UseLookup
+   call RegUnpackPtr(RF, OutData%LkpN, LB, UB); if (RegCheckErr(RF, RoutineName)) return
+   if (associated(OutData%LkpN)) then
+      OutData%C_obj%LkpN_Len = size(OutData%LkpN)
+      if (OutData%C_obj%LkpN_Len > 0) OutData%C_obj%LkpN = c_loc(OutData%LkpN(LB(1)))
+   end if
+   call RegUnpackPtr(RF, OutData%LkpMin, LB, UB); if (RegCheckErr(RF, RoutineName)) return
+   if (associated(OutData%LkpMin)) then
+      OutData%C_obj%LkpMin_Len = size(OutData%LkpMin)
+      if (OutData%C_obj%LkpMin_Len > 0) OutData%C_obj%LkpMin = c_loc(OutData%LkpMin(LB(1)))
+   end if
+   call RegUnpackPtr(RF, OutData%LkpDelta, LB, UB); if (RegCheckErr(RF, RoutineName)) return
+   if (associated(OutData%LkpDelta)) then
+      OutData%C_obj%LkpDelta_Len = size(OutData%LkpDelta)
+      if (OutData%C_obj%LkpDelta_Len > 0) OutData%C_obj%LkpDelta = c_loc(OutData%LkpDelta(LB(1)))
+   end if
+   call RegUnpack(RF, OutData%LkpNOut); if (RegCheckErr(RF, RoutineName)) return
+   OutData%C_obj%LkpNOut = OutData%LkpNOut
+   call RegUnpackPtr(RF, OutData%LkpTable, LB, UB); if (RegCheckErr(RF, RoutineName)) return
+   if (associated(OutData%LkpTable)) then
+      OutData%C_obj%LkpTable_Len = size(OutData%LkpTable)
+      if (OutData%C_obj%LkpTable_Len > 0) OutData%C_obj%LkpTable = c_loc(OutData%LkpTable(LB(1)))
+   end if
 end subroutine
 
 SUBROUTINE MAP_C2Fary_CopyParam(ParamData, ErrStat, ErrMsg, SkipPointers)
@@ -1954,6 +2244,44 @@ SUBROUTINE MAP_C2Fary_CopyParam(ParamData, ErrStat, ErrMsg, SkipPointers)
    ParamData%rho_sea = ParamData%C_obj%rho_sea
    ParamData%dt = ParamData%C_obj%dt
    ParamData%numOuts = ParamData%C_obj%numOuts
+   ParamData%UseLookup = ParamData%C_obj%UseLookup
+   
+   ! -- LkpN Param Data fields
+   IF ( .NOT. SkipPointers_local ) THEN
+      IF ( .NOT. C_ASSOCIATED( ParamData%C_obj%LkpN ) ) THEN
+         NULLIFY( ParamData%LkpN )
+      ELSE
+         CALL C_F_POINTER(ParamData%C_obj%LkpN, ParamData%LkpN, [ParamData%C_obj%LkpN_Len])
+      END IF
+   END IF
+   
+   ! -- LkpMin Param Data fields
+   IF ( .NOT. SkipPointers_local ) THEN
+      IF ( .NOT. C_ASSOCIATED( ParamData%C_obj%LkpMin ) ) THEN
+         NULLIFY( ParamData%LkpMin )
+      ELSE
+         CALL C_F_POINTER(ParamData%C_obj%LkpMin, ParamData%LkpMin, [ParamData%C_obj%LkpMin_Len])
+      END IF
+   END IF
+   
+   ! -- LkpDelta Param Data fields
+   IF ( .NOT. SkipPointers_local ) THEN
+      IF ( .NOT. C_ASSOCIATED( ParamData%C_obj%LkpDelta ) ) THEN
+         NULLIFY( ParamData%LkpDelta )
+      ELSE
+         CALL C_F_POINTER(ParamData%C_obj%LkpDelta, ParamData%LkpDelta, [ParamData%C_obj%LkpDelta_Len])
+      END IF
+   END IF
+   ParamData%LkpNOut = ParamData%C_obj%LkpNOut
+   
+   ! -- LkpTable Param Data fields
+   IF ( .NOT. SkipPointers_local ) THEN
+      IF ( .NOT. C_ASSOCIATED( ParamData%C_obj%LkpTable ) ) THEN
+         NULLIFY( ParamData%LkpTable )
+      ELSE
+         CALL C_F_POINTER(ParamData%C_obj%LkpTable, ParamData%LkpTable, [ParamData%C_obj%LkpTable_Len])
+      END IF
+   END IF
 END SUBROUTINE
 
 SUBROUTINE MAP_F2C_CopyParam( ParamData, ErrStat, ErrMsg, SkipPointers  )
@@ -1976,6 +2304,56 @@ SUBROUTINE MAP_F2C_CopyParam( ParamData, ErrStat, ErrMsg, SkipPointers  )
    ParamData%C_obj%rho_sea = ParamData%rho_sea
    ParamData%C_obj%dt = ParamData%dt
    ParamData%C_obj%numOuts = ParamData%numOuts
+   ParamData%C_obj%UseLookup = ParamData%UseLookup
+   
+   ! -- LkpN Param Data fields
+   IF (.NOT. SkipPointers_local ) THEN
+      IF (.NOT. ASSOCIATED(ParamData%LkpN)) THEN 
+         ParamData%C_obj%LkpN_Len = 0
+         ParamData%C_obj%LkpN = C_NULL_PTR
+      ELSE
+         ParamData%C_obj%LkpN_Len = SIZE(ParamData%LkpN)
+         IF (ParamData%C_obj%LkpN_Len > 0) &
+            ParamData%C_obj%LkpN = C_LOC(ParamData%LkpN(lbound(ParamData%LkpN,1)))
+      END IF
+   END IF
+   
+   ! -- LkpMin Param Data fields
+   IF (.NOT. SkipPointers_local ) THEN
+      IF (.NOT. ASSOCIATED(ParamData%LkpMin)) THEN 
+         ParamData%C_obj%LkpMin_Len = 0
+         ParamData%C_obj%LkpMin = C_NULL_PTR
+      ELSE
+         ParamData%C_obj%LkpMin_Len = SIZE(ParamData%LkpMin)
+         IF (ParamData%C_obj%LkpMin_Len > 0) &
+            ParamData%C_obj%LkpMin = C_LOC(ParamData%LkpMin(lbound(ParamData%LkpMin,1)))
+      END IF
+   END IF
+   
+   ! -- LkpDelta Param Data fields
+   IF (.NOT. SkipPointers_local ) THEN
+      IF (.NOT. ASSOCIATED(ParamData%LkpDelta)) THEN 
+         ParamData%C_obj%LkpDelta_Len = 0
+         ParamData%C_obj%LkpDelta = C_NULL_PTR
+      ELSE
+         ParamData%C_obj%LkpDelta_Len = SIZE(ParamData%LkpDelta)
+         IF (ParamData%C_obj%LkpDelta_Len > 0) &
+            ParamData%C_obj%LkpDelta = C_LOC(ParamData%LkpDelta(lbound(ParamData%LkpDelta,1)))
+      END IF
+   END IF
+   ParamData%C_obj%LkpNOut = ParamData%LkpNOut
+   
+   ! -- LkpTable Param Data fields
+   IF (.NOT. SkipPointers_local ) THEN
+      IF (.NOT. ASSOCIATED(ParamData%LkpTable)) THEN 
+         ParamData%C_obj%LkpTable_Len = 0
+         ParamData%C_obj%LkpTable = C_NULL_PTR
+      ELSE
+         ParamData%C_obj%LkpTable_Len = SIZE(ParamData%LkpTable)
+         IF (ParamData%C_obj%LkpTable_Len > 0) &
+            ParamData%C_obj%LkpTable = C_LOC(ParamData%LkpTable(lbound(ParamData%LkpTable,1)))
+      END IF
+   END IF
 END SUBROUTINE
 
 subroutine MAP_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
@@ -2040,6 +2418,37 @@ subroutine MAP_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine MAP_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(MAP_InputType), intent(inout) :: InputData1
+   type(MAP_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(KIND=C_DOUBLE), pointer :: tmp_x(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_y(:)
+   REAL(KIND=C_DOUBLE), pointer :: tmp_z(:)
+   type(MAP_InputType_C) :: tmp_C_obj
+   character(*), parameter        :: RoutineName = 'MAP_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_x => InputData1%x
+   InputData1%x => InputData2%x
+   InputData2%x => tmp_x
+   tmp_y => InputData1%y
+   InputData1%y => InputData2%y
+   InputData2%y => tmp_y
+   tmp_z => InputData1%z
+   InputData1%z => InputData2%z
+   InputData2%z => tmp_z
+   call MeshSwap(InputData1%PtFairDisplacement, InputData2%PtFairDisplacement, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   tmp_C_obj = InputData1%C_obj
+   InputData1%C_obj = InputData2%C_obj
+   InputData2%C_obj = tmp_C_obj
+end subroutine
+
 subroutine MAP_DestroyInput(InputData, ErrStat, ErrMsg)
    type(MAP_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -87,6 +87,12 @@ typedef struct MAP_ParameterType {
 	double rho_sea;
 	double dt;
 	int numOuts;
+	bool UseLookup;
+	int *LkpN;                  int LkpN_Len;
+	double *LkpMin;             int LkpMin_Len;
+	double *LkpDelta;           int LkpDelta_Len;
+	int LkpNOut;
+	double *LkpTable;           int LkpTable_Len;
 } MAP_ParameterType_t;
 
 typedef struct MAP_InputType {
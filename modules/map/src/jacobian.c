@@ -97,14 +97,217 @@ double jacobian_dzdv_contact(const double V, const double H, const double w, con
 };
 
 
+/* Adds the 3x3 block d[][] into the outer-loop Jacobian at (row node, column node). Nodes 
+ * that are not CONNECT nodes are not part of the outer-loop problem and are skipped. 
+ */
+static void add_node_block_to_jacobian(OuterSolveAttributes* ns, Node* row_node, Node* col_node, MAP_OtherStateType_t* other_type, MAP_ConstraintStateType_t* z_type, double d[3][3], const double sign)
+{
+  int row = 0;
+  int col = 0;
+  int i = 0;
+  int j = 0;
+
+  if (row_node->type!=CONNECT || col_node->type!=CONNECT) {
+    return;
+  };
+
+  row = 3*(int)(row_node->sum_force_ptr.fx.value - other_type->Fx_connect);
+  col = 3*(int)(col_node->position_ptr.x.value - z_type->x);
+  for (i=0 ; i<3 ; i++) {
+    for (j=0 ; j<3 ; j++) {
+      ns->jac[row+i][col+j] += sign*d[i][j];
+    };
+  };
+};
+
+
+MAP_ERROR_CODE analytic_jacobian(MAP_OtherStateType_t* other_type, MAP_ParameterType_t* p_type, MAP_ConstraintStateType_t* z_type, Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr)
+{
+  OuterSolveAttributes* ns = &domain->outer_loop;
+  MAP_ERROR_CODE success = MAP_SAFE;
+  Line* line_iter = NULL;
+  const int THREE = 3;
+  const int z_size = z_type->z_Len; 
+  const int n = THREE*(z_type->z_Len);
+  double df[3][3];  /* d(fairlead force)/d(fairlead position) */
+  double da[3][3];  /* d(anchor force)/d(fairlead position) */
+  double dxdh = 0.0;
+  double dxdv = 0.0;
+  double dzdh = 0.0;
+  double dzdv = 0.0;
+  double det = 0.0;
+  double dHdl = 0.0;
+  double dHdh = 0.0;
+  double dVdl = 0.0;
+  double dVdh = 0.0;
+  double a_H = 0.0; /* dHa/dH */
+  double a_V = 0.0; /* dHa/dV */
+  double b_V = 0.0; /* dVa/dV */
+  double Ha = 0.0;
+  double H = 0.0;
+  double V = 0.0;
+  double w = 0.0;
+  double Lu = 0.0;
+  double EA = 0.0;
+  double cb = 0.0;
+  double l = 0.0;
+  double c = 0.0;
+  double s = 0.0;
+  double sh = 0.0;
+  bool fallback = false;
+  int i = 0;
+  int j = 0;
+  
+  for (i=0 ; i<z_size ; i++) {
+    ns->b[THREE*i] = other_type->Fx_connect[i];
+    ns->b[THREE*i+1] = other_type->Fy_connect[i];
+    ns->b[THREE*i+2] = other_type->Fz_connect[i];      
+  }
+
+  for (i=0 ; i<n ; i++) {            
+    for (j=0 ; j<n ; j++) {            
+      ns->jac[i][j] = 0.0;
+    };
+  };
+
+  /* The node force sum is (H*cos(psi), H*sin(psi), V) at the fairlead and -(Ha*cos(psi), Ha*sin(psi), Va)
+   * at the anchor. H and V depend on the line excursions (l,h) through the inverse of the inner-loop 
+   * Jacobian, and (l,h,psi) depend on the fairlead/anchor positions through simple geometry.
+   */
+  list_iterator_start(&domain->line);
+  while (list_iterator_hasnext(&domain->line)) { 
+    line_iter = (Line*)list_iterator_next(&domain->line);
+    if (line_iter->fairlead->type!=CONNECT && line_iter->anchor->type!=CONNECT) {
+      continue;
+    };
+
+    /* linear springs and (nearly) vertical lines are left to the finite-difference Jacobian */
+    if (line_iter->options.linear_spring || line_iter->l<=MAP_HORIZONTAL_TOL) {
+      fallback = true;
+      break;
+    };
+    
+    H = *(line_iter->H.value);
+    V = *(line_iter->V.value);
+    w = line_iter->line_property->omega;
+    EA = line_iter->line_property->EA;
+    cb = line_iter->line_property->cb;
+    Lu = line_iter->Lu.value;
+    l = line_iter->l;
+    c = cos(line_iter->psi);
+    s = sin(line_iter->psi);
+    sh = (*(line_iter->fairlead->position_ptr.z.value)>=*(line_iter->anchor->position_ptr.z.value)) ? 1.0 : -1.0;
+
+    if (line_iter->options.omit_contact==true || w<0.0 || (V-w*Lu)>0.0) { /* same branch as inner_function_evals() */
+      dxdh = jacobian_dxdh_no_contact(V, H, w, Lu, EA);
+      dxdv = jacobian_dxdv_no_contact(V, H, w, Lu, EA);
+      dzdh = jacobian_dzdh_no_contact(V, H, w, Lu, EA);
+      dzdv = jacobian_dzdv_no_contact(V, H, w, Lu, EA);
+      Ha = H;
+      a_H = 1.0;
+      a_V = 0.0;
+      b_V = 1.0;
+    } else {
+      dxdh = jacobian_dxdh_contact(V, H, w, Lu, EA, cb);
+      dxdv = jacobian_dxdv_contact(V, H, w, Lu, EA, cb);
+      dzdh = jacobian_dzdh_contact(V, H, w, Lu, EA, cb);
+      dzdv = jacobian_dzdv_contact(V, H, w, Lu, EA, cb);
+      Ha = line_iter->H_at_anchor;
+      a_H = (Ha>0.0) ? 1.0 : 0.0;
+      a_V = (Ha>0.0) ? cb : 0.0;
+      b_V = 0.0;
+    };
+
+    det = dxdh*dzdv - dxdv*dzdh;
+    if (!(fabs(det)>MACHINE_EPSILON)) { /* also catches NaN */
+      fallback = true;
+      break;
+    };
+    dHdl = dzdv/det;
+    dHdh = -dxdv/det;
+    dVdl = -dzdh/det;
+    dVdh = dxdh/det;
+
+    df[0][0] = dHdl*c*c + H*s*s/l;
+    df[0][1] = dHdl*c*s - H*c*s/l;
+    df[0][2] = dHdh*sh*c;
+    df[1][0] = df[0][1];
+    df[1][1] = dHdl*s*s + H*c*c/l;
+    df[1][2] = dHdh*sh*s;
+    df[2][0] = dVdl*c;
+    df[2][1] = dVdl*s;
+    df[2][2] = dVdh*sh;
+
+    da[0][0] = -((a_H*dHdl + a_V*dVdl)*c*c + Ha*s*s/l);
+    da[0][1] = -((a_H*dHdl + a_V*dVdl)*c*s - Ha*c*s/l);
+    da[0][2] = -(a_H*dHdh + a_V*dVdh)*sh*c;
+    da[1][0] = da[0][1];
+    da[1][1] = -((a_H*dHdl + a_V*dVdl)*s*s + Ha*c*c/l);
+    da[1][2] = -(a_H*dHdh + a_V*dVdh)*sh*s;
+    da[2][0] = -b_V*dVdl*c;
+    da[2][1] = -b_V*dVdl*s;
+    da[2][2] = -b_V*dVdh*sh;
+
+    /* derivatives with respect to the anchor position are the negative of the fairlead ones */
+    add_node_block_to_jacobian(ns, line_iter->fairlead, line_iter->fairlead, other_type, z_type, df, 1.0);
+    add_node_block_to_jacobian(ns, line_iter->fairlead, line_iter->anchor, other_type, z_type, df, -1.0);
+    add_node_block_to_jacobian(ns, line_iter->anchor, line_iter->fairlead, other_type, z_type, da, 1.0);
+    add_node_block_to_jacobian(ns, line_iter->anchor, line_iter->anchor, other_type, z_type, da, -1.0);
+  };
+  list_iterator_stop(&domain->line);
+
+  if (fallback) {
+    success = backward_difference_jacobian(other_type, p_type, z_type, domain, map_msg, ierr); 
+    if (success) {
+      return MAP_FATAL;
+    };
+    /* restore the line solution at the unperturbed node positions */
+    return line_solve_sequence(domain, p_type, 0.0, map_msg, ierr); 
+  };
+
+  /* read flag to set scaling parameter */
+  if (ns->pg) {
+    for (i=0 ; i<THREE*z_size ; i++) { 
+      ns->jac[i][i] += (ns->ds/pow(ns->iteration_count,1.5)+ns->d);
+    };
+  };
+
+  return MAP_SAFE;
+};
+
+
+/* Perturbs the j-th node coordinate, re-solves all lines once, and accumulates sign*F_connect
+ * into column col of the Jacobian. 
+ */
+static MAP_ERROR_CODE perturbed_connect_force(double* coordinate, const double delta, const double sign, const int col, MAP_OtherStateType_t* other_type, MAP_ParameterType_t* p_type, Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr)
+{
+  OuterSolveAttributes* ns = &domain->outer_loop;
+  MAP_ERROR_CODE success = MAP_SAFE;
+  const double original_displacement = *coordinate;
+  const int z_size = other_type->Fx_connect_Len;
+  int i = 0;
+
+  *coordinate += delta;
+  success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
+  *coordinate = original_displacement;
+  if (success) {
+    return MAP_FATAL;
+  };
+  for (i=0 ; i<z_size ; i++) { // rows           
+    ns->jac[3*i][col] += sign*other_type->Fx_connect[i];
+    ns->jac[3*i+1][col] += sign*other_type->Fy_connect[i];
+    ns->jac[3*i+2][col] += sign*other_type->Fz_connect[i];
+  };
+  return MAP_SAFE;
+};
+
+
 MAP_ERROR_CODE forward_difference_jacobian(MAP_OtherStateType_t* other_type, MAP_ParameterType_t* p_type, MAP_ConstraintStateType_t* z_type, Domain* domain, char* map_msg, MAP_ERROR_CODE* ierr)
 {
   OuterSolveAttributes* ns = &domain->outer_loop;
   MAP_ERROR_CODE success = MAP_SAFE;
-  double original_displacement = 0.0;
   const int THREE = 3;
   const int z_size = z_type->z_Len; 
-  // const int m = THREE*(other_type->Fz_connect_Len); // rows
   const int n = THREE*(z_type->z_Len);              // columns
   int i = 0;
   int j = 0;
@@ -124,52 +327,24 @@ MAP_ERROR_CODE forward_difference_jacobian(MAP_OtherStateType_t* other_type, MAP
     };
   };
     
+  /* one line solve per perturbed coordinate fills the entire column */
   for (j=0 ; j<z_size ; j++) {   // column               
-    for (i=0 ; i<z_size ; i++) { // rows           
-      original_displacement = z_type->x[j];
-      z_type->x[j] += ns->epsilon;
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Forward difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      ns->jac[THREE*i][THREE*j] += other_type->Fx_connect[i];
-      ns->jac[THREE*i][THREE*j] /= ns->epsilon;
-      ns->jac[THREE*i+1][THREE*j] += other_type->Fy_connect[i];
-      ns->jac[THREE*i+1][THREE*j] /= ns->epsilon;
-      ns->jac[THREE*i+2][THREE*j] += other_type->Fz_connect[i];
-      ns->jac[THREE*i+2][THREE*j] /= ns->epsilon;
-      z_type->x[j] = original_displacement;
-        
-      original_displacement = z_type->y[j];
-      z_type->y[j] += ns->epsilon;
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Forward difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      ns->jac[THREE*i][THREE*j+1] += other_type->Fx_connect[i];
-      ns->jac[THREE*i][THREE*j+1] /= ns->epsilon;
-      ns->jac[THREE*i+1][THREE*j+1] += other_type->Fy_connect[i];
-      ns->jac[THREE*i+1][THREE*j+1] /= ns->epsilon;
-      ns->jac[THREE*i+2][THREE*j+1] += other_type->Fz_connect[i];
-      ns->jac[THREE*i+2][THREE*j+1] /= ns->epsilon;
-      z_type->y[j] = original_displacement;
-    
-      original_displacement = z_type->z[j];
-      z_type->z[j] += ns->epsilon;
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Forward difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      ns->jac[THREE*i][THREE*j+2] += other_type->Fx_connect[i];
-      ns->jac[THREE*i][THREE*j+2] /= ns->epsilon;
-      ns->jac[THREE*i+1][THREE*j+2] += other_type->Fy_connect[i];
-      ns->jac[THREE*i+1][THREE*j+2] /= ns->epsilon;
-      ns->jac[THREE*i+2][THREE*j+2] += other_type->Fz_connect[i];
-      ns->jac[THREE*i+2][THREE*j+2] /= ns->epsilon;
-      z_type->z[j] = original_displacement;
+    success = perturbed_connect_force(&z_type->x[j], ns->epsilon, 1.0, THREE*j, other_type, p_type, domain, map_msg, ierr);
+    if (!success) {
+      success = perturbed_connect_force(&z_type->y[j], ns->epsilon, 1.0, THREE*j+1, other_type, p_type, domain, map_msg, ierr);
+    };
+    if (!success) {
+      success = perturbed_connect_force(&z_type->z[j], ns->epsilon, 1.0, THREE*j+2, other_type, p_type, domain, map_msg, ierr);
+    };
+    if (success) {
+      set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Forward difference, node %d+delta.", j+1);
+      return MAP_FATAL;
+    };
+  };
+
+  for (i=0 ; i<n ; i++) {            
+    for (j=0 ; j<n ; j++) {            
+      ns->jac[i][j] /= ns->epsilon;
     };
   };
 
@@ -188,10 +363,8 @@ MAP_ERROR_CODE backward_difference_jacobian(MAP_OtherStateType_t* other_type, MA
 {
   OuterSolveAttributes* ns = &domain->outer_loop;
   MAP_ERROR_CODE success = MAP_SAFE;
-  double original_displacement = 0.0;
   const int THREE = 3;
   const int z_size = z_type->z_Len; // N
-  // const int m = THREE*(other_type->Fz_connect_Len); // rows
   const int n = THREE*(z_type->z_Len);              // columns
   int i = 0;
   int j = 0;
@@ -211,52 +384,24 @@ MAP_ERROR_CODE backward_difference_jacobian(MAP_OtherStateType_t* other_type, MA
     };
   };
 
+  /* one line solve per perturbed coordinate fills the entire column */
   for (j=0 ; j<z_size ; j++) {   // column               
-    for (i=0 ; i<z_size ; i++) { // rows           
-      original_displacement = z_type->x[j];
-      z_type->x[j] -= ns->epsilon;
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Backward difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      ns->jac[THREE*i][THREE*j] -= other_type->Fx_connect[i];
-      ns->jac[THREE*i][THREE*j] /= ns->epsilon;
-      ns->jac[THREE*i+1][THREE*j] -= other_type->Fy_connect[i];
-      ns->jac[THREE*i+1][THREE*j] /= ns->epsilon;
-      ns->jac[THREE*i+2][THREE*j] -= other_type->Fz_connect[i];
-      ns->jac[THREE*i+2][THREE*j] /= ns->epsilon;
-      z_type->x[j] = original_displacement;
-        
-      original_displacement = z_type->y[j];
-      z_type->y[j] -= ns->epsilon;
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Backward difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      ns->jac[THREE*i][THREE*j+1] -= other_type->Fx_connect[i];
-      ns->jac[THREE*i][THREE*j+1] /= ns->epsilon;
-      ns->jac[THREE*i+1][THREE*j+1] -= other_type->Fy_connect[i];
-      ns->jac[THREE*i+1][THREE*j+1] /= ns->epsilon;
-      ns->jac[THREE*i+2][THREE*j+1] -= other_type->Fz_connect[i];
-      ns->jac[THREE*i+2][THREE*j+1] /= ns->epsilon;
-      z_type->y[j] = original_displacement;
-    
-      original_displacement = z_type->z[j];
-      z_type->z[j] -= ns->epsilon;
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Backward difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      ns->jac[THREE*i][THREE*j+2] -= other_type->Fx_connect[i];
-      ns->jac[THREE*i][THREE*j+2] /= ns->epsilon;
-      ns->jac[THREE*i+1][THREE*j+2] -= other_type->Fy_connect[i];
-      ns->jac[THREE*i+1][THREE*j+2] /= ns->epsilon;
-      ns->jac[THREE*i+2][THREE*j+2] -= other_type->Fz_connect[i];
-      ns->jac[THREE*i+2][THREE*j+2] /= ns->epsilon;
-      z_type->z[j] = original_displacement;
+    success = perturbed_connect_force(&z_type->x[j], -ns->epsilon, -1.0, THREE*j, other_type, p_type, domain, map_msg, ierr);
+    if (!success) {
+      success = perturbed_connect_force(&z_type->y[j], -ns->epsilon, -1.0, THREE*j+1, other_type, p_type, domain, map_msg, ierr);
+    };
+    if (!success) {
+      success = perturbed_connect_force(&z_type->z[j], -ns->epsilon, -1.0, THREE*j+2, other_type, p_type, domain, map_msg, ierr);
+    };
+    if (success) {
+      set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Backward difference, node %d-delta.", j+1);
+      return MAP_FATAL;
+    };
+  };
+
+  for (i=0 ; i<n ; i++) {            
+    for (j=0 ; j<n ; j++) {            
+      ns->jac[i][j] /= ns->epsilon;
     };
   };
 
@@ -275,11 +420,10 @@ MAP_ERROR_CODE central_difference_jacobian(MAP_OtherStateType_t* other_type, MAP
 {
   OuterSolveAttributes* ns = &domain->outer_loop;
   MAP_ERROR_CODE success = MAP_SAFE;
-  double original_displacement = 0.0;
   const int THREE = 3;
   const int z_size = z_type->z_Len; //M
-  // const int m = THREE*(other_type->Fz_connect_Len); // rows
-  // const int n = THREE*(z_type->z_Len);              // columns
+  const int n = THREE*(z_type->z_Len);              // columns
+  double* coordinate = NULL;
   int i = 0;
   int j = 0;
   
@@ -289,93 +433,34 @@ MAP_ERROR_CODE central_difference_jacobian(MAP_OtherStateType_t* other_type, MAP
     ns->b[THREE*i+2] = other_type->Fz_connect[i];      
   }
 
-  /* First store the connect node force before applying ns->epsilon displacement */
-  for (j=0 ; j<z_size ; j++) {   // column               
-    for (i=0 ; i<z_size ; i++) { // rows           
-      original_displacement = z_type->x[j];
-      z_type->x[j] += ns->epsilon;
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Central difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      ns->jac[THREE*i][THREE*j] = other_type->Fx_connect[i];      
-      ns->jac[THREE*i+1][THREE*j] = other_type->Fy_connect[i];
-      ns->jac[THREE*i+2][THREE*j] = other_type->Fz_connect[i];
-      z_type->x[j] = original_displacement;
-        
-      original_displacement = z_type->y[j];
-      z_type->y[j] += ns->epsilon;
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Central difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      ns->jac[THREE*i][THREE*j+1] = other_type->Fx_connect[i];
-      ns->jac[THREE*i+1][THREE*j+1] = other_type->Fy_connect[i];
-      ns->jac[THREE*i+2][THREE*j+1] = other_type->Fz_connect[i];
-      z_type->y[j] = original_displacement;
-    
-      original_displacement = z_type->z[j];
-      z_type->z[j] += ns->epsilon;
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Central difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      ns->jac[THREE*i][THREE*j+2] = other_type->Fx_connect[i];
-      ns->jac[THREE*i+1][THREE*j+2] = other_type->Fy_connect[i];
-      ns->jac[THREE*i+2][THREE*j+2] = other_type->Fz_connect[i];
-      z_type->z[j] = original_displacement;
+  for (i=0 ; i<n ; i++) {            
+    for (j=0 ; j<n ; j++) {            
+      ns->jac[i][j] = 0.0;
     };
   };
-    
-  for (j=0 ; j<z_size ; j++) {   // column               
-    for (i=0 ; i<z_size ; i++) { // rows           
-      original_displacement = z_type->x[j];
-      z_type->x[j] -= ns->epsilon;
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Central difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      ns->jac[THREE*i][THREE*j] -= other_type->Fx_connect[i];
-      ns->jac[THREE*i][THREE*j] /= (2*ns->epsilon);
-      ns->jac[THREE*i+1][THREE*j] -= other_type->Fy_connect[i];
-      ns->jac[THREE*i+1][THREE*j] /= (2*ns->epsilon);
-      ns->jac[THREE*i+2][THREE*j] -= other_type->Fz_connect[i];
-      ns->jac[THREE*i+2][THREE*j] /= (2*ns->epsilon);
-      z_type->x[j] = original_displacement;
-        
-      original_displacement = z_type->y[j];
-      z_type->y[j] -= ns->epsilon;
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Central difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      ns->jac[THREE*i][THREE*j+1] -= other_type->Fx_connect[i];
-      ns->jac[THREE*i][THREE*j+1] /= (2*ns->epsilon);
-      ns->jac[THREE*i+1][THREE*j+1] -= other_type->Fy_connect[i];
-      ns->jac[THREE*i+1][THREE*j+1] /= (2*ns->epsilon);
-      ns->jac[THREE*i+2][THREE*j+1] -= other_type->Fz_connect[i];
-      ns->jac[THREE*i+2][THREE*j+1] /= (2*ns->epsilon);
-      z_type->y[j] = original_displacement;
-    
-      original_displacement = z_type->z[j];
-      z_type->z[j] -= ns->epsilon;
-      success = line_solve_sequence(domain, p_type, 0.0, map_msg, ierr);
-      if (success) {
-        set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Central difference, x[%d]+delta, row %d, col %d.", j+1, THREE*i, THREE*j);
-        return MAP_FATAL;
-      };
-      ns->jac[THREE*i][THREE*j+2] -= other_type->Fx_connect[i];
-      ns->jac[THREE*i][THREE*j+2] /= (2*ns->epsilon);
-      ns->jac[THREE*i+1][THREE*j+2] -= other_type->Fy_connect[i];
-      ns->jac[THREE*i+1][THREE*j+2] /= (2*ns->epsilon);
-      ns->jac[THREE*i+2][THREE*j+2] -= other_type->Fz_connect[i];
-      ns->jac[THREE*i+2][THREE*j+2] /= (2*ns->epsilon);
-      z_type->z[j] = original_displacement;
+
+  /* two line solves per perturbed coordinate fill the entire column */
+  for (j=0 ; j<n ; j++) {   // column               
+    if (j%THREE==0) {
+      coordinate = &z_type->x[j/THREE];
+    } else if (j%THREE==1) {
+      coordinate = &z_type->y[j/THREE];
+    } else {
+      coordinate = &z_type->z[j/THREE];
+    };
+    success = perturbed_connect_force(coordinate, ns->epsilon, 1.0, j, other_type, p_type, domain, map_msg, ierr);
+    if (!success) {
+      success = perturbed_connect_force(coordinate, -ns->epsilon, -1.0, j, other_type, p_type, domain, map_msg, ierr);
+    };
+    if (success) {
+      set_universal_error_with_message(map_msg, ierr, MAP_FATAL_78, "Central difference, node %d, col %d.", j/THREE+1, j);
+      return MAP_FATAL;
+    };
+  };
+
+  for (i=0 ; i<n ; i++) {            
+    for (j=0 ; j<n ; j++) {            
+      ns->jac[i][j] /= (2*ns->epsilon);
     };
   };
 
@@ -411,6 +411,9 @@ MAP_ERROR_CODE krylov_solve_sequence(Domain* domain, MAP_ParameterType_t* p_type
       case FORWARD_DIFFERENCE :
         success = forward_difference_jacobian(other_type, p_type, z_type, domain, map_msg, ierr); CHECKERRQ(MAP_FATAL_77);
         break;
+      case ANALYTIC_JACOBIAN :
+        success = analytic_jacobian(other_type, p_type, z_type, domain, map_msg, ierr); CHECKERRQ(MAP_FATAL_75);
+        break;
       };
       success = line_solve_sequence(domain, p_type, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_78);
       success = lu(ns, rows, map_msg, ierr); CHECKERRQ(MAP_FATAL_74);
@@ -519,9 +522,15 @@ MAP_ERROR_CODE newton_solve_sequence(Domain* domain, MAP_ParameterType_t* p_type
     case FORWARD_DIFFERENCE :
       success = forward_difference_jacobian(other_type, p_type, z_type, domain, map_msg, ierr); CHECKERRQ(MAP_FATAL_77);
       break;
+    case ANALYTIC_JACOBIAN :
+      success = analytic_jacobian(other_type, p_type, z_type, domain, map_msg, ierr); CHECKERRQ(MAP_FATAL_75);
+      break;
     };
     
-    success = line_solve_sequence(domain, p_type, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_78);
+    /* the analytic Jacobian leaves the line solution untouched; the finite-difference ones do not */
+    if (ns->fd!=ANALYTIC_JACOBIAN) {
+      success = line_solve_sequence(domain, p_type, time, map_msg, ierr); CHECKERRQ(MAP_FATAL_78);
+    };
     success = root_finding_step(ns, SIZE, z_type, other_type, &error, map_msg, ierr); CHECKERRQ(MAP_FATAL_92);
     
     ns->iteration_count++;
@@ -614,13 +614,19 @@ IF (ErrStat >= AbortErrLev) RETURN
     CALL MAP_C2Fary_CopyParam(p, ErrStat2, ErrMsg2);  ! copy these scalars for pack/unpack reasons
       CALL SetErrStat(ErrStat2,ErrMsg2, ErrStat, ErrMsg, RoutineName)    
     
+    ! optional fairlead-load lookup table (LOOKUP lines in the solver options)
+    CALL MAP_Lookup_ReadOptions(p, InitInp%Linearize, ErrStat2, ErrMsg2)
+      CALL SetErrStat(ErrStat2,ErrMsg2, ErrStat, ErrMsg, RoutineName)    
+      IF (ErrStat >= AbortErrLev) RETURN
+
     CALL MAP_Get_Output_Headers(InitOut, other)
     
     !==========   MAP Mesh initialization   ======     <--------------------------+               
     ! get header information for the FAST output file                  !          | 
     NumNodes = u%C_obj%X_Len                                           !          |    
     ! Create the input mesh                                            !          |
-    CALL MeshCreate(BlankMesh=u%PtFairDisplacement ,IOS= COMPONENT_INPUT, NNodes=NumNodes, TranslationDisp=.TRUE.,ErrStat=ErrStat2, ErrMess=ErrMsg2)
+    ! the lookup table is indexed by the platform rotation, so it needs the orientation of the fairleads
+    CALL MeshCreate(BlankMesh=u%PtFairDisplacement ,IOS= COMPONENT_INPUT, NNodes=NumNodes, TranslationDisp=.TRUE., Orientation=p%UseLookup, ErrStat=ErrStat2, ErrMess=ErrMsg2)
        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat,ErrMsg, RoutineName)
        IF (ErrStat >= AbortErrLev) RETURN
                                                                        !          |
@@ -687,6 +693,12 @@ IF (ErrStat >= AbortErrLev) RETURN
        if (N/=0) call SetErrStat(ErrID_Fatal, 'Failed to allocate y%WriteOutput',ErrStat, ErrMsg, RoutineName)   
     end if
 
+    if (p%UseLookup) then
+       call MAP_Lookup_Tabulate(u, p, x, xd, z, other, y, ErrStat2, ErrMsg2)
+       call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+       if (ErrStat >= AbortErrLev) return
+    end if
+
     !............................................................................................
     ! Module Variables
     !............................................................................................
@@ -792,6 +804,7 @@ IF (ErrStat >= AbortErrLev) RETURN
     INTEGER(KIND=C_INT)                             :: interval 
     INTEGER(IntKi)                                  :: i  
     TYPE(MAP_InputType)                             :: u_interp    ! Inputs at t
+    REAL(R8Ki)                                      :: q(6)         ! platform offset used for the lookup table
     
     INTEGER(IntKi)                                  :: ErrStat2     ! Error status of the operation
     CHARACTER(ErrMsgLen)                            :: ErrMsg2      ! Error message if ErrStat /= ErrID_None
@@ -809,6 +822,16 @@ IF (ErrStat >= AbortErrLev) RETURN
     CALL MAP_Input_ExtrapInterp(u, utimes, u_interp, t+p%dt, ErrStat2, ErrMsg2)
        CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat,ErrMsg, RoutineName)
     
+    ! inside the lookup-table box the constraint states are interpolated instead of solved for
+    IF (p%UseLookup) THEN
+       q = MAP_Lookup_Offset(u_interp%PtFairDisplacement)
+       IF (MAP_Lookup_InBox(p, q)) THEN
+          CALL MAP_Lookup_Interp(p, q, z)
+          CALL MAP_DestroyInput(u_interp, ErrStat2, ErrMsg2) 
+          RETURN
+       END IF
+    END IF
+    
     ! set the time and coupling interval to something readable by MAP (using KIND=C_INT/C_FLOAT instead
     ! of the native IntKi/DbKi format in FAST)
     time = t
@@ -866,6 +889,8 @@ IF (ErrStat >= AbortErrLev) RETURN
     CHARACTER(KIND=C_CHAR), DIMENSION(1024)         :: message_from_MAP 
     REAL(KIND=C_FLOAT)                              :: time
     integer                                         :: i     
+    REAL(R8Ki)                                      :: q(6)         ! platform offset used for the lookup table
+    LOGICAL                                         :: UseTable     ! whether the outputs are interpolated from the lookup table
     
     INTEGER(IntKi)                                  :: ErrStat2     ! Error status of the operation
     CHARACTER(ErrMsgLen)                            :: ErrMsg2      ! Error message if ErrStat /= ErrID_None
@@ -878,27 +903,38 @@ IF (ErrStat >= AbortErrLev) RETURN
     time = t
     message_from_MAP = ' '
     
-    DO i = 1,u%PtFairDisplacement%NNodes
-       u%X(i) = u%PtFairDisplacement%Position(1,i) + u%PtFairDisplacement%TranslationDisp(1,i)
-       u%Y(i) = u%PtFairDisplacement%Position(2,i) + u%PtFairDisplacement%TranslationDisp(2,i)
-       u%Z(i) = u%PtFairDisplacement%Position(3,i) + u%PtFairDisplacement%TranslationDisp(3,i)
-    END DO
+    ! use the lookup table when the platform offset lies inside the tabulated box; outside it the catenary
+    ! equations are solved as usual (the table keeps the constraint states current for the initial guess)
+    UseTable = .FALSE.
+    IF (p%UseLookup) THEN
+       q = MAP_Lookup_Offset(u%PtFairDisplacement)
+       UseTable = MAP_Lookup_InBox(p, q)
+    END IF
+    
+    IF (UseTable) THEN
+       CALL MAP_Lookup_Interp(p, q, z, y)
+    ELSE
+       DO i = 1,u%PtFairDisplacement%NNodes
+          u%X(i) = u%PtFairDisplacement%Position(1,i) + u%PtFairDisplacement%TranslationDisp(1,i)
+          u%Y(i) = u%PtFairDisplacement%Position(2,i) + u%PtFairDisplacement%TranslationDisp(2,i)
+          u%Z(i) = u%PtFairDisplacement%Position(3,i) + u%PtFairDisplacement%TranslationDisp(3,i)
+       END DO
   
-    CALL MSQS_CalcOutput(time            , & 
-                         u%C_obj         , &
-                         p%C_obj         , &
-                         x%C_obj         , &
-                         xd%C_obj        , &
-                         z%C_obj         , &
-                         O%C_obj         , &
-                         y%C_obj         , &
-                         status_from_MAP , &
-                         message_from_MAP ) 
+       CALL MSQS_CalcOutput(time            , & 
+                            u%C_obj         , &
+                            p%C_obj         , &
+                            x%C_obj         , &
+                            xd%C_obj        , &
+                            z%C_obj         , &
+                            O%C_obj         , &
+                            y%C_obj         , &
+                            status_from_MAP , &
+                            message_from_MAP ) 
+  
+       CALL MAP_ERROR_CHECKER(message_from_MAP,status_from_MAP,ErrMsg2,ErrStat2)
+          CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat,ErrMsg, RoutineName)
+    END IF
   
-      CALL MAP_ERROR_CHECKER(message_from_MAP,status_from_MAP,ErrMsg2,ErrStat2)
-      CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat,ErrMsg, RoutineName)
-
-    
    IF (ALLOCATED(y%WriteOutput) .AND. ASSOCIATED(y%WrtOutput) ) y%WriteOutput = REAL( y%WrtOutput, ReKi ) 
 
    ! Copy the MAP C output types to the native Fortran mesh output types
@@ -913,6 +949,474 @@ IF (ErrStat >= AbortErrLev) RETURN
   !==========================================================================================================
 
 
+  !==========   MAP_Lookup_ReadOptions   ======     <-------------------------------------------------------+
+  ! Reads the LOOKUP lines from the solver options section of the MAP input file:
+  !     LOOKUP <dof> <min> <max> <n>
+  ! where <dof> is one of SURGE, SWAY, HEAVE, ROLL, PITCH or YAW. Rotations are given in degrees. Platform
+  ! DOFs that are not listed are sampled only at zero offset.
+  SUBROUTINE MAP_Lookup_ReadOptions(p, Linearize, ErrStat, ErrMsg)
+    TYPE( MAP_ParameterType )       , INTENT(INOUT) :: p
+    LOGICAL                         , INTENT(IN   ) :: Linearize
+    INTEGER(IntKi)                  , INTENT(  OUT) :: ErrStat
+    CHARACTER(*)                    , INTENT(  OUT) :: ErrMsg
+
+    ! Local variables
+    CHARACTER(*), PARAMETER                         :: DofNames(6) = (/ 'SURGE', 'SWAY ', 'HEAVE', 'ROLL ', 'PITCH', 'YAW  ' /)
+    CHARACTER(20)                                   :: Key
+    CHARACTER(20)                                   :: DofName
+    REAL(R8Ki)                                      :: LkpMin(6)
+    REAL(R8Ki)                                      :: LkpMax(6)
+    INTEGER(IntKi)                                  :: LkpN(6)
+    REAL(R8Ki)                                      :: ValMin
+    REAL(R8Ki)                                      :: ValMax
+    INTEGER(IntKi)                                  :: nVal
+    INTEGER(IntKi)                                  :: iLine
+    INTEGER(IntKi)                                  :: iDof
+    INTEGER(IntKi)                                  :: ios
+    LOGICAL                                         :: Found
+    CHARACTER(*), PARAMETER                         :: RoutineName = 'MAP_Lookup_ReadOptions'
+
+    ErrStat = ErrID_None
+    ErrMsg  = ""
+
+    p%UseLookup = .FALSE.
+    p%C_obj%UseLookup = p%UseLookup
+
+    Found  = .FALSE.
+    LkpN   = 1
+    LkpMin = 0.0_R8Ki
+    LkpMax = 0.0_R8Ki
+
+    DO iLine = 1,SIZE(p%InputLines)
+       IF ( p%InputLineType(iLine) /= 'S' ) CYCLE
+
+       READ(p%InputLines(iLine), *, IOSTAT=ios) Key
+       IF (ios /= 0) CYCLE
+       CALL Conv2UC(Key)
+       IF ( TRIM(Key) /= 'LOOKUP' ) CYCLE
+
+       READ(p%InputLines(iLine), *, IOSTAT=ios) Key, DofName, ValMin, ValMax, nVal
+       IF (ios /= 0) THEN
+          CALL SetErrStat(ErrID_Fatal, 'Invalid LOOKUP option "'//TRIM(p%InputLines(iLine))//'". Expected LOOKUP <dof> <min> <max> <n>.', ErrStat, ErrMsg, RoutineName)
+          RETURN
+       END IF
+       CALL Conv2UC(DofName)
+
+       iDof = 0
+       DO ios = 1,SIZE(DofNames)
+          IF ( TRIM(DofName) == TRIM(DofNames(ios)) ) iDof = ios
+       END DO
+       IF (iDof < 1) THEN
+          CALL SetErrStat(ErrID_Fatal, 'Invalid LOOKUP degree of freedom "'//TRIM(DofName)//'". Must be SURGE, SWAY, HEAVE, ROLL, PITCH or YAW.', ErrStat, ErrMsg, RoutineName)
+          RETURN
+       END IF
+
+       IF ( nVal < 1 .OR. (nVal > 1 .AND. ValMax <= ValMin) ) THEN
+          CALL SetErrStat(ErrID_Fatal, 'Invalid LOOKUP range for '//TRIM(DofNames(iDof))//'. The number of samples must be at least 1 and <max> must be larger than <min>.', ErrStat, ErrMsg, RoutineName)
+          RETURN
+       END IF
+       IF (nVal == 1) ValMax = ValMin
+       IF (iDof > 3) THEN
+          ValMin = ValMin*D2R_D
+          ValMax = ValMax*D2R_D
+       END IF
+       LkpN(iDof)   = nVal
+       LkpMin(iDof) = ValMin
+       LkpMax(iDof) = ValMax
+       Found = .TRUE.
+    END DO
+
+    IF (.NOT. Found) RETURN
+
+    IF (Linearize) THEN
+       CALL SetErrStat(ErrID_Warn, 'The LOOKUP option is not available for linearization; the catenary equations will be solved at every call.', ErrStat, ErrMsg, RoutineName)
+       RETURN
+    END IF
+
+    ALLOCATE( p%LkpN(6), p%LkpMin(6), p%LkpDelta(6), STAT=ios )
+    IF (ios /= 0) THEN
+       CALL SetErrStat(ErrID_Fatal, 'Failed to allocate the lookup-table parameters.', ErrStat, ErrMsg, RoutineName)
+       RETURN
+    END IF
+    p%C_obj%LkpN     = C_LOC(p%LkpN(1))    ; p%C_obj%LkpN_Len     = 6
+    p%C_obj%LkpMin   = C_LOC(p%LkpMin(1))  ; p%C_obj%LkpMin_Len   = 6
+    p%C_obj%LkpDelta = C_LOC(p%LkpDelta(1)); p%C_obj%LkpDelta_Len = 6
+
+    p%LkpN   = LkpN
+    p%LkpMin = LkpMin
+    DO iDof = 1,6
+       IF (LkpN(iDof) > 1) THEN
+          p%LkpDelta(iDof) = (LkpMax(iDof) - LkpMin(iDof)) / REAL(LkpN(iDof) - 1, R8Ki)
+       ELSE
+          p%LkpDelta(iDof) = 0.0_R8Ki
+       END IF
+    END DO
+
+    p%UseLookup = .TRUE.
+    p%C_obj%UseLookup = p%UseLookup
+  END SUBROUTINE MAP_Lookup_ReadOptions                                                         !   -------+
+  !==========================================================================================================
+
+
+  !==========   MAP_Lookup_Tabulate   ======     <----------------------------------------------------------+
+  ! Solves the mooring system at every point of the lookup grid and stores the fairlead loads, the
+  ! WriteOutput channels and the constraint states in p%LkpTable. The grid is traversed in serpentine order so each solve starts from
+  ! the solution at a neighbouring offset; when a solve fails, the step from the last converged offset is
+  ! split into smaller increments. The system is left at the zero-offset equilibrium.
+  SUBROUTINE MAP_Lookup_Tabulate(u, p, x, xd, z, O, y, ErrStat, ErrMsg)
+    TYPE( MAP_InputType )           , INTENT(INOUT) :: u
+    TYPE( MAP_ParameterType )       , INTENT(INOUT) :: p
+    TYPE( MAP_ContinuousStateType ) , INTENT(INOUT) :: x
+    TYPE( MAP_DiscreteStateType )   , INTENT(INOUT) :: xd
+    TYPE( MAP_ConstraintStateType ) , INTENT(INOUT) :: z
+    TYPE( MAP_OtherStateType )      , INTENT(INOUT) :: O
+    TYPE( MAP_OutputType )          , INTENT(INOUT) :: y
+    INTEGER(IntKi)                  , INTENT(  OUT) :: ErrStat
+    CHARACTER(*)                    , INTENT(  OUT) :: ErrMsg
+
+    ! Local variables
+    INTEGER(IntKi), PARAMETER                       :: MaxGridPoints = 1000000
+    INTEGER(IntKi), PARAMETER                       :: MaxSubSteps   = 64
+    TYPE( MAP_ConstraintStateType )                 :: z_conv       ! constraint states at the last converged offset
+    REAL(R8Ki)                                      :: q(6)         ! platform offset at the current grid point
+    REAL(R8Ki)                                      :: q_conv(6)    ! last converged platform offset
+    INTEGER(IntKi)                                  :: Stride(6)
+    INTEGER(IntKi)                                  :: Digit
+    INTEGER(IntKi)                                  :: Remain
+    INTEGER(IntKi)                                  :: nGrid
+    INTEGER(IntKi)                                  :: nNodes
+    INTEGER(IntKi)                                  :: nWrt
+    INTEGER(IntKi)                                  :: nZ
+    INTEGER(IntKi)                                  :: nSub
+    INTEGER(IntKi)                                  :: k, d, j, iSub
+    INTEGER(IntKi)                                  :: ErrStat2
+    CHARACTER(ErrMsgLen)                            :: ErrMsg2
+    CHARACTER(*), PARAMETER                         :: RoutineName = 'MAP_Lookup_Tabulate'
+
+    ErrStat = ErrID_None
+    ErrMsg  = ""
+
+    IF ( PRODUCT(REAL(p%LkpN, R8Ki)) > REAL(MaxGridPoints, R8Ki) ) THEN
+       CALL SetErrStat(ErrID_Fatal, 'The LOOKUP grid has more than '//TRIM(Num2LStr(MaxGridPoints))//' points.', ErrStat, ErrMsg, RoutineName)
+       RETURN
+    END IF
+    nGrid = PRODUCT(p%LkpN)
+
+    Stride(1) = 1
+    DO d = 2,6
+       Stride(d) = Stride(d-1)*p%LkpN(d-1)
+    END DO
+
+    nNodes = u%PtFairDisplacement%NNodes
+    nWrt   = 0
+    IF (ASSOCIATED(y%WrtOutput)) nWrt = SIZE(y%WrtOutput)
+    nZ = SIZE(z%H) + SIZE(z%V) + SIZE(z%x) + SIZE(z%y) + SIZE(z%z)
+    p%LkpNOut = 3*nNodes + nWrt + nZ
+    p%C_obj%LkpNOut = p%LkpNOut
+
+    ALLOCATE( p%LkpTable(p%LkpNOut*nGrid), STAT=ErrStat2 )
+    IF (ErrStat2 /= 0) THEN
+       CALL SetErrStat(ErrID_Fatal, 'Failed to allocate the lookup table.', ErrStat, ErrMsg, RoutineName)
+       RETURN
+    END IF
+    p%C_obj%LkpTable = C_LOC(p%LkpTable(1)); p%C_obj%LkpTable_Len = SIZE(p%LkpTable)
+
+    ! the constraint states point into the C solver; keep a plain copy of the last converged solution
+    ALLOCATE( z_conv%H(SIZE(z%H)), z_conv%V(SIZE(z%V)), z_conv%x(SIZE(z%x)), z_conv%y(SIZE(z%y)), z_conv%z(SIZE(z%z)), STAT=ErrStat2 )
+    IF (ErrStat2 /= 0) THEN
+       CALL SetErrStat(ErrID_Fatal, 'Failed to allocate the lookup-table work arrays.', ErrStat, ErrMsg, RoutineName)
+       CALL Cleanup()
+       RETURN
+    END IF
+    CALL SaveConstrStates()
+    q_conv = 0.0_R8Ki
+
+    DO k = 0,nGrid
+       ! grid coordinates of the k-th point of the serpentine traversal (the last pass restores the zero offset)
+       j = 0
+       IF (k < nGrid) THEN
+          Remain = k
+          DO d = 1,6
+             Digit  = MOD(Remain, p%LkpN(d))
+             Remain = Remain / p%LkpN(d)
+             IF (MOD(Remain, 2) == 1) Digit = p%LkpN(d) - 1 - Digit
+             q(d) = p%LkpMin(d) + Digit*p%LkpDelta(d)
+             j = j + Digit*Stride(d)
+          END DO
+       ELSE
+          q = 0.0_R8Ki
+       END IF
+
+       nSub = 1
+       DO
+          DO iSub = 1,nSub
+             CALL MAP_Lookup_Solve(q_conv + (q - q_conv)*REAL(iSub, R8Ki)/REAL(nSub, R8Ki), u, p, x, xd, z, O, y, ErrStat2, ErrMsg2)
+             IF (ErrStat2 >= AbortErrLev) EXIT
+          END DO
+          IF (ErrStat2 < AbortErrLev) EXIT
+
+          nSub = 2*nSub
+          IF (nSub > MaxSubSteps) THEN
+             CALL SetErrStat(ErrStat2, TRIM(ErrMsg2)//' (lookup-table offset: '//TRIM(Num2LStr(q(1)))//', '//TRIM(Num2LStr(q(2)))//', '//TRIM(Num2LStr(q(3)))// &
+                             ' m; '//TRIM(Num2LStr(q(4)*R2D_D))//', '//TRIM(Num2LStr(q(5)*R2D_D))//', '//TRIM(Num2LStr(q(6)*R2D_D))//' deg)', ErrStat, ErrMsg, RoutineName)
+             CALL Cleanup()
+             RETURN
+          END IF
+          CALL RestoreConstrStates()
+       END DO
+       CALL SaveConstrStates()
+       q_conv = q
+
+       IF (k == nGrid) EXIT
+       j = j*p%LkpNOut
+       p%LkpTable(j+1          : j+  nNodes) = y%FX(1:nNodes)
+       p%LkpTable(j+1+  nNodes : j+2*nNodes) = y%FY(1:nNodes)
+       p%LkpTable(j+1+2*nNodes : j+3*nNodes) = y%FZ(1:nNodes)
+       IF (nWrt > 0) p%LkpTable(j+1+3*nNodes : j+3*nNodes+nWrt) = y%WrtOutput(1:nWrt)
+       j = j + 3*nNodes + nWrt
+       p%LkpTable(j+1 : j+SIZE(z%H)) = z%H;  j = j + SIZE(z%H)
+       p%LkpTable(j+1 : j+SIZE(z%V)) = z%V;  j = j + SIZE(z%V)
+       p%LkpTable(j+1 : j+SIZE(z%x)) = z%x;  j = j + SIZE(z%x)
+       p%LkpTable(j+1 : j+SIZE(z%y)) = z%y;  j = j + SIZE(z%y)
+       p%LkpTable(j+1 : j+SIZE(z%z)) = z%z
+    END DO
+
+    CALL Cleanup()
+
+  CONTAINS
+     SUBROUTINE SaveConstrStates()
+        z_conv%H = z%H
+        z_conv%V = z%V
+        z_conv%x = z%x
+        z_conv%y = z%y
+        z_conv%z = z%z
+     END SUBROUTINE SaveConstrStates
+
+     SUBROUTINE RestoreConstrStates()
+        z%H = z_conv%H
+        z%V = z_conv%V
+        z%x = z_conv%x
+        z%y = z_conv%y
+        z%z = z_conv%z
+     END SUBROUTINE RestoreConstrStates
+
+     SUBROUTINE Cleanup()
+        IF (ASSOCIATED(z_conv%H)) DEALLOCATE(z_conv%H)
+        IF (ASSOCIATED(z_conv%V)) DEALLOCATE(z_conv%V)
+        IF (ASSOCIATED(z_conv%x)) DEALLOCATE(z_conv%x)
+        IF (ASSOCIATED(z_conv%y)) DEALLOCATE(z_conv%y)
+        IF (ASSOCIATED(z_conv%z)) DEALLOCATE(z_conv%z)
+     END SUBROUTINE Cleanup
+  END SUBROUTINE MAP_Lookup_Tabulate                                                            !   -------+
+  !==========================================================================================================
+
+
+  !==========   MAP_Lookup_Solve   ======     <-------------------------------------------------------------+
+  ! Places the fairleads at the rigid-body platform offset q and solves the mooring system.
+  SUBROUTINE MAP_Lookup_Solve(q, u, p, x, xd, z, O, y, ErrStat, ErrMsg)
+    REAL(R8Ki)                      , INTENT(IN   ) :: q(6)
+    TYPE( MAP_InputType )           , INTENT(INOUT) :: u
+    TYPE( MAP_ParameterType )       , INTENT(INOUT) :: p
+    TYPE( MAP_ContinuousStateType ) , INTENT(INOUT) :: x
+    TYPE( MAP_DiscreteStateType )   , INTENT(INOUT) :: xd
+    TYPE( MAP_ConstraintStateType ) , INTENT(INOUT) :: z
+    TYPE( MAP_OtherStateType )      , INTENT(INOUT) :: O
+    TYPE( MAP_OutputType )          , INTENT(INOUT) :: y
+    INTEGER(IntKi)                  , INTENT(  OUT) :: ErrStat
+    CHARACTER(*)                    , INTENT(  OUT) :: ErrMsg
+
+    ! Local variables
+    INTEGER(KIND=C_INT)                             :: status_from_MAP
+    CHARACTER(KIND=C_CHAR), DIMENSION(1024)         :: message_from_MAP
+    REAL(KIND=C_FLOAT)                              :: time
+    REAL(R8Ki)                                      :: Orient(3,3)  ! transpose of the platform orientation
+    REAL(R8Ki)                                      :: Pos(3)
+    INTEGER(IntKi)                                  :: i
+
+    Orient = TRANSPOSE( EulerConstruct(q(4:6)) )
+    DO i = 1,u%PtFairDisplacement%NNodes
+       Pos = q(1:3) + MATMUL( Orient, u%PtFairDisplacement%Position(:,i) )
+       u%X(i) = Pos(1)
+       u%Y(i) = Pos(2)
+       u%Z(i) = Pos(3)
+    END DO
+
+    time = 0.0_C_FLOAT
+    status_from_MAP = 0
+    message_from_MAP = ' '
+    CALL MSQS_CalcOutput(time            , &
+                         u%C_obj         , &
+                         p%C_obj         , &
+                         x%C_obj         , &
+                         xd%C_obj        , &
+                         z%C_obj         , &
+                         O%C_obj         , &
+                         y%C_obj         , &
+                         status_from_MAP , &
+                         message_from_MAP )
+    CALL MAP_ERROR_CHECKER(message_from_MAP,status_from_MAP,ErrMsg,ErrStat)
+  END SUBROUTINE MAP_Lookup_Solve                                                               !   -------+
+  !==========================================================================================================
+
+
+  !==========   MAP_Lookup_Offset   ======     <------------------------------------------------------------+
+  ! Recovers the rigid-body platform offset (surge, sway, heave, roll, pitch, yaw) from the fairlead motion.
+  ! The rotation comes from the fairlead orientation; the translation is the mean displacement of the
+  ! platform reference point implied by each fairlead.
+  FUNCTION MAP_Lookup_Offset(Mesh) RESULT(q)
+    TYPE(MeshType)                  , INTENT(IN   ) :: Mesh
+    REAL(R8Ki)                                      :: q(6)
+
+    ! Local variables
+    REAL(R8Ki)                                      :: Orient(3,3)
+    INTEGER(IntKi)                                  :: i
+
+    q = 0.0_R8Ki
+    IF (Mesh%NNodes < 1) RETURN
+
+    IF (ALLOCATED(Mesh%Orientation)) THEN
+       q(4:6) = EulerExtract( Mesh%Orientation(:,:,1) )
+       Orient = TRANSPOSE( Mesh%Orientation(:,:,1) )
+       DO i = 1,Mesh%NNodes
+          q(1:3) = q(1:3) + Mesh%Position(:,i) + Mesh%TranslationDisp(:,i) - MATMUL( Orient, Mesh%Position(:,i) )
+       END DO
+    ELSE
+       DO i = 1,Mesh%NNodes
+          q(1:3) = q(1:3) + Mesh%TranslationDisp(:,i)
+       END DO
+    END IF
+    q(1:3) = q(1:3) / REAL(Mesh%NNodes, R8Ki)
+  END FUNCTION MAP_Lookup_Offset                                                                !   -------+
+  !==========================================================================================================
+
+
+  !==========   MAP_Lookup_InBox   ======     <-------------------------------------------------------------+
+  ! Returns .TRUE. when the platform offset q lies inside the tabulated box. DOFs with a single sample must
+  ! be at that sample.
+  LOGICAL FUNCTION MAP_Lookup_InBox(p, q)
+    TYPE( MAP_ParameterType )       , INTENT(IN   ) :: p
+    REAL(R8Ki)                      , INTENT(IN   ) :: q(6)
+
+    ! Local variables
+    REAL(R8Ki), PARAMETER                           :: Tol = 1.0E-6_R8Ki
+    INTEGER(IntKi)                                  :: d
+
+    MAP_Lookup_InBox = .FALSE.
+    DO d = 1,6
+       IF ( q(d) < p%LkpMin(d) - Tol ) RETURN
+       IF ( q(d) > p%LkpMin(d) + (p%LkpN(d)-1)*p%LkpDelta(d) + Tol ) RETURN
+    END DO
+    MAP_Lookup_InBox = .TRUE.
+  END FUNCTION MAP_Lookup_InBox                                                                 !   -------+
+  !==========================================================================================================
+
+
+  !==========   MAP_Lookup_Interp   ======     <------------------------------------------------------------+
+  ! Interpolates the constraint states and, when y is present, the fairlead loads and WriteOutput channels
+  ! at the platform offset q with a tensor-product Catmull-Rom spline. Offsets outside the box are clamped to
+  ! it. Missing neighbours at the edges of the box are extrapolated linearly, which reduces the spline to a
+  ! quadratic in the end intervals and to linear interpolation for DOFs with two samples.
+  SUBROUTINE MAP_Lookup_Interp(p, q, z, y)
+    TYPE( MAP_ParameterType )       , INTENT(IN   ) :: p
+    REAL(R8Ki)                      , INTENT(IN   ) :: q(6)
+    TYPE( MAP_ConstraintStateType ) , INTENT(INOUT) :: z
+    TYPE( MAP_OutputType ), OPTIONAL, INTENT(INOUT) :: y
+
+    ! Local variables
+    REAL(R8Ki)                                      :: w(0:3,6)     ! stencil weights for each DOF
+    INTEGER(IntKi)                                  :: i0(6)        ! grid index of the first stencil point for each DOF
+    INTEGER(IntKi)                                  :: nSt(6)       ! stencil size for each DOF
+    INTEGER(IntKi)                                  :: St(6)        ! current position in the stencil
+    INTEGER(IntKi)                                  :: Stride(6)
+    REAL(R8Ki)                                      :: v(p%LkpNOut)
+    REAL(R8Ki)                                      :: s, t, wk
+    INTEGER(IntKi)                                  :: nNodes
+    INTEGER(IntKi)                                  :: nWrt
+    INTEGER(IntKi)                                  :: j, d, k, nComb
+
+    Stride(1) = 1
+    DO d = 2,6
+       Stride(d) = Stride(d-1)*p%LkpN(d-1)
+    END DO
+
+    nComb = 1
+    DO d = 1,6
+       IF (p%LkpN(d) < 2) THEN
+          nSt(d)  = 1
+          i0(d)   = 0
+          w(:,d)  = 0.0_R8Ki
+          w(0,d)  = 1.0_R8Ki
+       ELSE
+          s = (q(d) - p%LkpMin(d)) / p%LkpDelta(d)
+          s = MIN( MAX(s, 0.0_R8Ki), REAL(p%LkpN(d)-1, R8Ki) )
+          k = MIN( INT(s), p%LkpN(d)-2 )
+          t = s - k
+
+          ! Catmull-Rom weights for grid points k-1, k, k+1, k+2
+          w(0,d) = 0.5_R8Ki*( -t**3 + 2.0_R8Ki*t**2 - t )
+          w(1,d) = 0.5_R8Ki*( 3.0_R8Ki*t**3 - 5.0_R8Ki*t**2 + 2.0_R8Ki )
+          w(2,d) = 0.5_R8Ki*( -3.0_R8Ki*t**3 + 4.0_R8Ki*t**2 + t )
+          w(3,d) = 0.5_R8Ki*( t**3 - t**2 )
+
+          ! fold points outside the box into their linear extrapolation from the boundary
+          IF (k == 0) THEN
+             w(1,d) = w(1,d) + 2.0_R8Ki*w(0,d)
+             w(2,d) = w(2,d) - w(0,d)
+             w(0,d) = 0.0_R8Ki
+          END IF
+          IF (k == p%LkpN(d)-2) THEN
+             w(2,d) = w(2,d) + 2.0_R8Ki*w(3,d)
+             w(1,d) = w(1,d) - w(3,d)
+             w(3,d) = 0.0_R8Ki
+          END IF
+
+          nSt(d) = 4
+          i0(d)  = k - 1
+       END IF
+       nComb = nComb*nSt(d)
+    END DO
+
+    v  = 0.0_R8Ki
+    St = 0
+    DO k = 1,nComb
+       wk = 1.0_R8Ki
+       j  = 0
+       DO d = 1,6
+          wk = wk*w(St(d),d)
+          j  = j + (i0(d) + St(d))*Stride(d)
+       END DO
+       IF (wk /= 0.0_R8Ki) THEN
+          j = j*p%LkpNOut
+          v = v + wk*p%LkpTable(j+1:j+p%LkpNOut)
+       END IF
+
+       ! advance the mixed-radix stencil counter
+       DO d = 1,6
+          St(d) = St(d) + 1
+          IF (St(d) < nSt(d)) EXIT
+          St(d) = 0
+       END DO
+    END DO
+
+    ! the constraint states are stored at the end of each record
+    j = p%LkpNOut - ( SIZE(z%H) + SIZE(z%V) + SIZE(z%x) + SIZE(z%y) + SIZE(z%z) )
+    z%H = v(j+1 : j+SIZE(z%H));  j = j + SIZE(z%H)
+    z%V = v(j+1 : j+SIZE(z%V));  j = j + SIZE(z%V)
+    z%x = v(j+1 : j+SIZE(z%x));  j = j + SIZE(z%x)
+    z%y = v(j+1 : j+SIZE(z%y));  j = j + SIZE(z%y)
+    z%z = v(j+1 : j+SIZE(z%z))
+
+    IF (.NOT. PRESENT(y)) RETURN
+    nNodes = SIZE(y%FX)
+    nWrt   = p%LkpNOut - 3*nNodes - ( SIZE(z%H) + SIZE(z%V) + SIZE(z%x) + SIZE(z%y) + SIZE(z%z) )
+    y%FX(1:nNodes) = v(         1 :   nNodes)
+    y%FY(1:nNodes) = v(  nNodes+1 : 2*nNodes)
+    y%FZ(1:nNodes) = v(2*nNodes+1 : 3*nNodes)
+    IF (nWrt > 0) y%WrtOutput(1:nWrt) = v(3*nNodes+1 : 3*nNodes+nWrt)
+  END SUBROUTINE MAP_Lookup_Interp                                                              !   -------+
+  !==========================================================================================================
+
+
   !==========   MAP_End   ======     <----------------------------------------------------------------------+
   SUBROUTINE MAP_End(u, p, x, xd, z, other, y, ErrStat , ErrMsg)                           
     TYPE( MAP_InputType ) ,           INTENT(INOUT) :: u                                 
@@ -951,6 +1455,16 @@ IF (ErrStat >= AbortErrLev) RETURN
       CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat,ErrMsg, RoutineName)
    
 
+    ! the lookup-table arrays are allocated in Fortran; release them before the pointers are reset from the C objects
+    IF (ASSOCIATED(p%LkpN))     DEALLOCATE(p%LkpN)
+    IF (ASSOCIATED(p%LkpMin))   DEALLOCATE(p%LkpMin)
+    IF (ASSOCIATED(p%LkpDelta)) DEALLOCATE(p%LkpDelta)
+    IF (ASSOCIATED(p%LkpTable)) DEALLOCATE(p%LkpTable)
+    p%C_obj%LkpN     = C_NULL_PTR; p%C_obj%LkpN_Len     = 0
+    p%C_obj%LkpMin   = C_NULL_PTR; p%C_obj%LkpMin_Len   = 0
+    p%C_obj%LkpDelta = C_NULL_PTR; p%C_obj%LkpDelta_Len = 0
+    p%C_obj%LkpTable = C_NULL_PTR; p%C_obj%LkpTable_Len = 0
+
     ! bjj: we need to nullify Fortran pointers that were associated with C_F_POINTER in the Init routine:
     !        
     CALL MAP_C2Fary_CopyConstrState(z, ErrStat2, ErrMsg2);    CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat,ErrMsg, RoutineName)
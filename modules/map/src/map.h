@@ -68,7 +68,8 @@ typedef enum NodeType_enum {
 typedef enum FdType_enum {
   BACKWARD_DIFFERENCE, /**< */
   CENTRAL_DIFFERENCE,  /**< */
-  FORWARD_DIFFERENCE   /**< */
+  FORWARD_DIFFERENCE,  /**< */
+  ANALYTIC_JACOBIAN    /**< catenary derivatives; falls back to BACKWARD_DIFFERENCE for linear springs */
 } FdType;
 
 
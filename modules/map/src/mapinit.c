@@ -217,7 +217,7 @@ void initialize_model_option_defaults(DomainOptions* options)
 /* deallocated in free_outer_solve_data() */
 void initialize_outer_solve_data_defaults(OuterSolveAttributes* outer) 
 {
-  outer->fd = BACKWARD_DIFFERENCE;
+  outer->fd = ANALYTIC_JACOBIAN;
   outer->pg = false;
   outer->krylov_accelerator = false;
   outer->powell = false;
@@ -849,6 +849,18 @@ MAP_ERROR_CODE check_outer_fd_flag(struct bstrList* list, FdType* fd)
 };
 
 
+MAP_ERROR_CODE check_outer_aj_flag(struct bstrList* list, FdType* aj)
+{
+  int success = 0;
+
+  success = biseqcstrcaseless(list->entry[0],"OUTER_AJ"); /* string compare */
+  if (success) {
+    *aj = ANALYTIC_JACOBIAN;
+  };
+  return MAP_SAFE;
+};
+
+
 MAP_ERROR_CODE check_wave_kinematics_flag(struct bstrList* list, bool* wave)
 {
   int success = 0;
@@ -1020,6 +1032,8 @@ MAP_ERROR_CODE check_uncaught_flag(struct bstrList* list)
     return MAP_SAFE;
   } else if (biseqcstrcaseless(list->entry[0],"OUTER_FD")) {
     return MAP_SAFE;
+  } else if (biseqcstrcaseless(list->entry[0],"OUTER_AJ")) {
+    return MAP_SAFE;
   } else if (biseqcstrcaseless(list->entry[0],"WAVE_KINEMATICS")) {
     return MAP_SAFE;
   } else if (biseqcstrcaseless(list->entry[0],"LM_MODEL")) {
@@ -1034,6 +1048,8 @@ MAP_ERROR_CODE check_uncaught_flag(struct bstrList* list)
     return MAP_SAFE;
   } else if (biseqcstrcaseless(list->entry[0],"REF_POSITION")) {
     return MAP_SAFE;
+  } else if (biseqcstrcaseless(list->entry[0],"LOOKUP")) { /* read by the Fortran glue code */
+    return MAP_SAFE;
   }; 
   return MAP_WARNING;
 };
@@ -1156,6 +1172,7 @@ MAP_ERROR_CODE set_model_options_list(Domain* domain, InitializationData* init_d
     success = check_outer_bd_flag(parsed, &domain->outer_loop.fd);
     success = check_outer_cd_flag(parsed, &domain->outer_loop.fd);
     success = check_outer_fd_flag(parsed, &domain->outer_loop.fd);      
+    success = check_outer_aj_flag(parsed, &domain->outer_loop.fd);
     success = check_wave_kinematics_flag(parsed, &domain->model_options.wave_kinematics); CHECKERRK(MAP_WARNING_10);
     success = check_lm_model_flag(parsed, &domain->model_options.lm_model); CHECKERRK(MAP_WARNING_11);
     success = check_pg_cooked_flag(parsed, &domain->outer_loop); CHECKERRK(MAP_WARNING_8);
@@ -2829,9 +2846,11 @@ MAP_ERROR_CODE print_help_to_screen()
   printf("      -outer_bd,\n");
   printf("      -outer_cd,\n");
   printf("      -outer_fd,\n");
+  printf("      -outer_aj,           --Analytic outer-loop Jacobian (default)\n");
   printf("      -pg_cooked <1000.0> <1.0>,\n");
   printf("      -krylov_accelerator <3>,\n");
   printf("      -integration_dt <0.01>,\n");
+  printf("      -lookup <dof> <min> <max> <n>, --Tabulate fairlead loads over an offset box\n");
   printf("    LM model feature (not suported yet):\n");
   printf("      -kb_default      --Seabed stiffness parameter\n");
   printf("      -cb_default      --Seabed damping parameter\n");
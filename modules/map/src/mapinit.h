@@ -167,10 +167,12 @@ void initialize_outer_solve_data_defaults(OuterSolveAttributes* outer);
  *          outer_bd
  *          outer_cd
  *          outer_fd
+ *          outer_aj
  *          pg_cooked (not compatible with krylov_accelerator option)
  *          krylov_accelerator (not compatible ith pg_cooked option)
  *          repeat
  *          ref_position
+ *          lookup (tabulated fairlead loads, read by the Fortran glue code)
  *          </pre>
  * @param   domain, MAP interal data construct
  * @param   init_data, initialization input strings
@@ -375,6 +377,24 @@ MAP_ERROR_CODE check_outer_cd_flag(struct bstrList* list, FdType* cd);
 MAP_ERROR_CODE check_outer_fd_flag(struct bstrList* list, FdType* fd);
 
 
+/**
+ * @brief   Sets FdType type to ANALYTIC_JACOBIAN
+ * @details Called by {@link set_model_option_list} to build the outer-loop Jacobian 
+ *          from the closed-form catenary derivatives instead of finite differences. 
+ *          This is the default. Lines modeled as linear springs revert to the 
+ *          backward-difference Jacobian.
+ *          MAP input file syntax:
+ *          <pre>
+ *          outer_aj
+ *          </pre>
+ * @param   list, a character array structure
+ * @param   aj, finite difference type
+ * @see     set_model_options_list(), map_init()
+ * @return  MAP error code
+ */
+MAP_ERROR_CODE check_outer_aj_flag(struct bstrList* list, FdType* aj);
+
+
 /**
  * @brief   Sets DS and DSM preconditioning coefficients for outer-loop solver
  * @details Called by {@link set_model_option_list} to set preconditioner coefficients
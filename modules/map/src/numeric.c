@@ -174,6 +174,75 @@ MAP_ERROR_CODE lu_back_substitution(OuterSolveAttributes* ns, const int n, char*
 };
 
 
+/* Plain Newton iterations on the catenary equations, starting from the previous solution in 
+ * inner_opt->x. Between coupling steps the fairlead moves little, so the previous (H,V) is almost 
+ * always inside the quadratic convergence region and this avoids the overhead of lmder. Returns 
+ * true when the relative Newton step falls below x_tol; false tells the caller to fall back to lmder.
+ */
+static bool inner_newton_warm_start(Line* line, InnerSolveAttributes* inner_opt)
+{
+  const double EA = line->line_property->EA;
+  const double Lu = line->Lu.value;
+  const double omega = line->line_property->omega;
+  const double cb = line->line_property->cb;
+  const bool contactFlag = line->options.omit_contact;
+  const int max_its = 10;
+  double H = inner_opt->x[0];
+  double V = inner_opt->x[1];
+  double x[2];
+  double dxdh = 0.0;
+  double dxdv = 0.0;
+  double dzdh = 0.0;
+  double dzdv = 0.0;
+  double det = 0.0;
+  double dH = 0.0;
+  double dV = 0.0;
+  int i = 0;
+
+  for (i=0 ; i<max_its ; i++) {
+    x[0] = H;
+    x[1] = V;
+    inner_function_evals(line, inner_opt->m, inner_opt->n, x, inner_opt->fvec, inner_opt->fjac, inner_opt->ldfjac, 1);
+    line->evals++;
+    if (contactFlag==true || omega<0.0 || (V-omega*Lu)>0.0) { /* same branch as inner_function_evals() */
+      dxdh = jacobian_dxdh_no_contact(V, H, omega, Lu, EA);
+      dxdv = jacobian_dxdv_no_contact(V, H, omega, Lu, EA);
+      dzdh = jacobian_dzdh_no_contact(V, H, omega, Lu, EA);
+      dzdv = jacobian_dzdv_no_contact(V, H, omega, Lu, EA);
+    } else {
+      dxdh = jacobian_dxdh_contact(V, H, omega, Lu, EA, cb);
+      dxdv = jacobian_dxdv_contact(V, H, omega, Lu, EA, cb);
+      dzdh = jacobian_dzdh_contact(V, H, omega, Lu, EA, cb);
+      dzdv = jacobian_dzdv_contact(V, H, omega, Lu, EA, cb);
+    };
+    line->njac_evals++;
+
+    det = dxdh*dzdv - dxdv*dzdh;
+    if (!(fabs(det)>MACHINE_EPSILON)) { /* also catches NaN */
+      return false;
+    };
+    dH = (dzdv*inner_opt->fvec[0] - dxdv*inner_opt->fvec[1])/det;
+    dV = (dxdh*inner_opt->fvec[1] - dzdh*inner_opt->fvec[0])/det;
+    H -= dH;
+    V -= dV;
+    if (!(H>MAP_HORIZONTAL_TOL)) { /* left the physical region (or NaN); let lmder handle it */
+      return false;
+    };
+
+    if (fabs(dH)<=inner_opt->x_tol*H && fabs(dV)<=inner_opt->x_tol*(fabs(V)+H)) {
+      inner_opt->x[0] = H;
+      inner_opt->x[1] = V;
+      x[0] = H;
+      x[1] = V;
+      inner_function_evals(line, inner_opt->m, inner_opt->n, x, inner_opt->fvec, inner_opt->fjac, inner_opt->ldfjac, 1);
+      line->evals++;
+      return true;
+    };
+  };
+  return false;
+};
+
+
 MAP_ERROR_CODE call_minpack_lmder(Line* line, InnerSolveAttributes* inner_opt, const int line_num, const float time, char* map_msg, MAP_ERROR_CODE* ierr)
 {
   MAP_ERROR_CODE success = MAP_SAFE;
@@ -186,30 +255,36 @@ MAP_ERROR_CODE call_minpack_lmder(Line* line, InnerSolveAttributes* inner_opt, c
   line->evals = 0;
   line->njac_evals = 0;
 
-  inner_opt->info = __cminpack_func__(lmder)(inner_function_evals, 
-                                      line, 
-                                      inner_opt->m, 
-                                      inner_opt->n, 
-                                      inner_opt->x, 
-                                      inner_opt->fvec, 
-                                      inner_opt->fjac, 
-                                      inner_opt->ldfjac, 
-                                      inner_opt->f_tol, 
-                                      inner_opt->x_tol, 
-                                      inner_opt->g_tol, 
-                                      inner_opt->max_its, 
-                                      inner_opt->diag,
-                                      inner_opt->mode, 
-                                      inner_opt->factor, 
-                                      inner_opt->nprint, 
-                                      &line->evals, 
-                                      &line->njac_evals, 
-                                      inner_opt->ipvt, 
-                                      inner_opt->qtf, 
-                                      inner_opt->wa1 ,
-                                      inner_opt->wa2 ,
-                                      inner_opt->wa3 , 
-                                      inner_opt->wa4);
+  if (inner_newton_warm_start(line, inner_opt)) {
+    inner_opt->info = 2; /* same meaning as lmder: relative error between two consecutive iterates is at most x_tol */
+  } else {
+    inner_opt->x[0] = fabs(*(line->H.value)) > MAP_HORIZONTAL_TOL ? fabs(*(line->H.value)) : MAP_HORIZONTAL_TOL;
+    inner_opt->x[1] = *(line->V.value);
+    inner_opt->info = __cminpack_func__(lmder)(inner_function_evals, 
+                                        line, 
+                                        inner_opt->m, 
+                                        inner_opt->n, 
+                                        inner_opt->x, 
+                                        inner_opt->fvec, 
+                                        inner_opt->fjac, 
+                                        inner_opt->ldfjac, 
+                                        inner_opt->f_tol, 
+                                        inner_opt->x_tol, 
+                                        inner_opt->g_tol, 
+                                        inner_opt->max_its, 
+                                        inner_opt->diag,
+                                        inner_opt->mode, 
+                                        inner_opt->factor, 
+                                        inner_opt->nprint, 
+                                        &line->evals, 
+                                        &line->njac_evals, 
+                                        inner_opt->ipvt, 
+                                        inner_opt->qtf, 
+                                        inner_opt->wa1 ,
+                                        inner_opt->wa2 ,
+                                        inner_opt->wa3 , 
+                                        inner_opt->wa4);
+  };
   
   line->residual_norm = (double)__minpack_func__(enorm)(&inner_opt->m, inner_opt->fvec);
   
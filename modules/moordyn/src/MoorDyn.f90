@@ -181,6 +181,8 @@ CONTAINS
       ! set default values for the simulation settings
       ! these defaults are based on the glue code
       p%dtM0                 = DTcoupling      ! default to the coupling interval (but will likely need to be smaller)
+      p%rTol                 = 1.0E-4_DbKi     ! error tolerances of the adaptive RK23 scheme
+      p%aTol                 = 1.0E-6_DbKi
       p%Tmax                 = InitInp%Tmax
       p%g                    = InitInp%g
       p%rhoW                 = InitInp%rhoW
@@ -453,6 +455,10 @@ CONTAINS
                      read (OptValue,*) p%dtM0 
                   else if ( OptString == 'TSCHEME') THEN
                      read (OptValue,*) tSchemeString
+                  else if ( OptString == 'RTOL') THEN
+                     read (OptValue,*) p%rTol
+                  else if ( OptString == 'ATOL') THEN
+                     read (OptValue,*) p%aTol
                   else if ( OptString == 'G') then
                      read (OptValue,*) p%g
                   else if (( OptString == 'RHOW') .or. ( OptString == 'RHO')) then
@@ -506,6 +512,8 @@ CONTAINS
                   write(p%UnLog, '(A)'        ) "  - Options List:"
                   write(p%UnLog, '(A17,f12.4)') "   dtm      : ", p%dtM0 
                   write(p%UnLog, '(A17,A)'    ) "   tScheme  : ", tSchemeString
+                  write(p%UnLog, '(A17,ES12.4)') "   rTol     : ", p%rTol
+                  write(p%UnLog, '(A17,ES12.4)') "   aTol     : ", p%aTol
                   write(p%UnLog, '(A17,f12.4)') "   g        : ", p%g
                   write(p%UnLog, '(A17,f12.4)') "   rhoW     : ", p%rhoW
                   write(p%UnLog, '(A17,A)'    ) "   Depth    : ", DepthValue    ! water depth input read in as a string to be processed by setupBathymetry
@@ -566,8 +574,12 @@ CONTAINS
          p%tScheme = 0
       ELSEIF (tSchemeString == 'RK4') THEN 
          p%tScheme = 1
+      ELSEIF (tSchemeString == 'RK23') THEN 
+         p%tScheme = 2
+      ELSEIF (tSchemeString == 'SEMIIMPLICIT') THEN 
+         p%tScheme = 3
       ELSE 
-         CALL SetErrStat( ErrID_Fatal, 'Unrecognized tScheme option: '//tSchemeString//' Only RK2 and RK4 supported in MD-F', ErrStat, ErrMsg, RoutineName )
+         CALL SetErrStat( ErrID_Fatal, 'Unrecognized tScheme option: '//tSchemeString//' Only RK2, RK4, RK23, and SemiImplicit supported in MD-F', ErrStat, ErrMsg, RoutineName )
          CALL CleanUp()
          RETURN
       ENDIF
@@ -2357,6 +2369,13 @@ CONTAINS
          m%kSum%states = 0.0_DbKi
       END IF
 
+      ! Allocate the stage slopes if using the adaptive RK23 method, which starts from the requested time step
+      IF (p%tScheme == 2_Intki) THEN 
+         ALLOCATE (m%kRK23(m%Nxtra,4), STAT = ErrStat2)
+         m%kRK23  = 0.0_DbKi
+         m%dtAdapt = min(p%dtM0, DTcoupling)
+      END IF
+
       IF ( ErrStat2 /= ErrID_None ) THEN
          ErrMsg  = ' Error allocating state vectors.'
          !CALL CleanUp()
@@ -3452,9 +3471,19 @@ CONTAINS
       CALL MD_CopyInput(u(1), u_interp, MESH_NEWCOPY, ErrStat, ErrMsg)
 
 
-      ! round dt to integer number of time steps   <<<< should this be calculated only once, up front?
-      NdtM = ceiling(p%dtCoupling/p%dtM0)            ! get number of mooring time steps to do based on desired time step size
-      dtM = p%dtCoupling/REAL(NdtM,DbKi)             ! adjust desired time step to satisfy dt with an integer number of time steps
+      IF (p%tScheme == 2_IntKi) THEN
+         ! adaptive RK23: step sizes are chosen by error control to cover the coupling interval
+         CALL MD_RK23Adaptive(t2, p%dtCoupling, u_interp, u, t_array, p, x, xd, z, other, m, ErrStat2, ErrMsg2)
+         IF ( ErrStat2 /= ErrID_None ) THEN
+            CALL CheckError(ErrStat2, ErrMsg2)
+            IF ( ErrStat >= AbortErrLev ) RETURN
+         END IF
+         NdtM = 0                                    ! no fixed steps left to take
+      ELSE
+         ! round dt to integer number of time steps   <<<< should this be calculated only once, up front?
+         NdtM = ceiling(p%dtCoupling/p%dtM0)            ! get number of mooring time steps to do based on desired time step size
+         dtM = p%dtCoupling/REAL(NdtM,DbKi)             ! adjust desired time step to satisfy dt with an integer number of time steps
+      END IF
 
 
       !loop through line integration time steps
@@ -3935,6 +3964,8 @@ CONTAINS
       REAL(DbKi)                                         :: rd_in(3) ! temporary for passing kinematics
       REAL(DbKi)                                         :: a_in(3)  ! temporary for passing kinematics
 
+      TYPE(GridInterp_MiscVarType)                       :: WaveField_mThd ! per-thread wave field interpolation scratch for the line loop
+
       INTEGER(IntKi)                                     :: ErrStat2 ! Error status of the operation
       CHARACTER(ErrMsgLen)                               :: ErrMsg2  ! Error message if ErrStat2 /= ErrID_None
       character(*), parameter                            :: RoutineName = 'MD_CalcContStateDeriv'
@@ -4133,12 +4164,25 @@ CONTAINS
       ! calculate dynamics of free objects (will also calculate forces (doRHS()) from any child/dependent objects)...
          
       ! calculate line dynamics (and calculate line forces and masses attributed to points)
+      ! Each line only updates its own data here, so lines are processed concurrently. The line-end forces are 
+      ! summed onto points, rods, and bodies below in a fixed order, so results do not depend on the thread count.
+      !$OMP PARALLEL DEFAULT(SHARED) PRIVATE(l, ErrStat2, ErrMsg2, WaveField_mThd)
+      WaveField_mThd = m%WaveField_m   ! each thread gets its own wave field interpolation scratch
+      !$OMP DO SCHEDULE(DYNAMIC)
       DO l = 1,p%nLines
-         CALL Line_GetStateDeriv(m%LineList(l), dxdt%states(m%LineStateIs1(l):m%LineStateIsN(l)), m, p, ErrStat, ErrMsg)  !dt might also be passed for fancy friction models
-         if (ErrStat == ErrID_Fatal) then
-            return
-         endif
+         CALL Line_GetStateDeriv(m%LineList(l), dxdt%states(m%LineStateIs1(l):m%LineStateIsN(l)), m, p, ErrStat2, ErrMsg2, WaveField_mThd)  !dt might also be passed for fancy friction models
+         if (ErrStat2 /= ErrID_None) then
+            !$OMP CRITICAL(MD_LineDeriv)
+            CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+            !$OMP END CRITICAL(MD_LineDeriv)
+         end if
       END DO
+      !$OMP END DO
+      !$OMP CRITICAL(MD_LineDeriv)
+      m%WaveField_m%FirstWarn_Clamp = m%WaveField_m%FirstWarn_Clamp .and. WaveField_mThd%FirstWarn_Clamp
+      !$OMP END CRITICAL(MD_LineDeriv)
+      !$OMP END PARALLEL
+      if (ErrStat >= AbortErrLev) return
       
       ! calculate point dynamics (including contributions from attached lines
       ! as well as hydrodynamic forces etc. on point object itself if applicable)
@@ -4306,10 +4350,20 @@ CONTAINS
       INTEGER(IntKi)                 , INTENT(  OUT)      :: ErrStat
       CHARACTER(*)                   , INTENT(  OUT)      :: ErrMsg
 
+      REAL(DbKi)                                          :: ErrNorm    ! error estimate of an RK23 step (unused for fixed steps)
+
       IF (p%tScheme == 0_Intki) THEN
          CALL MD_RK2(t, dtM, u_interp, u, t_array, p, x, xd, z, other, m, ErrStat, ErrMsg)
       ELSEIF (p%tScheme == 1_Intki) THEN
          CALL MD_RK4(t, dtM, u_interp, u, t_array, p, x, xd, z, other, m, ErrStat, ErrMsg)
+      ELSEIF (p%tScheme == 2_Intki) THEN
+         ! fixed step (e.g. during IC generation): accept the third-order solution regardless of the error estimate
+         CALL MD_RK23(t, dtM, u_interp, u, t_array, p, x, xd, z, other, m, .FALSE., ErrNorm, ErrStat, ErrMsg)
+         IF ( ErrStat >= AbortErrLev ) RETURN
+         x%states(1:m%Nx) = m%xTemp%states(1:m%Nx)
+         t = t + dtM
+      ELSEIF (p%tScheme == 3_Intki) THEN
+         CALL MD_SemiImplicit(t, dtM, u_interp, u, t_array, p, x, xd, z, other, m, ErrStat, ErrMsg)
       ELSE
          ErrStat = ErrID_Fatal
          ErrMsg = ' Unrecognized tScheme option in MD_Step'
@@ -4465,6 +4519,215 @@ CONTAINS
    END SUBROUTINE MD_RK4
    !--------------------------------------------------------------
 
+   ! Bogacki-Shampine RK23 step with embedded second-order error estimate. The third-order solution is left in 
+   ! m%xTemp (and its slope in m%kRK23(:,4)); x and t are not changed so that the caller can reject the step.
+   !--------------------------------------------------------------
+   SUBROUTINE MD_RK23 ( t, dtM, u_interp, u, t_array, p, x, xd, z, other, m, FSAL, ErrNorm, ErrStat, ErrMsg )
+   
+      REAL(DbKi)                     , INTENT(IN   )      :: t          ! intial time (s) for this integration step
+      REAL(DbKi)                     , INTENT(IN   )      :: dtM        ! single time step  size (s) for this integration step
+      TYPE( MD_InputType )           , INTENT(INOUT)      :: u_interp   ! interpolated instantaneous input values to be calculated for each mooring time step
+      TYPE( MD_InputType )           , INTENT(INOUT)      :: u(:)       ! INTENT(IN   )
+      REAL(DbKi)                     , INTENT(IN   )      :: t_array(:)  ! times corresponding to elements of u(:)?
+      TYPE( MD_ParameterType )       , INTENT(IN   )      :: p          ! INTENT(IN   )
+      TYPE( MD_ContinuousStateType ) , INTENT(IN   )      :: x
+      TYPE( MD_DiscreteStateType )   , INTENT(IN   )      :: xd         ! INTENT(IN   )
+      TYPE( MD_ConstraintStateType ) , INTENT(IN   )      :: z          ! INTENT(IN   )
+      TYPE( MD_OtherStateType )      , INTENT(IN   )      :: other      ! INTENT(INOUT)
+      TYPE(MD_MiscVarType)           , INTENT(INOUT)      :: m          ! INTENT(INOUT)
+      LOGICAL                        , INTENT(IN   )      :: FSAL       ! true if m%kRK23(:,4) already holds the slope at (t, x) from the previous accepted step
+      REAL(DbKi)                     , INTENT(  OUT)      :: ErrNorm    ! error estimate scaled by the tolerances (step is acceptable if <= 1)
+      INTEGER(IntKi)                 , INTENT(  OUT)      :: ErrStat
+      CHARACTER(*)                   , INTENT(  OUT)      :: ErrMsg
+
+      INTEGER(IntKi)                                      :: J          ! counter
+      REAL(DbKi)                                          :: ErrJ       ! error estimate of one state
+
+      ErrNorm = 0.0_DbKi
+
+      ! k1
+      IF (FSAL) THEN
+         ErrStat = ErrID_None
+         ErrMsg  = ""
+         m%kRK23(1:m%Nx,1) = m%kRK23(1:m%Nx,4)
+      ELSE
+         CALL MD_Input_ExtrapInterp(u, t_array, u_interp, t          , ErrStat, ErrMsg)   ! interpolate input mesh to correct time (t)
+         if ( ErrStat >= AbortErrLev ) return
+
+         CALL MD_CalcContStateDeriv( t, u_interp, p, x, xd, z, other, m, m%xdTemp, ErrStat, ErrMsg ) 
+         if ( ErrStat >= AbortErrLev ) return
+         m%kRK23(1:m%Nx,1) = m%xdTemp%states(1:m%Nx)
+      END IF
+
+      ! k2
+      DO J = 1, m%Nx
+         m%xTemp%states(J) = x%states(J) + 0.5_DbKi*dtM*m%kRK23(J,1)
+      END DO
+
+      CALL MD_Input_ExtrapInterp(u, t_array, u_interp, t + 0.5_DbKi*dtM, ErrStat, ErrMsg)
+      if ( ErrStat >= AbortErrLev ) return
+
+      CALL MD_CalcContStateDeriv( (t + 0.5_DbKi*dtM), u_interp, p, m%xTemp, xd, z, other, m, m%xdTemp, ErrStat, ErrMsg ) 
+      if ( ErrStat >= AbortErrLev ) return
+      m%kRK23(1:m%Nx,2) = m%xdTemp%states(1:m%Nx)
+
+      ! k3
+      DO J = 1, m%Nx
+         m%xTemp%states(J) = x%states(J) + 0.75_DbKi*dtM*m%kRK23(J,2)
+      END DO
+
+      CALL MD_Input_ExtrapInterp(u, t_array, u_interp, t + 0.75_DbKi*dtM, ErrStat, ErrMsg)
+      if ( ErrStat >= AbortErrLev ) return
+
+      CALL MD_CalcContStateDeriv( (t + 0.75_DbKi*dtM), u_interp, p, m%xTemp, xd, z, other, m, m%xdTemp, ErrStat, ErrMsg ) 
+      if ( ErrStat >= AbortErrLev ) return
+      m%kRK23(1:m%Nx,3) = m%xdTemp%states(1:m%Nx)
+
+      ! third-order solution, and k4 at it (reused as k1 of the next step)
+      DO J = 1, m%Nx
+         m%xTemp%states(J) = x%states(J) + dtM*( 2.0_DbKi*m%kRK23(J,1) + 3.0_DbKi*m%kRK23(J,2) + 4.0_DbKi*m%kRK23(J,3) )/9.0_DbKi
+      END DO
+
+      CALL MD_Input_ExtrapInterp(u, t_array, u_interp, t + dtM, ErrStat, ErrMsg)
+      if ( ErrStat >= AbortErrLev ) return
+
+      CALL MD_CalcContStateDeriv( (t + dtM), u_interp, p, m%xTemp, xd, z, other, m, m%xdTemp, ErrStat, ErrMsg ) 
+      if ( ErrStat >= AbortErrLev ) return
+      m%kRK23(1:m%Nx,4) = m%xdTemp%states(1:m%Nx)
+
+      ! difference to the embedded second-order solution, in the max norm scaled by the tolerances
+      DO J = 1, m%Nx
+         ErrJ = dtM*( -5.0_DbKi*m%kRK23(J,1)/72.0_DbKi + m%kRK23(J,2)/12.0_DbKi + m%kRK23(J,3)/9.0_DbKi - 0.125_DbKi*m%kRK23(J,4) )
+         IF (Is_NaN(ErrJ)) THEN
+            ErrNorm = HUGE(ErrNorm)   ! forces the step to be rejected
+            EXIT
+         END IF
+         ErrNorm = max( ErrNorm, abs(ErrJ)/( p%aTol + p%rTol*max(abs(x%states(J)), abs(m%xTemp%states(J))) ) )
+      END DO
+
+   END SUBROUTINE MD_RK23
+   !--------------------------------------------------------------
+
+   ! Adaptive RK23 integration over an interval, with the step size adjusted by the embedded error estimate.
+   ! The last accepted step size is kept in m%dtAdapt as the starting guess for the next interval.
+   !--------------------------------------------------------------
+   SUBROUTINE MD_RK23Adaptive ( t, dtInt, u_interp, u, t_array, p, x, xd, z, other, m, ErrStat, ErrMsg )
+   
+      REAL(DbKi)                     , INTENT(INOUT)      :: t          ! intial time (s), advanced to the end of the interval
+      REAL(DbKi)                     , INTENT(IN   )      :: dtInt      ! length of the interval to integrate over (s)
+      TYPE( MD_InputType )           , INTENT(INOUT)      :: u_interp   ! interpolated instantaneous input values to be calculated for each mooring time step
+      TYPE( MD_InputType )           , INTENT(INOUT)      :: u(:)       ! INTENT(IN   )
+      REAL(DbKi)                     , INTENT(IN   )      :: t_array(:)  ! times corresponding to elements of u(:)?
+      TYPE( MD_ParameterType )       , INTENT(IN   )      :: p          ! INTENT(IN   )
+      TYPE( MD_ContinuousStateType ) , INTENT(INOUT)      :: x
+      TYPE( MD_DiscreteStateType )   , INTENT(IN   )      :: xd         ! INTENT(IN   )
+      TYPE( MD_ConstraintStateType ) , INTENT(IN   )      :: z          ! INTENT(IN   )
+      TYPE( MD_OtherStateType )      , INTENT(IN   )      :: other      ! INTENT(INOUT)
+      TYPE(MD_MiscVarType)           , INTENT(INOUT)      :: m          ! INTENT(INOUT)
+      INTEGER(IntKi)                 , INTENT(  OUT)      :: ErrStat
+      CHARACTER(*)                   , INTENT(  OUT)      :: ErrMsg
+
+      REAL(DbKi)                                          :: tEnd       ! end of the interval
+      REAL(DbKi)                                          :: h          ! trial step size
+      REAL(DbKi)                                          :: hMin       ! smallest step size allowed before giving up
+      REAL(DbKi)                                          :: ErrNorm    ! scaled error estimate of the trial step
+      REAL(DbKi)                                          :: fac        ! step size change factor
+      LOGICAL                                             :: FSAL       ! whether the first slope of the step is known from the last accepted step
+      LOGICAL                                             :: Clipped    ! whether the trial step was shortened to land on tEnd
+
+      ErrStat = ErrID_None
+      ErrMsg  = ""
+
+      tEnd = t + dtInt
+      hMin = 1.0E-8_DbKi*dtInt
+      FSAL = .FALSE.   ! states may have changed since the last interval (e.g. line failures), so start fresh
+
+      DO WHILE ( tEnd - t > hMin )
+
+         h = min( m%dtAdapt, dtInt )
+         Clipped = ( t + h > tEnd - hMin )
+         if (Clipped) h = tEnd - t
+
+         CALL MD_RK23(t, h, u_interp, u, t_array, p, x, xd, z, other, m, FSAL, ErrNorm, ErrStat, ErrMsg)
+         if ( ErrStat >= AbortErrLev ) return
+
+         ! standard step size controller for a third-order method with a safety factor, limited to [0.2, 5]
+         if (ErrNorm > 0.0_DbKi) then
+            fac = min( 5.0_DbKi, max( 0.2_DbKi, 0.9_DbKi*ErrNorm**(-1.0_DbKi/3.0_DbKi) ) )
+         else
+            fac = 5.0_DbKi
+         end if
+
+         if (ErrNorm <= 1.0_DbKi) then
+            ! accept
+            x%states(1:m%Nx) = m%xTemp%states(1:m%Nx)
+            t    = t + h
+            FSAL = .TRUE.
+            if (.not. Clipped .or. fac < 1.0_DbKi) m%dtAdapt = h*fac   ! a step shortened to hit tEnd says little about the next one
+         else
+            ! reject and retry with a smaller step
+            m%kRK23(1:m%Nx,4) = m%kRK23(1:m%Nx,1)   ! the slope at (t, x) is still valid for the retry
+            FSAL = .TRUE.
+            m%dtAdapt = h*min( fac, 0.5_DbKi )
+            if (m%dtAdapt < hMin) then
+               ErrStat = ErrID_Fatal
+               ErrMsg  = ' MD_RK23Adaptive: step size fell below '//trim(Num2LStr(hMin))//' s at time '//trim(Num2LStr(t))//'. Check the model or loosen rTol/aTol.'
+               return
+            end if
+         end if
+
+      END DO
+
+      t = tEnd
+
+   END SUBROUTINE MD_RK23Adaptive
+   !--------------------------------------------------------------
+
+   ! Semi-implicit Euler step: every state is advanced with the slopes at (t, x), except the internal line 
+   ! nodes, whose axial stiffness and damping are treated implicitly (see Line_SemiImplicitStep). This lets
+   ! stiff lines run at time steps well above their explicit stability limit.
+   !--------------------------------------------------------------
+   SUBROUTINE MD_SemiImplicit ( t, dtM, u_interp, u, t_array, p, x, xd, z, other, m, ErrStat, ErrMsg )
+   
+      REAL(DbKi)                     , INTENT(INOUT)      :: t          ! intial time (s) for this integration step
+      REAL(DbKi)                     , INTENT(IN   )      :: dtM        ! single time step  size (s) for this integration step
+      TYPE( MD_InputType )           , INTENT(INOUT)      :: u_interp   ! interpolated instantaneous input values to be calculated for each mooring time step
+      TYPE( MD_InputType )           , INTENT(INOUT)      :: u(:)       ! INTENT(IN   )
+      REAL(DbKi)                     , INTENT(IN   )      :: t_array(:)  ! times corresponding to elements of u(:)?
+      TYPE( MD_ParameterType )       , INTENT(IN   )      :: p          ! INTENT(IN   )
+      TYPE( MD_ContinuousStateType ) , INTENT(INOUT)      :: x
+      TYPE( MD_DiscreteStateType )   , INTENT(IN   )      :: xd         ! INTENT(IN   )
+      TYPE( MD_ConstraintStateType ) , INTENT(IN   )      :: z          ! INTENT(IN   )
+      TYPE( MD_OtherStateType )      , INTENT(IN   )      :: other      ! INTENT(INOUT)
+      TYPE(MD_MiscVarType)           , INTENT(INOUT)      :: m          ! INTENT(INOUT)
+      INTEGER(IntKi)                 , INTENT(  OUT)      :: ErrStat
+      CHARACTER(*)                   , INTENT(  OUT)      :: ErrMsg
+
+      INTEGER(IntKi)                                      :: J          ! counter
+      INTEGER(IntKi)                                      :: l          ! line index
+
+      CALL MD_Input_ExtrapInterp(u, t_array, u_interp, t          , ErrStat, ErrMsg)   ! interpolate input mesh to correct time (t)
+      if ( ErrStat >= AbortErrLev ) return
+
+      ! this also leaves the forces and mass matrices of each line at (t, x) for the implicit solve
+      CALL MD_CalcContStateDeriv( t, u_interp, p, x, xd, z, other, m, m%xdTemp, ErrStat, ErrMsg ) 
+      if ( ErrStat >= AbortErrLev ) return
+
+      DO J = 1, m%Nx
+         m%xTemp%states(J) = x%states(J) + dtM*m%xdTemp%states(J)
+      END DO
+
+      DO l = 1, p%nLines
+         CALL Line_SemiImplicitStep(m%LineList(l), dtM, x%states(m%LineStateIs1(l):m%LineStateIsN(l)), m%xTemp%states(m%LineStateIs1(l):m%LineStateIsN(l)))
+      END DO
+
+      x%states(1:m%Nx) = m%xTemp%states(1:m%Nx)
+
+      t = t + dtM  ! update time
+
+   END SUBROUTINE MD_SemiImplicit
+   !--------------------------------------------------------------
+
    ! !----------------------------------------------------------------------------------------================
    ! ! this would do a full (coupling) time step and is no longer used
    ! SUBROUTINE TimeStep ( t, dtStep, u, t_array, p, x, xd, z, other, m, ErrStat, ErrMsg )
@@ -42,52 +42,6 @@ PRIVATE
 TYPE(ProgDesc), PARAMETER              :: version   = ProgDesc( 'MoorDyn library', '', '' )
 
 
-!--------------------------------------------------------------------------------------------------------------------------------------------------------
-!  Data storage
-!     All MoorDyn data is stored within the following data structures inside this
-!     module.  No data is stored within MoorDyn itself, but is instead passed in
-!     from this module.  This data is not available to the calling code unless
-!     explicitly passed through the interface (derived types such as these are
-!     non-trivial to pass through the c-bindings).
-TYPE(MD_InitInputType)                  :: InitInp             !< Input data for initialization routine
-TYPE(MD_InputType), ALLOCATABLE         :: u(:)                !< An initial guess for the input; input mesh must be defined
-TYPE(MD_ParameterType)                  :: p                   !< Parameters
-TYPE(MD_ContinuousStateType)            :: x(0:2)              !< Initial continuous states
-TYPE(MD_DiscreteStateType)              :: xd(0:2)             !< Initial discrete states
-TYPE(MD_ConstraintStateType)            :: z(0:2)              !< Initial constraint states
-TYPE(MD_OtherStateType)                 :: other(0:2)          !< Initial other states
-TYPE(MD_OutputType)                     :: y                   !< Initial system outputs (outputs are not calculated; only the output mesh is initialized)
-TYPE(MD_MiscVarType)                    :: m                   !< Initial misc/optimization variables
-TYPE(MD_InitOutputType)                 :: InitOutData         !< Output for initialization routine
-
-!--------------------------------------------------------------------------------------------------------------------------------------------------------
-! Time tracking
-!     For the solver in MD, previous timesteps input must be stored for extrapolation
-!     to the t+dt timestep.  This can be either linear (1) quadratic (2).  The
-!     InterpOrder variable tracks what this is and sets the size of the inputs `u`
-!     passed into MD. Inputs `u` will be sized as follows:
-!        linear    interp     u(2)  with inputs at T,T-dt
-!        quadratic interp     u(3)  with inputs at T,T-dt,T-2*dt
-!  Time tracking
-!     When we are performing a correction step, time information of previous
-!     calls is needed to decide how to apply correction logic or cycle the inputs
-!     and resave the previous timestep states.
-!  Correction steps
-!     OpenFAST has the ability to perform correction steps.  During a correction
-!     step, new input values are passed in but the timestep remains the same.
-!     When this occurs the new input data at time t is used with the state
-!     information from the previous timestep (t) to calculate new state values
-!     time t+dt in the UpdateStates routine.  In OpenFAST this is all handled by
-!     the glue code.  However, here we do not pass state information through the
-!     interface and therefore must store it here analogously to how it is handled
-!     in the OpenFAST glue code.
-INTEGER(IntKi)                          :: InterpOrder         !< Interpolation order: must be 1 (linear) or 2 (quadratic)
-REAL(DbKi), DIMENSION(:), ALLOCATABLE   :: InputTimes(:)       !< InputTimes array
-REAL(DbKi)                              :: InputTimePrev       !< input time of last UpdateStates call
-real(DbKi)                              :: dT_Global           !< dT of the code calling this module
-integer(IntKi)                          :: N_Global            !< global timestep
-real(DbKi)                              :: T_Initial           !< initial Time of simulation
-
 ! We are including the previous state info here (not done in OpenFAST this way)
 INTEGER(IntKi),   PARAMETER             :: STATE_LAST = 0      !< Index for previous state (not needed in OF, but necessary here)
 INTEGER(IntKi),   PARAMETER             :: STATE_CURR = 1      !< Index for current state
@@ -99,32 +53,97 @@ INTEGER(IntKi),   PARAMETER             :: INPUT_CURR = 2      !< Index for curr
 INTEGER(IntKi),   PARAMETER             :: INPUT_PRED = 1      !< Index for predicted input at t+dt
 
 !--------------------------------------------------------------------------------------------------------------------------------------------------------
-! Meshes for motions and loads
-!     Meshes are used within MD to handle all motions and loads. Rather than directly
-!     map to those nodes, we will create a mapping to go between the array of node
-!     positions passed into this module and what is used inside MD.  This is done
-!     through a pair of meshes for the motion and loads corresponding to the node
-!     positions passed in.
-!------------------------------
-!  Meshes for external nodes
-!     These point meshes are merely used to simplify the mapping of motions/loads
-!     to/from MD using the library mesh mapping routines.  The input mesh into the
-!     library can only contain one point at present and is rigidly mapped to multiple
-!     MoorDyn mesh points. This means all MoorDyn coupled objects as defined in the
-!     input file will be rigidly attached to the input mesh
-!
-!     In the future, we may wish modify this interface to allow for N mesh points
-!     for coupling to N MoorDyn mesh points for modeling things likeflexible structures.
-TYPE(MeshType)                          :: MD_MotionMesh       !< mesh for motions of external nodes
-TYPE(MeshType)                          :: MD_LoadMesh         !< mesh for loads  for external nodes
-TYPE(MeshMapType)                       :: Map_Motion_2_MD     !< Mesh mapping between input motion mesh and MD
-TYPE(MeshMapType)                       :: Map_MD_2_Load       !< Mesh mapping between MD output loads mesh and external nodes mesh
-
-! Motions input (so that we don't have to reallocate all the time)
-REAL(ReKi)                              :: tmpPositions(6,1)   !< temp array.  Probably don't need this, but makes conversion from C clearer.
-REAL(ReKi)                              :: tmpVelocities(6,1)  !< temp array.  Probably don't need this, but makes conversion from C clearer.
-REAL(ReKi)                              :: tmpAccelerations(6,1) !< temp array.  Probably don't need this, but makes conversion from C clearer.
-REAL(ReKi)                              :: tmpForces(6,1)      !< temp array.  Probably don't need this, but makes conversion to   C clearer.
+!  Instances
+!     Each instance of MoorDyn used through this interface is kept in its own
+!     MD_C_InstanceType record below.  The record is created by the first call
+!     to MD_C_SetWaveFieldData or MD_C_Init and an integer handle to it is
+!     returned.  All other MD_C_* routines take that handle as their first
+!     argument, so several independent MoorDyn models can be run from a single
+!     process.  Calls on different handles may be made from separate threads at
+!     the same time.  Creating or ending an instance changes the instance list,
+!     so those calls must not overlap with any other call into this library.
+TYPE :: MD_C_InstanceType
+   !--------------------------------------------------------------------------------------------------------------------------------------------------------
+   !  Data storage
+   !     All MoorDyn data is stored within the following data structures inside this
+   !     record.  No data is stored within MoorDyn itself, but is instead passed in
+   !     from this module.  This data is not available to the calling code unless
+   !     explicitly passed through the interface (derived types such as these are
+   !     non-trivial to pass through the c-bindings).
+   TYPE(MD_InitInputType)                  :: InitInp             !< Input data for initialization routine
+   TYPE(MD_InputType), ALLOCATABLE         :: u(:)                !< An initial guess for the input; input mesh must be defined
+   TYPE(MD_ParameterType)                  :: p                   !< Parameters
+   TYPE(MD_ContinuousStateType)            :: x(0:2)              !< Initial continuous states
+   TYPE(MD_DiscreteStateType)              :: xd(0:2)             !< Initial discrete states
+   TYPE(MD_ConstraintStateType)            :: z(0:2)              !< Initial constraint states
+   TYPE(MD_OtherStateType)                 :: other(0:2)          !< Initial other states
+   TYPE(MD_OutputType)                     :: y                   !< Initial system outputs (outputs are not calculated; only the output mesh is initialized)
+   TYPE(MD_MiscVarType)                    :: m                   !< Initial misc/optimization variables
+   TYPE(MD_InitOutputType)                 :: InitOutData         !< Output for initialization routine
+
+   !--------------------------------------------------------------------------------------------------------------------------------------------------------
+   ! Time tracking
+   !     For the solver in MD, previous timesteps input must be stored for extrapolation
+   !     to the t+dt timestep.  This can be either linear (1) quadratic (2).  The
+   !     InterpOrder variable tracks what this is and sets the size of the inputs `u`
+   !     passed into MD. Inputs `u` will be sized as follows:
+   !        linear    interp     u(2)  with inputs at T,T-dt
+   !        quadratic interp     u(3)  with inputs at T,T-dt,T-2*dt
+   !  Time tracking
+   !     When we are performing a correction step, time information of previous
+   !     calls is needed to decide how to apply correction logic or cycle the inputs
+   !     and resave the previous timestep states.
+   !  Correction steps
+   !     OpenFAST has the ability to perform correction steps.  During a correction
+   !     step, new input values are passed in but the timestep remains the same.
+   !     When this occurs the new input data at time t is used with the state
+   !     information from the previous timestep (t) to calculate new state values
+   !     time t+dt in the UpdateStates routine.  In OpenFAST this is all handled by
+   !     the glue code.  However, here we do not pass state information through the
+   !     interface and therefore must store it here analogously to how it is handled
+   !     in the OpenFAST glue code.
+   INTEGER(IntKi)                          :: InterpOrder         !< Interpolation order: must be 1 (linear) or 2 (quadratic)
+   REAL(DbKi), DIMENSION(:), ALLOCATABLE   :: InputTimes(:)       !< InputTimes array
+   REAL(DbKi)                              :: InputTimePrev       !< input time of last UpdateStates call
+   real(DbKi)                              :: dT_Global           !< dT of the code calling this module
+   integer(IntKi)                          :: N_Global            !< global timestep
+   real(DbKi)                              :: T_Initial           !< initial Time of simulation
+
+   !--------------------------------------------------------------------------------------------------------------------------------------------------------
+   ! Meshes for motions and loads
+   !     Meshes are used within MD to handle all motions and loads. Rather than directly
+   !     map to those nodes, we will create a mapping to go between the array of node
+   !     positions passed into this module and what is used inside MD.  This is done
+   !     through a pair of meshes for the motion and loads corresponding to the node
+   !     positions passed in.
+   !------------------------------
+   !  Meshes for external nodes
+   !     These point meshes are merely used to simplify the mapping of motions/loads
+   !     to/from MD using the library mesh mapping routines.  The input mesh into the
+   !     library can only contain one point at present and is rigidly mapped to multiple
+   !     MoorDyn mesh points. This means all MoorDyn coupled objects as defined in the
+   !     input file will be rigidly attached to the input mesh
+   !
+   !     In the future, we may wish modify this interface to allow for N mesh points
+   !     for coupling to N MoorDyn mesh points for modeling things likeflexible structures.
+   TYPE(MeshType)                          :: MD_MotionMesh       !< mesh for motions of external nodes
+   TYPE(MeshType)                          :: MD_LoadMesh         !< mesh for loads  for external nodes
+   TYPE(MeshMapType)                       :: Map_Motion_2_MD     !< Mesh mapping between input motion mesh and MD
+   TYPE(MeshMapType)                       :: Map_MD_2_Load       !< Mesh mapping between MD output loads mesh and external nodes mesh
+
+   ! Motions input (so that we don't have to reallocate all the time)
+   REAL(ReKi)                              :: tmpPositions(6,1)   !< temp array.  Probably don't need this, but makes conversion from C clearer.
+   REAL(ReKi)                              :: tmpVelocities(6,1)  !< temp array.  Probably don't need this, but makes conversion from C clearer.
+   REAL(ReKi)                              :: tmpAccelerations(6,1) !< temp array.  Probably don't need this, but makes conversion from C clearer.
+   REAL(ReKi)                              :: tmpForces(6,1)      !< temp array.  Probably don't need this, but makes conversion to   C clearer.
+END TYPE MD_C_InstanceType
+
+!> Instances are held through pointers so that they never move when the list grows
+TYPE :: MD_C_InstancePtr
+   TYPE(MD_C_InstanceType), POINTER         :: Inst => NULL()
+END TYPE MD_C_InstancePtr
+
+TYPE(MD_C_InstancePtr), ALLOCATABLE        :: Instances(:)      !< Instance list; the handle is the index into this array
 
 CONTAINS
 
@@ -133,6 +152,7 @@ CONTAINS
 !===============================================================================================================
 !FIXME: add ShowPassed and DebugLevel
 SUBROUTINE MD_C_Init(                                             &
+   Handle_C,                                                      &
    InputFilePassed, InputFileString_C, InputFileStringLength_C,   &
    DT_C, G_C, RHO_C, DEPTH_C, PtfmInit_C,                         &
    InterpOrder_C,                                                 &
@@ -143,6 +163,7 @@ SUBROUTINE MD_C_Init(                                             &
 !DEC$ ATTRIBUTES DLLEXPORT :: MD_C_Init
 !GCC$ ATTRIBUTES DLLEXPORT :: MD_C_Init
 #endif
+   INTEGER(C_INT)                                 , INTENT(INOUT)   :: Handle_C               !< Instance handle: 0 to create a new instance, or the handle returned by MD_C_SetWaveFieldData
    INTEGER(C_INT)                                 , INTENT(IN   )   :: InputFilePassed        !< Whether to load the file from the filesystem - 1: InputFileString_C contains the contents of the input file; otherwise, InputFileString_C contains the path to the input file
    TYPE(C_PTR)                                    , INTENT(IN   )   :: InputFileString_C        !< Input file as a single string with lines deliniated by C_NULL_CHAR
    INTEGER(C_INT)                                 , INTENT(IN   )   :: InputFileStringLength_C  !< length of the input file string
@@ -161,6 +182,7 @@ SUBROUTINE MD_C_Init(                                             &
 
    ! Local Variables
    CHARACTER(KIND=C_char, LEN=InputFileStringLength_C), POINTER     :: InputFileString          !< Input file as a single string with NULL chracter separating lines
+   TYPE(MD_C_InstanceType),                             POINTER     :: Inst                     !< Instance data for this handle
    INTEGER(IntKi)                                                   :: ErrStat_F, ErrStat_F2
    CHARACTER(ErrMsgLen)                                             :: ErrMsg_F,  ErrMsg_F2
    INTEGER                                                          :: I, J, K
@@ -175,28 +197,19 @@ SUBROUTINE MD_C_Init(                                             &
    CALL DispCopyrightLicense( version%Name )
    CALL DispCompileRuntimeInfo( version%Name )
 
-   ! Destroy global memory
-   if (allocated(u)) then
-      do i = 1, size(u)
-         call MD_DestroyInput(u(i), ErrStat_F, ErrMsg_F)
-      end do
-      deallocate(u)
-   end if
-   call MD_DestroyParam(p, ErrStat_F, ErrMsg_F)
-   do i = 0, 2
-      call MD_DestroyContState(x(i), ErrStat_F, ErrMsg_F)
-   end do
-   do i = 0, 2
-      call MD_DestroyDiscState(xd(i), ErrStat_F, ErrMsg_F)
-   end do
-   do i = 0, 2
-      call MD_DestroyConstrState(z(i), ErrStat_F, ErrMsg_F)
-   end do
-   do i = 0, 2
-      call MD_DestroyOtherState(other(i), ErrStat_F, ErrMsg_F)
-   end do
-   call MD_DestroyOutput(y, ErrStat_F, ErrMsg_F)
-   call MD_DestroyMisc(m, ErrStat_F, ErrMsg_F)
+   ! Get the instance: a new one, or the one created by MD_C_SetWaveFieldData.
+   ! The handle is returned even if initialization fails below so that MD_C_End
+   ! can clean up whatever was allocated.
+   if (Handle_C == 0_c_int) then
+      call NewInstance(Handle_C, Inst, ErrStat_F2, ErrMsg_F2); if (Failed()) return
+   else
+      call GetInstance(Handle_C, Inst, ErrStat_F2, ErrMsg_F2); if (Failed()) return
+      if (allocated(Inst%u)) then
+         ErrStat_F2 = ErrID_Fatal
+         ErrMsg_F2  = 'MoorDyn instance '//trim(Num2LStr(int(Handle_C,IntKi)))//' is already initialized.  Call MD_C_End first.'
+         if (Failed()) return
+      endif
+   endif
 
    ! Convert the MD input file to FileInfoType
    !----------------------------------------------------------------------------------------------------------------------------------------------
@@ -206,12 +219,12 @@ SUBROUTINE MD_C_Init(                                             &
 
    ! Format input file contents
    if (InputFilePassed==1_c_int) then
-      InitInp%UsePrimaryInputFile   = .FALSE.            ! Don't try to read an input -- use passed data instead (blades and AF tables not passed)
-      InitInp%FileName              = ""                 ! not actually used
-      CALL InitFileInfo(InputFileString, InitInp%PassedPrimaryInputData, ErrStat_F2, ErrMsg_F2); if (Failed()) return
+      Inst%InitInp%UsePrimaryInputFile   = .FALSE.            ! Don't try to read an input -- use passed data instead (blades and AF tables not passed)
+      Inst%InitInp%FileName              = ""                 ! not actually used
+      CALL InitFileInfo(InputFileString, Inst%InitInp%PassedPrimaryInputData, ErrStat_F2, ErrMsg_F2); if (Failed()) return
    else
-      InitInp%UsePrimaryInputFile   = .TRUE.             ! Read input info from a primary input file
-      InitInp%FileName = FileNameFromCString(InputFileString, InputFileStringLength_C)
+      Inst%InitInp%UsePrimaryInputFile   = .TRUE.             ! Read input info from a primary input file
+      Inst%InitInp%FileName = FileNameFromCString(InputFileString, InputFileStringLength_C)
    endif
 
    ! Set other inputs for calling MD_Init
@@ -219,31 +232,31 @@ SUBROUTINE MD_C_Init(                                             &
    
    ! Check the interpolation order
    IF (InterpOrder_C .EQ. 1 .OR. InterpOrder_C .EQ. 2) THEN
-      InterpOrder = INT(InterpOrder_C, IntKi)
-      call AllocAry( InputTimes, InterpOrder+1, 'InputTimes', ErrStat_F2, ErrMsg_F2); if (Failed()) return
+      Inst%InterpOrder = INT(InterpOrder_C, IntKi)
+      call AllocAry( Inst%InputTimes, Inst%InterpOrder+1, 'InputTimes', ErrStat_F2, ErrMsg_F2); if (Failed()) return
    ELSE
       ErrStat_F2 = ErrID_Fatal
       ErrMsg_F2  = 'InterpOrder must be 1 (linear) or 2 (quadratic)'
       if (Failed()) return
    END IF
 
-   dT_Global                = REAL(DT_C, DbKi)
-   N_Global                 = 0_IntKi                     ! Assume we are on timestep 0 at start
-   InitInp%RootName         = 'MDroot'
+   Inst%dT_Global                = REAL(DT_C, DbKi)
+   Inst%N_Global                 = 0_IntKi                     ! Assume we are on timestep 0 at start
+   Inst%InitInp%RootName         = 'MDroot'
 
    ! Environment variables -- These should be passed in from C.
-   InitInp%g                = REAL(G_C, ReKi)
-   InitInp%rhoW             = REAL(RHO_C, ReKi)
-   InitInp%WtrDepth         = REAL(DEPTH_C, ReKi)
+   Inst%InitInp%g                = REAL(G_C, ReKi)
+   Inst%InitInp%rhoW             = REAL(RHO_C, ReKi)
+   Inst%InitInp%WtrDepth         = REAL(DEPTH_C, ReKi)
 
    ! Platform position (x,y,z,Rx,Ry,Rz) -- where rotations are small angle assumption in radians.
    ! This data is used to set the CoupledKinematics mesh that will be used at each timestep call
-   CALL AllocAry (InitInp%PtfmInit, 6, 1, 'InitInp%PtfmInit', ErrStat_F2, ErrMsg_F2 ); if (Failed()) return
+   CALL AllocAry (Inst%InitInp%PtfmInit, 6, 1, 'InitInp%PtfmInit', ErrStat_F2, ErrMsg_F2 ); if (Failed()) return
    DO I = 1,6
-      InitInp%PtfmInit(I,1)  = REAL(PtfmInit_C(I),ReKi)
+      Inst%InitInp%PtfmInit(I,1)  = REAL(PtfmInit_C(I),ReKi)
    END DO
 
-   ALLOCATE(u(InterpOrder+1), STAT=ErrStat_F2)
+   ALLOCATE(Inst%u(Inst%InterpOrder+1), STAT=ErrStat_F2)
    if (ErrStat_F2 /= 0) then
       ErrStat_F2 = ErrID_Fatal
       ErrMsg_F2  = 'Failed to allocate Inputs type for MD'
@@ -253,21 +266,21 @@ SUBROUTINE MD_C_Init(                                             &
    !-------------------------------------------------
    ! Call the main subroutine MD_Init
    !-------------------------------------------------
-   CALL MD_Init(InitInp, u(1), p, x(STATE_CURR), xd(STATE_CURR), z(STATE_CURR), other(STATE_CURR), y, m, dT_Global, InitOutData, ErrStat_F2, ErrMsg_F2); if (Failed()) return
+   CALL MD_Init(Inst%InitInp, Inst%u(1), Inst%p, Inst%x(STATE_CURR), Inst%xd(STATE_CURR), Inst%z(STATE_CURR), Inst%other(STATE_CURR), Inst%y, Inst%m, Inst%dT_Global, Inst%InitOutData, ErrStat_F2, ErrMsg_F2); if (Failed()) return
 
    !-------------------------------------------------
    !  Set output channel information for driver code
    !-------------------------------------------------
 
    ! Number of channels
-   NumChannels_C = size(InitOutData%WriteOutputHdr)
+   NumChannels_C = size(Inst%InitOutData%WriteOutputHdr)
 
    ! Transfer the output channel names and units to c_char arrays for returning
    k=1
    DO i=1,NumChannels_C
       DO j=1,ChanLen    ! max length of channel name.  Same for units
-         OutputChannelNames_C(k)=InitOutData%WriteOutputHdr(i)(j:j)
-         OutputChannelUnits_C(k)=InitOutData%WriteOutputUnt(i)(j:j)
+         OutputChannelNames_C(k)=Inst%InitOutData%WriteOutputHdr(i)(j:j)
+         OutputChannelUnits_C(k)=Inst%InitOutData%WriteOutputUnt(i)(j:j)
          k=k+1
       END DO
    END DO
@@ -280,38 +293,38 @@ SUBROUTINE MD_C_Init(                                             &
    ! Set the interface  meshes for motion inputs and loads output
    !-------------------------------------------------------------
    DO i = 1,6
-       tmpPositions(i,1)     = REAL(PtfmInit_C(i),ReKi)
+       Inst%tmpPositions(i,1)     = REAL(PtfmInit_C(i),ReKi)
    END DO
-   tmpVelocities     = 0_ReKi
-   tmpAccelerations  = 0_ReKi
-   CALL SetMotionLoadsInterfaceMeshes(ErrStat_F2,ErrMsg_F2); if (Failed()) return
+   Inst%tmpVelocities     = 0_ReKi
+   Inst%tmpAccelerations  = 0_ReKi
+   CALL SetMotionLoadsInterfaceMeshes(Inst,ErrStat_F2,ErrMsg_F2); if (Failed()) return
 
-   DO i=2,InterpOrder+1
-      CALL MD_CopyInput (u(1),  u(i),  MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2); if (Failed()) return
+   DO i=2,Inst%InterpOrder+1
+      CALL MD_CopyInput (Inst%u(1),  Inst%u(i),  MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2); if (Failed()) return
    END DO
-   InputTimePrev = -dT_Global    ! Initialize for MD_C_UpdateStates
+   Inst%InputTimePrev = -Inst%dT_Global    ! Initialize for MD_C_UpdateStates
 
    !-------------------------------------------------------------
    ! Initial setup of other pieces of x,xd,z,other
    !-------------------------------------------------------------
-   CALL MD_CopyContState  ( x(    STATE_CURR), x(    STATE_PRED), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
-   CALL MD_CopyDiscState  ( xd(   STATE_CURR), xd(   STATE_PRED), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
-   CALL MD_CopyConstrState( z(    STATE_CURR), z(    STATE_PRED), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
-   CALL MD_CopyOtherState ( other(STATE_CURR), other(STATE_PRED), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
+   CALL MD_CopyContState  ( Inst%x(    STATE_CURR), Inst%x(    STATE_PRED), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
+   CALL MD_CopyDiscState  ( Inst%xd(   STATE_CURR), Inst%xd(   STATE_PRED), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
+   CALL MD_CopyConstrState( Inst%z(    STATE_CURR), Inst%z(    STATE_PRED), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
+   CALL MD_CopyOtherState ( Inst%other(STATE_CURR), Inst%other(STATE_PRED), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
 
    !-------------------------------------------------------------
    ! Setup the previous timestep copies of states
    !-------------------------------------------------------------
-   CALL MD_CopyContState  ( x(    STATE_CURR), x(    STATE_LAST), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
-   CALL MD_CopyDiscState  ( xd(   STATE_CURR), xd(   STATE_LAST), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
-   CALL MD_CopyConstrState( z(    STATE_CURR), z(    STATE_LAST), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
-   CALL MD_CopyOtherState ( other(STATE_CURR), other(STATE_LAST), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
+   CALL MD_CopyContState  ( Inst%x(    STATE_CURR), Inst%x(    STATE_LAST), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
+   CALL MD_CopyDiscState  ( Inst%xd(   STATE_CURR), Inst%xd(   STATE_LAST), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
+   CALL MD_CopyConstrState( Inst%z(    STATE_CURR), Inst%z(    STATE_LAST), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
+   CALL MD_CopyOtherState ( Inst%other(STATE_CURR), Inst%other(STATE_LAST), MESH_NEWCOPY, ErrStat_F2, ErrMsg_F2);   if (Failed())  return
 
    !-------------------------------------------------
    ! Clean up variables and set up for MD_C_CalcOutput
    !------------------------------------------------- 
-   CALL MD_DestroyInitInput( InitInp, ErrStat_F2, ErrMsg_F2 );        if (Failed())  return
-   CALL MD_DestroyInitOutput( InitOutData, ErrStat_F2, ErrMsg_F2 );   if (Failed())  return
+   CALL MD_DestroyInitInput( Inst%InitInp, ErrStat_F2, ErrMsg_F2 );        if (Failed())  return
+   CALL MD_DestroyInitOutput( Inst%InitOutData, ErrStat_F2, ErrMsg_F2 );   if (Failed())  return
 
    call SetErrStat_F2C(ErrStat_F,ErrMsg_F,ErrStat_C,ErrMsg_C)
 
@@ -327,11 +340,12 @@ END SUBROUTINE MD_C_Init
 !===============================================================================================================
 !---------------------------------------------- MD UPDATE STATES -----------------------------------------------
 !===============================================================================================================
-SUBROUTINE MD_C_UpdateStates(Time_C, TimeNext_C, POSITIONS_C, VELOCITIES_C, ACCELERATIONS_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='MD_C_UpdateStates')
+SUBROUTINE MD_C_UpdateStates(Handle_C, Time_C, TimeNext_C, POSITIONS_C, VELOCITIES_C, ACCELERATIONS_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='MD_C_UpdateStates')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: MD_C_UpdateStates
 !GCC$ ATTRIBUTES DLLEXPORT :: MD_C_UpdateStates
 #endif
+   INTEGER(C_INT)                                 , INTENT(IN   )   :: Handle_C
    real(c_double),                                  intent(in   )  :: Time_C
    real(c_double),                                  intent(in   )  :: TimeNext_C
    REAL(C_FLOAT)                                  , INTENT(IN   )   :: POSITIONS_C(1,6)
@@ -341,6 +355,7 @@ SUBROUTINE MD_C_UpdateStates(Time_C, TimeNext_C, POSITIONS_C, VELOCITIES_C, ACCE
    CHARACTER(KIND=C_CHAR)                         , INTENT(  OUT)   :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local Variables
+   TYPE(MD_C_InstanceType), POINTER                                 :: Inst
    INTEGER(IntKi)                                                   :: ErrStat_F, ErrStat_F2, J
    CHARACTER(ErrMsgLen)                                             :: ErrMsg_F,  ErrMsg_F2
    LOGICAL                                                          :: CorrectionStep
@@ -351,6 +366,8 @@ SUBROUTINE MD_C_UpdateStates(Time_C, TimeNext_C, POSITIONS_C, VELOCITIES_C, ACCE
    ErrMsg_F = ''
    CorrectionStep = .FALSE.
 
+   CALL GetInstance(Handle_C, Inst, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+
    !-------------------------------------------------------
    ! Check the time for current timestep and next timestep
    !-------------------------------------------------------
@@ -372,16 +389,16 @@ SUBROUTINE MD_C_UpdateStates(Time_C, TimeNext_C, POSITIONS_C, VELOCITIES_C, ACCE
    !        but should not affect any results.
 
    !  Check if we are repeating an UpdateStates call (for example in a predictor/corrector loop)
-   if ( EqualRealNos( real(Time_C,DbKi), InputTimePrev ) ) then
+   if ( EqualRealNos( real(Time_C,DbKi), Inst%InputTimePrev ) ) then
       CorrectionStep = .true.
    else ! Setup time input times array
-      InputTimePrev          = real(Time_C,DbKi)            ! Store for check next time
-      if (InterpOrder>1) then ! quadratic, so keep the old time
-         InputTimes(INPUT_LAST) = ( N_Global - 1 ) * dT_Global    ! u(3) at T-dT
+      Inst%InputTimePrev          = real(Time_C,DbKi)            ! Store for check next time
+      if (Inst%InterpOrder>1) then ! quadratic, so keep the old time
+         Inst%InputTimes(INPUT_LAST) = ( Inst%N_Global - 1 ) * Inst%dT_Global    ! u(3) at T-dT
       endif
-      InputTimes(INPUT_CURR) =   N_Global       * dT_Global       ! u(2) at T
-      InputTimes(INPUT_PRED) = ( N_Global + 1 ) * dT_Global       ! u(1) at T+dT
-      N_Global = N_Global + 1_IntKi                               ! increment counter to T+dT
+      Inst%InputTimes(INPUT_CURR) =   Inst%N_Global       * Inst%dT_Global       ! u(2) at T
+      Inst%InputTimes(INPUT_PRED) = ( Inst%N_Global + 1 ) * Inst%dT_Global       ! u(1) at T+dT
+      Inst%N_Global = Inst%N_Global + 1_IntKi                               ! increment counter to T+dT
    endif
 
 
@@ -389,42 +406,42 @@ SUBROUTINE MD_C_UpdateStates(Time_C, TimeNext_C, POSITIONS_C, VELOCITIES_C, ACCE
        ! Step back to previous state because we are doing a correction step
        !     -- repeating the T -> T+dt update with new inputs at T+dt
        !     -- the STATE_CURR contains states at T+dt from the previous call, so revert those
-       CALL MD_CopyContState   (x(    STATE_LAST), x(    STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-       CALL MD_CopyDiscState   (xd(   STATE_LAST), xd(   STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-       CALL MD_CopyConstrState (z(    STATE_LAST), z(    STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-       CALL MD_CopyOtherState  (other(STATE_LAST), other(STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+       CALL MD_CopyContState   (Inst%x(    STATE_LAST), Inst%x(    STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+       CALL MD_CopyDiscState   (Inst%xd(   STATE_LAST), Inst%xd(   STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+       CALL MD_CopyConstrState (Inst%z(    STATE_LAST), Inst%z(    STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+       CALL MD_CopyOtherState  (Inst%other(STATE_LAST), Inst%other(STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
    ELSE
        ! Cycle inputs back one timestep since we are moving forward in time.
-       IF (InterpOrder>1) THEN ! quadratic, so keep the old time
-           CALL MD_CopyInput( u(INPUT_CURR), u(INPUT_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);   IF (Failed())  RETURN
+       IF (Inst%InterpOrder>1) THEN ! quadratic, so keep the old time
+           CALL MD_CopyInput( Inst%u(INPUT_CURR), Inst%u(INPUT_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);   IF (Failed())  RETURN
        END IF
        ! Move inputs from previous t+dt (now t) to t
-       CALL MD_CopyInput( u(INPUT_PRED), u(INPUT_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);       IF (Failed())  RETURN
+       CALL MD_CopyInput( Inst%u(INPUT_PRED), Inst%u(INPUT_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);       IF (Failed())  RETURN
    END IF
 
    ! Reshape position and velocity (transposing from a row vector to a column vector)
    DO J = 1,6
-       tmpPositions(J,1)     = REAL(POSITIONS_C(1,J),ReKi)
-       tmpVelocities(J,1)    = REAL(VELOCITIES_C(1,J),ReKi)
-       tmpAccelerations(J,1) = REAL(ACCELERATIONS_C(1,J),ReKi)
+       Inst%tmpPositions(J,1)     = REAL(POSITIONS_C(1,J),ReKi)
+       Inst%tmpVelocities(J,1)    = REAL(VELOCITIES_C(1,J),ReKi)
+       Inst%tmpAccelerations(J,1) = REAL(ACCELERATIONS_C(1,J),ReKi)
    END DO
 
    ! Transfer motions to input meshes
-   CALL Set_MotionMesh()
-   CALL MD_SetInputMotion( u(INPUT_PRED), ErrStat_F2, ErrMsg_F2 ); IF (Failed())  RETURN
+   CALL Set_MotionMesh(Inst)
+   CALL MD_SetInputMotion( Inst, Inst%u(INPUT_PRED), ErrStat_F2, ErrMsg_F2 ); IF (Failed())  RETURN
 
    ! Set copy the current state over to the predicted state for sending to UpdateStates
    !     -- The STATE_PREDicted will get updated in the call.
    !     -- The UpdateStates routine expects this to contain states at T at the start of the call (history not passed in)
-   CALL MD_CopyContState   (x(    STATE_CURR), x(    STATE_PRED), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-   CALL MD_CopyDiscState   (xd(   STATE_CURR), xd(   STATE_PRED), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-   CALL MD_CopyConstrState (z(    STATE_CURR), z(    STATE_PRED), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-   CALL MD_CopyOtherState  (other(STATE_CURR), other(STATE_PRED), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyContState   (Inst%x(    STATE_CURR), Inst%x(    STATE_PRED), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyDiscState   (Inst%xd(   STATE_CURR), Inst%xd(   STATE_PRED), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyConstrState (Inst%z(    STATE_CURR), Inst%z(    STATE_PRED), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyOtherState  (Inst%other(STATE_CURR), Inst%other(STATE_PRED), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
 
    !-------------------------------------------------
    ! Call the main subroutine MD_UpdateStates
    !-------------------------------------------------
-   CALL MD_UpdateStates( InputTimes(INPUT_CURR), N_Global, u, InputTimes, p, x(STATE_PRED), xd(STATE_PRED), z(STATE_PRED), other(STATE_PRED), m, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_UpdateStates( Inst%InputTimes(INPUT_CURR), Inst%N_Global, Inst%u, Inst%InputTimes, Inst%p, Inst%x(STATE_PRED), Inst%xd(STATE_PRED), Inst%z(STATE_PRED), Inst%other(STATE_PRED), Inst%m, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
 
    !-------------------------------------------------------
    ! Cycle the states
@@ -432,16 +449,16 @@ SUBROUTINE MD_C_UpdateStates(Time_C, TimeNext_C, POSITIONS_C, VELOCITIES_C, ACCE
    ! Move current state at T to previous state at T-dt
    !     -- STATE_LAST now contains info at time T
    !     -- this allows repeating the T --> T+dt update
-   CALL MD_CopyContState   (x(    STATE_CURR), x(    STATE_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-   CALL MD_CopyDiscState   (xd(   STATE_CURR), xd(   STATE_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-   CALL MD_CopyConstrState (z(    STATE_CURR), z(    STATE_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-   CALL MD_CopyOtherState  (other(STATE_CURR), other(STATE_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyContState   (Inst%x(    STATE_CURR), Inst%x(    STATE_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyDiscState   (Inst%xd(   STATE_CURR), Inst%xd(   STATE_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyConstrState (Inst%z(    STATE_CURR), Inst%z(    STATE_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyOtherState  (Inst%other(STATE_CURR), Inst%other(STATE_LAST), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
    ! Update the predicted state as the new current state
    !     -- we have now advanced from T to T+dt.  This allows calling with CalcOuput to get the outputs at T+dt
-   CALL MD_CopyContState   (x(    STATE_PRED), x(    STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-   CALL MD_CopyDiscState   (xd(   STATE_PRED), xd(   STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-   CALL MD_CopyConstrState (z(    STATE_PRED), z(    STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
-   CALL MD_CopyOtherState  (other(STATE_PRED), other(STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyContState   (Inst%x(    STATE_PRED), Inst%x(    STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyDiscState   (Inst%xd(   STATE_PRED), Inst%xd(   STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyConstrState (Inst%z(    STATE_PRED), Inst%z(    STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
+   CALL MD_CopyOtherState  (Inst%other(STATE_PRED), Inst%other(STATE_CURR), MESH_UPDATECOPY, ErrStat_F2, ErrMsg_F2);  IF (Failed())  RETURN
 
    call SetErrStat_F2C(ErrStat_F,ErrMsg_F,ErrStat_C,ErrMsg_C)
 
@@ -457,21 +474,23 @@ END SUBROUTINE MD_C_UpdateStates
 !---------------------------------------------- MD CALC OUTPUT -------------------------------------------------
 !===============================================================================================================
 !> Calculate the moordyn results iven the current set of states and inputs
-SUBROUTINE MD_C_CalcOutput(Time_C, POSITIONS_C, VELOCITIES_C, ACCELERATIONS_C, FORCES_C, OUTPUTS_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='MD_C_CalcOutput')
+SUBROUTINE MD_C_CalcOutput(Handle_C, Time_C, POSITIONS_C, VELOCITIES_C, ACCELERATIONS_C, FORCES_C, OUTPUTS_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='MD_C_CalcOutput')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: MD_C_CalcOutput
 !GCC$ ATTRIBUTES DLLEXPORT :: MD_C_CalcOutput
 #endif
+   INTEGER(C_INT)                                 , INTENT(IN   )   :: Handle_C
    REAL(C_DOUBLE)                                 , INTENT(IN   )   :: Time_C
    REAL(C_FLOAT)                                  , INTENT(IN   )   :: POSITIONS_C(1,6)
    REAL(C_FLOAT)                                  , INTENT(IN   )   :: VELOCITIES_C(1,6)
    REAL(C_FLOAT)                                  , INTENT(IN   )   :: ACCELERATIONS_C(1,6)
    REAL(C_FLOAT)                                  , INTENT(  OUT)   :: FORCES_C(1,6)
-   REAL(C_FLOAT)                                  , INTENT(  OUT)   :: OUTPUTS_C(p%NumOuts)
+   REAL(C_FLOAT)                                  , INTENT(  OUT)   :: OUTPUTS_C(*)      !< NumChannels
    INTEGER(C_INT)                                 , INTENT(  OUT)   :: ErrStat_C
    CHARACTER(KIND=C_CHAR)                         , INTENT(  OUT)   :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local Variables
+   TYPE(MD_C_InstanceType), POINTER                                 :: Inst
    REAL(DbKi)                                                       :: t
    INTEGER(IntKi)                                                   :: ErrStat_F, ErrStat_F2, J
    CHARACTER(ErrMsgLen)                                             :: ErrMsg_F,  ErrMsg_F2
@@ -481,6 +500,8 @@ SUBROUTINE MD_C_CalcOutput(Time_C, POSITIONS_C, VELOCITIES_C, ACCELERATIONS_C, F
    ErrStat_F = ErrID_None
    ErrMsg_F = ''
 
+   CALL GetInstance(Handle_C, Inst, ErrStat_F2, ErrMsg_F2);  if (Failed()) return
+
    ! Set up inputs to MD_CalcOutput
    !-----------------------------------------------------------------------------------------------------------
 
@@ -489,37 +510,37 @@ SUBROUTINE MD_C_CalcOutput(Time_C, POSITIONS_C, VELOCITIES_C, ACCELERATIONS_C, F
 
    ! Reshape position and velocity (from row vector to a column vector)
    DO J = 1,6
-       tmpPositions(J,1)       = REAL(POSITIONS_C(1,J),ReKi)
-       tmpVelocities(J,1)      = REAL(VELOCITIES_C(1,J),ReKi)
-       tmpAccelerations(J,1)   = REAL(ACCELERATIONS_C(1,J),ReKi)
+       Inst%tmpPositions(J,1)       = REAL(POSITIONS_C(1,J),ReKi)
+       Inst%tmpVelocities(J,1)      = REAL(VELOCITIES_C(1,J),ReKi)
+       Inst%tmpAccelerations(J,1)   = REAL(ACCELERATIONS_C(1,J),ReKi)
    END DO
 
    ! Transfer motions to input meshes
-   CALL Set_MotionMesh()
+   CALL Set_MotionMesh(Inst)
 
    ! transfer input motion mesh to u(1) meshes
-   CALL MD_SetInputMotion( u(1), ErrStat_F2, ErrMsg_F2 );  if (Failed()) return;
+   CALL MD_SetInputMotion( Inst, Inst%u(1), ErrStat_F2, ErrMsg_F2 );  if (Failed()) return;
 
    !-------------------------------------------------
    ! Call the main subroutine MD_CalcOutput
    !-------------------------------------------------
-   CALL MD_CalcOutput( t, u(1), p, x(STATE_CURR), xd(STATE_CURR), z(STATE_CURR), other(STATE_CURR), y, m, ErrStat_F2, ErrMsg_F2 );  if (Failed()) return;
+   CALL MD_CalcOutput( t, Inst%u(1), Inst%p, Inst%x(STATE_CURR), Inst%xd(STATE_CURR), Inst%z(STATE_CURR), Inst%other(STATE_CURR), Inst%y, Inst%m, ErrStat_F2, ErrMsg_F2 );  if (Failed()) return;
 
    !-------------------------------------------------
    ! Convert the outputs of MD_calcOutput back to C
    !-------------------------------------------------
    ! Transfer resulting load meshes to intermediate mesh
-   CALL MD_TransferLoads( u(1), y, ErrStat_F2, ErrMsg_F2 );  if (Failed()) return;
+   CALL MD_TransferLoads( Inst, Inst%u(1), Inst%y, ErrStat_F2, ErrMsg_F2 );  if (Failed()) return;
 
    ! Set output force/moment array
-   CALL Set_OutputLoadArray( )
+   CALL Set_OutputLoadArray(Inst)
 
    ! Reshape for return
    DO J = 1,6
-       FORCES_C(1,J) = REAL(tmpForces(J,1), c_float)
+       FORCES_C(1,J) = REAL(Inst%tmpForces(J,1), c_float)
    END DO
 
-   OUTPUTS_C = REAL(y%WriteOutput, C_FLOAT)
+   OUTPUTS_C(1:Inst%p%NumOuts) = REAL(Inst%y%WriteOutput, C_FLOAT)
 
    call SetErrStat_F2C(ErrStat_F,ErrMsg_F,ErrStat_C,ErrMsg_C)
 
@@ -537,15 +558,17 @@ END SUBROUTINE MD_C_CalcOutput
 !===============================================================================================================
 !> Cleanup memory
 !! NOTE: the error handling here is slightly different than in other routines
-SUBROUTINE MD_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='MD_C_End')
+SUBROUTINE MD_C_End(Handle_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='MD_C_End')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: MD_C_End
 !GCC$ ATTRIBUTES DLLEXPORT :: MD_C_End
 #endif
+   INTEGER(C_INT)                , INTENT(IN   )      :: Handle_C
    INTEGER(C_INT)                , INTENT(  OUT)      :: ErrStat_C
    CHARACTER(KIND=C_CHAR)        , INTENT(  OUT)      :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local variables
+   TYPE(MD_C_InstanceType), POINTER                   :: Inst
    INTEGER(IntKi)                                     :: ErrStat_F, ErrStat_F2, i
    CHARACTER(ErrMsgLen)                               :: ErrMsg_F,  ErrMsg_F2
    character(*), parameter                            :: RoutineName = 'MD_C_End'
@@ -554,12 +577,18 @@ SUBROUTINE MD_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='MD_C_End')
    ErrStat_F = ErrID_None
    ErrMsg_F = ''
 
+   CALL GetInstance(Handle_C, Inst, ErrStat_F, ErrMsg_F)
+   if (ErrStat_F >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat_F,ErrMsg_F,ErrStat_C,ErrMsg_C)
+      return
+   endif
+
    ! Call the main subroutine MD_End
    !     If u is not allocated, then we didn't get far at all in initialization,
    !     or AD_C_End got called before Init.  We don't want a segfault, so check
    !     for allocation.
-   if (allocated(u)) then
-      CALL MD_End(u(1), p, x(1), xd(1), z(1), other(1), y, m, ErrStat_F2, ErrMsg_F2)
+   if (allocated(Inst%u)) then
+      CALL MD_End(Inst%u(1), Inst%p, Inst%x(1), Inst%xd(1), Inst%z(1), Inst%other(1), Inst%y, Inst%m, ErrStat_F2, ErrMsg_F2)
       call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
    endif
 
@@ -567,46 +596,49 @@ SUBROUTINE MD_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='MD_C_End')
    !        logic is required here (this isn't necessary in the fortran driver
    !        or in openfast, but may be when this code is called from C, Python,
    !        or some other code using the c-bindings)
-   IF (allocated(u)) THEN
-      DO i=2,size(u)
-         CALL MD_DestroyInput( u(i), ErrStat_F2, ErrMsg_F2 )
+   IF (allocated(Inst%u)) THEN
+      DO i=2,size(Inst%u)
+         CALL MD_DestroyInput( Inst%u(i), ErrStat_F2, ErrMsg_F2 )
          call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
       END DO
-      IF (allocated(u))             deallocate(u)
+      IF (allocated(Inst%u))             deallocate(Inst%u)
    END IF
 
    ! Destroy any other copies of states (rerun on (STATE_CURR) is ok)
-   call MD_DestroyContState(   x(    STATE_LAST), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyContState(   x(    STATE_CURR), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyContState(   x(    STATE_PRED), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyDiscState(   xd(   STATE_LAST), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyDiscState(   xd(   STATE_CURR), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyDiscState(   xd(   STATE_PRED), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyConstrState( z(    STATE_LAST), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyConstrState( z(    STATE_CURR), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyConstrState( z(    STATE_PRED), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyOtherState(  other(STATE_LAST), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyOtherState(  other(STATE_CURR), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-   call MD_DestroyOtherState(  other(STATE_PRED), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyContState(   Inst%x(    STATE_LAST), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyContState(   Inst%x(    STATE_CURR), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyContState(   Inst%x(    STATE_PRED), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyDiscState(   Inst%xd(   STATE_LAST), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyDiscState(   Inst%xd(   STATE_CURR), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyDiscState(   Inst%xd(   STATE_PRED), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyConstrState( Inst%z(    STATE_LAST), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyConstrState( Inst%z(    STATE_CURR), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyConstrState( Inst%z(    STATE_PRED), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyOtherState(  Inst%other(STATE_LAST), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyOtherState(  Inst%other(STATE_CURR), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
+   call MD_DestroyOtherState(  Inst%other(STATE_PRED), ErrStat_F2, ErrMsg_F2 );  call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
 
    ! if deallocate other items now
-   if (allocated(InputTimes))    deallocate(InputTimes)
+   if (allocated(Inst%InputTimes))    deallocate(Inst%InputTimes)
 
    ! Clear out mesh related data storage
    call ClearMesh()
 
+   ! Release the instance; the handle is no longer valid after this
+   call FreeInstance(Handle_C)
+
    call SetErrStat_F2C(ErrStat_F,ErrMsg_F,ErrStat_C,ErrMsg_C)
 CONTAINS
    !> Don't leave junk in memory.  So destroy meshes and mappings.
    subroutine ClearMesh()
-      call MeshDestroy( MD_MotionMesh, ErrStat_F2, ErrMsg_F2 )
+      call MeshDestroy( Inst%MD_MotionMesh, ErrStat_F2, ErrMsg_F2 )
       call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-      call MeshDestroy( MD_LoadMesh, ErrStat_F2, ErrMsg_F2 )
+      call MeshDestroy( Inst%MD_LoadMesh, ErrStat_F2, ErrMsg_F2 )
       call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
       ! Destroy mesh mappings
-      call NWTC_Library_Destroymeshmaptype( Map_Motion_2_MD, ErrStat_F2, ErrMsg_F2 )
+      call NWTC_Library_Destroymeshmaptype( Inst%Map_Motion_2_MD, ErrStat_F2, ErrMsg_F2 )
       call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
-      call NWTC_Library_Destroymeshmaptype( Map_MD_2_Load, ErrStat_F2, ErrMsg_F2 )
+      call NWTC_Library_Destroymeshmaptype( Inst%Map_MD_2_Load, ErrStat_F2, ErrMsg_F2 )
       call SetErrStat( ErrStat_F2, ErrMsg_F2, ErrStat_F, ErrMsg_F, RoutineName )
    end subroutine ClearMesh
 END SUBROUTINE MD_C_End
@@ -614,23 +646,35 @@ END SUBROUTINE MD_C_End
 !===============================================================================================================
 !----------------------------------------------- MD SetWaveFieldData -------------------------------------------
 !===============================================================================================================
-!> Set the wave field data pointer from an external source such as SeaState
-SUBROUTINE MD_C_SetWaveFieldData(WaveFieldData_C) BIND (C, NAME='MD_C_SetWaveFieldData')
+!> Set the wave field data pointer from an external source such as SeaState.  This must be called before
+!! MD_C_Init.  If Handle_C is 0, a new instance is created and its handle returned for use with MD_C_Init.
+SUBROUTINE MD_C_SetWaveFieldData(Handle_C, WaveFieldData_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='MD_C_SetWaveFieldData')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: MD_C_SetWaveFieldData
 !GCC$ ATTRIBUTES DLLEXPORT :: MD_C_SetWaveFieldData
 #endif
-   TYPE(C_PTR), INTENT(IN) :: WaveFieldData_C
+   INTEGER(C_INT),         INTENT(INOUT) :: Handle_C
+   TYPE(C_PTR),            INTENT(IN   ) :: WaveFieldData_C
+   INTEGER(C_INT),         INTENT(  OUT) :: ErrStat_C
+   CHARACTER(KIND=C_CHAR), INTENT(  OUT) :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local Variables
-   ! INTEGER(IntKi)                                                   :: ErrStat_F, ErrStat_F2
-   ! CHARACTER(ErrMsgLen)                                             :: ErrMsg_F,  ErrMsg_F2
+   TYPE(MD_C_InstanceType), POINTER                                 :: Inst
+   INTEGER(IntKi)                                                   :: ErrStat_F
+   CHARACTER(ErrMsgLen)                                             :: ErrMsg_F
    character(*), parameter                                          :: RoutineName = 'MD_C_SetWaveFieldData'
 
-   ! ErrStat_F = ErrID_None
-   ! ErrMsg_F = ''
+   if (Handle_C == 0_c_int) then
+      call NewInstance(Handle_C, Inst, ErrStat_F, ErrMsg_F)
+   else
+      call GetInstance(Handle_C, Inst, ErrStat_F, ErrMsg_F)
+   endif
+
+   if (ErrStat_F < AbortErrLev) then
+      call C_F_POINTER(WaveFieldData_C, Inst%InitInp%WaveField)  ! Set the wave field data pointer
+   endif
 
-   call C_F_POINTER(WaveFieldData_C, InitInp%WaveField)  ! Set the wave field data pointer
+   call SetErrStat_F2C(ErrStat_F,ErrMsg_F,ErrStat_C,ErrMsg_C)
 
 END SUBROUTINE MD_C_SetWaveFieldData
 
@@ -639,7 +683,8 @@ END SUBROUTINE MD_C_SetWaveFieldData
 !===============================================================================================================
 !! This subroutine sets the interface meshes to map to the input motions to the MD
 !! meshes.  This subroutine also sets the meshes for the output loads.
-SUBROUTINE SetMotionLoadsInterfaceMeshes(ErrStat,ErrMsg)
+SUBROUTINE SetMotionLoadsInterfaceMeshes(Inst,ErrStat,ErrMsg)
+   TYPE(MD_C_InstanceType),POINTER        :: Inst       !< instance data
    INTEGER(IntKi),         INTENT(  OUT)  :: ErrStat    !< temporary error status
    CHARACTER(ErrMsgLen),   INTENT(  OUT)  :: ErrMsg     !< temporary error message
    REAL(ReKi)                             :: InitPos(3)
@@ -651,7 +696,7 @@ SUBROUTINE SetMotionLoadsInterfaceMeshes(ErrStat,ErrMsg)
    ! Motion mesh
    !     This point mesh may contain more than one point. Mapping will be used to map
    !     this to the input mesh.
-   CALL MeshCreate(  MD_MotionMesh                       ,  &
+   CALL MeshCreate(  Inst%MD_MotionMesh                       ,  &
                      IOS              = COMPONENT_INPUT  ,  &
                      Nnodes           = 1                ,  &     ! Single node for now -- rigid body mapping to MD mesh points
                      ErrStat          = ErrStat          ,  &
@@ -662,24 +707,24 @@ SUBROUTINE SetMotionLoadsInterfaceMeshes(ErrStat,ErrMsg)
    IF (ErrStat >= AbortErrLev) RETURN
 
    ! initial position and orientation of node
-   InitPos  = tmpPositions(1:3,1)
-   theta    = REAL(tmpPositions(4:6,1),DbKi)    ! convert ReKi to DbKi to avoid roundoff
+   InitPos  = Inst%tmpPositions(1:3,1)
+   theta    = REAL(Inst%tmpPositions(4:6,1),DbKi)    ! convert ReKi to DbKi to avoid roundoff
    ! CALL SmllRotTrans( 'InputRotation', theta(1), theta(2), theta(3), Orient, 'Orient', ErrStat, ErrMsg )
    Orient = EulerConstructZYX((/theta(1), theta(2), theta(3)/))
-   CALL MeshPositionNode(  MD_MotionMesh            , &
+   CALL MeshPositionNode(  Inst%MD_MotionMesh            , &
                            1                        , &
                            InitPos                  , &  ! position
                            ErrStat, ErrMsg          , &
                            Orient                     )  ! orientation
    IF (ErrStat >= AbortErrLev) RETURN
     
-   CALL MeshConstructElement ( MD_MotionMesh, ELEMENT_POINT, ErrStat, ErrMsg, 1 )
+   CALL MeshConstructElement ( Inst%MD_MotionMesh, ELEMENT_POINT, ErrStat, ErrMsg, 1 )
    IF (ErrStat >= AbortErrLev) RETURN
 
-   CALL MeshCommit ( MD_MotionMesh, ErrStat, ErrMsg )
+   CALL MeshCommit ( Inst%MD_MotionMesh, ErrStat, ErrMsg )
    IF (ErrStat >= AbortErrLev) RETURN
 
-   MD_MotionMesh%RemapFlag  = .TRUE.
+   Inst%MD_MotionMesh%RemapFlag  = .TRUE.
 
    ! For checking the mesh, uncomment this.
    !     note: CU is is output unit (platform dependent).
@@ -689,8 +734,8 @@ SUBROUTINE SetMotionLoadsInterfaceMeshes(ErrStat,ErrMsg)
    ! Loads mesh
    !     This point mesh may contain more than one point. Mapping will be used to map
    !     the loads from output mesh
-   CALL MeshCopy( SrcMesh  = MD_MotionMesh      ,&
-                  DestMesh = MD_LoadMesh        ,&
+   CALL MeshCopy( SrcMesh  = Inst%MD_MotionMesh      ,&
+                  DestMesh = Inst%MD_LoadMesh        ,&
                   CtrlCode = MESH_SIBLING       ,&
                   IOS      = COMPONENT_OUTPUT   ,&
                   ErrStat  = ErrStat            ,&
@@ -699,7 +744,7 @@ SUBROUTINE SetMotionLoadsInterfaceMeshes(ErrStat,ErrMsg)
                   Moment   = .TRUE.             )
        IF (ErrStat >= AbortErrLev) RETURN
    
-   MD_LoadMesh%RemapFlag  = .TRUE.
+   Inst%MD_LoadMesh%RemapFlag  = .TRUE.
 
    ! For checking the mesh, uncomment this.
    !     note: CU is is output unit (platform dependent).
@@ -707,37 +752,39 @@ SUBROUTINE SetMotionLoadsInterfaceMeshes(ErrStat,ErrMsg)
 
    !-------------------------------------------------------------
    ! Set the mapping meshes
-   IF ( allocated(u(1)%CoupledKinematics) ) THEN      ! input motions
-       CALL MeshMapCreate( MD_MotionMesh, u(1)%CoupledKinematics(1), Map_Motion_2_MD, ErrStat, ErrMsg )
+   IF ( allocated(Inst%u(1)%CoupledKinematics) ) THEN      ! input motions
+       CALL MeshMapCreate( Inst%MD_MotionMesh, Inst%u(1)%CoupledKinematics(1), Inst%Map_Motion_2_MD, ErrStat, ErrMsg )
        IF (ErrStat >= AbortErrLev) RETURN
    END IF
-   IF ( allocated(y%CoupledLoads) ) THEN              ! output loads
-       CALL MeshMapCreate( y%CoupledLoads(1), MD_LoadMesh, Map_MD_2_Load, ErrStat, ErrMsg )
+   IF ( allocated(Inst%y%CoupledLoads) ) THEN              ! output loads
+       CALL MeshMapCreate( Inst%y%CoupledLoads(1), Inst%MD_LoadMesh, Inst%Map_MD_2_Load, ErrStat, ErrMsg )
        IF (ErrStat >= AbortErrLev) RETURN
    END IF
 END SUBROUTINE SetMotionLoadsInterfaceMeshes
 
 !---------------------------------------------------------------------------------------------------------------
-!> This routine is operating on module level data, hence few inputs
-SUBROUTINE Set_MotionMesh()
+!> This routine is operating on the instance data, hence few inputs
+SUBROUTINE Set_MotionMesh(Inst)
+   TYPE(MD_C_InstanceType),   POINTER        :: Inst
    REAL(R8Ki)                                :: theta(3)
    REAL(R8Ki)                                :: Orient(3,3)
    ! Set mesh corresponding to input motions
-   theta = REAL(tmpPositions(4:6,1),DbKi)    ! convert ReKi to DbKi to avoid roundoff
+   theta = REAL(Inst%tmpPositions(4:6,1),DbKi)    ! convert ReKi to DbKi to avoid roundoff
    ! CALL SmllRotTrans( 'InputRotation', theta(1), theta(2), theta(3), Orient, 'Orient', ErrStat, ErrMsg )
    Orient = EulerConstructZYX((/theta(1), theta(2), theta(3)/))
-   MD_MotionMesh%TranslationDisp(1:3,1) = tmpPositions(1:3,1) - MD_MotionMesh%Position(1:3,1)  ! relative displacement only
-   MD_MotionMesh%Orientation(1:3,1:3,1) = Orient
-   MD_MotionMesh%TranslationVel( 1:3,1) = tmpVelocities(1:3,1)
-   MD_MotionMesh%RotationVel(    1:3,1) = tmpVelocities(4:6,1)
-   MD_MotionMesh%TranslationAcc( 1:3,1) = tmpAccelerations(1:3,1)
-   MD_MotionMesh%RotationAcc(    1:3,1) = tmpAccelerations(4:6,1)
+   Inst%MD_MotionMesh%TranslationDisp(1:3,1) = Inst%tmpPositions(1:3,1) - Inst%MD_MotionMesh%Position(1:3,1)  ! relative displacement only
+   Inst%MD_MotionMesh%Orientation(1:3,1:3,1) = Orient
+   Inst%MD_MotionMesh%TranslationVel( 1:3,1) = Inst%tmpVelocities(1:3,1)
+   Inst%MD_MotionMesh%RotationVel(    1:3,1) = Inst%tmpVelocities(4:6,1)
+   Inst%MD_MotionMesh%TranslationAcc( 1:3,1) = Inst%tmpAccelerations(1:3,1)
+   Inst%MD_MotionMesh%RotationAcc(    1:3,1) = Inst%tmpAccelerations(4:6,1)
 END SUBROUTINE Set_MotionMesh
 
 !---------------------------------------------------------------------------------------------------------------
 !> Map the motion of the intermediate input mesh over to the input meshes
-!! This routine is operating on module level data, hence few inputs
-SUBROUTINE MD_SetInputMotion( u_local, ErrStat, ErrMsg )
+!! This routine is operating on the instance data, hence few inputs
+SUBROUTINE MD_SetInputMotion( Inst, u_local, ErrStat, ErrMsg )
+   TYPE(MD_C_InstanceType),   POINTER        :: Inst
    TYPE(MD_InputType),        INTENT(INOUT)  :: u_local
    INTEGER(IntKi),            INTENT(  OUT)  :: ErrStat
    CHARACTER(ErrMsgLen),      INTENT(  OUT)  :: ErrMsg
@@ -746,7 +793,7 @@ SUBROUTINE MD_SetInputMotion( u_local, ErrStat, ErrMsg )
    ErrMsg = ''
 
    IF ( allocated(u_local%CoupledKinematics) ) THEN
-      CALL Transfer_Point_to_Point( MD_MotionMesh, u_local%CoupledKinematics(1), Map_Motion_2_MD, ErrStat, ErrMsg )
+      CALL Transfer_Point_to_Point( Inst%MD_MotionMesh, u_local%CoupledKinematics(1), Inst%Map_Motion_2_MD, ErrStat, ErrMsg )
    END IF
 END SUBROUTINE MD_SetInputMotion
 
@@ -755,7 +802,8 @@ END SUBROUTINE MD_SetInputMotion
 !! we are mapping two meshes over to a single one, we use an intermediate
 !! temporary mesh -- This step is not currently necessary in MD since only one set
 !! of load points is used with MD.
-SUBROUTINE MD_TransferLoads( u_local, y_local, ErrStat, ErrMsg )
+SUBROUTINE MD_TransferLoads( Inst, u_local, y_local, ErrStat, ErrMsg )
+   TYPE(MD_C_InstanceType),   POINTER        :: Inst
    TYPE(MD_InputType),        INTENT(IN   )  :: u_local     ! Only one input (probably at T)
    TYPE(MD_OutputType),       INTENT(IN   )  :: y_local     ! Only one input (probably at T)
    INTEGER(IntKi),            INTENT(  OUT)  :: ErrStat
@@ -763,23 +811,96 @@ SUBROUTINE MD_TransferLoads( u_local, y_local, ErrStat, ErrMsg )
 
    ErrStat = ErrID_None
    ErrMsg = ''
-   MD_LoadMesh%Force            = 0.0_ReKi
-   MD_LoadMesh%Moment           = 0.0_ReKi
+   Inst%MD_LoadMesh%Force            = 0.0_ReKi
+   Inst%MD_LoadMesh%Moment           = 0.0_ReKi
 
    !  mesh
    IF ( allocated(y_local%CoupledLoads) ) THEN
-       CALL Transfer_Point_to_Point( y_local%CoupledLoads(1), MD_LoadMesh, Map_MD_2_Load, ErrStat, ErrMsg, u_local%CoupledKinematics(1), MD_MotionMesh )
+       CALL Transfer_Point_to_Point( y_local%CoupledLoads(1), Inst%MD_LoadMesh, Inst%Map_MD_2_Load, ErrStat, ErrMsg, u_local%CoupledKinematics(1), Inst%MD_MotionMesh )
        IF (ErrStat >= AbortErrLev)  RETURN
    END IF
 END SUBROUTINE MD_TransferLoads
 
 !---------------------------------------------------------------------------------------------------------------
 !> Transfer the loads from the load mesh to the temporary array for output
-!! This routine is operating on module level data, hence few inputs
-SUBROUTINE Set_OutputLoadArray()
+!! This routine is operating on the instance data, hence few inputs
+SUBROUTINE Set_OutputLoadArray(Inst)
+   TYPE(MD_C_InstanceType),   POINTER        :: Inst
    ! Set mesh corresponding to input motions
-   tmpForces(1:3,1)          = MD_LoadMesh%Force (1:3,1)
-   tmpForces(4:6,1)          = MD_LoadMesh%Moment(1:3,1)
+   Inst%tmpForces(1:3,1)          = Inst%MD_LoadMesh%Force (1:3,1)
+   Inst%tmpForces(4:6,1)          = Inst%MD_LoadMesh%Moment(1:3,1)
 END SUBROUTINE Set_OutputLoadArray
 
+
+!---------------------------------------------------------------------------------------------------------------
+!> Create a new instance and return its handle.  Slots freed by MD_C_End are reused.
+subroutine NewInstance(Handle, Inst, ErrStat, ErrMsg)
+   integer(c_int),                     intent(  out) :: Handle      !< handle (index into Instances)
+   type(MD_C_InstanceType), pointer,  intent(  out) :: Inst        !< new instance data
+   integer(IntKi),                            intent(  out) :: ErrStat
+   character(ErrMsgLen),               intent(  out) :: ErrMsg
+   type(MD_C_InstancePtr), allocatable              :: TmpList(:)
+   integer                                          :: i, NumOld, ErrStat2
+   character(*), parameter                          :: RoutineName = 'NewInstance'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   Handle  = 0_c_int
+   Inst    => NULL()
+
+   ! find a free slot, growing the list if there is none
+   NumOld = 0
+   if (allocated(Instances)) NumOld = size(Instances)
+   do i = 1, NumOld
+      if (.not. associated(Instances(i)%Inst)) exit
+   enddo
+   if (i > NumOld) then
+      allocate(TmpList(max(4, 2*NumOld)), STAT=ErrStat2)
+      if (ErrStat2 /= 0) then
+         call SetErrStat(ErrID_Fatal, "Could not allocate instance list", ErrStat, ErrMsg, RoutineName)
+         return
+      endif
+      if (NumOld > 0) TmpList(1:NumOld) = Instances
+      call move_alloc(TmpList, Instances)
+   endif
+
+   allocate(Instances(i)%Inst, STAT=ErrStat2)
+   if (ErrStat2 /= 0) then
+      call SetErrStat(ErrID_Fatal, "Could not allocate instance data", ErrStat, ErrMsg, RoutineName)
+      return
+   endif
+   Inst   => Instances(i)%Inst
+   Handle =  int(i, c_int)
+end subroutine NewInstance
+
+!---------------------------------------------------------------------------------------------------------------
+!> Return the instance data for a handle, or a fatal error if the handle is not in use
+subroutine GetInstance(Handle, Inst, ErrStat, ErrMsg)
+   integer(c_int),                     intent(in   ) :: Handle
+   type(MD_C_InstanceType), pointer,  intent(  out) :: Inst
+   integer(IntKi),                            intent(  out) :: ErrStat
+   character(ErrMsgLen),               intent(  out) :: ErrMsg
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   Inst    => NULL()
+   if (allocated(Instances)) then
+      if (Handle >= 1 .and. Handle <= size(Instances)) Inst => Instances(Handle)%Inst
+   endif
+   if (.not. associated(Inst)) then
+      ErrStat = ErrID_Fatal
+      ErrMsg  = "Invalid MoorDyn instance handle "//trim(Num2LStr(int(Handle,IntKi)))//". Was MD_C_Init called?"
+   endif
+end subroutine GetInstance
+
+!---------------------------------------------------------------------------------------------------------------
+!> Release the instance data for a handle.  Data inside the instance must already be destroyed.
+subroutine FreeInstance(Handle)
+   integer(c_int),                     intent(in   ) :: Handle
+   if (.not. allocated(Instances)) return
+   if (Handle < 1 .or. Handle > size(Instances)) return
+   if (associated(Instances(Handle)%Inst)) deallocate(Instances(Handle)%Inst)
+   Instances(Handle)%Inst => NULL()
+end subroutine FreeInstance
+
 END MODULE
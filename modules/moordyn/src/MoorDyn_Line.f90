@@ -35,6 +35,7 @@ MODULE MoorDyn_Line
    PUBLIC :: Line_Initialize
    PUBLIC :: Line_SetState
    PUBLIC :: Line_GetStateDeriv
+   PUBLIC :: Line_SemiImplicitStep
    PUBLIC :: Line_SetEndKinematics
    PUBLIC :: Line_GetEndStuff
    PUBLIC :: Line_GetEndSegmentInfo
@@ -1078,7 +1079,7 @@ CONTAINS
    !--------------------------------------------------------------
 
    !--------------------------------------------------------------
-   SUBROUTINE Line_GetStateDeriv(Line, Xd, m, p, ErrStat, ErrMsg)  !, FairFtot, FairMtot, AnchFtot, AnchMtot)
+   SUBROUTINE Line_GetStateDeriv(Line, Xd, m, p, ErrStat, ErrMsg, WaveField_m)  !, FairFtot, FairMtot, AnchFtot, AnchMtot)
 
       TYPE(MD_Line),          INTENT(INOUT) :: Line    ! the current Line object
       Real(DbKi),             INTENT(INOUT) :: Xd(:)   ! state derivative vector section for this line
@@ -1086,6 +1087,7 @@ CONTAINS
       TYPE(MD_ParameterType), INTENT(IN   ) :: p       ! Parameters
       INTEGER(IntKi),         INTENT(  OUT) :: ErrStat ! Error status of the operation
       CHARACTER(*),           INTENT(  OUT) :: ErrMsg  ! Error message if ErrStat /= ErrID_None
+      TYPE(GridInterp_MiscVarType), OPTIONAL, INTENT(INOUT) :: WaveField_m ! wave field interpolation scratch (when lines are processed in parallel)
 
       
       !   Real(DbKi), INTENT( IN )      :: X(:)           ! state vector, provided
@@ -1222,7 +1224,7 @@ CONTAINS
       
       ! apply wave kinematics (if there are any) 
       DO i=0,N
-         CALL getWaterKin(p, m, Line%r(1,i), Line%r(2,i), Line%r(3,i), Line%time, Line%U(:,i), Line%Ud(:,i), Line%zeta(i), Line%PDyn(i), ErrStat2, ErrMsg2)
+         CALL getWaterKin(p, m, Line%r(1,i), Line%r(2,i), Line%r(3,i), Line%time, Line%U(:,i), Line%Ud(:,i), Line%zeta(i), Line%PDyn(i), ErrStat2, ErrMsg2, WaveField_m)
          CALL SetErrStat(ErrStat2,ErrMsg2,ErrStat,ErrMsg,RoutineName)
       END DO
       
@@ -1836,6 +1838,90 @@ CONTAINS
    !=====================================================================
 
 
+   !--------------------------------------------------------------
+   ! Semi-implicit Euler update of the internal node velocities and positions of a line. The axial stiffness
+   ! and internal damping of the segments are treated implicitly, which gives a block-tridiagonal system
+   ! (3x3 blocks, one per internal node) that is solved directly. All other forces are taken explicitly from
+   ! the last call to Line_GetStateDeriv, which must have been made at the state X.
+   SUBROUTINE Line_SemiImplicitStep(Line, dtM, X, Xnew)
+
+      TYPE(MD_Line),          INTENT(IN   ) :: Line    ! the current Line object (forces, mass matrices, and geometry at state X)
+      Real(DbKi),             INTENT(IN   ) :: dtM     ! time step size [s]
+      Real(DbKi),             INTENT(IN   ) :: X(:)    ! state vector section for this line at the start of the step
+      Real(DbKi),             INTENT(INOUT) :: Xnew(:) ! state vector section for this line at the end of the step (internal node entries are overwritten)
+
+      INTEGER(IntKi)                   :: I              ! index of segments or nodes along line
+      INTEGER(IntKi)                   :: J              ! index
+      INTEGER(IntKi)                   :: N              ! number of segments in line
+      Real(DbKi)                       :: kSeg           ! axial stiffness of a segment [N/m]
+      Real(DbKi)                       :: cSeg           ! axial damping of a segment [N-s/m]
+      Real(DbKi)                       :: qq(3,3)        ! outer product of segment unit vector
+      Real(DbKi)                       :: A(3,3,Line%N)  ! implicit axial coupling block of each segment, (dt*c + dt^2*k) q q^T
+      Real(DbKi)                       :: K(3,3,Line%N)  ! axial stiffness block of each segment, k q q^T
+      Real(DbKi)                       :: v0(3,0:Line%N) ! node velocities at the start of the step (end nodes from attached objects)
+      Real(DbKi)                       :: Dinv(3,3,Line%N-1) ! inverses of the eliminated diagonal blocks
+      Real(DbKi)                       :: g(3,Line%N-1)  ! eliminated right-hand sides, then velocity increments
+      Real(DbKi)                       :: W(3,3)         ! elimination multiplier
+
+      N = Line%N
+      if (N < 2) return   ! no internal nodes
+
+      ! segment stiffness and damping along the segment direction
+      DO I = 1, N
+         if (Line%ElasticMod == 1) then
+            if (Line%lstr(I) > Line%l(I)) then
+               kSeg = Line%EA/Line%l(I)   ! tangent stiffness (EA is already the secant value for nonlinear lines)
+            else
+               kSeg = 0.0_DbKi            ! slack segment
+            end if
+            cSeg = Line%BA/Line%l(I)
+         else
+            kSeg = 0.0_DbKi               ! viscoelastic segments are left explicit
+            cSeg = 0.0_DbKi
+         end if
+
+         qq = OuterProduct(Line%qs(:,I), Line%qs(:,I))
+         K(:,:,I) = kSeg*qq
+         A(:,:,I) = (dtM*cSeg + dtM*dtM*kSeg)*qq
+      END DO
+
+      v0(:,0) = Line%rd(:,0)
+      v0(:,N) = Line%rd(:,N)
+      DO I = 1, N-1
+         v0(:,I) = X(3*I-2:3*I)
+      END DO
+
+      ! (M + dt*C + dt^2*K) dv = dt*(F - dt*K*v0), eliminated forward with the block Thomas algorithm
+      DO I = 1, N-1
+         g(:,I) = dtM*( Line%Fnet(:,I) - dtM*( MATMUL(K(:,:,I), v0(:,I) - v0(:,I-1)) - MATMUL(K(:,:,I+1), v0(:,I+1) - v0(:,I)) ) )
+         if (I == 1) then
+            CALL Inverse3by3(Dinv(:,:,I), Line%M(:,:,I) + A(:,:,I) + A(:,:,I+1))
+         else
+            ! the off-diagonal block coupling nodes I-1 and I is -A(:,:,I)
+            W = MATMUL(A(:,:,I), Dinv(:,:,I-1))
+            CALL Inverse3by3(Dinv(:,:,I), Line%M(:,:,I) + A(:,:,I) + A(:,:,I+1) - MATMUL(W, A(:,:,I)))
+            g(:,I) = g(:,I) + MATMUL(W, g(:,I-1))
+         end if
+      END DO
+
+      ! back substitution
+      g(:,N-1) = MATMUL(Dinv(:,:,N-1), g(:,N-1))
+      DO I = N-2, 1, -1
+         g(:,I) = MATMUL(Dinv(:,:,I), g(:,I) + MATMUL(A(:,:,I+1), g(:,I+1)))
+      END DO
+
+      ! new velocities, then positions from the new velocities
+      DO I = 1, N-1
+         DO J = 1, 3
+            Xnew(        3*I-3 + J) = v0(J,I) + g(J,I)
+            Xnew(3*N-3 + 3*I-3 + J) = X(3*N-3 + 3*I-3 + J) + dtM*Xnew(3*I-3 + J)
+         END DO
+      END DO
+
+   END SUBROUTINE Line_SemiImplicitStep
+   !--------------------------------------------------------------
+
+
    !--------------------------------------------------------------
    SUBROUTINE Line_SetEndKinematics(Line, r_in, rd_in, t, topOfLine)
 
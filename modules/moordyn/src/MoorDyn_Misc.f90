@@ -905,7 +905,7 @@ CONTAINS
    
    
    ! master function to get wave/water kinematics at a given point -- called by each object 
-   SUBROUTINE getWaterKin(p, m, x, y, z, t, U, Ud, zeta, PDyn, ErrStat, ErrMsg)
+   SUBROUTINE getWaterKin(p, m, x, y, z, t, U, Ud, zeta, PDyn, ErrStat, ErrMsg, WaveField_m)
    
       ! This whole approach assuems that px, py, and pz are in increasing order.
       ! Wheeler stretching is built in for WaterKin 1 and 2.
@@ -922,6 +922,7 @@ CONTAINS
       Real(DbKi),                       INTENT (INOUT)       :: PDyn        ! dynamic fluid pressure
       INTEGER(IntKi),                   INTENT(  OUT)        :: ErrStat     ! Error status of the operation
       CHARACTER(*),                     INTENT(  OUT)        :: ErrMsg      ! Error message IF ErrStat /= ErrID_None
+      TYPE(GridInterp_MiscVarType), OPTIONAL, INTENT(INOUT)  :: WaveField_m ! wave field interpolation scratch to use instead of m%WaveField_m (e.g., one per thread)
 
       ! outputs of WaveField_GetNodeWaveKin not in above list (single precision required by wave grid)
       Real(ReKi)                 :: xyz_sp(3) ! single precision
@@ -967,7 +968,6 @@ CONTAINS
             ! find time interpolation indices and coefficients
             it = floor(t/ p%dtWave) + 1    ! add 1 because Fortran indexing starts at 1
             ft = (t - (it-1)*p%dtWave)/p%dtWave
-            m%WaveTi = it                  
          
             ! find x-y interpolation indices and coefficients
             CALL getInterpNumsSiKi(p%pxWave, REAL(x, SiKi), 1, ix, fx) ! wave grid
@@ -1020,7 +1020,11 @@ CONTAINS
          xyz_sp = REAL([x, y, z], SiKi)
 
          ! for now we will force the node to be in the water (forceNodeInWater = True). Rods handle partial submergence separately so they need to get information from SeaState 
-         CALL WaveField_GetNodeWaveKin(p%WaveField, m%WaveField_m, t, xyz_sp, .true., .true., nodeInWater, WaveElev1, WaveElev2, zeta_sp, PDyn_sp, U_sp, Ud_sp, FAMCF, ErrStat2, ErrMsg2 ) ! outputs: nodeInWater, WaveElev1, WaveElev2, FAMCF all unused
+         if (present(WaveField_m)) then
+            CALL WaveField_GetNodeWaveKin(p%WaveField, WaveField_m, t, xyz_sp, .true., .true., nodeInWater, WaveElev1, WaveElev2, zeta_sp, PDyn_sp, U_sp, Ud_sp, FAMCF, ErrStat2, ErrMsg2 ) ! outputs: nodeInWater, WaveElev1, WaveElev2, FAMCF all unused
+         else
+            CALL WaveField_GetNodeWaveKin(p%WaveField, m%WaveField_m, t, xyz_sp, .true., .true., nodeInWater, WaveElev1, WaveElev2, zeta_sp, PDyn_sp, U_sp, Ud_sp, FAMCF, ErrStat2, ErrMsg2 ) ! outputs: nodeInWater, WaveElev1, WaveElev2, FAMCF all unused
+         end if
          CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
 
          ! Unpack all WaveGrid outputs to MD output data types (single to double)
@@ -415,7 +415,9 @@ IMPLICIT NONE
     INTEGER(IntKi)  :: NConns = 0      !< number of Connect type Points - not to be confused with NPoints []
     INTEGER(IntKi)  :: NAnchs = 0      !< number of Anchor type Points []
     REAL(DbKi)  :: Tmax = 0.0_R8Ki      !< simulation duration [[s]]
-    INTEGER(IntKi)  :: tScheme = 0      !< Time integration scheme (0 = RK2, 1 = RK4). Default is RK2 [-]
+    INTEGER(IntKi)  :: tScheme = 0      !< Time integration scheme (0 = RK2, 1 = RK4, 2 = adaptive RK23, 3 = semi-implicit Euler). Default is RK2 [-]
+    REAL(DbKi)  :: rTol = 0.0_R8Ki      !< relative error tolerance of the adaptive RK23 scheme [-]
+    REAL(DbKi)  :: aTol = 0.0_R8Ki      !< absolute error tolerance of the adaptive RK23 scheme [-]
     REAL(DbKi)  :: g = 9.81      !< gravitational constant (positive) [[m/s^2]]
     REAL(DbKi)  :: rhoW = 1025      !< density of seawater [[kg/m^3]]
     REAL(DbKi)  :: WtrDpth = 0.0_R8Ki      !< water depth [[m]]
@@ -523,6 +525,8 @@ IMPLICIT NONE
     TYPE(MD_ContinuousStateType)  :: xTemp      !< contains temporary state vector used in integration (put here so it's only allocated once) [-]
     TYPE(MD_ContinuousStateType)  :: xdTemp      !< contains temporary state derivative vector used in integration (put here so it's only allocated once) [-]
     TYPE(MD_ContinuousStateType)  :: kSum      !< Sum of RK4 slope estimates: k0 + 2*k1 + 2*k2 + k3 [-]
+    REAL(DbKi) , DIMENSION(:,:), ALLOCATABLE  :: kRK23      !< stage slopes k1-k4 of the adaptive RK23 scheme [-]
+    REAL(DbKi)  :: dtAdapt = 0.0_R8Ki      !< last accepted step size of the adaptive RK23 scheme [[s]]
     REAL(DbKi) , DIMENSION(1:6)  :: zeros6 = 0.0_R8Ki      !< array of zeros for convenience [-]
     REAL(DbKi) , DIMENSION(:), ALLOCATABLE  :: MDWrOutput      !< Data from time step to be written to a MoorDyn output file [-]
     REAL(DbKi)  :: LastOutTime = 0.0_R8Ki      !< Time of last writing to MD output files [-]
@@ -2851,6 +2855,20 @@ subroutine MD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSta
    end if
 end subroutine
 
+subroutine MD_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(MD_ContinuousStateType), intent(inout) :: ContStateData1
+   type(MD_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(DbKi), allocatable :: tmp_states(:)
+   character(*), parameter        :: RoutineName = 'MD_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%states, tmp_states)
+   call move_alloc(ContStateData2%states, ContStateData1%states)
+   call move_alloc(tmp_states, ContStateData2%states)
+end subroutine
+
 subroutine MD_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(MD_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2895,6 +2913,20 @@ subroutine MD_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSta
    DstDiscStateData%dummy = SrcDiscStateData%dummy
 end subroutine
 
+subroutine MD_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(MD_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(MD_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_dummy
+   character(*), parameter        :: RoutineName = 'MD_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = DiscStateData1%dummy
+   DiscStateData1%dummy = DiscStateData2%dummy
+   DiscStateData2%dummy = tmp_dummy
+end subroutine
+
 subroutine MD_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(MD_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2933,6 +2965,20 @@ subroutine MD_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%dummy = SrcConstrStateData%dummy
 end subroutine
 
+subroutine MD_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(MD_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(MD_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_dummy
+   character(*), parameter        :: RoutineName = 'MD_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = ConstrStateData1%dummy
+   ConstrStateData1%dummy = ConstrStateData2%dummy
+   ConstrStateData2%dummy = tmp_dummy
+end subroutine
+
 subroutine MD_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(MD_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2971,6 +3017,20 @@ subroutine MD_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Err
    DstOtherStateData%dummy = SrcOtherStateData%dummy
 end subroutine
 
+subroutine MD_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(MD_OtherStateType), intent(inout) :: OtherStateData1
+   type(MD_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_dummy
+   character(*), parameter        :: RoutineName = 'MD_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_dummy = OtherStateData1%dummy
+   OtherStateData1%dummy = OtherStateData2%dummy
+   OtherStateData2%dummy = tmp_dummy
+end subroutine
+
 subroutine MD_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(MD_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3063,6 +3123,8 @@ subroutine MD_CopyParam(SrcParamData, DstParamData, CtrlCode, ErrStat, ErrMsg)
    DstParamData%NAnchs = SrcParamData%NAnchs
    DstParamData%Tmax = SrcParamData%Tmax
    DstParamData%tScheme = SrcParamData%tScheme
+   DstParamData%rTol = SrcParamData%rTol
+   DstParamData%aTol = SrcParamData%aTol
    DstParamData%g = SrcParamData%g
    DstParamData%rhoW = SrcParamData%rhoW
    DstParamData%WtrDpth = SrcParamData%WtrDpth
@@ -3426,6 +3488,8 @@ subroutine MD_PackParam(RF, Indata)
    call RegPack(RF, InData%NAnchs)
    call RegPack(RF, InData%Tmax)
    call RegPack(RF, InData%tScheme)
+   call RegPack(RF, InData%rTol)
+   call RegPack(RF, InData%aTol)
    call RegPack(RF, InData%g)
    call RegPack(RF, InData%rhoW)
    call RegPack(RF, InData%WtrDpth)
@@ -3534,6 +3598,8 @@ subroutine MD_UnPackParam(RF, OutData)
    call RegUnpack(RF, OutData%NAnchs); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%Tmax); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%tScheme); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%rTol); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%aTol); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%g); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%rhoW); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%WtrDpth); if (RegCheckErr(RF, RoutineName)) return
@@ -3684,6 +3750,45 @@ subroutine MD_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine MD_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(MD_InputType), intent(inout) :: InputData1
+   type(MD_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_DeltaL(:)
+   REAL(ReKi), allocatable :: tmp_DeltaLdot(:)
+   character(*), parameter        :: RoutineName = 'MD_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(InputData1%CoupledKinematics) .neqv. allocated(InputData2%CoupledKinematics)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%CoupledKinematics with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%CoupledKinematics)) then
+      if (any(lbound(InputData1%CoupledKinematics) /= lbound(InputData2%CoupledKinematics)) .or. any(ubound(InputData1%CoupledKinematics) /= ubound(InputData2%CoupledKinematics))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%CoupledKinematics with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%CoupledKinematics)
+      UB(1:1) = ubound(InputData1%CoupledKinematics)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%CoupledKinematics(i1), InputData2%CoupledKinematics(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call move_alloc(InputData1%DeltaL, tmp_DeltaL)
+   call move_alloc(InputData2%DeltaL, InputData1%DeltaL)
+   call move_alloc(tmp_DeltaL, InputData2%DeltaL)
+   call move_alloc(InputData1%DeltaLdot, tmp_DeltaLdot)
+   call move_alloc(InputData2%DeltaLdot, InputData1%DeltaLdot)
+   call move_alloc(tmp_DeltaLdot, InputData2%DeltaLdot)
+end subroutine
+
 subroutine MD_DestroyInput(InputData, ErrStat, ErrMsg)
    type(MD_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4399,6 +4504,19 @@ subroutine MD_CopyMisc(SrcMiscData, DstMiscData, CtrlCode, ErrStat, ErrMsg)
    call MD_CopyContState(SrcMiscData%kSum, DstMiscData%kSum, CtrlCode, ErrStat2, ErrMsg2)
    call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
    if (ErrStat >= AbortErrLev) return
+   if (allocated(SrcMiscData%kRK23)) then
+      LB(1:2) = lbound(SrcMiscData%kRK23)
+      UB(1:2) = ubound(SrcMiscData%kRK23)
+      if (.not. allocated(DstMiscData%kRK23)) then
+         allocate(DstMiscData%kRK23(LB(1):UB(1),LB(2):UB(2)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstMiscData%kRK23.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstMiscData%kRK23 = SrcMiscData%kRK23
+   end if
+   DstMiscData%dtAdapt = SrcMiscData%dtAdapt
    DstMiscData%zeros6 = SrcMiscData%zeros6
    if (allocated(SrcMiscData%MDWrOutput)) then
       LB(1:1) = lbound(SrcMiscData%MDWrOutput)
@@ -4611,6 +4729,9 @@ subroutine MD_DestroyMisc(MiscData, ErrStat, ErrMsg)
    call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
    call MD_DestroyContState(MiscData%kSum, ErrStat2, ErrMsg2)
    call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (allocated(MiscData%kRK23)) then
+      deallocate(MiscData%kRK23)
+   end if
    if (allocated(MiscData%MDWrOutput)) then
       deallocate(MiscData%MDWrOutput)
    end if
@@ -4735,6 +4856,8 @@ subroutine MD_PackMisc(RF, Indata)
    call MD_PackContState(RF, InData%xTemp) 
    call MD_PackContState(RF, InData%xdTemp) 
    call MD_PackContState(RF, InData%kSum) 
+   call RegPackAlloc(RF, InData%kRK23)
+   call RegPack(RF, InData%dtAdapt)
    call RegPack(RF, InData%zeros6)
    call RegPackAlloc(RF, InData%MDWrOutput)
    call RegPack(RF, InData%LastOutTime)
@@ -4887,6 +5010,8 @@ subroutine MD_UnPackMisc(RF, OutData)
    call MD_UnpackContState(RF, OutData%xTemp) ! xTemp 
    call MD_UnpackContState(RF, OutData%xdTemp) ! xdTemp 
    call MD_UnpackContState(RF, OutData%kSum) ! kSum 
+   call RegUnpackAlloc(RF, OutData%kRK23); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%dtAdapt); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%zeros6); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%MDWrOutput); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%LastOutTime); if (RegCheckErr(RF, RoutineName)) return
@@ -2025,6 +2025,84 @@ SUBROUTINE MeshWrVTK_PointSurface ( RefPoint, M, FileRootName, VTKcount, OutputF
 
    END SUBROUTINE MeshCopy
 
+!----------------------------------------------------------------------------------------------------------------------------------
+!> Given two existing meshes, exchange the values of their fields by swapping the field allocations instead of copying the data.
+!!   (The underlying meshes are untouched.) As with MESH_UPDATECOPY in MeshCopy, the mesh and field definitions of the two
+!!   meshes must match; this is used by the registry-generated Swap routines to rotate input and state arrays in time.
+   SUBROUTINE MeshSwap( Mesh1, Mesh2, ErrStat, ErrMess )
+
+     TYPE(MeshType),              INTENT(INOUT) :: Mesh1             !< First mesh
+     TYPE(MeshType),              INTENT(INOUT) :: Mesh2             !< Second mesh
+     INTEGER(IntKi),              INTENT(OUT)   :: ErrStat           !< Error code
+     CHARACTER(*),                INTENT(OUT)   :: ErrMess           !< Error message
+
+    ! Local
+     REAL(ReKi), ALLOCATABLE                    :: TmpRe(:,:)        ! temporary for swapping single-precision fields
+     REAL(R8Ki), ALLOCATABLE                    :: TmpR8(:,:)        ! temporary for swapping double-precision fields
+     REAL(R8Ki), ALLOCATABLE                    :: TmpDCM(:,:,:)     ! temporary for swapping orientation fields
+
+
+      ErrStat = ErrID_None
+      ErrMess = ""
+
+      IF ( .NOT. Mesh1%Initialized .AND. .NOT. Mesh2%Initialized ) RETURN
+
+      IF ( Mesh1%Initialized .NEQV. Mesh2%Initialized ) THEN
+         ErrStat = ErrID_Fatal
+         ErrMess = "MeshSwap: cannot swap an initialized mesh with an uninitialized mesh."
+         RETURN
+      ENDIF
+
+      IF ( Mesh1%nNodes .NE. Mesh2%nNodes .OR. Mesh1%nScalars .NE. Mesh2%nScalars ) THEN
+         ErrStat = ErrID_Fatal
+         ErrMess = "MeshSwap: meshes have different numbers of nodes or scalars."
+         RETURN
+      ENDIF
+
+      IF ( ANY( Mesh1%FieldMask .NEQV. Mesh2%FieldMask ) ) THEN
+         ErrStat = ErrID_Fatal
+         ErrMess = "MeshSwap: meshes have different fields."
+         RETURN
+      ENDIF
+
+      CALL MOVE_ALLOC( Mesh1%Force,           TmpRe  )
+      CALL MOVE_ALLOC( Mesh2%Force,           Mesh1%Force )
+      CALL MOVE_ALLOC( TmpRe,                 Mesh2%Force )
+
+      CALL MOVE_ALLOC( Mesh1%Moment,          TmpRe  )
+      CALL MOVE_ALLOC( Mesh2%Moment,          Mesh1%Moment )
+      CALL MOVE_ALLOC( TmpRe,                 Mesh2%Moment )
+
+      CALL MOVE_ALLOC( Mesh1%Orientation,     TmpDCM )
+      CALL MOVE_ALLOC( Mesh2%Orientation,     Mesh1%Orientation )
+      CALL MOVE_ALLOC( TmpDCM,                Mesh2%Orientation )
+
+      CALL MOVE_ALLOC( Mesh1%TranslationDisp, TmpR8  )
+      CALL MOVE_ALLOC( Mesh2%TranslationDisp, Mesh1%TranslationDisp )
+      CALL MOVE_ALLOC( TmpR8,                 Mesh2%TranslationDisp )
+
+      CALL MOVE_ALLOC( Mesh1%TranslationVel,  TmpRe  )
+      CALL MOVE_ALLOC( Mesh2%TranslationVel,  Mesh1%TranslationVel )
+      CALL MOVE_ALLOC( TmpRe,                 Mesh2%TranslationVel )
+
+      CALL MOVE_ALLOC( Mesh1%RotationVel,     TmpRe  )
+      CALL MOVE_ALLOC( Mesh2%RotationVel,     Mesh1%RotationVel )
+      CALL MOVE_ALLOC( TmpRe,                 Mesh2%RotationVel )
+
+      CALL MOVE_ALLOC( Mesh1%TranslationAcc,  TmpRe  )
+      CALL MOVE_ALLOC( Mesh2%TranslationAcc,  Mesh1%TranslationAcc )
+      CALL MOVE_ALLOC( TmpRe,                 Mesh2%TranslationAcc )
+
+      CALL MOVE_ALLOC( Mesh1%RotationAcc,     TmpRe  )
+      CALL MOVE_ALLOC( Mesh2%RotationAcc,     Mesh1%RotationAcc )
+      CALL MOVE_ALLOC( TmpRe,                 Mesh2%RotationAcc )
+
+      CALL MOVE_ALLOC( Mesh1%Scalars,         TmpRe  )
+      CALL MOVE_ALLOC( Mesh2%Scalars,         Mesh1%Scalars )
+      CALL MOVE_ALLOC( TmpRe,                 Mesh2%Scalars )
+
+   END SUBROUTINE MeshSwap
+
 !----------------------------------------------------------------------------------------------------------------------------------
 !> For a given node in a mesh, assign the coordinates of the node in the global coordinate space. 
 !! If an Orient argument is included, the node will also be assigned the specified orientation 
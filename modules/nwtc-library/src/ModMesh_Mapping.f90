@@ -30,6 +30,7 @@ MODULE ModMesh_Mapping
    USE ModReg
    USE ModMesh
    USE NWTC_LAPACK
+   USE KdTree
 
    IMPLICIT NONE
 
@@ -75,9 +76,9 @@ MODULE ModMesh_Mapping
 #endif
       INTEGER,        ALLOCATABLE :: LoadLn2_A_Mat_Piv(:)      !< The pivot values for the factorization of LoadLn2_A_Mat [-]
       REAL(R8Ki),     ALLOCATABLE :: DisplacedPosition(:,:,:)  !< couple_arm +Scr%Disp - Dest%Disp for each mapped node (stored here for efficiency) [m]
-      REAL(R8Ki),     ALLOCATABLE :: LoadLn2_A_Mat(:,:)        !< The n-by-n (n=3xNNodes) matrix that makes up the diagonal of the [A 0; B A] matrix in the point-to-line load mapping [-]
-      REAL(R8Ki),     ALLOCATABLE :: LoadLn2_F(:,:)            !< The 3-components of the forces for each node of an element in the point-to-line load mapping (for each element) [-]
-      REAL(R8Ki),     ALLOCATABLE :: LoadLn2_M(:,:)            !< The 3-components of the moments for each node of an element in the point-to-line load mapping (for each element) [-]
+      REAL(R8Ki),     ALLOCATABLE :: LoadLn2_A_Mat(:,:)        !< The NNodes-by-NNodes matrix that (applied to each of the 3 components) makes up the diagonal of the [A 0; B A] matrix in the point-to-line load mapping [-]
+      REAL(R8Ki),     ALLOCATABLE :: LoadLn2_F(:,:)            !< The forces (NNodes-by-3) for each node in the point-to-line load mapping [-]
+      REAL(R8Ki),     ALLOCATABLE :: LoadLn2_M(:,:)            !< The moments (NNodes-by-3) for each node in the point-to-line load mapping [-]
       
       TYPE(MeshMapLinearizationType) :: dM                     !< type that contains information for linearization matrices, partial M partial u (or y)                  
    END TYPE MeshMapType
@@ -1820,6 +1821,7 @@ SUBROUTINE CreateMapping_ProjectToLine2(Mesh1, Mesh2, NodeMap, Mesh1_TYPE, ErrSt
 
    INTEGER(IntKi)  :: iElem, iNode, i  ! do-loop counter for elements on Mesh1, associated node(S)
    INTEGER(IntKi)  :: jElem            ! do-loop counter for elements on Mesh2, associated node
+   INTEGER(IntKi)  :: k                ! do-loop counter for candidate elements on Mesh2
 
    INTEGER(IntKi)  :: n1, n2           ! nodes associated with an element
 
@@ -1829,6 +1831,14 @@ SUBROUTINE CreateMapping_ProjectToLine2(Mesh1, Mesh2, NodeMap, Mesh1_TYPE, ErrSt
    INTEGER(IntKi)  :: closest_elem
    REAL(ReKi)      :: closest_elem_diff
    REAL(ReKi)      :: closest_elem_distance
+
+   TYPE(KdTreeType)             :: ElemTree          ! k-d tree of Mesh2 element midpoints
+   REAL(ReKi),     ALLOCATABLE  :: ElemCenter(:,:)   ! midpoint of each Mesh2 element
+   INTEGER,        ALLOCATABLE  :: ElemList(:)       ! candidate Mesh2 elements for the current node (ascending order)
+   INTEGER                      :: nCandidates       ! number of candidate elements in ElemList
+   INTEGER(IntKi)               :: nElem2            ! number of Mesh2 elements
+   REAL(ReKi)                   :: max_half_len      ! half of the length of the longest Mesh2 element
+   REAL(ReKi)                   :: search_radius     ! radius around the node in which all elements closer than this are candidates
    
 #ifdef DEBUG_MESHMAPPING
    INTEGER(IntKi)       :: Un               ! unit number for debugging
@@ -1848,7 +1858,30 @@ SUBROUTINE CreateMapping_ProjectToLine2(Mesh1, Mesh2, NodeMap, Mesh1_TYPE, ErrSt
       NodeMap(n1)%OtherMesh_Element = NODE_NOT_MAPPED ! initialize this so we know if we've mapped this node already (done only because we may have different elements)
    end do !n1
       
-
+   
+      ! Build a k-d tree of the Mesh2 element midpoints. A node is never farther from an element than from the element's 
+      ! midpoint plus half the element length, so searching the tree for midpoints within (search_radius + max_half_len) 
+      ! returns every element whose distance to the node is less than search_radius.
+   nElem2 = Mesh2%ElemTable(Mesh2_TYPE)%nelem
+   ALLOCATE( ElemCenter(3, max(1,nElem2)), ElemList(max(1,nElem2)) )
+   ElemCenter   = 0.0_ReKi
+   max_half_len = 0.0_ReKi
+   do jElem = 1, nElem2
+      n1 = Mesh2%ElemTable(Mesh2_TYPE)%Elements(jElem)%ElemNodes(1)
+      n2 = Mesh2%ElemTable(Mesh2_TYPE)%Elements(jElem)%ElemNodes(2)
+      
+      n1_n2_vector = Mesh2%Position(:,n2) - Mesh2%Position(:,n1)
+      denom        = DOT_PRODUCT( n1_n2_vector, n1_n2_vector )
+      IF ( EqualRealNos( denom, 0.0_ReKi ) ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Division by zero because Line2 element nodes are in same position.', ErrStat, ErrMsg, RoutineName)
+         RETURN
+      END IF
+      
+      ElemCenter(:,jElem) = 0.5_ReKi*( Mesh2%Position(:,n1) + Mesh2%Position(:,n2) )
+      max_half_len = max( max_half_len, 0.5_ReKi*sqrt(denom) )
+   end do
+   if (nElem2 > 0) call kdtree_build(ElemTree, ElemCenter(:,1:nElem2))
+   
 
    do iElem = 1, Mesh1%ElemTable(Mesh1_TYPE)%nelem   ! number of Mesh1_TYPE elements on Mesh1
       do iNode = 1, SIZE( Mesh1%ElemTable(Mesh1_TYPE)%Elements(iElem)%ElemNodes )
@@ -1857,94 +1890,124 @@ SUBROUTINE CreateMapping_ProjectToLine2(Mesh1, Mesh2, NodeMap, Mesh1_TYPE, ErrSt
 
          ! destination point
          Mesh1_xyz = Mesh1%Position(:, i)
+         
+            ! start the search with the distance to the closest element midpoint (an upper bound on the distance to that element)
+         if (nElem2 > 0) then
+            jElem = kdtree_nearest_neighbor(ElemTree, Mesh1_xyz)
+            search_radius = max( TwoNorm( ElemCenter(:,jElem) - Mesh1_xyz ), max_half_len )
+         else
+            search_radius = 0.0_ReKi
+         end if
+         
+            ! Grow the search radius until we find an element the node projects onto that is closer than search_radius. Elements outside 
+            ! the candidate list are farther than search_radius, so the result is identical to checking every element on Mesh2.
+            ! If the candidate list contains every element, this is the full search (including the numerical-roundoff checks below).
+         do
 
-         found = .false.
-         min_dist = HUGE(min_dist)
+            if (nElem2 > 0) then
+               call kdtree_points_in_radius(ElemTree, Mesh1_xyz, (search_radius + max_half_len)*1.001_ReKi, ElemList, nCandidates)
+               call kdtree_sort_indices(ElemList(1:nCandidates))
+            else
+               nCandidates = 0
+            end if
+
+            found = .false.
+            min_dist = HUGE(min_dist)
+            NodeMap(i)%OtherMesh_Element = NODE_NOT_MAPPED
          
-            ! some values for finding mapping if there are some numerical issues
-         closest_elem_diff = HUGE(min_dist)
-         closest_elem = 0
+               ! some values for finding mapping if there are some numerical issues
+            closest_elem_diff = HUGE(min_dist)
+            closest_elem = 0
 
-         do jElem = 1, Mesh2%ElemTable(Mesh2_TYPE)%nelem  ! ELEMENT_LINE2 = Mesh2_TYPE
+            do k = 1, nCandidates  ! candidate elements in increasing order
+               jElem = ElemList(k)
 
-               ! write(*,*) 'i,jElem = ', i,jElem, 'found = ', found
+                  ! write(*,*) 'i,jElem = ', i,jElem, 'found = ', found
 
-               ! grab node numbers associated with the jElem_th element
-            n1 = Mesh2%ElemTable(Mesh2_TYPE)%Elements(jElem)%ElemNodes(1)
-            n2 = Mesh2%ElemTable(Mesh2_TYPE)%Elements(jElem)%ElemNodes(2)
+                  ! grab node numbers associated with the jElem_th element
+               n1 = Mesh2%ElemTable(Mesh2_TYPE)%Elements(jElem)%ElemNodes(1)
+               n2 = Mesh2%ElemTable(Mesh2_TYPE)%Elements(jElem)%ElemNodes(2)
 
-               ! Calculate vectors used in projection operation
+                  ! Calculate vectors used in projection operation
 
-            n1_n2_vector    = Mesh2%Position(:,n2) - Mesh2%Position(:,n1)
-            n1_Point_vector = Mesh1_xyz - Mesh2%Position(:,n1)
+               n1_n2_vector    = Mesh2%Position(:,n2) - Mesh2%Position(:,n1)
+               n1_Point_vector = Mesh1_xyz - Mesh2%Position(:,n1)
 
-            denom           = DOT_PRODUCT( n1_n2_vector, n1_n2_vector )
-            IF ( EqualRealNos( denom, 0.0_ReKi ) ) THEN
-               CALL SetErrStat( ErrID_Fatal, 'Division by zero because Line2 element nodes are in same position.', ErrStat, ErrMsg, RoutineName)
-               RETURN
-            END IF
+               denom           = DOT_PRODUCT( n1_n2_vector, n1_n2_vector )
+               IF ( EqualRealNos( denom, 0.0_ReKi ) ) THEN
+                  CALL SetErrStat( ErrID_Fatal, 'Division by zero because Line2 element nodes are in same position.', ErrStat, ErrMsg, RoutineName)
+                  RETURN
+               END IF
 
-               ! project point onto line defined by n1 and n2
+                  ! project point onto line defined by n1 and n2
 
-            elem_position = DOT_PRODUCT(n1_n2_vector,n1_Point_vector) / denom
+               elem_position = DOT_PRODUCT(n1_n2_vector,n1_Point_vector) / denom
 
-                  ! note: i forumlated it this way because Fortran doesn't necessarially do shortcutting and I don't want to call EqualRealNos if we don't need it:
-            if ( elem_position .ge. 0.0_ReKi .and. elem_position .le. 1.0_ReKi ) then !we're ON the element (between the two nodes)
-               on_element = .true.
-            else
-               elem_position_SiKi = REAL( elem_position, SiKi )
-               if (EqualRealNos( elem_position_SiKi, 1.0_SiKi )) then !we're ON the element (at a node)
+                     ! note: i forumlated it this way because Fortran doesn't necessarially do shortcutting and I don't want to call EqualRealNos if we don't need it:
+               if ( elem_position .ge. 0.0_ReKi .and. elem_position .le. 1.0_ReKi ) then !we're ON the element (between the two nodes)
                   on_element = .true.
-                  elem_position = 1.0_ReKi
-               elseif (EqualRealNos( elem_position_SiKi,  0.0_SiKi )) then !we're ON the element (at a node)
-                  on_element = .true.
-                  elem_position = 0.0_ReKi
-               else !we're not on the element
-                  on_element = .false.
+               else
+                  elem_position_SiKi = REAL( elem_position, SiKi )
+                  if (EqualRealNos( elem_position_SiKi, 1.0_SiKi )) then !we're ON the element (at a node)
+                     on_element = .true.
+                     elem_position = 1.0_ReKi
+                  elseif (EqualRealNos( elem_position_SiKi,  0.0_SiKi )) then !we're ON the element (at a node)
+                     on_element = .true.
+                     elem_position = 0.0_ReKi
+                  else !we're not on the element
+                     on_element = .false.
                   
-                  if (.not. found) then ! see if we have are very close to the end of an element (numerical roundoff?)
-                     if ( elem_position_SiKi < 0.0_SiKi ) then
-                        if ( -elem_position_SiKi < closest_elem_diff ) then
-                           closest_elem_diff = -elem_position_SiKi
-                           closest_elem = jElem
-                           closest_elem_position = 0.0_ReKi
-                           closest_elem_distance    = sqrt(denom) * closest_elem_diff ! distance from end of element, in meters
-                        end if
-                     else
-                        if ( elem_position_SiKi-1.0_SiKi < closest_elem_diff ) then
-                           closest_elem_diff = elem_position_SiKi-1.0_SiKi
-                           closest_elem = jElem
-                           closest_elem_position = 1.0_ReKi
-                           closest_elem_distance    = sqrt(denom) * closest_elem_diff ! distance from end of element, in meters
+                     if (.not. found) then ! see if we have are very close to the end of an element (numerical roundoff?)
+                        if ( elem_position_SiKi < 0.0_SiKi ) then
+                           if ( -elem_position_SiKi < closest_elem_diff ) then
+                              closest_elem_diff = -elem_position_SiKi
+                              closest_elem = jElem
+                              closest_elem_position = 0.0_ReKi
+                              closest_elem_distance    = sqrt(denom) * closest_elem_diff ! distance from end of element, in meters
+                           end if
+                        else
+                           if ( elem_position_SiKi-1.0_SiKi < closest_elem_diff ) then
+                              closest_elem_diff = elem_position_SiKi-1.0_SiKi
+                              closest_elem = jElem
+                              closest_elem_position = 1.0_ReKi
+                              closest_elem_distance    = sqrt(denom) * closest_elem_diff ! distance from end of element, in meters
+                           end if
                         end if
                      end if
-                  end if
                   
+                  end if
                end if
-            end if
 
-            if (on_element) then
+               if (on_element) then
 
-               ! calculate distance between point and line (note: this is actually the distance squared);
-               ! will only store information once we have determined the closest element
-               tmp  = cross_product( n1_n2_vector, n1_Point_vector )
-               dist = DOT_PRODUCT(tmp,tmp) / denom
+                  ! calculate distance between point and line (note: this is actually the distance squared);
+                  ! will only store information once we have determined the closest element
+                  tmp  = cross_product( n1_n2_vector, n1_Point_vector )
+                  dist = DOT_PRODUCT(tmp,tmp) / denom
 
-               if (dist .lt. min_dist) then
-                  found = .true.
-                  min_dist = dist
+                  if (dist .lt. min_dist) then
+                     found = .true.
+                     min_dist = dist
 
-                  NodeMap(i)%OtherMesh_Element = jElem
-                  NodeMap(i)%shape_fn(1)       = 1.0_ReKi - elem_position
-                  NodeMap(i)%shape_fn(2)       = elem_position
+                     NodeMap(i)%OtherMesh_Element = jElem
+                     NodeMap(i)%shape_fn(1)       = 1.0_ReKi - elem_position
+                     NodeMap(i)%shape_fn(2)       = elem_position
 
-                  !NodeMap(i)%couple_arm        = n1_Point_vector
+                     !NodeMap(i)%couple_arm        = n1_Point_vector
 
-               end if !the point is closest to this line2 element
+                  end if !the point is closest to this line2 element
 
-            endif
+               endif
 
-         end do !jElem
+            end do !k (jElem)
+         
+            if (found) then
+               if ( min_dist <= search_radius**2 ) exit
+            end if
+            if (nCandidates >= nElem2) exit
+            search_radius = 2.0_ReKi*search_radius
+         
+         end do ! search_radius
 
             ! if failed to find an element that the Point projected into, throw an error
          if (.not. found) then
@@ -1988,6 +2051,8 @@ SUBROUTINE CreateMapping_ProjectToLine2(Mesh1, Mesh2, NodeMap, Mesh1_TYPE, ErrSt
 
       end do !iNode
    end do !iElem
+   
+   call kdtree_destroy(ElemTree)
 
 END SUBROUTINE CreateMapping_ProjectToLine2
 !----------------------------------------------------------------------------------------------------------------------------------
@@ -2545,6 +2610,14 @@ SUBROUTINE CreateMapping_NearestNeighbor( Mesh1, Mesh2, NodeMap, Mesh1_TYPE, Mes
    INTEGER(IntKi)  :: jElem, jNode, j  ! do-loop counter for elements on Mesh2, associated node
 
    LOGICAL         :: UseMesh2Node(Mesh2%NNodes) ! determines if the node on the second mesh is part of the mapping (i.e., contained in an element of the appropriate type)
+   
+   TYPE(KdTreeType)             :: NodeTree           ! k-d tree of the Mesh2 nodes that are part of the mapping
+   REAL(ReKi),     ALLOCATABLE  :: NodePos(:,:)       ! positions of the Mesh2 nodes that are part of the mapping
+   INTEGER(IntKi), ALLOCATABLE  :: NodeIndx(:)        ! Mesh2 node number of each point in NodePos (ascending order)
+   INTEGER,        ALLOCATABLE  :: NodeList(:)        ! candidate points (indices into NodePos) for the current node
+   INTEGER                      :: nCandidates        ! number of candidate points in NodeList
+   INTEGER(IntKi)               :: nUsed              ! number of Mesh2 nodes that are part of the mapping
+   INTEGER(IntKi)               :: k                  ! do-loop counter for candidate points
      
    
       ! initialization
@@ -2564,6 +2637,18 @@ SUBROUTINE CreateMapping_NearestNeighbor( Mesh1, Mesh2, NodeMap, Mesh1_TYPE, Mes
       NodeMap(i)%OtherMesh_Element = NODE_NOT_MAPPED ! initialize this so we know if we've mapped this node already (done only because we may have different elements)
    end do !n1
    
+   ! Build a k-d tree of the Mesh2 nodes in the mapping so we don't have to check every node for each node on Mesh1
+   nUsed = COUNT(UseMesh2Node)
+   ALLOCATE( NodePos(3, max(1,nUsed)), NodeIndx(max(1,nUsed)), NodeList(max(1,nUsed)) )
+   k = 0
+   do j = 1, Mesh2%NNodes
+      IF ( .NOT. UseMesh2Node(j) ) CYCLE
+      k = k + 1
+      NodePos(:,k) = Mesh2%Position(:, j)
+      NodeIndx(k)  = j
+   end do
+   if (nUsed > 0) call kdtree_build(NodeTree, NodePos(:,1:nUsed))
+   
 
    do iElem = 1, Mesh1%ElemTable(Mesh1_TYPE)%nelem   ! number of Mesh1_TYPE elements on Mesh1 = number of points on Mesh1
       do iNode = 1, SIZE( Mesh1%ElemTable(Mesh1_TYPE)%Elements(iElem)%ElemNodes )
@@ -2578,9 +2663,20 @@ SUBROUTINE CreateMapping_NearestNeighbor( Mesh1, Mesh2, NodeMap, Mesh1_TYPE, Mes
          point_with_min_dist = 0
 
          Mesh1_xyz = Mesh1%Position(:, i)
+         
+         ! The nearest point in the tree gives the minimum distance; check all points at (about) that distance in increasing
+         ! node order so that ties are resolved the same way as a search through every node on Mesh2
+         if (nUsed > 0) then
+            k = kdtree_nearest_neighbor(NodeTree, Mesh1_xyz)
+            dist = TwoNorm( NodePos(:,k) - Mesh1_xyz )
+            call kdtree_points_in_radius(NodeTree, Mesh1_xyz, dist*1.001_ReKi + EPSILON(dist), NodeList, nCandidates)
+            call kdtree_sort_indices(NodeList(1:nCandidates))
+         else
+            nCandidates = 0
+         end if
 
-         do j = 1, Mesh2%NNodes
-            IF ( .NOT. UseMesh2Node(j) ) CYCLE !This node isn't part of the elements we're mapping
+         do k = 1, nCandidates
+            j = NodeIndx( NodeList(k) )
 
             ! destination point
             Mesh2_xyz = Mesh2%Position(:, j)
@@ -2600,7 +2696,7 @@ SUBROUTINE CreateMapping_NearestNeighbor( Mesh1, Mesh2, NodeMap, Mesh1_TYPE, Mes
 
             endif
 
-         end do !j
+         end do !k (j)
 
          if (point_with_min_dist .lt. 1 )  then
             CALL SetErrStat( ErrID_Fatal, 'Failed to find destination point associated with source point.', ErrStat, ErrMsg, 'CreateMapping_NearestNeighbor')
@@ -2616,7 +2712,8 @@ SUBROUTINE CreateMapping_NearestNeighbor( Mesh1, Mesh2, NodeMap, Mesh1_TYPE, Mes
 
       end do !iNode
    end do !iElem
-
+   
+   call kdtree_destroy(NodeTree)
 
 END SUBROUTINE CreateMapping_NearestNeighbor
 !----------------------------------------------------------------------------------------------------------------------------------
@@ -3963,8 +4060,6 @@ SUBROUTINE Linearize_Loads_Point_to_Line2( Src, Dest, MeshMap, ErrStat, ErrMsg,
       end if
    
    !> Finally, we multiply the matrices together and return the non-zero block matrices that remain.
-   
-      n=Dest%Nnodes*3
       
    !> > Matrix \f$ M_{li} = \begin{bmatrix} M_{li}^{DL} \end{bmatrix}^{-1} M_{li}^{D} \f$, stored in modmesh_mapping::meshmaplinearizationtype::li,
    !! > is allocated to be size Dest\%NNodes*3, Src\%NNodes*3.
@@ -3974,7 +4069,7 @@ SUBROUTINE Linearize_Loads_Point_to_Line2( Src, Dest, MeshMap, ErrStat, ErrMsg,
    ! solve this before M_{fm} so that we can use M_{li} in the equation for M_{fm}
 
       ! solve for M_{li}:
-   CALL LAPACK_getrs(TRANS='N',N=n,A=MeshMap%LoadLn2_A_Mat,IPIV=MeshMap%LoadLn2_A_Mat_piv, B=li_D, ErrStat=ErrStat2, ErrMsg=ErrMsg2)
+   CALL Solve_InverseLumping( Dest%Nnodes, MeshMap, li_D, ErrStat2, ErrMsg2 )
       CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
       if (ErrStat >= AbortErrLev) return      
                  
@@ -3989,7 +4084,7 @@ SUBROUTINE Linearize_Loads_Point_to_Line2( Src, Dest, MeshMap, ErrStat, ErrMsg,
       !! > \n Note that we solve the equation \f$ M_{li}^{DL} M_{uSm} = M_{uSm}^{DL} \f$ for \f$ M_{uSm} \f$.
 
          ! solve for M_{uSm}      
-      CALL LAPACK_getrs(TRANS='N',N=n,A=MeshMap%LoadLn2_A_Mat,IPIV=MeshMap%LoadLn2_A_Mat_piv, B=muS_D, ErrStat=ErrStat2, ErrMsg=ErrMsg2)
+      CALL Solve_InverseLumping( Dest%Nnodes, MeshMap, muS_D, ErrStat2, ErrMsg2 )
          CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
          if (ErrStat >= AbortErrLev) return      
          
@@ -4004,7 +4099,7 @@ SUBROUTINE Linearize_Loads_Point_to_Line2( Src, Dest, MeshMap, ErrStat, ErrMsg,
       muD_D = muD_D - MeshMap%dM%m_uD     
 
          ! solve for M_{uDm}      
-      CALL LAPACK_getrs(TRANS='N',N=n,A=MeshMap%LoadLn2_A_Mat,IPIV=MeshMap%LoadLn2_A_Mat_piv, B=muD_D, ErrStat=ErrStat2, ErrMsg=ErrMsg2)
+      CALL Solve_InverseLumping( Dest%Nnodes, MeshMap, muD_D, ErrStat2, ErrMsg2 )
          CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
          if (ErrStat >= AbortErrLev) return      
          
@@ -4022,7 +4117,7 @@ SUBROUTINE Linearize_Loads_Point_to_Line2( Src, Dest, MeshMap, ErrStat, ErrMsg,
       mf_D = mf_D - matmul( MeshMap%dM%m_f, MeshMap%dM%li )
       
          ! solve for M_{fm}      
-      CALL LAPACK_getrs(TRANS='N',N=n,A=MeshMap%LoadLn2_A_Mat,IPIV=MeshMap%LoadLn2_A_Mat_piv, B=mf_D, ErrStat=ErrStat2, ErrMsg=ErrMsg2)
+      CALL Solve_InverseLumping( Dest%Nnodes, MeshMap, mf_D, ErrStat2, ErrMsg2 )
          CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
          if (ErrStat >= AbortErrLev) return      
                   
@@ -4054,7 +4149,7 @@ SUBROUTINE Convert_Point_To_Line2_Loads(Dest, MeshMap, ErrStat, ErrMsg, DestDisp
    INTEGER(IntKi),                 INTENT(  OUT)  :: ErrStat                        !< Error status of the operation
    CHARACTER(*),                   INTENT(  OUT)  :: ErrMsg                         !< Error message if ErrStat /= ErrID_None
 
-   INTEGER(IntKi) :: jElem, n, i,j, n1, n2
+   INTEGER(IntKi) :: jElem, n, n1, n2
    REAL(ReKi)     :: a_vec(3), sum_f(3), crossProd(3)
    REAL(ReKi)     :: c
    
@@ -4063,16 +4158,17 @@ SUBROUTINE Convert_Point_To_Line2_Loads(Dest, MeshMap, ErrStat, ErrMsg, DestDisp
    character(*), parameter                        :: RoutineName = 'Convert_Point_To_Line2_Loads'
    
    
-   n=3*Dest%Nnodes !also SIZE(MeshMap%LoadLn2_F,1) and SIZE(MeshMap%LoadLn2_M,1)
+   n=Dest%Nnodes !also SIZE(MeshMap%LoadLn2_F,1) and SIZE(MeshMap%LoadLn2_M,1)
    ErrStat = ErrID_None
    ErrMsg  = ""
    
    
-      ! Convert the forces on each element
+      ! Convert the forces on each element 
+      ! (the lumping matrix is the same for each of the 3 components, so we solve for all three as separate right-hand sides)
    
    IF ( Dest%FieldMask(MASKID_Force) ) then  
       
-      MeshMap%LoadLn2_F = RESHAPE( Dest%Force, (/ n, 1 /) )
+      MeshMap%LoadLn2_F = TRANSPOSE( Dest%Force )
       
       ! After following call, LoadLn2_F contains the distributed forces:
       
@@ -4081,7 +4177,7 @@ SUBROUTINE Convert_Point_To_Line2_Loads(Dest, MeshMap, ErrStat, ErrMsg, DestDisp
       
       ! Transfer forces to the mesh fields
    
-      Dest%Force =  RESHAPE( MeshMap%LoadLn2_F, (/ 3, Dest%Nnodes /) )
+      Dest%Force =  TRANSPOSE( MeshMap%LoadLn2_F )
       
       CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
       IF (ErrStat >= AbortErrLev) RETURN      
@@ -4093,7 +4189,7 @@ SUBROUTINE Convert_Point_To_Line2_Loads(Dest, MeshMap, ErrStat, ErrMsg, DestDisp
       
    IF ( Dest%FieldMask(MASKID_Moment) ) then  
       
-      MeshMap%LoadLn2_M = RESHAPE( Dest%Moment, (/ n, 1 /) )       
+      MeshMap%LoadLn2_M = TRANSPOSE( Dest%Moment )
       
       IF ( Dest%FieldMask(MASKID_Force) ) then
                                                                
@@ -4112,11 +4208,8 @@ SUBROUTINE Convert_Point_To_Line2_Loads(Dest, MeshMap, ErrStat, ErrMsg, DestDisp
             crossProd = c * cross_product( a_vec, sum_f)
                                  
             ! subtract the force (using the distributed values) from the lumped moment terms:
-            i = (n1-1)*3+1;  j = i+2
-            MeshMap%LoadLn2_M(i:j,1)=MeshMap%LoadLn2_M(i:j,1) - crossProd
-            
-            i = (n2-1)*3+1;  j = i+2            
-            MeshMap%LoadLn2_M(i:j,1)=MeshMap%LoadLn2_M(i:j,1) + crossProd
+            MeshMap%LoadLn2_M(n1,:)=MeshMap%LoadLn2_M(n1,:) - crossProd
+            MeshMap%LoadLn2_M(n2,:)=MeshMap%LoadLn2_M(n2,:) + crossProd
          END DO        
                            
       END IF ! moment due to force
@@ -4128,7 +4221,7 @@ SUBROUTINE Convert_Point_To_Line2_Loads(Dest, MeshMap, ErrStat, ErrMsg, DestDisp
             
       ! Transfer moments to the mesh fields
    
-      Dest%Moment =  RESHAPE( MeshMap%LoadLn2_M, (/ 3, Dest%Nnodes /) )
+      Dest%Moment =  TRANSPOSE( MeshMap%LoadLn2_M )
 
       
       CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
@@ -4833,7 +4926,7 @@ SUBROUTINE Create_InverseLumping_Matrix( Dest, MeshMap, ErrStat, ErrMsg )
    REAL(ReKi)                              :: c, TwoC
 
    INTEGER(IntKi)                          :: N, n1, n2  ! node numbers
-   INTEGER(IntKi)                          :: j,k, iElem, iComp
+   INTEGER(IntKi)                          :: iElem
    INTEGER(IntKi)                          :: ErrStat2
    CHARACTER(ErrMsgLen)                    :: ErrMsg2
    CHARACTER(*), PARAMETER                 :: RoutineName = 'Create_InverseLumping_Matrix'
@@ -4842,10 +4935,12 @@ SUBROUTINE Create_InverseLumping_Matrix( Dest, MeshMap, ErrStat, ErrMsg )
    ErrStat = ErrID_None
    ErrMsg = ""
 
-   n = Dest%Nnodes* 3
+      ! The lumping matrix is identical for each of the 3 vector components, so we store (and factor) only 
+      ! the NNodes-by-NNodes matrix instead of the block matrix of size 3*NNodes:
+   n = Dest%Nnodes
 
    IF ( ALLOCATED(MeshMap%LoadLn2_A_Mat) ) THEN
-      IF ( SIZE(MeshMap%LoadLn2_A_Mat,1) < n ) THEN
+      IF ( SIZE(MeshMap%LoadLn2_A_Mat,1) /= n ) THEN
          DEALLOCATE(MeshMap%LoadLn2_A_Mat)
          DEALLOCATE(MeshMap%LoadLn2_A_Mat_piv)
          DEALLOCATE(MeshMap%LoadLn2_F)
@@ -4872,15 +4967,10 @@ SUBROUTINE Create_InverseLumping_Matrix( Dest, MeshMap, ErrStat, ErrMsg )
       c    = Dest%ElemTable(ELEMENT_LINE2)%Elements(iElem)%det_jac / 3.0_ReKi  != TwoNorm( p(n2)-p(n1) )/6
       TwoC = 2.0_ReKi * c
 
-      do iComp=1,3 !3 components of force
-         j = (n1-1)*3 + iComp      ! this is the index of the node/component of the lumped value
-         k = (n2-1)*3 + iComp      ! the is the portion of the "lesser" node
-         
-         MeshMap%LoadLn2_A_Mat(j,j) = MeshMap%LoadLn2_A_Mat(j,j) + TwoC
-         MeshMap%LoadLn2_A_Mat(k,k) = MeshMap%LoadLn2_A_Mat(k,k) + TwoC
-         MeshMap%LoadLn2_A_Mat(j,k) = MeshMap%LoadLn2_A_Mat(j,k) + c
-         MeshMap%LoadLn2_A_Mat(k,j) = MeshMap%LoadLn2_A_Mat(k,j) + c
-      enddo !icomp
+      MeshMap%LoadLn2_A_Mat(n1,n1) = MeshMap%LoadLn2_A_Mat(n1,n1) + TwoC
+      MeshMap%LoadLn2_A_Mat(n2,n2) = MeshMap%LoadLn2_A_Mat(n2,n2) + TwoC
+      MeshMap%LoadLn2_A_Mat(n1,n2) = MeshMap%LoadLn2_A_Mat(n1,n2) + c
+      MeshMap%LoadLn2_A_Mat(n2,n1) = MeshMap%LoadLn2_A_Mat(n2,n1) + c
    enddo !i
       
    CALL LAPACK_getrf(n,n,MeshMap%LoadLn2_A_Mat,MeshMap%LoadLn2_A_Mat_piv, ErrStat, ErrMsg)      
@@ -4895,16 +4985,57 @@ CONTAINS
          CALL AllocAry( MeshMap%LoadLn2_A_Mat_piv, n,     'MeshMap%LoadLn2_A_Mat_piv',ErrStat2, ErrMsg2)
             CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
             
-         CALL AllocAry( MeshMap%LoadLn2_F,         n, 1,  'MeshMap%LoadLn2_F',        ErrStat2, ErrMsg2)
+         CALL AllocAry( MeshMap%LoadLn2_F,         n, 3,  'MeshMap%LoadLn2_F',        ErrStat2, ErrMsg2)
             CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
             
-         CALL AllocAry( MeshMap%LoadLn2_M,         n, 1,  'MeshMap%LoadLn2_M',        ErrStat2, ErrMsg2)
+         CALL AllocAry( MeshMap%LoadLn2_M,         n, 3,  'MeshMap%LoadLn2_M',        ErrStat2, ErrMsg2)
             CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
 
    END SUBROUTINE AllocInvLumpingArrays
    
 END SUBROUTINE Create_InverseLumping_Matrix
 !----------------------------------------------------------------------------------------------------------------------------------
+!> This routine solves \f$ A X = B \f$, where \f$ A \f$ is the (3*NNodes)-by-(3*NNodes) lumping matrix whose entries are ordered 
+!! by node and then component (as in the linearization matrices). Because \f$ A \f$ is the NNodes-by-NNodes matrix factored in
+!! Create_InverseLumping_Matrix applied independently to each component, we gather the components into separate right-hand sides,
+!! solve with the smaller factored matrix, and scatter the result back into B.
+SUBROUTINE Solve_InverseLumping( NNodes, MeshMap, B, ErrStat, ErrMsg )
+   INTEGER(IntKi),         INTENT(IN   ) ::  NNodes      !< number of nodes on the destination (line2) mesh
+   TYPE(MeshMapType),      INTENT(IN   ) ::  MeshMap     !< mesh mapping data (containing the factored lumping matrix)
+   REAL(R8Ki),             INTENT(INOUT) ::  B(:,:)      !< on entry, the (3*NNodes)-by-m right-hand side; on exit, the solution
+
+   INTEGER(IntKi),         INTENT(  OUT) ::  ErrStat     !< Error status of the operation
+   CHARACTER(*),           INTENT(  OUT) ::  ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+   ! local variables
+   REAL(R8Ki), ALLOCATABLE                 :: Tmp(:,:)
+   INTEGER(IntKi)                          :: m, iComp
+   INTEGER(IntKi)                          :: ErrStat2
+   CHARACTER(ErrMsgLen)                    :: ErrMsg2
+   CHARACTER(*), PARAMETER                 :: RoutineName = 'Solve_InverseLumping'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   m = SIZE(B,2)
+   CALL AllocAry( Tmp, NNodes, 3*m, 'Tmp', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      IF (ErrStat >= AbortErrLev) RETURN
+
+   do iComp=1,3
+      Tmp( :, (iComp-1)*m+1 : iComp*m ) = B( iComp:3*NNodes:3, : )
+   end do
+
+   CALL LAPACK_getrs(TRANS='N',N=NNodes,A=MeshMap%LoadLn2_A_Mat,IPIV=MeshMap%LoadLn2_A_Mat_piv, B=Tmp, ErrStat=ErrStat2, ErrMsg=ErrMsg2)
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      IF (ErrStat >= AbortErrLev) RETURN
+
+   do iComp=1,3
+      B( iComp:3*NNodes:3, : ) = Tmp( :, (iComp-1)*m+1 : iComp*m )
+   end do
+
+END SUBROUTINE Solve_InverseLumping
+!----------------------------------------------------------------------------------------------------------------------------------
 !> This subroutine creates the mapping from a line2 mesh with loads to another line2 mesh.
 SUBROUTINE CreateLoadMap_L2_to_L2( Src, Dest, MeshMap, ErrStat, ErrMsg )
 
@@ -54,6 +54,11 @@ MODULE NWTC_IO
    INTEGER(B2Ki), PARAMETER      :: FileFmtID_WithoutTime = 2                    !< ID for FAST Output File Format, specifies that the time channel is not included in the output file (used only with constant time-step output)
    INTEGER(B2Ki), PARAMETER      :: FileFmtID_NoCompressWithoutTime = 3          !< ID for FAST Output File Format, specifies that the time channel is not included in the output file (used only with constant time-step output), and data is not compressed, but written as double-precision floats
    INTEGER(B2Ki), PARAMETER      :: FileFmtID_ChanLen_In  = 4                    !< ID for FAST Output File Format, specifies that the time channel is not included in the output file, and channel length is included in the file
+   INTEGER(B2Ki), PARAMETER      :: FileFmtID_Columnar    = 5                    !< ID for FAST Output File Format, specifies that the time channel is not included in the output file, and each channel is stored (losslessly compressed) in a contiguous block that is located with an index in the header
+
+   INTEGER(B2Ki), PARAMETER      :: BinColEnc_Const       = 0                    !< Encoding of a channel block in a FileFmtID_Columnar file: constant channel, stored as a single double-precision float
+   INTEGER(B2Ki), PARAMETER      :: BinColEnc_R4          = 1                    !< Encoding of a channel block in a FileFmtID_Columnar file: all values are exactly representable as (and stored as) single-precision floats
+   INTEGER(B2Ki), PARAMETER      :: BinColEnc_R8          = 2                    !< Encoding of a channel block in a FileFmtID_Columnar file: values stored as double-precision floats
 
 
    LOGICAL                       :: Beep     = .TRUE.                            !< Flag that specifies whether or not to beep for error messages and program terminations.
@@ -4959,6 +4964,10 @@ END SUBROUTINE CheckR8Var
    INTEGER(B2Ki)                          :: Tmp2BInt                ! This scalar temporarially holds a 2-byte integer that was stored in the binary file.
    INTEGER(B2Ki), ALLOCATABLE             :: TmpInArray(:,:)         ! This array holds the normalized channels that were read from the binary file.
    INTEGER(R8Ki), ALLOCATABLE             :: TmpR8InArray(:,:)       ! This array holds the uncompressed channels that were read from the binary file.
+   REAL(R8Ki),    ALLOCATABLE             :: TmpR8Col(:)             ! This array holds one channel block that was read from a columnar binary file.
+   REAL(SiKi),    ALLOCATABLE             :: TmpR4Col(:)             ! This array holds one single-precision channel block that was read from a columnar binary file.
+   INTEGER(B2Ki), ALLOCATABLE             :: ChanEnc(:)              ! The encoding of each channel block in a columnar binary file.
+   INTEGER(B8Ki), ALLOCATABLE             :: ChanPos(:)              ! The file position of each channel block in a columnar binary file.
 
    INTEGER(B1Ki), ALLOCATABLE             :: DescStrASCII(:)         ! The ASCII equivalent of DescStr.
    INTEGER(B1Ki), ALLOCATABLE             :: TmpStrASCII(:)          ! The temporary ASCII equivalent of a channel name or units.
@@ -5000,7 +5009,7 @@ END SUBROUTINE CheckR8Var
    ENDIF
 
 
-   IF (FileType == FileFmtID_ChanLen_In) THEN
+   IF (FileType == FileFmtID_ChanLen_In .OR. FileType == FileFmtID_Columnar) THEN
       READ (UnIn, IOSTAT=ErrStat2)  Tmp2BInt
       IF ( ErrStat2 /= 0 )  THEN
          CALL SetErrStat ( ErrID_Fatal, 'Fatal error reading ChanLen from file "'//TRIM( FASTdata%File )//'".', ErrStat, ErrMsg, RoutineName )
@@ -5103,6 +5112,14 @@ END SUBROUTINE CheckR8Var
          RETURN
       ENDIF
 
+   ELSEIF ( FileType == FileFmtID_Columnar ) THEN 
+      ALLOCATE ( TmpR8Col( FASTdata%NumRecs ), TmpR4Col( FASTdata%NumRecs ), ChanEnc( FASTdata%NumChans ), ChanPos( FASTdata%NumChans ), STAT=ErrStat2 )
+      IF ( ErrStat2 /= 0 )  THEN
+         CALL SetErrStat ( ErrID_Fatal, 'Fatal error allocating memory for the columnar channel arrays.', ErrStat, ErrMsg, RoutineName )
+         CALL Cleanup()
+         RETURN
+      ENDIF
+
    ELSE
       
       ALLOCATE ( ColMax( FASTdata%NumChans ) , STAT=ErrStat2 )
@@ -5156,7 +5173,7 @@ END SUBROUTINE CheckR8Var
 
       ! Read more of the header information.
 
-   IF ( FileType /= FileFmtID_NoCompressWithoutTime ) THEN 
+   IF ( FileType /= FileFmtID_NoCompressWithoutTime .AND. FileType /= FileFmtID_Columnar ) THEN 
       
       READ (UnIn, IOSTAT=ErrStat2)  ColScl
       IF ( ErrStat2 /= 0 )  THEN
@@ -5279,6 +5296,41 @@ END SUBROUTINE CheckR8Var
 
       ! Read the FAST channel data.
 
+   IF ( FileType == FileFmtID_Columnar ) THEN
+
+         ! The channel index follows the channel units; each channel is stored in a contiguous block.
+      READ (UnIn, IOSTAT=ErrStat2)  ChanEnc, ChanPos
+      IF ( ErrStat2 /= 0 )  THEN
+         CALL SetErrStat ( ErrID_Fatal, 'Fatal error reading the channel index from file "'//TRIM( FASTdata%File )//'".', ErrStat, ErrMsg, RoutineName )
+         CALL Cleanup()
+         RETURN
+      ENDIF
+
+      DO IChan=1,FASTdata%NumChans
+         SELECT CASE ( ChanEnc(IChan) )
+         CASE ( BinColEnc_Const )
+            READ (UnIn, POS=ChanPos(IChan), IOSTAT=ErrStat2)  TmpR8Col(1)
+            TmpR8Col(:) = TmpR8Col(1)
+         CASE ( BinColEnc_R4 )
+            READ (UnIn, POS=ChanPos(IChan), IOSTAT=ErrStat2)  TmpR4Col
+            TmpR8Col(:) = TmpR4Col(:)
+         CASE DEFAULT
+            READ (UnIn, POS=ChanPos(IChan), IOSTAT=ErrStat2)  TmpR8Col
+         END SELECT
+
+         IF ( ErrStat2 /= 0 )  THEN
+            CALL SetErrStat ( ErrID_Fatal, 'Fatal error reading channel data from file "'//TRIM( FASTdata%File )//'".', ErrStat, ErrMsg, RoutineName )
+            CALL Cleanup()
+            RETURN
+         ENDIF
+         FASTdata%Data(:,IChan+1) = REAL(TmpR8Col, ReKi)
+      END DO
+
+      CALL Cleanup( )
+      RETURN
+
+   END IF
+
    DO IRow=1,FASTdata%NumRecs
       IF ( FileType == FileFmtID_NoCompressWithoutTime ) THEN
          READ (UnIn, IOSTAT=ErrStat2)  TmpR8InArray(IRow,:)
@@ -5329,6 +5381,10 @@ END SUBROUTINE CheckR8Var
          IF ( ALLOCATED( TmpInArray         ) ) DEALLOCATE( TmpInArray         )
          IF ( ALLOCATED( TmpR8InArray       ) ) DEALLOCATE( TmpR8InArray         )
          IF ( ALLOCATED( TmpTimeArray       ) ) DEALLOCATE( TmpTimeArray       )
+         IF ( ALLOCATED( TmpR8Col           ) ) DEALLOCATE( TmpR8Col           )
+         IF ( ALLOCATED( TmpR4Col           ) ) DEALLOCATE( TmpR4Col           )
+         IF ( ALLOCATED( ChanEnc            ) ) DEALLOCATE( ChanEnc            )
+         IF ( ALLOCATED( ChanPos            ) ) DEALLOCATE( ChanPos            )
 
 
             ! Close file
@@ -6967,6 +7023,9 @@ end subroutine ReadR8AryWDefault
    INTEGER(B1Ki), ALLOCATABLE    :: ChanUnitASCII(:)                 ! The ASCII equivalent of ChanUnit
 
    INTEGER(IntKi)                :: LenName                          ! Max number of characters in a channel name
+   INTEGER(B2Ki), ALLOCATABLE    :: ChanEnc(:)                       ! Encoding of each channel block (FileFmtID_Columnar only)
+   INTEGER(B8Ki), ALLOCATABLE    :: ChanPos(:)                       ! File position of each channel block (FileFmtID_Columnar only)
+   INTEGER(B8Ki)                 :: IndexPos                         ! File position of the channel index (FileFmtID_Columnar only)
    
    CHARACTER(ErrMsgLen)          :: ErrMsg2                          ! temporary error message
    CHARACTER(*), PARAMETER       :: RoutineName = 'WrBinFAST'
@@ -6999,6 +7058,32 @@ end subroutine ReadR8AryWDefault
          RETURN
       END IF
       
+   !...............................................................................................................................
+   ! The columnar format writes each channel in its own block, followed by the index of the blocks
+   !...............................................................................................................................
+   IF ( FileID == FileFmtID_Columnar ) THEN
+      ALLOCATE( ChanEnc(NumOutChans), ChanPos(NumOutChans), STAT=ErrStat2 )
+         IF ( ErrStat2 /= 0 ) CALL SetErrStat( ErrID_Fatal, 'Error allocating the channel index (ChanEnc, ChanPos).', ErrStat, ErrMsg, RoutineName )
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL Cleanup()
+            RETURN
+         END IF
+
+      CALL BinFAST_WrColumnarHeader( UnIn, DescStr, ChanName, ChanUnit, NT, TimeData(1), TimeData(2), IndexPos, ErrStat2, ErrMsg2 )
+         CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      DO IC=1,NumOutChans
+         IF ( ErrStat >= AbortErrLev ) EXIT
+         CALL BinFAST_WrColumn( UnIn, AllOutData(IC,:), ChanEnc(IC), ChanPos(IC), ErrStat2, ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      END DO
+      IF ( ErrStat < AbortErrLev ) THEN
+         WRITE (UnIn, POS=IndexPos, IOSTAT=ErrStat2)  ChanEnc, ChanPos
+            IF ( ErrStat2 /= 0 ) CALL SetErrStat( ErrID_Fatal, 'Error writing the channel index to the FAST binary file.', ErrStat, ErrMsg, RoutineName )
+      END IF
+
+      CALL Cleanup()
+      RETURN
+   END IF
 
    !...............................................................................................................................
    ! Allocate arrays
@@ -7330,6 +7415,8 @@ end subroutine ReadR8AryWDefault
          IF ( ALLOCATED( DescStrASCII  ) ) DEALLOCATE( DescStrASCII )
          IF ( ALLOCATED( ChanNameASCII ) ) DEALLOCATE( ChanNameASCII )
          IF ( ALLOCATED( ChanUnitASCII ) ) DEALLOCATE( ChanUnitASCII )
+         IF ( ALLOCATED( ChanEnc       ) ) DEALLOCATE( ChanEnc )
+         IF ( ALLOCATED( ChanPos       ) ) DEALLOCATE( ChanPos )
       
             ! Close file:
          CLOSE ( UnIn )
@@ -7337,6 +7424,515 @@ end subroutine ReadR8AryWDefault
       END SUBROUTINE Cleanup
    !...............................................................................................................................
    END SUBROUTINE WrBinFAST
+!=======================================================================
+!> This subroutine appends a chunk of output data to a streamed FAST binary file that was opened with WrBinFAST_Open
+!! (or WrBinFAST_Reopen). The data is written as double-precision floats after the NT time steps already in the file, 
+!! and the header (number of time steps, first output time, and time increment) is updated and flushed to disk, so the
+!! file is a valid FileFmtID_NoCompressWithoutTime file after every call.
+   SUBROUTINE WrBinFAST_Append(Un, TimeData, OutData, NT, ErrStat, ErrMsg)
+
+   INTEGER(IntKi),    INTENT(IN)    :: Un                            !< Unit number of the streamed binary file
+   REAL(DbKi),        INTENT(IN)    :: TimeData(:)                   !< First output time (element 1) and the delta t (element 2)
+   REAL(ReKi),        INTENT(IN)    :: OutData(:,:)                  !< Chunk of output data (except time); channels are the rows and time is the column
+   INTEGER(IntKi),    INTENT(INOUT) :: NT                            !< Number of time steps in the file (updated on exit)
+   INTEGER(IntKi),    INTENT(OUT)   :: ErrStat                       !< Error status
+   CHARACTER(*),      INTENT(OUT)   :: ErrMsg                        !< Error message associated with the ErrStat
+
+   INTEGER(B8Ki)                    :: DataPos                       ! file position of the first byte of the new data
+   INTEGER(IntKi)                   :: ErrStat2                      ! temporary error status
+   CHARACTER(*), PARAMETER          :: RoutineName = 'WrBinFAST_Append'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+
+   CALL BinFAST_StreamDataPos( Un, SIZE(OutData,1), NT, DataPos, ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+
+   WRITE (Un, POS=DataPos, IOSTAT=ErrStat2)  REAL( OutData, R8Ki )
+      IF ( ErrStat2 /= 0 ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Error writing channel data to the FAST binary file.', ErrStat, ErrMsg, RoutineName )
+         RETURN
+      END IF
+
+   NT = NT + SIZE(OutData,2)
+
+   WRITE (Un, POS=7, IOSTAT=ErrStat2)  INT( NT, B4Ki ), REAL( TimeData(1), R8Ki ), REAL( TimeData(2), R8Ki )
+      IF ( ErrStat2 /= 0 ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Error updating the header of the FAST binary file.', ErrStat, ErrMsg, RoutineName )
+         RETURN
+      END IF
+
+   FLUSH ( Un )
+
+   END SUBROUTINE WrBinFAST_Append
+!=======================================================================
+!> This subroutine closes a streamed FAST binary file that was opened with WrBinFAST_Open. If FileID is 
+!! FileFmtID_NoCompressWithoutTime, the streamed file is already in its final form and is simply closed. Otherwise, 
+!! the streamed data are converted to the 16-bit packed format (using the same scaling as WrBinFAST) or to the columnar 
+!! format in FileName, reading the streamed file in chunks so that the whole time history is never held in memory. 
+!! The streamed file is deleted after it has been converted successfully.
+   SUBROUTINE WrBinFAST_Close(Un, FileName, FileID, DescStr, ChanName, ChanUnit, ErrStat, ErrMsg)
+
+   INTEGER(IntKi),    INTENT(INOUT) :: Un                            !< Unit number of the streamed binary file (set to -1 on exit)
+   CHARACTER(*),      INTENT(IN)    :: FileName                      !< Name of the packed file (ignored for FileFmtID_NoCompressWithoutTime)
+   INTEGER(B2Ki),     INTENT(IN)    :: FileID                        !< File ID, used to determine format of output file (use FileFmtID_WithoutTime, FileFmtID_NoCompressWithoutTime, or FileFmtID_ChanLen_In)
+   CHARACTER(*),      INTENT(IN)    :: DescStr                       !< Description to write to the binary file (e.g., program version, date, & time)
+   CHARACTER(ChanLen),INTENT(IN)    :: ChanName(:)                   !< The output channel names (including Time)
+   CHARACTER(ChanLen),INTENT(IN)    :: ChanUnit(:)                   !< The output channel units (including Time)
+   INTEGER(IntKi),    INTENT(OUT)   :: ErrStat                       !< Error status
+   CHARACTER(*),      INTENT(OUT)   :: ErrMsg                        !< Error message associated with the ErrStat
+
+   INTEGER(IntKi), PARAMETER        :: NStepsBuf = 1024              ! Number of time steps read from the streamed file at once
+   INTEGER(IntKi), PARAMETER        :: NColBuf   = 4194304           ! Number of values stored at once when transposing the streamed data to channel blocks
+
+   REAL(SiKi), PARAMETER            :: IntMax   =  32767.0           ! Largest integer represented in 2 bytes
+   REAL(SiKi), PARAMETER            :: IntMin   = -32768.0           ! Smallest integer represented in 2 bytes
+   REAL(SiKi), PARAMETER            :: IntRng   = IntMax - IntMin    ! Max Range of 2 byte integer
+   REAL(SiKi), PARAMETER            :: SqrtEps = SQRT(EPSILON(1.0_SiKi)) ! small number for tolerance
+
+   REAL(R8Ki)                       :: TimeOut1                      ! The first output time
+   REAL(R8Ki)                       :: TimeIncrement                 ! The delta t
+   REAL(R8Ki),    ALLOCATABLE       :: R8Buf(:,:)                    ! Chunk of data read from the streamed file
+   REAL(ReKi),    ALLOCATABLE       :: Buf(:,:)                      ! Chunk of data, converted back to ReKi
+   INTEGER(B2Ki), ALLOCATABLE       :: TmpOutArray(:,:)              ! Chunk of data converted to packed binary
+   REAL(ReKi),    ALLOCATABLE       :: ColMax(:)                     ! Maximum value of the column data
+   REAL(ReKi),    ALLOCATABLE       :: ColMin(:)                     ! Minimum value of the column data
+   REAL(SiKi),    ALLOCATABLE       :: ColOff(:)                     ! Offset for the column data
+   REAL(SiKi),    ALLOCATABLE       :: ColScl(:)                     ! Slope for the column data
+   REAL(ReKi),    ALLOCATABLE       :: ColBuf(:,:)                   ! Time history of a group of channels (FileFmtID_Columnar only)
+   INTEGER(B2Ki), ALLOCATABLE       :: ChanEnc(:)                    ! Encoding of each channel block (FileFmtID_Columnar only)
+   INTEGER(B8Ki), ALLOCATABLE       :: ChanPos(:)                    ! File position of each channel block (FileFmtID_Columnar only)
+   INTEGER(B8Ki)                    :: IndexPos                      ! File position of the channel index (FileFmtID_Columnar only)
+   INTEGER(IntKi)                   :: IC1                           ! First channel of the group of channels being transposed
+   INTEGER(IntKi)                   :: NGroup                        ! Number of channels in a group
+
+   INTEGER(B4Ki)                    :: NumOutChans                   ! Number of output channels
+   INTEGER(B4Ki)                    :: NT                            ! Number of time steps
+   INTEGER(B8Ki)                    :: DataPos                       ! file position of the first byte of data in the streamed file
+   INTEGER(IntKi)                   :: IC                            ! Loop counter for the output channel
+   INTEGER(IntKi)                   :: IT                            ! Loop counter for the timestep
+   INTEGER(IntKi)                   :: NBuf                          ! Number of time steps in the current chunk
+   INTEGER(IntKi)                   :: IPass                         ! pass through the streamed data (1=find range, 2=write packed data)
+   INTEGER(IntKi)                   :: LenName                       ! Max number of characters in a channel name
+   INTEGER(IntKi)                   :: UnOut                         ! Unit number for the packed binary file
+   INTEGER(IntKi)                   :: ErrStat2                      ! temporary error status
+   CHARACTER(ErrMsgLen)             :: ErrMsg2                       ! temporary error message
+   CHARACTER(*), PARAMETER          :: RoutineName = 'WrBinFAST_Close'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   UnOut   = -1
+
+   IF ( FileID == FileFmtID_NoCompressWithoutTime ) THEN
+      CLOSE ( Un )
+      Un = -1
+      RETURN
+   ELSEIF ( FileID == FileFmtID_WithTime ) THEN
+      CALL SetErrStat( ErrID_Fatal, 'Streamed binary output cannot be converted to FileFmtID_WithTime.', ErrStat, ErrMsg, RoutineName )
+      CALL Cleanup()
+      RETURN
+   END IF
+
+   READ (Un, POS=3, IOSTAT=ErrStat2)  NumOutChans, NT, TimeOut1, TimeIncrement
+      IF ( ErrStat2 /= 0 ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Error reading the header of the streamed FAST binary file.', ErrStat, ErrMsg, RoutineName )
+         CALL Cleanup()
+         RETURN
+      END IF
+
+   IF ( NT < 1 ) THEN ! there is nothing to convert
+      CLOSE ( Un, STATUS='DELETE' )
+      Un = -1
+      RETURN
+   END IF
+
+   CALL BinFAST_StreamDataPos( Un, NumOutChans, 0_IntKi, DataPos, ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+
+   NBuf = MIN( NT, NStepsBuf )
+   CALL AllocAry( R8Buf, NumOutChans, NBuf, 'streamed data chunk (R8Buf)', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+
+   IF ( FileID == FileFmtID_Columnar ) THEN
+      CALL WriteColumnar()
+      CALL Cleanup()
+      RETURN
+   END IF
+
+   CALL AllocAry( Buf, NumOutChans, NBuf, 'streamed data chunk (Buf)', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL AllocAry( ColMax, NumOutChans, 'column maxima (ColMax)', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL AllocAry( ColMin, NumOutChans, 'column minima (ColMin)', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL AllocAry( ColOff, NumOutChans, 'column offsets (ColOff)', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   CALL AllocAry( ColScl, NumOutChans, 'column scales (ColScl)', ErrStat2, ErrMsg2 )
+      CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+   ALLOCATE( TmpOutArray(NumOutChans, NBuf), STAT=ErrStat2 )
+      IF ( ErrStat2 /= 0 ) CALL SetErrStat( ErrID_Fatal, 'Error allocating temporary output array (TmpOutArray).', ErrStat, ErrMsg, RoutineName )
+   IF ( ErrStat >= AbortErrLev ) THEN
+      CALL Cleanup()
+      RETURN
+   END IF
+
+   DO IPass = 1,2
+
+      IF ( IPass == 2 ) THEN
+
+         !...........................................................................................................................
+         ! Calculate the scaling parameters for each channel and write the header of the packed file
+         !...........................................................................................................................
+         DO IC=1,NumOutChans
+            IF ( abs(ColMax(IC) - ColMin(IC)) < SqrtEps ) THEN
+               ColScl(IC) = IntRng/SqrtEps
+            ELSE
+               ColScl(IC) = IntRng/REAL( ColMax(IC) - ColMin(IC), SiKi )
+            ENDIF
+            ColOff(IC) = IntMin - ColScl(IC)*REAL( ColMin(IC), SiKi )
+         ENDDO !IC
+
+         IF (FileID==FileFmtID_ChanLen_In) THEN
+            LenName = 1
+            DO IC = 1,NumOutChans+1
+               LenName = MAX(LenName,LEN_TRIM(ChanName(IC)))
+               LenName = MAX(LenName,LEN_TRIM(ChanUnit(IC)))
+            END DO
+         ELSE
+            LenName = 10
+         END IF
+
+         !$OMP critical(fileopenNWTCio_critical)
+         CALL GetNewUnit( UnOut, ErrStat2, ErrMsg2 )
+         CALL OpenBOutFile ( UnOut, TRIM(FileName), ErrStat2, ErrMsg2 )
+         !$OMP end critical(fileopenNWTCio_critical)
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            IF ( ErrStat >= AbortErrLev ) THEN
+               UnOut = -1
+               CALL Cleanup()
+               RETURN
+            END IF
+
+         IF (FileID==FileFmtID_ChanLen_In) THEN
+            WRITE (UnOut, IOSTAT=ErrStat2)  FileID, INT( LenName, B2Ki ), NumOutChans, NT, TimeOut1, TimeIncrement
+         ELSE
+            WRITE (UnOut, IOSTAT=ErrStat2)  FileID, NumOutChans, NT, TimeOut1, TimeIncrement
+         END IF
+         IF ( ErrStat2 == 0 ) WRITE (UnOut, IOSTAT=ErrStat2)  ColScl, ColOff, INT( LEN_TRIM(DescStr), B4Ki ), TRIM(DescStr)
+         IF ( ErrStat2 == 0 ) WRITE (UnOut, IOSTAT=ErrStat2)  ( ChanName(IC)(1:LenName), IC=1,NumOutChans+1 )
+         IF ( ErrStat2 == 0 ) WRITE (UnOut, IOSTAT=ErrStat2)  ( ChanUnit(IC)(1:LenName), IC=1,NumOutChans+1 )
+            IF ( ErrStat2 /= 0 ) THEN
+               CALL SetErrStat( ErrID_Fatal, 'Error writing the header of the FAST binary file.', ErrStat, ErrMsg, RoutineName )
+               CALL Cleanup()
+               RETURN
+            END IF
+
+      END IF
+
+      !..............................................................................................................................
+      ! Read the streamed data in chunks: find the range of each channel (IPass=1) or convert to 16-bit integers and write (IPass=2)
+      !..............................................................................................................................
+      READ (Un, POS=DataPos, IOSTAT=ErrStat2) ! position the file at the start of the data
+      IT = 0
+      DO WHILE ( IT < NT .AND. ErrStat2 == 0 )
+         NBuf = MIN( NT - IT, SIZE(R8Buf,2) )
+         READ (Un, IOSTAT=ErrStat2)  R8Buf(:,1:NBuf)
+         IF ( ErrStat2 /= 0 ) EXIT
+         Buf(:,1:NBuf) = REAL( R8Buf(:,1:NBuf), ReKi )
+
+         IF ( IPass == 1 ) THEN
+            IF ( IT == 0 ) THEN
+               ColMin(:) = Buf(:,1)        ! Initialize the Min values for each channel
+               ColMax(:) = Buf(:,1)        ! Initialize the Max values for each channel
+            END IF
+            DO IC=1,NumOutChans
+               ColMin(IC) = MIN( ColMin(IC), MINVAL( Buf(IC,1:NBuf) ) )
+               ColMax(IC) = MAX( ColMax(IC), MAXVAL( Buf(IC,1:NBuf) ) )
+            ENDDO !IC
+         ELSE
+            DO IC=1,NumOutChans
+               TmpOutArray(IC,1:NBuf) = NINT( Max( Min( REAL( ColScl(IC)*Buf(IC,1:NBuf) + ColOff(IC), SiKi), IntMax ), IntMin) , B2Ki )
+            ENDDO !IC
+            WRITE (UnOut, IOSTAT=ErrStat2)  TmpOutArray(:,1:NBuf)
+            IF ( ErrStat2 /= 0 ) EXIT
+         END IF
+
+         IT = IT + NBuf
+      END DO
+         IF ( ErrStat2 /= 0 ) THEN
+            CALL SetErrStat( ErrID_Fatal, 'Error converting streamed channel data to the FAST binary file.', ErrStat, ErrMsg, RoutineName )
+            CALL Cleanup()
+            RETURN
+         END IF
+
+   END DO !IPass
+
+   CALL Cleanup()
+   RETURN
+
+   CONTAINS
+      !............................................................................................................................
+      SUBROUTINE Cleanup()
+      ! This subroutine deallocates local arrays and closes the files. The streamed file is kept if an error occurred.
+      !............................................................................................................................
+         IF ( ALLOCATED( R8Buf       ) ) DEALLOCATE( R8Buf )
+         IF ( ALLOCATED( Buf         ) ) DEALLOCATE( Buf )
+         IF ( ALLOCATED( TmpOutArray ) ) DEALLOCATE( TmpOutArray )
+         IF ( ALLOCATED( ColMax      ) ) DEALLOCATE( ColMax )
+         IF ( ALLOCATED( ColMin      ) ) DEALLOCATE( ColMin )
+         IF ( ALLOCATED( ColOff      ) ) DEALLOCATE( ColOff )
+         IF ( ALLOCATED( ColScl      ) ) DEALLOCATE( ColScl )
+         IF ( ALLOCATED( ColBuf      ) ) DEALLOCATE( ColBuf )
+         IF ( ALLOCATED( ChanEnc     ) ) DEALLOCATE( ChanEnc )
+         IF ( ALLOCATED( ChanPos     ) ) DEALLOCATE( ChanPos )
+
+         IF ( UnOut > 0 ) CLOSE ( UnOut )
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CLOSE ( Un )
+         ELSE
+            CLOSE ( Un, STATUS='DELETE' )
+         END IF
+         Un = -1
+      END SUBROUTINE Cleanup
+      !............................................................................................................................
+      SUBROUTINE WriteColumnar()
+      ! This subroutine transposes the streamed data to channel blocks, a group of channels at a time, and writes the columnar file.
+      !............................................................................................................................
+         NGroup = MAX( 1, MIN( NumOutChans, NColBuf / NT ) )
+
+         CALL AllocAry( ColBuf, NT, NGroup, 'channel group time history (ColBuf)', ErrStat2, ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+         ALLOCATE( ChanEnc(NumOutChans), ChanPos(NumOutChans), STAT=ErrStat2 )
+            IF ( ErrStat2 /= 0 ) CALL SetErrStat( ErrID_Fatal, 'Error allocating the channel index (ChanEnc, ChanPos).', ErrStat, ErrMsg, RoutineName )
+            IF ( ErrStat >= AbortErrLev ) RETURN
+
+         !$OMP critical(fileopenNWTCio_critical)
+         CALL GetNewUnit( UnOut, ErrStat2, ErrMsg2 )
+         CALL OpenBOutFile ( UnOut, TRIM(FileName), ErrStat2, ErrMsg2 )
+         !$OMP end critical(fileopenNWTCio_critical)
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            IF ( ErrStat >= AbortErrLev ) THEN
+               UnOut = -1
+               RETURN
+            END IF
+
+         CALL BinFAST_WrColumnarHeader( UnOut, DescStr, ChanName, ChanUnit, NT, TimeOut1, TimeIncrement, IndexPos, ErrStat2, ErrMsg2 )
+            CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+            IF ( ErrStat >= AbortErrLev ) RETURN
+
+         DO IC1 = 1, NumOutChans, NGroup
+            NGroup = MIN( SIZE(ColBuf,2), NumOutChans - IC1 + 1 )
+
+            READ (Un, POS=DataPos, IOSTAT=ErrStat2) ! position the file at the start of the data
+            IT = 0
+            DO WHILE ( IT < NT .AND. ErrStat2 == 0 )
+               NBuf = MIN( NT - IT, SIZE(R8Buf,2) )
+               READ (Un, IOSTAT=ErrStat2)  R8Buf(:,1:NBuf)
+               IF ( ErrStat2 /= 0 ) EXIT
+               ColBuf(IT+1:IT+NBuf,1:NGroup) = TRANSPOSE( REAL( R8Buf(IC1:IC1+NGroup-1,1:NBuf), ReKi ) )
+               IT = IT + NBuf
+            END DO
+               IF ( ErrStat2 /= 0 ) THEN
+                  CALL SetErrStat( ErrID_Fatal, 'Error reading streamed channel data.', ErrStat, ErrMsg, RoutineName )
+                  RETURN
+               END IF
+
+            DO IC = 1, NGroup
+               CALL BinFAST_WrColumn( UnOut, ColBuf(:,IC), ChanEnc(IC1+IC-1), ChanPos(IC1+IC-1), ErrStat2, ErrMsg2 )
+                  CALL SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+                  IF ( ErrStat >= AbortErrLev ) RETURN
+            END DO
+         END DO
+
+         WRITE (UnOut, POS=IndexPos, IOSTAT=ErrStat2)  ChanEnc, ChanPos
+            IF ( ErrStat2 /= 0 ) CALL SetErrStat( ErrID_Fatal, 'Error writing the channel index to the FAST binary file.', ErrStat, ErrMsg, RoutineName )
+
+      END SUBROUTINE WriteColumnar
+   END SUBROUTINE WrBinFAST_Close
+!=======================================================================
+!> This subroutine opens a FAST binary file for streamed output and writes its header. Data are added to the file with
+!! WrBinFAST_Append and the file is finished with WrBinFAST_Close. The streamed file is always written in the
+!! FileFmtID_NoCompressWithoutTime format, with the number of time steps updated after each call to WrBinFAST_Append, 
+!! so results written before a crash can still be read.
+   SUBROUTINE WrBinFAST_Open(FileName, DescStr, ChanName, ChanUnit, TimeData, Un, ErrStat, ErrMsg)
+
+   CHARACTER(*),      INTENT(IN)  :: FileName                        !< Name of the streamed binary file
+   CHARACTER(*),      INTENT(IN)  :: DescStr                         !< Description to write to the binary file (e.g., program version, date, & time)
+   CHARACTER(ChanLen),INTENT(IN)  :: ChanName(:)                     !< The output channel names (including Time)
+   CHARACTER(ChanLen),INTENT(IN)  :: ChanUnit(:)                     !< The output channel units (including Time)
+   REAL(DbKi),        INTENT(IN)  :: TimeData(:)                     !< First output time (element 1) and the delta t (element 2)
+   INTEGER(IntKi),    INTENT(OUT) :: Un                              !< Unit number of the streamed binary file
+   INTEGER(IntKi),    INTENT(OUT) :: ErrStat                         !< Error status
+   CHARACTER(*),      INTENT(OUT) :: ErrMsg                          !< Error message associated with the ErrStat
+
+   INTEGER(IntKi)                 :: IC                              ! Loop counter for the output channel
+   INTEGER(IntKi)                 :: ErrStat2                        ! temporary error status
+   CHARACTER(*), PARAMETER        :: RoutineName = 'WrBinFAST_Open'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+
+   Un = -1
+   !$OMP critical(fileopenNWTCio_critical)
+   CALL GetNewUnit( Un, ErrStat, ErrMsg )
+   OPEN( Un, FILE=TRIM( FileName ), STATUS='REPLACE', FORM='UNFORMATTED', ACCESS='STREAM', IOSTAT=ErrStat2, ACTION='READWRITE' )
+   !$OMP end critical(fileopenNWTCio_critical)
+      IF ( ErrStat2 /= 0 ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Cannot open file "'//TRIM( FileName )//'". Another program may have locked it for writing.' &
+                          //' (IOSTAT is '//TRIM(Num2LStr(ErrStat2))//')', ErrStat, ErrMsg, RoutineName )
+         Un = -1
+         RETURN
+      END IF
+
+   WRITE (Un, IOSTAT=ErrStat2)  FileFmtID_NoCompressWithoutTime, INT( SIZE(ChanName)-1, B4Ki ), 0_B4Ki, &
+                                REAL( TimeData(1), R8Ki ), REAL( TimeData(2), R8Ki ), INT( LEN_TRIM(DescStr), B4Ki ), TRIM(DescStr)
+   IF ( ErrStat2 == 0 ) WRITE (Un, IOSTAT=ErrStat2)  ( ChanName(IC)(1:10), IC=1,SIZE(ChanName) )
+   IF ( ErrStat2 == 0 ) WRITE (Un, IOSTAT=ErrStat2)  ( ChanUnit(IC)(1:10), IC=1,SIZE(ChanUnit) )
+      IF ( ErrStat2 /= 0 ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Error writing the header of the FAST binary file.', ErrStat, ErrMsg, RoutineName )
+         CLOSE ( Un )
+         Un = -1
+         RETURN
+      END IF
+
+   FLUSH ( Un )
+
+   END SUBROUTINE WrBinFAST_Open
+!=======================================================================
+!> This subroutine reopens a streamed FAST binary file (e.g., when restarting from a checkpoint file) so that 
+!! WrBinFAST_Append can continue writing to it.
+   SUBROUTINE WrBinFAST_Reopen(FileName, Un, ErrStat, ErrMsg)
+
+   CHARACTER(*),      INTENT(IN)  :: FileName                        !< Name of the streamed binary file
+   INTEGER(IntKi),    INTENT(OUT) :: Un                              !< Unit number of the streamed binary file
+   INTEGER(IntKi),    INTENT(OUT) :: ErrStat                         !< Error status
+   CHARACTER(*),      INTENT(OUT) :: ErrMsg                          !< Error message associated with the ErrStat
+
+   INTEGER(IntKi)                 :: ErrStat2                        ! temporary error status
+
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+
+   Un = -1
+   !$OMP critical(fileopenNWTCio_critical)
+   CALL GetNewUnit( Un, ErrStat, ErrMsg )
+   OPEN( Un, FILE=TRIM( FileName ), STATUS='OLD', FORM='UNFORMATTED', ACCESS='STREAM', IOSTAT=ErrStat2, ACTION='READWRITE' )
+   !$OMP end critical(fileopenNWTCio_critical)
+      IF ( ErrStat2 /= 0 ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Cannot reopen streamed binary output file "'//TRIM( FileName )//'".' &
+                          //' (IOSTAT is '//TRIM(Num2LStr(ErrStat2))//')', ErrStat, ErrMsg, 'WrBinFAST_Reopen' )
+         Un = -1
+      END IF
+
+   END SUBROUTINE WrBinFAST_Reopen
+!=======================================================================
+!> This subroutine returns the file position of time step NT+1 in a streamed (FileFmtID_NoCompressWithoutTime) FAST
+!! binary file. The length of the description string is read from the file header.
+   SUBROUTINE BinFAST_StreamDataPos(Un, NumOutChans, NT, DataPos, ErrStat, ErrMsg)
+
+   INTEGER(IntKi),    INTENT(IN)  :: Un                              !< Unit number of the streamed binary file
+   INTEGER(IntKi),    INTENT(IN)  :: NumOutChans                     !< Number of output channels (not including time)
+   INTEGER(IntKi),    INTENT(IN)  :: NT                              !< Number of time steps preceding the requested position
+   INTEGER(B8Ki),     INTENT(OUT) :: DataPos                         !< File position
+   INTEGER(IntKi),    INTENT(OUT) :: ErrStat                         !< Error status
+   CHARACTER(*),      INTENT(OUT) :: ErrMsg                          !< Error message associated with the ErrStat
+
+   INTEGER(B4Ki)                  :: LenDesc                         ! Length of the description string
+   INTEGER(IntKi)                 :: ErrStat2                        ! temporary error status
+
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+
+      ! header: FileID (2 bytes), NumOutChans (4), NT (4), TimeOut1 (8), TimeIncrement (8), LenDesc (4), DescStr, and 10-character channel names and units
+   READ (Un, POS=27, IOSTAT=ErrStat2)  LenDesc
+      IF ( ErrStat2 /= 0 ) THEN
+         CALL SetErrStat( ErrID_Fatal, 'Error reading the header of the streamed FAST binary file.', ErrStat, ErrMsg, 'BinFAST_StreamDataPos' )
+         DataPos = 0
+         RETURN
+      END IF
+
+   DataPos = 31_B8Ki + LenDesc + 20_B8Ki*(NumOutChans+1) + 8_B8Ki*NumOutChans*NT
+
+   END SUBROUTINE BinFAST_StreamDataPos
+!=======================================================================
+!> This subroutine writes the header of a FileFmtID_Columnar FAST binary file, followed by space for the channel index
+!! (the encoding and file position of each channel block), which is written after the channel blocks. 
+   SUBROUTINE BinFAST_WrColumnarHeader(Un, DescStr, ChanName, ChanUnit, NT, TimeOut1, TimeIncrement, IndexPos, ErrStat, ErrMsg)
+
+   INTEGER(IntKi),    INTENT(IN)  :: Un                              !< Unit number of the binary file (opened for stream access)
+   CHARACTER(*),      INTENT(IN)  :: DescStr                         !< Description to write to the binary file (e.g., program version, date, & time)
+   CHARACTER(ChanLen),INTENT(IN)  :: ChanName(:)                     !< The output channel names (including Time)
+   CHARACTER(ChanLen),INTENT(IN)  :: ChanUnit(:)                     !< The output channel units (including Time)
+   INTEGER(IntKi),    INTENT(IN)  :: NT                              !< Number of time steps
+   REAL(DbKi),        INTENT(IN)  :: TimeOut1                        !< The first output time
+   REAL(DbKi),        INTENT(IN)  :: TimeIncrement                   !< The delta t
+   INTEGER(B8Ki),     INTENT(OUT) :: IndexPos                        !< File position of the channel index
+   INTEGER(IntKi),    INTENT(OUT) :: ErrStat                         !< Error status
+   CHARACTER(*),      INTENT(OUT) :: ErrMsg                          !< Error message associated with the ErrStat
+
+   INTEGER(IntKi)                 :: IC                              ! Loop counter for the output channel
+   INTEGER(IntKi)                 :: LenName                         ! Max number of characters in a channel name
+   INTEGER(IntKi)                 :: NumOutChans                     ! Number of output channels
+   INTEGER(IntKi)                 :: ErrStat2                        ! temporary error status
+
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   NumOutChans = SIZE(ChanName) - 1
+
+   LenName = 1
+   DO IC = 1,NumOutChans+1
+      LenName = MAX(LenName,LEN_TRIM(ChanName(IC)))
+      LenName = MAX(LenName,LEN_TRIM(ChanUnit(IC)))
+   END DO
+
+   WRITE (Un, IOSTAT=ErrStat2)  FileFmtID_Columnar, INT( LenName, B2Ki ), INT( NumOutChans, B4Ki ), INT( NT, B4Ki ), &
+                                REAL( TimeOut1, R8Ki ), REAL( TimeIncrement, R8Ki ), INT( LEN_TRIM(DescStr), B4Ki ), TRIM(DescStr)
+   IF ( ErrStat2 == 0 ) WRITE (Un, IOSTAT=ErrStat2)  ( ChanName(IC)(1:LenName), IC=1,NumOutChans+1 )
+   IF ( ErrStat2 == 0 ) WRITE (Un, IOSTAT=ErrStat2)  ( ChanUnit(IC)(1:LenName), IC=1,NumOutChans+1 )
+   IF ( ErrStat2 == 0 ) INQUIRE (Un, POS=IndexPos)
+   IF ( ErrStat2 == 0 ) WRITE (Un, IOSTAT=ErrStat2)  ( 0_B2Ki, IC=1,NumOutChans ), ( 0_B8Ki, IC=1,NumOutChans )
+      IF ( ErrStat2 /= 0 ) CALL SetErrStat( ErrID_Fatal, 'Error writing the header of the FAST binary file.', ErrStat, ErrMsg, 'BinFAST_WrColumnarHeader' )
+
+   END SUBROUTINE BinFAST_WrColumnarHeader
+!=======================================================================
+!> This subroutine writes the time history of one channel as a contiguous block at the current position of a FileFmtID_Columnar
+!! FAST binary file, using the smallest lossless encoding: a single value for constant channels, single-precision floats
+!! if every value is exactly representable in single precision, and double-precision floats otherwise.
+   SUBROUTINE BinFAST_WrColumn(Un, ColData, ChanEnc, ChanPos, ErrStat, ErrMsg)
+
+   INTEGER(IntKi),    INTENT(IN)  :: Un                              !< Unit number of the binary file (opened for stream access)
+   REAL(ReKi),        INTENT(IN)  :: ColData(:)                      !< Time history of the channel
+   INTEGER(B2Ki),     INTENT(OUT) :: ChanEnc                         !< Encoding of the channel block
+   INTEGER(B8Ki),     INTENT(OUT) :: ChanPos                         !< File position of the channel block
+   INTEGER(IntKi),    INTENT(OUT) :: ErrStat                         !< Error status
+   CHARACTER(*),      INTENT(OUT) :: ErrMsg                          !< Error message associated with the ErrStat
+
+   INTEGER(IntKi)                 :: ErrStat2                        ! temporary error status
+
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+
+   INQUIRE (Un, POS=ChanPos)
+
+   ChanEnc = BinColEnc_R8
+   IF ( SIZE(ColData) > 0 ) THEN
+      IF ( ALL( ColData == ColData(1) ) ) THEN
+         ChanEnc = BinColEnc_Const
+      ELSEIF ( ALL( REAL( REAL( ColData, SiKi ), ReKi ) == ColData ) ) THEN
+         ChanEnc = BinColEnc_R4
+      END IF
+   END IF
+
+   IF ( ChanEnc == BinColEnc_Const ) THEN
+      WRITE (Un, IOSTAT=ErrStat2)  REAL( ColData(1), R8Ki )
+   ELSEIF ( ChanEnc == BinColEnc_R4 ) THEN
+      WRITE (Un, IOSTAT=ErrStat2)  REAL( ColData, SiKi )
+   ELSE
+      WRITE (Un, IOSTAT=ErrStat2)  REAL( ColData, R8Ki )
+   END IF
+      IF ( ErrStat2 /= 0 ) CALL SetErrStat( ErrID_Fatal, 'Error writing channel data to the FAST binary file.', ErrStat, ErrMsg, 'BinFAST_WrColumn' )
+
+   END SUBROUTINE BinFAST_WrColumn
 !==================================================================================================================================
 !> This routine writes out a string to the file connected to Unit without following it with a new line.
    SUBROUTINE WrFileNR ( Unit, Str )
@@ -71,6 +71,12 @@ MODULE NWTC_LAPACK
       MODULE PROCEDURE LAPACK_sggev
    END INTERFACE
 
+   !> Compute all eigenvalues and, optionally, eigenvectors of a real symmetric matrix A.
+   INTERFACE LAPACK_syev 
+      MODULE PROCEDURE LAPACK_dsyev
+      MODULE PROCEDURE LAPACK_ssyev
+   END INTERFACE
+
    !> Compute the solution to system of linear equations A * X = B for PO matrices.
    INTERFACE LAPACK_posv 
       MODULE PROCEDURE LAPACK_dposv
@@ -1306,6 +1312,104 @@ MODULE NWTC_LAPACK
    RETURN
    END SUBROUTINE LAPACK_SGGEV
 !=======================================================================
+!> Compute all eigenvalues and, optionally, eigenvectors of a real symmetric matrix A.
+!! use LAPACK_SYEV (nwtc_lapack::lapack_syev) instead of this specific function.
+   SUBROUTINE LAPACK_DSYEV(JOBZ, UPLO, N, A, W, WORK, LWORK, ErrStat, ErrMsg)
+
+      ! passed variables/parameters:
+
+      CHARACTER(1),    intent(in   ) :: JOBZ              !< = 'N':  Compute eigenvalues only; = 'V':  Compute eigenvalues and eigenvectors.
+      CHARACTER(1),    intent(in   ) :: UPLO              !< = 'U':  Upper triangle of A is stored; = 'L':  Lower triangle of A is stored.
+
+      INTEGER,         intent(in   ) :: N                 !< The order of the matrix A.  N >= 0.
+
+      INTEGER,         intent(in   ) :: LWORK             !< The length of the array WORK.  LWORK >= max(1,3*N-1). For optimal efficiency, LWORK >= (NB+2)*N,
+                                                          !!   where NB is the blocksize for DSYTRD returned by ILAENV. If LWORK = -1, then a workspace query is assumed.
+
+      REAL(R8Ki)      ,intent(inout) :: A( :, : )         !< dimension (LDA, N). On entry, the symmetric matrix A. On exit, if JOBZ = 'V', A contains the orthonormal eigenvectors
+                                                          !!   of the matrix A; if JOBZ = 'N', the triangle of A selected by UPLO, including the diagonal, is destroyed.
+      REAL(R8Ki)      ,intent(  out) :: W( : )            !< dimension (N). If INFO = 0, the eigenvalues in ascending order.
+      REAL(R8Ki)      ,intent(inout) :: WORK( : )         !< dimension (MAX(1,LWORK)). On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+
+      INTEGER(IntKi),  intent(  out) :: ErrStat           !< Error level
+      CHARACTER(*),    intent(  out) :: ErrMsg            !< Message describing error
+
+         ! local variables
+      INTEGER                        :: INFO              ! = 0:  successful exit; < 0:  if INFO = -i, the i-th argument had an illegal value; > 0:  if INFO = i, the algorithm failed
+                                                          !   to converge; i off-diagonal elements of an intermediate tridiagonal form did not converge to zero.
+      INTEGER                        :: LDA               ! The leading dimension of the array A.  LDA >= max(1,N).
+
+
+      LDA  = SIZE(A,1)
+
+      ErrStat = ErrID_None
+      ErrMsg  = ""
+
+      CALL DSYEV( JOBZ, UPLO, N, A, LDA, W, WORK, LWORK, INFO )
+
+      IF (INFO /= 0) THEN
+         ErrStat = ErrID_FATAL
+         WRITE( ErrMsg, * ) INFO
+         IF (INFO < 0) THEN
+            ErrMsg  = "LAPACK_DSYEV: illegal value in argument "//TRIM(ErrMsg)//"."
+         ELSE
+            ErrMsg  = "LAPACK_DSYEV: the algorithm failed to converge; "//TRIM(ErrMsg)//" off-diagonal elements of an intermediate tridiagonal form did not converge to zero."
+         END IF
+      END IF
+
+
+   RETURN
+   END SUBROUTINE LAPACK_DSYEV
+!=======================================================================
+!> Compute all eigenvalues and, optionally, eigenvectors of a real symmetric matrix A.
+!! use LAPACK_SYEV (nwtc_lapack::lapack_syev) instead of this specific function.
+   SUBROUTINE LAPACK_SSYEV(JOBZ, UPLO, N, A, W, WORK, LWORK, ErrStat, ErrMsg)
+
+      ! passed variables/parameters:
+
+      CHARACTER(1),    intent(in   ) :: JOBZ              !< = 'N':  Compute eigenvalues only; = 'V':  Compute eigenvalues and eigenvectors.
+      CHARACTER(1),    intent(in   ) :: UPLO              !< = 'U':  Upper triangle of A is stored; = 'L':  Lower triangle of A is stored.
+
+      INTEGER,         intent(in   ) :: N                 !< The order of the matrix A.  N >= 0.
+
+      INTEGER,         intent(in   ) :: LWORK             !< The length of the array WORK.  LWORK >= max(1,3*N-1). For optimal efficiency, LWORK >= (NB+2)*N,
+                                                          !!   where NB is the blocksize for SSYTRD returned by ILAENV. If LWORK = -1, then a workspace query is assumed.
+
+      REAL(SiKi)      ,intent(inout) :: A( :, : )         !< dimension (LDA, N). On entry, the symmetric matrix A. On exit, if JOBZ = 'V', A contains the orthonormal eigenvectors
+                                                          !!   of the matrix A; if JOBZ = 'N', the triangle of A selected by UPLO, including the diagonal, is destroyed.
+      REAL(SiKi)      ,intent(  out) :: W( : )            !< dimension (N). If INFO = 0, the eigenvalues in ascending order.
+      REAL(SiKi)      ,intent(inout) :: WORK( : )         !< dimension (MAX(1,LWORK)). On exit, if INFO = 0, WORK(1) returns the optimal LWORK.
+
+      INTEGER(IntKi),  intent(  out) :: ErrStat           !< Error level
+      CHARACTER(*),    intent(  out) :: ErrMsg            !< Message describing error
+
+         ! local variables
+      INTEGER                        :: INFO              ! = 0:  successful exit; < 0:  if INFO = -i, the i-th argument had an illegal value; > 0:  if INFO = i, the algorithm failed
+                                                          !   to converge; i off-diagonal elements of an intermediate tridiagonal form did not converge to zero.
+      INTEGER                        :: LDA               ! The leading dimension of the array A.  LDA >= max(1,N).
+
+
+      LDA  = SIZE(A,1)
+
+      ErrStat = ErrID_None
+      ErrMsg  = ""
+
+      CALL SSYEV( JOBZ, UPLO, N, A, LDA, W, WORK, LWORK, INFO )
+
+      IF (INFO /= 0) THEN
+         ErrStat = ErrID_FATAL
+         WRITE( ErrMsg, * ) INFO
+         IF (INFO < 0) THEN
+            ErrMsg  = "LAPACK_SSYEV: illegal value in argument "//TRIM(ErrMsg)//"."
+         ELSE
+            ErrMsg  = "LAPACK_SSYEV: the algorithm failed to converge; "//TRIM(ErrMsg)//" off-diagonal elements of an intermediate tridiagonal form did not converge to zero."
+         END IF
+      END IF
+
+
+   RETURN
+   END SUBROUTINE LAPACK_SSYEV
+!=======================================================================
 !> Compute the solution to system of linear equations A * X = B for PO (positive-definite) matrices.
 !! use LAPACK_POSV (nwtc_lapack::lapack_posv) instead of this specific function.
    SUBROUTINE LAPACK_DPOSV (UPLO, N, NRHS, A, B, ErrStat, ErrMsg)
@@ -27,6 +27,7 @@ use FAST_Mapping
 use FAST_ModGlue
 use FAST_Subs
 use NWTC_LAPACK
+!$ use OMP_LIB
 
 implicit none
 
@@ -94,9 +95,8 @@ subroutine FAST_AeroMapDriver(AM, m, p_FAST, m_FAST, y_FAST, T, ErrStat, ErrMsg)
    integer(IntKi)                            :: n_case         !< loop counter
    real(DbKi)                                :: n_global
    real(ReKi), allocatable                   :: UnusedAry(:)
-   type(AeroMapCase)                         :: CaseDataTmp  ! tsr, windSpeed, pitch, and rotor speed for this case (to try a different operating point first)
    integer(IntKi)                            :: NStatus
-   character(MaxWrScrLen), parameter         :: BlankLine = " "
+   integer(IntKi)                            :: NumThreads     !< number of OpenMP threads available for the case sweep
 
    ErrStat = ErrID_None
    ErrMsg = ''
@@ -258,6 +258,16 @@ subroutine FAST_AeroMapDriver(AM, m, p_FAST, m_FAST, y_FAST, T, ErrStat, ErrMsg)
    NStatus = min(100, p_FAST%NumSSCases/100 + 1) ! at least 100 every 100 cases or 100 times per simulation
    call WrScr(NewLine)
 
+   ! If more than one OpenMP thread is available, solve the cases concurrently (the debugging linearization
+   ! files are numbered in the order the Jacobians are built, so that mode stays serial)
+   NumThreads = 1
+   !$ NumThreads = omp_get_max_threads()
+   if (NumThreads > 1 .and. p_FAST%NumSSCases > 1 .and. .not. output_debugging) then
+      call SS_SolveCasesParallel(T, min(NumThreads, p_FAST%NumSSCases), NStatus, ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+
    ! Loop through Aero Map cases
    do n_case = 1, p_FAST%NumSSCases
 
@@ -267,41 +277,8 @@ subroutine FAST_AeroMapDriver(AM, m, p_FAST, m_FAST, y_FAST, T, ErrStat, ErrMsg)
       end if
 
       ! Call steady-state solve for this pitch and rotor speed
-      call SS_Solve(AM, m, m%Mappings, AM%Cases(n_case), p_FAST, y_FAST, m_FAST, T, ErrStat2, ErrMsg2)
-
-      ! we didn't converge; let's try a different operating point and see if that helps:
-      if (ErrStat2 >= ErrID_Severe) then
-
-         ! Create copy of case data for second attempt
-         CaseDataTmp = AM%Cases(n_case)
-
-         ! Modify pitch, TSR, and WindSpeed
-         CaseDataTmp%Pitch = CaseDataTmp%Pitch*0.5_ReKi
-         CaseDataTmp%TSR = CaseDataTmp%TSR*0.5_ReKi
-         CaseDataTmp%WindSpeed = CaseDataTmp%WindSpeed*0.5_ReKi
-
-         ! Write message about retrying case
-         call WrScr('Retrying case '//trim(Num2LStr(n_case))//', first trying to get a better initial guess. Average error is '// &
-                    trim(Num2LStr(y_FAST%DriverWriteOutput(SS_Indx_Err)))//'.')
-
-         call SS_Solve(AM, m, m%Mappings, CaseDataTmp, p_FAST, y_FAST, m_FAST, T, ErrStat2, ErrMsg2)
-
-         ! if that worked, try the real case again:
-         if (ErrStat2 < AbortErrLev) then
-            ! call SS_Solve(m, AM%Cases(n_case), p_FAST, y_FAST, m_FAST, T%ED, T%BD, T%AD, T%MeshMapData, T, ErrStat2, ErrMsg2)
-            call WrOver(BlankLine)
-         end if
-
-      end if
-
-      if (ErrStat2 > ErrID_None) then
-         ErrMsg2 = trim(ErrMsg2)//" case "//trim(Num2LStr(n_case))// &
-                   ' (tsr='//trim(Num2LStr(AM%Cases(n_case)%tsr))// &
-                   ', wind speed='//trim(Num2LStr(AM%Cases(n_case)%windSpeed))//' m/s'// &
-                   ', pitch='//trim(num2lstr(AM%Cases(n_case)%pitch*R2D))//' deg'// &
-                   ', rotor speed='//trim(num2lstr(AM%Cases(n_case)%RotSpeed*RPS2RPM))//' rpm)'
-         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-      end if
+      call SS_SolveCase(AM, m, p_FAST, y_FAST, m_FAST, T, n_case, ErrStat2, ErrMsg2)
+      if (ErrStat2 > ErrID_None) call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
 
       !-------------------------------------------------------------------------
       ! Write results to file
@@ -334,6 +311,246 @@ contains
    end function
 end subroutine
 
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine solves the aero-map cases concurrently. Each OpenMP thread works on its own copy of the turbine data and takes
+!! cases from the list dynamically. The first case a thread solves starts from the nearest case that has already converged; after
+!! that, the thread continues from its previous solution as in the serial sweep. The outputs are buffered and written in case
+!! order after all cases are done, so the output file does not depend on the number of threads.
+subroutine SS_SolveCasesParallel(T, NumThreads, NStatus, ErrStat, ErrMsg)
+   use IfW_FlowField_Types, only: IfW_FlowField_CopyFlowFieldType, IfW_FlowField_DestroyFlowFieldType
+   type(FAST_TurbineType), intent(inout)     :: T              !< all data for one instance of a turbine
+   integer(IntKi), intent(in)                :: NumThreads     !< number of threads (one turbine copy per thread)
+   integer(IntKi), intent(in)                :: NStatus        !< how often the number of finished cases is written to the screen
+   integer(IntKi), intent(out)               :: ErrStat        !< Error status of the operation
+   character(*), intent(out)                 :: ErrMsg         !< Error message if ErrStat /= ErrID_None
+
+   character(*), parameter                   :: RoutineName = 'SS_SolveCasesParallel'
+   character(ErrMsgLen)                      :: ErrMsg2
+   integer(IntKi)                            :: ErrStat2
+   type(FAST_TurbineType), allocatable       :: Tw(:)          ! turbine data for each thread
+   logical, allocatable                      :: Seeded(:)      ! has the thread started its first case?
+   logical, allocatable                      :: Solved(:)      ! has the case converged?
+   real(R8Ki), allocatable                   :: SolvedOP(:,:)  ! converged states and inputs of each case
+   real(ReKi), allocatable                   :: OutBuf(:,:)    ! output channels of each case
+   integer(IntKi), allocatable               :: CaseErrStat(:) ! error status of each case
+   character(ErrMsgLen), allocatable         :: CaseErrMsg(:)  ! error message of each case
+   real(ReKi), allocatable                   :: UnusedAry(:)
+   real(ReKi)                                :: OPScale(3)     ! range of wind speed, rotor speed, and pitch over all cases
+   real(DbKi)                                :: n_global
+   integer(IntKi)                            :: NumCases, NumDone, nx
+   integer(IntKi)                            :: n_case, iThread, iSeed, i
+
+   ErrStat = ErrID_None
+   ErrMsg = ''
+
+   NumCases = T%p_FAST%NumSSCases
+   nx = T%m_Glue%AM%Mod%Vars%Nx
+
+   allocate (Tw(NumThreads), Seeded(NumThreads), Solved(NumCases), CaseErrStat(NumCases), CaseErrMsg(NumCases), stat=ErrStat2)
+   if (ErrStat2 /= 0) then
+      call SetErrStat(ErrID_Fatal, "Error allocating AeroMap case data", ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   call AllocAry(SolvedOP, nx + T%m_Glue%AM%Mod%Vars%Nu, NumCases, 'SolvedOP', ErrStat2, ErrMsg2); if (Failed()) return
+   call AllocAry(OutBuf, size(T%y_FAST%ChannelNames) - 1, NumCases, 'OutBuf', ErrStat2, ErrMsg2); if (Failed()) return
+
+   ! Give each thread its own copy of the turbine, including the steady flow field that AeroDyn points to
+   do i = 1, NumThreads
+      call FAST_CopyTurbineType(T, Tw(i), MESH_NEWCOPY, ErrStat2, ErrMsg2); if (Failed()) return
+      nullify (Tw(i)%AD%p%FlowField)
+      allocate (Tw(i)%AD%p%FlowField, stat=ErrStat2)
+      if (ErrStat2 /= 0) then
+         ErrStat2 = ErrID_Fatal
+         ErrMsg2 = "Error allocating AeroDyn flow field"
+         if (Failed()) return
+      end if
+      call IfW_FlowField_CopyFlowFieldType(T%AD%p%FlowField, Tw(i)%AD%p%FlowField, MESH_NEWCOPY, ErrStat2, ErrMsg2); if (Failed()) return
+   end do
+
+   ! Scale the operating-point distance used to pick the case a thread starts from
+   associate (Cases => T%m_Glue%AM%Cases)
+      OPScale = [maxval(Cases%WindSpeed) - minval(Cases%WindSpeed), &
+                 maxval(Cases%RotSpeed) - minval(Cases%RotSpeed), &
+                 maxval(Cases%Pitch) - minval(Cases%Pitch)]
+   end associate
+   where (OPScale <= 0.0_ReKi) OPScale = 1.0_ReKi
+
+   Seeded = .false.
+   Solved = .false.
+   NumDone = 0
+
+   !$OMP PARALLEL DO SCHEDULE(DYNAMIC) NUM_THREADS(NumThreads) DEFAULT(SHARED) PRIVATE(n_case, iThread, iSeed, ErrStat2, ErrMsg2)
+   do n_case = 1, NumCases
+      iThread = 1
+      !$ iThread = omp_get_thread_num() + 1
+
+      ErrStat2 = ErrID_None
+      ErrMsg2 = ''
+
+      ! Start the thread's first case from the nearest case that has already converged
+      if (.not. Seeded(iThread)) then
+         Seeded(iThread) = .true.
+         !$OMP CRITICAL(AeroMap_SolvedCases)
+         iSeed = NearestSolvedCase(n_case)
+         if (iSeed > 0) then
+            Tw(iThread)%m_Glue%AM%Mod%Lin%x = SolvedOP(:nx, iSeed)
+            Tw(iThread)%m_Glue%AM%u1 = SolvedOP(nx + 1:, iSeed)
+         end if
+         !$OMP END CRITICAL(AeroMap_SolvedCases)
+         if (iSeed > 0) then
+            Tw(iThread)%m_Glue%AM%SolveDelta = 0.0_R8Ki
+            call SS_UpdateInputsStates(Tw(iThread)%m_Glue%AM, Tw(iThread)%m_Glue%AM%SolveDelta, Tw(iThread), ErrStat2, ErrMsg2)
+         end if
+      end if
+
+      ! Call steady-state solve for this pitch and rotor speed
+      call SS_SolveCase(Tw(iThread)%m_Glue%AM, Tw(iThread)%m_Glue, Tw(iThread)%p_FAST, Tw(iThread)%y_FAST, Tw(iThread)%m_FAST, &
+                        Tw(iThread), n_case, CaseErrStat(n_case), CaseErrMsg(n_case))
+      if (ErrStat2 /= ErrID_None) call SetErrStat(ErrStat2, ErrMsg2, CaseErrStat(n_case), CaseErrMsg(n_case), RoutineName)
+
+      ! Store the outputs of this case
+      call FillOutputAry(Tw(iThread)%p_FAST, Tw(iThread)%y_FAST, UnusedAry, UnusedAry, Tw(iThread)%ED%y, UnusedAry, &
+                         Tw(iThread)%AD%y, UnusedAry, Tw(iThread)%SrvD%y, UnusedAry, UnusedAry, UnusedAry, UnusedAry, UnusedAry, &
+                         UnusedAry, UnusedAry, UnusedAry, UnusedAry, Tw(iThread)%IceD%y, Tw(iThread)%SlD%y%WriteOutput, &
+                         Tw(iThread)%BD%y, OutBuf(:, n_case))
+
+      ! Store the solution so other threads can start from it
+      if (CaseErrStat(n_case) < ErrID_Severe) then
+         call SS_GetStates(Tw(iThread)%m_Glue%AM, SolvedOP(:nx, n_case), STATE_CURR, Tw(iThread), ErrStat2, ErrMsg2)
+         if (ErrStat2 < AbortErrLev) then
+            call SS_GetInputs(Tw(iThread)%m_Glue%AM, SolvedOP(nx + 1:, n_case), INPUT_CURR, Tw(iThread), ErrStat2, ErrMsg2)
+         end if
+      end if
+
+      !$OMP CRITICAL(AeroMap_SolvedCases)
+      Solved(n_case) = CaseErrStat(n_case) < ErrID_Severe .and. ErrStat2 < AbortErrLev
+      NumDone = NumDone + 1
+      if (NumDone == 1 .or. NumDone == NumCases .or. mod(NumDone, NStatus) == 0) then
+         call WrOver(' Case '//trim(Num2LStr(NumDone))//' of '//trim(Num2LStr(NumCases)))
+      end if
+      !$OMP END CRITICAL(AeroMap_SolvedCases)
+   end do
+   !$OMP END PARALLEL DO
+
+   !----------------------------------------------------------------------------
+   ! Write results and errors to file/screen in case order
+   !----------------------------------------------------------------------------
+
+   do n_case = 1, NumCases
+      n_global = real(n_case, DbKi) ! n_global is double-precision so that we can reuse existing code.
+      call WrOutputAry(n_global, T%p_FAST, T%y_FAST, OutBuf(:, n_case), ErrStat2, ErrMsg2)
+      if (Failed()) return
+
+      if (CaseErrStat(n_case) > ErrID_None) then
+         call WrScr(trim(CaseErrMsg(n_case)))
+         call WrScr("")
+      end if
+   end do
+
+   call Cleanup()
+
+contains
+   logical function Failed()
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      Failed = ErrStat >= AbortErrLev
+      if (Failed) call Cleanup()
+   end function
+
+   !> Returns the index of the converged case closest to case iCase in (wind speed, rotor speed, pitch), or 0 if none has converged
+   integer(IntKi) function NearestSolvedCase(iCase)
+      integer(IntKi), intent(in) :: iCase
+      real(ReKi)                 :: Dist, MinDist
+      integer(IntKi)             :: j
+      NearestSolvedCase = 0
+      MinDist = huge(MinDist)
+      associate (Cases => T%m_Glue%AM%Cases)
+         do j = 1, NumCases
+            if (.not. Solved(j)) cycle
+            Dist = ((Cases(j)%WindSpeed - Cases(iCase)%WindSpeed)/OPScale(1))**2 + &
+                   ((Cases(j)%RotSpeed - Cases(iCase)%RotSpeed)/OPScale(2))**2 + &
+                   ((Cases(j)%Pitch - Cases(iCase)%Pitch)/OPScale(3))**2
+            if (Dist < MinDist) then
+               MinDist = Dist
+               NearestSolvedCase = j
+            end if
+         end do
+      end associate
+   end function
+
+   subroutine Cleanup()
+      integer(IntKi)             :: ErrStat3
+      character(ErrMsgLen)       :: ErrMsg3
+      integer(IntKi)             :: j
+      if (.not. allocated(Tw)) return
+      do j = 1, size(Tw)
+         ! the flow field is not destroyed with the turbine because AeroDyn only points to it
+         if (associated(Tw(j)%AD%p%FlowField)) then
+            if (.not. associated(Tw(j)%AD%p%FlowField, T%AD%p%FlowField)) then
+               call IfW_FlowField_DestroyFlowFieldType(Tw(j)%AD%p%FlowField, ErrStat3, ErrMsg3)
+               deallocate (Tw(j)%AD%p%FlowField)
+            end if
+         end if
+         call FAST_DestroyTurbineType(Tw(j), ErrStat3, ErrMsg3)
+      end do
+      deallocate (Tw)
+   end subroutine
+end subroutine
+
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine solves one aero-map case. If the solve does not converge, it is retried from a modified operating point to
+!! get a better initial guess for the following cases.
+subroutine SS_SolveCase(AM, m, p_FAST, y_FAST, m_FAST, T, n_case, ErrStat, ErrMsg)
+   type(Glue_AeroMap), intent(inout)         :: AM          !< AeroMap data
+   type(Glue_MiscVarType), intent(inout)     :: m           !< MiscVars for the glue code
+   type(FAST_ParameterType), intent(in)      :: p_FAST      !< Parameters for the glue code
+   type(FAST_OutputFileType), intent(inout)  :: y_FAST      !< Output variables for the glue code
+   type(FAST_MiscVarType), intent(inout)     :: m_FAST      !< Miscellaneous variables
+   type(FAST_TurbineType), intent(inout)     :: T           !< all data for one instance of a turbine
+   integer(IntKi), intent(in)                :: n_case      !< case number
+   integer(IntKi), intent(out)               :: ErrStat     !< Error status of the operation
+   character(*), intent(out)                 :: ErrMsg      !< Error message if ErrStat /= ErrID_None
+
+   type(AeroMapCase)                         :: CaseDataTmp  ! tsr, windSpeed, pitch, and rotor speed for this case (to try a different operating point first)
+   character(MaxWrScrLen), parameter         :: BlankLine = " "
+
+   ! Call steady-state solve for this pitch and rotor speed
+   call SS_Solve(AM, m, m%Mappings, AM%Cases(n_case), p_FAST, y_FAST, m_FAST, T, ErrStat, ErrMsg)
+
+   ! we didn't converge; let's try a different operating point and see if that helps:
+   if (ErrStat >= ErrID_Severe) then
+
+      ! Create copy of case data for second attempt
+      CaseDataTmp = AM%Cases(n_case)
+
+      ! Modify pitch, TSR, and WindSpeed
+      CaseDataTmp%Pitch = CaseDataTmp%Pitch*0.5_ReKi
+      CaseDataTmp%TSR = CaseDataTmp%TSR*0.5_ReKi
+      CaseDataTmp%WindSpeed = CaseDataTmp%WindSpeed*0.5_ReKi
+
+      ! Write message about retrying case
+      call WrScr('Retrying case '//trim(Num2LStr(n_case))//', first trying to get a better initial guess. Average error is '// &
+                 trim(Num2LStr(y_FAST%DriverWriteOutput(SS_Indx_Err)))//'.')
+
+      call SS_Solve(AM, m, m%Mappings, CaseDataTmp, p_FAST, y_FAST, m_FAST, T, ErrStat, ErrMsg)
+
+      ! if that worked, try the real case again:
+      if (ErrStat < AbortErrLev) then
+         ! call SS_Solve(m, AM%Cases(n_case), p_FAST, y_FAST, m_FAST, T%ED, T%BD, T%AD, T%MeshMapData, T, ErrStat2, ErrMsg2)
+         call WrOver(BlankLine)
+      end if
+
+   end if
+
+   if (ErrStat > ErrID_None) then
+      ErrMsg = trim(ErrMsg)//" case "//trim(Num2LStr(n_case))// &
+               ' (tsr='//trim(Num2LStr(AM%Cases(n_case)%tsr))// &
+               ', wind speed='//trim(Num2LStr(AM%Cases(n_case)%windSpeed))//' m/s'// &
+               ', pitch='//trim(num2lstr(AM%Cases(n_case)%pitch*R2D))//' deg'// &
+               ', rotor speed='//trim(num2lstr(AM%Cases(n_case)%RotSpeed*RPS2RPM))//' rpm)'
+   end if
+
+end subroutine
+
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This routine performs the Input-Output solve for the steady-state solver.
 !! Note that this has been customized for the physics in the problems and is not a general solution.
@@ -150,6 +150,7 @@ public ::   FAST_InitInputStateArrays, &
             FAST_SetOP, &
             FAST_CopyInput, &
             FAST_CopyStates, &
+            FAST_SwapStates, &
             FAST_UpdateStates, &
             FAST_CalcOutput, &
             FAST_ModEnd, &
@@ -174,6 +175,11 @@ subroutine FAST_ExtrapInterp(ModData, t_global_next, T, ErrStat, ErrMsg)
    ErrStat = ErrID_None
    ErrMsg = ''
 
+   ! The extrapolated input is placed in INPUT_TEMP and the input history is rotated
+   ! by swapping the allocations of adjacent entries rather than copying them. After
+   ! the rotation, INPUT_TEMP holds the oldest (discarded) input, so it is refreshed
+   ! from the new INPUT_CURR to keep it consistent for the solver.
+
    ! Select based on module ID
    select case (ModData%ID)
 
@@ -181,8 +187,9 @@ subroutine FAST_ExtrapInterp(ModData, t_global_next, T, ErrStat, ErrMsg)
       if (ModData%Ins == 1) then
          call AD_Input_ExtrapInterp(T%AD%Input(1:), T%AD%InputTimes, T%AD%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
          do j = T%p_FAST%InterpOrder, 0, -1
-            call AD_CopyInput(T%AD%Input(j), T%AD%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+            call AD_SwapInput(T%AD%Input(j), T%AD%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
          end do
+         call AD_CopyInput(T%AD%Input(INPUT_CURR), T%AD%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
          call ShiftInputTimes(T%AD%InputTimes)
       else
          ErrStat2 = ErrID_None
@@ -192,29 +199,33 @@ subroutine FAST_ExtrapInterp(ModData, t_global_next, T, ErrStat, ErrMsg)
    case (Module_ADsk)
       call ADsk_Input_ExtrapInterp(T%ADsk%Input(1:), T%ADsk%InputTimes, T%ADsk%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call ADsk_CopyInput(T%ADsk%Input(j), T%ADsk%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call ADsk_SwapInput(T%ADsk%Input(j), T%ADsk%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call ADsk_CopyInput(T%ADsk%Input(INPUT_CURR), T%ADsk%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%ADsk%InputTimes)
 
    case (Module_BD)
       call BD_Input_ExtrapInterp(T%BD%Input(1:, ModData%Ins), T%BD%InputTimes(:, ModData%Ins), T%BD%Input(INPUT_TEMP, ModData%Ins), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call BD_CopyInput(T%BD%Input(j, ModData%Ins), T%BD%Input(j + 1, ModData%Ins), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call BD_SwapInput(T%BD%Input(j, ModData%Ins), T%BD%Input(j + 1, ModData%Ins), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call BD_CopyInput(T%BD%Input(INPUT_CURR, ModData%Ins), T%BD%Input(INPUT_TEMP, ModData%Ins), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%BD%InputTimes(:, ModData%Ins))
 
    case (Module_ED)
       call ED_Input_ExtrapInterp(T%ED%Input(1:, ModData%Ins), T%ED%InputTimes(:, ModData%Ins), T%ED%Input(INPUT_TEMP, ModData%Ins), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call ED_CopyInput(T%ED%Input(j, ModData%Ins), T%ED%Input(j + 1, ModData%Ins), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call ED_SwapInput(T%ED%Input(j, ModData%Ins), T%ED%Input(j + 1, ModData%Ins), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call ED_CopyInput(T%ED%Input(INPUT_CURR, ModData%Ins), T%ED%Input(INPUT_TEMP, ModData%Ins), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%ED%InputTimes(:, ModData%Ins))
 
    case (Module_SED)
       call SED_Input_ExtrapInterp(T%SED%Input(1:), T%SED%InputTimes, T%SED%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call SED_CopyInput(T%SED%Input(j), T%SED%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call SED_SwapInput(T%SED%Input(j), T%SED%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call SED_CopyInput(T%SED%Input(INPUT_CURR), T%SED%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%SED%InputTimes)
 
    case (Module_ExtInfw)
@@ -226,46 +237,53 @@ subroutine FAST_ExtrapInterp(ModData, t_global_next, T, ErrStat, ErrMsg)
    case (Module_ExtPtfm)
       call ExtPtfm_Input_ExtrapInterp(T%ExtPtfm%Input(1:), T%ExtPtfm%InputTimes, T%ExtPtfm%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call ExtPtfm_CopyInput(T%ExtPtfm%Input(j), T%ExtPtfm%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call ExtPtfm_SwapInput(T%ExtPtfm%Input(j), T%ExtPtfm%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call ExtPtfm_CopyInput(T%ExtPtfm%Input(INPUT_CURR), T%ExtPtfm%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%ExtPtfm%InputTimes)
 
    case (Module_FEAM)
       call FEAM_Input_ExtrapInterp(T%FEAM%Input(1:), T%FEAM%InputTimes, T%FEAM%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call FEAM_CopyInput(T%FEAM%Input(j), T%FEAM%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call FEAM_SwapInput(T%FEAM%Input(j), T%FEAM%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call FEAM_CopyInput(T%FEAM%Input(INPUT_CURR), T%FEAM%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%FEAM%InputTimes)
 
    case (Module_HD)
       call HydroDyn_Input_ExtrapInterp(T%HD%Input(1:), T%HD%InputTimes, T%HD%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call HydroDyn_CopyInput(T%HD%Input(j), T%HD%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call HydroDyn_SwapInput(T%HD%Input(j), T%HD%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call HydroDyn_CopyInput(T%HD%Input(INPUT_CURR), T%HD%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%HD%InputTimes)
 
    case (Module_IceD)
       call IceD_Input_ExtrapInterp(T%IceD%Input(1:, ModData%Ins), T%IceD%InputTimes(:, ModData%Ins), T%IceD%Input(INPUT_TEMP, ModData%Ins), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call IceD_CopyInput(T%IceD%Input(j, ModData%Ins), T%IceD%Input(j + 1, ModData%Ins), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call IceD_SwapInput(T%IceD%Input(j, ModData%Ins), T%IceD%Input(j + 1, ModData%Ins), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call IceD_CopyInput(T%IceD%Input(INPUT_CURR, ModData%Ins), T%IceD%Input(INPUT_TEMP, ModData%Ins), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%IceD%InputTimes(:, ModData%Ins))
 
    case (Module_IceF)
       call IceFloe_Input_ExtrapInterp(T%IceF%Input(1:), T%IceF%InputTimes, T%IceF%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call IceFloe_CopyInput(T%IceF%Input(j), T%IceF%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call IceFloe_SwapInput(T%IceF%Input(j), T%IceF%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call IceFloe_CopyInput(T%IceF%Input(INPUT_CURR), T%IceF%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%IceF%InputTimes)
 
    case (Module_IfW)
       call InflowWind_Input_ExtrapInterp(T%IfW%Input(1:), T%IfW%InputTimes, T%IfW%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call InflowWind_CopyInput(T%IfW%Input(j), T%IfW%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call InflowWind_SwapInput(T%IfW%Input(j), T%IfW%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call InflowWind_CopyInput(T%IfW%Input(INPUT_CURR), T%IfW%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%IfW%InputTimes)
 
    case (Module_MAP)
+      ! MAP inputs are shared with the C library, so they are copied instead of swapped
       call MAP_Input_ExtrapInterp(T%MAP%Input(1:), T%MAP%InputTimes, T%MAP%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
          call MAP_CopyInput(T%MAP%Input(j), T%MAP%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
@@ -275,29 +293,33 @@ subroutine FAST_ExtrapInterp(ModData, t_global_next, T, ErrStat, ErrMsg)
    case (Module_MD)
       call MD_Input_ExtrapInterp(T%MD%Input(1:), T%MD%InputTimes, T%MD%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call MD_CopyInput(T%MD%Input(j), T%MD%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call MD_SwapInput(T%MD%Input(j), T%MD%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call MD_CopyInput(T%MD%Input(INPUT_CURR), T%MD%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%MD%InputTimes)
 
    case (Module_Orca)
       call Orca_Input_ExtrapInterp(T%Orca%Input(1:), T%Orca%InputTimes, T%Orca%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call Orca_CopyInput(T%Orca%Input(j), T%Orca%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call Orca_SwapInput(T%Orca%Input(j), T%Orca%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call Orca_CopyInput(T%Orca%Input(INPUT_CURR), T%Orca%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%Orca%InputTimes)
 
    case (Module_SD)
       call SD_Input_ExtrapInterp(T%SD%Input(1:), T%SD%InputTimes, T%SD%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call SD_CopyInput(T%SD%Input(j), T%SD%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call SD_SwapInput(T%SD%Input(j), T%SD%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call SD_CopyInput(T%SD%Input(INPUT_CURR), T%SD%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%SD%InputTimes)
 
    case (Module_SlD)
       call SlD_Input_ExtrapInterp(T%SlD%Input(1:), T%SlD%InputTimes, T%SlD%Input(INPUT_TEMP), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call SlD_CopyInput(T%SlD%Input(j), T%SlD%Input(j + 1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call SlD_SwapInput(T%SlD%Input(j), T%SlD%Input(j + 1), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call SlD_CopyInput(T%SlD%Input(INPUT_CURR), T%SlD%Input(INPUT_TEMP), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%SlD%InputTimes)
 
    case (Module_SeaSt)
@@ -312,8 +334,9 @@ subroutine FAST_ExtrapInterp(ModData, t_global_next, T, ErrStat, ErrMsg)
    case (Module_SrvD)
       call SrvD_Input_ExtrapInterp(T%SrvD%Input(1:, ModData%Ins), T%SrvD%InputTimes(:, ModData%Ins), T%SrvD%Input(INPUT_TEMP, ModData%Ins), t_global_next, ErrStat2, ErrMsg2); if (Failed()) return
       do j = T%p_FAST%InterpOrder, 0, -1
-         call SrvD_CopyInput(T%SrvD%Input(j, ModData%Ins), T%SrvD%Input(j + 1, ModData%Ins), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+         call SrvD_SwapInput(T%SrvD%Input(j, ModData%Ins), T%SrvD%Input(j + 1, ModData%Ins), ErrStat2, ErrMsg2); if (Failed()) return
       end do
+      call SrvD_CopyInput(T%SrvD%Input(INPUT_CURR, ModData%Ins), T%SrvD%Input(INPUT_TEMP, ModData%Ins), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
       call ShiftInputTimes(T%SrvD%InputTimes(:, ModData%Ins))
 
    case default
@@ -1762,6 +1785,183 @@ contains
    end function
 end subroutine
 
+!> FAST_SwapStates exchanges the module states at indices iState1 and iState2 by swapping their
+!! allocations instead of copying the data. MAP states are shared with the C library, so they are
+!! copied from iState2 into iState1 instead.
+subroutine FAST_SwapStates(ModData, T, iState1, iState2, ErrStat, ErrMsg)
+   type(ModDataType), intent(in)                      :: ModData     !< Module data
+   type(FAST_TurbineType), intent(inout)              :: T           !< Turbine type
+   integer(IntKi), intent(in)                         :: iState1, iState2 !< State indices
+   integer(IntKi), intent(out)                        :: ErrStat
+   character(*), intent(out)                          :: ErrMsg
+
+   character(*), parameter    :: RoutineName = 'FAST_SwapStates'
+   integer(IntKi)             :: ErrStat2
+   character(ErrMsgLen)       :: ErrMsg2
+
+   ErrStat = ErrID_None
+   ErrMsg = ''
+
+   ! Select based on module ID
+   select case (ModData%ID)
+
+   case (Module_AD)
+
+      if (ModData%Ins == 1) then
+         call AD_SwapContState(T%AD%x(iState1), T%AD%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+         call AD_SwapDiscState(T%AD%xd(iState1), T%AD%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+         call AD_SwapConstrState(T%AD%z(iState1), T%AD%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+         call AD_SwapOtherState(T%AD%OtherSt(iState1), T%AD%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      else
+         ErrStat2 = ErrID_None
+         ErrMsg2 = ''
+      end if
+
+   case (Module_ADsk)
+
+      call ADsk_SwapContState(T%ADsk%x(iState1), T%ADsk%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ADsk_SwapDiscState(T%ADsk%xd(iState1), T%ADsk%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ADsk_SwapConstrState(T%ADsk%z(iState1), T%ADsk%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ADsk_SwapOtherState(T%ADsk%OtherSt(iState1), T%ADsk%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_BD)
+
+      call BD_SwapContState(T%BD%x(ModData%Ins, iState1), T%BD%x(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call BD_SwapDiscState(T%BD%xd(ModData%Ins, iState1), T%BD%xd(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call BD_SwapConstrState(T%BD%z(ModData%Ins, iState1), T%BD%z(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call BD_SwapOtherState(T%BD%OtherSt(ModData%Ins, iState1), T%BD%OtherSt(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_ED)
+
+      call ED_SwapContState(T%ED%x(ModData%Ins, iState1), T%ED%x(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ED_SwapDiscState(T%ED%xd(ModData%Ins, iState1), T%ED%xd(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ED_SwapConstrState(T%ED%z(ModData%Ins, iState1), T%ED%z(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ED_SwapOtherState(T%ED%OtherSt(ModData%Ins, iState1), T%ED%OtherSt(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_SED)
+
+      call SED_SwapContState(T%SED%x(iState1), T%SED%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SED_SwapDiscState(T%SED%xd(iState1), T%SED%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SED_SwapConstrState(T%SED%z(iState1), T%SED%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SED_SwapOtherState(T%SED%OtherSt(iState1), T%SED%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_ExtInfw)
+
+      ! call ExtInfw_SwapContState(T%ExtInfw%x(iState1), T%ExtInfw%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      ! call ExtInfw_SwapDiscState(T%ExtInfw%xd(iState1), T%ExtInfw%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      ! call ExtInfw_SwapConstrState(T%ExtInfw%z(iState1), T%ExtInfw%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      ! call ExtInfw_SwapOtherState(T%ExtInfw%OtherSt(iState1), T%ExtInfw%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_ExtLd)
+
+      call ExtLd_SwapContState(T%ExtLd%x(iState1), T%ExtLd%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ExtLd_SwapDiscState(T%ExtLd%xd(iState1), T%ExtLd%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ExtLd_SwapConstrState(T%ExtLd%z(iState1), T%ExtLd%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ExtLd_SwapOtherState(T%ExtLd%OtherSt(iState1), T%ExtLd%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_ExtPtfm)
+
+      call ExtPtfm_SwapContState(T%ExtPtfm%x(iState1), T%ExtPtfm%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ExtPtfm_SwapDiscState(T%ExtPtfm%xd(iState1), T%ExtPtfm%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ExtPtfm_SwapConstrState(T%ExtPtfm%z(iState1), T%ExtPtfm%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call ExtPtfm_SwapOtherState(T%ExtPtfm%OtherSt(iState1), T%ExtPtfm%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_FEAM)
+
+      call FEAM_SwapContState(T%FEAM%x(iState1), T%FEAM%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call FEAM_SwapDiscState(T%FEAM%xd(iState1), T%FEAM%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call FEAM_SwapConstrState(T%FEAM%z(iState1), T%FEAM%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call FEAM_SwapOtherState(T%FEAM%OtherSt(iState1), T%FEAM%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_HD)
+
+      call HydroDyn_SwapContState(T%HD%x(iState1), T%HD%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call HydroDyn_SwapDiscState(T%HD%xd(iState1), T%HD%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call HydroDyn_SwapConstrState(T%HD%z(iState1), T%HD%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call HydroDyn_SwapOtherState(T%HD%OtherSt(iState1), T%HD%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_IceD)
+
+      call IceD_SwapContState(T%IceD%x(iState1, ModData%Ins), T%IceD%x(iState2, ModData%Ins), ErrStat2, ErrMsg2); if (Failed()) return
+      call IceD_SwapDiscState(T%IceD%xd(iState1, ModData%Ins), T%IceD%xd(iState2, ModData%Ins), ErrStat2, ErrMsg2); if (Failed()) return
+      call IceD_SwapConstrState(T%IceD%z(iState1, ModData%Ins), T%IceD%z(iState2, ModData%Ins), ErrStat2, ErrMsg2); if (Failed()) return
+      call IceD_SwapOtherState(T%IceD%OtherSt(iState1, ModData%Ins), T%IceD%OtherSt(iState2, ModData%Ins), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_IceF)
+
+      call IceFloe_SwapContState(T%IceF%x(iState1), T%IceF%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call IceFloe_SwapDiscState(T%IceF%xd(iState1), T%IceF%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call IceFloe_SwapConstrState(T%IceF%z(iState1), T%IceF%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call IceFloe_SwapOtherState(T%IceF%OtherSt(iState1), T%IceF%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_IfW)
+
+      ! call IfW_SwapContState(T%IfW%x(iState1), T%IfW%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      ! call IfW_SwapDiscState(T%IfW%xd(iState1), T%IfW%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      ! call IfW_SwapConstrState(T%IfW%z(iState1), T%IfW%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      ! call IfW_SwapOtherState(T%IfW%OtherSt(iState1), T%IfW%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_MAP)
+
+      call MAP_CopyContState(T%MAP%x(iState2), T%MAP%x(iState1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+      call MAP_CopyDiscState(T%MAP%xd(iState2), T%MAP%xd(iState1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+      call MAP_CopyConstrState(T%MAP%z(iState2), T%MAP%z(iState1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+      ! call MAP_CopyOtherState(T%MAP%OtherSt(iState2), T%MAP%OtherSt(iState1), MESH_UPDATECOPY, ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_MD)
+
+      call MD_SwapContState(T%MD%x(iState1), T%MD%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call MD_SwapDiscState(T%MD%xd(iState1), T%MD%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call MD_SwapConstrState(T%MD%z(iState1), T%MD%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call MD_SwapOtherState(T%MD%OtherSt(iState1), T%MD%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_Orca)
+
+      call Orca_SwapContState(T%Orca%x(iState1), T%Orca%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call Orca_SwapDiscState(T%Orca%xd(iState1), T%Orca%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call Orca_SwapConstrState(T%Orca%z(iState1), T%Orca%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call Orca_SwapOtherState(T%Orca%OtherSt(iState1), T%Orca%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_SD)
+
+      call SD_SwapContState(T%SD%x(iState1), T%SD%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SD_SwapDiscState(T%SD%xd(iState1), T%SD%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SD_SwapConstrState(T%SD%z(iState1), T%SD%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SD_SwapOtherState(T%SD%OtherSt(iState1), T%SD%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_SeaSt)
+
+      call SeaSt_SwapContState(T%SeaSt%x(iState1), T%SeaSt%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SeaSt_SwapDiscState(T%SeaSt%xd(iState1), T%SeaSt%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SeaSt_SwapConstrState(T%SeaSt%z(iState1), T%SeaSt%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SeaSt_SwapOtherState(T%SeaSt%OtherSt(iState1), T%SeaSt%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_SlD)
+
+      call SlD_SwapContState(T%SlD%x(iState1), T%SlD%x(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SlD_SwapDiscState(T%SlD%xd(iState1), T%SlD%xd(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SlD_SwapConstrState(T%SlD%z(iState1), T%SlD%z(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SlD_SwapOtherState(T%SlD%OtherSt(iState1), T%SlD%OtherSt(iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case (Module_SrvD)
+
+      call SrvD_SwapContState(T%SrvD%x(ModData%Ins, iState1), T%SrvD%x(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SrvD_SwapDiscState(T%SrvD%xd(ModData%Ins, iState1), T%SrvD%xd(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SrvD_SwapConstrState(T%SrvD%z(ModData%Ins, iState1), T%SrvD%z(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+      call SrvD_SwapOtherState(T%SrvD%OtherSt(ModData%Ins, iState1), T%SrvD%OtherSt(ModData%Ins, iState2), ErrStat2, ErrMsg2); if (Failed()) return
+
+   case default
+      call SetErrStat(ErrID_Fatal, "Unknown module "//trim(ModData%Abbr), ErrStat, ErrMsg, RoutineName)
+      return
+   end select
+
+contains
+   logical function Failed()
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      Failed = ErrStat >= AbortErrLev
+   end function
+end subroutine
+
 subroutine FAST_CopyInput(ModData, T, iSrc, iDst, CtrlCode, ErrStat, ErrMsg)
    type(ModDataType), intent(in)                      :: ModData        !< Module data
    type(FAST_TurbineType), target, intent(inout)      :: T              !< Turbine type
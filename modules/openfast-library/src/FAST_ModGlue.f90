@@ -34,6 +34,9 @@ private
 
 public :: ModGlue_Init, &
           ModGlue_Linearize_OP, &
+          ModGlue_CalcJacobians_OP, &
+          ModGlue_WriteLinearization_OP, &
+          CalcGlueStateMatrices, &
           ModGlue_CalcSteady, &
           ModGlue_SaveOperatingPoint, &
           ModGlue_RestoreOperatingPoint, &
@@ -922,27 +925,11 @@ subroutine ModGlue_Linearize_OP(p, m, y, p_FAST, m_FAST, y_FAST, t_global, Turbi
    character(*), parameter                   :: RoutineName = 'ModGlue_Linearize_OP'
    integer(IntKi)                            :: ErrStat2
    character(ErrMsgLen)                      :: ErrMsg2
-   integer(IntKi)                            :: i, j, k
-   integer(IntKi)                            :: ix, iz, iu, iy
-   integer(IntKi)                            :: Un
-   integer(IntKi)                            :: StateLinIndex, InputLinIndex
-   integer(IntKi), parameter                 :: iED = 1
-   character(200)                            :: SimStr
-   character(MaxWrScrLen)                    :: BlankLine
-   character(1024)                           :: LinRootName
-   character(*), parameter                   :: Fmt = 'F10.2'
 
    ! Initialize error return
    ErrStat = ErrID_None
    ErrMsg = ""
 
-   ! Write message to screen
-   BlankLine = ""
-   call WrOver(BlankLine)  ! BlankLine contains MaxWrScrLen spaces
-   SimStr = '(RotSpeed='//trim(Num2LStr(Turbine%ED%y(iED)%RotSpeed*RPS2RPM, Fmt))//' rpm, BldPitch1='//trim(Num2LStr(Turbine%ED%y(iED)%BlPitch(1)*R2D, Fmt))//' deg)'
-   call WrOver(' Performing linearization '//trim(Num2LStr(m%Lin%TimeIndex))//' at simulation time '//TRIM(Num2LStr(t_global))//' s. '//trim(SimStr))
-   call WrScr('')
-
    !----------------------------------------------------------------------------
    ! Save operating point
    !----------------------------------------------------------------------------
@@ -954,24 +941,47 @@ subroutine ModGlue_Linearize_OP(p, m, y, p_FAST, m_FAST, y_FAST, t_global, Turbi
    end if
 
    !----------------------------------------------------------------------------
-   ! Initialization
+   ! Jacobians and linearization files
    !----------------------------------------------------------------------------
 
-   ! Get parameters
-   y_FAST%Lin%RotSpeed = Turbine%ED%y(iED)%RotSpeed
-   y_FAST%Lin%Azimuth = Turbine%ED%y(iED)%LSSTipPxa
+   call ModGlue_CalcJacobians_OP(m, y_FAST, t_global, Turbine, ErrStat2, ErrMsg2)
+   if (Failed()) return
 
-   ! Assemble linearization root file name
-   LinRootName = trim(p_FAST%OutFileRoot)//'.'//trim(Num2LStr(m%Lin%TimeIndex))
+   call ModGlue_WriteLinearization_OP(m, y, p_FAST, y_FAST, t_global, Turbine, .true., ErrStat2, ErrMsg2)
+   if (Failed()) return
 
-   ! Get unit number for writing files
-   call GetNewUnit(Un, ErrStat2, ErrMsg2); if (Failed()) return
+contains
+   logical function Failed()
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      Failed = ErrStat >= AbortErrLev
+   end function Failed
+end subroutine
+
+!> ModGlue_CalcJacobians_OP calculates the module Jacobians, the operating point, and the mesh-mapping Jacobians
+!! at the current operating point of the turbine. It does not write anything to file, so it can be called for
+!! several copies of the turbine at once.
+subroutine ModGlue_CalcJacobians_OP(m, y_FAST, t_global, Turbine, ErrStat, ErrMsg)
+
+   type(Glue_MiscVarType), intent(inout)     :: m        !< Glue MiscVars
+   type(FAST_OutputFileType), intent(inout)  :: y_FAST
+   real(DbKi), intent(IN)                    :: t_global !< current (global) simulation time
+   type(FAST_TurbineType), intent(inout)     :: Turbine  !< Turbine type
+   integer(IntKi), intent(out)               :: ErrStat
+   character(*), intent(out)                 :: ErrMsg
 
-   ! Initialize the index numbers
-   ix = 1
-   iz = 1
-   iu = 1
-   iy = 1
+   character(*), parameter                   :: RoutineName = 'ModGlue_CalcJacobians_OP'
+   integer(IntKi)                            :: ErrStat2
+   character(ErrMsgLen)                      :: ErrMsg2
+   integer(IntKi)                            :: i
+   integer(IntKi), parameter                 :: iED = 1
+
+   ! Initialize error return
+   ErrStat = ErrID_None
+   ErrMsg = ""
+
+   ! Get parameters
+   y_FAST%Lin%RotSpeed = Turbine%ED%y(iED)%RotSpeed
+   y_FAST%Lin%Azimuth = Turbine%ED%y(iED)%LSSTipPxa
 
    ! Initialize data in Jacobian matrices to zero
    if (allocated(m%ModGlue%Lin%dYdu)) m%ModGlue%Lin%dYdu = 0.0_R8Ki
@@ -1004,31 +1014,13 @@ subroutine ModGlue_Linearize_OP(p, m, y, p_FAST, m_FAST, y_FAST, t_global, Turbi
                          dx_op=ModData%Lin%dx, dx_glue=m%ModGlue%Lin%dx)
          if (Failed()) return
 
-         ! If requested, write the module linearization matrices was requested
-         if (p_FAST%LinOutMod) then
-            call ModGlue_CalcWriteLinearMatrices(ModData%Vars, ModData%Lin, p_FAST, y_FAST, t_global, Un, &
-                                         LinRootName, VF_Linearize, ErrStat2, ErrMsg2, ModSuffix=ModData%Abbr)
-            if (Failed()) return
-         end if
-
       end associate
    end do
 
-   ! Copy arrays into linearization operating points
-   if (allocated(m%ModGlue%Lin%x)) y%Lin%x(:, m%Lin%TimeIndex) = m%ModGlue%Lin%x
-   if (allocated(m%ModGlue%Lin%u)) y%Lin%u(:, m%Lin%TimeIndex) = m%ModGlue%Lin%u
-
    ! Linearize mesh mappings to populate dUdy and dUdu
    call FAST_LinearizeMappings(m%ModGlue, m%Mappings, Turbine, ErrStat2, ErrMsg2)
    if (Failed()) return
 
-   ! Write glue code matrices to file
-   call ModGlue_CalcWriteLinearMatrices(m%ModGlue%Vars, m%ModGlue%Lin, p_FAST, y_FAST, t_global, Un, LinRootName, VF_Linearize, ErrStat2, ErrMsg2)
-   if (Failed()) return
-
-   ! Update index for next linearization time
-   m%Lin%TimeIndex = m%Lin%TimeIndex + 1
-
 contains
    logical function JacobianHasNaNs(Jac, label, abbr)
       real(R8Ki), allocatable, intent(in) :: Jac(:, :)
@@ -1047,6 +1039,79 @@ contains
    end function Failed
 end subroutine
 
+!> ModGlue_WriteLinearization_OP writes the module and glue-code linearization files for the Jacobians calculated
+!! by ModGlue_CalcJacobians_OP, stores the operating point, and advances the linearization index. If CalcGlue is
+!! false, the glue-code state matrices must already have been calculated with CalcGlueStateMatrices.
+subroutine ModGlue_WriteLinearization_OP(m, y, p_FAST, y_FAST, t_global, Turbine, CalcGlue, ErrStat, ErrMsg)
+
+   type(Glue_MiscVarType), intent(inout)     :: m        !< Glue MiscVars
+   type(Glue_OutputFileType), intent(inout)  :: y        !< Glue Output
+   type(FAST_ParameterType), intent(in)      :: p_FAST
+   type(FAST_OutputFileType), intent(in)     :: y_FAST
+   real(DbKi), intent(IN)                    :: t_global !< current (global) simulation time
+   type(FAST_TurbineType), intent(in)        :: Turbine  !< Turbine type
+   logical, intent(in)                       :: CalcGlue !< Calculate the glue-code state matrices before writing them
+   integer(IntKi), intent(out)               :: ErrStat
+   character(*), intent(out)                 :: ErrMsg
+
+   character(*), parameter                   :: RoutineName = 'ModGlue_WriteLinearization_OP'
+   integer(IntKi)                            :: ErrStat2
+   character(ErrMsgLen)                      :: ErrMsg2
+   integer(IntKi)                            :: i
+   integer(IntKi)                            :: Un
+   integer(IntKi), parameter                 :: iED = 1
+   character(200)                            :: SimStr
+   character(MaxWrScrLen)                    :: BlankLine
+   character(1024)                           :: LinRootName
+   character(*), parameter                   :: Fmt = 'F10.2'
+
+   ! Initialize error return
+   ErrStat = ErrID_None
+   ErrMsg = ""
+
+   ! Write message to screen
+   BlankLine = ""
+   call WrOver(BlankLine)  ! BlankLine contains MaxWrScrLen spaces
+   SimStr = '(RotSpeed='//trim(Num2LStr(Turbine%ED%y(iED)%RotSpeed*RPS2RPM, Fmt))//' rpm, BldPitch1='//trim(Num2LStr(Turbine%ED%y(iED)%BlPitch(1)*R2D, Fmt))//' deg)'
+   call WrOver(' Performing linearization '//trim(Num2LStr(m%Lin%TimeIndex))//' at simulation time '//TRIM(Num2LStr(t_global))//' s. '//trim(SimStr))
+   call WrScr('')
+
+   ! Assemble linearization root file name
+   LinRootName = trim(p_FAST%OutFileRoot)//'.'//trim(Num2LStr(m%Lin%TimeIndex))
+
+   ! Get unit number for writing files
+   call GetNewUnit(Un, ErrStat2, ErrMsg2); if (Failed()) return
+
+   ! If requested, write the module linearization matrices
+   if (p_FAST%LinOutMod) then
+      do i = 1, size(m%ModGlue%ModData)
+         associate (ModData => m%ModGlue%ModData(i))
+            call ModGlue_CalcWriteLinearMatrices(ModData%Vars, ModData%Lin, p_FAST, y_FAST, t_global, Un, &
+                                         LinRootName, VF_Linearize, ErrStat2, ErrMsg2, ModSuffix=ModData%Abbr)
+            if (Failed()) return
+         end associate
+      end do
+   end if
+
+   ! Copy arrays into linearization operating points
+   if (allocated(m%ModGlue%Lin%x)) y%Lin%x(:, m%Lin%TimeIndex) = m%ModGlue%Lin%x
+   if (allocated(m%ModGlue%Lin%u)) y%Lin%u(:, m%Lin%TimeIndex) = m%ModGlue%Lin%u
+
+   ! Write glue code matrices to file
+   call ModGlue_CalcWriteLinearMatrices(m%ModGlue%Vars, m%ModGlue%Lin, p_FAST, y_FAST, t_global, Un, LinRootName, VF_Linearize, ErrStat2, ErrMsg2, &
+                                        CalcGlue=CalcGlue)
+   if (Failed()) return
+
+   ! Update index for next linearization time
+   m%Lin%TimeIndex = m%Lin%TimeIndex + 1
+
+contains
+   logical function Failed()
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      Failed = ErrStat >= AbortErrLev
+   end function Failed
+end subroutine
+
 subroutine ModGlue_SaveOperatingPoint(p, m, OPIndex, NewCopy, Turbine, ErrStat, ErrMsg)
    type(Glue_ParameterType), intent(in)   :: p
    type(Glue_MiscVarType), intent(inout)  :: m
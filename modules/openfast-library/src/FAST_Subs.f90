@@ -54,6 +54,7 @@ MODULE FAST_Subs
                        TrimCase_pitch, &
                        TrimCase_torque, &
                        TrimCase_yaw
+!$ use OMP_LIB
 
    IMPLICIT NONE
 
@@ -180,6 +181,8 @@ SUBROUTINE FAST_InitializeAll( t_initial, m_Glue, p_FAST, y_FAST, m_FAST, ED, SE
    y_FAST%UnSum = -1                                                    ! set the summary file unit to -1 to indicate it's not open
    y_FAST%UnOu  = -1                                                    ! set the text output file unit to -1 to indicate it's not open
    y_FAST%UnGra = -1                                                    ! set the binary graphics output file unit to -1 to indicate it's not open
+   y_FAST%UnOuBin = -1                                                  ! set the streamed binary output file unit to -1 to indicate it's not open
+   y_FAST%BinStreamFile = ''                                            ! binary output is not streamed unless set in FAST_InitOutput
 
    p_FAST%WrVTK = VTK_Unknown                                           ! set this so that we can potentially output VTK information on initialization error
    p_FAST%VTK_tWidth = 1                                                ! initialize in case of error before reading the full file
@@ -187,6 +190,7 @@ SUBROUTINE FAST_InitializeAll( t_initial, m_Glue, p_FAST, y_FAST, m_FAST, ED, SE
    y_FAST%VTK_LastWaveIndx = 1                                          ! Start looking for wave data at the first index
    y_FAST%VTK_count = 0                                                 ! first VTK file has 0 as output
    y_FAST%n_Out = 0                                                     ! set the number of ouptut channels to 0 to indicate there's nothing to write to the binary file
+   y_FAST%n_OutFile = 0                                                 ! nothing has been written to the streamed binary file
 
       ! Get the current time
    CALL DATE_AND_TIME ( Values=m_FAST%StrtTime )                        ! Let's time the whole simulation
@@ -2197,6 +2201,7 @@ SUBROUTINE FAST_InitOutput( p_FAST, y_FAST, Init, ErrStat, ErrMsg )
    INTEGER(IntKi)                                :: indxNext   ! The index of the next value to be written to an array
    INTEGER(IntKi)                                :: NumOuts    ! number of channels to be written to the output file(s)
    character(10)                                 :: Prefix     ! Output header prefix
+   CHARACTER(LEN(y_FAST%FileDescLines)*3)        :: FileDesc   ! The description of the run, to be written in the binary output file
 
    !......................................................
    ! Set the description lines to be printed in the output file
@@ -2636,6 +2641,23 @@ SUBROUTINE FAST_InitOutput( p_FAST, y_FAST, Init, ErrStat, ErrMsg )
 
       WRITE (y_FAST%UnOu,'()')
 
+         !......................................................
+         ! Allocate the buffer of rows that are written to the file in blocks of TxtOutBufSteps lines:
+         !......................................................
+
+         ! one row is time followed by the individual module outputs (converted to SiKi); the outer group lets format reversion start each row with time
+      IF ( NumOuts > 1 ) THEN
+         y_FAST%TxtOutFmt = '(1('//TRIM(p_FAST%OutFmt_t)//','//TRIM(Num2LStr(NumOuts-1))//'("'//p_FAST%Delim//'",'//TRIM(p_FAST%OutFmt)//')))'
+      ELSE
+         y_FAST%TxtOutFmt = '(1('//TRIM(p_FAST%OutFmt_t)//'))'
+      END IF
+
+      CALL AllocAry( y_FAST%TxtOutBuf, NumOuts-1, TxtOutBufSteps, 'TxtOutBuf', ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+      CALL AllocAry( y_FAST%TxtOutTime, TxtOutBufSteps, 'TxtOutTime', ErrStat, ErrMsg )
+      IF ( ErrStat >= AbortErrLev ) RETURN
+      y_FAST%n_TxtOut = 0
+
    END IF
 
    !......................................................
@@ -2647,6 +2669,17 @@ SUBROUTINE FAST_InitOutput( p_FAST, y_FAST, Init, ErrStat, ErrMsg )
       !IF (p_FAST%CompAeroMaps) y_FAST%NOutSteps = p_FAST%NumTSR * p_FAST%NumPitch
       y_FAST%NOutSteps = CEILING ( (p_FAST%TMax - p_FAST%TStart) / p_FAST%DT_OUT ) + 1
 
+         ! Unless checkpoint files will be written (which must contain all of the data needed to write the binary file on restart), 
+         ! the outputs are streamed to the binary file in chunks of BinOutChunkSteps steps instead of being stored until the end of the simulation:
+      IF ( p_FAST%n_ChkptTime > p_FAST%n_TMax_m1 .AND. p_FAST%WrBinMod /= FileFmtID_WithTime ) THEN
+         y_FAST%NOutSteps = MIN( y_FAST%NOutSteps, BinOutChunkSteps )
+         IF ( p_FAST%WrBinMod == FileFmtID_NoCompressWithoutTime ) THEN
+            y_FAST%BinStreamFile = TRIM(p_FAST%OutFileRoot)//'.outb'
+         ELSE
+            y_FAST%BinStreamFile = TRIM(p_FAST%OutFileRoot)//'.outb.tmp'   ! uncompressed data, converted to the packed format at the end of the simulation
+         END IF
+      END IF
+
       CALL AllocAry( y_FAST%AllOutData, NumOuts-1, y_FAST%NOutSteps, 'AllOutData', ErrStat, ErrMsg ) ! this does not include the time channel (or case number for steady-state solve)
       IF ( ErrStat >= AbortErrLev ) RETURN
       y_FAST%AllOutData = 0.0_ReKi
@@ -2662,7 +2695,15 @@ SUBROUTINE FAST_InitOutput( p_FAST, y_FAST, Init, ErrStat, ErrMsg )
          y_FAST%TimeData(2) = p_FAST%DT_out      ! This is the (constant) time between subsequent writes to the output file
       END IF
 
-      y_FAST%n_Out = 0  !number of steps actually written to the file
+      y_FAST%n_Out = 0  !number of steps stored in AllOutData
+      y_FAST%n_OutFile = 0  !number of steps actually written to the file
+
+      IF ( LEN_TRIM(y_FAST%BinStreamFile) > 0 ) THEN
+         FileDesc = TRIM(y_FAST%FileDescLines(1))//' '//TRIM(y_FAST%FileDescLines(2))//'; '//TRIM(y_FAST%FileDescLines(3))
+         CALL WrBinFAST_Open( y_FAST%BinStreamFile, TRIM(FileDesc), y_FAST%ChannelNames, y_FAST%ChannelUnits, y_FAST%TimeData, &
+                              y_FAST%UnOuBin, ErrStat, ErrMsg )
+         IF ( ErrStat >= AbortErrLev ) RETURN
+      END IF
 
    END IF
 
@@ -3236,10 +3277,13 @@ SUBROUTINE FAST_ReadPrimaryFile( InputFile, p, m_FAST, OverrideAbortErrLev, ErrS
       !! | 5            | Text and uncompressed binary files                                   |
       !! | 6  => 4      | Binary (not written) and uncompressed binary files; same as 4        |
       !! | 7  => 5      | Text, Binary (not written), and uncompressed binary files; same as 5 |
+      !! | 8            | columnar binary file `<RootName>.outb`                               |
+      !! | 9            | Text and columnar binary files                                       |
+      !! | 10-15        | Text (if odd) and columnar binary files; other binary files are not written |
       !!
 
       ! OutFileFmt - Format for tabular (time-marching) output file(s) (1: text file [<RootName>.out], 2: binary file [<RootName>.outb], 3: both) (-):
-   CALL ReadVar( UnIn, InputFile, OutFileFmt, "OutFileFmt", "Format for tabular (time-marching) output file(s) {0: uncompressed binary and text file, 1: text file [<RootName>.out], 2: compressed binary file [<RootName>.outb], 3: both text and compressed binary, 4: uncompressed binary <RootName>.outb]; add for combinations) (-)", ErrStat2, ErrMsg2, UnEc)
+   CALL ReadVar( UnIn, InputFile, OutFileFmt, "OutFileFmt", "Format for tabular (time-marching) output file(s) {0: uncompressed binary and text file, 1: text file [<RootName>.out], 2: compressed binary file [<RootName>.outb], 3: both text and compressed binary, 4: uncompressed binary <RootName>.outb], 8: columnar binary <RootName>.outb]; add for combinations) (-)", ErrStat2, ErrMsg2, UnEc)
       if (Failed()) return
 
      if (OutFileFmt == 0) OutFileFmt = 5
@@ -3264,10 +3308,21 @@ SUBROUTINE FAST_ReadPrimaryFile( InputFile, p, m_FAST, OverrideAbortErrLev, ErrS
          p%WrBinMod = FileFmtID_ChanLen_In               ! A format specifier for the binary output file format (4=don't include time channel; do include channel width; do pack data)
       end if
 
+      OutFileFmt = OutFileFmt / 2 ! integer division
+      if (mod(OutFileFmt,2) == 1) then
+         ! The columnar binary file stores each channel in a contiguous block, so that post-processors can read individual channels without reading the whole file.
+         if (p%WrBinOutFile) then
+            call SetErrStat(ErrID_Warn,'Row-ordered binary file will not be generated because the columnar version was also requested.', ErrStat, ErrMsg, RoutineName)
+         else
+            p%WrBinOutFile = .true.
+         end if
+         p%WrBinMod = FileFmtID_Columnar                 ! A format specifier for the binary output file format (5=don't include time channel; store each channel in a contiguous, losslessly compressed block)
+      end if
+
       OutFileFmt = OutFileFmt / 2 ! integer division
 
       if (OutFileFmt /= 0) then
-         call SetErrStat( ErrID_Fatal, "OutFileFmt must be 0, 1, 2, 3, 4, or 5.",ErrStat,ErrMsg,RoutineName)
+         call SetErrStat( ErrID_Fatal, "OutFileFmt must be between 0 and 15.",ErrStat,ErrMsg,RoutineName)
          call cleanup()
          return
       end if
@@ -5233,9 +5288,11 @@ SUBROUTINE FAST_AdvanceToNextTimeStep_T(t_initial, n_t_global, Turbine, ErrStat,
    call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
    if (ErrStat >= AbortErrLev) return
 
-   ! Copy the final predicted states from step t_global_next to actual states for that step
+   ! Make the final predicted states from step t_global_next the actual states for that step.
+   ! The states are swapped rather than copied; the predicted states are reset from the
+   ! current states before they are updated in the next step.
    do i = 1, size(Turbine%m_Glue%ModData)
-      call FAST_CopyStates(Turbine%m_Glue%ModData(i), Turbine, STATE_PRED, STATE_CURR, MESH_UPDATECOPY, ErrStat2, ErrMsg2)
+      call FAST_SwapStates(Turbine%m_Glue%ModData(i), Turbine, STATE_CURR, STATE_PRED, ErrStat2, ErrMsg2)
       call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
       if (ErrStat >= AbortErrLev) return
    end do
@@ -5414,9 +5471,6 @@ SUBROUTINE WrOutputLine( t, p_FAST, y_FAST, IfWOutput, ExtInfwOutput, y_ED, SEDO
 
       ! Local variables.
 
-   CHARACTER(200)                   :: Frmt                                      ! A string to hold a format specifier
-   CHARACTER(p_FAST%TChanLen)       :: TmpStr                                    ! temporary string to print the time output as text
-
    REAL(ReKi)                       :: OutputAry(SIZE(y_FAST%ChannelNames)-1)
 
    ErrStat = ErrID_None
@@ -5425,22 +5479,35 @@ SUBROUTINE WrOutputLine( t, p_FAST, y_FAST, IfWOutput, ExtInfwOutput, y_ED, SEDO
    CALL FillOutputAry(p_FAST, y_FAST, IfWOutput, ExtInfwOutput, y_ED, SEDOutput, y_AD, ADskOutput, y_SrvD, SeaStOutput, HDOutput, SDOutput, ExtPtfmOutput, &
                       MAPOutput, FEAMOutput, MDOutput, OrcaOutput, IceFOutput, y_IceD, SlDOutput, y_BD, OutputAry)
 
-   IF (p_FAST%WrTxtOutFile) THEN
+   CALL WrOutputAry( t, p_FAST, y_FAST, OutputAry, ErrStat, ErrMsg )
 
-         ! Write one line of tabular output:
-   !   Frmt = '(F8.3,'//TRIM(Num2LStr(p%NumOuts))//'(:,A,'//TRIM( p%OutFmt )//'))'
-      Frmt = '"'//p_FAST%Delim//'"'//p_FAST%OutFmt      ! format for array elements from individual modules
+END SUBROUTINE WrOutputLine
+!----------------------------------------------------------------------------------------------------------------------------------
+!> This routine writes one line of outputs that have already been collected with FillOutputAry to the primary output file(s).
+SUBROUTINE WrOutputAry( t, p_FAST, y_FAST, OutputAry, ErrStat, ErrMsg )
 
-            ! time
-      WRITE( TmpStr, '('//trim(p_FAST%OutFmt_t)//')' ) t
-      CALL WrFileNR( y_FAST%UnOu, TmpStr )
+   REAL(DbKi),               INTENT(IN)    :: t                                  !< Current simulation time, in seconds
+   TYPE(FAST_ParameterType), INTENT(IN)    :: p_FAST                             !< Glue-code simulation parameters
+   TYPE(FAST_OutputFileType),INTENT(INOUT) :: y_FAST                             !< Glue-code simulation outputs
+   REAL(ReKi),               INTENT(IN)    :: OutputAry(:)                       !< Output channel values (without time)
+   INTEGER(IntKi),           INTENT(OUT)   :: ErrStat                            !< Error status
+   CHARACTER(*),             INTENT(OUT)   :: ErrMsg                             !< Error message
 
-         ! write the individual module output (convert to SiKi if necessary, so that we don't need to print so many digits in the exponent)
-      CALL WrNumAryFileNR ( y_FAST%UnOu, REAL(OutputAry,SiKi), Frmt, ErrStat, ErrMsg )
-         !IF ( ErrStat >= AbortErrLev ) RETURN
+   ErrStat = ErrID_None
+   ErrMsg  = ''
 
-         ! write a new line (advance to the next line)
-      WRITE (y_FAST%UnOu,'()')
+   IF (p_FAST%WrTxtOutFile) THEN
+
+         ! Store one line of tabular output (convert to SiKi if necessary, so that we don't need to print so many digits in the exponent)
+      y_FAST%n_TxtOut = y_FAST%n_TxtOut + 1
+      y_FAST%TxtOutTime(y_FAST%n_TxtOut)  = t
+      y_FAST%TxtOutBuf(:,y_FAST%n_TxtOut) = REAL(OutputAry,SiKi)
+
+         ! write the stored lines when the buffer is full
+      IF ( y_FAST%n_TxtOut == SIZE(y_FAST%TxtOutTime) ) THEN
+         CALL WrOutputTxtBuf( y_FAST, ErrStat, ErrMsg )
+            !IF ( ErrStat >= AbortErrLev ) RETURN
+      END IF
 
    END IF
 
@@ -5459,19 +5526,51 @@ SUBROUTINE WrOutputLine( t, p_FAST, y_FAST, IfWOutput, ExtInfwOutput, y_ED, SEDO
          y_FAST%n_Out = y_FAST%n_Out + 1
 
             ! store time data
-         IF ( y_FAST%n_Out == 1_IntKi .OR. p_FAST%WrBinMod == FileFmtID_WithTime ) THEN
+         IF ( (y_FAST%n_Out == 1_IntKi .AND. y_FAST%n_OutFile == 0_IntKi) .OR. p_FAST%WrBinMod == FileFmtID_WithTime ) THEN
             y_FAST%TimeData(y_FAST%n_Out) = t   ! Time associated with these outputs
          END IF
 
             ! store individual module data
          y_FAST%AllOutData(:, y_FAST%n_Out) = OutputAry
 
+            ! write a full chunk of data to the streamed binary file
+         IF ( y_FAST%UnOuBin > 0 .AND. y_FAST%n_Out == y_FAST%NOutSteps ) THEN
+            CALL WrBinFAST_Append( y_FAST%UnOuBin, y_FAST%TimeData, y_FAST%AllOutData, y_FAST%n_OutFile, ErrStat, ErrMsg )
+            y_FAST%n_Out = 0
+         END IF
+
       END IF
 
    END IF
 
    RETURN
-END SUBROUTINE WrOutputLine
+END SUBROUTINE WrOutputAry
+!----------------------------------------------------------------------------------------------------------------------------------
+!> Routine that writes the lines of tabular output stored in y_FAST%TxtOutBuf to the text output file with a single WRITE statement
+!! and empties the buffer.
+SUBROUTINE WrOutputTxtBuf( y_FAST, ErrStat, ErrMsg )
+
+   TYPE(FAST_OutputFileType),INTENT(INOUT) :: y_FAST                    !< FAST Output
+   INTEGER(IntKi),           INTENT(OUT)   :: ErrStat                   !< Error status
+   CHARACTER(*),             INTENT(OUT)   :: ErrMsg                    !< Error message
+
+      ! Local variables.
+   INTEGER(IntKi)                   :: i                                         ! loop counter over the stored lines
+
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+
+   IF ( y_FAST%n_TxtOut < 1 .OR. y_FAST%UnOu < 1 ) RETURN
+
+   WRITE( y_FAST%UnOu, y_FAST%TxtOutFmt, IOSTAT=ErrStat ) ( y_FAST%TxtOutTime(i), y_FAST%TxtOutBuf(:,i), i=1,y_FAST%n_TxtOut )
+   IF ( ErrStat /= 0 ) THEN
+      ErrMsg  = 'WrOutputTxtBuf:Error '//TRIM(Num2LStr(ErrStat))//' occurred while writing to file using this format: '//TRIM(y_FAST%TxtOutFmt)
+      ErrStat = ErrID_Fatal
+   END IF
+
+   y_FAST%n_TxtOut = 0
+
+END SUBROUTINE WrOutputTxtBuf
 !----------------------------------------------------------------------------------------------------------------------------------
 !> Routine that calls FillOutputAry for one instance of a Turbine data structure. This is a separate subroutine so that the FAST
 !! driver programs do not need to change or operate on the individual module level. (Called from Simulink interface.)
@@ -6720,6 +6819,7 @@ SUBROUTINE FAST_Linearize_T(t_initial, n_t_global, Turbine, ErrStat, ErrMsg)
    REAL(DbKi)                              :: next_lin_time       ! next simulation time where linearization analysis should be performed
    INTEGER(IntKi)                          :: iLinTime            ! loop counter
    INTEGER(IntKi)                          :: i                   ! loop counter
+   INTEGER(IntKi)                          :: NumThreads          ! number of OpenMP threads
 
 
    ErrStat = ErrID_None
@@ -6780,37 +6880,53 @@ SUBROUTINE FAST_Linearize_T(t_initial, n_t_global, Turbine, ErrStat, ErrMsg)
             Turbine%p_FAST%NLinTimes = 1
          endif
 
-         ! Loop through linearization times
-         do iLinTime = 1, Turbine%p_FAST%NLinTimes
+         ! Number of OpenMP threads available for linearizing the operating points
+         NumThreads = 1
+         !$ NumThreads = omp_get_max_threads()
 
-            ! Set global time to saved linearization time
-            t_global = Turbine%y_Glue%Lin%Times(iLinTime)
+         ! If more than one thread is available and all modules can be copied, linearize the
+         ! operating points concurrently; otherwise, linearize them one after another
+         if (NumThreads > 1 .and. Turbine%p_FAST%NLinTimes > 1 .and. LinearizeOPsInParallel(Turbine)) then
 
-            ! Restore operating point so linearization can be performed
-            call ModGlue_RestoreOperatingPoint(Turbine%p_Glue, Turbine%m_Glue, iLinTime, Turbine, ErrStat2, ErrMsg2)
-               CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-               IF (ErrStat >= AbortErrLev) RETURN
-
-            ! Calculate outputs using restored operating points
-            do i = 1, size(Turbine%m_Glue%ModData)
-               call FAST_CalcOutput(Turbine%m_Glue%ModData(i), Turbine%m_Glue%Mappings, &
-                                    t_global, INPUT_CURR, STATE_CURR, Turbine, ErrStat2, ErrMsg2)
+            call FAST_LinearizeOPsParallel(Turbine, min(NumThreads, Turbine%p_FAST%NLinTimes), ErrStat2, ErrMsg2)
                call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
                if (ErrStat >= AbortErrLev) return
-            end do
-            ! call CalcOutputs_And_SolveForInputs(Turbine%p_Glue%TC, Turbine%m_Glue%TC, &
-            !                                     Turbine%m_Glue%ModData, Turbine%m_Glue%Mappings, &
-            !                                     t_global, INPUT_CURR, STATE_CURR, Turbine, ErrStat2, ErrMsg2)
-            !    call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-            !    if (ErrStat >= AbortErrLev) return
 
-            ! Linearize at operating points
-            call ModGlue_Linearize_OP(Turbine%p_Glue, Turbine%m_Glue, Turbine%y_Glue, &
-               Turbine%p_FAST, Turbine%m_FAST, Turbine%y_FAST, t_global, Turbine, ErrStat2, ErrMsg2)
-               call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
-               if (ErrStat >= AbortErrLev) return
+         else
 
-         end do
+            ! Loop through linearization times
+            do iLinTime = 1, Turbine%p_FAST%NLinTimes
+
+               ! Set global time to saved linearization time
+               t_global = Turbine%y_Glue%Lin%Times(iLinTime)
+
+               ! Restore operating point so linearization can be performed
+               call ModGlue_RestoreOperatingPoint(Turbine%p_Glue, Turbine%m_Glue, iLinTime, Turbine, ErrStat2, ErrMsg2)
+                  CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+                  IF (ErrStat >= AbortErrLev) RETURN
+
+               ! Calculate outputs using restored operating points
+               do i = 1, size(Turbine%m_Glue%ModData)
+                  call FAST_CalcOutput(Turbine%m_Glue%ModData(i), Turbine%m_Glue%Mappings, &
+                                       t_global, INPUT_CURR, STATE_CURR, Turbine, ErrStat2, ErrMsg2)
+                  call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+                  if (ErrStat >= AbortErrLev) return
+               end do
+               ! call CalcOutputs_And_SolveForInputs(Turbine%p_Glue%TC, Turbine%m_Glue%TC, &
+               !                                     Turbine%m_Glue%ModData, Turbine%m_Glue%Mappings, &
+               !                                     t_global, INPUT_CURR, STATE_CURR, Turbine, ErrStat2, ErrMsg2)
+               !    call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+               !    if (ErrStat >= AbortErrLev) return
+
+               ! Linearize at operating points
+               call ModGlue_Linearize_OP(Turbine%p_Glue, Turbine%m_Glue, Turbine%y_Glue, &
+                  Turbine%p_FAST, Turbine%m_FAST, Turbine%y_FAST, t_global, Turbine, ErrStat2, ErrMsg2)
+                  call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+                  if (ErrStat >= AbortErrLev) return
+
+            end do
+
+         end if
 
          ! If mode shape VTKs were requested, write checkpoint file
          if (Turbine%p_FAST%WrVTK == VTK_ModeShapes) then
@@ -6832,6 +6948,180 @@ SUBROUTINE FAST_Linearize_T(t_initial, n_t_global, Turbine, ErrStat, ErrMsg)
 
 END SUBROUTINE FAST_Linearize_T
 !----------------------------------------------------------------------------------------------------------------------------------
+!> Returns true if the operating points saved by the steady-state calculation can be linearized concurrently on copies of the
+!! turbine data. Modules that keep their state outside of the FAST data structures (DLLs, external codes, C libraries) cannot be
+!! copied, so those turbines are linearized serially.
+LOGICAL FUNCTION LinearizeOPsInParallel(Turbine)
+
+   TYPE(FAST_TurbineType),   INTENT(IN   ) :: Turbine             !< all data for one instance of a turbine
+
+   LinearizeOPsInParallel = .false.
+
+   if (Turbine%p_FAST%CompInflow == Module_ExtInfw) return
+   if (Turbine%p_FAST%CompAero == Module_ExtLd) return
+   if (Turbine%p_FAST%CompMooring == Module_MAP .or. Turbine%p_FAST%CompMooring == Module_Orca) return
+   if (Turbine%p_FAST%CompSoil == Module_SlD) return
+   if (Turbine%p_FAST%CompServo == Module_SrvD) then
+      if (allocated(Turbine%SrvD%p)) then
+         if (any(Turbine%SrvD%p%UseBladedInterface)) return
+      end if
+   end if
+
+   LinearizeOPsInParallel = .true.
+
+END FUNCTION LinearizeOPsInParallel
+!----------------------------------------------------------------------------------------------------------------------------------
+!> Routine that linearizes the operating points saved by the steady-state calculation concurrently. Each OpenMP thread works on
+!! its own copy of the turbine data: it restores an operating point, calculates the outputs, and computes the module and glue-code
+!! Jacobians. The linearization files are written in operating-point order, so they do not depend on the number of threads.
+SUBROUTINE FAST_LinearizeOPsParallel(Turbine, NumThreads, ErrStat, ErrMsg)
+
+   TYPE(FAST_TurbineType),   INTENT(INOUT) :: Turbine             !< all data for one instance of a turbine
+   INTEGER(IntKi),           INTENT(IN   ) :: NumThreads          !< number of threads (one turbine copy per thread)
+   INTEGER(IntKi),           INTENT(  OUT) :: ErrStat             !< Error status of the operation
+   CHARACTER(*),             INTENT(  OUT) :: ErrMsg              !< Error message if ErrStat /= ErrID_None
+
+   CHARACTER(*),             PARAMETER     :: RoutineName = 'FAST_LinearizeOPsParallel'
+   INTEGER(IntKi)                          :: ErrStat2            ! local error status
+   CHARACTER(ErrMsgLen)                    :: ErrMsg2             ! local error message
+   TYPE(FAST_TurbineType),   ALLOCATABLE   :: Tw(:)               ! turbine data for each thread
+   REAL(DbKi)                              :: t_global            ! saved linearization time
+   INTEGER(IntKi)                          :: TimeIndex           ! linearization index of the first operating point
+   INTEGER(IntKi)                          :: NLinTimes           ! number of operating points
+   INTEGER(IntKi)                          :: iLinTime            ! loop counter
+   INTEGER(IntKi)                          :: iThread             ! thread index
+   INTEGER(IntKi)                          :: i                   ! loop counter
+   LOGICAL                                 :: CalcGlue            ! calculate the glue-code state matrices while writing the file
+   LOGICAL                                 :: Aborted             ! has a fatal error occurred?
+
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   NLinTimes = Turbine%p_FAST%NLinTimes
+   TimeIndex = Turbine%m_Glue%Lin%TimeIndex
+
+   ! Give each thread its own copy of the turbine
+   allocate(Tw(NumThreads), stat=ErrStat2)
+   if (ErrStat2 /= 0) then
+      call SetErrStat(ErrID_Fatal, "Error allocating turbine data for linearization threads", ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   do i = 1, NumThreads
+      call FAST_CopyTurbineType(Turbine, Tw(i), MESH_NEWCOPY, ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) then
+            call Cleanup()
+            return
+         end if
+   end do
+
+   ! When the Jacobians are written to the file, dUdu and dUdy must be written before the glue-code state
+   ! matrices overwrite them, so the state matrices are calculated by the ordered writer; otherwise each
+   ! thread calculates them with its Jacobians
+   CalcGlue = Turbine%p_FAST%LinOutJac
+
+   Aborted = .false.
+
+   !$OMP PARALLEL DO ORDERED SCHEDULE(DYNAMIC) NUM_THREADS(NumThreads) DEFAULT(SHARED) PRIVATE(iLinTime, iThread, i, t_global, ErrStat2, ErrMsg2)
+   do iLinTime = 1, NLinTimes
+      iThread = 1
+      !$ iThread = omp_get_thread_num() + 1
+
+      ! Set global time to saved linearization time
+      t_global = Turbine%y_Glue%Lin%Times(iLinTime)
+
+      call LinearizeOP(Tw(iThread), iLinTime, t_global, ErrStat2, ErrMsg2)
+
+      ! Write the linearization files in operating-point order
+      !$OMP ORDERED
+      if (.not. Aborted) then
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         Aborted = ErrStat >= AbortErrLev
+      end if
+      if (.not. Aborted) then
+         Tw(iThread)%m_Glue%Lin%TimeIndex = TimeIndex + iLinTime - 1
+         call ModGlue_WriteLinearization_OP(Tw(iThread)%m_Glue, Turbine%y_Glue, Turbine%p_FAST, Tw(iThread)%y_FAST, &
+                                            t_global, Tw(iThread), CalcGlue, ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         Aborted = ErrStat >= AbortErrLev
+         Turbine%y_FAST%Lin = Tw(iThread)%y_FAST%Lin
+      end if
+      !$OMP END ORDERED
+   end do
+   !$OMP END PARALLEL DO
+
+   call Cleanup()
+   if (ErrStat >= AbortErrLev) return
+
+   ! Update index for next linearization time
+   Turbine%m_Glue%Lin%TimeIndex = TimeIndex + NLinTimes
+
+   ! Leave the turbine at the last operating point, as the serial linearization does
+   t_global = Turbine%y_Glue%Lin%Times(NLinTimes)
+   call ModGlue_RestoreOperatingPoint(Turbine%p_Glue, Turbine%m_Glue, NLinTimes, Turbine, ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      if (ErrStat >= AbortErrLev) return
+   do i = 1, size(Turbine%m_Glue%ModData)
+      call FAST_CalcOutput(Turbine%m_Glue%ModData(i), Turbine%m_Glue%Mappings, &
+                           t_global, INPUT_CURR, STATE_CURR, Turbine, ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      if (ErrStat >= AbortErrLev) return
+   end do
+
+contains
+   !> Restores operating point iOP in turbine copy T and calculates its Jacobians
+   subroutine LinearizeOP(T, iOP, t_global, ErrStat, ErrMsg)
+      TYPE(FAST_TurbineType),   INTENT(INOUT) :: T
+      INTEGER(IntKi),           INTENT(IN   ) :: iOP
+      REAL(DbKi),               INTENT(IN   ) :: t_global
+      INTEGER(IntKi),           INTENT(  OUT) :: ErrStat
+      CHARACTER(*),             INTENT(  OUT) :: ErrMsg
+      INTEGER(IntKi)                          :: ErrStat3
+      CHARACTER(ErrMsgLen)                    :: ErrMsg3
+      INTEGER(IntKi)                          :: j
+
+      ErrStat = ErrID_None
+      ErrMsg  = ""
+
+      ! Restore operating point so linearization can be performed
+      call ModGlue_RestoreOperatingPoint(T%p_Glue, T%m_Glue, iOP, T, ErrStat3, ErrMsg3)
+         call SetErrStat(ErrStat3, ErrMsg3, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+
+      ! Calculate outputs using restored operating points
+      do j = 1, size(T%m_Glue%ModData)
+         call FAST_CalcOutput(T%m_Glue%ModData(j), T%m_Glue%Mappings, &
+                              t_global, INPUT_CURR, STATE_CURR, T, ErrStat3, ErrMsg3)
+         call SetErrStat(ErrStat3, ErrMsg3, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+
+      ! Module and mesh-mapping Jacobians at this operating point
+      call ModGlue_CalcJacobians_OP(T%m_Glue, T%y_FAST, t_global, T, ErrStat3, ErrMsg3)
+         call SetErrStat(ErrStat3, ErrMsg3, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+
+      ! Glue-code state matrices
+      if (.not. CalcGlue) then
+         call CalcGlueStateMatrices(T%m_Glue%ModGlue%Vars, T%m_Glue%ModGlue%Lin, real(T%p_FAST%UJacSclFact, R8Ki), ErrStat3, ErrMsg3)
+            call SetErrStat(ErrStat3, ErrMsg3, ErrStat, ErrMsg, RoutineName)
+            if (ErrStat >= AbortErrLev) return
+      end if
+   end subroutine
+
+   subroutine Cleanup()
+      INTEGER(IntKi)                          :: ErrStat3
+      CHARACTER(ErrMsgLen)                    :: ErrMsg3
+      INTEGER(IntKi)                          :: j
+      if (.not. allocated(Tw)) return
+      do j = 1, size(Tw)
+         call FAST_DestroyTurbineType(Tw(j), ErrStat3, ErrMsg3)
+      end do
+      deallocate(Tw)
+   end subroutine
+END SUBROUTINE FAST_LinearizeOPsParallel
+!----------------------------------------------------------------------------------------------------------------------------------
 
 !++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 ! PROGRAM EXIT ROUTINES
@@ -7005,7 +7295,27 @@ SUBROUTINE FAST_EndOutput( p_FAST, y_FAST, m_FAST, ErrStat, ErrMsg )
    ! Write the binary output file if requested
    !-------------------------------------------------------------------------------------------------
 
-   IF (p_FAST%WrBinOutFile .AND. y_FAST%n_Out > 0) THEN
+   IF (p_FAST%WrBinOutFile .AND. y_FAST%UnOuBin > 0) THEN
+
+      FileDesc = TRIM(y_FAST%FileDescLines(1))//' '//TRIM(y_FAST%FileDescLines(2))//'; '//TRIM(y_FAST%FileDescLines(3))
+
+         ! write the last (partial) chunk of data and finish the streamed file
+      IF ( y_FAST%n_Out > 0 ) THEN
+         CALL WrBinFAST_Append( y_FAST%UnOuBin, y_FAST%TimeData, y_FAST%AllOutData(:,1:y_FAST%n_Out), y_FAST%n_OutFile, ErrStat, ErrMsg )
+         y_FAST%n_Out = 0
+      END IF
+
+      IF ( ErrStat < AbortErrLev ) THEN
+         CALL WrBinFAST_Close( y_FAST%UnOuBin, TRIM(p_FAST%OutFileRoot)//'.outb', Int(p_FAST%WrBinMod, B2Ki), TRIM(FileDesc), &
+               y_FAST%ChannelNames, y_FAST%ChannelUnits, ErrStat, ErrMsg )
+      ELSE
+         CLOSE( y_FAST%UnOuBin )
+         y_FAST%UnOuBin = -1
+      END IF
+
+      IF ( ErrStat /= ErrID_None ) CALL WrScr( TRIM(GetErrStr(ErrStat))//' when writing binary output file: '//TRIM(ErrMsg) )
+
+   ELSEIF (p_FAST%WrBinOutFile .AND. y_FAST%n_Out > 0) THEN
 
       FileDesc = TRIM(y_FAST%FileDescLines(1))//' '//TRIM(y_FAST%FileDescLines(2))//'; '//TRIM(y_FAST%FileDescLines(3))
 
@@ -7021,6 +7331,8 @@ SUBROUTINE FAST_EndOutput( p_FAST, y_FAST, m_FAST, ErrStat, ErrMsg )
    ! Close the text tabular output file and summary file (if opened)
    !-------------------------------------------------------------------------------------------------
    IF (y_FAST%UnOu  > 0) THEN ! I/O unit number for the tabular output file
+      CALL WrOutputTxtBuf( y_FAST, ErrStat, ErrMsg ) ! write the lines that are still stored in memory
+      IF ( ErrStat /= ErrID_None ) CALL WrScr( TRIM(GetErrStr(ErrStat))//' when writing text output file: '//TRIM(ErrMsg) )
       CLOSE( y_FAST%UnOu )
       y_FAST%UnOu = -1
    END IF
@@ -7154,6 +7466,10 @@ SUBROUTINE FAST_CreateCheckpoint_T(t_initial, n_t_global, NumTurbines, Turbine,
 
    END IF
 
+   ! Write the lines of text output stored in memory so that they are not written again after a restart
+   call WrOutputTxtBuf(Turbine%y_FAST, ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+
    ! Initialize the registry file
    call InitRegFile(RF, unOut, ErrStat2, ErrMsg2)
       call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
@@ -7375,6 +7691,12 @@ SUBROUTINE FAST_RestoreFromCheckpoint_T(t_initial, n_t_global, NumTurbines, Turb
       endif
    END IF
 
+   IF (Turbine%y_FAST%UnOuBin > 0) THEN ! the binary output was being streamed when the checkpoint file was written
+      CALL WrBinFAST_Reopen( Turbine%y_FAST%BinStreamFile, Turbine%y_FAST%UnOuBin, ErrStat2, ErrMsg2 )
+      CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      IF ( ErrStat2 >= AbortErrLev ) RETURN
+   END IF
+
    ! (ignoring for now; will have fort.x files if any were open [though I printed a warning about not outputting binary files earlier])
 
 END SUBROUTINE FAST_RestoreFromCheckpoint_T
@@ -82,6 +82,8 @@ IMPLICIT NONE
     INTEGER(IntKi), PUBLIC, PARAMETER  :: NumModules                       = 22      ! The number of modules available in FAST [-]
     INTEGER(IntKi), PUBLIC, PARAMETER  :: MaxBladesBD                      = 3      ! Maximum number of blades allowed on a turbine [-]
     INTEGER(IntKi), PUBLIC, PARAMETER  :: IceD_MaxLegs                     = 4      ! because I don't know how many legs there are before calling IceD_Init and I don't want to copy the data because of sibling mesh issues, I'm going to allocate IceD based on this number [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: BinOutChunkSteps                 = 1000      ! Number of output steps stored in memory before they are written to the streamed binary output file [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: TxtOutBufSteps                   = 100      ! Number of output steps stored in memory before they are written to the text tabular output file [-]
     INTEGER(IntKi), PUBLIC, PARAMETER  :: SS_Indx_Pitch                    = 1      ! pitch [-]
     INTEGER(IntKi), PUBLIC, PARAMETER  :: SS_Indx_TSR                      = 2      ! TSR [-]
     INTEGER(IntKi), PUBLIC, PARAMETER  :: SS_Indx_WS                       = 3      ! wind speed [-]
@@ -268,11 +270,18 @@ IMPLICIT NONE
 ! =========  FAST_OutputFileType  =======
   TYPE, PUBLIC :: FAST_OutputFileType
     REAL(DbKi) , DIMENSION(:), ALLOCATABLE  :: TimeData      !< Array to contain the time output data for the binary file (first output time and a time [fixed] increment) [-]
-    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: AllOutData      !< Array to contain all the output data (time history of all outputs); Index 1 is NumOuts, Index 2 is Time step [-]
+    REAL(ReKi) , DIMENSION(:,:), ALLOCATABLE  :: AllOutData      !< Array to contain the output data that has not yet been written to the binary file (time history of all outputs); Index 1 is NumOuts, Index 2 is Time step [-]
     INTEGER(IntKi)  :: n_Out = 0_IntKi      !< Time index into the AllOutData array [-]
-    INTEGER(IntKi)  :: NOutSteps = 0_IntKi      !< Maximum number of output steps [-]
+    INTEGER(IntKi)  :: NOutSteps = 0_IntKi      !< Maximum number of output steps stored in AllOutData [-]
+    INTEGER(IntKi)  :: n_OutFile = 0_IntKi      !< Number of output steps already written to the streamed binary file [-]
+    INTEGER(IntKi)  :: UnOuBin = -1      !< I/O unit number for the streamed binary output file (-1 if the binary output is stored in AllOutData until the end of the simulation) [-]
+    CHARACTER(1024)  :: BinStreamFile      !< Name of the streamed binary output file [-]
     INTEGER(IntKi) , DIMENSION(1:NumModules)  :: numOuts = 0_IntKi      !< number of outputs to print from each module [-]
     INTEGER(IntKi)  :: UnOu = -1      !< I/O unit number for the tabular output file [-]
+    REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: TxtOutBuf      !< Rows of text tabular output that have not yet been written to the file; Index 1 is NumOuts, Index 2 is the row [-]
+    REAL(DbKi) , DIMENSION(:), ALLOCATABLE  :: TxtOutTime      !< Time associated with each row in TxtOutBuf [-]
+    INTEGER(IntKi)  :: n_TxtOut = 0_IntKi      !< Number of rows stored in TxtOutBuf [-]
+    CHARACTER(1024)  :: TxtOutFmt      !< Format used to write rows of TxtOutBuf to the text tabular output file [-]
     INTEGER(IntKi)  :: UnSum = -1      !< I/O unit number for the summary file [-]
     INTEGER(IntKi)  :: UnGra = -1      !< I/O unit number for mesh graphics [-]
     CHARACTER(1024) , DIMENSION(1:3)  :: FileDescLines      !< Description lines to include in output files (header, time run, plus module names/versions) [-]
@@ -1855,8 +1864,37 @@ subroutine FAST_CopyOutputFileType(SrcOutputFileTypeData, DstOutputFileTypeData,
    end if
    DstOutputFileTypeData%n_Out = SrcOutputFileTypeData%n_Out
    DstOutputFileTypeData%NOutSteps = SrcOutputFileTypeData%NOutSteps
+   DstOutputFileTypeData%n_OutFile = SrcOutputFileTypeData%n_OutFile
+   DstOutputFileTypeData%UnOuBin = SrcOutputFileTypeData%UnOuBin
+   DstOutputFileTypeData%BinStreamFile = SrcOutputFileTypeData%BinStreamFile
    DstOutputFileTypeData%numOuts = SrcOutputFileTypeData%numOuts
    DstOutputFileTypeData%UnOu = SrcOutputFileTypeData%UnOu
+   if (allocated(SrcOutputFileTypeData%TxtOutBuf)) then
+      LB(1:2) = lbound(SrcOutputFileTypeData%TxtOutBuf)
+      UB(1:2) = ubound(SrcOutputFileTypeData%TxtOutBuf)
+      if (.not. allocated(DstOutputFileTypeData%TxtOutBuf)) then
+         allocate(DstOutputFileTypeData%TxtOutBuf(LB(1):UB(1),LB(2):UB(2)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstOutputFileTypeData%TxtOutBuf.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstOutputFileTypeData%TxtOutBuf = SrcOutputFileTypeData%TxtOutBuf
+   end if
+   if (allocated(SrcOutputFileTypeData%TxtOutTime)) then
+      LB(1:1) = lbound(SrcOutputFileTypeData%TxtOutTime)
+      UB(1:1) = ubound(SrcOutputFileTypeData%TxtOutTime)
+      if (.not. allocated(DstOutputFileTypeData%TxtOutTime)) then
+         allocate(DstOutputFileTypeData%TxtOutTime(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstOutputFileTypeData%TxtOutTime.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstOutputFileTypeData%TxtOutTime = SrcOutputFileTypeData%TxtOutTime
+   end if
+   DstOutputFileTypeData%n_TxtOut = SrcOutputFileTypeData%n_TxtOut
+   DstOutputFileTypeData%TxtOutFmt = SrcOutputFileTypeData%TxtOutFmt
    DstOutputFileTypeData%UnSum = SrcOutputFileTypeData%UnSum
    DstOutputFileTypeData%UnGra = SrcOutputFileTypeData%UnGra
    DstOutputFileTypeData%FileDescLines = SrcOutputFileTypeData%FileDescLines
@@ -1919,6 +1957,12 @@ subroutine FAST_DestroyOutputFileType(OutputFileTypeData, ErrStat, ErrMsg)
    if (allocated(OutputFileTypeData%AllOutData)) then
       deallocate(OutputFileTypeData%AllOutData)
    end if
+   if (allocated(OutputFileTypeData%TxtOutBuf)) then
+      deallocate(OutputFileTypeData%TxtOutBuf)
+   end if
+   if (allocated(OutputFileTypeData%TxtOutTime)) then
+      deallocate(OutputFileTypeData%TxtOutTime)
+   end if
    if (allocated(OutputFileTypeData%ChannelNames)) then
       deallocate(OutputFileTypeData%ChannelNames)
    end if
@@ -1946,8 +1990,15 @@ subroutine FAST_PackOutputFileType(RF, Indata)
    call RegPackAlloc(RF, InData%AllOutData)
    call RegPack(RF, InData%n_Out)
    call RegPack(RF, InData%NOutSteps)
+   call RegPack(RF, InData%n_OutFile)
+   call RegPack(RF, InData%UnOuBin)
+   call RegPack(RF, InData%BinStreamFile)
    call RegPack(RF, InData%numOuts)
    call RegPack(RF, InData%UnOu)
+   call RegPackAlloc(RF, InData%TxtOutBuf)
+   call RegPackAlloc(RF, InData%TxtOutTime)
+   call RegPack(RF, InData%n_TxtOut)
+   call RegPack(RF, InData%TxtOutFmt)
    call RegPack(RF, InData%UnSum)
    call RegPack(RF, InData%UnGra)
    call RegPack(RF, InData%FileDescLines)
@@ -1981,8 +2032,15 @@ subroutine FAST_UnPackOutputFileType(RF, OutData)
    call RegUnpackAlloc(RF, OutData%AllOutData); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%n_Out); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%NOutSteps); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%n_OutFile); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%UnOuBin); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%BinStreamFile); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%numOuts); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%UnOu); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%TxtOutBuf); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%TxtOutTime); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%n_TxtOut); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%TxtOutFmt); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%UnSum); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%UnGra); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%FileDescLines); if (RegCheckErr(RF, RoutineName)) return
@@ -11,6 +11,9 @@ void gen_ExtrapInterp(std::ostream &w, const Module &mod, std::string type_name_
                       std::string type_kind, const bool useModPrefix);
 void gen_copy(std::ostream &w, const Module &mod, const DataType::Derived &ddt,
               const bool gen_c_code);
+void gen_swap(std::ostream &w, const Module &mod, const DataType::Derived &ddt,
+              const bool gen_c_code);
+void get_swap_types(const Module &mod, const DataType::Derived &ddt, std::set<std::string> &swap_types);
 void gen_destroy(std::ostream &w, const Module &mod, const DataType::Derived &ddt,
                  const bool gen_c_code);
 void gen_pack(std::ostream &w, const Module &mod, const DataType::Derived &ddt,
@@ -344,14 +347,28 @@ void Registry::gen_fortran_module(const Module &mod, const std::string &out_dir)
 
 void Registry::gen_fortran_subs(std::ostream &w, const Module &mod)
 {
+    // Find the input and state types of this module, and the types they contain,
+    // which get swap routines for rotating the time-level arrays in the glue code
+    std::set<std::string> swap_types;
+    for (auto &dt_name : mod.ddt_names)
+    {
+        auto &ddt = mod.data_types.find(dt_name)->second->derived;
+        if ((ddt.name_short.compare("Input") == 0) || (ddt.name_short.compare("ContState") == 0) ||
+            (ddt.name_short.compare("DiscState") == 0) || (ddt.name_short.compare("ConstrState") == 0) ||
+            (ddt.name_short.compare("OtherState") == 0))
+            get_swap_types(mod, ddt, swap_types);
+    }
+
     // Loop through derived data types
     for (auto &dt_name : mod.ddt_names)
     {
         // Get derived data type
         auto &ddt = mod.data_types.find(dt_name)->second->derived;
 
-        // Generate copy, destroy, pack, and unpack routines
+        // Generate copy, swap, destroy, pack, and unpack routines
         gen_copy(w, mod, ddt, this->gen_c_code);
+        if (swap_types.count(ddt.type_fortran) > 0)
+            gen_swap(w, mod, ddt, this->gen_c_code);
         gen_destroy(w, mod, ddt, this->gen_c_code);
         gen_pack(w, mod, ddt, this->gen_c_code);
         gen_unpack(w, mod, ddt, this->gen_c_code);
@@ -562,6 +579,204 @@ void gen_copy(std::ostream &w, const Module &mod, const DataType::Derived &ddt,
     w << indent;
 }
 
+void get_swap_types(const Module &mod, const DataType::Derived &ddt, std::set<std::string> &swap_types)
+{
+    // If type has already been added, return
+    if (!swap_types.insert(ddt.type_fortran).second)
+        return;
+
+    // Add derived types from this module that are owned by this type
+    for (auto &field : ddt.fields)
+    {
+        if (field.data_type->tag != DataType::Tag::Derived || field.is_pointer)
+            continue;
+        auto &field_ddt = field.data_type->derived;
+        if (field_ddt.module != nullptr && field_ddt.module->name.compare(mod.name) == 0)
+            get_swap_types(mod, field_ddt, swap_types);
+    }
+}
+
+// Declaration of a temporary variable that can hold the value of a field for swapping
+std::string swap_tmp_decl(const Field &field, const bool gen_c_code)
+{
+    std::string decl;
+    if (field.data_type->tag == DataType::Tag::Derived)
+        decl = "type(" + field.data_type->derived.type_fortran + ")";
+    else if (gen_c_code && field.is_pointer)
+        decl = field.data_type->c_types_binding();
+    else
+        decl = field.data_type->basic.type_fortran;
+
+    std::string dims("");
+    if (field.rank > 0)
+    {
+        for (int d = 0; d < field.rank; d++)
+        {
+            if (field.is_allocatable)
+                dims += (d > 0 ? ",:" : ":");
+            else
+                dims += (d > 0 ? "," : "") + field.dims[d].lower_bound + ":" + field.dims[d].upper_bound;
+        }
+        dims = "(" + dims + ")";
+    }
+
+    if (field.is_pointer)
+        decl += ", pointer";
+    else if (field.is_allocatable)
+        decl += ", allocatable";
+
+    return decl + " :: tmp_" + field.name + dims;
+}
+
+void gen_swap(std::ostream &w, const Module &mod, const DataType::Derived &ddt,
+              const bool gen_c_code)
+{
+    auto routine_name = mod.nickname + "_Swap" + ddt.name_short;
+    auto data1 = ddt.name_short + "Data1";
+    auto data2 = ddt.name_short + "Data2";
+    std::string indent("\n");
+
+    // Derived type fields are swapped element by element, except for pointers and DLL types
+    auto is_ddt_swap = [](const Field &f)
+    {
+        return f.data_type->tag == DataType::Tag::Derived && !f.is_pointer &&
+               f.data_type->derived.name_short.compare("DLL_Type") != 0;
+    };
+
+    bool has_ddt = std::any_of(ddt.fields.begin(), ddt.fields.end(), is_ddt_swap);
+    bool has_ddt_arr = std::any_of(ddt.fields.begin(), ddt.fields.end(), [&](Field f)
+                                   { return is_ddt_swap(f) && f.rank > 0; });
+
+    w << indent << "subroutine " << routine_name << "(" << data1 << ", " << data2 << ", ErrStat, ErrMsg)";
+    indent += "   ";
+    w << indent << "type(" << ddt.type_fortran << "), intent(inout) :: " << data1;
+    w << indent << "type(" << ddt.type_fortran << "), intent(inout) :: " << data2;
+    w << indent << "integer(IntKi),  intent(  out) :: ErrStat";
+    w << indent << "character(*),    intent(  out) :: ErrMsg";
+    if (has_ddt_arr)
+    {
+        w << indent << "integer(B4Ki)   :: ";
+        for (int i = 1; i <= ddt.max_rank; i++)
+            w << (i > 1 ? ", " : "") << "i" << i;
+        w << indent << "integer(B4Ki)                  :: LB(" << ddt.max_rank << "), UB(" << ddt.max_rank << ")";
+    }
+    if (has_ddt)
+    {
+        w << indent << "integer(IntKi)                 :: ErrStat2";
+        w << indent << "character(ErrMsgLen)           :: ErrMsg2";
+    }
+    for (auto &field : ddt.fields)
+    {
+        if (!is_ddt_swap(field))
+            w << indent << swap_tmp_decl(field, gen_c_code);
+    }
+    if (gen_c_code)
+        w << indent << "type(" << ddt.type_fortran << "_C) :: tmp_C_obj";
+    w << indent << "character(*), parameter        :: RoutineName = '" << routine_name << "'";
+    w << indent << "ErrStat = ErrID_None";
+    w << indent << "ErrMsg  = ''";
+
+    // Loop through fields
+    for (auto &field : ddt.fields)
+    {
+        std::string var1 = data1 + "%" + field.name;
+        std::string var2 = data2 + "%" + field.name;
+        std::string tmp = "tmp_" + field.name;
+
+        // Pointers exchange their targets
+        if (field.is_pointer)
+        {
+            w << indent << tmp << " => " << var1;
+            w << indent << var1 << " => " << var2;
+            w << indent << var2 << " => " << tmp;
+            continue;
+        }
+
+        // Allocatable arrays of intrinsic types exchange their allocations
+        if (field.is_allocatable && !is_ddt_swap(field))
+        {
+            w << indent << "call move_alloc(" << var1 << ", " << tmp << ")";
+            w << indent << "call move_alloc(" << var2 << ", " << var1 << ")";
+            w << indent << "call move_alloc(" << tmp << ", " << var2 << ")";
+            continue;
+        }
+
+        // Non-allocatable intrinsic types and DLL types exchange their values
+        if (!is_ddt_swap(field))
+        {
+            w << indent << tmp << " = " << var1;
+            w << indent << var1 << " = " << var2;
+            w << indent << var2 << " = " << tmp;
+            continue;
+        }
+
+        // Derived types (including meshes) are swapped element by element, so the
+        // arrays must have the same bounds
+        if (field.is_allocatable)
+        {
+            w << indent << "if (allocated(" << var1 << ") .neqv. allocated(" << var2 << ")) then";
+            w << indent << "   call SetErrStat(ErrID_Fatal, 'Cannot swap " << var1 << " with an array of different size.', ErrStat, ErrMsg, RoutineName)";
+            w << indent << "   return";
+            w << indent << "end if";
+            w << indent << "if (allocated(" << var1 << ")) then";
+            indent += "   ";
+            w << indent << "if (any(lbound(" << var1 << ") /= lbound(" << var2 << ")) .or. any(ubound(" << var1 << ") /= ubound(" << var2 << "))) then";
+            w << indent << "   call SetErrStat(ErrID_Fatal, 'Cannot swap " << var1 << " with an array of different size.', ErrStat, ErrMsg, RoutineName)";
+            w << indent << "   return";
+            w << indent << "end if";
+        }
+
+        if (field.rank > 0)
+        {
+            w << indent << "LB(1:" << field.rank << ") = lbound(" << var1 << ")";
+            w << indent << "UB(1:" << field.rank << ") = ubound(" << var1 << ")";
+        }
+        for (int d = field.rank; d >= 1; d--)
+        {
+            w << indent << "do i" << d << " = LB(" << d << "), UB(" << d << ")";
+            indent += "   ";
+        }
+
+        if (field.data_type->derived.name_short.compare("MeshType") == 0)
+        {
+            w << indent << "call MeshSwap(" << var1 << dimstr(field.rank) << ", " << var2
+              << dimstr(field.rank) << ", ErrStat2, ErrMsg2)";
+        }
+        else
+        {
+            w << indent << "call " << field.data_type->derived.module->nickname << "_Swap"
+              << field.data_type->derived.name_short << "(" << var1 << dimstr(field.rank) << ", "
+              << var2 << dimstr(field.rank) << ", ErrStat2, ErrMsg2)";
+        }
+        w << indent << "call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)";
+        w << indent << "if (ErrStat >= AbortErrLev) return";
+
+        for (int d = field.rank; d >= 1; d--)
+        {
+            indent.erase(indent.size() - 3);
+            w << indent << "end do";
+        }
+
+        if (field.is_allocatable)
+        {
+            indent.erase(indent.size() - 3);
+            w << indent << "end if";
+        }
+    }
+
+    // The C object holds the C view of the data that was exchanged above
+    if (gen_c_code)
+    {
+        w << indent << "tmp_C_obj = " << data1 << "%C_obj";
+        w << indent << data1 << "%C_obj = " << data2 << "%C_obj";
+        w << indent << data2 << "%C_obj = tmp_C_obj";
+    }
+
+    indent.erase(indent.size() - 3);
+    w << indent << "end subroutine";
+    w << indent;
+}
+
 void gen_destroy(std::ostream &w, const Module &mod, const DataType::Derived &ddt,
                  const bool gen_c_code)
 {
@@ -312,6 +312,20 @@ subroutine Orca_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, E
    DstOtherStateData%DummyOtherState = SrcOtherStateData%DummyOtherState
 end subroutine
 
+subroutine Orca_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(Orca_OtherStateType), intent(inout) :: OtherStateData1
+   type(Orca_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyOtherState
+   character(*), parameter        :: RoutineName = 'Orca_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyOtherState = OtherStateData1%DummyOtherState
+   OtherStateData1%DummyOtherState = OtherStateData2%DummyOtherState
+   OtherStateData2%DummyOtherState = tmp_DummyOtherState
+end subroutine
+
 subroutine Orca_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(Orca_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -546,6 +560,21 @@ subroutine Orca_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine Orca_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(Orca_InputType), intent(inout) :: InputData1
+   type(Orca_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'Orca_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%PtfmMesh, InputData2%PtfmMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine Orca_DestroyInput(InputData, ErrStat, ErrMsg)
    type(Orca_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -655,6 +684,20 @@ subroutine Orca_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrS
    DstContStateData%Dummy = SrcContStateData%Dummy
 end subroutine
 
+subroutine Orca_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(Orca_ContinuousStateType), intent(inout) :: ContStateData1
+   type(Orca_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_Dummy
+   character(*), parameter        :: RoutineName = 'Orca_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Dummy = ContStateData1%Dummy
+   ContStateData1%Dummy = ContStateData2%Dummy
+   ContStateData2%Dummy = tmp_Dummy
+end subroutine
+
 subroutine Orca_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(Orca_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -693,6 +736,20 @@ subroutine Orca_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrS
    DstDiscStateData%Dummy = SrcDiscStateData%Dummy
 end subroutine
 
+subroutine Orca_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(Orca_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(Orca_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_Dummy
+   character(*), parameter        :: RoutineName = 'Orca_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Dummy = DiscStateData1%Dummy
+   DiscStateData1%Dummy = DiscStateData2%Dummy
+   DiscStateData2%Dummy = tmp_Dummy
+end subroutine
+
 subroutine Orca_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(Orca_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -731,6 +788,20 @@ subroutine Orca_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine Orca_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(Orca_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(Orca_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'Orca_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine Orca_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(Orca_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
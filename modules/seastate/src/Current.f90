@@ -35,6 +35,7 @@ MODULE Current
       ! ..... Public Subroutines ...................................................................................................
 
    PUBLIC :: Current_Init                           ! Initialization routine
+   PUBLIC :: Calc_Current                           ! Current velocity at an elevation
       
 CONTAINS
 
@@ -4,6 +4,8 @@ USE GridInterp
 USE SeaSt_WaveField_Types
 USE IfW_FlowField, only: IfW_FlowField_GetVelAcc
 USE GridInterp_Types
+USE Waves, only: COSHNumOvrCOSHDen, COSHNumOvrSINHDen, SINHNumOvrSINHDen
+USE Current, only: Calc_Current
 
 IMPLICIT NONE
 
@@ -151,7 +153,8 @@ SUBROUTINE WaveField_GetNodeWaveKin( WaveField, WaveField_m, Time, pos, forceNod
    integer(IntKi),                     intent(  out) :: ErrStat ! Error status of the operation
    character(*),                       intent(  out) :: ErrMsg  ! Error message if errStat /= ErrID_None
 
-   real(ReKi)                                        :: posXY(2), posPrime(3), posXY0(3), PosOffset(3), posDummy(3,1)
+   real(ReKi)                                        :: posPrime(3), posXY0(3), PosOffset(3), posDummy(3,1)
+   real(SiKi)                                        :: PV(3), PA(3), PAMCF(3), PDynP
    integer(IntKi)                                    :: startNode
    real(ReKi), allocatable                           :: FV_DC(:,:), FA_DC(:,:)
    character(*),                       parameter     :: RoutineName = 'WaveField_GetNodeWaveKin'
@@ -160,7 +163,6 @@ SUBROUTINE WaveField_GetNodeWaveKin( WaveField, WaveField_m, Time, pos, forceNod
 
    ErrStat   = ErrID_None
 
-   posXY    = pos(1:2)
    posXY0   = (/pos(1),pos(2),0.0_ReKi/)
    FAMCF(:) = 0.0
 
@@ -173,13 +175,7 @@ SUBROUTINE WaveField_GetNodeWaveKin( WaveField, WaveField_m, Time, pos, forceNod
       IF ( pos(3) <= 0.0_ReKi) THEN ! Node is at or below the SWL
          nodeInWater = 1_IntKi
          ! Use location to obtain interpolated values of kinematics
-         CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, pos, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-         FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
-         FA(:) = GridInterp4DVec( WaveField%WaveAcc,  WaveField_m )
-         FDynP = GridInterp4D   ( WaveField%WaveDynP, WaveField_m )
-         IF ( ALLOCATED(WaveField%WaveAccMCF) ) THEN
-            FAMCF(:) = GridInterp4DVec( WaveField%WaveAccMCF, WaveField_m )
-         END IF
+         CALL WaveField_GetKin0( WaveField, WaveField_m, Time, pos, ErrStat2, ErrMsg2, FV=FV, FA=FA, FDynP=FDynP, FAMCF=FAMCF ); if (Failed()) return;
       ELSE ! Node is above the SWL
          nodeInWater = 0_IntKi
          FV(:)       = 0.0
@@ -199,34 +195,20 @@ SUBROUTINE WaveField_GetNodeWaveKin( WaveField, WaveField_m, Time, pos, forceNod
             IF ( pos(3) <= 0.0_SiKi) THEN ! Node is below the SWL - evaluate wave dynamics as usual
 
                ! Use location to obtain interpolated values of kinematics
-               CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, pos, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-               FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
-               FA(:) = GridInterp4DVec( WaveField%WaveAcc,  WaveField_m )
-               FDynP = GridInterp4D   ( WaveField%WaveDynP, WaveField_m )
-               IF ( ALLOCATED(WaveField%WaveAccMCF) ) THEN
-                  FAMCF(:) = GridInterp4DVec( WaveField%WaveAccMCF, WaveField_m )
-               END IF
+               CALL WaveField_GetKin0( WaveField, WaveField_m, Time, pos, ErrStat2, ErrMsg2, FV=FV, FA=FA, FDynP=FDynP, FAMCF=FAMCF ); if (Failed()) return;
 
             ELSE ! Node is above SWL - need wave stretching
 
                ! Vertical wave stretching
-               CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, posXY0, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-               FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
-               FA(:) = GridInterp4DVec( WaveField%WaveAcc,  WaveField_m )
-               FDynP = GridInterp4D   ( WaveField%WaveDynP, WaveField_m )
-               IF ( ALLOCATED(WaveField%WaveAccMCF) ) THEN
-                  FAMCF(:) = GridInterp4DVec( WaveField%WaveAccMCF, WaveField_m )
-               END IF
+               CALL WaveField_GetKin0( WaveField, WaveField_m, Time, posXY0, ErrStat2, ErrMsg2, FV=FV, FA=FA, FDynP=FDynP, FAMCF=FAMCF ); if (Failed()) return;
 
                ! Extrapolated wave stretching
                IF (WaveField%WaveStMod == 2) THEN
-                  CALL WaveField_Interp_Setup3D( Time+WaveField%WaveTimeShift, posXY, WaveField%SrfGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-                  FV(:) = FV(:) + GridInterp3DVec( WaveField%PWaveVel0,  WaveField_m ) * pos(3)
-                  FA(:) = FA(:) + GridInterp3DVec( WaveField%PWaveAcc0,  WaveField_m ) * pos(3)
-                  FDynP = FDynP + GridInterp3D   ( WaveField%PWaveDynP0, WaveField_m ) * pos(3)
-                  IF ( ALLOCATED(WaveField%WaveAccMCF) ) THEN
-                     FAMCF(:) = FAMCF(:) + GridInterp3DVec( WaveField%PWaveAccMCF0, WaveField_m ) * pos(3)
-                  END IF
+                  CALL WaveField_GetPKin0( WaveField, WaveField_m, Time, posXY0, ErrStat2, ErrMsg2, PV=PV, PA=PA, PDynP=PDynP, PAMCF=PAMCF ); if (Failed()) return;
+                  FV(:)    = FV(:)    + PV(:)    * pos(3)
+                  FA(:)    = FA(:)    + PA(:)    * pos(3)
+                  FDynP    = FDynP    + PDynP    * pos(3)
+                  FAMCF(:) = FAMCF(:) + PAMCF(:) * pos(3)
                END IF
 
             END IF ! Node is submerged
@@ -239,13 +221,7 @@ SUBROUTINE WaveField_GetNodeWaveKin( WaveField, WaveField_m, Time, pos, forceNod
             posPrime(3) = MIN( posPrime(3), 0.0_ReKi) ! Clamp z-position to zero. Needed when forceNodeInWater=.TRUE.
 
             ! Obtain the wave-field variables by interpolation with the mapped position.
-            CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, posPrime, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-            FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
-            FA(:) = GridInterp4DVec( WaveField%WaveAcc,  WaveField_m )
-            FDynP = GridInterp4D   ( WaveField%WaveDynP, WaveField_m )
-            IF ( ALLOCATED(WaveField%WaveAccMCF) ) THEN
-               FAMCF(:) = GridInterp4DVec( WaveField%WaveAccMCF, WaveField_m )
-            END IF
+            CALL WaveField_GetKin0( WaveField, WaveField_m, Time, posPrime, ErrStat2, ErrMsg2, FV=FV, FA=FA, FDynP=FDynP, FAMCF=FAMCF ); if (Failed()) return;
          END IF
 
       ELSE ! Node is out of water - zero-out all wave dynamics
@@ -298,7 +274,8 @@ SUBROUTINE WaveField_GetDynP( WaveField, WaveField_m, Time, pos, forceNodeInWate
    integer(IntKi),                     intent(  out) :: ErrStat ! Error status of the operation
    character(*),                       intent(  out) :: ErrMsg  ! Error message if errStat /= ErrID_None
 
-   real(ReKi)                                        :: posXY(2), posPrime(3), posXY0(3)
+   real(ReKi)                                        :: posPrime(3), posXY0(3)
+   real(SiKi)                                        :: PDynP
    character(*),                       parameter     :: RoutineName = 'WaveField_GetDynP'
    integer(IntKi)                                    :: errStat2
    character(ErrMsgLen)                              :: errMsg2
@@ -309,7 +286,6 @@ SUBROUTINE WaveField_GetDynP( WaveField, WaveField_m, Time, pos, forceNodeInWate
    ErrStat   = ErrID_None
    ErrMsg    = ""
 
-   posXY    = pos(1:2)
    posXY0   = (/pos(1),pos(2),0.0_ReKi/)
 
    ! Wave elevation (Calls WaveField_Interp_Setup3D internally so WaveField_Interp_3D_vec can be used below)
@@ -320,8 +296,7 @@ SUBROUTINE WaveField_GetDynP( WaveField, WaveField_m, Time, pos, forceNodeInWate
       IF ( pos(3) <= 0.0_ReKi) THEN ! Node is at or below the SWL
          nodeInWater = 1_IntKi
          ! Use location to obtain interpolated values of kinematics
-         CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, pos, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-         FDynP = GridInterp4D   ( WaveField%WaveDynP, WaveField_m )
+         CALL WaveField_GetKin0( WaveField, WaveField_m, Time, pos, ErrStat2, ErrMsg2, FDynP=FDynP ); if (Failed()) return;
       ELSE ! Node is above the SWL
          nodeInWater = 0_IntKi
          FDynP       = 0.0
@@ -334,18 +309,16 @@ SUBROUTINE WaveField_GetDynP( WaveField, WaveField_m, Time, pos, forceNodeInWate
 
             IF ( pos(3) <= 0.0_SiKi) THEN ! Node is below the SWL - evaluate wave dynamics as usual
                ! Use location to obtain interpolated values of kinematics
-               CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, pos, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-               FDynP = GridInterp4D   ( WaveField%WaveDynP, WaveField_m )
+               CALL WaveField_GetKin0( WaveField, WaveField_m, Time, pos, ErrStat2, ErrMsg2, FDynP=FDynP ); if (Failed()) return;
             ELSE ! Node is above SWL - need wave stretching
 
                ! Vertical wave stretching
-               CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, posXY0, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-               FDynP = GridInterp4D   ( WaveField%WaveDynP, WaveField_m )
+               CALL WaveField_GetKin0( WaveField, WaveField_m, Time, posXY0, ErrStat2, ErrMsg2, FDynP=FDynP ); if (Failed()) return;
 
                ! Extrapoled wave stretching
                IF (WaveField%WaveStMod == 2) THEN
-                  CALL WaveField_Interp_Setup3D( Time+WaveField%WaveTimeShift, posXY, WaveField%SrfGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-                  FDynP = FDynP + GridInterp3D   ( WaveField%PWaveDynP0, WaveField_m ) * pos(3)
+                  CALL WaveField_GetPKin0( WaveField, WaveField_m, Time, posXY0, ErrStat2, ErrMsg2, PDynP=PDynP ); if (Failed()) return;
+                  FDynP = FDynP + PDynP * pos(3)
                END IF
 
             END IF ! Node is submerged
@@ -358,8 +331,7 @@ SUBROUTINE WaveField_GetDynP( WaveField, WaveField_m, Time, pos, forceNodeInWate
             posPrime(3) = MIN( posPrime(3), 0.0_ReKi) ! Clamp z-position to zero. Needed when forceNodeInWater=.TRUE.
 
             ! Obtain the wave-field variables by interpolation with the mapped position.
-            CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, posPrime, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-            FDynP = GridInterp4D   ( WaveField%WaveDynP, WaveField_m )
+            CALL WaveField_GetKin0( WaveField, WaveField_m, Time, posPrime, ErrStat2, ErrMsg2, FDynP=FDynP ); if (Failed()) return;
          END IF
 
       ELSE ! Node is out of water - zero-out all wave dynamics
@@ -392,7 +364,8 @@ SUBROUTINE WaveField_GetNodeWaveVel( WaveField, WaveField_m, Time, pos, forceNod
    character(*),                       intent(  out) :: ErrMsg  ! Error message if errStat /= ErrID_None
 
    real(SiKi)                                        :: WaveElev
-   real(ReKi)                                        :: posXY(2), posPrime(3), posXY0(3), PosOffset(3), posDummy(3,1)
+   real(ReKi)                                        :: posPrime(3), posXY0(3), PosOffset(3), posDummy(3,1)
+   real(SiKi)                                        :: PV(3)
    real(ReKi), allocatable                           :: FV_DC(:,:), FA_DC(:,:)
    integer(IntKi)                                    :: startNode
    character(*),                       parameter     :: RoutineName = 'WaveField_GetNodeWaveVel'
@@ -401,7 +374,6 @@ SUBROUTINE WaveField_GetNodeWaveVel( WaveField, WaveField_m, Time, pos, forceNod
 
    ErrStat   = ErrID_None
 
-   posXY    = pos(1:2)
    posXY0   = (/pos(1),pos(2),0.0_ReKi/)
 
    ! Wave elevation (Calls WaveField_Interp_Setup3D internally so WaveField_Interp_3D_vec can be used below)
@@ -412,8 +384,7 @@ SUBROUTINE WaveField_GetNodeWaveVel( WaveField, WaveField_m, Time, pos, forceNod
       IF ( pos(3) <= 0.0_ReKi) THEN ! Node is at or below the SWL
          nodeInWater = 1_IntKi
          ! Use location to obtain interpolated values of kinematics
-         CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, pos, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-         FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
+         CALL WaveField_GetKin0( WaveField, WaveField_m, Time, pos, ErrStat2, ErrMsg2, FV=FV ); if (Failed()) return;
       ELSE ! Node is above the SWL
          nodeInWater = 0_IntKi
          FV(:)       = 0.0
@@ -430,19 +401,17 @@ SUBROUTINE WaveField_GetNodeWaveVel( WaveField, WaveField_m, Time, pos, forceNod
             IF ( pos(3) <= 0.0_SiKi) THEN ! Node is below the SWL - evaluate wave dynamics as usual
 
                ! Use location to obtain interpolated values of kinematics
-               CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, pos, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-               FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
+               CALL WaveField_GetKin0( WaveField, WaveField_m, Time, pos, ErrStat2, ErrMsg2, FV=FV ); if (Failed()) return;
 
             ELSE ! Node is above SWL - need wave stretching
 
                ! Vertical wave stretching
-               CALL WaveField_Interp_Setup4D( Time, posXY0, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-               FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
+               CALL WaveField_GetKin0( WaveField, WaveField_m, Time, posXY0, ErrStat2, ErrMsg2, FV=FV ); if (Failed()) return;
 
                ! Extrapolated wave stretching
                IF (WaveField%WaveStMod == 2) THEN
-                  CALL WaveField_Interp_Setup3D( Time+WaveField%WaveTimeShift, posXY, WaveField%SrfGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-                  FV(:) = FV(:) + GridInterp3DVec( WaveField%PWaveVel0, WaveField_m ) * pos(3)
+                  CALL WaveField_GetPKin0( WaveField, WaveField_m, Time, posXY0, ErrStat2, ErrMsg2, PV=PV ); if (Failed()) return;
+                  FV(:) = FV(:) + PV(:) * pos(3)
                END IF
 
             END IF ! Node is submerged
@@ -455,8 +424,7 @@ SUBROUTINE WaveField_GetNodeWaveVel( WaveField, WaveField_m, Time, pos, forceNod
             posPrime(3) = MIN( posPrime(3), 0.0_ReKi) ! Clamp z-position to zero. Needed when forceNodeInWater=.TRUE.
 
             ! Obtain the wave-field variables by interpolation with the mapped position.
-            CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, posPrime, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-            FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
+            CALL WaveField_GetKin0( WaveField, WaveField_m, Time, posPrime, ErrStat2, ErrMsg2, FV=FV ); if (Failed()) return;
 
          END IF
 
@@ -506,7 +474,8 @@ SUBROUTINE WaveField_GetNodeWaveVelAcc( WaveField, WaveField_m, Time, pos, force
    character(*),                       intent(  out) :: ErrMsg  ! Error message if errStat /= ErrID_None
 
    real(SiKi)                                        :: WaveElev
-   real(ReKi)                                        :: posXY(2), posPrime(3), posXY0(3), PosOffset(3), posDummy(3,1)
+   real(ReKi)                                        :: posPrime(3), posXY0(3), PosOffset(3), posDummy(3,1)
+   real(SiKi)                                        :: PV(3), PA(3)
    integer(IntKi)                                    :: startNode
    real(ReKi), allocatable                           :: FV_DC(:,:), FA_DC(:,:)
    character(*),                       parameter     :: RoutineName = 'WaveField_GetNodeWaveVelAcc'
@@ -515,7 +484,6 @@ SUBROUTINE WaveField_GetNodeWaveVelAcc( WaveField, WaveField_m, Time, pos, force
 
    ErrStat   = ErrID_None
 
-   posXY    = pos(1:2)
    posXY0   = (/pos(1),pos(2),0.0_ReKi/)
    
    ! Wave elevation
@@ -526,9 +494,7 @@ SUBROUTINE WaveField_GetNodeWaveVelAcc( WaveField, WaveField_m, Time, pos, force
       IF ( pos(3) <= 0.0_ReKi) THEN ! Node is at or below the SWL
          nodeInWater = 1_IntKi
          ! Use location to obtain interpolated values of kinematics
-         CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, pos, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-         FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
-         FA(:) = GridInterp4DVec( WaveField%WaveAcc,  WaveField_m )
+         CALL WaveField_GetKin0( WaveField, WaveField_m, Time, pos, ErrStat2, ErrMsg2, FV=FV, FA=FA ); if (Failed()) return;
       ELSE ! Node is above the SWL
          nodeInWater = 0_IntKi
          FV(:)       = 0.0
@@ -546,22 +512,18 @@ SUBROUTINE WaveField_GetNodeWaveVelAcc( WaveField, WaveField_m, Time, pos, force
             IF ( pos(3) <= 0.0_SiKi) THEN ! Node is below the SWL - evaluate wave dynamics as usual
 
                ! Use location to obtain interpolated values of kinematics
-               CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, pos, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-               FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
-               FA(:) = GridInterp4DVec( WaveField%WaveAcc,  WaveField_m )
+               CALL WaveField_GetKin0( WaveField, WaveField_m, Time, pos, ErrStat2, ErrMsg2, FV=FV, FA=FA ); if (Failed()) return;
 
             ELSE ! Node is above SWL - need wave stretching
 
                ! Vertical wave stretching
-               CALL WaveField_Interp_Setup4D( Time, posXY0, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-               FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
-               FA(:) = GridInterp4DVec( WaveField%WaveAcc,  WaveField_m )
+               CALL WaveField_GetKin0( WaveField, WaveField_m, Time, posXY0, ErrStat2, ErrMsg2, FV=FV, FA=FA ); if (Failed()) return;
 
                ! Extrapolated wave stretching
                IF (WaveField%WaveStMod == 2) THEN
-                  CALL WaveField_Interp_Setup3D( Time+WaveField%WaveTimeShift, posXY, WaveField%SrfGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-                  FV(:) = FV(:) + GridInterp3DVec( WaveField%PWaveVel0, WaveField_m ) * pos(3)
-                  FA(:) = FA(:) + GridInterp3DVec( WaveField%PWaveAcc0, WaveField_m ) * pos(3)
+                  CALL WaveField_GetPKin0( WaveField, WaveField_m, Time, posXY0, ErrStat2, ErrMsg2, PV=PV, PA=PA ); if (Failed()) return;
+                  FV(:) = FV(:) + PV(:) * pos(3)
+                  FA(:) = FA(:) + PA(:) * pos(3)
                END IF
 
             END IF ! Node is submerged
@@ -574,9 +536,7 @@ SUBROUTINE WaveField_GetNodeWaveVelAcc( WaveField, WaveField_m, Time, pos, force
             posPrime(3) = MIN( posPrime(3), 0.0_ReKi) ! Clamp z-position to zero. Needed when forceNodeInWater=.TRUE.
 
             ! Obtain the wave-field variables by interpolation with the mapped position.
-            CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, posPrime, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
-            FV(:) = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
-            FA(:) = GridInterp4DVec( WaveField%WaveAcc,  WaveField_m )
+            CALL WaveField_GetKin0( WaveField, WaveField_m, Time, posPrime, ErrStat2, ErrMsg2, FV=FV, FA=FA ); if (Failed()) return;
          END IF
 
       ELSE ! Node is out of water - zero-out all wave dynamics
@@ -649,7 +609,7 @@ SUBROUTINE WaveField_GetWaveKin( WaveField, WaveField_m, Time, pos, forceNodeInW
       FDynP(i) = REAL(FDynP_node,ReKi)
       FV(:, i) = REAL(FV_node,   ReKi)
       FA(:, i) = REAL(FA_node,   ReKi)
-      IF (ALLOCATED(WaveField%WaveAccMCF)) THEN
+      IF (WaveField%MCFD > 0.0_SiKi) THEN
          FAMCF(:,i) = REAL(FAMCF_node,ReKi)
       END IF
    END DO
@@ -819,6 +779,215 @@ contains
    end function
 END SUBROUTINE WaveField_GetMeanDynSurfCurr
 
+!----------------------------------------------------------------------------------------------------
+! Unstretched wave kinematics
+!----------------------------------------------------------------------------------------------------
+
+!====================================================================================================
+!> This routine returns the wave kinematics without stretching at a point between the seabed and the SWL.  They are
+!! interpolated from the volume grid or, with WaveKinEval = WaveKinEval_Spectral, summed from the wave components at the
+!! point itself.  Only the requested quantities are interpolated from the grid.
+SUBROUTINE WaveField_GetKin0( WaveField, WaveField_m, Time, pos, ErrStat, ErrMsg, FV, FA, FDynP, FAMCF )
+   type(SeaSt_WaveFieldType),          intent(in   ) :: WaveField
+   type(GridInterp_MiscVarType),       intent(inout) :: WaveField_m
+   real(DbKi),                         intent(in   ) :: Time
+   real(ReKi),                         intent(in   ) :: pos(3)
+   integer(IntKi),                     intent(  out) :: ErrStat ! Error status of the operation
+   character(*),                       intent(  out) :: ErrMsg  ! Error message if errStat /= ErrID_None
+   real(SiKi),       optional,         intent(  out) :: FV(3)
+   real(SiKi),       optional,         intent(  out) :: FA(3)
+   real(SiKi),       optional,         intent(  out) :: FDynP
+   real(SiKi),       optional,         intent(  out) :: FAMCF(3)
+
+   real(SiKi)                                        :: V(3), A(3), AMCF(3), DynP
+   real(SiKi)                                        :: CurrVxi, CurrVyi
+   character(*),                       parameter     :: RoutineName = 'WaveField_GetKin0'
+   integer(IntKi)                                    :: errStat2
+   character(ErrMsgLen)                              :: errMsg2
+
+   ErrStat   = ErrID_None
+   ErrMsg    = ""
+
+   IF (WaveField%WaveKinEval == WaveKinEval_Spectral) THEN
+
+      CALL WaveField_SpectralKin( WaveField, Time+WaveField%WaveTimeShift, pos, .FALSE., V, A, DynP, AMCF )
+
+      ! The steady current is added to the grid velocities in the Waves module, so add it here too
+      CALL Calc_Current( WaveField%Current_InitInput, REAL(pos(3),SiKi), WaveField%Current_InitInput%EffWtrDpth, WaveField%Current_InitInput%DirRoot, CurrVxi, CurrVyi )
+      V(1) = V(1) + CurrVxi
+      V(2) = V(2) + CurrVyi
+
+      IF (PRESENT(FV))    FV    = V
+      IF (PRESENT(FA))    FA    = A
+      IF (PRESENT(FDynP)) FDynP = DynP
+      IF (PRESENT(FAMCF)) FAMCF = AMCF
+
+   ELSE
+
+      CALL WaveField_Interp_Setup4D( Time+WaveField%WaveTimeShift, pos, WaveField%GridDepth, WaveField%VolGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
+      IF (PRESENT(FV))    FV    = GridInterp4DVec( WaveField%WaveVel,  WaveField_m )
+      IF (PRESENT(FA))    FA    = GridInterp4DVec( WaveField%WaveAcc,  WaveField_m )
+      IF (PRESENT(FDynP)) FDynP = GridInterp4D   ( WaveField%WaveDynP, WaveField_m )
+      IF (PRESENT(FAMCF)) THEN
+         IF ( ALLOCATED(WaveField%WaveAccMCF) ) THEN
+            FAMCF = GridInterp4DVec( WaveField%WaveAccMCF, WaveField_m )
+         ELSE
+            FAMCF = 0.0_SiKi
+         END IF
+      END IF
+
+   END IF
+
+contains
+   logical function Failed()
+      call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      Failed = ErrStat >= AbortErrLev
+   end function
+END SUBROUTINE WaveField_GetKin0
+
+!====================================================================================================
+!> This routine returns the partial derivatives of the wave kinematics with respect to z at the SWL above the point
+!! (x,y) of pos, as used by extrapolated wave stretching.  Like WaveField_GetKin0, these are either interpolated from
+!! the free-surface grid or summed from the wave components.
+SUBROUTINE WaveField_GetPKin0( WaveField, WaveField_m, Time, pos, ErrStat, ErrMsg, PV, PA, PDynP, PAMCF )
+   type(SeaSt_WaveFieldType),          intent(in   ) :: WaveField
+   type(GridInterp_MiscVarType),       intent(inout) :: WaveField_m
+   real(DbKi),                         intent(in   ) :: Time
+   real(ReKi),                         intent(in   ) :: pos(3)  ! Position; only x and y are used
+   integer(IntKi),                     intent(  out) :: ErrStat ! Error status of the operation
+   character(*),                       intent(  out) :: ErrMsg  ! Error message if errStat /= ErrID_None
+   real(SiKi),       optional,         intent(  out) :: PV(3)
+   real(SiKi),       optional,         intent(  out) :: PA(3)
+   real(SiKi),       optional,         intent(  out) :: PDynP
+   real(SiKi),       optional,         intent(  out) :: PAMCF(3)
+
+   real(SiKi)                                        :: V(3), A(3), AMCF(3), DynP
+   character(*),                       parameter     :: RoutineName = 'WaveField_GetPKin0'
+   integer(IntKi)                                    :: errStat2
+   character(ErrMsgLen)                              :: errMsg2
+
+   ErrStat   = ErrID_None
+   ErrMsg    = ""
+
+   IF (WaveField%WaveKinEval == WaveKinEval_Spectral) THEN
+
+      CALL WaveField_SpectralKin( WaveField, Time+WaveField%WaveTimeShift, pos, .TRUE., V, A, DynP, AMCF )
+      IF (PRESENT(PV))    PV    = V
+      IF (PRESENT(PA))    PA    = A
+      IF (PRESENT(PDynP)) PDynP = DynP
+      IF (PRESENT(PAMCF)) PAMCF = AMCF
+
+   ELSE
+
+      CALL WaveField_Interp_Setup3D( Time+WaveField%WaveTimeShift, pos(1:2), WaveField%SrfGridParams, WaveField_m, ErrStat2, ErrMsg2 ); if (Failed()) return;
+      IF (PRESENT(PV))    PV    = GridInterp3DVec( WaveField%PWaveVel0,  WaveField_m )
+      IF (PRESENT(PA))    PA    = GridInterp3DVec( WaveField%PWaveAcc0,  WaveField_m )
+      IF (PRESENT(PDynP)) PDynP = GridInterp3D   ( WaveField%PWaveDynP0, WaveField_m )
+      IF (PRESENT(PAMCF)) THEN
+         IF ( ALLOCATED(WaveField%PWaveAccMCF0) ) THEN
+            PAMCF = GridInterp3DVec( WaveField%PWaveAccMCF0, WaveField_m )
+         ELSE
+            PAMCF = 0.0_SiKi
+         END IF
+      END IF
+
+   END IF
+
+contains
+   logical function Failed()
+      call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
+      Failed = ErrStat >= AbortErrLev
+   end function
+END SUBROUTINE WaveField_GetPKin0
+
+!====================================================================================================
+!> This routine sums the first-order wave kinematics at a point directly from the wave components stored in the wave
+!! field.  Each component is weighted as in the inverse FFT that fills the volume grid, so the result matches the grid
+!! at the grid points and wave time steps.  The time factor exp(i*I*WaveDOmega*Time) of component I is advanced from
+!! the previous component by a complex recurrence, which leaves one complex exponential per component for the position.
+!! With Partial = .TRUE., the partial derivatives of the kinematics with respect to z at the SWL are returned instead.
+SUBROUTINE WaveField_SpectralKin( WaveField, Time, pos, Partial, FV, FA, FDynP, FAMCF )
+   type(SeaSt_WaveFieldType),          intent(in   ) :: WaveField
+   real(DbKi),                         intent(in   ) :: Time    !< Time including WaveTimeShift
+   real(ReKi),                         intent(in   ) :: pos(3)  !< Position; z is clamped to [-EffWtrDpth,0]
+   logical,                            intent(in   ) :: Partial !< Return the z-derivatives at the SWL instead of the kinematics at pos
+   real(SiKi),                         intent(  out) :: FV(3)
+   real(SiKi),                         intent(  out) :: FA(3)
+   real(SiKi),                         intent(  out) :: FDynP
+   real(SiKi),                         intent(  out) :: FAMCF(3)
+
+   complex(R8Ki)                                     :: TimeStep   ! exp(i*WaveDOmega*Time)
+   complex(R8Ki)                                     :: TimeFac    ! exp(i*I*WaveDOmega*Time)
+   complex(R8Ki)                                     :: C          ! Weighted complex amplitude of component I at pos and Time
+   real(R8Ki)                                        :: SumV(3), SumA(3), SumAMCF(3), SumDynP
+   real(R8Ki)                                        :: VelH, VelV, AccH, AccV
+   real(SiKi)                                        :: k, z, kh, ScDynP, ScH, ScV
+   integer(IntKi)                                    :: I
+
+   z  = MIN( MAX( REAL(pos(3),SiKi), -REAL(WaveField%EffWtrDpth,SiKi) ), 0.0_SiKi )
+
+   SumV    = 0.0_R8Ki
+   SumA    = 0.0_R8Ki
+   SumAMCF = 0.0_R8Ki
+   SumDynP = 0.0_R8Ki
+
+   TimeStep = EXP( CMPLX( 0.0_R8Ki, REAL(WaveField%WaveDOmega,R8Ki)*Time, R8Ki ) )
+   TimeFac  = ( 1.0_R8Ki, 0.0_R8Ki )
+
+   DO I = 0,WaveField%NStepWaveProp
+
+      k  = WaveField%WaveNmbr(I)
+      C  = CMPLX( WaveField%WaveElevC0(1,I), WaveField%WaveElevC0(2,I), R8Ki ) * TimeFac * &
+           EXP( CMPLX( 0.0_R8Ki, -k*( pos(1)*WaveField%CosWaveDir(I) + pos(2)*WaveField%SinWaveDir(I) ), R8Ki ) )
+      IF ( I > 0 .AND. I < WaveField%NStepWave2 ) C = 2.0_R8Ki*C   ! Positive and negative frequencies of the two-sided spectrum
+
+      IF (Partial) THEN
+         kh    = k*REAL(WaveField%EffWtrDpth,SiKi)
+         ScDynP = WaveField%RhoXg*k*TANH( kh )
+         ScH    = WaveField%WaveOmegaI(I)*k
+         IF (I == 0) THEN ! Zero frequency component - Need to avoid division by zero.
+            ScV = 0.0_SiKi
+         ELSE
+            ScV = WaveField%WaveOmegaI(I)*k/TANH( kh )
+         END IF
+      ELSE
+         ScDynP = WaveField%RhoXg       *COSHNumOvrCOSHDen( k, WaveField%EffWtrDpth, z )
+         ScH    = WaveField%WaveOmegaI(I)*COSHNumOvrSINHDen( k, WaveField%EffWtrDpth, z )
+         ScV    = WaveField%WaveOmegaI(I)*SINHNumOvrSINHDen( k, WaveField%EffWtrDpth, z )
+      END IF
+
+      ! Real parts of C*f, i*C*f, and (i*OmegaI)*(.) for the velocities and accelerations
+      VelH  =  ScH*REAL( C)
+      VelV  = -ScV*AIMAG(C)
+      AccH  = -WaveField%WaveOmegaI(I)*ScH*AIMAG(C)
+      AccV  = -WaveField%WaveOmegaI(I)*ScV*REAL( C)
+
+      SumDynP = SumDynP + ScDynP*REAL(C)
+      SumV(1) = SumV(1) + WaveField%CosWaveDir(I)*VelH
+      SumV(2) = SumV(2) + WaveField%SinWaveDir(I)*VelH
+      SumV(3) = SumV(3) + VelV
+      SumA(1) = SumA(1) + WaveField%CosWaveDir(I)*AccH
+      SumA(2) = SumA(2) + WaveField%SinWaveDir(I)*AccH
+      SumA(3) = SumA(3) + AccV
+
+      IF (WaveField%MCFD > 0.0_SiKi) THEN ! MacCamy-Fuchs scaled acceleration
+         SumAMCF(1) = SumAMCF(1) + WaveField%WaveMCFC(I)*WaveField%CosWaveDir(I)*AccH
+         SumAMCF(2) = SumAMCF(2) + WaveField%WaveMCFC(I)*WaveField%SinWaveDir(I)*AccH
+         SumAMCF(3) = SumAMCF(3) + WaveField%WaveMCFC(I)*AccV
+      END IF
+
+      TimeFac = TimeFac*TimeStep
+
+   END DO
+
+   ! Normalization of the inverse FFT
+   FDynP = REAL( SumDynP/WaveField%NStepWave, SiKi )
+   FV    = REAL( SumV   /WaveField%NStepWave, SiKi )
+   FA    = REAL( SumA   /WaveField%NStepWave, SiKi )
+   FAMCF = REAL( SumAMCF/WaveField%NStepWave, SiKi )
+
+END SUBROUTINE WaveField_SpectralKin
+
 !----------------------------------------------------------------------------------------------------
 ! Interpolation related functions
 !----------------------------------------------------------------------------------------------------
@@ -53,6 +53,8 @@ IMPLICIT NONE
     INTEGER(IntKi), PUBLIC, PARAMETER  :: WvCrntMod_Superpose              = 0      ! WvCrntMod = 0 [Simpler superposition] [-]
     INTEGER(IntKi), PUBLIC, PARAMETER  :: WvCrntMod_Doppler                = 1      ! WvCrntMod = 1 [Doppler effect] [-]
     INTEGER(IntKi), PUBLIC, PARAMETER  :: WvCrntMod_Full                   = 2      ! WvCrntMod = 2 [Doppler effect and amplitude/spectrum scaling] [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: WaveKinEval_Grid                 = 0      ! WaveKinEval = 0 [First-order wave kinematics interpolated from the precomputed volume grid] [-]
+    INTEGER(IntKi), PUBLIC, PARAMETER  :: WaveKinEval_Spectral             = 1      ! WaveKinEval = 1 [First-order wave kinematics summed from the wave components at each requested position] [-]
 ! =========  SeaSt_WaveField_MiscVarType  =======
   TYPE, PUBLIC :: SeaSt_WaveField_MiscVarType
     REAL(SiKi) , DIMENSION(1:8)  :: N3D = 0.0_R4Ki      !< this is the weighting function for 3-d velocity field [-]
@@ -84,6 +86,13 @@ IMPLICIT NONE
     REAL(SiKi) , DIMENSION(:,:,:), ALLOCATABLE  :: WaveElevC      !< Discrete Fourier transform of the instantaneous elevation of incident waves at all grid points.  First column is real part, second column is imaginary part [(m)]
     REAL(SiKi) , DIMENSION(:,:), ALLOCATABLE  :: WaveElevC0      !< Fourier components of the incident wave elevation at the platform reference point. First column is the real part; second column is the imaginary part [(m)]
     REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveDirArr      !< Wave direction array. Each frequency has a unique direction of WaveNDir > 1 [(degrees)]
+    INTEGER(IntKi)  :: WaveKinEval = 0_IntKi      !< Evaluation of the first-order wave kinematics {0: interpolated from the volume grid, 1: summed from the wave components at each requested position} [-]
+    INTEGER(IntKi)  :: NStepWaveProp = 0_IntKi      !< Highest frequency component that propagates; all components above it are zero [only used when WaveKinEval=1] [-]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveNmbr      !< Wave number of each frequency component [only used when WaveKinEval=1] [(1/m)]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveOmegaI      !< Intrinsic angular frequency of each frequency component [only used when WaveKinEval=1] [(rad/s)]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: CosWaveDir      !< Cosine of the direction of each frequency component [only used when WaveKinEval=1] [-]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: SinWaveDir      !< Sine of the direction of each frequency component [only used when WaveKinEval=1] [-]
+    REAL(SiKi) , DIMENSION(:), ALLOCATABLE  :: WaveMCFC      !< MacCamy-Fuchs acceleration scaling of each frequency component [only used when WaveKinEval=1 and MCFD>0] [-]
     LOGICAL  :: hasCurrField = .false.      !< True if CurrField is populated for MHK simulations [(-)]
     TYPE(FlowFieldType) , POINTER :: CurrField => NULL()      !< Pointer to FlowField type from InflowWind containing the dynamic current information [(-)]
     REAL(ReKi)  :: WtrDpth = 0.0_ReKi      !< Water depth, this is necessary to inform glue-code what the module is using for WtrDpth (may not be the glue-code's default) [(m)]
@@ -364,6 +373,68 @@ subroutine SeaSt_WaveField_CopySeaSt_WaveFieldType(SrcSeaSt_WaveFieldTypeData, D
       end if
       DstSeaSt_WaveFieldTypeData%WaveDirArr = SrcSeaSt_WaveFieldTypeData%WaveDirArr
    end if
+   DstSeaSt_WaveFieldTypeData%WaveKinEval = SrcSeaSt_WaveFieldTypeData%WaveKinEval
+   DstSeaSt_WaveFieldTypeData%NStepWaveProp = SrcSeaSt_WaveFieldTypeData%NStepWaveProp
+   if (allocated(SrcSeaSt_WaveFieldTypeData%WaveNmbr)) then
+      LB(1:1) = lbound(SrcSeaSt_WaveFieldTypeData%WaveNmbr)
+      UB(1:1) = ubound(SrcSeaSt_WaveFieldTypeData%WaveNmbr)
+      if (.not. allocated(DstSeaSt_WaveFieldTypeData%WaveNmbr)) then
+         allocate(DstSeaSt_WaveFieldTypeData%WaveNmbr(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstSeaSt_WaveFieldTypeData%WaveNmbr.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstSeaSt_WaveFieldTypeData%WaveNmbr = SrcSeaSt_WaveFieldTypeData%WaveNmbr
+   end if
+   if (allocated(SrcSeaSt_WaveFieldTypeData%WaveOmegaI)) then
+      LB(1:1) = lbound(SrcSeaSt_WaveFieldTypeData%WaveOmegaI)
+      UB(1:1) = ubound(SrcSeaSt_WaveFieldTypeData%WaveOmegaI)
+      if (.not. allocated(DstSeaSt_WaveFieldTypeData%WaveOmegaI)) then
+         allocate(DstSeaSt_WaveFieldTypeData%WaveOmegaI(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstSeaSt_WaveFieldTypeData%WaveOmegaI.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstSeaSt_WaveFieldTypeData%WaveOmegaI = SrcSeaSt_WaveFieldTypeData%WaveOmegaI
+   end if
+   if (allocated(SrcSeaSt_WaveFieldTypeData%CosWaveDir)) then
+      LB(1:1) = lbound(SrcSeaSt_WaveFieldTypeData%CosWaveDir)
+      UB(1:1) = ubound(SrcSeaSt_WaveFieldTypeData%CosWaveDir)
+      if (.not. allocated(DstSeaSt_WaveFieldTypeData%CosWaveDir)) then
+         allocate(DstSeaSt_WaveFieldTypeData%CosWaveDir(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstSeaSt_WaveFieldTypeData%CosWaveDir.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstSeaSt_WaveFieldTypeData%CosWaveDir = SrcSeaSt_WaveFieldTypeData%CosWaveDir
+   end if
+   if (allocated(SrcSeaSt_WaveFieldTypeData%SinWaveDir)) then
+      LB(1:1) = lbound(SrcSeaSt_WaveFieldTypeData%SinWaveDir)
+      UB(1:1) = ubound(SrcSeaSt_WaveFieldTypeData%SinWaveDir)
+      if (.not. allocated(DstSeaSt_WaveFieldTypeData%SinWaveDir)) then
+         allocate(DstSeaSt_WaveFieldTypeData%SinWaveDir(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstSeaSt_WaveFieldTypeData%SinWaveDir.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstSeaSt_WaveFieldTypeData%SinWaveDir = SrcSeaSt_WaveFieldTypeData%SinWaveDir
+   end if
+   if (allocated(SrcSeaSt_WaveFieldTypeData%WaveMCFC)) then
+      LB(1:1) = lbound(SrcSeaSt_WaveFieldTypeData%WaveMCFC)
+      UB(1:1) = ubound(SrcSeaSt_WaveFieldTypeData%WaveMCFC)
+      if (.not. allocated(DstSeaSt_WaveFieldTypeData%WaveMCFC)) then
+         allocate(DstSeaSt_WaveFieldTypeData%WaveMCFC(LB(1):UB(1)), stat=ErrStat2)
+         if (ErrStat2 /= 0) then
+            call SetErrStat(ErrID_Fatal, 'Error allocating DstSeaSt_WaveFieldTypeData%WaveMCFC.', ErrStat, ErrMsg, RoutineName)
+            return
+         end if
+      end if
+      DstSeaSt_WaveFieldTypeData%WaveMCFC = SrcSeaSt_WaveFieldTypeData%WaveMCFC
+   end if
    DstSeaSt_WaveFieldTypeData%hasCurrField = SrcSeaSt_WaveFieldTypeData%hasCurrField
    DstSeaSt_WaveFieldTypeData%CurrField => SrcSeaSt_WaveFieldTypeData%CurrField
    DstSeaSt_WaveFieldTypeData%WtrDpth = SrcSeaSt_WaveFieldTypeData%WtrDpth
@@ -450,6 +521,21 @@ subroutine SeaSt_WaveField_DestroySeaSt_WaveFieldType(SeaSt_WaveFieldTypeData, E
    if (allocated(SeaSt_WaveFieldTypeData%WaveDirArr)) then
       deallocate(SeaSt_WaveFieldTypeData%WaveDirArr)
    end if
+   if (allocated(SeaSt_WaveFieldTypeData%WaveNmbr)) then
+      deallocate(SeaSt_WaveFieldTypeData%WaveNmbr)
+   end if
+   if (allocated(SeaSt_WaveFieldTypeData%WaveOmegaI)) then
+      deallocate(SeaSt_WaveFieldTypeData%WaveOmegaI)
+   end if
+   if (allocated(SeaSt_WaveFieldTypeData%CosWaveDir)) then
+      deallocate(SeaSt_WaveFieldTypeData%CosWaveDir)
+   end if
+   if (allocated(SeaSt_WaveFieldTypeData%SinWaveDir)) then
+      deallocate(SeaSt_WaveFieldTypeData%SinWaveDir)
+   end if
+   if (allocated(SeaSt_WaveFieldTypeData%WaveMCFC)) then
+      deallocate(SeaSt_WaveFieldTypeData%WaveMCFC)
+   end if
    nullify(SeaSt_WaveFieldTypeData%CurrField)
    call Current_DestroyInitInput(SeaSt_WaveFieldTypeData%Current_InitInput, ErrStat2, ErrMsg2)
    call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
@@ -481,6 +567,13 @@ subroutine SeaSt_WaveField_PackSeaSt_WaveFieldType(RF, Indata)
    call RegPackAlloc(RF, InData%WaveElevC)
    call RegPackAlloc(RF, InData%WaveElevC0)
    call RegPackAlloc(RF, InData%WaveDirArr)
+   call RegPack(RF, InData%WaveKinEval)
+   call RegPack(RF, InData%NStepWaveProp)
+   call RegPackAlloc(RF, InData%WaveNmbr)
+   call RegPackAlloc(RF, InData%WaveOmegaI)
+   call RegPackAlloc(RF, InData%CosWaveDir)
+   call RegPackAlloc(RF, InData%SinWaveDir)
+   call RegPackAlloc(RF, InData%WaveMCFC)
    call RegPack(RF, InData%hasCurrField)
    call RegPack(RF, associated(InData%CurrField))
    if (associated(InData%CurrField)) then
@@ -544,6 +637,13 @@ subroutine SeaSt_WaveField_UnPackSeaSt_WaveFieldType(RF, OutData)
    call RegUnpackAlloc(RF, OutData%WaveElevC); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%WaveElevC0); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpackAlloc(RF, OutData%WaveDirArr); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%WaveKinEval); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%NStepWaveProp); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%WaveNmbr); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%WaveOmegaI); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%CosWaveDir); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%SinWaveDir); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpackAlloc(RF, OutData%WaveMCFC); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%hasCurrField); if (RegCheckErr(RF, RoutineName)) return
    if (associated(OutData%CurrField)) deallocate(OutData%CurrField)
    call RegUnpack(RF, IsAllocAssoc); if (RegCheckErr(RF, RoutineName)) return
@@ -45,16 +45,9 @@ MODULE SeaState_C_Binding
    PUBLIC :: SeaSt_C_GetDpth
    PUBLIC :: SeaSt_C_GetMSL2SWL
    PUBLIC :: SeaSt_C_GetDynPressure
-
-   !------------------------------------------------------------------------------------
-   !  Debugging: DebugLevel -- passed at PreInit
-   !     0  - none
-   !     1  - some summary info
-   !     2  - above + all position/orientation info
-   !     3  - above + input files (if direct passed)
-   !     4  - above + meshes
-   integer(IntKi)                         :: DebugLevel
-   logical                                :: PreInitDone = .false.
+   PUBLIC :: SeaSt_C_GetFluidVelAccPts
+   PUBLIC :: SeaSt_C_GetSurfElevPts
+   PUBLIC :: SeaSt_C_GetDynPressurePts
 
    !------------------------------------------------------------------------------------
    !  Visualization
@@ -70,30 +63,56 @@ MODULE SeaState_C_Binding
       integer(IntKi)                      :: LastWaveIndx
       integer(IntKi)                      :: lastCount = -1
    end type VTKvis
-   type(VTKvis)                           :: vtk
-
-   !------------------------------
-   !  Primary derived types
-   type(SeaSt_InputType)                  :: u           !< inputs to SS
-   type(SeaSt_InitInputType)              :: InitInp     !< initialization input
-   type(SeaSt_InitOutputType)             :: InitOutData !< Initial output data
-   type(SeaSt_ParameterType), target      :: p           !< Parameters
-   type(SeaSt_OutputType)                 :: y           !< Initial output (outputs are not calculated; only the output mesh is initialized)
-   type(SeaSt_MiscVarType)                :: m           !< Misc variables for optimization (not copied in glue code)
-   type(SeaSt_ContinuousStateType)        :: x           !< Initial continuous states
-   type(SeaSt_DiscreteStateType)          :: xd          !< Initial discrete states
-   type(SeaSt_ConstraintStateType)        :: z           !< Initial guess of the constraint states
-   type(SeaSt_OtherStateType)             :: OtherState  !< Initial other states            
+   !------------------------------------------------------------------------------------
+   !  Instances
+   !     Each call to SeaSt_C_PreInit creates a new instance holding all the data
+   !     below and returns an integer handle to it.  All other SeaSt_C_* routines
+   !     take that handle as their first argument, so several independent sea states
+   !     can be used from one process.  Calls on different handles may be made from
+   !     separate threads at the same time.  SeaSt_C_PreInit and SeaSt_C_End change
+   !     the instance list and must not overlap with any other call into this library.
+   type SeaSt_C_InstanceType
+      !  Debugging: DebugLevel -- passed at PreInit
+      !     0  - none
+      !     1  - some summary info
+      !     2  - above + all position/orientation info
+      !     3  - above + input files (if direct passed)
+      !     4  - above + meshes
+      integer(IntKi)                         :: DebugLevel = 0
+      logical                                :: PreInitDone = .false.
+
+      type(VTKvis)                           :: vtk
+
+      !  Primary derived types
+      type(SeaSt_InputType)                  :: u           !< inputs to SS
+      type(SeaSt_InitInputType)              :: InitInp     !< initialization input
+      type(SeaSt_InitOutputType)             :: InitOutData !< Initial output data
+      type(SeaSt_ParameterType)              :: p           !< Parameters
+      type(SeaSt_OutputType)                 :: y           !< Initial output (outputs are not calculated; only the output mesh is initialized)
+      type(SeaSt_MiscVarType)                :: m           !< Misc variables for optimization (not copied in glue code)
+      type(SeaSt_ContinuousStateType)        :: x           !< Initial continuous states
+      type(SeaSt_DiscreteStateType)          :: xd          !< Initial discrete states
+      type(SeaSt_ConstraintStateType)        :: z           !< Initial guess of the constraint states
+      type(SeaSt_OtherStateType)             :: OtherState  !< Initial other states
+   end type SeaSt_C_InstanceType
+
+   !> Instances are held through pointers so that they never move when the list grows
+   type SeaSt_C_InstancePtr
+      type(SeaSt_C_InstanceType), pointer    :: Inst => NULL()
+   end type SeaSt_C_InstancePtr
+
+   type(SeaSt_C_InstancePtr), allocatable :: Instances(:)   !< Instance list; the handle is the index into this array
 
 contains
 
 
 !> Set environment variables
-subroutine SeaSt_C_PreInit(Gravity_C, WtrDens_C, WtrDpth_C, MSL2SWL_C, DebugLevel_C, OutVTKDir_C, WrVTK_in, WrVTK_inDT, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_PreInit')
+subroutine SeaSt_C_PreInit(Handle_C, Gravity_C, WtrDens_C, WtrDpth_C, MSL2SWL_C, DebugLevel_C, OutVTKDir_C, WrVTK_in, WrVTK_inDT, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_PreInit')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_PreInit
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_PreInit
 #endif
+   integer(c_int),             intent(  out) :: Handle_C                      !< Handle to the new instance, passed to all other SeaSt_C_* routines
    real(c_float),              intent(in   ) :: Gravity_C
    real(c_float),              intent(in   ) :: WtrDens_C
    real(c_float),              intent(in   ) :: WtrDpth_C
@@ -109,25 +128,31 @@ subroutine SeaSt_C_PreInit(Gravity_C, WtrDens_C, WtrDpth_C, MSL2SWL_C, DebugLeve
    character(ErrMsgLen)             :: ErrMsg,  ErrMsg2
    integer                          :: i,j,k
    character(*), parameter          :: RoutineName = 'SeaSt_C_PreInit'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
 
    ! Initialize error handling
    ErrStat =  ErrID_None
    ErrMsg  =  ""
 
+   ! create a new instance.  The handle is returned even if anything below fails
+   ! so that SeaSt_C_End can clean up whatever was allocated.
+   call NewInstance(Handle_C, Inst, ErrStat2, ErrMsg2)
+   if (Failed()) return
+
    call NWTC_Init( ProgNameIn=  SeaSt_ProgDesc%Name )
    call DispCopyrightLicense(   SeaSt_ProgDesc%Name )
    call DispCompileRuntimeInfo( SeaSt_ProgDesc%Name )
 
    ! Store the out root dir - do this before ShowPassedData call
-   vtk%outdir = TRANSFER( OutVTKDir_C, vtk%outdir )
-   i = INDEX(vtk%outdir,C_NULL_CHAR) - 1               ! if this has a c null character at the end...
-   if ( i > 0 ) vtk%outdir = vtk%outdir(1:I)            ! remove it
+   Inst%vtk%outdir = TRANSFER( OutVTKDir_C, Inst%vtk%outdir )
+   i = INDEX(Inst%vtk%outdir,C_NULL_CHAR) - 1               ! if this has a c null character at the end...
+   if ( i > 0 ) Inst%vtk%outdir = Inst%vtk%outdir(1:I)            ! remove it
 
    ! interface debugging
-   DebugLevel = int(DebugLevel_C,IntKi)
+   Inst%DebugLevel = int(DebugLevel_C,IntKi)
 
    ! check valid debug level, show passed data if >0
-   if (DebugLevel < 0_IntKi) then
+   if (Inst%DebugLevel < 0_IntKi) then
       ErrStat2 = ErrID_Fatal
       ErrMsg2  = "Interface debug level must be 0 or greater"//NewLine// &
       "  0  - none"//NewLine// &
@@ -135,42 +160,39 @@ subroutine SeaSt_C_PreInit(Gravity_C, WtrDens_C, WtrDpth_C, MSL2SWL_C, DebugLeve
       "  2  - above + all position info on all calls"
       call ShowPassedData()
       if (Failed()) return;
-   elseif (DebugLevel > 0_IntKi) THEN
-      call WrScr("   Interface debugging level "//trim(Num2Lstr(DebugLevel))//" requested.")
+   elseif (Inst%DebugLevel > 0_IntKi) THEN
+      call WrScr("   Interface debugging level "//trim(Num2Lstr(Inst%DebugLevel))//" requested.")
       call ShowPassedData()
    endif
 
-   ! clear memory of anything we allocate locally
-   call ClearMem()      ! ignoring any error handling from this
-
    ! store environment values
-   InitInp%Gravity      = Gravity_C
-   InitInp%defWtrDens   = WtrDens_C
-   InitInp%defWtrDpth   = WtrDpth_C
-   InitInp%defMSL2SWL   = MSL2SWL_C
+   Inst%InitInp%Gravity      = Gravity_C
+   Inst%InitInp%defWtrDens   = WtrDens_C
+   Inst%InitInp%defWtrDpth   = WtrDpth_C
+   Inst%InitInp%defMSL2SWL   = MSL2SWL_C
 
    !----------------------
    ! store VTK output info
-   vtk%write  = int(WrVTK_in, IntKi)
-   vtk%dt     = real(WrVTK_inDT, DbKi)
+   Inst%vtk%write  = int(WrVTK_in, IntKi)
+   Inst%vtk%dt     = real(WrVTK_inDT, DbKi)
 
-   if (vtk%write < 0_IntKi .or. vtk%write > 2_IntKi) then
+   if (Inst%vtk%write < 0_IntKi .or. Inst%vtk%write > 2_IntKi) then
       ErrStat2 = ErrID_Warn
-      ErrMSg2  = "WrVTK_in must be 0 (off), 1 (init), 2 (animation), but "//trim(Num2LStr(vtk%write))//" was passed.  Turning off VTK surface export."
-      vtk%write = 0_IntKi
+      ErrMSg2  = "WrVTK_in must be 0 (off), 1 (init), 2 (animation), but "//trim(Num2LStr(Inst%vtk%write))//" was passed.  Turning off VTK surface export."
+      Inst%vtk%write = 0_IntKi
       if (Failed()) return
    endif
 
-   if (vtk%write > 0_IntKi) then
+   if (Inst%vtk%write > 0_IntKi) then
       ! Tell SeaState to generate the visualization using default grid
-      InitInp%SurfaceVis     = .true.
-      InitInp%SurfaceVisNx   = 0    ! use the WaveField grid resolution
-      InitInp%SurfaceVisNy   = 0    ! use the WaveField grid resolution
+      Inst%InitInp%SurfaceVis     = .true.
+      Inst%InitInp%SurfaceVisNx   = 0    ! use the WaveField grid resolution
+      Inst%InitInp%SurfaceVisNy   = 0    ! use the WaveField grid resolution
    endif
 
 
    ! If we got this far, we are initialized
-   PreInitDone = .true.
+   Inst%PreInitDone = .true.
 
    call Cleanup()
    return
@@ -192,7 +214,7 @@ contains
       call WrScr("   WtrDpth_C              -> "//trim(Num2LStr(WtrDpth_C)))
       call WrScr("   MSL2SWL_C              -> "//trim(Num2LStr(MSL2SWL_C)))
       call WrScr("   DebugLevel_C           -> "//trim(Num2LStr(DebugLevel_C)))
-      call WrScr("   OutVTKDir_C            -> "//trim(vtk%outdir))
+      call WrScr("   OutVTKDir_C            -> "//trim(Inst%vtk%outdir))
       call WrScr("   WrVTK_in               -> "//trim(Num2LStr(WrVTK_in)))
       call WrScr("   WrVTK_inDT             -> "//trim(Num2LStr(WrVTK_inDT)))
       call WrScr("-----------------------------------------------------------")
@@ -201,11 +223,12 @@ end subroutine SeaSt_C_PreInit
 
 
 !> Initialize the library (PreInit must be called first)
-subroutine SeaSt_C_Init(InputFile_C, OutRootName_C, TimeInterval_C, TMax_C, WaveTimeShift_C, NumChannels_C, OutputChannelNames_C, OutputChannelUnits_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_Init')
+subroutine SeaSt_C_Init(Handle_C, InputFile_C, OutRootName_C, TimeInterval_C, TMax_C, WaveTimeShift_C, NumChannels_C, OutputChannelNames_C, OutputChannelUnits_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_Init')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_Init
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_Init
 #endif
+   integer(c_int),             intent(in   ) :: Handle_C
    character(kind=c_char),     intent(in   ) :: InputFile_C(IntfStrLen)
    character(kind=c_char),     intent(in   ) :: OutRootName_C(IntfStrLen)
    real(c_double),             intent(in   ) :: TimeInterval_C
@@ -224,12 +247,7 @@ subroutine SeaSt_C_Init(InputFile_C, OutRootName_C, TimeInterval_C, TMax_C, Wave
    character(ErrMsgLen)             :: ErrMsg,  ErrMsg2
    integer                          :: i,j,k
    character(*), parameter          :: RoutineName = 'SeaSt_C_Init'  !< for error handling
-
-   if (.not. PreInitDone) then
-      ErrStat = ErrID_Fatal
-      ErrMSg  = "SeaSt_C_PreInit must be called before SeaSt_C_Init"
-      call Cleanup()
-   endif
+   type(SeaSt_C_InstanceType), pointer  :: Inst
 
    ! Initialize error handling
    ErrStat =  ErrID_None
@@ -242,49 +260,58 @@ subroutine SeaSt_C_Init(InputFile_C, OutRootName_C, TimeInterval_C, TMax_C, Wave
    OutputChannelNames_C = c_null_char
    OutputChannelUnits_C = c_null_char
 
+   call GetInstance(Handle_C, Inst, ErrStat2, ErrMsg2)
+   if (Failed()) return
+
+   if (.not. Inst%PreInitDone) then
+      ErrStat2 = ErrID_Fatal
+      ErrMsg2  = "SeaSt_C_PreInit must be called before SeaSt_C_Init"
+      if (Failed()) return
+   endif
+
    call NWTC_Init( ProgNameIn=  SeaSt_ProgDesc%Name )
    call DispCopyrightLicense(   SeaSt_ProgDesc%Name )
    call DispCompileRuntimeInfo( SeaSt_ProgDesc%Name )
 
 
    ! Input file
-   InitInp%InputFile    = TRANSFER( InputFile_C, InitInp%InputFile )
-   i = INDEX(InitInp%InputFile,C_NULL_CHAR) - 1                   ! if this has a c null character at the end...
-   if ( i > 0 ) InitInp%InputFile = InitInp%InputFile(1:I)        ! remove it
+   Inst%InitInp%InputFile    = TRANSFER( InputFile_C, Inst%InitInp%InputFile )
+   i = INDEX(Inst%InitInp%InputFile,C_NULL_CHAR) - 1                   ! if this has a c null character at the end...
+   if ( i > 0 ) Inst%InitInp%InputFile = Inst%InitInp%InputFile(1:I)        ! remove it
 
    ! OutRootName - this should be relative to current location
-   InitInp%OutRootName  = TRANSFER( OutRootName_C, InitInp%OutRootName )
-   i = INDEX(InitInp%OutRootName,C_NULL_CHAR) - 1                 ! if this has a c null character at the end...
-   if ( i > 0 ) InitInp%OutRootName = InitInp%OutRootName(1:I)    ! remove it
-   vtk%OutRootName = InitInp%OutRootName                          ! store for vtk (will modify below)
+   Inst%InitInp%OutRootName  = TRANSFER( OutRootName_C, Inst%InitInp%OutRootName )
+   i = INDEX(Inst%InitInp%OutRootName,C_NULL_CHAR) - 1                 ! if this has a c null character at the end...
+   if ( i > 0 ) Inst%InitInp%OutRootName = Inst%InitInp%OutRootName(1:I)    ! remove it
+   Inst%vtk%OutRootName = Inst%InitInp%OutRootName                          ! store for vtk (will modify below)
 
    ! Debugging interface
-   if (DebugLevel > 0_IntKi) call ShowPassedData()
+   if (Inst%DebugLevel > 0_IntKi) call ShowPassedData()
 
    ! Set other inputs for calling SeaSt_Init
-   InitInp%UseInputFile = .TRUE.                            ! don't allow passing of full file contents as a string
-   InitInp%TMax         = real(TMax_c, DbKi)
-   InitInp%WaveFieldMod = 0_IntKi 
-   InitInp%WrWvKinMod   = 0_IntKi 
-   InitInp%Linearize    = .false.
-   InitInp%hasIce        = .false.
-   InitInp%WaveFieldMod  = 0        ! does not currently support moving platform.  Not really necessary though since can directly get data in absolute coords
-   InitInp%PtfmLocationX = 0.0_ReKi
-   InitInp%PtfmLocationY = 0.0_ReKi
-   InitInp%WaveTimeShift = real(WaveTimeShift_C,DbKi)
-
-   call SeaSt_Init( InitInp, u, p, x, xd, z, OtherState, y, m, Interval, InitOutData, ErrStat2, ErrMsg2 )
+   Inst%InitInp%UseInputFile = .TRUE.                            ! don't allow passing of full file contents as a string
+   Inst%InitInp%TMax         = real(TMax_c, DbKi)
+   Inst%InitInp%WaveFieldMod = 0_IntKi 
+   Inst%InitInp%WrWvKinMod   = 0_IntKi 
+   Inst%InitInp%Linearize    = .false.
+   Inst%InitInp%hasIce        = .false.
+   Inst%InitInp%WaveFieldMod  = 0        ! does not currently support moving platform.  Not really necessary though since can directly get data in absolute coords
+   Inst%InitInp%PtfmLocationX = 0.0_ReKi
+   Inst%InitInp%PtfmLocationY = 0.0_ReKi
+   Inst%InitInp%WaveTimeShift = real(WaveTimeShift_C,DbKi)
+
+   call SeaSt_Init( Inst%InitInp, Inst%u, Inst%p, Inst%x, Inst%xd, Inst%z, Inst%OtherState, Inst%y, Inst%m, Interval, Inst%InitOutData, ErrStat2, ErrMsg2 )
       if (Failed()) return
 
    ! Number of channels
-   NumChannels_C = size(InitOutData%WriteOutputHdr)
+   NumChannels_C = size(Inst%InitOutData%WriteOutputHdr)
 
    ! transfer the output channel names and units to c_char arrays for returning
    k=1
    do i=1,NumChannels_C
       do j=1,ChanLen    ! max length of channel name.  Same for units
-         OutputChannelNames_C(k)=InitOutData%WriteOutputHdr(i)(j:j)
-         OutputChannelUnits_C(k)=InitOutData%WriteOutputUnt(i)(j:j)
+         OutputChannelNames_C(k)=Inst%InitOutData%WriteOutputHdr(i)(j:j)
+         OutputChannelUnits_C(k)=Inst%InitOutData%WriteOutputUnt(i)(j:j)
          k=k+1
       enddo
    enddo
@@ -293,7 +320,7 @@ subroutine SeaSt_C_Init(InputFile_C, OutRootName_C, TimeInterval_C, TMax_C, Wave
    OutputChannelNames_C(k) = C_NULL_CHAR
    OutputChannelUnits_C(k) = C_NULL_CHAR
 
-   if (vtk%write > 0_IntKi) then
+   if (Inst%vtk%write > 0_IntKi) then
       call VTKsetup()
    endif
 
@@ -314,8 +341,8 @@ contains
       call WrScr("-----------------------------------------------------------")
       call WrScr("Interface debugging:  SeaSt_C_Init")
       call WrScr("   --------------------------------------------------------")
-      call WrScr("   InputFile_C             -> "//trim(InitInp%InputFile))
-      call WrScr("   OutRootName_C           -> "//trim(InitInp%OutRootName))
+      call WrScr("   InputFile_C             -> "//trim(Inst%InitInp%InputFile))
+      call WrScr("   OutRootName_C           -> "//trim(Inst%InitInp%OutRootName))
       call WrScr("   TMax_C                  -> "//trim(Num2LStr(TMax_C)))
       call WrScr("   TimeInterval_C          -> "//trim(Num2LStr(TimeInterval_C)))
       call WrScr("   WaveTimeShift_C         -> "//trim(Num2LStr(WaveTimeShift_C)))
@@ -324,75 +351,77 @@ contains
 
    subroutine VTKsetup()
       ! check dt (can't check against Interval since that is never set, so just make sure it is positive)
-      if (vtk%dt <= 0.0) vtk%dt = 0.25
+      if (Inst%vtk%dt <= 0.0) Inst%vtk%dt = 0.25
       ! move data
-      if (allocated(InitOutData%WaveElevVisGrid)) then
-         vtk%NWaveElevPts(1) = size(InitOutData%WaveElevVisX)
-         vtk%NWaveElevPts(2) = size(InitOutData%WaveElevVisY)
-         call move_alloc(InitOutData%WaveElevVisX, vtk%WaveElevVisX)
-         call move_alloc(InitOutData%WaveElevVisY, vtk%WaveElevVisY)
-         call move_alloc(InitOutData%WaveElevVisGrid,vtk%WaveElevVisGrid )
+      if (allocated(Inst%InitOutData%WaveElevVisGrid)) then
+         Inst%vtk%NWaveElevPts(1) = size(Inst%InitOutData%WaveElevVisX)
+         Inst%vtk%NWaveElevPts(2) = size(Inst%InitOutData%WaveElevVisY)
+         call move_alloc(Inst%InitOutData%WaveElevVisX, Inst%vtk%WaveElevVisX)
+         call move_alloc(Inst%InitOutData%WaveElevVisY, Inst%vtk%WaveElevVisY)
+         call move_alloc(Inst%InitOutData%WaveElevVisGrid,Inst%vtk%WaveElevVisGrid )
       else
-         vtk%NWaveElevPts = 0
-         vtk%write = 0     ! FIXME throw warning if we do this
+         Inst%vtk%NWaveElevPts = 0
+         Inst%vtk%write = 0     ! FIXME throw warning if we do this
       endif
       ! get the name of the output directory for vtk files (in a subdirectory called "vtk" of the output directory), and
       ! create the VTK directory if it does not exist
-      call MKDIR( trim(vtk%outdir) )
-      vtk%OutRootName = trim(vtk%outdir) // PathSep //trim( vtk%OutRootName )
-      call WrVTK_WaveElevVisGrid  (0.0_DbKi, vtk, ErrStat2, ErrMsg2)
+      call MKDIR( trim(Inst%vtk%outdir) )
+      Inst%vtk%OutRootName = trim(Inst%vtk%outdir) // PathSep //trim( Inst%vtk%OutRootName )
+      call WrVTK_WaveElevVisGrid  (0.0_DbKi, Inst%p%WaveField%WaveTime, Inst%vtk, ErrStat2, ErrMsg2)
       if (Failed()) return
    end subroutine VTKsetup
 end subroutine SeaSt_C_Init
 
-subroutine SeaSt_C_CalcOutput(Time_C, OutputChannelValues_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_CalcOutput')
+subroutine SeaSt_C_CalcOutput(Handle_C, Time_C, OutputChannelValues_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_CalcOutput')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_CalcOutput
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_CalcOutput
 #endif
 
+   integer(c_int),             intent(in   ) :: Handle_C
    real(c_double),             intent(in   ) :: Time_C
-   real(c_float),              intent(  out) :: OutputChannelValues_C(p%NumOuts)
+   real(c_float),              intent(  out) :: OutputChannelValues_C(*)      !< NumChannels
    integer(c_int),             intent(  out) :: ErrStat_C
    character(kind=c_char),     intent(  out) :: ErrMsg_C(ErrMsgLen_C)
 
    ! Local variables
-   type(SeaSt_InputType)           :: u           !< An initial guess for the input; input mesh must be defined
-   type(SeaSt_ContinuousStateType) :: x           !< Initial continuous states
-   type(SeaSt_DiscreteStateType)   :: xd          !< Initial discrete states
-   type(SeaSt_ConstraintStateType) :: z           !< Initial guess of the constraint states
-   type(SeaSt_OtherStateType)      :: OtherState  !< Initial other states            
-
    real(DbKi)                 :: Time
    integer                    :: ErrStat, ErrStat2
    character(ErrMsgLen)       :: ErrMsg,  ErrMsg2
    character(*), parameter    :: RoutineName = 'SeaSt_C_CalcOutput'  !< for error handling
+   type(SeaSt_C_InstanceType), pointer  :: Inst
 
    ! Initialize error handling
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
    ErrStat =  ErrID_None
    ErrMsg  =  ""
 
    ! Debugging
-   if (DebugLevel > 1) call ShowPassedData()
+   if (Inst%DebugLevel > 1) call ShowPassedData()
 
    ! Convert the inputs from C to Fortran
    Time = REAL(Time_C,DbKi)
 
-   call SeaSt_CalcOutput( Time, u, p, x, xd, z, OtherState, y, m, ErrStat2, ErrMsg2 )
+   call SeaSt_CalcOutput( Time, Inst%u, Inst%p, Inst%x, Inst%xd, Inst%z, Inst%OtherState, Inst%y, Inst%m, ErrStat2, ErrMsg2 )
    if (Failed()) return
 
    ! Get the output channel info out of y
-   OutputChannelValues_C = REAL(y%WriteOutput, C_FLOAT)
+   OutputChannelValues_C(1:Inst%p%NumOuts) = REAL(Inst%y%WriteOutput, C_FLOAT)
 
-   if (vtk%write > 1_IntKi) then
-      call WrVTK_WaveElevVisGrid  (Time, vtk, ErrStat2, ErrMsg2)
+   if (Inst%vtk%write > 1_IntKi) then
+      call WrVTK_WaveElevVisGrid  (Time, Inst%p%WaveField%WaveTime, Inst%vtk, ErrStat2, ErrMsg2)
       if (Failed()) return
    endif
 
    call Cleanup()
 
    ! Debugging
-   if (DebugLevel > 1) call ShowReturnData()
+   if (Inst%DebugLevel > 1) call ShowReturnData()
 
 contains
    logical function Failed()
@@ -411,16 +440,17 @@ contains
    end subroutine ShowPassedData
    subroutine ShowReturnData()
       call WrScr("   OutputChannelValues_C  <-")
-      call WrMatrix(OutputChannelValues_C,CU,'g15.6')
+      call WrMatrix(OutputChannelValues_C(1:Inst%p%NumOuts),CU,'g15.6')
       call WrScr("-----------------------------------------------------------")
    end subroutine ShowReturnData
 end subroutine
 
-subroutine SeaSt_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_End')
+subroutine SeaSt_C_End(Handle_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_End')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_End
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_End
 #endif
+   integer(C_INT),             intent(in   ) :: Handle_C
    integer(C_INT),             intent(  out) :: ErrStat_C
    character(kind=C_CHAR),     intent(  out) :: ErrMsg_C(ErrMsgLen_C)
 
@@ -429,73 +459,96 @@ subroutine SeaSt_C_End(ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_End')
    integer                    :: ErrStat2                         !< temporary error status  from a call
    character(ErrMsgLen)       :: ErrMsg2                          !< temporary error message from a call
    character(*), parameter    :: RoutineName = 'SeaSt_C_End'  !< for error handling
+   type(SeaSt_C_InstanceType), pointer  :: Inst
    ErrStat  =  ErrID_None
    ErrMsg   =  ""
-   call SeaSt_End(u, p, x, xd, z, OtherState, y, m, ErrStat2, ErrMsg2)
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
+      return
+   endif
+   call SeaSt_End(Inst%u, Inst%p, Inst%x, Inst%xd, Inst%z, Inst%OtherState, Inst%y, Inst%m, ErrStat2, ErrMsg2)
    call SetErrStat( ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName )
-   call ClearMem()      ! ignoring any error handling from this
+   call ClearMem(Inst)  ! ignoring any error handling from this
+   call FreeInstance(Handle_C)
    call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
 end subroutine
 
 
 !> return the pointer to the WaveField data
-subroutine SeaSt_C_GetWaveFieldPointer(WaveFieldPointer_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetWaveFieldPointer')
+subroutine SeaSt_C_GetWaveFieldPointer(Handle_C, WaveFieldPointer_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetWaveFieldPointer')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetWaveFieldPointer
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetWaveFieldPointer
 #endif
+   integer(c_int),            intent(in   )  :: Handle_C
    type(c_ptr),               intent(  out)  :: WaveFieldPointer_C
    integer(c_int),            intent(  out)  :: ErrStat_C
    character(kind=c_char),    intent(  out)  :: ErrMsg_C(ErrMsgLen_C)
    integer                                   :: ErrStat
    character(ErrMsgLen)                      :: ErrMsg
    character(*),              parameter      :: RoutineName = 'SeaSt_C_GetWaveFieldPointer'
+   type(SeaSt_C_InstanceType), pointer       :: Inst
    logical                                   :: valid
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
    ErrStat = ErrID_None
    ErrMSg = ""
    WaveFieldPointer_C = C_NULL_PTR
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
-   if (valid) WaveFieldPointer_C = C_LOC(p%WaveField)
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
+   if (valid) WaveFieldPointer_C = C_LOC(Inst%p%WaveField)
    call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
-   if (DebugLevel > 1) call ShowPassedData()
+   if (Inst%DebugLevel > 1) call ShowPassedData()
    return
 contains
    subroutine ShowPassedData()
       call WrScr("-----------------------------------------------------------")
       call WrScr("Interface debugging:  SeaSt_C_GetWaveFieldPointer returns")
       call WrScr("   --------------------------------------------------------")
-      call WrScr("   WaveFieldPointer_C     <- "//trim(Num2LStr(loc(p%WaveField))))
+      call WrScr("   WaveFieldPointer_C     <- "//trim(Num2LStr(loc(Inst%p%WaveField))))
       call WrScr("-----------------------------------------------------------")
    end subroutine ShowPassedData
 end subroutine
 
 
 !> set the pointer to the WaveField data
-subroutine SeaSt_C_SetWaveFieldPointer(WaveFieldPointer_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_SetWaveFieldPointer')
+subroutine SeaSt_C_SetWaveFieldPointer(Handle_C, WaveFieldPointer_C,ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_SetWaveFieldPointer')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_SetWaveFieldPointer
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_SetWaveFieldPointer
 #endif
+   integer(c_int),            intent(in   )  :: Handle_C
    type(c_ptr),               intent(in   )  :: WaveFieldPointer_C
    integer(c_int),            intent(  out)  :: ErrStat_C
    character(kind=c_char),    intent(  out)  :: ErrMsg_C(ErrMsgLen_C)
    integer                                   :: ErrStat
    character(ErrMsgLen)                      :: ErrMsg
    character(*),              parameter      :: RoutineName = 'SeaSt_C_SetWaveFieldPointer'
+   type(SeaSt_C_InstanceType), pointer       :: Inst
    logical                                   :: valid
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
    ErrStat = ErrID_None
    ErrMSg = ""
-   call C_F_POINTER(WaveFieldPointer_C, p%WaveField)
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
+   call C_F_POINTER(WaveFieldPointer_C, Inst%p%WaveField)
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
    call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
-   if (DebugLevel > 1) call ShowPassedData()
+   if (Inst%DebugLevel > 1) call ShowPassedData()
    return
 contains
    subroutine ShowPassedData()
       call WrScr("-----------------------------------------------------------")
       call WrScr("Interface debugging:  SeaSt_C_SetWaveFieldPointer inputs")
       call WrScr("   --------------------------------------------------------")
-      call WrScr("   WaveFieldPointer_C     -> "//trim(Num2LStr(loc(p%WaveField))))
+      call WrScr("   WaveFieldPointer_C     -> "//trim(Num2LStr(loc(Inst%p%WaveField))))
       call WrScr("-----------------------------------------------------------")
    end subroutine ShowPassedData
 end subroutine
@@ -503,11 +556,12 @@ end subroutine
 
 !> Get the fluid velocity, acceleration, and node-in-water status at time+position coordinate
 !! NOTE: if wave stretching is turned off, the SWL is used as the cutoff for the nodeInWater and for Vel / Acc values 
-subroutine SeaSt_C_GetFluidVelAcc(Time_C, Pos_C, Vel_C, Acc_C, NodeInWater_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetFluidVelAcc')
+subroutine SeaSt_C_GetFluidVelAcc(Handle_C, Time_C, Pos_C, Vel_C, Acc_C, NodeInWater_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetFluidVelAcc')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetFluidVelAcc
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetFluidVelAcc
 #endif
+   integer(c_int),            intent(in   ) :: Handle_C
    real(c_double),            intent(in   ) :: Time_C
    real(c_float),             intent(in   ) :: Pos_c(3)
    real(c_float),             intent(  out) :: Vel_c(3)
@@ -525,9 +579,16 @@ subroutine SeaSt_C_GetFluidVelAcc(Time_C, Pos_C, Vel_C, Acc_C, NodeInWater_C, Er
    integer                    :: ErrStat, ErrStat2
    character(ErrMsgLen)       :: ErrMsg,  ErrMsg2
    character(*), parameter    :: RoutineName = 'SeaSt_C_GetFluidVelAcc'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
    logical                    :: valid
 
    ! Initialize
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
    ErrStat  =  ErrID_None
    ErrMsg   =  ""
    Vel_c    =  0.0_c_float
@@ -535,14 +596,14 @@ subroutine SeaSt_C_GetFluidVelAcc(Time_C, Pos_C, Vel_C, Acc_C, NodeInWater_C, Er
 
    forceNodeInWater = .false.
 
-   if (DebugLevel > 1) call ShowPassedData()
+   if (Inst%DebugLevel > 1) call ShowPassedData()
 
    ! convert position and time to fortran types
    Time = real(Time_C, DbKi)
    Pos = real(Pos_C, ReKi)
 
    ! verify there is actually wavefield data
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
    if (.not. valid) then
       call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
       return
@@ -553,7 +614,7 @@ subroutine SeaSt_C_GetFluidVelAcc(Time_C, Pos_C, Vel_C, Acc_C, NodeInWater_C, Er
    !     - if node is out of water, velocity and acceleration are zero
    !     - if position is outside the wave field boundary, it will simply return boundary edge value
    !     - time must be positive or a fatal error occurs
-   call WaveField_GetNodeWaveVelAcc( p%WaveField, m%WaveField_m, Time, pos, forceNodeInWater, fetchDynCurrent, nodeInWater, Vel, Acc, ErrStat, ErrMsg )
+   call WaveField_GetNodeWaveVelAcc( Inst%p%WaveField, Inst%m%WaveField_m, Time, pos, forceNodeInWater, fetchDynCurrent, nodeInWater, Vel, Acc, ErrStat, ErrMsg )
 
    ! Store resulting velocity and acceleration as C type
    Vel_c = real(Vel,c_float)
@@ -567,7 +628,7 @@ subroutine SeaSt_C_GetFluidVelAcc(Time_C, Pos_C, Vel_C, Acc_C, NodeInWater_C, Er
    endif
 
    call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )    ! convert error from fortran to C for return
-   if (DebugLevel > 1) call ShowReturnData()
+   if (Inst%DebugLevel > 1) call ShowReturnData()
    return
 contains
    subroutine ShowPassedData()
@@ -588,11 +649,12 @@ end subroutine SeaSt_C_GetFluidVelAcc
 
 
 !> return the surface elevation and normal vector at a point.
-subroutine SeaSt_C_GetSurfElev(Time_C, Pos_C, Elev_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetSurfElev')
+subroutine SeaSt_C_GetSurfElev(Handle_C, Time_C, Pos_C, Elev_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetSurfElev')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetSurfElev
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetSurfElev
 #endif
+   integer(c_int),            intent(in   ) :: Handle_C
    real(c_double),            intent(in   ) :: Time_C
    real(c_float),             intent(in   ) :: Pos_c(2)
    real(c_float),             intent(  out) :: Elev_C
@@ -605,16 +667,23 @@ subroutine SeaSt_C_GetSurfElev(Time_C, Pos_C, Elev_C, ErrStat_C,ErrMsg_C) BIND (
    integer                    :: ErrStat
    character(ErrMsgLen)       :: ErrMsg
    character(*), parameter    :: RoutineName = 'SeaSt_C_GetSurfElev'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
    logical                    :: valid
 
-   if (DebugLevel > 1) call ShowPassedData()
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   if (Inst%DebugLevel > 1) call ShowPassedData()
 
    ! convert position and time to fortran types
    Time = real(Time_C, DbKi)
    Pos = real(Pos_C(1:2), ReKi)
 
    ! verify there is actually wavefield data
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
    if (.not. valid) then
       call Cleanup()
       return
@@ -624,12 +693,12 @@ subroutine SeaSt_C_GetSurfElev(Time_C, Pos_C, Elev_C, ErrStat_C,ErrMsg_C) BIND (
    ! Notes:
    !     - if position is outside the wave field boundary, it will simply return boundary edge value
    !     - time must be positive or a fatal error occurs
-   Elev = WaveField_GetNodeTotalWaveElev( p%WaveField, m%WaveField_m, Time, pos, ErrStat, ErrMsg )
+   Elev = WaveField_GetNodeTotalWaveElev( Inst%p%WaveField, Inst%m%WaveField_m, Time, pos, ErrStat, ErrMsg )
 
    ! Store resulting elevation as C type
    Elev_C = real(Elev,c_float)
 
-   if (DebugLevel > 1) call ShowReturnData()
+   if (Inst%DebugLevel > 1) call ShowReturnData()
    call Cleanup()
    return
 contains
@@ -652,11 +721,12 @@ end subroutine SeaSt_C_GetSurfElev
 
 
 !> return the surface normal vector at a point.
-subroutine SeaSt_C_GetSurfNorm(Time_C, Pos_C, NormVec_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetSurfNorm')
+subroutine SeaSt_C_GetSurfNorm(Handle_C, Time_C, Pos_C, NormVec_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetSurfNorm')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetSurfNorm
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetSurfNorm
 #endif
+   integer(c_int),            intent(in   ) :: Handle_C
    real(c_double),            intent(in   ) :: Time_C
    real(c_float),             intent(in   ) :: Pos_c(2)
    real(c_float),             intent(  out) :: NormVec_C(3)
@@ -669,12 +739,19 @@ subroutine SeaSt_C_GetSurfNorm(Time_C, Pos_C, NormVec_C, ErrStat_C,ErrMsg_C) BIN
    integer                    :: ErrStat
    character(ErrMsgLen)       :: ErrMsg
    character(*), parameter    :: RoutineName = 'SeaSt_C_GetSurfNorm'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
    logical                    :: valid
 
-   if (DebugLevel > 1) call ShowPassedData()
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   if (Inst%DebugLevel > 1) call ShowPassedData()
 
    ! verify there is actually wavefield data
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
    if (.not. valid) then
       call Cleanup()
       return
@@ -685,12 +762,12 @@ subroutine SeaSt_C_GetSurfNorm(Time_C, Pos_C, NormVec_C, ErrStat_C,ErrMsg_C) BIN
    Pos = real(Pos_C(1:2), ReKi)
 
    ! get the normal vector at the point (set to vertical if outside region)
-   call WaveField_GetNodeWaveNormal( p%WaveField, m%WaveField_m, Time, pos, NormVec, ErrStat, ErrMsg )
+   call WaveField_GetNodeWaveNormal( Inst%p%WaveField, Inst%m%WaveField_m, Time, pos, NormVec, ErrStat, ErrMsg )
 
    ! Store resulting normal vector as C type
    NormVec_C = real(NormVec,c_float)
 
-   if (DebugLevel > 1) call ShowReturnData()
+   if (Inst%DebugLevel > 1) call ShowReturnData()
    call Cleanup()
    return
 contains
@@ -713,11 +790,12 @@ end subroutine SeaSt_C_GetSurfNorm
 
 !> return the min and max levels across entire wavefield.  This only needs to be called once at the
 !! start if desired
-subroutine SeaSt_C_GetElevMinMaxEstimate(Min_C, Max_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetElevMinMaxEstimate')
+subroutine SeaSt_C_GetElevMinMaxEstimate(Handle_C, Min_C, Max_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetElevMinMaxEstimate')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetElevMinMaxEstimate
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetElevMinMaxEstimate
 #endif
+   integer(c_int),            intent(in   ) :: Handle_C
    real(c_float),             intent(  out) :: Min_C
    real(c_float),             intent(  out) :: Max_C
    integer(c_int),            intent(  out) :: ErrStat_C
@@ -728,23 +806,30 @@ subroutine SeaSt_C_GetElevMinMaxEstimate(Min_C, Max_C, ErrStat_C,ErrMsg_C) BIND
    integer                    :: ErrStat
    character(ErrMsgLen)       :: ErrMsg
    character(*), parameter    :: RoutineName = 'SeaSt_C_GetElevMinMaxEstimate'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
    logical                    :: valid
 
-   if (DebugLevel > 1) call ShowPassedData()
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   if (Inst%DebugLevel > 1) call ShowPassedData()
 
    ! verify there is actually wavefield data
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
    if (.not. valid) then
       call Cleanup()
       return
    endif
 
    ! Measure directly from the data set (this is not ideal and will break if the layout changes)
-   call WaveField_GetMinMaxWaveElevEstimate( p%WaveField, MinElev, MaxElev, ErrStat, ErrMsg)
+   call WaveField_GetMinMaxWaveElevEstimate( Inst%p%WaveField, MinElev, MaxElev, ErrStat, ErrMsg)
    Min_C = real(MinElev, c_float)
    Max_C = real(MaxElev, c_float)
 
-   if (DebugLevel > 1) call ShowReturnData()
+   if (Inst%DebugLevel > 1) call ShowReturnData()
    call Cleanup()
    return
 contains
@@ -768,29 +853,37 @@ end subroutine SeaSt_C_GetElevMinMaxEstimate
 ! Routines to return environment vars
 !----------------------------------------------------------------------------------------------------------------------------------
 !> retrieve the water density
-subroutine SeaSt_C_GetDens(Dens_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_GetDens')
+subroutine SeaSt_C_GetDens(Handle_C, Dens_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_GetDens')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetDens
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetDens
 #endif
+   integer(c_int),            intent(in   ) :: Handle_C
    real(c_float),             intent(  out) :: Dens_C
    integer(c_int),            intent(  out) :: ErrStat_C
    character(kind=c_char),    intent(  out) :: ErrMsg_C(ErrMsgLen_C)
    integer                    :: ErrStat
    character(ErrMsgLen)       :: ErrMsg
    character(*), parameter    :: RoutineName = 'SeaSt_C_GetDens'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
    logical                    :: valid
 
    ! verify there is actually wavefield data
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
    if (.not. valid) then
       call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
       Dens_C = 0.0_c_float
       return
    endif
 
-   Dens_C = real(p%WaveField%WtrDens, c_float)
-   if (DebugLevel > 1) call ShowReturnData()
+   Dens_C = real(Inst%p%WaveField%WtrDens, c_float)
+   if (Inst%DebugLevel > 1) call ShowReturnData()
 contains
    subroutine ShowReturnData()
       call WrScr("-----------------------------------------------------------")
@@ -803,29 +896,37 @@ end subroutine
 
 
 !> retrieve the water depth
-subroutine SeaSt_C_GetDpth(Dpth_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_GetDpth')
+subroutine SeaSt_C_GetDpth(Handle_C, Dpth_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_GetDpth')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetDpth
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetDpth
 #endif
+   integer(c_int),            intent(in   ) :: Handle_C
    real(c_float),             intent(  out) :: Dpth_C
    integer(c_int),            intent(  out) :: ErrStat_C
    character(kind=c_char),    intent(  out) :: ErrMsg_C(ErrMsgLen_C)
    integer                    :: ErrStat
    character(ErrMsgLen)       :: ErrMsg
    character(*), parameter    :: RoutineName = 'SeaSt_C_GetDpth'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
    logical                    :: valid
 
    ! verify there is actually wavefield data
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
    if (.not. valid) then
       call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
       Dpth_C = 0.0_c_float
       return
    endif
 
-   Dpth_C = real(p%WaveField%WtrDpth, c_float)
-   if (DebugLevel > 1) call ShowReturnData()
+   Dpth_C = real(Inst%p%WaveField%WtrDpth, c_float)
+   if (Inst%DebugLevel > 1) call ShowReturnData()
 contains
    subroutine ShowReturnData()
       call WrScr("-----------------------------------------------------------")
@@ -838,29 +939,37 @@ end subroutine
 
 
 !> retrieve MSL to SWL distance
-subroutine SeaSt_C_GetMSL2SWL(MSL2SWL_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_GetMSL2SWL')
+subroutine SeaSt_C_GetMSL2SWL(Handle_C, MSL2SWL_C, ErrStat_C, ErrMsg_C) BIND (C, NAME='SeaSt_C_GetMSL2SWL')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetMSL2SWL
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetMSL2SWL
 #endif
+   integer(c_int),            intent(in   ) :: Handle_C
    real(c_float),             intent(  out) :: MSL2SWL_C
    integer(c_int),            intent(  out) :: ErrStat_C
    character(kind=c_char),    intent(  out) :: ErrMsg_C(ErrMsgLen_C)
    integer                    :: ErrStat
    character(ErrMsgLen)       :: ErrMsg
    character(*), parameter    :: RoutineName = 'SeaSt_C_GetMSL2SWL'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
    logical                    :: valid
 
    ! verify there is actually wavefield data
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
    if (.not. valid) then
       call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
       MSL2SWL_C = 0.0_c_float
       return
    endif
 
-   MSL2SWL_C = real(p%WaveField%MSL2SWL, c_float)
-   if (DebugLevel > 1) call ShowReturnData()
+   MSL2SWL_C = real(Inst%p%WaveField%MSL2SWL, c_float)
+   if (Inst%DebugLevel > 1) call ShowReturnData()
 contains
    subroutine ShowReturnData()
       call WrScr("-----------------------------------------------------------")
@@ -873,7 +982,8 @@ end subroutine
 
 
 !> routine to check if the WaveField pointer is valid. ErrStat==ErrID_None is a valid pointer
-subroutine CheckWaveFieldPtr(callingRoutine,valid,ErrStat,ErrMsg)
+subroutine CheckWaveFieldPtr(Inst,callingRoutine,valid,ErrStat,ErrMsg)
+   type(SeaSt_C_InstanceType),intent(in   ) :: Inst
    character(*),              intent(in   ) :: callingRoutine
    logical,                   intent(  out) :: valid
    integer(IntKi),            intent(  out) :: ErrStat
@@ -881,9 +991,9 @@ subroutine CheckWaveFieldPtr(callingRoutine,valid,ErrStat,ErrMsg)
    ErrStat = ErrID_None
    ErrMsg  = ""
    valid = .true.
-   if (associated(p%WaveField)) then
+   if (associated(Inst%p%WaveField)) then
       ! basic sanity check
-      if (.not. allocated(p%WaveField%WaveTime)) then
+      if (.not. allocated(Inst%p%WaveField%WaveTime)) then
          ErrStat = ErrID_Fatal
          ErrMsg  = trim(callingRoutine)//":: Invalid pointer passed in, or WaveField not initialized"
          valid = .false.
@@ -897,11 +1007,12 @@ end subroutine
 
 
 !> return the surface elevation and normal vector at a point.
-subroutine SeaSt_C_GetDynPressure(Time_C, Pos_C, DynP_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetDynPressure')
+subroutine SeaSt_C_GetDynPressure(Handle_C, Time_C, Pos_C, DynP_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetDynPressure')
 #ifndef IMPLICIT_DLLEXPORT
 !DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetDynPressure
 !GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetDynPressure
 #endif
+   integer(c_int),            intent(in   ) :: Handle_C
    real(c_double),            intent(in   ) :: Time_C
    real(c_float),             intent(in   ) :: Pos_c(3)
    real(c_float),             intent(  out) :: DynP_C
@@ -914,18 +1025,25 @@ subroutine SeaSt_C_GetDynPressure(Time_C, Pos_C, DynP_C, ErrStat_C,ErrMsg_C) BIN
    integer                    :: ErrStat
    character(ErrMsgLen)       :: ErrMsg
    character(*), parameter    :: RoutineName = 'SeaSt_C_GetDynPressure'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
    logical                    :: valid
    ! Temporary vars for calling GetNodeWaveKin -- remove if new interface developed
    integer(IntKi)             :: nodeInWater
 
-   if (DebugLevel > 1) call ShowPassedData()
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   if (Inst%DebugLevel > 1) call ShowPassedData()
 
    ! convert position and time to fortran types
    Time = real(Time_C, DbKi)
    Pos = real(Pos_C(1:3), ReKi)
 
    ! verify there is actually wavefield data
-   call CheckWaveFieldPtr(RoutineName, valid, ErrStat, ErrMsg)
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
    if (.not. valid) then
       call Cleanup()
       return
@@ -936,13 +1054,13 @@ subroutine SeaSt_C_GetDynPressure(Time_C, Pos_C, DynP_C, ErrStat_C,ErrMsg_C) BIN
    !     - if position is outside the wave field boundary, it will simply return boundary edge value
    !     - time must be positive or a fatal error occurs
    !     - forceNodeInWater = .false. -- perhaps update this later to allow throug interface?
-   call WaveField_GetDynP( p%WaveField, m%WaveField_m, Time, pos, .false., nodeInWater, FDynP, ErrStat, ErrMsg )
+   call WaveField_GetDynP( Inst%p%WaveField, Inst%m%WaveField_m, Time, pos, .false., nodeInWater, FDynP, ErrStat, ErrMsg )
 
 
    ! Store resulting elevation as C type
    DynP_C = real(FDynP,c_float)
 
-   if (DebugLevel > 1) call ShowReturnData()
+   if (Inst%DebugLevel > 1) call ShowReturnData()
    call Cleanup()
    return
 contains
@@ -963,13 +1081,223 @@ contains
 end subroutine SeaSt_C_GetDynPressure
 
 
+!===============================================================================================================
+!---------------------------------------- Multi-point wave field queries ---------------------------------------
+!===============================================================================================================
+!  The following routines are array versions of SeaSt_C_GetFluidVelAcc, SeaSt_C_GetSurfElev, and
+!  SeaSt_C_GetDynPressure.  All NumPts_C points are evaluated at the same time in a single call, so the
+!  handle lookup and WaveField check are only done once.  The point loop is run with OpenMP when enabled.
+!  Each thread works on its own copy of the wave field interpolation scratch data.
+
+!> Get the fluid velocity, acceleration, and node-in-water status at NumPts_C points at a single time.
+!! Positions are passed as a flat 3xNumPts_C array, velocities and accelerations are returned the same way.
+subroutine SeaSt_C_GetFluidVelAccPts(Handle_C, NumPts_C, Time_C, Pos_C, Vel_C, Acc_C, NodeInWater_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetFluidVelAccPts')
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetFluidVelAccPts
+!GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetFluidVelAccPts
+#endif
+   integer(c_int),            intent(in   ) :: Handle_C
+   integer(c_int),            intent(in   ) :: NumPts_C
+   real(c_double),            intent(in   ) :: Time_C
+   real(c_float),             intent(in   ) :: Pos_C(3*NumPts_C)
+   real(c_float),             intent(  out) :: Vel_C(3*NumPts_C)
+   real(c_float),             intent(  out) :: Acc_C(3*NumPts_C)
+   integer(c_int),            intent(  out) :: NodeInWater_C(NumPts_C)
+   integer(c_int),            intent(  out) :: ErrStat_C
+   character(kind=c_char),    intent(  out) :: ErrMsg_C(ErrMsgLen_C)
+   real(DbKi)                 :: Time
+   real(ReKi)                 :: Pos(3)
+   real(SiKi)                 :: Vel(3)
+   real(SiKi)                 :: Acc(3)
+   logical, parameter         :: forceNodeInWater = .false.
+   logical, parameter         :: fetchDynCurrent = .true.
+   integer(IntKi)             :: i, nodeInWater
+   integer                    :: ErrStat, ErrStat2
+   character(ErrMsgLen)       :: ErrMsg,  ErrMsg2
+   character(*), parameter    :: RoutineName = 'SeaSt_C_GetFluidVelAccPts'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
+   type(GridInterp_MiscVarType)         :: WaveField_mThd    ! per-thread wave field interpolation scratch
+   logical                    :: valid
+
+   if (NumPts_C > 0) then
+      Vel_C         = 0.0_c_float
+      Acc_C         = 0.0_c_float
+      NodeInWater_C = 0_c_int
+   endif
+
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
+   if (.not. valid) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   Time = real(Time_C, DbKi)
+
+   !$OMP PARALLEL DEFAULT(SHARED) PRIVATE(i, Pos, Vel, Acc, nodeInWater, ErrStat2, ErrMsg2, WaveField_mThd)
+   WaveField_mThd = Inst%m%WaveField_m
+   !$OMP DO SCHEDULE(STATIC)
+   do i = 1, NumPts_C
+      Pos = real(Pos_C(3*i-2:3*i), ReKi)
+      call WaveField_GetNodeWaveVelAcc( Inst%p%WaveField, WaveField_mThd, Time, Pos, forceNodeInWater, fetchDynCurrent, nodeInWater, Vel, Acc, ErrStat2, ErrMsg2 )
+      if (ErrStat2 /= ErrID_None) then
+         !$OMP CRITICAL(SeaSt_C_Pts)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         !$OMP END CRITICAL(SeaSt_C_Pts)
+      endif
+      Vel_C(3*i-2:3*i) = real(Vel, c_float)
+      Acc_C(3*i-2:3*i) = real(Acc, c_float)
+      if (nodeInWater == 1_IntKi) NodeInWater_C(i) = 1_c_int
+   enddo
+   !$OMP END DO
+   !$OMP CRITICAL(SeaSt_C_Pts)
+   Inst%m%WaveField_m%FirstWarn_Clamp = Inst%m%WaveField_m%FirstWarn_Clamp .and. WaveField_mThd%FirstWarn_Clamp
+   !$OMP END CRITICAL(SeaSt_C_Pts)
+   !$OMP END PARALLEL
+
+   call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
+end subroutine SeaSt_C_GetFluidVelAccPts
+
+
+!> Get the total surface elevation at NumPts_C (X,Y) points at a single time.
+!! Positions are passed as a flat 2xNumPts_C array.
+subroutine SeaSt_C_GetSurfElevPts(Handle_C, NumPts_C, Time_C, Pos_C, Elev_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetSurfElevPts')
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetSurfElevPts
+!GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetSurfElevPts
+#endif
+   integer(c_int),            intent(in   ) :: Handle_C
+   integer(c_int),            intent(in   ) :: NumPts_C
+   real(c_double),            intent(in   ) :: Time_C
+   real(c_float),             intent(in   ) :: Pos_C(2*NumPts_C)
+   real(c_float),             intent(  out) :: Elev_C(NumPts_C)
+   integer(c_int),            intent(  out) :: ErrStat_C
+   character(kind=c_char),    intent(  out) :: ErrMsg_C(ErrMsgLen_C)
+   real(DbKi)                 :: Time
+   real(ReKi)                 :: Pos(2)
+   integer(IntKi)             :: i
+   integer                    :: ErrStat, ErrStat2
+   character(ErrMsgLen)       :: ErrMsg,  ErrMsg2
+   character(*), parameter    :: RoutineName = 'SeaSt_C_GetSurfElevPts'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
+   type(GridInterp_MiscVarType)         :: WaveField_mThd    ! per-thread wave field interpolation scratch
+   logical                    :: valid
+
+   if (NumPts_C > 0) Elev_C = 0.0_c_float
+
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
+   if (.not. valid) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   Time = real(Time_C, DbKi)
+
+   !$OMP PARALLEL DEFAULT(SHARED) PRIVATE(i, Pos, ErrStat2, ErrMsg2, WaveField_mThd)
+   WaveField_mThd = Inst%m%WaveField_m
+   !$OMP DO SCHEDULE(STATIC)
+   do i = 1, NumPts_C
+      Pos = real(Pos_C(2*i-1:2*i), ReKi)
+      Elev_C(i) = real(WaveField_GetNodeTotalWaveElev( Inst%p%WaveField, WaveField_mThd, Time, Pos, ErrStat2, ErrMsg2 ), c_float)
+      if (ErrStat2 /= ErrID_None) then
+         !$OMP CRITICAL(SeaSt_C_Pts)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         !$OMP END CRITICAL(SeaSt_C_Pts)
+      endif
+   enddo
+   !$OMP END DO
+   !$OMP CRITICAL(SeaSt_C_Pts)
+   Inst%m%WaveField_m%FirstWarn_Clamp = Inst%m%WaveField_m%FirstWarn_Clamp .and. WaveField_mThd%FirstWarn_Clamp
+   !$OMP END CRITICAL(SeaSt_C_Pts)
+   !$OMP END PARALLEL
+
+   call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
+end subroutine SeaSt_C_GetSurfElevPts
+
+
+!> Get the dynamic pressure at NumPts_C points at a single time.
+!! Positions are passed as a flat 3xNumPts_C array.
+subroutine SeaSt_C_GetDynPressurePts(Handle_C, NumPts_C, Time_C, Pos_C, DynP_C, ErrStat_C,ErrMsg_C) BIND (C, NAME='SeaSt_C_GetDynPressurePts')
+#ifndef IMPLICIT_DLLEXPORT
+!DEC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetDynPressurePts
+!GCC$ ATTRIBUTES DLLEXPORT :: SeaSt_C_GetDynPressurePts
+#endif
+   integer(c_int),            intent(in   ) :: Handle_C
+   integer(c_int),            intent(in   ) :: NumPts_C
+   real(c_double),            intent(in   ) :: Time_C
+   real(c_float),             intent(in   ) :: Pos_C(3*NumPts_C)
+   real(c_float),             intent(  out) :: DynP_C(NumPts_C)
+   integer(c_int),            intent(  out) :: ErrStat_C
+   character(kind=c_char),    intent(  out) :: ErrMsg_C(ErrMsgLen_C)
+   real(DbKi)                 :: Time
+   real(ReKi)                 :: Pos(3)
+   real(SiKi)                 :: FDynP
+   integer(IntKi)             :: i, nodeInWater
+   integer                    :: ErrStat, ErrStat2
+   character(ErrMsgLen)       :: ErrMsg,  ErrMsg2
+   character(*), parameter    :: RoutineName = 'SeaSt_C_GetDynPressurePts'
+   type(SeaSt_C_InstanceType), pointer  :: Inst
+   type(GridInterp_MiscVarType)         :: WaveField_mThd    ! per-thread wave field interpolation scratch
+   logical                    :: valid
+
+   if (NumPts_C > 0) DynP_C = 0.0_c_float
+
+   call GetInstance(Handle_C, Inst, ErrStat, ErrMsg)
+   if (ErrStat >= AbortErrLev) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   call CheckWaveFieldPtr(Inst, RoutineName, valid, ErrStat, ErrMsg)
+   if (.not. valid) then
+      call SetErrStat_F2C(ErrStat, ErrMsg, ErrStat_C, ErrMsg_C)
+      return
+   endif
+
+   Time = real(Time_C, DbKi)
+
+   !$OMP PARALLEL DEFAULT(SHARED) PRIVATE(i, Pos, FDynP, nodeInWater, ErrStat2, ErrMsg2, WaveField_mThd)
+   WaveField_mThd = Inst%m%WaveField_m
+   !$OMP DO SCHEDULE(STATIC)
+   do i = 1, NumPts_C
+      Pos = real(Pos_C(3*i-2:3*i), ReKi)
+      call WaveField_GetDynP( Inst%p%WaveField, WaveField_mThd, Time, Pos, .false., nodeInWater, FDynP, ErrStat2, ErrMsg2 )
+      if (ErrStat2 /= ErrID_None) then
+         !$OMP CRITICAL(SeaSt_C_Pts)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         !$OMP END CRITICAL(SeaSt_C_Pts)
+      endif
+      DynP_C(i) = real(FDynP, c_float)
+   enddo
+   !$OMP END DO
+   !$OMP CRITICAL(SeaSt_C_Pts)
+   Inst%m%WaveField_m%FirstWarn_Clamp = Inst%m%WaveField_m%FirstWarn_Clamp .and. WaveField_mThd%FirstWarn_Clamp
+   !$OMP END CRITICAL(SeaSt_C_Pts)
+   !$OMP END PARALLEL
+
+   call SetErrStat_F2C( ErrStat, ErrMsg, ErrStat_C, ErrMsg_C )
+end subroutine SeaSt_C_GetDynPressurePts
+
+
 !FIXME: the following visualization writer should be merged into the library vtk.f90
 !        this is a modified duplicate of the routine from FAST_Subs by the same name.
 !FIXME: this routine currently only grabs the closest timestep and does not do any interpolation
 !----------------------------------------------------------------------------------------------------------------------------------
 !> This subroutine writes the wave elevation data for a given time step
-subroutine WrVTK_WaveElevVisGrid(t_global, vtk, ErrStat, ErrMsg)
+subroutine WrVTK_WaveElevVisGrid(t_global, WaveTime, vtk, ErrStat, ErrMsg)
    real(DbKi),                intent(in   )  :: t_global       !< Current global time
+   real(SiKi),                intent(in   )  :: WaveTime(:)    !< WaveField time array
    type(VTKvis),              intent(inout)  :: vtk
    integer(IntKi),            intent(  out)  :: ErrStat
    character(ErrMsgLen),      intent(  out)  :: ErrMsg
@@ -1017,7 +1345,7 @@ subroutine WrVTK_WaveElevVisGrid(t_global, vtk, ErrStat, ErrMsg)
 
    ! I'm not going to interpolate in time; I'm just going to get the index of the closest wave time value
    t = REAL(t_global,SiKi)
-   call GetWaveElevIndx( t, p%WaveField%WaveTime, vtk%LastWaveIndx )
+   call GetWaveElevIndx( t, WaveTime, vtk%LastWaveIndx )
 
    do ix=1,vtk%NWaveElevPts(1)
       do iy=1,vtk%NWaveElevPts(2)
@@ -1094,13 +1422,85 @@ contains
 end subroutine WrVTK_WaveElevVisGrid
 
 !> clear any memory that the _End routine would not clear. Note we are ignoring any errors
-subroutine ClearMem()
+subroutine ClearMem(Inst)
+   type(SeaSt_C_InstanceType), intent(inout) :: Inst
    integer(IntKi)       :: ErrStat2
    character(ErrMsgLen) :: ErrMsg2
-   if (allocated(vtk%WaveElevVisX   )) deallocate(vtk%WaveElevVisX   )
-   if (allocated(vtk%WaveElevVisY   )) deallocate(vtk%WaveElevVisY   )
-   if (allocated(vtk%WaveElevVisGrid)) deallocate(vtk%WaveElevVisGrid)
-   call SeaSt_DestroyInitInput( InitInp,     ErrStat2, ErrMsg2)
-   call SeaSt_DestroyInitOutput(InitOutData, ErrStat2, ErrMsg2)
+   if (allocated(Inst%vtk%WaveElevVisX   )) deallocate(Inst%vtk%WaveElevVisX   )
+   if (allocated(Inst%vtk%WaveElevVisY   )) deallocate(Inst%vtk%WaveElevVisY   )
+   if (allocated(Inst%vtk%WaveElevVisGrid)) deallocate(Inst%vtk%WaveElevVisGrid)
+   call SeaSt_DestroyInitInput( Inst%InitInp,     ErrStat2, ErrMsg2)
+   call SeaSt_DestroyInitOutput(Inst%InitOutData, ErrStat2, ErrMsg2)
 end subroutine ClearMem
+
+!> Create a new instance and return its handle.  Slots freed by SeaSt_C_End are reused.
+subroutine NewInstance(Handle, Inst, ErrStat, ErrMsg)
+   integer(c_int),                     intent(  out) :: Handle      !< handle (index into Instances)
+   type(SeaSt_C_InstanceType), pointer,  intent(  out) :: Inst        !< new instance data
+   integer,                            intent(  out) :: ErrStat
+   character(ErrMsgLen),               intent(  out) :: ErrMsg
+   type(SeaSt_C_InstancePtr), allocatable           :: TmpList(:)
+   integer                                          :: i, NumOld, ErrStat2
+   character(*), parameter                          :: RoutineName = 'NewInstance'
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   Handle  = 0_c_int
+   Inst    => NULL()
+
+   ! find a free slot, growing the list if there is none
+   NumOld = 0
+   if (allocated(Instances)) NumOld = size(Instances)
+   do i = 1, NumOld
+      if (.not. associated(Instances(i)%Inst)) exit
+   enddo
+   if (i > NumOld) then
+      allocate(TmpList(max(4, 2*NumOld)), STAT=ErrStat2)
+      if (ErrStat2 /= 0) then
+         call SetErrStat(ErrID_Fatal, "Could not allocate instance list", ErrStat, ErrMsg, RoutineName)
+         return
+      endif
+      if (NumOld > 0) TmpList(1:NumOld) = Instances
+      call move_alloc(TmpList, Instances)
+   endif
+
+   allocate(Instances(i)%Inst, STAT=ErrStat2)
+   if (ErrStat2 /= 0) then
+      call SetErrStat(ErrID_Fatal, "Could not allocate instance data", ErrStat, ErrMsg, RoutineName)
+      return
+   endif
+   Inst   => Instances(i)%Inst
+   Handle =  int(i, c_int)
+end subroutine NewInstance
+
+
+!> Return the instance data for a handle, or a fatal error if the handle is not in use
+subroutine GetInstance(Handle, Inst, ErrStat, ErrMsg)
+   integer(c_int),                     intent(in   ) :: Handle
+   type(SeaSt_C_InstanceType), pointer,  intent(  out) :: Inst
+   integer,                            intent(  out) :: ErrStat
+   character(ErrMsgLen),               intent(  out) :: ErrMsg
+
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+   Inst    => NULL()
+   if (allocated(Instances)) then
+      if (Handle >= 1 .and. Handle <= size(Instances)) Inst => Instances(Handle)%Inst
+   endif
+   if (.not. associated(Inst)) then
+      ErrStat = ErrID_Fatal
+      ErrMsg  = "Invalid SeaState instance handle "//trim(Num2LStr(int(Handle,IntKi)))//". Was SeaSt_C_PreInit called?"
+   endif
+end subroutine GetInstance
+
+
+!> Release the instance data for a handle.  Data inside the instance must already be destroyed.
+subroutine FreeInstance(Handle)
+   integer(c_int),                     intent(in   ) :: Handle
+   if (.not. allocated(Instances)) return
+   if (Handle < 1 .or. Handle > size(Instances)) return
+   if (associated(Instances(Handle)%Inst)) deallocate(Instances(Handle)%Inst)
+   Instances(Handle)%Inst => NULL()
+end subroutine FreeInstance
+
 end module SeaState_C_Binding
@@ -54,6 +54,7 @@ subroutine SeaSt_ParseInput( InputFileName, OutRootName, defWtrDens, defWtrDpth,
    real(ReKi), allocatable                      :: tmpReArray(:)        ! Temporary array storage of the joint output list
    character(1)                                 :: Line1                ! The first character of an input line
    integer(IntKi)                               :: CurLine              !< Current entry in FileInfo_In%Lines array
+   integer(IntKi)                               :: I                    ! Generic loop counter
    integer(IntKi)                               :: IOS
    integer(IntKi)                               :: ErrStat2
    character(ErrMsgLen)                         :: ErrMsg2
@@ -483,6 +484,22 @@ subroutine SeaSt_ParseInput( InputFileName, OutRootName, defWtrDens, defWtrDpth,
    call ReadOutputListFromFileInfo( FileInfo_In, CurLine, InputFileData%OutList, InputFileData%NumOuts, ErrStat2, ErrMsg2, UnEc )
          if (Failed()) return;
 
+   !-------------------------------------------------------------------------------------------------
+   ! Optional advanced options following the end of the output list
+   !-------------------------------------------------------------------------------------------------
+   InputFileData%WaveKinEval = WaveKinEval_Grid
+   do I = CurLine, FileInfo_In%NumLines
+      Line = FileInfo_In%Lines(I)
+      call Conv2UC( Line )
+      if ( index(Line, 'WAVEKINEVAL') > 1 ) then
+            ! WaveKinEval - Evaluation of the first-order wave kinematics {0: interpolated from the volume grid, 1: summed from the wave components at each requested position}
+         CurLine = I
+         call ParseVar( FileInfo_In, CurLine, 'WaveKinEval', InputFileData%WaveKinEval, ErrStat2, ErrMsg2, UnEc )
+            if (Failed())  return;
+         exit
+      end if
+   end do
+
 contains
    !..............................
    logical function Failed()
@@ -1046,6 +1063,27 @@ subroutine SeaStateInput_ProcessInitData( InitInp, p, InputFileData, ErrStat, Er
          RETURN
       END IF
    END IF
+
+   !-------------------------------------------------------------------------------------------------
+   ! Data section for evaluation of the wave kinematics
+   !-------------------------------------------------------------------------------------------------
+   IF ( InputFileData%WaveKinEval == WaveKinEval_Spectral ) THEN
+      IF ( InputFileData%WaveMod == WaveMod_None .OR. InputFileData%WaveMod == WaveMod_ExtFull ) THEN
+         CALL SetErrStat( ErrID_Fatal,' WaveKinEval = 1 requires wave components and cannot be used with WaveMod = 0 or 6. Set WaveKinEval to 0.',ErrStat,ErrMsg,RoutineName)
+         RETURN
+      END IF
+      IF ( InputFileData%Waves2%WvDiffQTFF .OR. InputFileData%Waves2%WvSumQTFF ) THEN
+         CALL SetErrStat( ErrID_Fatal,' WaveKinEval = 1 only supports first-order wave kinematics. Set WaveKinEval to 0 or set both WvDiffQTF and WvSumQTF to false.',ErrStat,ErrMsg,RoutineName)
+         RETURN
+      END IF
+      IF ( InitInp%WrWvKinMod == 2 ) THEN
+         CALL SetErrStat( ErrID_Fatal,' The full wave kinematics cannot be written (WrWvKinMod = 2) when WaveKinEval = 1.',ErrStat,ErrMsg,RoutineName)
+         RETURN
+      END IF
+   ELSE IF ( InputFileData%WaveKinEval /= WaveKinEval_Grid ) THEN
+      CALL SetErrStat( ErrID_Fatal,' WaveKinEval must be 0 or 1.',ErrStat,ErrMsg,RoutineName)
+      RETURN
+   END IF
    
    !-------------------------------------------------------------------------------------------------
    ! Data section for OUTPUT
@@ -1170,6 +1208,7 @@ subroutine SeaStateInput_ProcessInitData( InitInp, p, InputFileData, ErrStat, Er
    
    p%WaveField%WaveMod      = InputFileData%WaveMod
    p%WaveField%WaveStMod    = InputFileData%WaveStMod
+   p%WaveField%WaveKinEval  = InputFileData%WaveKinEval
    p%WaveField%WvCrntMod    = InputFileData%WvCrntMod
    p%WaveField%WtrDens      = InputFileData%WtrDens     ! may have overwritten default InitInp
    p%WaveField%RhoXg        = p%WaveField%WtrDens*InitInp%Gravity               ! For WAMIT and WAMIT2
@@ -83,6 +83,7 @@ IMPLICIT NONE
     REAL(SiKi)  :: WaveDOmega = 0.0_R4Ki      !< Frequency step for incident wave calculations [(rad/s)]
     INTEGER(IntKi)  :: WaveMod = 0_IntKi      !< Incident wave kinematics model: See valid values in SeaSt_WaveField module parameters. [-]
     INTEGER(IntKi)  :: WvCrntMod = 0_IntKi      !< Wave-current modeling option [-]
+    INTEGER(IntKi)  :: WaveKinEval = 0      !< Evaluation of the first-order wave kinematics {0: interpolated from the volume grid, 1: summed from the wave components at each requested position} [-]
   END TYPE SeaSt_InputFile
 ! =======================
 ! =========  SeaSt_InitInputType  =======
@@ -322,6 +323,7 @@ subroutine SeaSt_CopyInputFile(SrcInputFileData, DstInputFileData, CtrlCode, Err
    DstInputFileData%WaveDOmega = SrcInputFileData%WaveDOmega
    DstInputFileData%WaveMod = SrcInputFileData%WaveMod
    DstInputFileData%WvCrntMod = SrcInputFileData%WvCrntMod
+   DstInputFileData%WaveKinEval = SrcInputFileData%WaveKinEval
 end subroutine
 
 subroutine SeaSt_DestroyInputFile(InputFileData, ErrStat, ErrMsg)
@@ -406,6 +408,7 @@ subroutine SeaSt_PackInputFile(RF, Indata)
    call RegPack(RF, InData%WaveDOmega)
    call RegPack(RF, InData%WaveMod)
    call RegPack(RF, InData%WvCrntMod)
+   call RegPack(RF, InData%WaveKinEval)
    if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
@@ -459,6 +462,7 @@ subroutine SeaSt_UnPackInputFile(RF, OutData)
    call RegUnpack(RF, OutData%WaveDOmega); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%WaveMod); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%WvCrntMod); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%WaveKinEval); if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
 subroutine SeaSt_CopyInitInput(SrcInitInputData, DstInitInputData, CtrlCode, ErrStat, ErrMsg)
@@ -791,6 +795,20 @@ subroutine SeaSt_CopyContState(SrcContStateData, DstContStateData, CtrlCode, Err
    DstContStateData%UnusedStates = SrcContStateData%UnusedStates
 end subroutine
 
+subroutine SeaSt_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(SeaSt_ContinuousStateType), intent(inout) :: ContStateData1
+   type(SeaSt_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki) :: tmp_UnusedStates
+   character(*), parameter        :: RoutineName = 'SeaSt_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_UnusedStates = ContStateData1%UnusedStates
+   ContStateData1%UnusedStates = ContStateData2%UnusedStates
+   ContStateData2%UnusedStates = tmp_UnusedStates
+end subroutine
+
 subroutine SeaSt_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(SeaSt_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -829,6 +847,20 @@ subroutine SeaSt_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, Err
    DstDiscStateData%UnusedStates = SrcDiscStateData%UnusedStates
 end subroutine
 
+subroutine SeaSt_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(SeaSt_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(SeaSt_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki) :: tmp_UnusedStates
+   character(*), parameter        :: RoutineName = 'SeaSt_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_UnusedStates = DiscStateData1%UnusedStates
+   DiscStateData1%UnusedStates = DiscStateData2%UnusedStates
+   DiscStateData2%UnusedStates = tmp_UnusedStates
+end subroutine
+
 subroutine SeaSt_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(SeaSt_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -867,6 +899,20 @@ subroutine SeaSt_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCod
    DstConstrStateData%UnusedStates = SrcConstrStateData%UnusedStates
 end subroutine
 
+subroutine SeaSt_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(SeaSt_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(SeaSt_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki) :: tmp_UnusedStates
+   character(*), parameter        :: RoutineName = 'SeaSt_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_UnusedStates = ConstrStateData1%UnusedStates
+   ConstrStateData1%UnusedStates = ConstrStateData2%UnusedStates
+   ConstrStateData2%UnusedStates = tmp_UnusedStates
+end subroutine
+
 subroutine SeaSt_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(SeaSt_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -905,6 +951,20 @@ subroutine SeaSt_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode,
    DstOtherStateData%UnusedStates = SrcOtherStateData%UnusedStates
 end subroutine
 
+subroutine SeaSt_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(SeaSt_OtherStateType), intent(inout) :: OtherStateData1
+   type(SeaSt_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki) :: tmp_UnusedStates
+   character(*), parameter        :: RoutineName = 'SeaSt_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_UnusedStates = OtherStateData1%UnusedStates
+   OtherStateData1%UnusedStates = OtherStateData2%UnusedStates
+   OtherStateData2%UnusedStates = tmp_UnusedStates
+end subroutine
+
 subroutine SeaSt_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(SeaSt_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1209,6 +1269,20 @@ subroutine SeaSt_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg
    DstInputData%DummyInput = SrcInputData%DummyInput
 end subroutine
 
+subroutine SeaSt_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(SeaSt_InputType), intent(inout) :: InputData1
+   type(SeaSt_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(SiKi) :: tmp_DummyInput
+   character(*), parameter        :: RoutineName = 'SeaSt_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyInput = InputData1%DummyInput
+   InputData1%DummyInput = InputData2%DummyInput
+   InputData2%DummyInput = tmp_DummyInput
+end subroutine
+
 subroutine SeaSt_DestroyInput(InputData, ErrStat, ErrMsg)
    type(SeaSt_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
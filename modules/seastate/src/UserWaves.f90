@@ -65,9 +65,13 @@ SUBROUTINE Initial_InitOut_Arrays(InitOut, WaveField, InitInp, WaveDT, ErrStat,
       ALLOCATE ( WaveField%WaveDirArr (   0:WaveField%NStepWave2                ) , STAT=ErrStat2 );  IF (ErrStat2 /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveField%WaveDirArr.',ErrStat, ErrMsg, RoutineName)
    
       ALLOCATE ( WaveField%WaveElev1(0:WaveField%NStepWave,InitInp%NGrid(1),InitInp%NGrid(2)                   ), STAT=ErrStat2 ); IF (ErrStat2 /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveField%WaveElev1.', ErrStat,ErrMsg,RoutineName)
-      ALLOCATE ( WaveField%WaveDynP (0:WaveField%NStepWave,InitInp%NGrid(1),InitInp%NGrid(2),InitInp%NGrid(3)  ), STAT=ErrStat2 ); IF (ErrStat2 /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveField%WaveDynP.', ErrStat,ErrMsg,RoutineName)
-      ALLOCATE ( WaveField%WaveVel  (0:WaveField%NStepWave,InitInp%NGrid(1),InitInp%NGrid(2),InitInp%NGrid(3),3), STAT=ErrStat2 ); IF (ErrStat2 /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveField%WaveVel.',  ErrStat,ErrMsg,RoutineName)
-      ALLOCATE ( WaveField%WaveAcc  (0:WaveField%NStepWave,InitInp%NGrid(1),InitInp%NGrid(2),InitInp%NGrid(3),3), STAT=ErrStat2 ); IF (ErrStat2 /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveField%WaveAcc.',  ErrStat,ErrMsg,RoutineName)
+
+      ! The volume grid is not needed when the kinematics are summed from the wave components at each requested position
+      IF ( WaveField%WaveKinEval == WaveKinEval_Grid ) THEN
+         ALLOCATE ( WaveField%WaveDynP (0:WaveField%NStepWave,InitInp%NGrid(1),InitInp%NGrid(2),InitInp%NGrid(3)  ), STAT=ErrStat2 ); IF (ErrStat2 /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveField%WaveDynP.', ErrStat,ErrMsg,RoutineName)
+         ALLOCATE ( WaveField%WaveVel  (0:WaveField%NStepWave,InitInp%NGrid(1),InitInp%NGrid(2),InitInp%NGrid(3),3), STAT=ErrStat2 ); IF (ErrStat2 /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveField%WaveVel.',  ErrStat,ErrMsg,RoutineName)
+         ALLOCATE ( WaveField%WaveAcc  (0:WaveField%NStepWave,InitInp%NGrid(1),InitInp%NGrid(2),InitInp%NGrid(3),3), STAT=ErrStat2 ); IF (ErrStat2 /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array WaveField%WaveAcc.',  ErrStat,ErrMsg,RoutineName)
+      END IF
 
       
       if (ErrStat >= AbortErrLev) return
@@ -87,9 +91,11 @@ SUBROUTINE Initial_InitOut_Arrays(InitOut, WaveField, InitInp, WaveDT, ErrStat,
       WaveField%WaveElevC  = 0.0
       WaveField%WaveElevC0 = 0.0
       WaveField%WaveElev1  = 0.0
-      WaveField%WaveDynP   = 0.0
-      WaveField%WaveVel    = 0.0
-      WaveField%WaveAcc    = 0.0
+      IF ( WaveField%WaveKinEval == WaveKinEval_Grid ) THEN
+         WaveField%WaveDynP   = 0.0
+         WaveField%WaveVel    = 0.0
+         WaveField%WaveAcc    = 0.0
+      END IF
       WaveField%WaveDirArr = 0.0
       
       ! scalars (adjusted later, if necessary)
@@ -47,6 +47,9 @@ MODULE Waves
    PRIVATE:: BoxMuller
    PRIVATE:: JONSWAP
    PUBLIC :: WaveNumber
+   PUBLIC :: COSHNumOvrCOSHDen
+   PUBLIC :: COSHNumOvrSINHDen
+   PUBLIC :: SINHNumOvrSINHDen
    PRIVATE:: UserWaveSpctrm
    PRIVATE:: StillWaterWaves_Init
    PRIVATE:: VariousWaves_Init
@@ -743,15 +746,21 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
    INTEGER   , ALLOCATABLE      :: WaveKinPrimeMap(:)
    REAL(SiKi)                   :: OmegaI                   ! Wave intrinsic frequency (rad/sec)
    REAL(SiKi)                   :: WaveNmbr                 ! Wavenumber of the current frequency component (1/meter)
+   REAL(SiKi), ALLOCATABLE      :: OmegaIArr(:)             ! Wave intrinsic frequency of each positive frequency component (rad/sec)
+   REAL(SiKi), ALLOCATABLE      :: WaveNmbrArr(:)           ! Wavenumber of each positive frequency component (1/meter)
+   INTEGER                      :: NStepWaveProp            ! Highest frequency component at which the waves propagate (all components above it are zero)
+   LOGICAL                      :: GridKin                  ! .TRUE. if the unstretched kinematics are tabulated on the volume grid; otherwise they are summed from the wave components on demand
    REAL(SiKi), ALLOCATABLE      :: WaveVel0Hxi    (:,:)     ! Instantaneous xi-direction velocity   of incident waves before applying stretching at the zi-coordinates for points (m/s  )
    REAL(SiKi), ALLOCATABLE      :: WaveVel0Hyi    (:,:)     ! Instantaneous yi-direction velocity   of incident waves before applying stretching at the zi-coordinates for points (m/s  )
    REAL(SiKi), ALLOCATABLE      :: WaveVel0V (:,:)          ! Instantaneous vertical     velocity   of incident waves before applying stretching at the zi-coordinates for points (m/s  )
    INTEGER                      :: I,J,K,count              ! Generic index
+   INTEGER                      :: ii,jj                    ! Grid indices of the current XY point
    INTEGER                      :: NWaveKin0Prime           ! Number of points where the incident wave kinematics will be computed before applying stretching to the instantaneous free surface (-)
    integer                      :: primeCount               ! Counter for locations before applying stretching
    COMPLEX(SiKi)                :: tmpComplex               ! A temporary varible to hold the complex value of the wave elevation before storing it into a REAL array
    COMPLEX(SiKi),ALLOCATABLE    :: tmpComplexArr(:)         ! A temporary array (0:NStepWave2-1) for FFT use.
    TYPE(FFT_DataType)           :: FFT_Data                 ! the instance of the FFT module we're using
+   TYPE(FFT_DataType)           :: FFT_DataThd              ! the instance of the FFT module used by the current OpenMP thread
 
    REAL(SiKi), ALLOCATABLE      :: WaveS1SddArr(:)          !< One-sided power spectral density of the wave spectrum at all non-negative frequencies (m^2/(rad/s))
    REAL(SiKi), ALLOCATABLE      :: OmegaArr(:)              !< Array of all non-negative angular frequencies (rad/s)
@@ -761,7 +770,7 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
    REAL(SiKi)                   :: JPrime
    REAL(SiKi)                   :: YPrime
    REAL(SiKi)                   :: HPrime
-   REAL(SiKi)                   :: MCFC
+   REAL(SiKi), ALLOCATABLE      :: MCFCArr(:)               ! Wavenumber-dependent acceleration scaling of each positive frequency component
    COMPLEX(SiKi), ALLOCATABLE   :: WaveAccC0HxiMCF(:,:)     ! Discrete Fourier transform of the instantaneous horizontal acceleration in x-direction of incident waves before applying stretching at the zi-coordinates for points (m/s^2)
    COMPLEX(SiKi), ALLOCATABLE   :: WaveAccC0HyiMCF(:,:)     ! Discrete Fourier transform of the instantaneous horizontal acceleration in y-direction of incident waves before applying stretching at the zi-coordinates for points (m/s^2)
    COMPLEX(SiKi), ALLOCATABLE   :: WaveAccC0VMCF(:,:)       ! Discrete Fourier transform of the instantaneous vertical   acceleration                of incident waves before applying stretching at the zi-coordinates for points (m/s^2)
@@ -794,6 +803,8 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
    ! Tell our users what is about to happen that may take a while:
    CALL WrScr ( ' Generating incident wave kinematics and current time history.' )
 
+   GridKin = WaveField%WaveKinEval == WaveKinEval_Grid
+
 
 
    ! Determine the number of, NWaveKin0Prime, and the zi-coordinates for,
@@ -804,7 +815,7 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
    NWaveKin0Prime = 0
    DO J = 1,InitInp%NWaveKinGrid   ! Loop through all mesh points  where the incident wave kinematics will be computed
          ! NOTE: We test to 0 instead of MSL2SWL because the locations of WaveKinGridzi and EffWtrDpth have already been adjusted using MSL2SWL
-     IF (    InitInp%WaveKinGridzi(J) >= -WaveField%EffWtrDpth .AND. InitInp%WaveKinGridzi(J) <= 0 )  THEN
+     IF ( GridKin .AND. InitInp%WaveKinGridzi(J) >= -WaveField%EffWtrDpth .AND. InitInp%WaveKinGridzi(J) <= 0 )  THEN
          NWaveKin0Prime = NWaveKin0Prime + 1
      END IF
    END DO                ! J - All Morison nodes where the incident wave kinematics will be computed
@@ -826,7 +837,7 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
    DO J = 1,InitInp%NWaveKinGrid ! Loop through all points where the incident wave kinematics will be computed without stretching
          ! NOTE: We test to 0 instead of MSL2SWL because the locations of WaveKinGridzi and EffWtrDpth have already been adjusted using MSL2SWL
-      IF (    InitInp%WaveKinGridzi(J) >= -WaveField%EffWtrDpth .AND. InitInp%WaveKinGridzi(J) <= 0 )  THEN
+      IF ( GridKin .AND. InitInp%WaveKinGridzi(J) >= -WaveField%EffWtrDpth .AND. InitInp%WaveKinGridzi(J) <= 0 )  THEN
 
          WaveKinzi0Prime(I) =  InitInp%WaveKinGridzi(J)
          WaveKinPrimeMap(I) =  J
@@ -949,11 +960,13 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
       ALLOCATE ( WaveAcc0HxiMCF (0:WaveField%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp ); if (Failed0('WaveAcc0HxiMCF ')) return;
       ALLOCATE ( WaveAcc0HyiMCF (0:WaveField%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp ); if (Failed0('WaveAcc0HyiMCF ')) return;
       ALLOCATE ( WaveAcc0VMCF   (0:WaveField%NStepWave-1,NWaveKin0Prime   ), STAT=ErrStatTmp ); if (Failed0('WaveAcc0VMCF   ')) return;
-      ALLOCATE ( WaveField%WaveAccMCF  (0:WaveField%NStepWave,InitInp%NGrid(1),InitInp%NGrid(2),InitInp%NGrid(3),3), STAT=ErrStatTmp ); if (Failed0('WaveField%WaveAccMCF')) return;
+      IF (GridKin) THEN
+         ALLOCATE ( WaveField%WaveAccMCF  (0:WaveField%NStepWave,InitInp%NGrid(1),InitInp%NGrid(2),InitInp%NGrid(3),3), STAT=ErrStatTmp ); if (Failed0('WaveField%WaveAccMCF')) return;
+      END IF
    END IF
    
    
-   IF (WaveField%WaveStMod .EQ. 2_IntKi) THEN ! Extrapolation Wave Stretching
+   IF (WaveField%WaveStMod .EQ. 2_IntKi .AND. GridKin) THEN ! Extrapolation Wave Stretching
       ALLOCATE ( PWaveDynPC0BPz0   (0:WaveField%NStepWave2 ,InitInp%NWaveElevGrid), STAT=ErrStatTmp ); if (Failed0('PWaveDynPC0BPz0 ')) return;
       ALLOCATE ( PWaveVelC0HxiPz0  (0:WaveField%NStepWave2 ,InitInp%NWaveElevGrid), STAT=ErrStatTmp ); if (Failed0('PWaveVelC0HxiPz0')) return;
       ALLOCATE ( PWaveVelC0HyiPz0  (0:WaveField%NStepWave2 ,InitInp%NWaveElevGrid), STAT=ErrStatTmp ); if (Failed0('PWaveVelC0HyiPz0')) return;
@@ -988,6 +1001,9 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
    ALLOCATE ( CosWaveDir( 0:WaveField%NStepWave2                          ), STAT=ErrStatTmp ); if (Failed0('CosWaveDir')) return;
    ALLOCATE ( SinWaveDir( 0:WaveField%NStepWave2                          ), STAT=ErrStatTmp ); if (Failed0('SinWaveDir')) return;
    ALLOCATE ( OmegaArr( 0:WaveField%NStepWave2                            ), STAT=ErrStatTmp ); if (Failed0('OmegaArr  ')) return;
+   ALLOCATE ( OmegaIArr( 0:WaveField%NStepWave2                           ), STAT=ErrStatTmp ); if (Failed0('OmegaIArr ')) return;
+   ALLOCATE ( WaveNmbrArr( 0:WaveField%NStepWave2                         ), STAT=ErrStatTmp ); if (Failed0('WaveNmbrArr')) return;
+   ALLOCATE ( MCFCArr( 0:WaveField%NStepWave2                             ), STAT=ErrStatTmp ); if (Failed0('MCFCArr   ')) return;
    
    ! Arrays for the constrained wave
    ALLOCATE ( WaveS1SddArr( 0:WaveField%NStepWave2                        ), STAT=ErrStatTmp ); if (Failed0('WaveS1SddArr')) return;
@@ -1085,93 +1101,54 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
    !--------------------------------------------------------------------------------
    !> ## Compute IFFTs
-   !> Compute the discrete Fourier transform of the instantaneous elevation of
-   !!   incident waves at each desired point on the still water level plane
-   !!   where it can be output:
+   !> The wavenumber, intrinsic frequency, and MacCamy-Fuchs scaling of each positive frequency
+   !! component (including zero) do not depend on the location, so find them once here.  Components
+   !! at and above the first frequency at which the waves cannot propagate against the current are zero.
 
+   NStepWaveProp = WaveField%NStepWave2
    DO I = 0,WaveField%NStepWave2  ! Loop through the positive frequency components (including zero) of the discrete Fourier transforms
-      ! Set tmpComplex to the Ith element of the WAveElevC0 array
-      tmpComplex  = CMPLX(  WaveField%WaveElevC0(1,I),   WaveField%WaveElevC0(2,I))
 
       ! Compute the wavenumber:
-      CALL WaveDispRel ( OmegaArr(I), InitInp%Gravity, WaveField%EffWtrDpth, CurrVw0, OmegaCrit, Omega_i_Crit, OmegaI, WaveNmbr, ErrStatTmp, ErrMsgTmp )
+      CALL WaveDispRel ( OmegaArr(I), InitInp%Gravity, WaveField%EffWtrDpth, CurrVw0, OmegaCrit, Omega_i_Crit, OmegaIArr(I), WaveNmbrArr(I), ErrStatTmp, ErrMsgTmp )
         CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,RoutineName)
           IF ( ErrStat >= AbortErrLev ) THEN
           CALL CleanUp()
           RETURN
         END IF
-      IF (OmegaI < 0.0_SiKi) EXIT
-
-      ! Compute the frequency of this component and its imaginary value:
-      ImagOmegaI = ImagNmbr*OmegaI
+      IF (OmegaIArr(I) < 0.0_SiKi) THEN
+         NStepWaveProp = I - 1
+         EXIT
+      END IF
 
       ! Wavenumber-dependent acceleration scaling for MacCamy-Fuchs model
-      MCFC = 0.0_ReKi
+      MCFCArr(I) = 0.0_SiKi
       IF (WaveField%MCFD > 0.0_SiKi .AND. I>0_IntKi) THEN
-         ka = 0.5_ReKi * WaveNmbr * WaveField%MCFD
+         ka = 0.5_ReKi * WaveNmbrArr(I) * WaveField%MCFD
          JPrime = BESSEL_JN(1,ka) / ka - BESSEL_JN(2,ka)
          YPrime = BESSEL_YN(1,ka) / ka - BESSEL_YN(2,ka)
          HPrime = SQRT(JPrime*JPrime + YPrime*YPrime)
-         MCFC = 4.0_ReKi/( PI * ka * ka * HPrime )
-      END IF
-
-      ! Compute the discrete Fourier transform of the incident wave kinematics
-      !   before applying stretching at the zi-coordinates for the WAMIT reference point, and all
-      !   points where are Morison loads will be calculated.
-
-      DO J = 1,NWaveKin0Prime ! Loop through all points where the incident wave kinematics will be computed without stretching
-
-         WaveElevxiPrime0 = EXP( -ImagNmbr*WaveNmbr*( InitInp%WaveKinGridxi(WaveKinPrimeMap(J))*CosWaveDir(I) + &
-                                                      InitInp%WaveKinGridyi(WaveKinPrimeMap(J))*SinWaveDir(I) ))
-
-         WaveDynPC0 (I,J)     = WaveField%RhoXg*tmpComplex*WaveElevxiPrime0 * COSHNumOvrCOSHDen ( WaveNmbr, WaveField%EffWtrDpth, WaveKinzi0Prime(J) )
-
-         WaveVelC0Hxi (I,J)   = CosWaveDir(I)*OmegaI*tmpComplex* WaveElevxiPrime0 * COSHNumOvrSINHDen ( WaveNmbr, WaveField%EffWtrDpth, WaveKinzi0Prime(J) )
-         WaveVelC0Hyi (I,J)   = SinWaveDir(I)*OmegaI*tmpComplex* WaveElevxiPrime0 * COSHNumOvrSINHDen ( WaveNmbr, WaveField%EffWtrDpth, WaveKinzi0Prime(J) )
-
-         WaveVelC0V (I,J)     = ImagOmegaI*tmpComplex* WaveElevxiPrime0 * SINHNumOvrSINHDen ( WaveNmbr, WaveField%EffWtrDpth, WaveKinzi0Prime(J) )
-         WaveAccC0Hxi (I,J)   = ImagOmegaI*        WaveVelC0Hxi (I,J)
-
-         WaveAccC0Hyi (I,J)   = ImagOmegaI*        WaveVelC0Hyi (I,J)
-         WaveAccC0V (I,J)     = ImagOmegaI*        WaveVelC0V   (I,J)
-
-         IF (WaveField%MCFD > 0.0_SiKi) THEN
-            WaveAccC0HxiMCF(I,J) = WaveAccC0Hxi(I,J) * MCFC
-            WaveAccC0HyiMCF(I,J) = WaveAccC0Hyi(I,J) * MCFC
-            WaveAccC0VMCF(I,J)   = WaveAccC0V(I,J)   * MCFC
-         END IF
-      END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
-
-      IF (WaveField%WaveStMod .EQ. 2_IntKi) THEN ! Extrapolation wave stretching
-         DO J = 1,InitInp%NWaveElevGrid ! Loop through all points on the SWL
-            WaveElevxiPrime0 = EXP( -ImagNmbr*WaveNmbr*( InitInp%WaveKinGridxi(J)*CosWaveDir(I) + &
-                                                         InitInp%WaveKinGridyi(J)*SinWaveDir(I) ))
-            ! Partial derivatives at zi = 0
-            PWaveDynPC0BPz0 (I,J) = WaveField%RhoXg*      tmpComplex*WaveElevxiPrime0*WaveNmbr*TANH ( WaveNmbr*WaveField%EffWtrDpth )
-            PWaveVelC0HxiPz0(I,J) = CosWaveDir(I)*OmegaI*tmpComplex*WaveElevxiPrime0*WaveNmbr
-            PWaveVelC0HyiPz0(I,J) = SinWaveDir(I)*OmegaI*tmpComplex*WaveElevxiPrime0*WaveNmbr
-         
-            IF (I == 0_IntKi) THEN ! Zero frequency component - Need to avoid division by zero.
-              PWaveVelC0VPz0  (I,J) =         0.0_ReKi
-            ELSE
-              PWaveVelC0VPz0  (I,J) =         ImagOmegaI*tmpComplex*WaveElevxiPrime0*WaveNmbr/TANH ( WaveNmbr*WaveField%EffWtrDpth )
-            END IF
-         
-            PWaveAccC0HxiPz0(I,J) =           ImagOmegaI*PWaveVelC0HxiPz0(I,J)
-            PWaveAccC0HyiPz0(I,J) =           ImagOmegaI*PWaveVelC0HyiPz0(I,J)
-            PWaveAccC0VPz0  (I,J) =           ImagOmegaI*PWaveVelC0VPz0  (I,J)
-            
-            
-            IF (WaveField%MCFD > 0.0_SiKi) THEN
-               PWaveAccC0HxiMCFPz0(I,J) = PWaveAccC0HxiPz0(I,J) * MCFC
-               PWaveAccC0HyiMCFPz0(I,J) = PWaveAccC0HyiPz0(I,J) * MCFC
-               PWaveAccC0VMCFPz0(I,J)   = PWaveAccC0VPz0(I,J)   * MCFC
-            END IF
-            
-         END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
+         MCFCArr(I) = 4.0_ReKi/( PI * ka * ka * HPrime )
       END IF
 
    END DO                ! I - The positive frequency components (including zero) of the discrete Fourier transforms
+   MCFCArr(NStepWaveProp+1:) = 0.0_SiKi
+
+   ! Without the volume grid, keep the wave components needed to sum the kinematics at the requested positions
+   IF (.NOT. GridKin) THEN
+      ALLOCATE ( WaveField%WaveNmbr  ( 0:WaveField%NStepWave2 ), STAT=ErrStatTmp ); if (Failed0('WaveField%WaveNmbr  ')) return;
+      ALLOCATE ( WaveField%WaveOmegaI( 0:WaveField%NStepWave2 ), STAT=ErrStatTmp ); if (Failed0('WaveField%WaveOmegaI')) return;
+      ALLOCATE ( WaveField%CosWaveDir( 0:WaveField%NStepWave2 ), STAT=ErrStatTmp ); if (Failed0('WaveField%CosWaveDir')) return;
+      ALLOCATE ( WaveField%SinWaveDir( 0:WaveField%NStepWave2 ), STAT=ErrStatTmp ); if (Failed0('WaveField%SinWaveDir')) return;
+      WaveField%NStepWaveProp = NStepWaveProp
+      WaveField%WaveNmbr      = WaveNmbrArr
+      WaveField%WaveOmegaI    = OmegaIArr
+      WaveField%CosWaveDir    = CosWaveDir
+      WaveField%SinWaveDir    = SinWaveDir
+      IF (WaveField%MCFD > 0.0_SiKi) THEN
+         ALLOCATE ( WaveField%WaveMCFC( 0:WaveField%NStepWave2 ), STAT=ErrStatTmp ); if (Failed0('WaveField%WaveMCFC')) return;
+         WaveField%WaveMCFC = MCFCArr
+      END IF
+   END IF
 
    ! Calculate the array of simulation times at which the instantaneous
    !   elevation of, velocity of, acceleration of, and loads associated with
@@ -1179,8 +1156,8 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
    DO I = 0,WaveField%NStepWave ! Loop through all time steps
       WaveField%WaveTime(I) = I*REAL(InitInp%WaveDT,SiKi)
    END DO                ! I - All time steps
-   
-   
+
+
    DO I = 0,WaveField%NStepWave2  ! Loop through the positive frequency components (including zero) of the discrete Fourier transform
       tmpComplexArr(I)    =  CMPLX(WaveField%WaveElevC0(1,I), WaveField%WaveElevC0(2,I))
    END DO
@@ -1190,59 +1167,153 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
    CALL    ApplyFFT_cx (  WaveField%WaveElev0    (0:WaveField%NStepWave-1),  tmpComplexArr    (:  ), FFT_Data, ErrStatTmp )
    if (FailedFFT('WaveField%WaveElev0'  )) return;
+
+
+   !> The discrete Fourier transforms and the inverse FFTs at each point do not depend on the other
+   !! points, so the points are distributed over the OpenMP threads.  FFTPACK uses part of the FFT
+   !! work array as scratch space, so each thread initializes its own FFT data.
+
+   !$OMP PARALLEL DEFAULT(SHARED) PRIVATE(I, J, K, ii, jj, FFT_DataThd, tmpComplexArr, tmpComplex, ImagOmegaI, WaveElevxiPrime0, ErrStatTmp, ErrMsgTmp)
+   CALL InitFFT ( WaveField%NStepWave, FFT_DataThd, .TRUE., ErrStatTmp )
+   CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while initializing the FFT.' )
+
 !NOTE:  For all grid points
+   !$OMP DO SCHEDULE(DYNAMIC)
    DO k = 1,InitInp%NWaveElevGrid     ! Loop through all points where the incident wave elevations are to be computed (normally all the XY grid points)
       ! This subroutine call applies the FFT at the correct location.
-      i = mod(k-1, InitInp%NGrid(1)) + 1
-      j = (k-1) / InitInp%NGrid(1) + 1
+      ii = mod(k-1, InitInp%NGrid(1)) + 1
+      jj = (k-1) / InitInp%NGrid(1) + 1
 
       ! note that this subroutine resets tmpComplexArr
-      CALL WaveElevTimeSeriesAtXY( InitInp%WaveKinGridxi(k), InitInp%WaveKinGridyi(k), WaveField%WaveElev1(:,i,j), WaveField%WaveElevC(:,:,k), tmpComplexArr, ErrStatTmp, ErrMsgTmp ) ! Note this sets tmpComplexArr
-      if (FailedFFT('WaveField%WaveElev1'  )) return;
-   END DO                   ! J - All points where the incident wave elevations can be output
+      CALL WaveElevTimeSeriesAtXY( InitInp%WaveKinGridxi(k), InitInp%WaveKinGridyi(k), WaveField%WaveElev1(:,ii,jj), WaveField%WaveElevC(:,:,k), tmpComplexArr, FFT_DataThd, ErrStatTmp, ErrMsgTmp ) ! Note this sets tmpComplexArr
+      CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveField%WaveElev1' )
+   END DO                   ! k - All points where the incident wave elevations can be output
+   !$OMP END DO NOWAIT
 
 
+   ! Compute the discrete Fourier transform of the incident wave kinematics
+   !   before applying stretching at the zi-coordinates for the WAMIT reference point, and all
+   !   points where are Morison loads will be calculated, then its inverse FFT.
 
-
-      ! User requested data points -- Do all the FFT calls first, then return if something failed.
+   !$OMP DO SCHEDULE(DYNAMIC)
    DO J = 1,NWaveKin0Prime ! Loop through all points where the incident wave kinematics will be computed without stretching
-      CALL ApplyFFT_cx (          WaveDynP0B   (:,J),          WaveDynPC0    (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveDynPC0  ')) return;
-      CALL ApplyFFT_cx (          WaveVel0Hxi  (:,J),          WaveVelC0Hxi  (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveVelC0Hxi')) return;
-      CALL ApplyFFT_cx (          WaveVel0Hyi  (:,J),          WaveVelC0Hyi  (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveVelC0Hyi')) return;
-      CALL ApplyFFT_cx (          WaveVel0V    (:,J),          WaveVelC0V    (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveVelC0V  ')) return;
-      CALL ApplyFFT_cx (          WaveAcc0Hxi  (:,J),          WaveAccC0Hxi  (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveAccC0Hxi')) return;
-      CALL ApplyFFT_cx (          WaveAcc0Hyi  (:,J),          WaveAccC0Hyi  (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveAccC0Hyi')) return;
-      CALL ApplyFFT_cx (          WaveAcc0V    (:,J),          WaveAccC0V    (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveAccC0V  ')) return;
-   END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
 
-   IF (WaveField%MCFD > 0.0_SiKi) THEN
-      DO J = 1,NWaveKin0Prime ! Loop through all points where the incident wave kinematics will be computed without stretching
-         CALL ApplyFFT_cx (          WaveAcc0HxiMCF  (:,J),          WaveAccC0HxiMCF  (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveAcc0HxiMCF')) return;
-         CALL ApplyFFT_cx (          WaveAcc0HyiMCF  (:,J),          WaveAccC0HyiMCF  (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveAcc0HyiMCF')) return;
-         CALL ApplyFFT_cx (          WaveAcc0VMCF    (:,J),          WaveAccC0VMCF    (:,J), FFT_Data, ErrStatTmp ); if (FailedFFT('WaveAcc0VMCF  ')) return;
-      END DO
-   END IF
+      DO I = 0,NStepWaveProp  ! Loop through the positive frequency components (including zero) of the discrete Fourier transforms
+         ! Set tmpComplex to the Ith element of the WAveElevC0 array
+         tmpComplex  = CMPLX(  WaveField%WaveElevC0(1,I),   WaveField%WaveElevC0(2,I))
+
+         ! Compute the frequency of this component and its imaginary value:
+         ImagOmegaI = ImagNmbr*OmegaIArr(I)
+
+         WaveElevxiPrime0 = EXP( -ImagNmbr*WaveNmbrArr(I)*( InitInp%WaveKinGridxi(WaveKinPrimeMap(J))*CosWaveDir(I) + &
+                                                            InitInp%WaveKinGridyi(WaveKinPrimeMap(J))*SinWaveDir(I) ))
+
+         WaveDynPC0 (I,J)     = WaveField%RhoXg*tmpComplex*WaveElevxiPrime0 * COSHNumOvrCOSHDen ( WaveNmbrArr(I), WaveField%EffWtrDpth, WaveKinzi0Prime(J) )
+
+         WaveVelC0Hxi (I,J)   = CosWaveDir(I)*OmegaIArr(I)*tmpComplex* WaveElevxiPrime0 * COSHNumOvrSINHDen ( WaveNmbrArr(I), WaveField%EffWtrDpth, WaveKinzi0Prime(J) )
+         WaveVelC0Hyi (I,J)   = SinWaveDir(I)*OmegaIArr(I)*tmpComplex* WaveElevxiPrime0 * COSHNumOvrSINHDen ( WaveNmbrArr(I), WaveField%EffWtrDpth, WaveKinzi0Prime(J) )
+
+         WaveVelC0V (I,J)     = ImagOmegaI*tmpComplex* WaveElevxiPrime0 * SINHNumOvrSINHDen ( WaveNmbrArr(I), WaveField%EffWtrDpth, WaveKinzi0Prime(J) )
+         WaveAccC0Hxi (I,J)   = ImagOmegaI*        WaveVelC0Hxi (I,J)
+
+         WaveAccC0Hyi (I,J)   = ImagOmegaI*        WaveVelC0Hyi (I,J)
+         WaveAccC0V (I,J)     = ImagOmegaI*        WaveVelC0V   (I,J)
+      END DO                ! I - The positive frequency components (including zero) of the discrete Fourier transforms
+
+      WaveDynPC0   (NStepWaveProp+1:,J) = 0.0_SiKi
+      WaveVelC0Hxi (NStepWaveProp+1:,J) = 0.0_SiKi
+      WaveVelC0Hyi (NStepWaveProp+1:,J) = 0.0_SiKi
+      WaveVelC0V   (NStepWaveProp+1:,J) = 0.0_SiKi
+      WaveAccC0Hxi (NStepWaveProp+1:,J) = 0.0_SiKi
+      WaveAccC0Hyi (NStepWaveProp+1:,J) = 0.0_SiKi
+      WaveAccC0V   (NStepWaveProp+1:,J) = 0.0_SiKi
 
-   IF (WaveField%WaveStMod .EQ. 2_IntKi) THEN ! Extrapolation Wave Stretching
+      IF (WaveField%MCFD > 0.0_SiKi) THEN
+         WaveAccC0HxiMCF(:,J) = WaveAccC0Hxi(:,J) * MCFCArr(:)
+         WaveAccC0HyiMCF(:,J) = WaveAccC0Hyi(:,J) * MCFCArr(:)
+         WaveAccC0VMCF(:,J)   = WaveAccC0V(:,J)   * MCFCArr(:)
+      END IF
+
+      CALL ApplyFFT_cx (          WaveDynP0B   (:,J),          WaveDynPC0    (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveDynPC0'   )
+      CALL ApplyFFT_cx (          WaveVel0Hxi  (:,J),          WaveVelC0Hxi  (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveVelC0Hxi' )
+      CALL ApplyFFT_cx (          WaveVel0Hyi  (:,J),          WaveVelC0Hyi  (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveVelC0Hyi' )
+      CALL ApplyFFT_cx (          WaveVel0V    (:,J),          WaveVelC0V    (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveVelC0V'   )
+      CALL ApplyFFT_cx (          WaveAcc0Hxi  (:,J),          WaveAccC0Hxi  (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveAccC0Hxi' )
+      CALL ApplyFFT_cx (          WaveAcc0Hyi  (:,J),          WaveAccC0Hyi  (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveAccC0Hyi' )
+      CALL ApplyFFT_cx (          WaveAcc0V    (:,J),          WaveAccC0V    (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveAccC0V'   )
+
+      IF (WaveField%MCFD > 0.0_SiKi) THEN
+         CALL ApplyFFT_cx (          WaveAcc0HxiMCF  (:,J),          WaveAccC0HxiMCF  (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveAcc0HxiMCF' )
+         CALL ApplyFFT_cx (          WaveAcc0HyiMCF  (:,J),          WaveAccC0HyiMCF  (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveAcc0HyiMCF' )
+         CALL ApplyFFT_cx (          WaveAcc0VMCF    (:,J),          WaveAccC0VMCF    (:,J), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveAcc0VMCF'   )
+      END IF
+   END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
+   !$OMP END DO NOWAIT
+
+   IF (WaveField%WaveStMod .EQ. 2_IntKi .AND. GridKin) THEN ! Extrapolation wave stretching
+      !$OMP DO SCHEDULE(DYNAMIC)
       DO J = 1,InitInp%NWaveElevGrid ! Loop through all points on the SWL where z-partial derivatives will be computed for extrapolated stretching
+
+         DO I = 0,NStepWaveProp  ! Loop through the positive frequency components (including zero) of the discrete Fourier transforms
+            tmpComplex  = CMPLX(  WaveField%WaveElevC0(1,I),   WaveField%WaveElevC0(2,I))
+            ImagOmegaI  = ImagNmbr*OmegaIArr(I)
+
+            WaveElevxiPrime0 = EXP( -ImagNmbr*WaveNmbrArr(I)*( InitInp%WaveKinGridxi(J)*CosWaveDir(I) + &
+                                                               InitInp%WaveKinGridyi(J)*SinWaveDir(I) ))
+            ! Partial derivatives at zi = 0
+            PWaveDynPC0BPz0 (I,J) = WaveField%RhoXg*      tmpComplex*WaveElevxiPrime0*WaveNmbrArr(I)*TANH ( WaveNmbrArr(I)*WaveField%EffWtrDpth )
+            PWaveVelC0HxiPz0(I,J) = CosWaveDir(I)*OmegaIArr(I)*tmpComplex*WaveElevxiPrime0*WaveNmbrArr(I)
+            PWaveVelC0HyiPz0(I,J) = SinWaveDir(I)*OmegaIArr(I)*tmpComplex*WaveElevxiPrime0*WaveNmbrArr(I)
+
+            IF (I == 0_IntKi) THEN ! Zero frequency component - Need to avoid division by zero.
+              PWaveVelC0VPz0  (I,J) =         0.0_ReKi
+            ELSE
+              PWaveVelC0VPz0  (I,J) =         ImagOmegaI*tmpComplex*WaveElevxiPrime0*WaveNmbrArr(I)/TANH ( WaveNmbrArr(I)*WaveField%EffWtrDpth )
+            END IF
+
+            PWaveAccC0HxiPz0(I,J) =           ImagOmegaI*PWaveVelC0HxiPz0(I,J)
+            PWaveAccC0HyiPz0(I,J) =           ImagOmegaI*PWaveVelC0HyiPz0(I,J)
+            PWaveAccC0VPz0  (I,J) =           ImagOmegaI*PWaveVelC0VPz0  (I,J)
+         END DO                ! I - The positive frequency components (including zero) of the discrete Fourier transforms
+
+         PWaveDynPC0BPz0 (NStepWaveProp+1:,J) = 0.0_SiKi
+         PWaveVelC0HxiPz0(NStepWaveProp+1:,J) = 0.0_SiKi
+         PWaveVelC0HyiPz0(NStepWaveProp+1:,J) = 0.0_SiKi
+         PWaveVelC0VPz0  (NStepWaveProp+1:,J) = 0.0_SiKi
+         PWaveAccC0HxiPz0(NStepWaveProp+1:,J) = 0.0_SiKi
+         PWaveAccC0HyiPz0(NStepWaveProp+1:,J) = 0.0_SiKi
+         PWaveAccC0VPz0  (NStepWaveProp+1:,J) = 0.0_SiKi
+
+         IF (WaveField%MCFD > 0.0_SiKi) THEN ! MacCamy-Fuchs scaled acceleration field
+            PWaveAccC0HxiMCFPz0(:,J) = PWaveAccC0HxiPz0(:,J) * MCFCArr(:)
+            PWaveAccC0HyiMCFPz0(:,J) = PWaveAccC0HyiPz0(:,J) * MCFCArr(:)
+            PWaveAccC0VMCFPz0(:,J)   = PWaveAccC0VPz0(:,J)   * MCFCArr(:)
+         END IF
+
          ! FFT's of the partial derivatives
-         CALL  ApplyFFT_cx (         PWaveDynP0BPz0(:,J  ),         PWaveDynPC0BPz0(:,J  ), FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveDynP0BPz0 ')) return;
-         CALL  ApplyFFT_cx (         PWaveVel0HxiPz0 (:,J  ),       PWaveVelC0HxiPz0( :,J ),FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveVel0HxiPz0')) return;
-         CALL  ApplyFFT_cx (         PWaveVel0HyiPz0 (:,J  ),       PWaveVelC0HyiPz0( :,J ),FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveVel0HyiPz0')) return;
-         CALL  ApplyFFT_cx (         PWaveVel0VPz0 (:,J  ),         PWaveVelC0VPz0 (:,J  ), FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveVel0VPz0  ')) return;
-         CALL  ApplyFFT_cx (         PWaveAcc0HxiPz0 (:,J  ),       PWaveAccC0HxiPz0(:,J  ),FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveAcc0HxiPz0')) return;
-         CALL  ApplyFFT_cx (         PWaveAcc0HyiPz0 (:,J  ),       PWaveAccC0HyiPz0(:,J  ),FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveAcc0HyiPz0')) return;
-         CALL  ApplyFFT_cx (         PWaveAcc0VPz0 (:,J  ),         PWaveAccC0VPz0( :,J  ), FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveAcc0VPz0  ')) return;
-      END DO                   ! J - All points where the incident wave kinematics will be computed without stretching
-      
-      IF (WaveField%MCFD > 0.0_SiKi) THEN ! MacCamy-Fuchs scaled acceleration field
-         DO J = 1,InitInp%NWaveElevGrid
-            CALL  ApplyFFT_cx (         PWaveAcc0HxiMCFPz0 (:,J  ),       PWaveAccC0HxiMCFPz0(:,J  ),FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveAcc0HxiMCFPz0')) return;
-            CALL  ApplyFFT_cx (         PWaveAcc0HyiMCFPz0 (:,J  ),       PWaveAccC0HyiMCFPz0(:,J  ),FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveAcc0HyiMCFPz0')) return;
-            CALL  ApplyFFT_cx (         PWaveAcc0VMCFPz0 (:,J  ),         PWaveAccC0VMCFPz0( :,J  ), FFT_Data, ErrStatTmp ); if (FailedFFT('PWaveAcc0VMCFPz0  ')) return;
-         END DO
-      END IF
-      
+         CALL  ApplyFFT_cx (         PWaveDynP0BPz0(:,J  ),         PWaveDynPC0BPz0(:,J  ), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveDynP0BPz0'  )
+         CALL  ApplyFFT_cx (         PWaveVel0HxiPz0 (:,J  ),       PWaveVelC0HxiPz0( :,J ),FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveVel0HxiPz0' )
+         CALL  ApplyFFT_cx (         PWaveVel0HyiPz0 (:,J  ),       PWaveVelC0HyiPz0( :,J ),FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveVel0HyiPz0' )
+         CALL  ApplyFFT_cx (         PWaveVel0VPz0 (:,J  ),         PWaveVelC0VPz0 (:,J  ), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveVel0VPz0'   )
+         CALL  ApplyFFT_cx (         PWaveAcc0HxiPz0 (:,J  ),       PWaveAccC0HxiPz0(:,J  ),FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveAcc0HxiPz0' )
+         CALL  ApplyFFT_cx (         PWaveAcc0HyiPz0 (:,J  ),       PWaveAccC0HyiPz0(:,J  ),FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveAcc0HyiPz0' )
+         CALL  ApplyFFT_cx (         PWaveAcc0VPz0 (:,J  ),         PWaveAccC0VPz0( :,J  ), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveAcc0VPz0'   )
+
+         IF (WaveField%MCFD > 0.0_SiKi) THEN ! MacCamy-Fuchs scaled acceleration field
+            CALL  ApplyFFT_cx (         PWaveAcc0HxiMCFPz0 (:,J  ),       PWaveAccC0HxiMCFPz0(:,J  ),FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveAcc0HxiMCFPz0' )
+            CALL  ApplyFFT_cx (         PWaveAcc0HyiMCFPz0 (:,J  ),       PWaveAccC0HyiMCFPz0(:,J  ),FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveAcc0HyiMCFPz0' )
+            CALL  ApplyFFT_cx (         PWaveAcc0VMCFPz0 (:,J  ),         PWaveAccC0VMCFPz0( :,J  ), FFT_DataThd, ErrStatTmp ); CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to PWaveAcc0VMCFPz0'   )
+         END IF
+      END DO                   ! J - All points on the SWL where z-partial derivatives will be computed for extrapolated stretching
+      !$OMP END DO NOWAIT
+   END IF
+
+   CALL  ExitFFT(FFT_DataThd, ErrStatTmp)
+   !$OMP END PARALLEL
+
+   IF ( ErrStat >= AbortErrLev ) THEN
+      CALL CleanUp()
+      RETURN
    END IF
 
    CALL  ExitFFT(FFT_Data, ErrStatTmp)
@@ -1300,94 +1371,96 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
    !   InitOut%PWaveDynP0(:,:,:,:)   = 0.0
 
-   primeCount = 1
-   count = 1
-   !DO J = 1,InitInp%NWaveKinGrid      ! Loop through all points where the incident wave kinematics will be computed
-   do k = 1, InitInp%NGrid(3)
-      do j = 1, InitInp%NGrid(2)
-         do i = 1, InitInp%NGrid(1)
-
-          !  ii = mod(count-1, InitInp%NGrid(1)) + 1
-          !  jj = mod( (count-1) /InitInp%NGrid(1), InitInp%NGrid(2) ) + 1
-          !  kk = (count-1) / (InitInp%NGrid(1)*InitInp%NGrid(2)) + 1
-
-            IF (   ( InitInp%WaveKinGridzi(count) < -WaveField%EffWtrDpth ) .OR. ( InitInp%WaveKinGridzi(count) > 0.0 ) ) THEN
-               ! .TRUE. if the elevation of the point defined by WaveKinGridzi(J) lies below the seabed or above mean sea level (exclusive)
-               ! NOTE: We test to 0 instead of MSL2SWL because the locations of WaveKinGridzi and EffWtrDpth have already been adjusted using MSL2SWL
-
-               WaveField%WaveDynP(:,i,j,k  )  = 0.0
-               WaveField%WaveVel (:,i,j,k,:)  = 0.0
-               WaveField%WaveAcc (:,i,j,k,:)  = 0.0
-
-            ELSE
-               ! The elevation of the point defined by WaveKinGridzi(J) must lie between the seabed and the mean sea level (inclusive)
-
-               WaveField%WaveDynP(0:WaveField%NStepWave-1,i,j,k  ) = WaveDynP0B( 0:WaveField%NStepWave-1,primeCount)
-               WaveField%WaveVel (0:WaveField%NStepWave-1,i,j,k,1) = WaveVel0Hxi(0:WaveField%NStepWave-1,primeCount)
-               WaveField%WaveVel (0:WaveField%NStepWave-1,i,j,k,2) = WaveVel0Hyi(0:WaveField%NStepWave-1,primeCount)
-               WaveField%WaveVel (0:WaveField%NStepWave-1,i,j,k,3) = WaveVel0V(  0:WaveField%NStepWave-1,primeCount)
-               WaveField%WaveAcc (0:WaveField%NStepWave-1,i,j,k,1) = WaveAcc0Hxi(0:WaveField%NStepWave-1,primeCount)
-               WaveField%WaveAcc (0:WaveField%NStepWave-1,i,j,k,2) = WaveAcc0Hyi(0:WaveField%NStepWave-1,primeCount)
-               WaveField%WaveAcc (0:WaveField%NStepWave-1,i,j,k,3) = WaveAcc0V(  0:WaveField%NStepWave-1,primeCount)
-               primeCount = primeCount + 1
-            END IF
-            count = count + 1
-         end do
-      end do
-   end do
-
-   ! MacCamy-Fuchs scaled fluid acceleration
-   IF (WaveField%MCFD > 0.0_SiKi) THEN
+   IF (GridKin) THEN ! Copy the unstretched kinematics into the volume grid
       primeCount = 1
       count = 1
+      !DO J = 1,InitInp%NWaveKinGrid      ! Loop through all points where the incident wave kinematics will be computed
       do k = 1, InitInp%NGrid(3)
          do j = 1, InitInp%NGrid(2)
             do i = 1, InitInp%NGrid(1)
+
+             !  ii = mod(count-1, InitInp%NGrid(1)) + 1
+             !  jj = mod( (count-1) /InitInp%NGrid(1), InitInp%NGrid(2) ) + 1
+             !  kk = (count-1) / (InitInp%NGrid(1)*InitInp%NGrid(2)) + 1
+
                IF (   ( InitInp%WaveKinGridzi(count) < -WaveField%EffWtrDpth ) .OR. ( InitInp%WaveKinGridzi(count) > 0.0 ) ) THEN
                   ! .TRUE. if the elevation of the point defined by WaveKinGridzi(J) lies below the seabed or above mean sea level (exclusive)
                   ! NOTE: We test to 0 instead of MSL2SWL because the locations of WaveKinGridzi and EffWtrDpth have already been adjusted using MSL2SWL
-                  WaveField%WaveAccMCF(:,i,j,k,:)  = 0.0
+
+                  WaveField%WaveDynP(:,i,j,k  )  = 0.0
+                  WaveField%WaveVel (:,i,j,k,:)  = 0.0
+                  WaveField%WaveAcc (:,i,j,k,:)  = 0.0
+
                ELSE
                   ! The elevation of the point defined by WaveKinGridzi(J) must lie between the seabed and the mean sea level (inclusive)
-                  WaveField%WaveAccMCF (0:WaveField%NStepWave-1,i,j,k,1) = WaveAcc0HxiMCF(0:WaveField%NStepWave-1,primeCount)
-                  WaveField%WaveAccMCF (0:WaveField%NStepWave-1,i,j,k,2) = WaveAcc0HyiMCF(0:WaveField%NStepWave-1,primeCount)
-                  WaveField%WaveAccMCF (0:WaveField%NStepWave-1,i,j,k,3) = WaveAcc0VMCF(  0:WaveField%NStepWave-1,primeCount)
+
+                  WaveField%WaveDynP(0:WaveField%NStepWave-1,i,j,k  ) = WaveDynP0B( 0:WaveField%NStepWave-1,primeCount)
+                  WaveField%WaveVel (0:WaveField%NStepWave-1,i,j,k,1) = WaveVel0Hxi(0:WaveField%NStepWave-1,primeCount)
+                  WaveField%WaveVel (0:WaveField%NStepWave-1,i,j,k,2) = WaveVel0Hyi(0:WaveField%NStepWave-1,primeCount)
+                  WaveField%WaveVel (0:WaveField%NStepWave-1,i,j,k,3) = WaveVel0V(  0:WaveField%NStepWave-1,primeCount)
+                  WaveField%WaveAcc (0:WaveField%NStepWave-1,i,j,k,1) = WaveAcc0Hxi(0:WaveField%NStepWave-1,primeCount)
+                  WaveField%WaveAcc (0:WaveField%NStepWave-1,i,j,k,2) = WaveAcc0Hyi(0:WaveField%NStepWave-1,primeCount)
+                  WaveField%WaveAcc (0:WaveField%NStepWave-1,i,j,k,3) = WaveAcc0V(  0:WaveField%NStepWave-1,primeCount)
                   primeCount = primeCount + 1
                END IF
                count = count + 1
             end do
          end do
       end do
-   END IF
 
-   IF (WaveField%WaveStMod .EQ. 2_IntKi) THEN ! Extrapolation Wave Stretching
-      
-      primeCount = 1
-      DO j = 1, InitInp%NGrid(2)  ! Loop through all points on the SWL where partial derivatives about z were computed
-         DO i = 1, InitInp%NGrid(1)
-            WaveField%PWaveDynP0(0:WaveField%NStepWave-1,i,j  ) = PWaveDynP0BPz0( 0:WaveField%NStepWave-1,primeCount)
-            WaveField%PWaveVel0 (0:WaveField%NStepWave-1,i,j,1) = PWaveVel0HxiPz0(0:WaveField%NStepWave-1,primeCount)
-            WaveField%PWaveVel0 (0:WaveField%NStepWave-1,i,j,2) = PWaveVel0HyiPz0(0:WaveField%NStepWave-1,primeCount)
-            WaveField%PWaveVel0 (0:WaveField%NStepWave-1,i,j,3) = PWaveVel0VPz0(  0:WaveField%NStepWave-1,primeCount)
-            WaveField%PWaveAcc0 (0:WaveField%NStepWave-1,i,j,1) = pWaveAcc0HxiPz0(0:WaveField%NStepWave-1,primeCount)
-            WaveField%PWaveAcc0 (0:WaveField%NStepWave-1,i,j,2) = pWaveAcc0HyiPz0(0:WaveField%NStepWave-1,primeCount)
-            WaveField%PWaveAcc0 (0:WaveField%NStepWave-1,i,j,3) = PWaveAcc0VPz0(  0:WaveField%NStepWave-1,primeCount)
-            primeCount = primeCount + 1
-         END DO
-      END DO
-      
+      ! MacCamy-Fuchs scaled fluid acceleration
       IF (WaveField%MCFD > 0.0_SiKi) THEN
+         primeCount = 1
+         count = 1
+         do k = 1, InitInp%NGrid(3)
+            do j = 1, InitInp%NGrid(2)
+               do i = 1, InitInp%NGrid(1)
+                  IF (   ( InitInp%WaveKinGridzi(count) < -WaveField%EffWtrDpth ) .OR. ( InitInp%WaveKinGridzi(count) > 0.0 ) ) THEN
+                     ! .TRUE. if the elevation of the point defined by WaveKinGridzi(J) lies below the seabed or above mean sea level (exclusive)
+                     ! NOTE: We test to 0 instead of MSL2SWL because the locations of WaveKinGridzi and EffWtrDpth have already been adjusted using MSL2SWL
+                     WaveField%WaveAccMCF(:,i,j,k,:)  = 0.0
+                  ELSE
+                     ! The elevation of the point defined by WaveKinGridzi(J) must lie between the seabed and the mean sea level (inclusive)
+                     WaveField%WaveAccMCF (0:WaveField%NStepWave-1,i,j,k,1) = WaveAcc0HxiMCF(0:WaveField%NStepWave-1,primeCount)
+                     WaveField%WaveAccMCF (0:WaveField%NStepWave-1,i,j,k,2) = WaveAcc0HyiMCF(0:WaveField%NStepWave-1,primeCount)
+                     WaveField%WaveAccMCF (0:WaveField%NStepWave-1,i,j,k,3) = WaveAcc0VMCF(  0:WaveField%NStepWave-1,primeCount)
+                     primeCount = primeCount + 1
+                  END IF
+                  count = count + 1
+               end do
+            end do
+         end do
+      END IF
+
+      IF (WaveField%WaveStMod .EQ. 2_IntKi) THEN ! Extrapolation Wave Stretching
+      
          primeCount = 1
          DO j = 1, InitInp%NGrid(2)  ! Loop through all points on the SWL where partial derivatives about z were computed
             DO i = 1, InitInp%NGrid(1)
-               WaveField%PWaveAccMCF0 (0:WaveField%NStepWave-1,i,j,1) = pWaveAcc0HxiMCFPz0(0:WaveField%NStepWave-1,primeCount)
-               WaveField%PWaveAccMCF0 (0:WaveField%NStepWave-1,i,j,2) = pWaveAcc0HyiMCFPz0(0:WaveField%NStepWave-1,primeCount)
-               WaveField%PWaveAccMCF0 (0:WaveField%NStepWave-1,i,j,3) = PWaveAcc0VMCFPz0(  0:WaveField%NStepWave-1,primeCount)
+               WaveField%PWaveDynP0(0:WaveField%NStepWave-1,i,j  ) = PWaveDynP0BPz0( 0:WaveField%NStepWave-1,primeCount)
+               WaveField%PWaveVel0 (0:WaveField%NStepWave-1,i,j,1) = PWaveVel0HxiPz0(0:WaveField%NStepWave-1,primeCount)
+               WaveField%PWaveVel0 (0:WaveField%NStepWave-1,i,j,2) = PWaveVel0HyiPz0(0:WaveField%NStepWave-1,primeCount)
+               WaveField%PWaveVel0 (0:WaveField%NStepWave-1,i,j,3) = PWaveVel0VPz0(  0:WaveField%NStepWave-1,primeCount)
+               WaveField%PWaveAcc0 (0:WaveField%NStepWave-1,i,j,1) = pWaveAcc0HxiPz0(0:WaveField%NStepWave-1,primeCount)
+               WaveField%PWaveAcc0 (0:WaveField%NStepWave-1,i,j,2) = pWaveAcc0HyiPz0(0:WaveField%NStepWave-1,primeCount)
+               WaveField%PWaveAcc0 (0:WaveField%NStepWave-1,i,j,3) = PWaveAcc0VPz0(  0:WaveField%NStepWave-1,primeCount)
                primeCount = primeCount + 1
             END DO
          END DO
-      END IF
+      
+         IF (WaveField%MCFD > 0.0_SiKi) THEN
+            primeCount = 1
+            DO j = 1, InitInp%NGrid(2)  ! Loop through all points on the SWL where partial derivatives about z were computed
+               DO i = 1, InitInp%NGrid(1)
+                  WaveField%PWaveAccMCF0 (0:WaveField%NStepWave-1,i,j,1) = pWaveAcc0HxiMCFPz0(0:WaveField%NStepWave-1,primeCount)
+                  WaveField%PWaveAccMCF0 (0:WaveField%NStepWave-1,i,j,2) = pWaveAcc0HyiMCFPz0(0:WaveField%NStepWave-1,primeCount)
+                  WaveField%PWaveAccMCF0 (0:WaveField%NStepWave-1,i,j,3) = PWaveAcc0VMCFPz0(  0:WaveField%NStepWave-1,primeCount)
+                  primeCount = primeCount + 1
+               END DO
+            END DO
+         END IF
 
+      END IF
    END IF
 
 
@@ -1423,19 +1496,21 @@ SUBROUTINE VariousWaves_Init ( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
    ! Set the ending timestep to the same as the first timestep
    WaveField%WaveElev0 (WaveField%NStepWave)          = WaveField%WaveElev0 (0    )
-   WaveField%WaveDynP  (WaveField%NStepWave,:,:,:  )  = WaveField%WaveDynP  (0,:,:,:  )
-   WaveField%WaveVel   (WaveField%NStepWave,:,:,:,:)  = WaveField%WaveVel   (0,:,:,:,:)
-   WaveField%WaveAcc   (WaveField%NStepWave,:,:,:,:)  = WaveField%WaveAcc   (0,:,:,:,:)
-   IF (WaveField%MCFD > 0.0_SiKi) THEN
-      WaveField%WaveAccMCF (WaveField%NStepWave,:,:,:,:) = WaveField%WaveAccMCF(0,:,:,:,:)
-   END IF
-   
-   IF (WaveField%WaveStMod .EQ. 2_IntKi) THEN ! Extrapolation Wave Stretching
-      WaveField%PWaveDynP0(WaveField%NStepWave,:,:  )    = WaveField%PWaveDynP0(0,:,:  )
-      WaveField%PWaveVel0 (WaveField%NStepWave,:,:,:)    = WaveField%PWaveVel0 (0,:,:,:)
-      WaveField%PWaveAcc0 (WaveField%NStepWave,:,:,:)    = WaveField%PWaveAcc0 (0,:,:,:)
+   IF (GridKin) THEN
+      WaveField%WaveDynP  (WaveField%NStepWave,:,:,:  )  = WaveField%WaveDynP  (0,:,:,:  )
+      WaveField%WaveVel   (WaveField%NStepWave,:,:,:,:)  = WaveField%WaveVel   (0,:,:,:,:)
+      WaveField%WaveAcc   (WaveField%NStepWave,:,:,:,:)  = WaveField%WaveAcc   (0,:,:,:,:)
       IF (WaveField%MCFD > 0.0_SiKi) THEN
-         WaveField%PWaveAccMCF0 (WaveField%NStepWave,:,:,:) = WaveField%PWaveAccMCF0(0,:,:,:)
+         WaveField%WaveAccMCF (WaveField%NStepWave,:,:,:,:) = WaveField%WaveAccMCF(0,:,:,:,:)
+      END IF
+   
+      IF (WaveField%WaveStMod .EQ. 2_IntKi) THEN ! Extrapolation Wave Stretching
+         WaveField%PWaveDynP0(WaveField%NStepWave,:,:  )    = WaveField%PWaveDynP0(0,:,:  )
+         WaveField%PWaveVel0 (WaveField%NStepWave,:,:,:)    = WaveField%PWaveVel0 (0,:,:,:)
+         WaveField%PWaveAcc0 (WaveField%NStepWave,:,:,:)    = WaveField%PWaveAcc0 (0,:,:,:)
+         IF (WaveField%MCFD > 0.0_SiKi) THEN
+            WaveField%PWaveAccMCF0 (WaveField%NStepWave,:,:,:) = WaveField%PWaveAccMCF0(0,:,:,:)
+         END IF
       END IF
    END IF
 
@@ -1463,22 +1538,32 @@ CONTAINS
       FailedFFT = ErrStat >= AbortErrLev
       if (FailedFFT) CALL Cleanup()
    end function
+   !> set the error status from inside an OpenMP parallel region; the caller checks ErrStat after the region
+   subroutine SetErrStatOMP(ErrStatLcl, ErrMsgLcl)
+      integer(IntKi), intent(in) :: ErrStatLcl
+      character(*),   intent(in) :: ErrMsgLcl
+      if (ErrStatLcl /= ErrID_None) then
+         !$OMP CRITICAL(VariousWaves_ErrStat)
+         CALL SetErrStat( ErrStatLcl, ErrMsgLcl, ErrStat, ErrMsg, RoutineName )
+         !$OMP END CRITICAL(VariousWaves_ErrStat)
+      end if
+   end subroutine
 !--------------------------------------------------------------------------------
-   SUBROUTINE WaveElevTimeSeriesAtXY(Xcoord,Ycoord, WaveElevAtXY, WaveElevCAtXY, tmpComplexArr, ErrStatLcl, ErrMsgLcl )
+   SUBROUTINE WaveElevTimeSeriesAtXY(Xcoord,Ycoord, WaveElevAtXY, WaveElevCAtXY, tmpComplexArr, FFT_DataLcl, ErrStatLcl, ErrMsgLcl )
 
       REAL(SiKi),       INTENT(IN   )                 :: Xcoord
       REAL(SiKi),       INTENT(IN   )                 :: Ycoord
       REAL(SiKi),       INTENT(  OUT)                 :: WaveElevAtXY(0:WaveField%NStepWave)
       real(SiKi),       INTENT(  OUT)                 :: WaveElevCAtXY(2,0:WaveField%NStepWave2)
       COMPLEX(SiKi),    INTENT(INOUT)                 :: tmpComplexArr(0:WaveField%NStepWave2)            ! A temporary array (0:NStepWave2-1) for FFT use.
+      TYPE(FFT_DataType), INTENT(IN   )               :: FFT_DataLcl                                     ! FFT data of the calling thread
       INTEGER(IntKi),   INTENT(  OUT)                 :: ErrStatLcl
       CHARACTER(*),     INTENT(  OUT)                 :: ErrMsgLcl
       
       integer                                         :: i
-      REAL(SiKi)                                      :: WaveNmbr                                        ! Wavenumber of the current frequency component (1/meter)
       INTEGER(IntKi)                                  :: ErrStatLcl2
 
-      ! note that InitOut, InitInp, FFT_Data, CosWaveDir and SinWaveDir are used here, but their values are not changed
+      ! note that WaveField, WaveNmbrArr, CosWaveDir and SinWaveDir are used here, but their values are not changed
       ErrStatLcl  = ErrID_None
       ErrMsgLcl = ""
 
@@ -1486,22 +1571,14 @@ CONTAINS
       tmpComplexArr  = CMPLX(0.0_SiKi,0.0_SiKi)
 
          ! Loop through the positive frequency components (including zero).
-      DO I = 0,WaveField%NStepWave2
-
-         CALL WaveDispRel ( OmegaArr(I), InitInp%Gravity, WaveField%EffWtrDpth, CurrVw0, OmegaCrit, Omega_i_Crit, OmegaI, WaveNmbr, ErrStatTmp, ErrMsgTmp )
-           CALL SetErrStat(ErrStatTmp,ErrMsgTmp,ErrStat,ErrMsg,RoutineName)
-             IF ( ErrStat >= AbortErrLev ) THEN
-             CALL CleanUp()
-             RETURN
-           END IF
-         IF (OmegaI < 0.0_SiKi) EXIT
+      DO I = 0,NStepWaveProp
 
          tmpComplexArr(I)  =  CMPLX(  WaveField%WaveElevC0(1,I),   WaveField%WaveElevC0(2,I))   *          &
-                                      EXP( -ImagNmbr*WaveNmbr*(  Xcoord*CosWaveDir(I)+    &
-                                                                 Ycoord*SinWaveDir(I) )   )
+                                      EXP( -ImagNmbr*WaveNmbrArr(I)*(  Xcoord*CosWaveDir(I)+    &
+                                                                       Ycoord*SinWaveDir(I) )   )
       ENDDO
 
-      CALL ApplyFFT_cx (   WaveElevAtXY(0:WaveField%NStepWave-1),   tmpComplexArr, FFT_Data,   ErrStatLcl2  )
+      CALL ApplyFFT_cx (   WaveElevAtXY(0:WaveField%NStepWave-1),   tmpComplexArr, FFT_DataLcl,   ErrStatLcl2  )
       CALL SetErrStat(ErrStatLcl2,'Error occurred while applying the FFT.',ErrStatLcl,ErrMsgLcl,'WaveElevTimeSeriesAtXY')
 
       WaveElevCAtXY( 1,: ) = REAL(tmpComplexArr(:))
@@ -1618,6 +1695,9 @@ CONTAINS
 
       IF (ALLOCATED( WaveS1SddArr ))      DEALLOCATE( WaveS1SddArr,     STAT=ErrStatTmp)
       IF (ALLOCATED( OmegaArr ))          DEALLOCATE( OmegaArr,         STAT=ErrStatTmp)
+      IF (ALLOCATED( OmegaIArr ))         DEALLOCATE( OmegaIArr,        STAT=ErrStatTmp)
+      IF (ALLOCATED( WaveNmbrArr ))       DEALLOCATE( WaveNmbrArr,      STAT=ErrStatTmp)
+      IF (ALLOCATED( MCFCArr ))           DEALLOCATE( MCFCArr,          STAT=ErrStatTmp)
 
       IF (ALLOCATED( WaveAccC0HxiMCF ))     DEALLOCATE( WaveAccC0HxiMCF,     STAT=ErrStatTmp)
       IF (ALLOCATED( WaveAccC0HyiMCF ))     DEALLOCATE( WaveAccC0HyiMCF,     STAT=ErrStatTmp)
@@ -124,9 +124,6 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
          ! Second order wave elevation calculations
       REAL(SiKi),                            ALLOCATABLE :: TmpTimeSeries(:)     !< Temporary storage for a wave elevation time series for a single point.
-      REAL(SiKi),                            ALLOCATABLE :: TmpTimeSeries2(:)    !< Temporary storage for a wave elevation time series for a single point.
-      COMPLEX(SiKi),                         ALLOCATABLE :: TmpFreqSeries(:)     !< Temporary storage for a wave elevation frequency series for a single point.
-      COMPLEX(SiKi),                         ALLOCATABLE :: TmpFreqSeries2(:)    !< Temporary storage for a wave elevation frequency series for a single point.
 
 
          ! Calculation of 2nd order particle acceleration, velocity, and pressure terms
@@ -176,7 +173,7 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
       REAL(SiKi),                            ALLOCATABLE :: WaveDynP2SumT2(:)    !< Time domain     difference frequency dynamic pressure term 2
 
          ! Stuff for the FFT calculations
-      TYPE(FFT_DataType)                                 :: FFT_Data             !< the instance of the FFT module we're using
+      TYPE(FFT_DataType)                                 :: FFT_DataThd          !< FFT data private to each OpenMP thread
 
 
 
@@ -376,13 +373,7 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
          ! For calculating the 2nd-order wave elevation corrections, we need a temporary array to hold the information.
       ALLOCATE ( TmpTimeSeries(0:WaveField%NStepWave), STAT=ErrStatTmp )
       IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array TmpTimeSeries.', ErrStat,ErrMsg,RoutineName)
-      ALLOCATE ( TmpTimeSeries2(0:WaveField%NStepWave), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array TmpTimeSeries2.', ErrStat,ErrMsg,RoutineName)
 
-      ALLOCATE ( TmpFreqSeries(0:WaveField%NStepWave2), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array TmpFreqSeries.', ErrStat,ErrMsg,RoutineName)
-      ALLOCATE ( TmpFreqSeries2(0:WaveField%NStepWave2), STAT=ErrStatTmp )
-      IF (ErrStatTmp /= 0) CALL SetErrStat(ErrID_Fatal,'Cannot allocate array TmpFreqSeries2.', ErrStat,ErrMsg,RoutineName)
 
          ! Now check if all the allocations worked properly
       IF ( ErrStat >= AbortErrLev ) THEN
@@ -391,16 +382,9 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
       END IF
 
       !--------------------------------------------------------------------------------
-      ! Setup the FFT working arrays
+      ! The FFT working arrays are set up by each thread inside the parallel regions below
       !--------------------------------------------------------------------------------
 
-      CALL InitFFT ( WaveField%NStepWave, FFT_Data, .FALSE., ErrStatTmp )
-      CALL SetErrStat(ErrStatTmp,'Error occurred while initializing the FFT.',ErrStat,ErrMsg,RoutineName)
-      IF ( ErrStat >= AbortErrLev ) THEN
-         CALL CleanUp()
-         RETURN
-      END IF
-
 
       !--------------------------------------------------------------------------------
       !> # Difference Frequency #
@@ -489,19 +473,27 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
             !! frequency calculations later in the code.
             !--------------------------------------------------------------------------------
 
+            ! Each point is independent of the others, so the points are distributed over the OpenMP threads.
+            ! FFTPACK uses part of the FFT work array as scratch space, so each thread initializes its own FFT data.
+         !$OMP PARALLEL DEFAULT(SHARED) PRIVATE(I, J, k, ii, jj, kk, masterCount, n, m, mu_minus, Omega_minus, Omega_n, Omega_m, k_n, k_m, k_nm, B_minus, &
+         !$OMP&   WaveElevxyPrime0, WaveElevC_n, WaveElevC_m, Ux_nm_minus, Uy_nm_minus, Uz_nm_minus, Accx_nm_minus, Accy_nm_minus, Accz_nm_minus, DynP_nm_minus, &
+         !$OMP&   TmpTimeSeries, FFT_DataThd, ErrStatTmp, ErrMsgTmp, &
+         !$OMP&   WaveVel2xCDiff, WaveVel2yCDiff, WaveVel2zCDiff, WaveAcc2xCDiff, WaveAcc2yCDiff, WaveAcc2zCDiff, WaveDynP2CDiff, &
+         !$OMP&   WaveVel2xDiff, WaveVel2yDiff, WaveVel2zDiff, WaveAcc2xDiff, WaveAcc2yDiff, WaveAcc2zDiff, WaveDynP2Diff)
+         CALL InitFFT ( WaveField%NStepWave, FFT_DataThd, .FALSE., ErrStatTmp )
+         CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while initializing the FFT.' )
+
             ! Step through the requested points
+         !$OMP DO SCHEDULE(DYNAMIC)
          DO k = 1,InitInp%NWaveElevGrid      ! Loop through all points where the incident wave elevations are to be computed (normally all the XY grid points)
                ! This subroutine call applies the FFT at the correct location.
             i = mod(k-1, InitInp%NGrid(1)) + 1
             j = (k-1) / InitInp%NGrid(1) + 1
-            CALL WaveElevTimeSeriesAtXY_Diff(InitInp%WaveKinGridxi(k), InitInp%WaveKinGridyi(k), TmpTimeSeries, ErrStatTmp, ErrMsgTmp )
-            CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT to WaveField%WaveElev2.',ErrStat,ErrMsg,RoutineName)
-            IF ( ErrStat >= AbortErrLev ) THEN
-               CALL CleanUp()
-               RETURN
-            END IF
+            CALL WaveElevTimeSeriesAtXY_Diff(InitInp%WaveKinGridxi(k), InitInp%WaveKinGridyi(k), TmpTimeSeries, FFT_DataThd, ErrStatTmp, ErrMsgTmp )
+            CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveField%WaveElev2.' )
             WaveField%WaveElev2(:,I,J) = TmpTimeSeries(:)
          ENDDO    ! Wave elevation points requested
+         !$OMP END DO
 
 
 
@@ -511,6 +503,7 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
 
             ! NWaveKin0Prime loop start
+         !$OMP DO SCHEDULE(DYNAMIC)
          DO I=1,NWaveKin0Prime
             masterCount = WaveKinPrimeMap(I)
 
@@ -638,30 +631,24 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
                !> ### Apply the inverse FFT to each of the components to get the time domain result ###
                !> *   \f$ V(t) = 2 \operatorname{IFFT}\left[H^-\right] \f$
-            CALL ApplyFFT_cx(  WaveVel2xDiff(:),  WaveVel2xCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on V_x.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveVel2yDiff(:),  WaveVel2yCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on V_y.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveVel2zDiff(:),  WaveVel2zCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on V_z.',ErrStat,ErrMsg,RoutineName)
-
-            CALL ApplyFFT_cx(  WaveAcc2xDiff(:),  WaveAcc2xCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on Acc_x.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveAcc2yDiff(:),  WaveAcc2yCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on Acc_y.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveAcc2zDiff(:),  WaveAcc2zCDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on Acc_z.',ErrStat,ErrMsg,RoutineName)
+            CALL ApplyFFT_cx(  WaveVel2xDiff(:),  WaveVel2xCDiff(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on V_x.' )
+            CALL ApplyFFT_cx(  WaveVel2yDiff(:),  WaveVel2yCDiff(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on V_y.' )
+            CALL ApplyFFT_cx(  WaveVel2zDiff(:),  WaveVel2zCDiff(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on V_z.' )
 
-            CALL ApplyFFT_cx(  WaveDynP2Diff(:),  WaveDynP2CDiff(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on DynP2.',ErrStat,ErrMsg,RoutineName)
+            CALL ApplyFFT_cx(  WaveAcc2xDiff(:),  WaveAcc2xCDiff(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on Acc_x.' )
+            CALL ApplyFFT_cx(  WaveAcc2yDiff(:),  WaveAcc2yCDiff(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on Acc_y.' )
+            CALL ApplyFFT_cx(  WaveAcc2zDiff(:),  WaveAcc2zCDiff(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on Acc_z.' )
 
+            CALL ApplyFFT_cx(  WaveDynP2Diff(:),  WaveDynP2CDiff(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on DynP2.' )
 
 
-            IF ( ErrStat >= AbortErrLev ) THEN
-               CALL CleanUp()
-               RETURN
-            END IF
-
 
                ! Copy the results to the output
             ii = mod(masterCount-1, InitInp%NGrid(1)) + 1
@@ -693,6 +680,15 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
 
          ENDDO    ! I=1,NWaveKin0Prime loop end
+         !$OMP END DO NOWAIT
+
+         CALL ExitFFT(FFT_DataThd, ErrStatTmp)
+         !$OMP END PARALLEL
+
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL CleanUp()
+            RETURN
+         END IF
 
          
             ! Deallocate working arrays.
@@ -852,25 +848,36 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
          !! frequency calculations earlier in the code.
          !--------------------------------------------------------------------------------
 !NOTE: This is all grid points
-             ! Step through the requested points
+            ! Each point is independent of the others, so the points are distributed over the OpenMP threads.
+            ! FFTPACK uses part of the FFT work array as scratch space, so each thread initializes its own FFT data.
+         !$OMP PARALLEL DEFAULT(SHARED) PRIVATE(I, J, k, ii, jj, kk, masterCount, n, m, mu_plus, Omega_plus, Omega_n, Omega_m, k_n, k_m, k_nm, B_plus, &
+         !$OMP&   WaveElevxyPrime0, WaveElevC_n, WaveElevC_m, Ux_nm_plus, Uy_nm_plus, Uz_nm_plus, Accx_nm_plus, Accy_nm_plus, Accz_nm_plus, DynP_nm_plus, &
+         !$OMP&   TmpTimeSeries, FFT_DataThd, ErrStatTmp, ErrMsgTmp, &
+         !$OMP&   WaveVel2xCSumT1, WaveVel2yCSumT1, WaveVel2zCSumT1, WaveAcc2xCSumT1, WaveAcc2yCSumT1, WaveAcc2zCSumT1, WaveDynP2CSumT1, &
+         !$OMP&   WaveVel2xSumT1, WaveVel2ySumT1, WaveVel2zSumT1, WaveAcc2xSumT1, WaveAcc2ySumT1, WaveAcc2zSumT1, WaveDynP2SumT1, &
+         !$OMP&   WaveVel2xCSumT2, WaveVel2yCSumT2, WaveVel2zCSumT2, WaveAcc2xCSumT2, WaveAcc2yCSumT2, WaveAcc2zCSumT2, WaveDynP2CSumT2, &
+         !$OMP&   WaveVel2xSumT2, WaveVel2ySumT2, WaveVel2zSumT2, WaveAcc2xSumT2, WaveAcc2ySumT2, WaveAcc2zSumT2, WaveDynP2SumT2)
+         CALL InitFFT ( WaveField%NStepWave, FFT_DataThd, .FALSE., ErrStatTmp )
+         CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while initializing the FFT.' )
+
+            ! Step through the requested points
+         !$OMP DO SCHEDULE(DYNAMIC)
          DO k = 1,InitInp%NWaveElevGrid      ! Loop through all points where the incident wave elevations are to be computed (normally all the XY grid points)
                ! This subroutine call applies the FFT at the correct location.
             i = mod(k-1, InitInp%NGrid(1)) + 1
             j = (k-1) / InitInp%NGrid(1) + 1
-            CALL WaveElevTimeSeriesAtXY_Sum(InitInp%WaveKinGridxi(k), InitInp%WaveKinGridyi(k), TmpTimeSeries, ErrStatTmp, ErrMsgTmp )
-            CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT to WaveField%WaveElev2.',ErrStat,ErrMsg,RoutineName)
-            IF ( ErrStat >= AbortErrLev ) THEN
-               CALL CleanUp()
-               RETURN
-            END IF
+            CALL WaveElevTimeSeriesAtXY_Sum(InitInp%WaveKinGridxi(k), InitInp%WaveKinGridyi(k), TmpTimeSeries, FFT_DataThd, ErrStatTmp, ErrMsgTmp )
+            CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT to WaveField%WaveElev2.' )
                ! Add to the series since the difference is already included
             WaveField%WaveElev2(:,I,J) = WaveField%WaveElev2(:,I,J) + TmpTimeSeries(:)
          ENDDO    ! Wave elevation points requested
+         !$OMP END DO
 
          !--------------------------------------------------------------------------------
          !> ## Calculate the second order velocity, acceleration, and pressure corrections for all joints below surface. ##
          !--------------------------------------------------------------------------------
             ! NWaveKin0Prime loop start
+         !$OMP DO SCHEDULE(DYNAMIC)
          DO I=1,NWaveKin0Prime
             masterCount = WaveKinPrimeMap(I)
 
@@ -1123,45 +1130,39 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
                !> ### Apply the inverse FFT to the first and second terms of each of the components to get the time domain result ###
                !> *   \f$ V^{(2)+}(t)  =  \operatorname{IFFT}\left[K^+\right]
                !!                      + 2\operatorname{IFFT}\left[H^+\right]     \f$
-            CALL ApplyFFT_cx(  WaveVel2xSumT1(:),  WaveVel2xCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on V_x.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveVel2ySumT1(:),  WaveVel2yCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on V_y.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveVel2zSumT1(:),  WaveVel2zCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on V_z.',ErrStat,ErrMsg,RoutineName)
-
-            CALL ApplyFFT_cx(  WaveAcc2xSumT1(:),  WaveAcc2xCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on Acc_x.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveAcc2ySumT1(:),  WaveAcc2yCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on Acc_y.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveAcc2zSumT1(:),  WaveAcc2zCSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on Acc_z.',ErrStat,ErrMsg,RoutineName)
-
-            CALL ApplyFFT_cx(  WaveDynP2SumT1(:),  WaveDynP2CSumT1(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on DynP2.',ErrStat,ErrMsg,RoutineName)
-
-            CALL ApplyFFT_cx(  WaveVel2xSumT2(:),  WaveVel2xCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on V_x.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveVel2ySumT2(:),  WaveVel2yCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on V_y.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveVel2zSumT2(:),  WaveVel2zCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on V_z.',ErrStat,ErrMsg,RoutineName)
-
-            CALL ApplyFFT_cx(  WaveAcc2xSumT2(:),  WaveAcc2xCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on Acc_x.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveAcc2ySumT2(:),  WaveAcc2yCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on Acc_y.',ErrStat,ErrMsg,RoutineName)
-            CALL ApplyFFT_cx(  WaveAcc2zSumT2(:),  WaveAcc2zCSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on Acc_z.',ErrStat,ErrMsg,RoutineName)
-
-            CALL ApplyFFT_cx(  WaveDynP2SumT2(:),  WaveDynP2CSumT2(:), FFT_Data, ErrStatTmp )
-               CALL SetErrStat(ErrStatTmp,'Error occurred while applying the FFT on DynP2.',ErrStat,ErrMsg,RoutineName)
-
-            IF ( ErrStat >= AbortErrLev ) THEN
-               CALL CleanUp()
-               RETURN
-            END IF
-
+            CALL ApplyFFT_cx(  WaveVel2xSumT1(:),  WaveVel2xCSumT1(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on V_x.' )
+            CALL ApplyFFT_cx(  WaveVel2ySumT1(:),  WaveVel2yCSumT1(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on V_y.' )
+            CALL ApplyFFT_cx(  WaveVel2zSumT1(:),  WaveVel2zCSumT1(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on V_z.' )
+
+            CALL ApplyFFT_cx(  WaveAcc2xSumT1(:),  WaveAcc2xCSumT1(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on Acc_x.' )
+            CALL ApplyFFT_cx(  WaveAcc2ySumT1(:),  WaveAcc2yCSumT1(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on Acc_y.' )
+            CALL ApplyFFT_cx(  WaveAcc2zSumT1(:),  WaveAcc2zCSumT1(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on Acc_z.' )
+
+            CALL ApplyFFT_cx(  WaveDynP2SumT1(:),  WaveDynP2CSumT1(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on DynP2.' )
+
+            CALL ApplyFFT_cx(  WaveVel2xSumT2(:),  WaveVel2xCSumT2(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on V_x.' )
+            CALL ApplyFFT_cx(  WaveVel2ySumT2(:),  WaveVel2yCSumT2(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on V_y.' )
+            CALL ApplyFFT_cx(  WaveVel2zSumT2(:),  WaveVel2zCSumT2(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on V_z.' )
+
+            CALL ApplyFFT_cx(  WaveAcc2xSumT2(:),  WaveAcc2xCSumT2(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on Acc_x.' )
+            CALL ApplyFFT_cx(  WaveAcc2ySumT2(:),  WaveAcc2yCSumT2(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on Acc_y.' )
+            CALL ApplyFFT_cx(  WaveAcc2zSumT2(:),  WaveAcc2zCSumT2(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on Acc_z.' )
+
+            CALL ApplyFFT_cx(  WaveDynP2SumT2(:),  WaveDynP2CSumT2(:), FFT_DataThd, ErrStatTmp )
+               CALL SetErrStatOMP( ErrStatTmp, 'Error occurred while applying the FFT on DynP2.' )
 
                ! Add the results to the output
             ii = mod(masterCount-1, InitInp%NGrid(1)) + 1
@@ -1186,6 +1187,15 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
 
          ENDDO    ! I=1,NWaveKin0Prime loop end
+         !$OMP END DO NOWAIT
+
+         CALL ExitFFT(FFT_DataThd, ErrStatTmp)
+         !$OMP END PARALLEL
+
+         IF ( ErrStat >= AbortErrLev ) THEN
+            CALL CleanUp()
+            RETURN
+         END IF
 
 
             ! Deallocate working arrays.
@@ -1235,19 +1245,8 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
 
 
-         CALL  ExitFFT(FFT_Data, ErrStatTmp)
-         CALL  SetErrStat(ErrStatTmp,'Error occurred while cleaning up after the FFTs.', ErrStat,ErrMsg,RoutineName)
-         IF ( ErrStat >= AbortErrLev ) THEN
-            CALL CleanUp()
-            RETURN
-         END IF
-
-
             ! If we calculated any second order wave elevation corrections, the array TmpTimeSeries was used.  Deallocate it.
          IF (ALLOCATED(TmpTimeSeries))    DEALLOCATE(TmpTimeSeries,     STAT=ErrStatTmp)
-         IF (ALLOCATED(TmpTimeSeries2))   DEALLOCATE(TmpTimeSeries2,    STAT=ErrStatTmp)
-         IF (ALLOCATED(TmpFreqSeries))    DEALLOCATE(TmpFreqSeries,     STAT=ErrStatTmp)
-         IF (ALLOCATED(TmpFreqSeries2))   DEALLOCATE(TmpFreqSeries2,    STAT=ErrStatTmp)
 
          RETURN
 
@@ -1270,11 +1269,12 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
       !! result is zero.  So this term is not included.
       !!
       !! Also notice that the multiplier 2 is moved inside the IFFT.  This was done purely to make the programming simpler.
-      SUBROUTINE WaveElevTimeSeriesAtXY_Diff(Xcoord,Ycoord, WaveElevSeriesAtXY, ErrStatLcl, ErrMsgLcl )
+      SUBROUTINE WaveElevTimeSeriesAtXY_Diff(Xcoord,Ycoord, WaveElevSeriesAtXY, FFT_DataLcl, ErrStatLcl, ErrMsgLcl )
    
          REAL(SiKi),       INTENT(IN   )              :: Xcoord
          REAL(SiKi),       INTENT(IN   )              :: Ycoord
          REAL(SiKi),       INTENT(  OUT)              :: WaveElevSeriesAtXY(0:WaveField%NStepWave)
+         TYPE(FFT_DataType), INTENT(IN   )            :: FFT_DataLcl    !< FFT work data owned by the calling thread
          INTEGER(IntKi),   INTENT(  OUT)              :: ErrStatLcl
          INTEGER(IntKi)                               :: ErrStatLcl2
          CHARACTER(*),     INTENT(  OUT)              :: ErrMsgLcl
@@ -1290,13 +1290,23 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
          REAL(SiKi)                                   :: Omega_n        !< First  frequency of index n
          REAL(SiKi)                                   :: Omega_m        !< Second frequency of index m
          REAL(SiKi)                                   :: D_minus        !< Value of \f$ D^-_{nm} \f$ found by ::TransFuncD_minus
+         INTEGER(IntKi)                               :: mu_minus       !< Index to the difference frequency
+         REAL(SiKi)                                   :: Omega_minus    !< The difference frequency corresponding to \f$ \omega_{\mu^-} \f$
+         COMPLEX(SiKi)                                :: WaveElevxyPrime0  !< Phase shift for the (x,y) location
+         COMPLEX(SiKi)                                :: WaveElevC_n    !< The complex wave elevation for the nth frequency component
+         COMPLEX(SiKi)                                :: WaveElevC_m    !< The complex wave elevation for the mth frequency component
+         COMPLEX(SiKi),    ALLOCATABLE                :: TmpFreqSeries(:)  !< Frequency series for this point
 
             ! Initializations
          ErrMsgLcl   = ''
          ErrStatLcl  = ErrID_None
-  
-            ! Note that TmpFreqSeries was allocated in the calling routine.  Probably bad programming
-            ! practice, but I didn't want to have to allocate it at each point.
+
+            ! The work arrays are local so that points can be evaluated concurrently from Waves2_Init.
+         ALLOCATE ( TmpFreqSeries(0:WaveField%NStepWave2), STAT=ErrStatLcl2 )
+         IF (ErrStatLcl2 /= 0) THEN
+            CALL SetErrStat(ErrID_Fatal,'Cannot allocate array TmpFreqSeries.',ErrStatLcl,ErrMsgLcl,'WaveElevSeriesAtXY_Diff')
+            RETURN
+         END IF
          TmpFreqSeries  =  CMPLX(0.0_SiKi, 0.0_SiKi, SiKi)
          WaveElevSeriesAtXY   =  0.0_SiKi
 
@@ -1375,7 +1385,7 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
             !> ### Apply the inverse FFT to each of the components to get the time domain result ###
             !> *   \f$ \eta(t) = \operatorname{IFFT}\left[2 H^-\right] \f$
-         CALL ApplyFFT_cx( WaveElevSeriesAtXY(:), TmpFreqSeries(:), FFT_Data, ErrStatLcl2 )
+         CALL ApplyFFT_cx( WaveElevSeriesAtXY(:), TmpFreqSeries(:), FFT_DataLcl, ErrStatLcl2 )
          CALL SetErrStat(ErrStatLcl2,'Error occurred while applying the FFT on WaveElevSeriesAtXY.',ErrStatLcl,ErrMsgLcl,'WaveElevSeriesAtXY_Diff')
  
             ! Append first datapoint as the last as aid for repeated wave data
@@ -1397,11 +1407,12 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
       !!                         \exp(\imath \omega_{\mu^+} t) \right]
       !!                   =  \operatorname{IFFT}\left[K^+\right] + 2\operatorname{IFFT}\left[H^+\right]     \f$
       !!
-      SUBROUTINE WaveElevTimeSeriesAtXY_Sum(Xcoord,Ycoord, WaveElevSeriesAtXY, ErrStatLcl, ErrMsgLcl )
+      SUBROUTINE WaveElevTimeSeriesAtXY_Sum(Xcoord,Ycoord, WaveElevSeriesAtXY, FFT_DataLcl, ErrStatLcl, ErrMsgLcl )
    
          REAL(SiKi),       INTENT(IN   )              :: Xcoord
          REAL(SiKi),       INTENT(IN   )              :: Ycoord
          REAL(SiKi),       INTENT(  OUT)              :: WaveElevSeriesAtXY(0:WaveField%NStepWave)
+         TYPE(FFT_DataType), INTENT(IN   )            :: FFT_DataLcl    !< FFT work data owned by the calling thread
          INTEGER(IntKi),   INTENT(  OUT)              :: ErrStatLcl
          INTEGER(IntKi)                               :: ErrStatLcl2
          CHARACTER(*),     INTENT(  OUT)              :: ErrMsgLcl
@@ -1418,13 +1429,25 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
          REAL(SiKi)                                   :: Omega_n        !< First  frequency of index n
          REAL(SiKi)                                   :: Omega_m        !< Second frequency of index m
          REAL(SiKi)                                   :: D_plus         !< Value of \f$ D^+_{nm} \f$ found by ::TransFuncD_plus
+         INTEGER(IntKi)                               :: mu_plus        !< Index to the sum frequency
+         REAL(SiKi)                                   :: Omega_plus     !< The sum frequency corresponding to \f$ \omega_{\mu^+} \f$
+         COMPLEX(SiKi)                                :: WaveElevxyPrime0  !< Phase shift for the (x,y) location
+         COMPLEX(SiKi)                                :: WaveElevC_n    !< The complex wave elevation for the nth frequency component
+         COMPLEX(SiKi)                                :: WaveElevC_m    !< The complex wave elevation for the mth frequency component
+         REAL(SiKi),       ALLOCATABLE                :: TmpTimeSeries2(:) !< Time series of the second term
+         COMPLEX(SiKi),    ALLOCATABLE                :: TmpFreqSeries(:)  !< Frequency series of the first term
+         COMPLEX(SiKi),    ALLOCATABLE                :: TmpFreqSeries2(:) !< Frequency series of the second term
 
             ! Initializations
          ErrMsgLcl   = ''
          ErrStatLcl  = ErrID_None
-  
-            ! Note that TmpFreqSeries was allocated in the calling routine.  Probably bad programming
-            ! practice, but I didn't want to have to allocate it at each point.
+
+            ! The work arrays are local so that points can be evaluated concurrently from Waves2_Init.
+         ALLOCATE ( TmpTimeSeries2(0:WaveField%NStepWave), TmpFreqSeries(0:WaveField%NStepWave2), TmpFreqSeries2(0:WaveField%NStepWave2), STAT=ErrStatLcl2 )
+         IF (ErrStatLcl2 /= 0) THEN
+            CALL SetErrStat(ErrID_Fatal,'Cannot allocate work arrays.',ErrStatLcl,ErrMsgLcl,'WaveElevSeriesAtXY_Sum')
+            RETURN
+         END IF
          TmpFreqSeries  =  CMPLX(0.0_SiKi, 0.0_SiKi, SiKi)     ! used for first term
          TmpFreqSeries2 =  CMPLX(0.0_SiKi, 0.0_SiKi, SiKi)     ! used for second term
          WaveElevSeriesAtXY   =  0.0_SiKi
@@ -1562,9 +1585,9 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
             !> ## Apply the inverse FFT to the first and second terms to get the time domain result ##
             !> *   \f$ \eta^{(2)+}(t)  =  \operatorname{IFFT}\left[K^+\right]
             !!                         + 2\operatorname{IFFT}\left[H^+\right]     \f$
-         CALL ApplyFFT_cx( WaveElevSeriesAtXY(:),  TmpFreqSeries(:), FFT_Data, ErrStatLcl2 )
+         CALL ApplyFFT_cx( WaveElevSeriesAtXY(:),  TmpFreqSeries(:), FFT_DataLcl, ErrStatLcl2 )
          CALL SetErrStat(ErrStatLcl2,'Error occurred while applying the FFT on WaveElevSeriesAtXY.',ErrStatLcl,ErrMsgLcl,'WaveElevSeriesAtXY_Sum')
-         CALL ApplyFFT_cx( TmpTimeSeries2(:),      TmpFreqSeries2(:), FFT_Data, ErrStatLcl2 )
+         CALL ApplyFFT_cx( TmpTimeSeries2(:),      TmpFreqSeries2(:), FFT_DataLcl, ErrStatLcl2 )
          CALL SetErrStat(ErrStatLcl2,'Error occurred while applying the FFT on WaveElevSeriesAtXY.',ErrStatLcl,ErrMsgLcl,'WaveElevSeriesAtXY_Sum')
 
             ! Add the two terms together
@@ -1949,9 +1972,19 @@ SUBROUTINE Waves2_Init( InitInp, InitOut, WaveField, ErrStat, ErrMsg )
 
 
 
-      SUBROUTINE CleanUp()
+      !> Sets the error status from inside an OpenMP parallel region; the caller checks ErrStat after the region.
+      SUBROUTINE SetErrStatOMP(ErrStatLcl, ErrMsgLcl)
+         INTEGER(IntKi),   INTENT(IN   )              :: ErrStatLcl
+         CHARACTER(*),     INTENT(IN   )              :: ErrMsgLcl
+         IF (ErrStatLcl /= ErrID_None) THEN
+            !$OMP CRITICAL(Waves2_ErrStat)
+            CALL SetErrStat(ErrStatLcl, ErrMsgLcl, ErrStat, ErrMsg, RoutineName)
+            !$OMP END CRITICAL(Waves2_ErrStat)
+         END IF
+      END SUBROUTINE SetErrStatOMP
 
-         CALL  ExitFFT(FFT_Data, ErrStatTmp)
+
+      SUBROUTINE CleanUp()
 
          IF (ALLOCATED(TmpTimeSeries))    DEALLOCATE(TmpTimeSeries,     STAT=ErrStatTmp)
 
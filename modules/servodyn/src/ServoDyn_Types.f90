@@ -2321,6 +2321,92 @@ subroutine SrvD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrS
    end if
 end subroutine
 
+subroutine SrvD_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(SrvD_ContinuousStateType), intent(inout) :: ContStateData1
+   type(SrvD_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_DummyContState
+   character(*), parameter        :: RoutineName = 'SrvD_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyContState = ContStateData1%DummyContState
+   ContStateData1%DummyContState = ContStateData2%DummyContState
+   ContStateData2%DummyContState = tmp_DummyContState
+   if (allocated(ContStateData1%BStC) .neqv. allocated(ContStateData2%BStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%BStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%BStC)) then
+      if (any(lbound(ContStateData1%BStC) /= lbound(ContStateData2%BStC)) .or. any(ubound(ContStateData1%BStC) /= ubound(ContStateData2%BStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%BStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ContStateData1%BStC)
+      UB(1:1) = ubound(ContStateData1%BStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapContState(ContStateData1%BStC(i1), ContStateData2%BStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(ContStateData1%NStC) .neqv. allocated(ContStateData2%NStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%NStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%NStC)) then
+      if (any(lbound(ContStateData1%NStC) /= lbound(ContStateData2%NStC)) .or. any(ubound(ContStateData1%NStC) /= ubound(ContStateData2%NStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%NStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ContStateData1%NStC)
+      UB(1:1) = ubound(ContStateData1%NStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapContState(ContStateData1%NStC(i1), ContStateData2%NStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(ContStateData1%TStC) .neqv. allocated(ContStateData2%TStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%TStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%TStC)) then
+      if (any(lbound(ContStateData1%TStC) /= lbound(ContStateData2%TStC)) .or. any(ubound(ContStateData1%TStC) /= ubound(ContStateData2%TStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%TStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ContStateData1%TStC)
+      UB(1:1) = ubound(ContStateData1%TStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapContState(ContStateData1%TStC(i1), ContStateData2%TStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(ContStateData1%SStC) .neqv. allocated(ContStateData2%SStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%SStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ContStateData1%SStC)) then
+      if (any(lbound(ContStateData1%SStC) /= lbound(ContStateData2%SStC)) .or. any(ubound(ContStateData1%SStC) /= ubound(ContStateData2%SStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ContStateData1%SStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ContStateData1%SStC)
+      UB(1:1) = ubound(ContStateData1%SStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapContState(ContStateData1%SStC(i1), ContStateData2%SStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+end subroutine
+
 subroutine SrvD_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(SrvD_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2562,6 +2648,96 @@ subroutine SrvD_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrS
    end if
 end subroutine
 
+subroutine SrvD_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(SrvD_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(SrvD_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_CtrlOffset
+   REAL(ReKi) :: tmp_CtrlIntegral
+   character(*), parameter        :: RoutineName = 'SrvD_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_CtrlOffset = DiscStateData1%CtrlOffset
+   DiscStateData1%CtrlOffset = DiscStateData2%CtrlOffset
+   DiscStateData2%CtrlOffset = tmp_CtrlOffset
+   tmp_CtrlIntegral = DiscStateData1%CtrlIntegral
+   DiscStateData1%CtrlIntegral = DiscStateData2%CtrlIntegral
+   DiscStateData2%CtrlIntegral = tmp_CtrlIntegral
+   if (allocated(DiscStateData1%BStC) .neqv. allocated(DiscStateData2%BStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%BStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(DiscStateData1%BStC)) then
+      if (any(lbound(DiscStateData1%BStC) /= lbound(DiscStateData2%BStC)) .or. any(ubound(DiscStateData1%BStC) /= ubound(DiscStateData2%BStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%BStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(DiscStateData1%BStC)
+      UB(1:1) = ubound(DiscStateData1%BStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapDiscState(DiscStateData1%BStC(i1), DiscStateData2%BStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(DiscStateData1%NStC) .neqv. allocated(DiscStateData2%NStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%NStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(DiscStateData1%NStC)) then
+      if (any(lbound(DiscStateData1%NStC) /= lbound(DiscStateData2%NStC)) .or. any(ubound(DiscStateData1%NStC) /= ubound(DiscStateData2%NStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%NStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(DiscStateData1%NStC)
+      UB(1:1) = ubound(DiscStateData1%NStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapDiscState(DiscStateData1%NStC(i1), DiscStateData2%NStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(DiscStateData1%TStC) .neqv. allocated(DiscStateData2%TStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%TStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(DiscStateData1%TStC)) then
+      if (any(lbound(DiscStateData1%TStC) /= lbound(DiscStateData2%TStC)) .or. any(ubound(DiscStateData1%TStC) /= ubound(DiscStateData2%TStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%TStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(DiscStateData1%TStC)
+      UB(1:1) = ubound(DiscStateData1%TStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapDiscState(DiscStateData1%TStC(i1), DiscStateData2%TStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(DiscStateData1%SStC) .neqv. allocated(DiscStateData2%SStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%SStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(DiscStateData1%SStC)) then
+      if (any(lbound(DiscStateData1%SStC) /= lbound(DiscStateData2%SStC)) .or. any(ubound(DiscStateData1%SStC) /= ubound(DiscStateData2%SStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%SStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(DiscStateData1%SStC)
+      UB(1:1) = ubound(DiscStateData1%SStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapDiscState(DiscStateData1%SStC(i1), DiscStateData2%SStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+end subroutine
+
 subroutine SrvD_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(SrvD_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2804,6 +2980,92 @@ subroutine SrvD_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode
    end if
 end subroutine
 
+subroutine SrvD_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(SrvD_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(SrvD_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'SrvD_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+   if (allocated(ConstrStateData1%BStC) .neqv. allocated(ConstrStateData2%BStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%BStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ConstrStateData1%BStC)) then
+      if (any(lbound(ConstrStateData1%BStC) /= lbound(ConstrStateData2%BStC)) .or. any(ubound(ConstrStateData1%BStC) /= ubound(ConstrStateData2%BStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%BStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ConstrStateData1%BStC)
+      UB(1:1) = ubound(ConstrStateData1%BStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapConstrState(ConstrStateData1%BStC(i1), ConstrStateData2%BStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(ConstrStateData1%NStC) .neqv. allocated(ConstrStateData2%NStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%NStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ConstrStateData1%NStC)) then
+      if (any(lbound(ConstrStateData1%NStC) /= lbound(ConstrStateData2%NStC)) .or. any(ubound(ConstrStateData1%NStC) /= ubound(ConstrStateData2%NStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%NStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ConstrStateData1%NStC)
+      UB(1:1) = ubound(ConstrStateData1%NStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapConstrState(ConstrStateData1%NStC(i1), ConstrStateData2%NStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(ConstrStateData1%TStC) .neqv. allocated(ConstrStateData2%TStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%TStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ConstrStateData1%TStC)) then
+      if (any(lbound(ConstrStateData1%TStC) /= lbound(ConstrStateData2%TStC)) .or. any(ubound(ConstrStateData1%TStC) /= ubound(ConstrStateData2%TStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%TStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ConstrStateData1%TStC)
+      UB(1:1) = ubound(ConstrStateData1%TStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapConstrState(ConstrStateData1%TStC(i1), ConstrStateData2%TStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(ConstrStateData1%SStC) .neqv. allocated(ConstrStateData2%SStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%SStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(ConstrStateData1%SStC)) then
+      if (any(lbound(ConstrStateData1%SStC) /= lbound(ConstrStateData2%SStC)) .or. any(ubound(ConstrStateData1%SStC) /= ubound(ConstrStateData2%SStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap ConstrStateData1%SStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(ConstrStateData1%SStC)
+      UB(1:1) = ubound(ConstrStateData1%SStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapConstrState(ConstrStateData1%SStC(i1), ConstrStateData2%SStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+end subroutine
+
 subroutine SrvD_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(SrvD_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3121,6 +3383,136 @@ subroutine SrvD_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, E
    end if
 end subroutine
 
+subroutine SrvD_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(SrvD_OtherStateType), intent(inout) :: OtherStateData1
+   type(SrvD_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   LOGICAL, allocatable :: tmp_BegPitMan(:)
+   REAL(ReKi), allocatable :: tmp_BlPitchI(:)
+   REAL(DbKi), allocatable :: tmp_TPitManE(:)
+   LOGICAL :: tmp_BegYawMan
+   REAL(ReKi) :: tmp_NacYawI
+   REAL(DbKi) :: tmp_TYawManE
+   REAL(ReKi) :: tmp_YawPosComInt
+   LOGICAL, allocatable :: tmp_BegTpBr(:)
+   REAL(DbKi), allocatable :: tmp_TTpBrDp(:)
+   REAL(DbKi), allocatable :: tmp_TTpBrFl(:)
+   LOGICAL :: tmp_Off4Good
+   LOGICAL :: tmp_GenOnLine
+   character(*), parameter        :: RoutineName = 'SrvD_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(OtherStateData1%BegPitMan, tmp_BegPitMan)
+   call move_alloc(OtherStateData2%BegPitMan, OtherStateData1%BegPitMan)
+   call move_alloc(tmp_BegPitMan, OtherStateData2%BegPitMan)
+   call move_alloc(OtherStateData1%BlPitchI, tmp_BlPitchI)
+   call move_alloc(OtherStateData2%BlPitchI, OtherStateData1%BlPitchI)
+   call move_alloc(tmp_BlPitchI, OtherStateData2%BlPitchI)
+   call move_alloc(OtherStateData1%TPitManE, tmp_TPitManE)
+   call move_alloc(OtherStateData2%TPitManE, OtherStateData1%TPitManE)
+   call move_alloc(tmp_TPitManE, OtherStateData2%TPitManE)
+   tmp_BegYawMan = OtherStateData1%BegYawMan
+   OtherStateData1%BegYawMan = OtherStateData2%BegYawMan
+   OtherStateData2%BegYawMan = tmp_BegYawMan
+   tmp_NacYawI = OtherStateData1%NacYawI
+   OtherStateData1%NacYawI = OtherStateData2%NacYawI
+   OtherStateData2%NacYawI = tmp_NacYawI
+   tmp_TYawManE = OtherStateData1%TYawManE
+   OtherStateData1%TYawManE = OtherStateData2%TYawManE
+   OtherStateData2%TYawManE = tmp_TYawManE
+   tmp_YawPosComInt = OtherStateData1%YawPosComInt
+   OtherStateData1%YawPosComInt = OtherStateData2%YawPosComInt
+   OtherStateData2%YawPosComInt = tmp_YawPosComInt
+   call move_alloc(OtherStateData1%BegTpBr, tmp_BegTpBr)
+   call move_alloc(OtherStateData2%BegTpBr, OtherStateData1%BegTpBr)
+   call move_alloc(tmp_BegTpBr, OtherStateData2%BegTpBr)
+   call move_alloc(OtherStateData1%TTpBrDp, tmp_TTpBrDp)
+   call move_alloc(OtherStateData2%TTpBrDp, OtherStateData1%TTpBrDp)
+   call move_alloc(tmp_TTpBrDp, OtherStateData2%TTpBrDp)
+   call move_alloc(OtherStateData1%TTpBrFl, tmp_TTpBrFl)
+   call move_alloc(OtherStateData2%TTpBrFl, OtherStateData1%TTpBrFl)
+   call move_alloc(tmp_TTpBrFl, OtherStateData2%TTpBrFl)
+   tmp_Off4Good = OtherStateData1%Off4Good
+   OtherStateData1%Off4Good = OtherStateData2%Off4Good
+   OtherStateData2%Off4Good = tmp_Off4Good
+   tmp_GenOnLine = OtherStateData1%GenOnLine
+   OtherStateData1%GenOnLine = OtherStateData2%GenOnLine
+   OtherStateData2%GenOnLine = tmp_GenOnLine
+   if (allocated(OtherStateData1%BStC) .neqv. allocated(OtherStateData2%BStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%BStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%BStC)) then
+      if (any(lbound(OtherStateData1%BStC) /= lbound(OtherStateData2%BStC)) .or. any(ubound(OtherStateData1%BStC) /= ubound(OtherStateData2%BStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%BStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%BStC)
+      UB(1:1) = ubound(OtherStateData1%BStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapOtherState(OtherStateData1%BStC(i1), OtherStateData2%BStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(OtherStateData1%NStC) .neqv. allocated(OtherStateData2%NStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%NStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%NStC)) then
+      if (any(lbound(OtherStateData1%NStC) /= lbound(OtherStateData2%NStC)) .or. any(ubound(OtherStateData1%NStC) /= ubound(OtherStateData2%NStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%NStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%NStC)
+      UB(1:1) = ubound(OtherStateData1%NStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapOtherState(OtherStateData1%NStC(i1), OtherStateData2%NStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(OtherStateData1%TStC) .neqv. allocated(OtherStateData2%TStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%TStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%TStC)) then
+      if (any(lbound(OtherStateData1%TStC) /= lbound(OtherStateData2%TStC)) .or. any(ubound(OtherStateData1%TStC) /= ubound(OtherStateData2%TStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%TStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%TStC)
+      UB(1:1) = ubound(OtherStateData1%TStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapOtherState(OtherStateData1%TStC(i1), OtherStateData2%TStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(OtherStateData1%SStC) .neqv. allocated(OtherStateData2%SStC)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%SStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%SStC)) then
+      if (any(lbound(OtherStateData1%SStC) /= lbound(OtherStateData2%SStC)) .or. any(ubound(OtherStateData1%SStC) /= ubound(OtherStateData2%SStC))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%SStC with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%SStC)
+      UB(1:1) = ubound(OtherStateData1%SStC)
+      do i1 = LB(1), UB(1)
+         call StC_SwapOtherState(OtherStateData1%SStC(i1), OtherStateData2%SStC(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+end subroutine
+
 subroutine SrvD_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(SrvD_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -4712,6 +5104,269 @@ subroutine SrvD_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine SrvD_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(SrvD_InputType), intent(inout) :: InputData1
+   type(SrvD_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_BlPitch(:)
+   REAL(ReKi), allocatable :: tmp_BlPRate(:)
+   REAL(ReKi) :: tmp_Yaw
+   REAL(ReKi) :: tmp_YawRate
+   REAL(ReKi) :: tmp_LSS_Spd
+   REAL(ReKi) :: tmp_HSS_Spd
+   REAL(ReKi) :: tmp_RotSpeed
+   REAL(ReKi) :: tmp_ExternalYawPosCom
+   REAL(ReKi) :: tmp_ExternalYawRateCom
+   REAL(ReKi), allocatable :: tmp_ExternalBlPitchCom(:)
+   REAL(ReKi) :: tmp_ExternalGenTrq
+   REAL(ReKi) :: tmp_ExternalElecPwr
+   REAL(ReKi) :: tmp_ExternalHSSBrFrac
+   REAL(ReKi), allocatable :: tmp_ExternalBlAirfoilCom(:)
+   REAL(ReKi), allocatable :: tmp_ExternalCableDeltaL(:)
+   REAL(ReKi), allocatable :: tmp_ExternalCableDeltaLdot(:)
+   REAL(ReKi) :: tmp_TwrAccel
+   REAL(ReKi) :: tmp_YawErr
+   REAL(ReKi) :: tmp_WindDir
+   REAL(ReKi) :: tmp_RootMyc(1:3)
+   REAL(ReKi) :: tmp_YawBrTAxp
+   REAL(ReKi) :: tmp_YawBrTAyp
+   REAL(ReKi) :: tmp_LSSTipPxa
+   REAL(ReKi) :: tmp_RootMxc(1:3)
+   REAL(ReKi) :: tmp_LSSTipMxa
+   REAL(ReKi) :: tmp_LSSTipMya
+   REAL(ReKi) :: tmp_LSSTipMza
+   REAL(ReKi) :: tmp_LSSTipMys
+   REAL(ReKi) :: tmp_LSSTipMzs
+   REAL(ReKi) :: tmp_YawBrMyn
+   REAL(ReKi) :: tmp_YawBrMzn
+   REAL(ReKi) :: tmp_NcIMURAxs
+   REAL(ReKi) :: tmp_NcIMURAys
+   REAL(ReKi) :: tmp_NcIMURAzs
+   REAL(ReKi) :: tmp_RotPwr
+   REAL(ReKi) :: tmp_HorWindV
+   REAL(ReKi) :: tmp_YawAngle
+   REAL(ReKi) :: tmp_LSShftFxa
+   REAL(ReKi) :: tmp_LSShftFys
+   REAL(ReKi) :: tmp_LSShftFzs
+   REAL(ReKi), allocatable :: tmp_LidSpeed(:)
+   REAL(ReKi), allocatable :: tmp_MsrPositionsX(:)
+   REAL(ReKi), allocatable :: tmp_MsrPositionsY(:)
+   REAL(ReKi), allocatable :: tmp_MsrPositionsZ(:)
+   character(*), parameter        :: RoutineName = 'SrvD_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(InputData1%BlPitch, tmp_BlPitch)
+   call move_alloc(InputData2%BlPitch, InputData1%BlPitch)
+   call move_alloc(tmp_BlPitch, InputData2%BlPitch)
+   call move_alloc(InputData1%BlPRate, tmp_BlPRate)
+   call move_alloc(InputData2%BlPRate, InputData1%BlPRate)
+   call move_alloc(tmp_BlPRate, InputData2%BlPRate)
+   tmp_Yaw = InputData1%Yaw
+   InputData1%Yaw = InputData2%Yaw
+   InputData2%Yaw = tmp_Yaw
+   tmp_YawRate = InputData1%YawRate
+   InputData1%YawRate = InputData2%YawRate
+   InputData2%YawRate = tmp_YawRate
+   tmp_LSS_Spd = InputData1%LSS_Spd
+   InputData1%LSS_Spd = InputData2%LSS_Spd
+   InputData2%LSS_Spd = tmp_LSS_Spd
+   tmp_HSS_Spd = InputData1%HSS_Spd
+   InputData1%HSS_Spd = InputData2%HSS_Spd
+   InputData2%HSS_Spd = tmp_HSS_Spd
+   tmp_RotSpeed = InputData1%RotSpeed
+   InputData1%RotSpeed = InputData2%RotSpeed
+   InputData2%RotSpeed = tmp_RotSpeed
+   tmp_ExternalYawPosCom = InputData1%ExternalYawPosCom
+   InputData1%ExternalYawPosCom = InputData2%ExternalYawPosCom
+   InputData2%ExternalYawPosCom = tmp_ExternalYawPosCom
+   tmp_ExternalYawRateCom = InputData1%ExternalYawRateCom
+   InputData1%ExternalYawRateCom = InputData2%ExternalYawRateCom
+   InputData2%ExternalYawRateCom = tmp_ExternalYawRateCom
+   call move_alloc(InputData1%ExternalBlPitchCom, tmp_ExternalBlPitchCom)
+   call move_alloc(InputData2%ExternalBlPitchCom, InputData1%ExternalBlPitchCom)
+   call move_alloc(tmp_ExternalBlPitchCom, InputData2%ExternalBlPitchCom)
+   tmp_ExternalGenTrq = InputData1%ExternalGenTrq
+   InputData1%ExternalGenTrq = InputData2%ExternalGenTrq
+   InputData2%ExternalGenTrq = tmp_ExternalGenTrq
+   tmp_ExternalElecPwr = InputData1%ExternalElecPwr
+   InputData1%ExternalElecPwr = InputData2%ExternalElecPwr
+   InputData2%ExternalElecPwr = tmp_ExternalElecPwr
+   tmp_ExternalHSSBrFrac = InputData1%ExternalHSSBrFrac
+   InputData1%ExternalHSSBrFrac = InputData2%ExternalHSSBrFrac
+   InputData2%ExternalHSSBrFrac = tmp_ExternalHSSBrFrac
+   call move_alloc(InputData1%ExternalBlAirfoilCom, tmp_ExternalBlAirfoilCom)
+   call move_alloc(InputData2%ExternalBlAirfoilCom, InputData1%ExternalBlAirfoilCom)
+   call move_alloc(tmp_ExternalBlAirfoilCom, InputData2%ExternalBlAirfoilCom)
+   call move_alloc(InputData1%ExternalCableDeltaL, tmp_ExternalCableDeltaL)
+   call move_alloc(InputData2%ExternalCableDeltaL, InputData1%ExternalCableDeltaL)
+   call move_alloc(tmp_ExternalCableDeltaL, InputData2%ExternalCableDeltaL)
+   call move_alloc(InputData1%ExternalCableDeltaLdot, tmp_ExternalCableDeltaLdot)
+   call move_alloc(InputData2%ExternalCableDeltaLdot, InputData1%ExternalCableDeltaLdot)
+   call move_alloc(tmp_ExternalCableDeltaLdot, InputData2%ExternalCableDeltaLdot)
+   tmp_TwrAccel = InputData1%TwrAccel
+   InputData1%TwrAccel = InputData2%TwrAccel
+   InputData2%TwrAccel = tmp_TwrAccel
+   tmp_YawErr = InputData1%YawErr
+   InputData1%YawErr = InputData2%YawErr
+   InputData2%YawErr = tmp_YawErr
+   tmp_WindDir = InputData1%WindDir
+   InputData1%WindDir = InputData2%WindDir
+   InputData2%WindDir = tmp_WindDir
+   tmp_RootMyc = InputData1%RootMyc
+   InputData1%RootMyc = InputData2%RootMyc
+   InputData2%RootMyc = tmp_RootMyc
+   tmp_YawBrTAxp = InputData1%YawBrTAxp
+   InputData1%YawBrTAxp = InputData2%YawBrTAxp
+   InputData2%YawBrTAxp = tmp_YawBrTAxp
+   tmp_YawBrTAyp = InputData1%YawBrTAyp
+   InputData1%YawBrTAyp = InputData2%YawBrTAyp
+   InputData2%YawBrTAyp = tmp_YawBrTAyp
+   tmp_LSSTipPxa = InputData1%LSSTipPxa
+   InputData1%LSSTipPxa = InputData2%LSSTipPxa
+   InputData2%LSSTipPxa = tmp_LSSTipPxa
+   tmp_RootMxc = InputData1%RootMxc
+   InputData1%RootMxc = InputData2%RootMxc
+   InputData2%RootMxc = tmp_RootMxc
+   tmp_LSSTipMxa = InputData1%LSSTipMxa
+   InputData1%LSSTipMxa = InputData2%LSSTipMxa
+   InputData2%LSSTipMxa = tmp_LSSTipMxa
+   tmp_LSSTipMya = InputData1%LSSTipMya
+   InputData1%LSSTipMya = InputData2%LSSTipMya
+   InputData2%LSSTipMya = tmp_LSSTipMya
+   tmp_LSSTipMza = InputData1%LSSTipMza
+   InputData1%LSSTipMza = InputData2%LSSTipMza
+   InputData2%LSSTipMza = tmp_LSSTipMza
+   tmp_LSSTipMys = InputData1%LSSTipMys
+   InputData1%LSSTipMys = InputData2%LSSTipMys
+   InputData2%LSSTipMys = tmp_LSSTipMys
+   tmp_LSSTipMzs = InputData1%LSSTipMzs
+   InputData1%LSSTipMzs = InputData2%LSSTipMzs
+   InputData2%LSSTipMzs = tmp_LSSTipMzs
+   tmp_YawBrMyn = InputData1%YawBrMyn
+   InputData1%YawBrMyn = InputData2%YawBrMyn
+   InputData2%YawBrMyn = tmp_YawBrMyn
+   tmp_YawBrMzn = InputData1%YawBrMzn
+   InputData1%YawBrMzn = InputData2%YawBrMzn
+   InputData2%YawBrMzn = tmp_YawBrMzn
+   tmp_NcIMURAxs = InputData1%NcIMURAxs
+   InputData1%NcIMURAxs = InputData2%NcIMURAxs
+   InputData2%NcIMURAxs = tmp_NcIMURAxs
+   tmp_NcIMURAys = InputData1%NcIMURAys
+   InputData1%NcIMURAys = InputData2%NcIMURAys
+   InputData2%NcIMURAys = tmp_NcIMURAys
+   tmp_NcIMURAzs = InputData1%NcIMURAzs
+   InputData1%NcIMURAzs = InputData2%NcIMURAzs
+   InputData2%NcIMURAzs = tmp_NcIMURAzs
+   tmp_RotPwr = InputData1%RotPwr
+   InputData1%RotPwr = InputData2%RotPwr
+   InputData2%RotPwr = tmp_RotPwr
+   tmp_HorWindV = InputData1%HorWindV
+   InputData1%HorWindV = InputData2%HorWindV
+   InputData2%HorWindV = tmp_HorWindV
+   tmp_YawAngle = InputData1%YawAngle
+   InputData1%YawAngle = InputData2%YawAngle
+   InputData2%YawAngle = tmp_YawAngle
+   tmp_LSShftFxa = InputData1%LSShftFxa
+   InputData1%LSShftFxa = InputData2%LSShftFxa
+   InputData2%LSShftFxa = tmp_LSShftFxa
+   tmp_LSShftFys = InputData1%LSShftFys
+   InputData1%LSShftFys = InputData2%LSShftFys
+   InputData2%LSShftFys = tmp_LSShftFys
+   tmp_LSShftFzs = InputData1%LSShftFzs
+   InputData1%LSShftFzs = InputData2%LSShftFzs
+   InputData2%LSShftFzs = tmp_LSShftFzs
+   call MeshSwap(InputData1%PtfmMotionMesh, InputData2%PtfmMotionMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   if (allocated(InputData1%BStCMotionMesh) .neqv. allocated(InputData2%BStCMotionMesh)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BStCMotionMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%BStCMotionMesh)) then
+      if (any(lbound(InputData1%BStCMotionMesh) /= lbound(InputData2%BStCMotionMesh)) .or. any(ubound(InputData1%BStCMotionMesh) /= ubound(InputData2%BStCMotionMesh))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%BStCMotionMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:2) = lbound(InputData1%BStCMotionMesh)
+      UB(1:2) = ubound(InputData1%BStCMotionMesh)
+      do i2 = LB(2), UB(2)
+         do i1 = LB(1), UB(1)
+            call MeshSwap(InputData1%BStCMotionMesh(i1,i2), InputData2%BStCMotionMesh(i1,i2), ErrStat2, ErrMsg2)
+            call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+            if (ErrStat >= AbortErrLev) return
+         end do
+      end do
+   end if
+   if (allocated(InputData1%NStCMotionMesh) .neqv. allocated(InputData2%NStCMotionMesh)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%NStCMotionMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%NStCMotionMesh)) then
+      if (any(lbound(InputData1%NStCMotionMesh) /= lbound(InputData2%NStCMotionMesh)) .or. any(ubound(InputData1%NStCMotionMesh) /= ubound(InputData2%NStCMotionMesh))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%NStCMotionMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%NStCMotionMesh)
+      UB(1:1) = ubound(InputData1%NStCMotionMesh)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%NStCMotionMesh(i1), InputData2%NStCMotionMesh(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(InputData1%TStCMotionMesh) .neqv. allocated(InputData2%TStCMotionMesh)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%TStCMotionMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%TStCMotionMesh)) then
+      if (any(lbound(InputData1%TStCMotionMesh) /= lbound(InputData2%TStCMotionMesh)) .or. any(ubound(InputData1%TStCMotionMesh) /= ubound(InputData2%TStCMotionMesh))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%TStCMotionMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%TStCMotionMesh)
+      UB(1:1) = ubound(InputData1%TStCMotionMesh)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%TStCMotionMesh(i1), InputData2%TStCMotionMesh(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   if (allocated(InputData1%SStCMotionMesh) .neqv. allocated(InputData2%SStCMotionMesh)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%SStCMotionMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%SStCMotionMesh)) then
+      if (any(lbound(InputData1%SStCMotionMesh) /= lbound(InputData2%SStCMotionMesh)) .or. any(ubound(InputData1%SStCMotionMesh) /= ubound(InputData2%SStCMotionMesh))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%SStCMotionMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%SStCMotionMesh)
+      UB(1:1) = ubound(InputData1%SStCMotionMesh)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%SStCMotionMesh(i1), InputData2%SStCMotionMesh(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call move_alloc(InputData1%LidSpeed, tmp_LidSpeed)
+   call move_alloc(InputData2%LidSpeed, InputData1%LidSpeed)
+   call move_alloc(tmp_LidSpeed, InputData2%LidSpeed)
+   call move_alloc(InputData1%MsrPositionsX, tmp_MsrPositionsX)
+   call move_alloc(InputData2%MsrPositionsX, InputData1%MsrPositionsX)
+   call move_alloc(tmp_MsrPositionsX, InputData2%MsrPositionsX)
+   call move_alloc(InputData1%MsrPositionsY, tmp_MsrPositionsY)
+   call move_alloc(InputData2%MsrPositionsY, InputData1%MsrPositionsY)
+   call move_alloc(tmp_MsrPositionsY, InputData2%MsrPositionsY)
+   call move_alloc(InputData1%MsrPositionsZ, tmp_MsrPositionsZ)
+   call move_alloc(InputData2%MsrPositionsZ, InputData1%MsrPositionsZ)
+   call move_alloc(tmp_MsrPositionsZ, InputData2%MsrPositionsZ)
+end subroutine
+
 subroutine SrvD_DestroyInput(InputData, ErrStat, ErrMsg)
    type(SrvD_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1060,6 +1060,20 @@ subroutine StC_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSt
    end if
 end subroutine
 
+subroutine StC_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(StC_ContinuousStateType), intent(inout) :: ContStateData1
+   type(StC_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi), allocatable :: tmp_StC_x(:,:)
+   character(*), parameter        :: RoutineName = 'StC_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%StC_x, tmp_StC_x)
+   call move_alloc(ContStateData2%StC_x, ContStateData1%StC_x)
+   call move_alloc(tmp_StC_x, ContStateData2%StC_x)
+end subroutine
+
 subroutine StC_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(StC_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1104,6 +1118,20 @@ subroutine StC_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSt
    DstDiscStateData%DummyDiscState = SrcDiscStateData%DummyDiscState
 end subroutine
 
+subroutine StC_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(StC_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(StC_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyDiscState
+   character(*), parameter        :: RoutineName = 'StC_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscState = DiscStateData1%DummyDiscState
+   DiscStateData1%DummyDiscState = DiscStateData2%DummyDiscState
+   DiscStateData2%DummyDiscState = tmp_DummyDiscState
+end subroutine
+
 subroutine StC_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(StC_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1142,6 +1170,20 @@ subroutine StC_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine StC_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(StC_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(StC_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'StC_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine StC_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(StC_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1180,6 +1222,20 @@ subroutine StC_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Er
    DstOtherStateData%DummyOtherState = SrcOtherStateData%DummyOtherState
 end subroutine
 
+subroutine StC_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(StC_OtherStateType), intent(inout) :: OtherStateData1
+   type(StC_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyOtherState
+   character(*), parameter        :: RoutineName = 'StC_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyOtherState = OtherStateData1%DummyOtherState
+   OtherStateData1%DummyOtherState = OtherStateData2%DummyOtherState
+   OtherStateData2%DummyOtherState = tmp_DummyOtherState
+end subroutine
+
 subroutine StC_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(StC_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1920,6 +1976,57 @@ subroutine StC_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine StC_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(StC_InputType), intent(inout) :: InputData1
+   type(StC_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1, i2
+   integer(B4Ki)                  :: LB(2), UB(2)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_CmdStiff(:,:)
+   REAL(ReKi), allocatable :: tmp_CmdDamp(:,:)
+   REAL(ReKi), allocatable :: tmp_CmdBrake(:,:)
+   REAL(ReKi), allocatable :: tmp_CmdForce(:,:)
+   REAL(ReKi), allocatable :: tmp_CmdMoment(:,:)
+   character(*), parameter        :: RoutineName = 'StC_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(InputData1%Mesh) .neqv. allocated(InputData2%Mesh)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%Mesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%Mesh)) then
+      if (any(lbound(InputData1%Mesh) /= lbound(InputData2%Mesh)) .or. any(ubound(InputData1%Mesh) /= ubound(InputData2%Mesh))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%Mesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%Mesh)
+      UB(1:1) = ubound(InputData1%Mesh)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%Mesh(i1), InputData2%Mesh(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call move_alloc(InputData1%CmdStiff, tmp_CmdStiff)
+   call move_alloc(InputData2%CmdStiff, InputData1%CmdStiff)
+   call move_alloc(tmp_CmdStiff, InputData2%CmdStiff)
+   call move_alloc(InputData1%CmdDamp, tmp_CmdDamp)
+   call move_alloc(InputData2%CmdDamp, InputData1%CmdDamp)
+   call move_alloc(tmp_CmdDamp, InputData2%CmdDamp)
+   call move_alloc(InputData1%CmdBrake, tmp_CmdBrake)
+   call move_alloc(InputData2%CmdBrake, InputData1%CmdBrake)
+   call move_alloc(tmp_CmdBrake, InputData2%CmdBrake)
+   call move_alloc(InputData1%CmdForce, tmp_CmdForce)
+   call move_alloc(InputData2%CmdForce, InputData1%CmdForce)
+   call move_alloc(tmp_CmdForce, InputData2%CmdForce)
+   call move_alloc(InputData1%CmdMoment, tmp_CmdMoment)
+   call move_alloc(InputData2%CmdMoment, InputData1%CmdMoment)
+   call move_alloc(tmp_CmdMoment, InputData2%CmdMoment)
+end subroutine
+
 subroutine StC_DestroyInput(InputData, ErrStat, ErrMsg)
    type(StC_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
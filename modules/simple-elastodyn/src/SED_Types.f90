@@ -560,6 +560,41 @@ subroutine SED_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    DstInputData%YawRateCom = SrcInputData%YawRateCom
 end subroutine
 
+subroutine SED_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(SED_InputType), intent(inout) :: InputData1
+   type(SED_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi) :: tmp_HSSBrTrqC
+   REAL(ReKi) :: tmp_GenTrq
+   REAL(ReKi), allocatable :: tmp_BlPitchCom(:)
+   REAL(ReKi) :: tmp_YawPosCom
+   REAL(ReKi) :: tmp_YawRateCom
+   character(*), parameter        :: RoutineName = 'SED_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%HubPtLoad, InputData2%HubPtLoad, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   tmp_HSSBrTrqC = InputData1%HSSBrTrqC
+   InputData1%HSSBrTrqC = InputData2%HSSBrTrqC
+   InputData2%HSSBrTrqC = tmp_HSSBrTrqC
+   tmp_GenTrq = InputData1%GenTrq
+   InputData1%GenTrq = InputData2%GenTrq
+   InputData2%GenTrq = tmp_GenTrq
+   call move_alloc(InputData1%BlPitchCom, tmp_BlPitchCom)
+   call move_alloc(InputData2%BlPitchCom, InputData1%BlPitchCom)
+   call move_alloc(tmp_BlPitchCom, InputData2%BlPitchCom)
+   tmp_YawPosCom = InputData1%YawPosCom
+   InputData1%YawPosCom = InputData2%YawPosCom
+   InputData2%YawPosCom = tmp_YawPosCom
+   tmp_YawRateCom = InputData1%YawRateCom
+   InputData1%YawRateCom = InputData2%YawRateCom
+   InputData2%YawRateCom = tmp_YawRateCom
+end subroutine
+
 subroutine SED_DestroyInput(InputData, ErrStat, ErrMsg)
    type(SED_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -822,6 +857,24 @@ subroutine SED_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSt
    end if
 end subroutine
 
+subroutine SED_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(SED_ContinuousStateType), intent(inout) :: ContStateData1
+   type(SED_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki), allocatable :: tmp_QT(:)
+   REAL(R8Ki), allocatable :: tmp_QDT(:)
+   character(*), parameter        :: RoutineName = 'SED_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%QT, tmp_QT)
+   call move_alloc(ContStateData2%QT, ContStateData1%QT)
+   call move_alloc(tmp_QT, ContStateData2%QT)
+   call move_alloc(ContStateData1%QDT, tmp_QDT)
+   call move_alloc(ContStateData2%QDT, ContStateData1%QDT)
+   call move_alloc(tmp_QDT, ContStateData2%QDT)
+end subroutine
+
 subroutine SED_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(SED_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -871,6 +924,20 @@ subroutine SED_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSt
    DstDiscStateData%DummyDiscreteState = SrcDiscStateData%DummyDiscreteState
 end subroutine
 
+subroutine SED_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(SED_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(SED_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyDiscreteState
+   character(*), parameter        :: RoutineName = 'SED_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscreteState = DiscStateData1%DummyDiscreteState
+   DiscStateData1%DummyDiscreteState = DiscStateData2%DummyDiscreteState
+   DiscStateData2%DummyDiscreteState = tmp_DummyDiscreteState
+end subroutine
+
 subroutine SED_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(SED_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -909,6 +976,20 @@ subroutine SED_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine SED_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(SED_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(SED_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'SED_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine SED_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(SED_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -963,6 +1044,51 @@ subroutine SED_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Er
    DstOtherStateData%SgnLSTQ = SrcOtherStateData%SgnLSTQ
 end subroutine
 
+subroutine SED_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(SED_OtherStateType), intent(inout) :: OtherStateData1
+   type(SED_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   INTEGER(IntKi) :: tmp_n
+   INTEGER(IntKi) :: tmp_IC(1:SED_NMX)
+   REAL(ReKi) :: tmp_HSSBrTrq
+   REAL(ReKi) :: tmp_HSSBrTrqC
+   INTEGER(IntKi) :: tmp_SgnPrvLSTQ
+   INTEGER(IntKi) :: tmp_SgnLSTQ(1:SED_NMX)
+   character(*), parameter        :: RoutineName = 'SED_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_n = OtherStateData1%n
+   OtherStateData1%n = OtherStateData2%n
+   OtherStateData2%n = tmp_n
+   LB(1:1) = lbound(OtherStateData1%xdot)
+   UB(1:1) = ubound(OtherStateData1%xdot)
+   do i1 = LB(1), UB(1)
+      call SED_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+      call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      if (ErrStat >= AbortErrLev) return
+   end do
+   tmp_IC = OtherStateData1%IC
+   OtherStateData1%IC = OtherStateData2%IC
+   OtherStateData2%IC = tmp_IC
+   tmp_HSSBrTrq = OtherStateData1%HSSBrTrq
+   OtherStateData1%HSSBrTrq = OtherStateData2%HSSBrTrq
+   OtherStateData2%HSSBrTrq = tmp_HSSBrTrq
+   tmp_HSSBrTrqC = OtherStateData1%HSSBrTrqC
+   OtherStateData1%HSSBrTrqC = OtherStateData2%HSSBrTrqC
+   OtherStateData2%HSSBrTrqC = tmp_HSSBrTrqC
+   tmp_SgnPrvLSTQ = OtherStateData1%SgnPrvLSTQ
+   OtherStateData1%SgnPrvLSTQ = OtherStateData2%SgnPrvLSTQ
+   OtherStateData2%SgnPrvLSTQ = tmp_SgnPrvLSTQ
+   tmp_SgnLSTQ = OtherStateData1%SgnLSTQ
+   OtherStateData1%SgnLSTQ = OtherStateData2%SgnLSTQ
+   OtherStateData2%SgnLSTQ = tmp_SgnLSTQ
+end subroutine
+
 subroutine SED_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(SED_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
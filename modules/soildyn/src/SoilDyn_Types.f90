@@ -259,6 +259,24 @@ subroutine SlD_CopyREDWINdllStates(SrcREDWINdllStatesData, DstREDWINdllStatesDat
    DstREDWINdllStatesData%StVar = SrcREDWINdllStatesData%StVar
 end subroutine
 
+subroutine SlD_SwapREDWINdllStates(REDWINdllStatesData1, REDWINdllStatesData2, ErrStat, ErrMsg)
+   type(REDWINdllStates), intent(inout) :: REDWINdllStatesData1
+   type(REDWINdllStates), intent(inout) :: REDWINdllStatesData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki) :: tmp_Props(1:100,1:200)
+   REAL(R8Ki) :: tmp_StVar(1:12,1:100)
+   character(*), parameter        :: RoutineName = 'SlD_SwapREDWINdllStates'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_Props = REDWINdllStatesData1%Props
+   REDWINdllStatesData1%Props = REDWINdllStatesData2%Props
+   REDWINdllStatesData2%Props = tmp_Props
+   tmp_StVar = REDWINdllStatesData1%StVar
+   REDWINdllStatesData1%StVar = REDWINdllStatesData2%StVar
+   REDWINdllStatesData2%StVar = tmp_StVar
+end subroutine
+
 subroutine SlD_DestroyREDWINdllStates(REDWINdllStatesData, ErrStat, ErrMsg)
    type(REDWINdllStates), intent(inout) :: REDWINdllStatesData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -686,6 +704,20 @@ subroutine SlD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSt
    DstContStateData%DummyContState = SrcContStateData%DummyContState
 end subroutine
 
+subroutine SlD_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(SlD_ContinuousStateType), intent(inout) :: ContStateData1
+   type(SlD_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyContState
+   character(*), parameter        :: RoutineName = 'SlD_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyContState = ContStateData1%DummyContState
+   ContStateData1%DummyContState = ContStateData2%DummyContState
+   ContStateData2%DummyContState = tmp_DummyContState
+end subroutine
+
 subroutine SlD_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(SlD_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -743,6 +775,37 @@ subroutine SlD_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSt
    end if
 end subroutine
 
+subroutine SlD_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(SlD_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(SlD_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'SlD_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(DiscStateData1%dll_states) .neqv. allocated(DiscStateData2%dll_states)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%dll_states with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(DiscStateData1%dll_states)) then
+      if (any(lbound(DiscStateData1%dll_states) /= lbound(DiscStateData2%dll_states)) .or. any(ubound(DiscStateData1%dll_states) /= ubound(DiscStateData2%dll_states))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap DiscStateData1%dll_states with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(DiscStateData1%dll_states)
+      UB(1:1) = ubound(DiscStateData1%dll_states)
+      do i1 = LB(1), UB(1)
+         call SlD_SwapREDWINdllStates(DiscStateData1%dll_states(i1), DiscStateData2%dll_states(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+end subroutine
+
 subroutine SlD_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(SlD_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -820,6 +883,20 @@ subroutine SlD_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine SlD_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(SlD_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(SlD_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'SlD_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine SlD_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(SlD_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -858,6 +935,20 @@ subroutine SlD_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Er
    DstOtherStateData%DummyOtherState = SrcOtherStateData%DummyOtherState
 end subroutine
 
+subroutine SlD_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(SlD_OtherStateType), intent(inout) :: OtherStateData1
+   type(SlD_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   INTEGER(IntKi) :: tmp_DummyOtherState
+   character(*), parameter        :: RoutineName = 'SlD_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyOtherState = OtherStateData1%DummyOtherState
+   OtherStateData1%DummyOtherState = OtherStateData2%DummyOtherState
+   OtherStateData2%DummyOtherState = tmp_DummyOtherState
+end subroutine
+
 subroutine SlD_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(SlD_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1060,6 +1151,21 @@ subroutine SlD_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    if (ErrStat >= AbortErrLev) return
 end subroutine
 
+subroutine SlD_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(SlD_InputType), intent(inout) :: InputData1
+   type(SlD_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   character(*), parameter        :: RoutineName = 'SlD_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call MeshSwap(InputData1%SoilMesh, InputData2%SoilMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+end subroutine
+
 subroutine SlD_DestroyInput(InputData, ErrStat, ErrMsg)
    type(SlD_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
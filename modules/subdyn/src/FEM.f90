@@ -24,6 +24,7 @@ MODULE FEM
 
   INTEGER, PARAMETER  :: FEKi = R8Ki  ! Define the kind to be used for FEM
   INTEGER, PARAMETER  :: LaKi = R8Ki  ! Define the kind to be used for LaPack
+  INTEGER, PARAMETER  :: nDOF_PartialEigen = 200 ! Minimum number of DOFs for which the Craig-Bampton modes are computed with the partial (Lanczos) eigensolver
 
   INTERFACE FINDLOCI ! In the future, use FINDLOC from intrinsic
      MODULE PROCEDURE FINDLOCI_R8Ki
@@ -396,6 +397,7 @@ SUBROUTINE CraigBamptonReduction_FromPartition( MRR, MLL, MRL, KRR, KLL, KRL, nR
    REAL(FEKi) , allocatable :: PhiR_T_MLL(:,:)   ! PhiR_T_MLL(nR,nL) = transpose of PhiR * MLL (temporary storage)
    INTEGER                  :: I        !counter
    INTEGER                  :: ipiv(nL) ! length min(m,n) (See LAPACK documentation)
+   LOGICAL                  :: bKLLFactored ! True if KLL has already been factored for the eigenvalue analysis
    INTEGER(IntKi)           :: ErrStat2
    CHARACTER(ErrMsgLen)     :: ErrMsg2
    CHARACTER(*), PARAMETER  :: RoutineName = 'CraigBamptonReduction_FromPartition'
@@ -412,9 +414,18 @@ SUBROUTINE CraigBamptonReduction_FromPartition( MRR, MLL, MRL, KRR, KLL, KRL, nR
    endif
    
    ! --- Compute CB modes (PhiL) and eigenvalues (OmegaL)
+   bKLLFactored = .false.
    if ( nM_out > 0 ) then 
-      ! bCheckSingularity = True
-      CALL EigenSolveWrap(KLL, MLL, nL, nM_out, .True., PhiL(:,1:nM_out), OmegaL(1:nM_out),  ErrStat2, ErrMsg2); if(Failed()) return
+      if (nL >= nDOF_PartialEigen .and. 4*nM_out < nL) then
+         ! Large system with few modes: only compute the requested modes. 
+         ! KLL is factored here, and the factorization is reused for the Guyan modes below
+         CALL LAPACK_getrf( nL, nL, KLL, ipiv, ErrStat2, ErrMsg2); if(Failed()) return
+         bKLLFactored = .true.
+         CALL EigenSolveLanczos(KLL, ipiv, MLL, nL, nM_out, PhiL(:,1:nM_out), OmegaL(1:nM_out),  ErrStat2, ErrMsg2); if(Failed()) return
+      else
+         ! bCheckSingularity = True
+         CALL EigenSolveWrap(KLL, MLL, nL, nM_out, .True., PhiL(:,1:nM_out), OmegaL(1:nM_out),  ErrStat2, ErrMsg2); if(Failed()) return
+      endif
       ! --- Normalize PhiL
       ! MU = MATMUL ( MATMUL( TRANSPOSE(PhiL), MLL ), PhiL )
       CALL AllocAry( Temp , nM_out, nL     , 'Temp' , ErrStat2 , ErrMsg2); if(Failed()) return
@@ -444,7 +455,9 @@ SUBROUTINE CraigBamptonReduction_FromPartition( MRR, MLL, MRL, KRR, KLL, KRL, nR
       ! --- Compute Guyan Modes (PhiR)
       ! factor KLL to compute PhiR: KLL*PhiR=-TRANSPOSE(KRL)
       ! ** note this must be done after EigenSolveWrap() because it modifies KLL **
-      CALL LAPACK_getrf( nL, nL, KLL, ipiv, ErrStat2, ErrMsg2); if(Failed()) return
+      if (.not. bKLLFactored) then
+         CALL LAPACK_getrf( nL, nL, KLL, ipiv, ErrStat2, ErrMsg2); if(Failed()) return
+      endif
       
       PhiR = -1.0_FEKi * TRANSPOSE(KRL) !set "b" in Ax=b  (solve KLL * PhiR = - TRANSPOSE( KRL ) for PhiR)
       CALL LAPACK_getrs( TRANS='N', N=nL, A=KLL, IPIV=ipiv, B=PhiR, ErrStat=ErrStat2, ErrMsg=ErrMsg2); if(Failed()) return
@@ -608,6 +621,255 @@ CONTAINS
    END SUBROUTINE CleanupEigen
   
 END SUBROUTINE EigenSolveWrap
+
+!------------------------------------------------------------------------------------------------------
+!> Partial eigenvalue analysis: lowest NOmega eigenpairs of K x = Omega^2 M x, for K symmetric positive definite and M symmetric.
+!! A shift-invert block Lanczos iteration with full reorthogonalization is used on the operator K^-1 M, which is symmetric
+!! in the M inner product. The Krylov basis is enlarged until the Ritz pairs of the lowest NOmega modes have converged, 
+!! at most up to the full space. Blocks of LanczosBlock vectors are used so that repeated eigenvalues (e.g. the bending modes
+!! of symmetric structures) are captured.
+!! K is provided as its LU factorization from LAPACK_getrf, so that the caller can reuse it. M is only used for
+!! matrix-vector products, in compressed sparse row storage. The eigenvectors returned are M-orthonormal.
+SUBROUTINE EigenSolveLanczos(KLU, ipiv, M, nDOF, NOmega, EigVect, Omega, ErrStat, ErrMsg)
+   USE NWTC_LAPACK, only: LAPACK_getrs, LAPACK_gemm, LAPACK_syev, LAPACK_GEMV
+   INTEGER,                INTENT(IN   )    :: nDOF                               ! Total degrees of freedom of the system
+   REAL(FEKi),             INTENT(IN   )    :: KLU(nDOF, nDOF)                    ! LU factorization of the stiffness matrix (from LAPACK_getrf)
+   INTEGER,                INTENT(IN   )    :: ipiv(nDOF)                         ! Pivot indices of the LU factorization
+   REAL(FEKi),             INTENT(IN   )    :: M(nDOF, nDOF)                      ! mass matrix 
+   INTEGER,                INTENT(IN   )    :: NOmega                             ! No. of requested eigenvalues
+   REAL(FEKi),             INTENT(  OUT)    :: EigVect(nDOF, NOmega)              ! Returned Eigenvectors
+   REAL(FEKi),             INTENT(  OUT)    :: Omega(NOmega)                      ! Returned Eigenvalues
+   INTEGER(IntKi),         INTENT(  OUT)    :: ErrStat                            ! Error status of the operation
+   CHARACTER(*),           INTENT(  OUT)    :: ErrMsg                             ! Error message if ErrStat /= ErrID_None
+   ! LOCALS
+   INTEGER,    PARAMETER                     :: LanczosBlock = 4                   ! Number of vectors per Lanczos block
+   REAL(FEKi), PARAMETER                     :: RelTol = 1.0e-10_FEKi              ! Relative tolerance on the M-norm of the residuals of the Ritz pairs
+   REAL(FEKi), ALLOCATABLE                   :: Q(:,:), MQ(:,:), AQ(:,:)           ! M-orthonormal basis, M*Q and K^-1*M*Q
+   REAL(FEKi), ALLOCATABLE                   :: W(:,:)                             ! Block of new directions
+   REAL(FEKi), ALLOCATABLE                   :: H(:,:), Theta(:), Work(:)          ! Projected operator, its eigenvalues, and workspace
+   REAL(FEKi), ALLOCATABLE                   :: x(:), r(:), Mr(:), c(:)
+   REAL(FEKi), ALLOCATABLE                   :: MVal(:)                            ! Non-zero values of M (CSR)
+   INTEGER,    ALLOCATABLE                   :: MCol(:), MRow(:)                   ! Column indices and row pointers of M (CSR)
+   INTEGER                                   :: nB                                 ! Block size
+   INTEGER                                   :: nQ                                 ! Number of basis vectors
+   INTEGER                                   :: nA                                 ! Number of basis vectors for which K^-1*M*Q is known
+   INTEGER                                   :: nTarget                            ! Basis size at which the Ritz pairs are checked
+   INTEGER                                   :: nSeed                              ! Counter for the starting vectors
+   INTEGER                                   :: i, j, k, nnz
+   LOGICAL                                   :: bConverged
+   INTEGER(IntKi)                            :: ErrStat2
+   CHARACTER(ErrMsgLen)                      :: ErrMsg2
+   CHARACTER(*), PARAMETER                   :: RoutineName = 'EigenSolveLanczos'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   EigVect = 0.0_FEKi
+   Omega   = 0.0_FEKi
+   if (NOmega <= 0) return
+   if ( NOmega > nDOF ) then
+      CALL SetErrStat(ErrID_Fatal,"NOmega must be less than or equal to N",ErrStat,ErrMsg,RoutineName)
+      return
+   end if
+
+   ! --- Mass matrix in compressed sparse row storage
+   nnz = count(M /= 0.0_FEKi)
+   CALL AllocAry(MVal, nnz   , 'MVal', ErrStat2, ErrMsg2); if(Failed()) return
+   allocate(MCol(nnz), MRow(nDOF+1), stat=ErrStat2)
+   if (ErrStat2 /= 0) then
+      call SetErrStat(ErrID_Fatal, 'Error allocating CSR storage of the mass matrix', ErrStat, ErrMsg, RoutineName); call CleanUp(); return
+   end if
+   k = 0
+   do i = 1, nDOF
+      MRow(i) = k+1
+      do j = 1, nDOF
+         if (M(i,j) /= 0.0_FEKi) then
+            k = k+1
+            MVal(k) = M(i,j)
+            MCol(k) = j
+         endif
+      enddo
+   enddo
+   MRow(nDOF+1) = k+1
+
+   ! --- Basis storage, grown as needed
+   nB      = min(LanczosBlock, nDOF)
+   nTarget = min(nDOF, max(2*NOmega, NOmega+5*nB))
+   CALL AllocAry(Q  , nDOF, nTarget, 'Q' , ErrStat2, ErrMsg2); if(Failed()) return
+   CALL AllocAry(MQ , nDOF, nTarget, 'MQ', ErrStat2, ErrMsg2); if(Failed()) return
+   CALL AllocAry(AQ , nDOF, nTarget, 'AQ', ErrStat2, ErrMsg2); if(Failed()) return
+   CALL AllocAry(W  , nDOF, nB     , 'W' , ErrStat2, ErrMsg2); if(Failed()) return
+   CALL AllocAry(x  , nDOF         , 'x' , ErrStat2, ErrMsg2); if(Failed()) return
+   CALL AllocAry(r  , nDOF         , 'r' , ErrStat2, ErrMsg2); if(Failed()) return
+   CALL AllocAry(Mr , nDOF         , 'Mr', ErrStat2, ErrMsg2); if(Failed()) return
+   CALL AllocAry(c  , nDOF         , 'c' , ErrStat2, ErrMsg2); if(Failed()) return
+
+   ! --- Starting block: K^-1 M applied to deterministic pseudo-random vectors
+   nSeed = 0
+   do j = 1, nB
+      call SeedVector(W(:,j))
+   enddo
+   call ApplyOperator(W); if (ErrStat >= AbortErrLev) return
+   nQ = 0
+   nA = 0
+   call AppendBlock(nB); if (ErrStat >= AbortErrLev) return
+
+   bConverged = .false.
+   do while (.not. bConverged)
+      ! Expand the Krylov basis up to the target size
+      do while (nA < nQ)
+         k = nQ - nA
+         ! New block: W = K^-1 M Q for the last block of the basis (M Q is already known)
+         W(:,1:k) = MQ(:,nA+1:nQ)
+         CALL LAPACK_getrs('N', nDOF, KLU, ipiv, W(:,1:k), ErrStat2, ErrMsg2); if(Failed()) return
+         AQ(:,nA+1:nQ) = W(:,1:k)
+         nA = nQ
+         if (nQ < nTarget .and. nQ < nDOF) then
+            call AppendBlock(min(k, nDOF-nQ)); if (ErrStat >= AbortErrLev) return
+         endif
+      enddo
+
+      ! Rayleigh-Ritz: H = Q^T M (K^-1 M) Q, symmetric
+      if (allocated(H)) deallocate(H)
+      if (allocated(Theta)) deallocate(Theta)
+      if (allocated(Work)) deallocate(Work)
+      CALL AllocAry(H    , nA, nA  , 'H'    , ErrStat2, ErrMsg2); if(Failed()) return
+      CALL AllocAry(Theta, nA      , 'Theta', ErrStat2, ErrMsg2); if(Failed()) return
+      CALL AllocAry(Work , 3*nA    , 'Work' , ErrStat2, ErrMsg2); if(Failed()) return
+      CALL LAPACK_gemm('T', 'N', 1.0_FEKi, MQ(:,1:nA), AQ(:,1:nA), 0.0_FEKi, H, ErrStat2, ErrMsg2); if(Failed()) return
+      H = 0.5_FEKi*(H + transpose(H))
+      CALL LAPACK_syev('V', 'U', nA, H, Theta, Work, size(Work), ErrStat2, ErrMsg2); if(Failed()) return
+
+      ! The largest Theta are the lowest Omega^2 = 1/Theta. Check the residuals of their Ritz pairs
+      if (Theta(nA-NOmega+1) <= 0.0_FEKi) then
+         call SetErrStat(ErrID_Fatal, 'Zero eigenvalue found, system may contain rigid body mode', ErrStat, ErrMsg, RoutineName); call CleanUp(); return
+      endif
+      bConverged = .true.
+      do i = 1, NOmega
+         j = nA - i + 1
+         call LAPACK_GEMV('n', nDOF, nA, 1.0_FEKi, Q , nDOF, H(:,j), 1, 0.0_FEKi, x, 1)
+         call LAPACK_GEMV('n', nDOF, nA, 1.0_FEKi, AQ, nDOF, H(:,j), 1, 0.0_FEKi, r, 1)
+         r = r - Theta(j)*x
+         call MultM(r, Mr)
+         if (sqrt(abs(dot_product(r, Mr))) > RelTol*Theta(j)) bConverged = .false.
+         EigVect(:,i) = x
+         Omega(i)     = sqrt(1.0_FEKi/Theta(j))
+      enddo
+      if (nA >= nDOF) bConverged = .true. ! The basis spans the full space, the Ritz pairs are exact
+      if (.not. bConverged) then
+         ! Enlarge the basis and continue the iterations from the last block
+         nTarget = min(nDOF, nTarget + NOmega + 2*nB)
+         W(:,1:nB) = AQ(:,nA-nB+1:nA)
+         call AppendBlock(min(nB, nDOF-nQ)); if (ErrStat >= AbortErrLev) return
+      endif
+   enddo
+
+   call CleanUp()
+
+CONTAINS
+   LOGICAL FUNCTION Failed()
+        call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName) 
+        Failed =  ErrStat >= AbortErrLev
+        if (Failed) call CleanUp()
+   END FUNCTION Failed
+
+   !> y = M x, using the CSR storage of M
+   SUBROUTINE MultM(xIn, y)
+      REAL(FEKi), INTENT(IN   ) :: xIn(:)
+      REAL(FEKi), INTENT(  OUT) :: y(:)
+      INTEGER :: ii, kk
+      do ii = 1, nDOF
+         y(ii) = 0.0_FEKi
+         do kk = MRow(ii), MRow(ii+1)-1
+            y(ii) = y(ii) + MVal(kk)*xIn(MCol(kk))
+         enddo
+      enddo
+   END SUBROUTINE MultM
+
+   !> V = K^-1 M V
+   SUBROUTINE ApplyOperator(V)
+      REAL(FEKi), INTENT(INOUT) :: V(:,:)
+      INTEGER :: jj
+      do jj = 1, size(V,2)
+         x = V(:,jj)
+         call MultM(x, V(:,jj))
+      enddo
+      CALL LAPACK_getrs('N', nDOF, KLU, ipiv, V, ErrStat2, ErrMsg2); if(Failed()) return
+   END SUBROUTINE ApplyOperator
+
+   !> Deterministic pseudo-random vector, so that the results are reproducible
+   SUBROUTINE SeedVector(v)
+      REAL(FEKi), INTENT(OUT) :: v(:)
+      INTEGER :: ii
+      nSeed = nSeed + 1
+      do ii = 1, size(v)
+         v(ii) = 0.5_FEKi - modulo(ii*0.6180339887498949_FEKi + nSeed*0.7548776662466927_FEKi + (ii*nSeed)*0.5698402909980532_FEKi, 1.0_FEKi)
+      enddo
+   END SUBROUTINE SeedVector
+
+   !> M-orthonormalize the first nNew columns of W against the basis and append them to it.
+   !! Columns that are (numerically) in the span of the basis are replaced by new pseudo-random directions.
+   SUBROUTINE AppendBlock(nNew)
+      INTEGER, INTENT(IN) :: nNew
+      INTEGER    :: jj, iPass, iTry
+      REAL(FEKi) :: nrm0, nrm
+      if (nQ + nNew > size(Q,2)) then
+         call GrowBasis(min(nDOF, max(nQ+nNew, nTarget))); if (ErrStat >= AbortErrLev) return
+      endif
+      do jj = 1, nNew
+         x = W(:,jj)
+         do iTry = 1, 10
+            call MultM(x, Mr)
+            nrm0 = sqrt(abs(dot_product(x, Mr)))
+            do iPass = 1, 2 ! Classical Gram-Schmidt, twice
+               if (nQ > 0) then
+                  call LAPACK_GEMV('t', nDOF, nQ,  1.0_FEKi, MQ, nDOF, x, 1, 0.0_FEKi, c, 1)
+                  call LAPACK_GEMV('n', nDOF, nQ, -1.0_FEKi, Q , nDOF, c, 1, 1.0_FEKi, x, 1)
+               endif
+            enddo
+            call MultM(x, Mr)
+            nrm = sqrt(abs(dot_product(x, Mr)))
+            if (nrm > 1.0e-8_FEKi*nrm0 .and. nrm > 0.0_FEKi) exit
+            call SeedVector(x) ! Deflation: the Krylov space is invariant, restart with a new direction
+         enddo
+         nQ = nQ + 1
+         Q (:,nQ) = x /nrm
+         MQ(:,nQ) = Mr/nrm
+      enddo
+   END SUBROUTINE AppendBlock
+
+   !> Increase the capacity of the basis storage to nCap vectors
+   SUBROUTINE GrowBasis(nCap)
+      INTEGER, INTENT(IN) :: nCap
+      call GrowArray(Q , nCap); if (ErrStat >= AbortErrLev) return
+      call GrowArray(MQ, nCap); if (ErrStat >= AbortErrLev) return
+      call GrowArray(AQ, nCap); if (ErrStat >= AbortErrLev) return
+   END SUBROUTINE GrowBasis
+
+   SUBROUTINE GrowArray(A, nCap)
+      REAL(FEKi), ALLOCATABLE, INTENT(INOUT) :: A(:,:)
+      INTEGER,                 INTENT(IN   ) :: nCap
+      REAL(FEKi), ALLOCATABLE :: Tmp(:,:)
+      CALL AllocAry(Tmp, nDOF, nCap, 'Basis', ErrStat2, ErrMsg2); if(Failed()) return
+      Tmp(:,1:nQ) = A(:,1:nQ)
+      call move_alloc(Tmp, A)
+   END SUBROUTINE GrowArray
+
+   SUBROUTINE CleanUp()
+      if (allocated(Q    )) deallocate(Q    )
+      if (allocated(MQ   )) deallocate(MQ   )
+      if (allocated(AQ   )) deallocate(AQ   )
+      if (allocated(W    )) deallocate(W    )
+      if (allocated(H    )) deallocate(H    )
+      if (allocated(Theta)) deallocate(Theta)
+      if (allocated(Work )) deallocate(Work )
+      if (allocated(x    )) deallocate(x    )
+      if (allocated(r    )) deallocate(r    )
+      if (allocated(Mr   )) deallocate(Mr   )
+      if (allocated(c    )) deallocate(c    )
+      if (allocated(MVal )) deallocate(MVal )
+      if (allocated(MCol )) deallocate(MCol )
+      if (allocated(MRow )) deallocate(MRow )
+   END SUBROUTINE CleanUp
+END SUBROUTINE EigenSolveLanczos
 !------------------------------------------------------------------------------------------------------
 !> Remove degrees of freedom from a matrix (lines and rows)
 SUBROUTINE RemoveDOF(A, bDOF, Ared, ErrStat, ErrMsg )
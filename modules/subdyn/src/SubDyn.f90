@@ -35,6 +35,7 @@ Module SubDyn
    PRIVATE
    
    TYPE(ProgDesc), PARAMETER  :: SD_ProgDesc = ProgDesc( 'SubDyn', '', '' )
+   INTEGER(B4Ki),  PARAMETER  :: CBCacheVer = 1   ! Version of the Craig-Bampton cache file layout (update if the layout or the reduction changes)
       
    ! ..... Public Subroutines ...................................................................................................
    PUBLIC :: SD_Init                           ! Initialization routine
@@ -1696,6 +1697,23 @@ CALL ReadCom( UnIn, SDInputFile, 'SSOutList',ErrStat2, ErrMsg2, UnEc ); if(Faile
 ALLOCATE(Init%SSOutList(MaxOutPts + p%OutAllInt*p%OutAllDims), STAT=ErrStat2)
 If (Check( ErrStat2 /= ErrID_None ,'Error allocating SSOutList arrays')) return
 CALL ReadOutputList ( UnIn, SDInputFile, Init%SSOutList, p%NumOuts, 'SSOutList', 'List of outputs requested', ErrStat2, ErrMsg2, UnEc ); if(Failed()) return
+
+!--------------------- OPTIONAL ADVANCED OPTIONS (after the end of the output list) ---------------------
+Init%CBCacheDir = ''
+DO
+   READ(UnIn, '(A)', IOSTAT=IOS) Line
+   IF (IOS /= 0) EXIT
+   CALL Conv2UC(Line)
+   IF (INDEX(Line, 'CBCACHE') > 1) THEN
+      ! CBCache - Directory in which the Craig-Bampton reduction is cached between runs (quoted string; "" to disable)
+      BACKSPACE(UnIn)
+      CALL ReadVar(UnIn, SDInputFile, Init%CBCacheDir, 'CBCache', 'Craig-Bampton cache directory', ErrStat2, ErrMsg2, UnEc); if(Failed()) return
+      IF (LEN_TRIM(Init%CBCacheDir) > 0) THEN
+         IF (PathIsRelative(Init%CBCacheDir)) Init%CBCacheDir = TRIM(PriPath)//TRIM(Init%CBCacheDir)
+      ENDIF
+      EXIT
+   ENDIF
+ENDDO
 CALL CleanUp()
 
 CONTAINS
@@ -2613,6 +2631,9 @@ SUBROUTINE SD_Craig_Bampton(Init, p, CB, ErrStat, ErrMsg)
    INTEGER(IntKi)           :: nR     !< Dimension of R DOFs (to switch between __R and R__)
    INTEGER(IntKi)           :: nL, nM, nM_out
    INTEGER(IntKi), pointer  :: IDR(:) !< Alias to switch between IDR__ and ID__Rb
+   CHARACTER(1024)          :: CacheFile  !< Name of the Craig-Bampton cache file
+   INTEGER(B8Ki)            :: CacheKey(2)!< Hash of the system being reduced
+   LOGICAL                  :: CacheHit   !< The reduction was read from the cache file
    INTEGER(IntKi)           :: ErrStat2
    CHARACTER(ErrMsgLen)     :: ErrMsg2
    character(*), parameter :: RoutineName = 'SD_Craig_Bampton'
@@ -2663,8 +2684,22 @@ SUBROUTINE SD_Craig_Bampton(Init, p, CB, ErrStat, ErrMsg)
    CALL AllocAry( CB%PhiR,   nL, nR,    'CB%PhiR',   ErrStat2, ErrMsg2 ); CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
    CALL AllocAry( CB%OmegaL, nM_out,    'CB%OmegaL', ErrStat2, ErrMsg2 ); if(Failed()) return
 
-   CALL CraigBamptonReduction(Init%M, Init%K, IDR, nR, p%ID__L, nL, nM, nM_out, CB%MBB, CB%MBM, CB%KBB, CB%PhiL, CB%PhiR, CB%OmegaL, ErrStat2, ErrMsg2) 
-   if(Failed()) return
+   ! Reuse the reduction of an identical system from a previous run if it is in the cache
+   CacheHit = .false.
+   if (len_trim(Init%CBCacheDir) > 0) then
+      call CBCache_FileName(Init, IDR, nR, p%ID__L, nL, nM, nM_out, CacheFile, CacheKey)
+      call CBCache_Read(CacheFile, CacheKey, nR, nL, nM, nM_out, CB, CacheHit)
+      if (CacheHit) call WrScr('   Read Craig-Bampton reduction from cache file '//trim(CacheFile))
+   endif
+
+   if (.not. CacheHit) then
+      CALL CraigBamptonReduction(Init%M, Init%K, IDR, nR, p%ID__L, nL, nM, nM_out, CB%MBB, CB%MBM, CB%KBB, CB%PhiL, CB%PhiR, CB%OmegaL, ErrStat2, ErrMsg2) 
+      if(Failed()) return
+      if (len_trim(Init%CBCacheDir) > 0) then
+         call CBCache_Write(CacheFile, CacheKey, CB, ErrStat2, ErrMsg2)
+         CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+      endif
+   endif
 
    CALL AllocAry(PhiRb,  nL, nR, 'PhiRb',   ErrStat2, ErrMsg2 ); CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
    if(.not.BC_Before_CB) then
@@ -2735,6 +2770,151 @@ contains
 
 END SUBROUTINE SD_Craig_Bampton 
 
+!------------------------------------------------------------------------------------------------------
+!> Build the name of the Craig-Bampton cache file. The name contains a 64-bit key hashed from everything the reduction
+!! depends on: the assembled mass and stiffness matrices (which cover the members, properties, joints, concentrated masses
+!! and soil), the partition of the DOFs, and the number of modes. The key is also stored in the file header so that a
+!! stale or mismatched file is never used.
+SUBROUTINE CBCache_FileName(Init, IDR, nR, IDL, nL, nM, nM_out, FileName, Key)
+   TYPE(SD_InitType), INTENT(IN   ) :: Init        !< Initialization data, with the assembled system matrices
+   INTEGER(IntKi),    INTENT(IN   ) :: IDR(:)      !< Indices of the boundary DOFs
+   INTEGER(IntKi),    INTENT(IN   ) :: nR          !< Number of boundary DOFs
+   INTEGER(IntKi),    INTENT(IN   ) :: IDL(:)      !< Indices of the internal DOFs
+   INTEGER(IntKi),    INTENT(IN   ) :: nL          !< Number of internal DOFs
+   INTEGER(IntKi),    INTENT(IN   ) :: nM          !< Number of CB modes
+   INTEGER(IntKi),    INTENT(IN   ) :: nM_out      !< Number of CB modes returned
+   CHARACTER(*),      INTENT(  OUT) :: FileName    !< Name of the cache file
+   INTEGER(B8Ki),     INTENT(  OUT) :: Key(2)      !< Two independent 32-bit hashes of the inputs
+   CHARACTER(16) :: KeyStr
+
+   ! FNV-1a offset bases
+   Key(1) = 2166136261_B8Ki
+   Key(2) = 3735928559_B8Ki
+
+   call CBCache_Hash(Key, [CBCacheVer, MERGE(1_B4Ki, 0_B4Ki, BC_Before_CB)])
+   call CBCache_Hash(Key, INT([nR, nL, nM, nM_out, size(Init%M,1), size(Init%M,2)], B4Ki))
+   call CBCache_Hash(Key, INT(IDR(1:nR), B4Ki))
+   call CBCache_Hash(Key, INT(IDL(1:nL), B4Ki))
+   call CBCache_Hash(Key, TRANSFER(Init%M, [0_B4Ki]))
+   call CBCache_Hash(Key, TRANSFER(Init%K, [0_B4Ki]))
+
+   WRITE(KeyStr, '(Z8.8,Z8.8)') Key(1), Key(2)
+   FileName = TRIM(Init%CBCacheDir)
+   IF (FileName(LEN_TRIM(FileName):LEN_TRIM(FileName)) /= PathSep) FileName = TRIM(FileName)//PathSep
+   FileName = TRIM(FileName)//'CB_'//KeyStr//'.bin'
+END SUBROUTINE CBCache_FileName
+
+!> Add an array of 32-bit words to a pair of 32-bit hashes (FNV-1a and a multiplicative hash), held in 64-bit
+!! integers so that no intermediate product overflows.
+SUBROUTINE CBCache_Hash(Key, Words)
+   INTEGER(B8Ki), INTENT(INOUT) :: Key(2)   !< Two independent 32-bit hashes
+   INTEGER(B4Ki), INTENT(IN   ) :: Words(:) !< Data to add to the hashes
+   INTEGER(B8Ki), PARAMETER :: Mask32 = 4294967295_B8Ki
+   INTEGER(B8Ki)  :: W
+   INTEGER(IntKi) :: I
+   DO I = 1, SIZE(Words)
+      W      = IAND(INT(Words(I), B8Ki), Mask32)
+      Key(1) = IAND(IEOR(Key(1), W) * 16777619_B8Ki, Mask32)
+      Key(2) = IAND(IAND(Key(2) + W, Mask32) * 1099087573_B8Ki, Mask32)
+      Key(2) = IEOR(Key(2), ISHFT(Key(2), -15))
+   ENDDO
+END SUBROUTINE CBCache_Hash
+
+!> Read the Craig-Bampton matrices from the cache file, if it exists and its header and dimensions match.
+!! Any problem reading the file is treated as a cache miss, in which case CB is left untouched.
+SUBROUTINE CBCache_Read(FileName, Key, nR, nL, nM, nM_out, CB, Found)
+   CHARACTER(*),       INTENT(IN   ) :: FileName  !< Name of the cache file
+   INTEGER(B8Ki),      INTENT(IN   ) :: Key(2)    !< Expected key
+   INTEGER(IntKi),     INTENT(IN   ) :: nR, nL, nM, nM_out !< Expected dimensions
+   TYPE(CB_MatArrays), INTENT(INOUT) :: CB        !< CB matrices
+   LOGICAL,            INTENT(  OUT) :: Found     !< The matrices were read from the cache file
+   TYPE(CB_MatArrays)   :: CBc
+   TYPE(RegFile)        :: RF
+   INTEGER(IntKi)       :: Un, IOS
+   INTEGER(B4Ki)        :: FileVer
+   INTEGER(B8Ki)        :: FileKey(2)
+   INTEGER(IntKi)       :: ErrStat2
+   CHARACTER(ErrMsgLen) :: ErrMsg2
+   INTEGER(B8Ki)        :: FileSize, DataSize
+   LOGICAL              :: Exists
+
+   Found = .false.
+   INQUIRE(FILE=TRIM(FileName), EXIST=Exists, SIZE=FileSize)
+   IF (.not. Exists) RETURN
+
+   ! The registry unpacking aborts on a premature end of file, so reject files too short to hold the matrices
+   DataSize = (STORAGE_SIZE(1.0_R8Ki)/8) * (2_B8Ki*nR*nR + INT(nR,B8Ki)*nM + INT(nL,B8Ki)*(nM_out + nR) + nM_out)
+   IF (FileSize < DataSize) RETURN
+
+   CALL GetNewUnit(Un, ErrStat2, ErrMsg2)
+   OPEN(Un, FILE=TRIM(FileName), STATUS='OLD', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='READ', IOSTAT=IOS)
+   IF (IOS /= 0) RETURN
+
+   READ(Un, IOSTAT=IOS) FileVer, FileKey
+   IF (IOS == 0 .and. FileVer == CBCacheVer .and. ALL(FileKey == Key)) THEN
+      call OpenRegFile(RF, Un, ErrStat2, ErrMsg2)
+      IF (ErrStat2 == ErrID_None .and. RF%NumPointers >= 0) THEN
+         call SD_UnPackCB_MatArrays(RF, CBc)
+         IF (RF%ErrStat == ErrID_None) THEN
+            Found = Dims2Match(CBc%MBB,  nR, nR) .and. Dims2Match(CBc%MBM,  nR, nM) .and. Dims2Match(CBc%KBB,  nR, nR) .and. &
+                    Dims2Match(CBc%PhiL, nL, nM_out) .and. Dims2Match(CBc%PhiR, nL, nR)
+            IF (Found) Found = allocated(CBc%OmegaL)
+            IF (Found) Found = size(CBc%OmegaL) == nM_out
+         ENDIF
+      ENDIF
+   ENDIF
+   CLOSE(Un)
+
+   IF (Found) THEN
+      call SD_CopyCB_MatArrays(CBc, CB, MESH_NEWCOPY, ErrStat2, ErrMsg2)
+      Found = ErrStat2 == ErrID_None
+   ENDIF
+   call SD_DestroyCB_MatArrays(CBc, ErrStat2, ErrMsg2)
+CONTAINS
+   LOGICAL FUNCTION Dims2Match(A, n1, n2)
+      REAL(FEKi), ALLOCATABLE, INTENT(IN) :: A(:,:)
+      INTEGER(IntKi),          INTENT(IN) :: n1, n2
+      Dims2Match = allocated(A)
+      IF (Dims2Match) Dims2Match = size(A,1) == n1 .and. size(A,2) == n2
+   END FUNCTION Dims2Match
+END SUBROUTINE CBCache_Read
+
+!> Write the Craig-Bampton matrices to the cache file. Failure to write the file only results in a warning.
+SUBROUTINE CBCache_Write(FileName, Key, CB, ErrStat, ErrMsg)
+   CHARACTER(*),       INTENT(IN   ) :: FileName  !< Name of the cache file
+   INTEGER(B8Ki),      INTENT(IN   ) :: Key(2)    !< Key of the system being reduced
+   TYPE(CB_MatArrays), INTENT(IN   ) :: CB        !< CB matrices
+   INTEGER(IntKi),     INTENT(  OUT) :: ErrStat   !< Error status of the operation
+   CHARACTER(*),       INTENT(  OUT) :: ErrMsg    !< Error message if ErrStat /= ErrID_None
+   TYPE(RegFile)        :: RF
+   INTEGER(IntKi)       :: Un, IOS
+   INTEGER(IntKi)       :: ErrStat2
+   CHARACTER(ErrMsgLen) :: ErrMsg2
+   ErrStat = ErrID_None
+   ErrMsg  = ""
+
+   CALL GetNewUnit(Un, ErrStat2, ErrMsg2)
+   OPEN(Un, FILE=TRIM(FileName), STATUS='REPLACE', FORM='UNFORMATTED', ACCESS='STREAM', ACTION='WRITE', IOSTAT=IOS)
+   IF (IOS /= 0) THEN
+      call SetErrStat(ErrID_Warn, 'Unable to open Craig-Bampton cache file "'//TRIM(FileName)//'" for writing.', ErrStat, ErrMsg, 'CBCache_Write')
+      RETURN
+   ENDIF
+
+   WRITE(Un, IOSTAT=IOS) CBCacheVer, Key
+   IF (IOS == 0) THEN
+      call InitRegFile(RF, Un, ErrStat2, ErrMsg2)
+      IF (ErrStat2 == ErrID_None) THEN
+         call SD_PackCB_MatArrays(RF, CB)
+         call CloseRegFile(RF, ErrStat2, ErrMsg2) ! closes the unit on success
+         IF (ErrStat2 == ErrID_None) RETURN
+      ENDIF
+   ENDIF
+
+   ! Remove the incomplete file so that it is not read by a later run
+   CLOSE(Un, STATUS='DELETE', IOSTAT=IOS)
+   call SetErrStat(ErrID_Warn, 'Unable to write Craig-Bampton cache file "'//TRIM(FileName)//'".', ErrStat, ErrMsg, 'CBCache_Write')
+END SUBROUTINE CBCache_Write
+
 !> Extract rigid body mass without SSI
 !! NOTE: performs a Guyan reduction
 SUBROUTINE SD_Guyan_RigidBodyMass(Init, p, MBB, ErrStat, ErrMsg)
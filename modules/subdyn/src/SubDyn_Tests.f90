@@ -427,6 +427,61 @@ contains
       call test_almost_equal('Inverse of 6x3 matrix', real(Aref,ReKi), real(Ainv,ReKi), 1e-6_ReKi, .true., .true.)
    end subroutine  Test_Linalg
 
+   !> Partial (Lanczos) eigensolver compared to the dense eigensolver
+   subroutine Test_PartialEigen(ErrStat,ErrMsg)
+      use NWTC_LAPACK, only: LAPACK_getrf
+      integer(IntKi)      , intent(out) :: ErrStat
+      character(ErrMsgLen), intent(out) :: ErrMsg
+      integer, parameter :: nChain = 150  ! Masses per chain
+      integer, parameter :: nDOF   = 2*nChain
+      integer, parameter :: nOmega = 10
+      real(FEKi), dimension(:,:), allocatable :: K, M, KLU, PhiRef, Phi
+      real(FEKi) :: OmegaRef(nOmega), Omega(nOmega), Res(nOmega)
+      integer    :: ipiv(nDOF)
+      integer    :: i, iOff
+      testname='PartialEigen'
+
+      ! --- Two identical fixed-free spring-mass chains, so that all eigenvalues are double
+      allocate(K(nDOF,nDOF), M(nDOF,nDOF), KLU(nDOF,nDOF), PhiRef(nDOF,nOmega), Phi(nDOF,nOmega))
+      K = 0.0_FEKi
+      M = 0.0_FEKi
+      do iOff = 0, nChain, nChain
+         do i = 1, nChain
+            M(iOff+i,iOff+i) = 1.0_FEKi + 0.5_FEKi*i/nChain
+            K(iOff+i,iOff+i) = 2.0e4_FEKi
+            if (i>1) then
+               K(iOff+i,iOff+i-1) = -1.0e4_FEKi
+               K(iOff+i-1,iOff+i) = -1.0e4_FEKi
+            endif
+         enddo
+         K(iOff+nChain,iOff+nChain) = 1.0e4_FEKi
+      enddo
+
+      call EigenSolveWrap(K, M, nDOF, nOmega, .True., PhiRef, OmegaRef, ErrStat, ErrMsg); if (ErrStat>=AbortErrLev) return
+      KLU = K
+      call LAPACK_getrf(nDOF, nDOF, KLU, ipiv, ErrStat, ErrMsg); if (ErrStat>=AbortErrLev) return
+      call EigenSolveLanczos(KLU, ipiv, M, nDOF, nOmega, Phi, Omega, ErrStat, ErrMsg); if (ErrStat>=AbortErrLev) return
+
+      call test_almost_equal('Lowest frequencies', OmegaRef/OmegaRef(nOmega), Omega/OmegaRef(nOmega), 1e-8_R8Ki, .true., .true.)
+      ! Residuals and M-orthonormality of the modes (the modes of a double eigenvalue are not unique)
+      do i = 1, nOmega
+         Res(i) = maxval(abs(matmul(K,Phi(:,i)) - Omega(i)**2*matmul(M,Phi(:,i)))) / OmegaRef(nOmega)**2
+      enddo
+      call test_almost_equal('Mode residuals', 0.0_R8Ki*Res, Res, 1e-8_R8Ki, .true., .true.)
+      call test_almost_equal('Mode orthonormality', real(matmul(transpose(Phi),matmul(M,Phi)),ReKi), real(Eye(nOmega),ReKi), 1e-8_ReKi, .true., .true.)
+      deallocate(K, M, KLU, PhiRef, Phi)
+   contains
+      function Eye(n)
+         integer, intent(in) :: n
+         real(FEKi) :: Eye(n,n)
+         integer :: ii
+         Eye = 0.0_FEKi
+         do ii = 1, n
+            Eye(ii,ii) = 1.0_FEKi
+         enddo
+      end function Eye
+   end subroutine Test_PartialEigen
+
    !> Series of tests for integer lists
    subroutine Test_lists(ErrStat,ErrMsg)
       integer(IntKi)      , intent(out) :: ErrStat
@@ -539,6 +594,7 @@ contains
       call Test_lists(ErrStat2, ErrMsg2); if(Failed()) return
       call Test_Transformations(ErrStat2, ErrMsg2); if(Failed()) return
       call Test_Linalg(ErrStat2, ErrMsg2); if(Failed()) return
+      call Test_PartialEigen(ErrStat2, ErrMsg2); if(Failed()) return
       call Test_ChessBoard(ErrStat2, ErrMsg2); if(Failed()) return
       contains
          logical function Failed()
@@ -197,6 +197,7 @@ IMPLICIT NONE
     INTEGER(IntKi) , DIMENSION(:,:), ALLOCATABLE  :: NodesConnE      !< Elements that connect to a common node [-]
     LOGICAL  :: SSSum = .false.      !< SubDyn Summary File Flag               [-]
     REAL(R8Ki) , DIMENSION(1:6)  :: qR0 = 0.0_R8Ki      !< Initial rigid-body displacement (floating only) [-]
+    CHARACTER(1024)  :: CBCacheDir      !< Directory in which the Craig-Bampton reduction is cached between runs (empty to disable caching) [-]
   END TYPE SD_InitType
 ! =======================
 ! =========  SD_ContinuousStateType  =======
@@ -1603,6 +1604,7 @@ subroutine SD_CopyInitType(SrcInitTypeData, DstInitTypeData, CtrlCode, ErrStat,
    end if
    DstInitTypeData%SSSum = SrcInitTypeData%SSSum
    DstInitTypeData%qR0 = SrcInitTypeData%qR0
+   DstInitTypeData%CBCacheDir = SrcInitTypeData%CBCacheDir
 end subroutine
 
 subroutine SD_DestroyInitType(InitTypeData, ErrStat, ErrMsg)
@@ -1783,6 +1785,7 @@ subroutine SD_PackInitType(RF, Indata)
    call RegPackAlloc(RF, InData%NodesConnE)
    call RegPack(RF, InData%SSSum)
    call RegPack(RF, InData%qR0)
+   call RegPack(RF, InData%CBCacheDir)
    if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
@@ -1859,6 +1862,7 @@ subroutine SD_UnPackInitType(RF, OutData)
    call RegUnpackAlloc(RF, OutData%NodesConnE); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%SSSum); if (RegCheckErr(RF, RoutineName)) return
    call RegUnpack(RF, OutData%qR0); if (RegCheckErr(RF, RoutineName)) return
+   call RegUnpack(RF, OutData%CBCacheDir); if (RegCheckErr(RF, RoutineName)) return
 end subroutine
 
 subroutine SD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrStat, ErrMsg)
@@ -1922,6 +1926,32 @@ subroutine SD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSta
    end if
 end subroutine
 
+subroutine SD_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(SD_ContinuousStateType), intent(inout) :: ContStateData1
+   type(SD_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(R8Ki), allocatable :: tmp_qm(:)
+   REAL(R8Ki), allocatable :: tmp_qmdot(:)
+   REAL(R8Ki), allocatable :: tmp_qR(:)
+   REAL(R8Ki), allocatable :: tmp_qRdot(:)
+   character(*), parameter        :: RoutineName = 'SD_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   call move_alloc(ContStateData1%qm, tmp_qm)
+   call move_alloc(ContStateData2%qm, ContStateData1%qm)
+   call move_alloc(tmp_qm, ContStateData2%qm)
+   call move_alloc(ContStateData1%qmdot, tmp_qmdot)
+   call move_alloc(ContStateData2%qmdot, ContStateData1%qmdot)
+   call move_alloc(tmp_qmdot, ContStateData2%qmdot)
+   call move_alloc(ContStateData1%qR, tmp_qR)
+   call move_alloc(ContStateData2%qR, ContStateData1%qR)
+   call move_alloc(tmp_qR, ContStateData2%qR)
+   call move_alloc(ContStateData1%qRdot, tmp_qRdot)
+   call move_alloc(ContStateData2%qRdot, ContStateData1%qRdot)
+   call move_alloc(tmp_qRdot, ContStateData2%qRdot)
+end subroutine
+
 subroutine SD_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(SD_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1981,6 +2011,20 @@ subroutine SD_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSta
    DstDiscStateData%DummyDiscState = SrcDiscStateData%DummyDiscState
 end subroutine
 
+subroutine SD_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(SD_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(SD_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyDiscState
+   character(*), parameter        :: RoutineName = 'SD_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyDiscState = DiscStateData1%DummyDiscState
+   DiscStateData1%DummyDiscState = DiscStateData2%DummyDiscState
+   DiscStateData2%DummyDiscState = tmp_DummyDiscState
+end subroutine
+
 subroutine SD_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(SD_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2019,6 +2063,20 @@ subroutine SD_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine SD_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(SD_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(SD_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'SD_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine SD_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(SD_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -2077,6 +2135,41 @@ subroutine SD_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Err
    DstOtherStateData%n = SrcOtherStateData%n
 end subroutine
 
+subroutine SD_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(SD_OtherStateType), intent(inout) :: OtherStateData1
+   type(SD_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   INTEGER(IntKi) :: tmp_n
+   character(*), parameter        :: RoutineName = 'SD_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(OtherStateData1%xdot) .neqv. allocated(OtherStateData2%xdot)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%xdot with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(OtherStateData1%xdot)) then
+      if (any(lbound(OtherStateData1%xdot) /= lbound(OtherStateData2%xdot)) .or. any(ubound(OtherStateData1%xdot) /= ubound(OtherStateData2%xdot))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap OtherStateData1%xdot with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(OtherStateData1%xdot)
+      UB(1:1) = ubound(OtherStateData1%xdot)
+      do i1 = LB(1), UB(1)
+         call SD_SwapContState(OtherStateData1%xdot(i1), OtherStateData2%xdot(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   tmp_n = OtherStateData1%n
+   OtherStateData1%n = OtherStateData2%n
+   OtherStateData2%n = tmp_n
+end subroutine
+
 subroutine SD_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(SD_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -3849,6 +3942,44 @@ subroutine SD_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine SD_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(SD_InputType), intent(inout) :: InputData1
+   type(SD_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   integer(B4Ki)   :: i1
+   integer(B4Ki)                  :: LB(1), UB(1)
+   integer(IntKi)                 :: ErrStat2
+   character(ErrMsgLen)           :: ErrMsg2
+   REAL(ReKi), allocatable :: tmp_CableDeltaL(:)
+   character(*), parameter        :: RoutineName = 'SD_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   if (allocated(InputData1%TPMesh) .neqv. allocated(InputData2%TPMesh)) then
+      call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%TPMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+      return
+   end if
+   if (allocated(InputData1%TPMesh)) then
+      if (any(lbound(InputData1%TPMesh) /= lbound(InputData2%TPMesh)) .or. any(ubound(InputData1%TPMesh) /= ubound(InputData2%TPMesh))) then
+         call SetErrStat(ErrID_Fatal, 'Cannot swap InputData1%TPMesh with an array of different size.', ErrStat, ErrMsg, RoutineName)
+         return
+      end if
+      LB(1:1) = lbound(InputData1%TPMesh)
+      UB(1:1) = ubound(InputData1%TPMesh)
+      do i1 = LB(1), UB(1)
+         call MeshSwap(InputData1%TPMesh(i1), InputData2%TPMesh(i1), ErrStat2, ErrMsg2)
+         call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+         if (ErrStat >= AbortErrLev) return
+      end do
+   end if
+   call MeshSwap(InputData1%LMesh, InputData2%LMesh, ErrStat2, ErrMsg2)
+   call SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, RoutineName)
+   if (ErrStat >= AbortErrLev) return
+   call move_alloc(InputData1%CableDeltaL, tmp_CableDeltaL)
+   call move_alloc(InputData2%CableDeltaL, InputData1%CableDeltaL)
+   call move_alloc(tmp_CableDeltaL, InputData2%CableDeltaL)
+end subroutine
+
 subroutine SD_DestroyInput(InputData, ErrStat, ErrMsg)
    type(SD_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -175,20 +175,27 @@ END SUBROUTINE CalcFourierCoeffs_IEC
 !! real array) of the simulated velocity (wind/water speed). It returns
 !! values FOR ONLY the velocity components that use the general method for
 !! computing spatial coherence; i.e., for i where SCMod(i) == CohMod_GENERAL
-SUBROUTINE CalcFourierCoeffs_General( p, U, PhaseAngles, S, V, TRH, ErrStat, ErrMsg )
+!!
+!! OpenMP:  This makes a copy of the TRH array for each thread to use, which
+!!          is a little inefficient, but the speedup from parallelization
+!!          should outweigh the memory overhead. In the single threaded case,
+!!          a single copy is made, which is relatively negligible.
+SUBROUTINE CalcFourierCoeffs_General( p, U, PhaseAngles, S, V, TRH_in, ErrStat, ErrMsg )
 
 TYPE(TurbSim_ParameterType), INTENT(IN   )  :: p                            !< TurbSim parameters
 REAL(ReKi),                  INTENT(IN)     :: U           (:)              !< The steady u-component wind speeds for the grid (NPoints).
 REAL(ReKi),                  INTENT(IN)     :: PhaseAngles (:,:,:)          !< The array that holds the random phases [number of points, number of frequencies, number of wind components=3].
 REAL(ReKi),                  INTENT(IN)     :: S           (:,:,:)          !< The turbulence PSD array (NumFreq,NPoints,3).
 REAL(ReKi),                  INTENT(INOUT)  :: V           (:,:,:)          !< An array containing the summations of the rows of H (NumSteps,NPoints,3).
-REAL(ReKi),                  INTENT(INOUT)  :: TRH (:)                      !< The transfer function matrix.  just used as a work array
+REAL(ReKi),                  INTENT(INOUT)  :: TRH_in (:)                   !< The transfer function matrix.  just used as a work array
 INTEGER(IntKi),              INTENT(OUT)    :: ErrStat
 CHARACTER(*),                INTENT(OUT)    :: ErrMsg
 
    
    ! Internal variables
 
+REAL(ReKi), allocatable, save :: TRH(:)         ! Each OMP thread gets its own copy of this array
+!$OMP THREADPRIVATE(TRH)
 INTEGER                      :: UC              ! I/O unit for Coherence debugging file.
 LOGICAL,    PARAMETER        :: COH_OUT = .FALSE.                       ! This parameter has been added to replace the NON-STANDARD compiler directive previously used
 
@@ -228,6 +235,8 @@ CHARACTER(MaxMsgLen)          :: ErrMsg2
       RETURN
    END IF
    
+   TRH = TRH_in  ! point the PRIVATE array to the passed in array for single thread case
+   
       
    !--------------------------------------------------------------------------------
    ! Calculate the distances and other parameters that don't change with frequency
@@ -325,8 +334,14 @@ ENDIF
 
       !--------------------------------------------------------------------------------
       ! Calculate the coherence, Veers' H matrix (CSDs), and the fourier coefficients
+      ! (the debugging output is written in frequency order, so it disables the threading)
       !---------------------------------------------------------------------------------
 
+      !$OMP PARALLEL DO IF(.NOT. COH_OUT) &
+      !$OMP DEFAULT(None) &
+      !$OMP SHARED(p, PhaseAngles, S, V, Dist, DistU, DistZMExp, IVec, UC, ErrStat, ErrMsg, AbortErrLev) &
+      !$OMP PRIVATE(Indx, I, J, ErrStat2, ErrMsg2) &
+      !$OMP COPYIN(TRH)
       DO IFREQ = 1,p%grid%NumFreq
          ! -----------------------------------------------
          ! Create the coherence matrix for this frequency
@@ -370,14 +385,19 @@ ENDIF
          ! -----------------------------------------------
          
          CALL Coh2H(    p, IVec, IFreq, TRH, S, ErrStat2, ErrMsg2 )       
+         if (ErrStat2 /= ErrID_None) then
+            !$OMP CRITICAL 
             CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'CalcFourierCoeffs_General')
-            IF (ErrStat >= AbortErrLev) THEN
-               CALL Cleanup()
-               RETURN
-            END IF
-         CALL H2Coeffs( IVec, IFreq, TRH, PhaseAngles, V, p%grid%NPoints )
+            !$OMP END CRITICAL
+         endif
+         if (ErrStat2 < AbortErrLev) CALL H2Coeffs( IVec, IFreq, TRH, PhaseAngles, V, p%grid%NPoints )
       END DO !IFreq
 
+      IF (ErrStat >= AbortErrLev) THEN
+         CALL Cleanup()
+         RETURN
+      END IF
+
    END DO !IVec   
    
    CALL Cleanup()
@@ -510,7 +530,12 @@ END SUBROUTINE CalcFourierCoeffs
 !! real array) of the simulated velocity (wind/water speed). It returns
 !! values FOR ONLY the velocity components that use the API method for
 !! computing spatial coherence; i.e., for i where SCMod(i) == CohMod_API
-SUBROUTINE CalcFourierCoeffs_API( p, U, PhaseAngles, S, V, TRH, ErrStat, ErrMsg )
+!!
+!! OpenMP:  This makes a copy of the TRH array for each thread to use, which
+!!          is a little inefficient, but the speedup from parallelization
+!!          should outweigh the memory overhead. In the single threaded case,
+!!          a single copy is made, which is relatively negligible.
+SUBROUTINE CalcFourierCoeffs_API( p, U, PhaseAngles, S, V, TRH_in, ErrStat, ErrMsg )
 
 IMPLICIT                      NONE
 
@@ -520,12 +545,14 @@ REAL(ReKi),                  INTENT(IN   )  :: U           (:)              !< T
 REAL(ReKi),                  INTENT(IN   )  :: PhaseAngles (:,:,:)          !< The array that holds the phase angles [number of points, number of frequencies, number of wind components=3].
 REAL(ReKi),                  INTENT(IN   )  :: S           (:,:,:)          !< The turbulence PSD array (NumFreq,NPoints,3).
 REAL(ReKi),                  INTENT(INOUT)  :: V           (:,:,:)          !< An array containing the summations of the rows of H (NumSteps,NPoints,3).
-REAL(ReKi),                  INTENT(INOUT)  :: TRH (:)                      !< The transfer function matrix.  just used as a work array
+REAL(ReKi),                  INTENT(INOUT)  :: TRH_in (:)                   !< The transfer function matrix.  just used as a work array
 INTEGER(IntKi),              INTENT(  OUT)  :: ErrStat
 CHARACTER(*),                INTENT(  OUT)  :: ErrMsg
 
    ! Internal variables
 
+REAL(ReKi), allocatable, save :: TRH(:)         ! Each OMP thread gets its own copy of this array
+!$OMP THREADPRIVATE(TRH)
 REAL(ReKi), ALLOCATABLE      :: Dist_Y(:)        ! The Y distance between points
 REAL(ReKi), ALLOCATABLE      :: Dist_Z(:)        ! The Z distance between points
 REAL(ReKi), ALLOCATABLE      :: z_g(:)           ! sqrt( Z(IZ)*Z(JZ) ) / H
@@ -574,6 +601,8 @@ REAL :: A_Y, A_Z
       RETURN
    END IF
 
+   TRH = TRH_in  ! point the PRIVATE array to the passed in array for single thread case
+
 
    !--------------------------------------------------------------------------------
    ! Calculate the distances and other parameters that don't change with frequency
@@ -625,8 +654,14 @@ ENDIF
       
    !--------------------------------------------------------------------------------
    ! Calculate the coherence, Veers' H matrix (CSDs), and the fourier coefficients
+   ! (the debugging output is written in frequency order, so it disables the threading)
    !---------------------------------------------------------------------------------
       
+      !$OMP PARALLEL DO IF(.NOT. COH_OUT) &
+      !$OMP DEFAULT(None) &
+      !$OMP SHARED(p, PhaseAngles, S, V, Dist_Y, Dist_Z, z_g, IVec, UC, ErrStat, ErrMsg, AbortErrLev) &
+      !$OMP PRIVATE(Indx, I, J, A_Y, A_Z, ErrStat2, ErrMsg2) &
+      !$OMP COPYIN(TRH)
       DO IFREQ = 1,p%grid%NumFreq
          ! -----------------------------------------------
          ! Create the coherence matrix for this frequency
@@ -674,15 +709,19 @@ ENDIF
          ! -----------------------------------------------
       
          CALL Coh2H(    p, IVec, IFreq, TRH, S, ErrStat2, ErrMsg2 )
+         if (ErrStat2 /= ErrID_None) then
+            !$OMP CRITICAL 
             CALL SetErrStat(ErrStat2, ErrMsg2, ErrStat, ErrMsg, 'CalcFourierCoeffs_API')
-            IF (ErrStat >= AbortErrLev) THEN
-               CALL Cleanup()
-               RETURN
-            END IF
-      
-         CALL H2Coeffs( IVec, IFreq, TRH, PhaseAngles, V, p%grid%NPoints )
+            !$OMP END CRITICAL
+         endif
+         if (ErrStat2 < AbortErrLev) CALL H2Coeffs( IVec, IFreq, TRH, PhaseAngles, V, p%grid%NPoints )
       
       ENDDO !IFreq
+
+      IF (ErrStat >= AbortErrLev) THEN
+         CALL Cleanup()
+         RETURN
+      END IF
    ENDDO !IVec
 
    CALL Cleanup()
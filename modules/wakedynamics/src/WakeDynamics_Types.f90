@@ -591,6 +591,20 @@ subroutine WD_CopyContState(SrcContStateData, DstContStateData, CtrlCode, ErrSta
    DstContStateData%DummyContState = SrcContStateData%DummyContState
 end subroutine
 
+subroutine WD_SwapContState(ContStateData1, ContStateData2, ErrStat, ErrMsg)
+   type(WD_ContinuousStateType), intent(inout) :: ContStateData1
+   type(WD_ContinuousStateType), intent(inout) :: ContStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyContState
+   character(*), parameter        :: RoutineName = 'WD_SwapContState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyContState = ContStateData1%DummyContState
+   ContStateData1%DummyContState = ContStateData2%DummyContState
+   ContStateData2%DummyContState = tmp_DummyContState
+end subroutine
+
 subroutine WD_DestroyContState(ContStateData, ErrStat, ErrMsg)
    type(WD_ContinuousStateType), intent(inout) :: ContStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -814,6 +828,92 @@ subroutine WD_CopyDiscState(SrcDiscStateData, DstDiscStateData, CtrlCode, ErrSta
    end if
 end subroutine
 
+subroutine WD_SwapDiscState(DiscStateData1, DiscStateData2, ErrStat, ErrMsg)
+   type(WD_DiscreteStateType), intent(inout) :: DiscStateData1
+   type(WD_DiscreteStateType), intent(inout) :: DiscStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_NumPlanes
+   REAL(ReKi), allocatable :: tmp_xhat_plane(:,:)
+   REAL(ReKi), allocatable :: tmp_YawErr_filt(:)
+   REAL(ReKi) :: tmp_psi_skew_filt
+   REAL(ReKi) :: tmp_chi_skew_filt
+   REAL(ReKi), allocatable :: tmp_V_plane_filt(:,:)
+   REAL(ReKi), allocatable :: tmp_p_plane(:,:)
+   REAL(ReKi), allocatable :: tmp_x_plane(:)
+   REAL(ReKi), allocatable :: tmp_Vx_wake(:,:)
+   REAL(ReKi), allocatable :: tmp_Vr_wake(:,:)
+   REAL(ReKi), allocatable :: tmp_Vx_wake2(:,:,:)
+   REAL(ReKi), allocatable :: tmp_Vy_wake2(:,:,:)
+   REAL(ReKi), allocatable :: tmp_Vz_wake2(:,:,:)
+   REAL(ReKi), allocatable :: tmp_Vx_wind_disk_filt(:)
+   REAL(ReKi), allocatable :: tmp_TI_amb_filt(:)
+   REAL(ReKi), allocatable :: tmp_D_rotor_filt(:)
+   REAL(ReKi) :: tmp_Vx_rel_disk_filt
+   REAL(ReKi), allocatable :: tmp_Ct_azavg_filt(:)
+   REAL(ReKi), allocatable :: tmp_Cq_azavg_filt(:)
+   character(*), parameter        :: RoutineName = 'WD_SwapDiscState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_NumPlanes = DiscStateData1%NumPlanes
+   DiscStateData1%NumPlanes = DiscStateData2%NumPlanes
+   DiscStateData2%NumPlanes = tmp_NumPlanes
+   call move_alloc(DiscStateData1%xhat_plane, tmp_xhat_plane)
+   call move_alloc(DiscStateData2%xhat_plane, DiscStateData1%xhat_plane)
+   call move_alloc(tmp_xhat_plane, DiscStateData2%xhat_plane)
+   call move_alloc(DiscStateData1%YawErr_filt, tmp_YawErr_filt)
+   call move_alloc(DiscStateData2%YawErr_filt, DiscStateData1%YawErr_filt)
+   call move_alloc(tmp_YawErr_filt, DiscStateData2%YawErr_filt)
+   tmp_psi_skew_filt = DiscStateData1%psi_skew_filt
+   DiscStateData1%psi_skew_filt = DiscStateData2%psi_skew_filt
+   DiscStateData2%psi_skew_filt = tmp_psi_skew_filt
+   tmp_chi_skew_filt = DiscStateData1%chi_skew_filt
+   DiscStateData1%chi_skew_filt = DiscStateData2%chi_skew_filt
+   DiscStateData2%chi_skew_filt = tmp_chi_skew_filt
+   call move_alloc(DiscStateData1%V_plane_filt, tmp_V_plane_filt)
+   call move_alloc(DiscStateData2%V_plane_filt, DiscStateData1%V_plane_filt)
+   call move_alloc(tmp_V_plane_filt, DiscStateData2%V_plane_filt)
+   call move_alloc(DiscStateData1%p_plane, tmp_p_plane)
+   call move_alloc(DiscStateData2%p_plane, DiscStateData1%p_plane)
+   call move_alloc(tmp_p_plane, DiscStateData2%p_plane)
+   call move_alloc(DiscStateData1%x_plane, tmp_x_plane)
+   call move_alloc(DiscStateData2%x_plane, DiscStateData1%x_plane)
+   call move_alloc(tmp_x_plane, DiscStateData2%x_plane)
+   call move_alloc(DiscStateData1%Vx_wake, tmp_Vx_wake)
+   call move_alloc(DiscStateData2%Vx_wake, DiscStateData1%Vx_wake)
+   call move_alloc(tmp_Vx_wake, DiscStateData2%Vx_wake)
+   call move_alloc(DiscStateData1%Vr_wake, tmp_Vr_wake)
+   call move_alloc(DiscStateData2%Vr_wake, DiscStateData1%Vr_wake)
+   call move_alloc(tmp_Vr_wake, DiscStateData2%Vr_wake)
+   call move_alloc(DiscStateData1%Vx_wake2, tmp_Vx_wake2)
+   call move_alloc(DiscStateData2%Vx_wake2, DiscStateData1%Vx_wake2)
+   call move_alloc(tmp_Vx_wake2, DiscStateData2%Vx_wake2)
+   call move_alloc(DiscStateData1%Vy_wake2, tmp_Vy_wake2)
+   call move_alloc(DiscStateData2%Vy_wake2, DiscStateData1%Vy_wake2)
+   call move_alloc(tmp_Vy_wake2, DiscStateData2%Vy_wake2)
+   call move_alloc(DiscStateData1%Vz_wake2, tmp_Vz_wake2)
+   call move_alloc(DiscStateData2%Vz_wake2, DiscStateData1%Vz_wake2)
+   call move_alloc(tmp_Vz_wake2, DiscStateData2%Vz_wake2)
+   call move_alloc(DiscStateData1%Vx_wind_disk_filt, tmp_Vx_wind_disk_filt)
+   call move_alloc(DiscStateData2%Vx_wind_disk_filt, DiscStateData1%Vx_wind_disk_filt)
+   call move_alloc(tmp_Vx_wind_disk_filt, DiscStateData2%Vx_wind_disk_filt)
+   call move_alloc(DiscStateData1%TI_amb_filt, tmp_TI_amb_filt)
+   call move_alloc(DiscStateData2%TI_amb_filt, DiscStateData1%TI_amb_filt)
+   call move_alloc(tmp_TI_amb_filt, DiscStateData2%TI_amb_filt)
+   call move_alloc(DiscStateData1%D_rotor_filt, tmp_D_rotor_filt)
+   call move_alloc(DiscStateData2%D_rotor_filt, DiscStateData1%D_rotor_filt)
+   call move_alloc(tmp_D_rotor_filt, DiscStateData2%D_rotor_filt)
+   tmp_Vx_rel_disk_filt = DiscStateData1%Vx_rel_disk_filt
+   DiscStateData1%Vx_rel_disk_filt = DiscStateData2%Vx_rel_disk_filt
+   DiscStateData2%Vx_rel_disk_filt = tmp_Vx_rel_disk_filt
+   call move_alloc(DiscStateData1%Ct_azavg_filt, tmp_Ct_azavg_filt)
+   call move_alloc(DiscStateData2%Ct_azavg_filt, DiscStateData1%Ct_azavg_filt)
+   call move_alloc(tmp_Ct_azavg_filt, DiscStateData2%Ct_azavg_filt)
+   call move_alloc(DiscStateData1%Cq_azavg_filt, tmp_Cq_azavg_filt)
+   call move_alloc(DiscStateData2%Cq_azavg_filt, DiscStateData1%Cq_azavg_filt)
+   call move_alloc(tmp_Cq_azavg_filt, DiscStateData2%Cq_azavg_filt)
+end subroutine
+
 subroutine WD_DestroyDiscState(DiscStateData, ErrStat, ErrMsg)
    type(WD_DiscreteStateType), intent(inout) :: DiscStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -936,6 +1036,20 @@ subroutine WD_CopyConstrState(SrcConstrStateData, DstConstrStateData, CtrlCode,
    DstConstrStateData%DummyConstrState = SrcConstrStateData%DummyConstrState
 end subroutine
 
+subroutine WD_SwapConstrState(ConstrStateData1, ConstrStateData2, ErrStat, ErrMsg)
+   type(WD_ConstraintStateType), intent(inout) :: ConstrStateData1
+   type(WD_ConstraintStateType), intent(inout) :: ConstrStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_DummyConstrState
+   character(*), parameter        :: RoutineName = 'WD_SwapConstrState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_DummyConstrState = ConstrStateData1%DummyConstrState
+   ConstrStateData1%DummyConstrState = ConstrStateData2%DummyConstrState
+   ConstrStateData2%DummyConstrState = tmp_DummyConstrState
+end subroutine
+
 subroutine WD_DestroyConstrState(ConstrStateData, ErrStat, ErrMsg)
    type(WD_ConstraintStateType), intent(inout) :: ConstrStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -974,6 +1088,20 @@ subroutine WD_CopyOtherState(SrcOtherStateData, DstOtherStateData, CtrlCode, Err
    DstOtherStateData%firstPass = SrcOtherStateData%firstPass
 end subroutine
 
+subroutine WD_SwapOtherState(OtherStateData1, OtherStateData2, ErrStat, ErrMsg)
+   type(WD_OtherStateType), intent(inout) :: OtherStateData1
+   type(WD_OtherStateType), intent(inout) :: OtherStateData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   LOGICAL :: tmp_firstPass
+   character(*), parameter        :: RoutineName = 'WD_SwapOtherState'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_firstPass = OtherStateData1%firstPass
+   OtherStateData1%firstPass = OtherStateData2%firstPass
+   OtherStateData2%firstPass = tmp_firstPass
+end subroutine
+
 subroutine WD_DestroyOtherState(OtherStateData, ErrStat, ErrMsg)
    type(WD_OtherStateType), intent(inout) :: OtherStateData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -1696,6 +1824,64 @@ subroutine WD_CopyInput(SrcInputData, DstInputData, CtrlCode, ErrStat, ErrMsg)
    end if
 end subroutine
 
+subroutine WD_SwapInput(InputData1, InputData2, ErrStat, ErrMsg)
+   type(WD_InputType), intent(inout) :: InputData1
+   type(WD_InputType), intent(inout) :: InputData2
+   integer(IntKi),  intent(  out) :: ErrStat
+   character(*),    intent(  out) :: ErrMsg
+   REAL(ReKi) :: tmp_xhat_disk(1:3)
+   REAL(ReKi) :: tmp_YawErr
+   REAL(ReKi) :: tmp_psi_skew
+   REAL(ReKi) :: tmp_chi_skew
+   REAL(ReKi) :: tmp_p_hub(1:3)
+   REAL(ReKi), allocatable :: tmp_V_plane(:,:)
+   REAL(ReKi) :: tmp_Vx_wind_disk
+   REAL(ReKi) :: tmp_TI_amb
+   REAL(ReKi) :: tmp_D_rotor
+   REAL(ReKi) :: tmp_Vx_rel_disk
+   REAL(ReKi), allocatable :: tmp_Ct_azavg(:)
+   REAL(ReKi), allocatable :: tmp_Cq_azavg(:)
+   character(*), parameter        :: RoutineName = 'WD_SwapInput'
+   ErrStat = ErrID_None
+   ErrMsg  = ''
+   tmp_xhat_disk = InputData1%xhat_disk
+   InputData1%xhat_disk = InputData2%xhat_disk
+   InputData2%xhat_disk = tmp_xhat_disk
+   tmp_YawErr = InputData1%YawErr
+   InputData1%YawErr = InputData2%YawErr
+   InputData2%YawErr = tmp_YawErr
+   tmp_psi_skew = InputData1%psi_skew
+   InputData1%psi_skew = InputData2%psi_skew
+   InputData2%psi_skew = tmp_psi_skew
+   tmp_chi_skew = InputData1%chi_skew
+   InputData1%chi_skew = InputData2%chi_skew
+   InputData2%chi_skew = tmp_chi_skew
+   tmp_p_hub = InputData1%p_hub
+   InputData1%p_hub = InputData2%p_hub
+   InputData2%p_hub = tmp_p_hub
+   call move_alloc(InputData1%V_plane, tmp_V_plane)
+   call move_alloc(InputData2%V_plane, InputData1%V_plane)
+   call move_alloc(tmp_V_plane, InputData2%V_plane)
+   tmp_Vx_wind_disk = InputData1%Vx_wind_disk
+   InputData1%Vx_wind_disk = InputData2%Vx_wind_disk
+   InputData2%Vx_wind_disk = tmp_Vx_wind_disk
+   tmp_TI_amb = InputData1%TI_amb
+   InputData1%TI_amb = InputData2%TI_amb
+   InputData2%TI_amb = tmp_TI_amb
+   tmp_D_rotor = InputData1%D_rotor
+   InputData1%D_rotor = InputData2%D_rotor
+   InputData2%D_rotor = tmp_D_rotor
+   tmp_Vx_rel_disk = InputData1%Vx_rel_disk
+   InputData1%Vx_rel_disk = InputData2%Vx_rel_disk
+   InputData2%Vx_rel_disk = tmp_Vx_rel_disk
+   call move_alloc(InputData1%Ct_azavg, tmp_Ct_azavg)
+   call move_alloc(InputData2%Ct_azavg, InputData1%Ct_azavg)
+   call move_alloc(tmp_Ct_azavg, InputData2%Ct_azavg)
+   call move_alloc(InputData1%Cq_azavg, tmp_Cq_azavg)
+   call move_alloc(InputData2%Cq_azavg, InputData1%Cq_azavg)
+   call move_alloc(tmp_Cq_azavg, InputData2%Cq_azavg)
+end subroutine
+
 subroutine WD_DestroyInput(InputData, ErrStat, ErrMsg)
    type(WD_InputType), intent(inout) :: InputData
    integer(IntKi),  intent(  out) :: ErrStat
@@ -32,7 +32,7 @@ class FASTOutputFile():
     - read, write, toDataFrame
     """
 
-    def __init__(self, filename=None, method='numpy'):
+    def __init__(self, filename=None, method='numpy', channels=None):
         """
         Load a FAST binary or ascii output file
 
@@ -40,6 +40,9 @@ class FASTOutputFile():
         ----------
         filename : str
             filename
+        channels : list of str, optional
+            names of the channels to read from a binary file (the time channel is always returned).
+            Only these channels are read from columnar binary files.
 
         Returns
         -------
@@ -66,7 +69,7 @@ class FASTOutputFile():
             self.data, self.info = load_ascii_output(filename)
 
         elif ext == '.outb':
-            self.data, self.info, self.pack = load_binary_output(filename)
+            self.data, self.info, self.pack = load_binary_output(filename, channels=channels)
 
         else:
             raise ValueError(f'File extension, {ext}, not supported')
@@ -114,13 +117,16 @@ def load_ascii_output(filename, headerLines = 8, descriptionLine = 4, attributeL
         data = np.array([line.split(delimiter) for line in f.readlines()], dtype=float)
         return data, info
 
-def load_binary_output(filename):
+def load_binary_output(filename, channels=None):
     """
     Ported from ReadFASTbinary.m by Mads M Pedersen, DTU Wind
     Info about ReadFASTbinary.m:
     Author: Bonnie Jonkman, National Renewable Energy Laboratory
     (c) 2012, National Renewable Energy Laboratory
     Edited for FAST v7.02.00b-bjj  22-Oct-2012
+
+    If channels (a list of channel names) is given, only those channels (and time) are returned.
+    In columnar files (FileFmtID_Columnar), only the blocks of the requested channels are read.
     """
 
     def fread(fid, n, type):
@@ -131,11 +137,16 @@ def load_binary_output(filename):
     FileFmtID_WithoutTime = 2
     FileFmtID_NoCompressWithoutTime = 3
     FileFmtID_ChanLen_In = 4
+    FileFmtID_Columnar = 5
+
+    BinColEnc_Const = 0       # Channel block encodings used in FileFmtID_Columnar files
+    BinColEnc_R4 = 1
+    BinColEnc_R8 = 2
     
     with open(filename, 'rb') as fid:
         FileID = fread(fid, 1, 'int16')[0]       # FAST output file format, INT(2)
         
-        if FileID == FileFmtID_ChanLen_In:
+        if FileID in (FileFmtID_ChanLen_In, FileFmtID_Columnar):
             LenName  = fread(fid, 1, 'int16')[0] # Number of characters in channel names and units
         else:
             LenName = 10                         # default number of characters per channel name
@@ -151,7 +162,7 @@ def load_binary_output(filename):
             TimeOut1 = fread(fid, 1, 'float64')  # The first time in the time series, REAL(8)
             TimeIncr = fread(fid, 1, 'float64')  # The time increment, REAL(8)
 
-        if FileID != FileFmtID_NoCompressWithoutTime:
+        if FileID not in (FileFmtID_NoCompressWithoutTime, FileFmtID_Columnar):
             ColScl = fread(fid, NumOutChans, 'float32')  # The channel slopes for scaling, REAL(4)
             ColOff = fread(fid, NumOutChans, 'float32')  # The channel offsets for scaling, REAL(4)
 
@@ -169,6 +180,14 @@ def load_binary_output(filename):
             ChanUnitASCII = fread(fid, LenName, 'uint8')  # ChanUnit converted to numeric ASCII
             ChanUnit.append("".join(map(chr, ChanUnitASCII)).strip()[1:-1])
 
+        if channels is None:
+            iChans = list(range(NumOutChans))
+        else:
+            missing = [c for c in channels if c not in ChanName[1:]]
+            if len(missing) > 0:
+                raise Exception('Channels %s not found in %s' % (missing, filename))
+            iChans = [ChanName.index(c, 1) - 1 for c in channels]
+
         # get the channel time series
         nPts = NT * NumOutChans                   # number of data points in the file
         if FileID == FileFmtID_WithTime:
@@ -177,22 +196,38 @@ def load_binary_output(filename):
             if cnt < NT:
                 raise Exception('Could not read entire %s file: read %d of %d time values' % (filename, cnt, NT))
         
-        if FileID == FileFmtID_NoCompressWithoutTime:
-            PackedData = fread(fid, nPts, 'float64')    # read the channel data
+        if FileID == FileFmtID_Columnar:
+            # the channel index follows the units; each channel is stored in a contiguous block
+            ChanEnc = fread(fid, NumOutChans, 'int16')
+            ChanPos = struct.unpack('q' * NumOutChans, fid.read(8 * NumOutChans))
+            pack = np.empty((NT, len(iChans)))
+            for j, iChan in enumerate(iChans):
+                fid.seek(ChanPos[iChan] - 1)  # Fortran stream positions start at 1
+                if ChanEnc[iChan] == BinColEnc_Const:
+                    pack[:, j] = fread(fid, 1, 'float64')[0]
+                elif ChanEnc[iChan] == BinColEnc_R4:
+                    pack[:, j] = np.frombuffer(fid.read(4 * NT), dtype=np.float32)
+                else:
+                    pack[:, j] = np.frombuffer(fid.read(8 * NT), dtype=np.float64)
         else:
-            PackedData = fread(fid, nPts, 'int16')    # read the channel data
-            
-        cnt = len(PackedData)
-        if cnt < nPts:
-            raise Exception('Could not read entire %s file: read %d of %d values' % (filename, cnt, nPts))
+            if FileID == FileFmtID_NoCompressWithoutTime:
+                PackedData = fread(fid, nPts, 'float64')    # read the channel data
+            else:
+                PackedData = fread(fid, nPts, 'int16')    # read the channel data
+                
+            cnt = len(PackedData)
+            if cnt < nPts:
+                raise Exception('Could not read entire %s file: read %d of %d values' % (filename, cnt, nPts))
 
-    if FileID == FileFmtID_NoCompressWithoutTime:
-        pack = np.array(PackedData).reshape(NT, NumOutChans)
+    if FileID == FileFmtID_Columnar:
+        data = pack
+    elif FileID == FileFmtID_NoCompressWithoutTime:
+        pack = np.array(PackedData).reshape(NT, NumOutChans)[:, iChans]
         data = pack
     else:
         # Scale the packed binary to real data
-        pack = np.array(PackedData).reshape(NT, NumOutChans)
-        data = (pack - ColOff) / ColScl
+        pack = np.array(PackedData).reshape(NT, NumOutChans)[:, iChans]
+        data = (pack - np.array(ColOff)[iChans]) / np.array(ColScl)[iChans]
 
     if FileID == FileFmtID_WithTime:
         time = (np.array(PackedTime) - TimeOff) / TimeScl;
@@ -204,12 +239,11 @@ def load_binary_output(filename):
 
     info = {'name': os.path.splitext(os.path.basename(filename))[0],
             'description': DescStr,
-            'attribute_names': ChanName,
-            'attribute_units': ChanUnit}
+            'attribute_names': [ChanName[0]] + [ChanName[i + 1] for i in iChans],
+            'attribute_units': [ChanUnit[0]] + [ChanUnit[i + 1] for i in iChans]}
     return data, info, pack
 
 
-
 if __name__=="__main__":
 
     from openfast_io.FileTools import check_rtest_cloned